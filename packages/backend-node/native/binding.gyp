@@ -9,7 +9,26 @@
       "sources": [
         "src/addon.cc",
         "src/addon_common.cc",
+        "src/cancellation.cc",
         "src/cell_handles.cc",
+        "src/cspice_executor.cc",
+        "src/coverage_index.cc",
+        "src/dsk_bvh.cc",
+        "src/ephemeris_table.cc",
+        "src/frame_cache.cc",
+        "src/id_cache.cc",
+        "src/instance_data.cc",
+        "src/kernel_set.cc",
+        "src/lazy_kernels.cc",
+        "src/leapseconds.cc",
+        "src/native_memory.cc",
+        "src/native_stats.cc",
+        "src/native_trace.cc",
+        "src/pool_generation.cc",
+        "src/query_cache.cc",
+        "src/sclk_model.cc",
+        "src/spk_evaluator.cc",
+        "src/text_kernel.cc",
         "src/domains/kernels.cc",
         "src/domains/kernel_pool.cc",
         "src/domains/ek.cc",
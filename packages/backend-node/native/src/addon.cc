@@ -1,5 +1,7 @@
 #include <napi.h>
 
+#include "cancellation.h"
+#include "cspice_executor.h"
 #include "domains/coords_vectors.h"
 #include "domains/error.h"
 #include "domains/cells_windows.h"
@@ -14,6 +16,11 @@
 #include "domains/kernels.h"
 #include "domains/kernel_pool.h"
 #include "domains/time.h"
+#include "instance_data.h"
+#include "native_stats.h"
+#include "native_trace.h"
+#include "pool_generation.h"
+#include "query_cache.h"
 
 // Forces a rebuild/relink when the resolved CSPICE install changes (cache/toolkit bump
 // or TSPICE_CSPICE_DIR override).
@@ -30,6 +37,12 @@ static Napi::Object Init(Napi::Env env, Napi::Object exports) {
     return !env.IsExceptionPending();
   };
 
+  // Per-environment handle tables; every domain below may reach for them.
+  tspice_backend_node::InitInstanceData(env);
+
+  // Next, so the stats and trace flags are settled before any export can take the CSPICE lock.
+  if (!registerDomain(tspice_backend_node::RegisterNativeStats)) return exports;
+  if (!registerDomain(tspice_backend_node::RegisterNativeTrace)) return exports;
   if (!registerDomain(tspice_backend_node::RegisterKernels)) return exports;
   if (!registerDomain(tspice_backend_node::RegisterKernelPool)) return exports;
   if (!registerDomain(tspice_backend_node::RegisterTime)) return exports;
@@ -44,6 +57,13 @@ static Napi::Object Init(Napi::Env env, Napi::Object exports) {
   if (!registerDomain(tspice_backend_node::RegisterCellsWindows)) return exports;
   if (!registerDomain(tspice_backend_node::RegisterEk)) return exports;
   if (!registerDomain(tspice_backend_node::RegisterDsk)) return exports;
+  if (!registerDomain(tspice_backend_node::RegisterCspiceExecutor)) return exports;
+  if (!registerDomain(tspice_backend_node::RegisterCancellation)) return exports;
+  if (!registerDomain(tspice_backend_node::RegisterPoolGeneration)) return exports;
+  if (!registerDomain(tspice_backend_node::RegisterQueryCache)) return exports;
+
+  // Last, so it sees every export.
+  tspice_backend_node::InstrumentExports(env, exports);
 
   return exports;
 }
@@ -1,5 +1,6 @@
 #include "addon_common.h"
 
+#include <cstring>
 #include <string>
 
 #include "napi_helpers.h"
@@ -31,8 +32,23 @@ bool ReadNumberArrayFixed(
     return false;
   }
 
+  // Fast path: a Float64Array is copied in one shot instead of boxing each element through
+  // `Get()`.
+  if (value.IsTypedArray() && value.As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+    Napi::Float64Array typed = value.As<Napi::Float64Array>();
+    if (typed.ElementLength() != expectedLength) {
+      ThrowSpiceError(Napi::TypeError::New(
+          env,
+          std::string(safeName) + " must have length " + std::to_string(expectedLength)));
+      return false;
+    }
+    std::memcpy(out, typed.Data(), expectedLength * sizeof(double));
+    return true;
+  }
+
   if (!value.IsArray()) {
-    ThrowSpiceError(Napi::TypeError::New(env, std::string(safeName) + " must be an array"));
+    ThrowSpiceError(
+        Napi::TypeError::New(env, std::string(safeName) + " must be an array or Float64Array"));
     return false;
   }
 
@@ -2,8 +2,11 @@
 
 #include <napi.h>
 
+#include <cstdint>
 #include <mutex>
 
+#include "native_stats.h"
+
 // Shared globals/helpers used across multiple domain spokes.
 
 namespace tspice_backend_node {
@@ -16,15 +19,33 @@ extern std::mutex g_cspice_mutex;
 // Note: this is intentionally a non-copyable, non-movable "token" type. Code
 // that mutates/reads shared registries should require a `const CspiceLock&`
 // parameter so the locking requirement is enforced at compile time.
+//
+// With native stats or tracing enabled (see `native_stats.h`) the wait for and hold of the mutex
+// are timed.
 class CspiceLock {
 public:
-  CspiceLock() : lock_(g_cspice_mutex) {}
+  CspiceLock() {
+    if (NativeInstrumentationEnabled()) {
+      acquiredNs_ = LockCspiceMutexTimed();
+    } else {
+      g_cspice_mutex.lock();
+    }
+  }
+
+  ~CspiceLock() {
+    if (acquiredNs_ != 0) {
+      UnlockCspiceMutexTimed(acquiredNs_);
+    } else {
+      g_cspice_mutex.unlock();
+    }
+  }
 
   CspiceLock(const CspiceLock&) = delete;
   CspiceLock& operator=(const CspiceLock&) = delete;
 
 private:
-  std::lock_guard<std::mutex> lock_;
+  // Nonzero only for a timed acquisition.
+  uint64_t acquiredNs_ = 0;
 };
 
 inline constexpr int kErrMaxBytes = 2048;
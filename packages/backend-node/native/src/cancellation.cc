@@ -0,0 +1,167 @@
+#include "cancellation.h"
+
+#include <cmath>
+
+#include "instance_data.h"
+#include "napi_helpers.h"
+#include "tspice_backend_shim.h"
+
+using tspice_napi::SetExportChecked;
+using tspice_napi::ThrowSpiceError;
+
+namespace tspice_backend_node {
+
+namespace {
+
+// Longest accepted `timeoutMs` (~24.8 days, the largest `setTimeout` delay).
+constexpr double kMaxTimeoutMs = 2147483647.0;
+
+bool ReadTokenId(Napi::Env env, const Napi::Value& value, const char* name, uint32_t* out) {
+  if (!value.IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + "(): expected token to be a number"));
+    return false;
+  }
+  const double d = value.As<Napi::Number>().DoubleValue();
+  if (!std::isfinite(d) || std::floor(d) != d || d < 1 || d > 4294967295.0) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): expected token to be a non-zero uint32"));
+    return false;
+  }
+  *out = (uint32_t)d;
+  return true;
+}
+
+}  // namespace
+
+CancelReason CallCancellation::Check() const {
+  if (flag_ && flag_->cancelled.load(std::memory_order_acquire)) return CancelReason::kCancelled;
+  if (hasDeadline_ && std::chrono::steady_clock::now() >= deadline_) return CancelReason::kDeadlineExceeded;
+  return CancelReason::kNone;
+}
+
+bool ReadCallCancellation(Napi::Env env, const Napi::Value& value, const char* name, CallCancellation* out) {
+  *out = CallCancellation();
+  if (value.IsUndefined()) return true;
+  if (!value.IsObject()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, std::string(name) + "(): expected options to be { token?: number, timeoutMs?: number } or undefined"));
+    return false;
+  }
+  Napi::Object options = value.As<Napi::Object>();
+
+  Napi::Value token = options.Get("token");
+  if (env.IsExceptionPending()) return false;
+  if (!token.IsUndefined()) {
+    uint32_t id = 0;
+    if (!ReadTokenId(env, token, name, &id)) return false;
+    const auto& tokens = GetInstanceData(env).cancelTokens;
+    auto it = tokens.find(id);
+    if (it == tokens.end()) {
+      ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): unknown cancel token " + std::to_string(id)));
+      return false;
+    }
+    out->flag_ = it->second;
+  }
+
+  Napi::Value timeoutMs = options.Get("timeoutMs");
+  if (env.IsExceptionPending()) return false;
+  if (!timeoutMs.IsUndefined()) {
+    if (!timeoutMs.IsNumber()) {
+      ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + "(): expected timeoutMs to be a number"));
+      return false;
+    }
+    const double ms = timeoutMs.As<Napi::Number>().DoubleValue();
+    if (!(ms >= 0) || ms > kMaxTimeoutMs) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env, std::string(name) + "(): expected timeoutMs to be between 0 and " + std::to_string((long long)kMaxTimeoutMs)));
+      return false;
+    }
+    out->hasDeadline_ = true;
+    out->deadline_ = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(ms));
+  }
+  return true;
+}
+
+InterruptScope::InterruptScope(const CspiceLock& /*lock*/, const CallCancellation& cancellation)
+    : cancellation_(cancellation) {
+  if (cancellation_.active()) {
+    tspice_set_interrupt_hook(&InterruptScope::Poll, this);
+    installed_ = true;
+  }
+}
+
+InterruptScope::~InterruptScope() {
+  if (installed_) tspice_set_interrupt_hook(nullptr, nullptr);
+}
+
+int InterruptScope::Poll(void* ctx) {
+  auto* scope = static_cast<InterruptScope*>(ctx);
+  if (scope->reason_ == CancelReason::kNone) scope->reason_ = scope->cancellation_.Check();
+  return scope->reason_ != CancelReason::kNone;
+}
+
+Napi::Error MakeCancellationError(Napi::Env env, const std::string& name, CancelReason reason) {
+  const bool cancelled = reason == CancelReason::kCancelled;
+  Napi::Error error = Napi::Error::New(env, name + (cancelled ? "(): cancelled" : "(): deadline exceeded"));
+  error.Value().Set("name", Napi::String::New(env, cancelled ? "AbortError" : "TimeoutError"));
+  return error;
+}
+
+}  // namespace tspice_backend_node
+
+static Napi::Value NewCancelToken(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "newCancelToken() does not take any arguments"));
+    return env.Undefined();
+  }
+
+  tspice_backend_node::InstanceData& data = tspice_backend_node::GetInstanceData(env);
+  uint32_t id = data.nextCancelToken;
+  // Skip 0 and ids still in use after wrapping around.
+  while (id == 0 || data.cancelTokens.count(id) != 0) id++;
+  data.nextCancelToken = id + 1;
+  data.cancelTokens.emplace(id, std::make_shared<tspice_backend_node::CancelFlag>());
+  return Napi::Number::New(env, (double)id);
+}
+
+static void CancelToken(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "cancelToken(token: number) expects 1 argument"));
+    return;
+  }
+  uint32_t id = 0;
+  if (!tspice_backend_node::ReadTokenId(env, info[0], "cancelToken", &id)) return;
+
+  // Cancelling a freed token is a no-op: whatever it guarded has already settled.
+  const auto& tokens = tspice_backend_node::GetInstanceData(env).cancelTokens;
+  auto it = tokens.find(id);
+  if (it != tokens.end()) it->second->cancelled.store(true, std::memory_order_release);
+}
+
+static void FreeCancelToken(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "freeCancelToken(token: number) expects 1 argument"));
+    return;
+  }
+  uint32_t id = 0;
+  if (!tspice_backend_node::ReadTokenId(env, info[0], "freeCancelToken", &id)) return;
+
+  // In-flight calls keep their own reference to the flag.
+  tspice_backend_node::GetInstanceData(env).cancelTokens.erase(id);
+}
+
+namespace tspice_backend_node {
+
+void RegisterCancellation(Napi::Env env, Napi::Object exports) {
+  if (!SetExportChecked(env, exports, "newCancelToken", Napi::Function::New(env, NewCancelToken), __func__)) return;
+  if (!SetExportChecked(env, exports, "cancelToken", Napi::Function::New(env, CancelToken), __func__)) return;
+  if (!SetExportChecked(env, exports, "freeCancelToken", Napi::Function::New(env, FreeCancelToken), __func__)) return;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <napi.h>
+
+#include "addon_common.h"
+
+namespace tspice_backend_node {
+
+// Per-call deadlines and cancellation for long native calls.
+//
+// Calls that support it take a trailing options object `{ token?: number, timeoutMs?: number }`,
+// read on the JS thread when the call is made. `timeoutMs` becomes a steady-clock deadline counted
+// from then (time spent queued for the CSPICE mutex counts against it); `token` names a flag from
+// `newCancelToken()` that `cancelToken(id)` sets from JS while the call is in flight.
+//
+// Stopping is cooperative. While the call holds the CSPICE lock, `InterruptScope` installs the
+// check as the shim's interrupt hook (`tspice_set_interrupt_hook`): GF searches poll it through
+// gfevnt_c's bail hook and batch loops poll it between items, so the lock is released soon after
+// the flag is set or the deadline passes. An async call that is already cancelled or late when it
+// gets the lock does not start.
+
+enum class CancelReason : uint8_t {
+  kNone = 0,
+  kCancelled = 1,
+  kDeadlineExceeded = 2,
+};
+
+struct CancelFlag {
+  std::atomic<bool> cancelled{false};
+};
+
+class CallCancellation {
+ public:
+  // False when the call was made without a token or a deadline.
+  bool active() const { return flag_ != nullptr || hasDeadline_; }
+
+  // Safe from any thread.
+  CancelReason Check() const;
+
+ private:
+  friend bool ReadCallCancellation(
+      Napi::Env env, const Napi::Value& value, const char* name, CallCancellation* out);
+
+  std::shared_ptr<CancelFlag> flag_;
+  bool hasDeadline_ = false;
+  std::chrono::steady_clock::time_point deadline_;
+};
+
+// Reads an options argument (`undefined` or `{ token?, timeoutMs? }`) into `out`. Throws a
+// TypeError / RangeError and returns false on a malformed value or an unknown token.
+bool ReadCallCancellation(Napi::Env env, const Napi::Value& value, const char* name, CallCancellation* out);
+
+// Installs `cancellation` as the shim's interrupt hook for the lifetime of the scope (no-op when it
+// is inactive). Requires the CSPICE lock, which must outlive the scope.
+class InterruptScope {
+ public:
+  InterruptScope(const CspiceLock& lock, const CallCancellation& cancellation);
+  ~InterruptScope();
+
+  InterruptScope(const InterruptScope&) = delete;
+  InterruptScope& operator=(const InterruptScope&) = delete;
+
+  // Why the hook first asked to stop, or kNone.
+  CancelReason reason() const { return reason_; }
+
+ private:
+  static int Poll(void* ctx);
+
+  const CallCancellation& cancellation_;
+  CancelReason reason_ = CancelReason::kNone;
+  bool installed_ = false;
+};
+
+// `<name>(): cancelled` (name "AbortError") or `<name>(): deadline exceeded` (name "TimeoutError").
+Napi::Error MakeCancellationError(Napi::Env env, const std::string& name, CancelReason reason);
+
+// Registers `newCancelToken()`, `cancelToken(id)` and `freeCancelToken(id)`.
+void RegisterCancellation(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
@@ -3,17 +3,134 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
+#include "instance_data.h"
 #include "napi_helpers.h"
 
 using tspice_napi::ThrowSpiceError;
 
 namespace tspice_backend_node {
 
-static uint32_t g_next_cell_handle = 1;
-static std::unordered_map<uint32_t, uintptr_t> g_cell_handles;
+// Generational-index handle table.
+//
+// A handle packs `generation << kSlotBits | slot`. Freeing a handle bumps its slot's generation and
+// queues the slot at the tail of a FIFO free list, so add/lookup/remove are O(1) and a stale handle
+// is rejected until its slot has been recycled 2^kGenerationBits - 1 times. Generations start at 1,
+// so `0` is never a valid handle. The top bit stays clear because the JS layer validates handles as
+// non-negative int32 values.
+constexpr uint32_t kSlotBits = 20;
+constexpr uint32_t kGenerationBits = 31 - kSlotBits;
+constexpr uint32_t kMaxSlots = 1u << kSlotBits;
+constexpr uint32_t kSlotMask = kMaxSlots - 1;
+constexpr uint32_t kMaxGeneration = (1u << kGenerationBits) - 1;
+
+const CellHandleTable::Slot *CellHandleTable::FindLive(uint32_t handle) const {
+  const uint32_t index = handle & kSlotMask;
+  const uint32_t generation = handle >> kSlotBits;
+  if (index >= slots_.size()) {
+    return nullptr;
+  }
+  const Slot& slot = slots_[index];
+  if (slot.allocation.ptr == 0 || slot.generation != generation) {
+    return nullptr;
+  }
+  return &slot;
+}
+
+uint32_t CellHandleTable::Add(const Allocation& allocation) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  uint32_t index = 0;
+  if (freeHead_ != kNoSlot) {
+    index = freeHead_;
+    freeHead_ = slots_[index].nextFree;
+    if (freeHead_ == kNoSlot) {
+      freeTail_ = kNoSlot;
+    }
+  } else if (slots_.size() < kMaxSlots) {
+    index = (uint32_t)slots_.size();
+    slots_.emplace_back();
+  } else {
+    return 0;
+  }
+
+  Slot& slot = slots_[index];
+  slot.allocation = allocation;
+  slot.nextFree = kNoSlot;
+  return (slot.generation << kSlotBits) | index;
+}
+
+bool CellHandleTable::TryGet(uint32_t handle, uintptr_t *outPtr) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  const Slot *slot = FindLive(handle);
+  if (slot == nullptr) {
+    return false;
+  }
+  if (outPtr != nullptr) {
+    *outPtr = slot->allocation.ptr;
+  }
+  return true;
+}
+
+bool CellHandleTable::Remove(uint32_t handle, Allocation *outAllocation) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  Slot *slot = const_cast<Slot *>(FindLive(handle));
+  if (slot == nullptr) {
+    return false;
+  }
+  if (outAllocation != nullptr) {
+    *outAllocation = slot->allocation;
+  }
+
+  slot->allocation = Allocation();
+  slot->pins = 0;
+  slot->generation = slot->generation == kMaxGeneration ? 1 : slot->generation + 1;
+
+  const uint32_t index = handle & kSlotMask;
+  if (freeTail_ == kNoSlot) {
+    freeHead_ = index;
+  } else {
+    slots_[freeTail_].nextFree = index;
+  }
+  freeTail_ = index;
+  return true;
+}
+
+std::vector<CellHandleTable::Allocation> CellHandleTable::LiveAllocations() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  std::vector<Allocation> out;
+  for (const Slot& slot : slots_) {
+    if (slot.allocation.ptr != 0) out.push_back(slot.allocation);
+  }
+  return out;
+}
+
+void CellHandleTable::Clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  slots_.clear();
+  freeHead_ = kNoSlot;
+  freeTail_ = kNoSlot;
+}
+
+bool CellHandleTable::Pin(uint32_t handle) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  Slot *slot = const_cast<Slot *>(FindLive(handle));
+  if (slot == nullptr) {
+    return false;
+  }
+  slot->pins++;
+  return true;
+}
+
+void CellHandleTable::Unpin(uint32_t handle) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  Slot *slot = const_cast<Slot *>(FindLive(handle));
+  if (slot != nullptr && slot->pins != 0) {
+    slot->pins--;
+  }
+}
 
 static std::string SpiceDataTypeToString(SpiceDataType dtype) {
   switch (dtype) {
@@ -32,68 +149,56 @@ static std::string SpiceDataTypeToString(SpiceDataType dtype) {
   }
 }
 
-uint32_t AddCellHandle(const CspiceLock& lock, Napi::Env env, uintptr_t ptr, const char *context) {
+// Element storage (control area included) plus the header, as allocated by the shim.
+static size_t SpiceCellBytes(uintptr_t ptr) {
+  const SpiceCell *cell = reinterpret_cast<const SpiceCell *>(ptr);
+  size_t element = sizeof(SpiceInt);
+  if (cell->dtype == SPICE_DP) {
+    element = sizeof(SpiceDouble);
+  } else if (cell->dtype == SPICE_CHR) {
+    element = (size_t)cell->length;
+  }
+  return sizeof(SpiceCell) + (size_t)(SPICE_CELL_CTRLSZ + cell->size) * element;
+}
+
+uint32_t AddCellHandle(
+    const CspiceLock& lock,
+    Napi::Env env,
+    uintptr_t ptr,
+    const char *context,
+    NativeMemoryKind kind) {
   (void)lock;
   const char *ctx = (context != nullptr && context[0] != '\0') ? context : "AddCellHandle";
 
-  // `0` is reserved as a sentinel/invalid handle.
-  //
-  // Note: a `uint32_t` has 2^32 possible values, so the space of non-zero
-  // handles is `UINT32_MAX`.
-  const size_t kMaxNonZeroHandles = (size_t)std::numeric_limits<uint32_t>::max();
-  if (g_cell_handles.size() >= kMaxNonZeroHandles) {
-    ThrowSpiceError(env, std::string(ctx) + ": exhausted SpiceCell handle space (uint32)");
+  CellHandleTable::Allocation allocation;
+  allocation.ptr = ptr;
+  allocation.bytes = SpiceCellBytes(ptr);
+  allocation.kind = kind;
+  const uint32_t handle = GetInstanceData(env).cells->Add(allocation);
+  if (handle == 0) {
+    ThrowSpiceError(env, std::string(ctx) + ": exhausted SpiceCell handle space (" +
+        std::to_string(kMaxSlots) + " live handles)");
     return 0;
   }
-
-  // `g_next_cell_handle` is a `uint32_t` and will wrap around. When that
-  // happens, we must ensure we don't reuse a handle that's still live.
-  for (size_t attempts = 0; attempts < kMaxNonZeroHandles; attempts++) {
-    uint32_t handle = g_next_cell_handle++;
-    if (handle == 0) {
-      handle = g_next_cell_handle++;
-    }
-
-    if (handle == 0) {
-      // Defensive: if we ever generate 0 again due to wraparound quirks, skip.
-      continue;
-    }
-
-    if (g_cell_handles.find(handle) != g_cell_handles.end()) {
-      continue;
-    }
-
-    g_cell_handles.emplace(handle, ptr);
-    return handle;
-  }
-
-  // Should be unreachable due to the size check above.
-  ThrowSpiceError(env, std::string(ctx) + ": failed to allocate a unique SpiceCell handle");
-  return 0;
+  TrackNativeAllocation(env, kind, allocation.bytes);
+  return handle;
 }
 
-bool TryGetCellPtr(const CspiceLock& lock, uint32_t handle, uintptr_t *outPtr) {
+bool TryGetCellPtr(const CspiceLock& lock, Napi::Env env, uint32_t handle, uintptr_t *outPtr) {
   (void)lock;
-  auto it = g_cell_handles.find(handle);
-  if (it == g_cell_handles.end()) {
-    return false;
-  }
-  if (outPtr != nullptr) {
-    *outPtr = it->second;
-  }
-  return true;
+  return GetInstanceData(env).cells->TryGet(handle, outPtr);
 }
 
-bool RemoveCellPtr(const CspiceLock& lock, uint32_t handle, uintptr_t *outPtr) {
+bool RemoveCellPtr(const CspiceLock& lock, Napi::Env env, uint32_t handle, uintptr_t *outPtr) {
   (void)lock;
-  auto it = g_cell_handles.find(handle);
-  if (it == g_cell_handles.end()) {
+  CellHandleTable::Allocation allocation;
+  if (!GetInstanceData(env).cells->Remove(handle, &allocation)) {
     return false;
   }
+  TrackNativeRelease(env, allocation.kind, allocation.bytes);
   if (outPtr != nullptr) {
-    *outPtr = it->second;
+    *outPtr = allocation.ptr;
   }
-  g_cell_handles.erase(it);
   return true;
 }
 
@@ -128,7 +233,7 @@ uintptr_t GetCellHandlePtrOrThrow(
     const char *kindLabel) {
   (void)lock;
   uintptr_t ptr = 0;
-  if (!TryGetCellPtr(lock, handle, &ptr)) {
+  if (!TryGetCellPtr(lock, env, handle, &ptr)) {
     const std::string ctx = (context != nullptr && context[0] != '\0') ? std::string(context) : std::string("call");
     const std::string kind = (kindLabel != nullptr && kindLabel[0] != '\0') ? std::string(kindLabel)
                                                                               : std::string("SpiceCell");
@@ -139,30 +244,66 @@ uintptr_t GetCellHandlePtrOrThrow(
   return ptr;
 }
 
-uintptr_t GetCellHandlePtrOrThrow(
+uintptr_t ResolveCellHandlePtr(
     const CspiceLock& lock,
-    Napi::Env env,
+    const CellHandleTable& cells,
     uint32_t handle,
     SpiceDataType expectedDtype,
     const char *context,
-    const char *kindLabel) {
-  const uintptr_t ptr = GetCellHandlePtrOrThrow(lock, env, handle, context, kindLabel);
-  if (env.IsExceptionPending() || ptr == 0) {
+    const char *kindLabel,
+    std::string *outError,
+    bool *outIsTypeError) {
+  const std::string ctx =
+      (context != nullptr && context[0] != '\0') ? std::string(context) : std::string("call");
+  const std::string kind = (kindLabel != nullptr && kindLabel[0] != '\0') ? std::string(kindLabel)
+                                                                            : std::string("SpiceCell");
+
+  (void)lock;
+  uintptr_t ptr = 0;
+  if (!cells.TryGet(handle, &ptr)) {
+    if (outError != nullptr) {
+      *outError = ctx + ": unknown/expired " + kind + " handle: " + std::to_string(handle);
+    }
+    if (outIsTypeError != nullptr) {
+      *outIsTypeError = false;
+    }
     return 0;
   }
 
   const SpiceDataType actualDtype = reinterpret_cast<SpiceCell *>(ptr)->dtype;
   if (actualDtype != expectedDtype) {
-    const std::string ctx =
-        (context != nullptr && context[0] != '\0') ? std::string(context) : std::string("call");
-    const std::string kind = (kindLabel != nullptr && kindLabel[0] != '\0') ? std::string(kindLabel)
-                                                                              : std::string("SpiceCell");
+    if (outError != nullptr) {
+      *outError = ctx + ": " + kind + " handle has wrong dtype (expected " +
+          SpiceDataTypeToString(expectedDtype) + ", got " + SpiceDataTypeToString(actualDtype) +
+          "): " + std::to_string(handle);
+    }
+    if (outIsTypeError != nullptr) {
+      *outIsTypeError = true;
+    }
+    return 0;
+  }
 
-    ThrowSpiceError(
-        Napi::TypeError::New(
-            env,
-            ctx + ": " + kind + " handle has wrong dtype (expected " + SpiceDataTypeToString(expectedDtype) +
-                ", got " + SpiceDataTypeToString(actualDtype) + "): " + std::to_string(handle)));
+  return ptr;
+}
+
+uintptr_t GetCellHandlePtrOrThrow(
+    const CspiceLock& lock,
+    Napi::Env env,
+    uint32_t handle,
+    SpiceDataType expectedDtype,
+    const char *context,
+    const char *kindLabel) {
+  std::string error;
+  bool isTypeError = false;
+  const uintptr_t ptr =
+      ResolveCellHandlePtr(
+          lock, *GetInstanceData(env).cells, handle, expectedDtype, context, kindLabel, &error, &isTypeError);
+  if (ptr == 0) {
+    if (isTypeError) {
+      ThrowSpiceError(Napi::TypeError::New(env, error));
+    } else {
+      ThrowSpiceError(Napi::RangeError::New(env, error));
+    }
     return 0;
   }
 
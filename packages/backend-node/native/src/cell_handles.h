@@ -1,27 +1,129 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <SpiceUsr.h>
 
 #include <napi.h>
 
 #include "addon_common.h"
+#include "native_memory.h"
 
 namespace tspice_backend_node {
 
-// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller.
-// This is enforced by requiring a `const CspiceLock&` token for all registry
-// access.
+// NOTE: the free functions in this file require `g_cspice_mutex` to be held by the caller (they
+// hand out pointers that are then passed to CSPICE). This is enforced by requiring a
+// `const CspiceLock&` token.
 
-// Allocates a new unique handle for `ptr`.
+// Generational-index handle table for SpiceCell / SpiceWindow pointers.
+//
+// Each environment (main thread or worker_thread) owns one (see instance_data.h), so a handle is
+// only meaningful in the environment that allocated it.
+//
+// The table has its own mutex, separate from `g_cspice_mutex`, so that pure reads of a cell's
+// header and elements (`ReadUnpinned`) can skip the CSPICE lock. A cell is only written by CSPICE
+// calls made under the CSPICE lock: on the JS thread (which cannot race a read on the same thread)
+// or by an off-thread call, which pins the cells it touches for as long as it runs (`CellPin`).
+// Cells are freed under the CSPICE lock too, and an off-thread call holds it for as long as it
+// keeps its pins, so a pinned cell is never freed.
+class CellHandleTable {
+ public:
+  // A live cell and the memory it was accounted under (see native_memory.h).
+  struct Allocation {
+    uintptr_t ptr = 0;
+    size_t bytes = 0;
+    NativeMemoryKind kind = NativeMemoryKind::kCells;
+  };
+
+  // Returns 0 when the handle space is exhausted.
+  uint32_t Add(const Allocation& allocation);
+  bool TryGet(uint32_t handle, uintptr_t *outPtr) const;
+  bool Remove(uint32_t handle, Allocation *outAllocation);
+
+  // Every live allocation, for teardown.
+  std::vector<Allocation> LiveAllocations() const;
+  void Clear();
+
+  // Marks `handle` as being written by an in-flight call; pins nest. Returns false for an
+  // unknown/expired handle. Prefer `CellPin`.
+  bool Pin(uint32_t handle);
+  void Unpin(uint32_t handle);
+
+  // Calls `read(const SpiceCell&)` on the cell behind `handle` while holding only the table's
+  // mutex, and returns its result. Returns false without calling `read` when the handle is unknown
+  // or pinned; `read` returns false when the cell does not suit the fast path (wrong dtype, index
+  // out of range, ...). Either way the caller falls back to its CSPICE-locked path, which reports
+  // errors (or waits out the in-flight call) as before.
+  //
+  // `read` must only look at the cell's fields and elements: no CSPICE or shim calls.
+  template <typename Read>
+  bool ReadUnpinned(uint32_t handle, Read&& read) const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    const Slot *slot = FindLive(handle);
+    if (slot == nullptr || slot->pins != 0) {
+      return false;
+    }
+    return read(*reinterpret_cast<const SpiceCell *>(slot->allocation.ptr));
+  }
+
+ private:
+  static constexpr uint32_t kNoSlot = std::numeric_limits<uint32_t>::max();
+
+  struct Slot {
+    Allocation allocation;  // `ptr` is 0 while the slot is free
+    uint32_t generation = 1;
+    uint32_t nextFree = kNoSlot;
+    uint32_t pins = 0;
+  };
+
+  // Requires `mutex_`.
+  const Slot *FindLive(uint32_t handle) const;
+
+  mutable std::mutex mutex_;
+  std::vector<Slot> slots_;
+  uint32_t freeHead_ = kNoSlot;
+  uint32_t freeTail_ = kNoSlot;
+};
+
+// Pins a cell for the lifetime of the scope (see `CellHandleTable::Pin`). Off-thread calls take one
+// for every cell they pass to CSPICE, right after resolving it under the CSPICE lock.
+class CellPin {
+ public:
+  CellPin(CellHandleTable& cells, uint32_t handle) : cells_(cells), handle_(handle) {
+    pinned_ = cells_.Pin(handle_);
+  }
+  ~CellPin() {
+    if (pinned_) cells_.Unpin(handle_);
+  }
+
+  CellPin(const CellPin&) = delete;
+  CellPin& operator=(const CellPin&) = delete;
+
+ private:
+  CellHandleTable& cells_;
+  uint32_t handle_;
+  bool pinned_ = false;
+};
+
+// Allocates a new unique handle for `ptr` in `env`'s table, and reports the cell's storage to V8
+// under `kind` (`kWindows` for windows).
 //
 // Returns 0 and throws a JS exception on internal failure (e.g. handle space exhaustion).
-uint32_t AddCellHandle(const CspiceLock& lock, Napi::Env env, uintptr_t ptr, const char *context);
+uint32_t AddCellHandle(
+    const CspiceLock& lock,
+    Napi::Env env,
+    uintptr_t ptr,
+    const char *context,
+    NativeMemoryKind kind = NativeMemoryKind::kCells);
 
-bool TryGetCellPtr(const CspiceLock& lock, uint32_t handle, uintptr_t *outPtr);
+bool TryGetCellPtr(const CspiceLock& lock, Napi::Env env, uint32_t handle, uintptr_t *outPtr);
 
-bool RemoveCellPtr(const CspiceLock& lock, uint32_t handle, uintptr_t *outPtr);
+// Forgets `handle` and takes back its memory accounting; the caller frees `*outPtr`.
+bool RemoveCellPtr(const CspiceLock& lock, Napi::Env env, uint32_t handle, uintptr_t *outPtr);
 
 bool ReadCellHandleArg(Napi::Env env, const Napi::Value &value, const char *label, uint32_t *outHandle);
 
@@ -42,4 +144,21 @@ uintptr_t GetCellHandlePtrOrThrow(
     const char *context,
     const char *kindLabel);
 
+// Non-throwing variant of the dtype-checked GetCellHandlePtrOrThrow, for code that runs off the JS
+// thread (e.g. `AsyncWorker::Execute`) and cannot touch `Napi::Env`; such code resolves against the
+// submitting environment's table, captured on the JS thread.
+//
+// Returns 0 on failure and fills `outError` with the same message GetCellHandlePtrOrThrow would
+// throw; `outIsTypeError` distinguishes a dtype mismatch (TypeError) from an unknown handle
+// (RangeError).
+uintptr_t ResolveCellHandlePtr(
+    const CspiceLock& lock,
+    const CellHandleTable& cells,
+    uint32_t handle,
+    SpiceDataType expectedDtype,
+    const char *context,
+    const char *kindLabel,
+    std::string *outError,
+    bool *outIsTypeError);
+
 }  // namespace tspice_backend_node
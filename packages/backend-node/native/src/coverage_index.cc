@@ -0,0 +1,478 @@
+#include "coverage_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <system_error>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "pool_generation.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// Scanning a file costs one DAF open; keep the table bounded like the ID cache and just drop it
+// when full.
+constexpr size_t kMaxFiles = 256;
+
+// ckcov_c writes into a fixed-size window; start from the segment count and grow on overflow.
+constexpr int kMinCkCoverIntervals = 16;
+constexpr int kMaxCkCoverIntervals = 1 << 22;
+
+// SPK and CK summaries both unpack to 2 doubles and 6 integers.
+constexpr int kSummaryNd = 2;
+constexpr int kSummaryNi = 6;
+
+// Longest center chain `LoadedSpkMayCover` follows; real chains are a handful of links.
+constexpr int kMaxChainDepth = 32;
+
+enum class DafKind { kSpk, kCk };
+
+using CkCoverKey = std::tuple<int, bool, std::string, double, std::string>;
+
+// One SPK segment as seen by the chain pre-check.
+struct SpkLink {
+  int center = 0;
+  double start = 0.0;
+  double stop = 0.0;
+};
+
+struct FileIndex {
+  DafKind kind = DafKind::kSpk;
+  int64_t mtime = 0;
+  uintmax_t size = 0;
+
+  // Sorted, unique object IDs.
+  std::vector<int> ids;
+  // SPK: merged coverage per body. CK: segment count per instrument (sizes the ckcov window).
+  std::unordered_map<int, std::vector<double>> spkCoverage;
+  // SPK: segments per body, in file order.
+  std::unordered_map<int, std::vector<SpkLink>> spkLinks;
+  std::unordered_map<int, int> ckSegments;
+  std::map<CkCoverKey, std::vector<double>> ckCoverage;
+};
+
+std::unordered_map<std::string, FileIndex> g_files;
+
+// Segments of every loaded SPK, merged per body. `complete` is false when some loaded file could
+// not be indexed, in which case every pre-check passes.
+struct LoadedSpkSnapshot {
+  bool valid = false;
+  bool complete = true;
+  uint64_t generation = 0;
+  std::unordered_map<int, std::vector<SpkLink>> links;
+};
+
+LoadedSpkSnapshot g_loaded;
+
+int Fail(char* err, int errMaxBytes, const std::string& message) {
+  if (err && errMaxBytes > 0) {
+    std::snprintf(err, (size_t)errMaxBytes, "%s", message.c_str());
+  }
+  return 1;
+}
+
+bool StatFile(const std::string& path, int64_t* outMtime, uintmax_t* outSize) {
+  std::error_code ec;
+  const auto mtime = std::filesystem::last_write_time(path, ec);
+  if (ec) return false;
+  const uintmax_t size = std::filesystem::file_size(path, ec);
+  if (ec) return false;
+  *outMtime = (int64_t)mtime.time_since_epoch().count();
+  *outSize = size;
+  return true;
+}
+
+// Sort `[left, right]` pairs and merge overlapping or touching ones, matching what repeated
+// `wninsd_c` calls produce.
+void MergeIntervals(std::vector<double>* intervals) {
+  const size_t n = intervals->size() / 2;
+  std::vector<std::pair<double, double>> pairs;
+  pairs.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    pairs.emplace_back((*intervals)[2 * i], (*intervals)[2 * i + 1]);
+  }
+  std::sort(pairs.begin(), pairs.end());
+
+  intervals->clear();
+  for (const auto& p : pairs) {
+    if (!intervals->empty() && p.first <= intervals->back()) {
+      intervals->back() = std::max(intervals->back(), p.second);
+    } else {
+      intervals->push_back(p.first);
+      intervals->push_back(p.second);
+    }
+  }
+}
+
+int ScanSummaries(const std::string& path, DafKind kind, FileIndex* index, char* err, int errMaxBytes) {
+  int handle = 0;
+  if (tspice_dafopr(path.c_str(), &handle, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  int code = tspice_dafbfs(handle, err, errMaxBytes);
+  while (code == 0) {
+    int found = 0;
+    code = tspice_daffna(handle, &found, err, errMaxBytes);
+    if (code != 0 || !found) break;
+
+    double dc[kSummaryNd];
+    int ic[kSummaryNi];
+    code = tspice_dafgsu(handle, kSummaryNd, kSummaryNi, dc, ic, err, errMaxBytes);
+    if (code != 0) break;
+
+    // SPK: ic[0] is the target body. CK: ic[0] is the instrument; dc holds encoded SCLK bounds.
+    index->ids.push_back(ic[0]);
+    if (kind == DafKind::kSpk) {
+      std::vector<double>& cover = index->spkCoverage[ic[0]];
+      cover.push_back(dc[0]);
+      cover.push_back(dc[1]);
+      // ic[1] is the segment's center.
+      index->spkLinks[ic[0]].push_back(SpkLink{ic[1], dc[0], dc[1]});
+    } else {
+      index->ckSegments[ic[0]]++;
+    }
+  }
+
+  // Close even after a failed scan, keeping the scan's error message.
+  if (code != 0) {
+    tspice_dafcls(handle, nullptr, 0);
+    return 1;
+  }
+  if (tspice_dafcls(handle, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  std::sort(index->ids.begin(), index->ids.end());
+  index->ids.erase(std::unique(index->ids.begin(), index->ids.end()), index->ids.end());
+  for (auto& entry : index->spkCoverage) {
+    MergeIntervals(&entry.second);
+  }
+  return 0;
+}
+
+int GetFileIndex(
+    const std::string& path,
+    DafKind kind,
+    const char* context,
+    FileIndex** outIndex,
+    char* err,
+    int errMaxBytes) {
+  int64_t mtime = 0;
+  uintmax_t size = 0;
+  if (!StatFile(path, &mtime, &size)) {
+    return Fail(err, errMaxBytes, std::string(context) + ": unable to stat \"" + path + "\"");
+  }
+
+  auto it = g_files.find(path);
+  if (it != g_files.end() && it->second.mtime == mtime && it->second.size == size) {
+    if (it->second.kind != kind) {
+      const char* actual = it->second.kind == DafKind::kSpk ? "SPK" : "CK";
+      return Fail(err, errMaxBytes, std::string(context) + ": \"" + path + "\" is a " + actual + " file");
+    }
+    *outIndex = &it->second;
+    return 0;
+  }
+  if (it != g_files.end()) {
+    g_files.erase(it);
+  }
+
+  char arch[16];
+  char type[16];
+  if (tspice_getfat(path.c_str(), arch, (int)sizeof(arch), type, (int)sizeof(type), err, errMaxBytes) != 0) {
+    return 1;
+  }
+  const bool isSpk = std::strcmp(arch, "DAF") == 0 && std::strcmp(type, "SPK") == 0;
+  const bool isCk = std::strcmp(arch, "DAF") == 0 && std::strcmp(type, "CK") == 0;
+  if ((kind == DafKind::kSpk && !isSpk) || (kind == DafKind::kCk && !isCk)) {
+    const char* expected = kind == DafKind::kSpk ? "DAF/SPK" : "DAF/CK";
+    return Fail(
+        err,
+        errMaxBytes,
+        std::string(context) + ": \"" + path + "\" is " + arch + "/" + type + ", expected " + expected);
+  }
+
+  FileIndex index;
+  index.kind = kind;
+  index.mtime = mtime;
+  index.size = size;
+  if (ScanSummaries(path, kind, &index, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  if (g_files.size() >= kMaxFiles) {
+    g_files.clear();
+  }
+  *outIndex = &g_files.emplace(path, std::move(index)).first->second;
+  return 0;
+}
+
+bool IsWindowOverflow(const char* err) {
+  return std::strstr(err, "WINDOWEXCESS") != nullptr || std::strstr(err, "CELLTOOSMALL") != nullptr;
+}
+
+int RunCkcov(
+    const std::string& path,
+    int idcode,
+    bool needav,
+    const std::string& level,
+    double tol,
+    const std::string& timsys,
+    int maxIntervals,
+    std::vector<double>* out,
+    char* err,
+    int errMaxBytes) {
+  for (;;) {
+    uintptr_t window = 0;
+    if (tspice_new_window(maxIntervals, &window, err, errMaxBytes) != 0) {
+      return 1;
+    }
+
+    int code = tspice_ckcov(
+        path.c_str(), idcode, needav ? 1 : 0, level.c_str(), tol, timsys.c_str(), window, err, errMaxBytes);
+    if (code != 0 && IsWindowOverflow(err) && maxIntervals < kMaxCkCoverIntervals) {
+      tspice_free_window(window, nullptr, 0);
+      maxIntervals = std::min(maxIntervals * 2, kMaxCkCoverIntervals);
+      continue;
+    }
+
+    int card = 0;
+    if (code == 0) {
+      code = tspice_wncard(window, &card, err, errMaxBytes);
+    }
+    out->clear();
+    out->reserve((size_t)card * 2);
+    for (int i = 0; code == 0 && i < card; i++) {
+      double left = 0.0;
+      double right = 0.0;
+      code = tspice_wnfetd(window, i, &left, &right, err, errMaxBytes);
+      out->push_back(left);
+      out->push_back(right);
+    }
+
+    tspice_free_window(window, nullptr, 0);
+    return code != 0 ? 1 : 0;
+  }
+}
+
+int RefreshLoadedSpks(char* err, int errMaxBytes) {
+  const uint64_t generation = PoolGeneration();
+  if (g_loaded.valid && g_loaded.generation == generation) {
+    return 0;
+  }
+
+  LoadedSpkSnapshot snapshot;
+  int count = 0;
+  if (tspice_ktotal("SPK", &count, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  for (int i = 0; i < count; i++) {
+    char file[1024];
+    char filtyp[32];
+    char source[1024];
+    int handle = 0;
+    int found = 0;
+    if (tspice_kdata(
+            i,
+            "SPK",
+            file,
+            (int)sizeof(file),
+            filtyp,
+            (int)sizeof(filtyp),
+            source,
+            (int)sizeof(source),
+            &handle,
+            &found,
+            err,
+            errMaxBytes) != 0) {
+      return 1;
+    }
+    if (!found) continue;
+
+    // A file the index cannot read (unstatable path, scan failure) only disables the pre-check.
+    FileIndex* index = nullptr;
+    if (GetFileIndex(file, DafKind::kSpk, "LoadedSpkMayCover()", &index, nullptr, 0) != 0) {
+      snapshot.complete = false;
+      continue;
+    }
+    for (const auto& entry : index->spkLinks) {
+      std::vector<SpkLink>& links = snapshot.links[entry.first];
+      links.insert(links.end(), entry.second.begin(), entry.second.end());
+    }
+  }
+
+  snapshot.valid = true;
+  snapshot.generation = generation;
+  g_loaded = std::move(snapshot);
+  return 0;
+}
+
+bool HasSegmentOver(int body, double etMin, double etMax) {
+  auto it = g_loaded.links.find(body);
+  if (it == g_loaded.links.end()) return false;
+  for (const SpkLink& link : it->second) {
+    if (link.start <= etMax && link.stop >= etMin) return true;
+  }
+  return false;
+}
+
+// Every center reachable from `body` through segments overlapping `[etMin, etMax]`: a superset of
+// the chain CSPICE would actually walk.
+void CollectCenters(int body, double etMin, double etMax, std::unordered_set<int>* out) {
+  std::vector<std::pair<int, int>> stack{{body, 0}};
+  while (!stack.empty()) {
+    const auto [current, depth] = stack.back();
+    stack.pop_back();
+    if (depth >= kMaxChainDepth) continue;
+    auto it = g_loaded.links.find(current);
+    if (it == g_loaded.links.end()) continue;
+    for (const SpkLink& link : it->second) {
+      if (link.start > etMax || link.stop < etMin) continue;
+      if (out->insert(link.center).second) stack.emplace_back(link.center, depth + 1);
+    }
+  }
+}
+
+// `body` needs a segment of its own unless it is the solar system barycenter or a node of
+// `other`'s chain.
+bool CertainlyUncovered(int body, int other, double etMin, double etMax) {
+  if (body == 0 || HasSegmentOver(body, etMin, etMax)) return false;
+  std::unordered_set<int> centers;
+  CollectCenters(other, etMin, etMax, &centers);
+  return centers.count(body) == 0;
+}
+
+}  // namespace
+
+void InvalidateCoverageIndex() {
+  g_files.clear();
+}
+
+void InvalidateCkCoverageMemos() {
+  for (auto& entry : g_files) {
+    entry.second.ckCoverage.clear();
+  }
+}
+
+void InvalidateLoadedSpkCoverage() {
+  g_loaded.valid = false;
+}
+
+int LoadedSpkMayCover(
+    int target,
+    int observer,
+    double etMin,
+    double etMax,
+    bool* outMayCover,
+    char* err,
+    int errMaxBytes) {
+  *outMayCover = true;
+  if (target == observer) {
+    return 0;
+  }
+  if (RefreshLoadedSpks(err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (!g_loaded.complete) {
+    return 0;
+  }
+  *outMayCover = !CertainlyUncovered(target, observer, etMin, etMax) &&
+      !CertainlyUncovered(observer, target, etMin, etMax);
+  return 0;
+}
+
+int CoverageIndexSpkObjects(const std::string& path, std::vector<int>* out, char* err, int errMaxBytes) {
+  FileIndex* index = nullptr;
+  if (GetFileIndex(path, DafKind::kSpk, "spkobjIds()", &index, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  *out = index->ids;
+  return 0;
+}
+
+int CoverageIndexSpkCoverage(
+    const std::string& path,
+    int idcode,
+    std::vector<double>* out,
+    char* err,
+    int errMaxBytes) {
+  FileIndex* index = nullptr;
+  if (GetFileIndex(path, DafKind::kSpk, "spkcovIntervals()", &index, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  auto it = index->spkCoverage.find(idcode);
+  if (it == index->spkCoverage.end()) {
+    out->clear();
+  } else {
+    *out = it->second;
+  }
+  return 0;
+}
+
+int CoverageIndexCkObjects(const std::string& path, std::vector<int>* out, char* err, int errMaxBytes) {
+  FileIndex* index = nullptr;
+  if (GetFileIndex(path, DafKind::kCk, "ckobjIds()", &index, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  *out = index->ids;
+  return 0;
+}
+
+int CoverageIndexCkCoverage(
+    const std::string& path,
+    int idcode,
+    bool needav,
+    const std::string& level,
+    double tol,
+    const std::string& timsys,
+    std::vector<double>* out,
+    char* err,
+    int errMaxBytes) {
+  FileIndex* index = nullptr;
+  if (GetFileIndex(path, DafKind::kCk, "ckcovIntervals()", &index, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  CkCoverKey key(idcode, needav, level, tol, timsys);
+  auto it = index->ckCoverage.find(key);
+  if (it != index->ckCoverage.end()) {
+    *out = it->second;
+    return 0;
+  }
+
+  auto segs = index->ckSegments.find(idcode);
+  const int segments = segs == index->ckSegments.end() ? 0 : segs->second;
+  const int maxIntervals = std::max(segments, kMinCkCoverIntervals);
+  if (RunCkcov(path, idcode, needav, level, tol, timsys, maxIntervals, out, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  index->ckCoverage.emplace(std::move(key), *out);
+  return 0;
+}
+
+Napi::Float64Array IntervalsToFloat64Array(Napi::Env env, const std::vector<double>& intervals) {
+  Napi::Float64Array out = Napi::Float64Array::New(env, intervals.size());
+  if (!intervals.empty()) {
+    std::memcpy(out.Data(), intervals.data(), intervals.size() * sizeof(double));
+  }
+  return out;
+}
+
+Napi::Int32Array IdsToInt32Array(Napi::Env env, const std::vector<int>& ids) {
+  Napi::Int32Array out = Napi::Int32Array::New(env, ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    out[i] = (int32_t)ids[i];
+  }
+  return out;
+}
+
+}  // namespace tspice_backend_node
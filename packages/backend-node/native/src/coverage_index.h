@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Addon-level per-file coverage index for SPK and CK files.
+//
+// The first query against a file scans its DAF summaries once (`dafbfs` / `daffna` / `dafgs`) and
+// keeps the object IDs and, for SPKs, the merged per-body coverage in memory. Later
+// `spkobjIds` / `spkcovIntervals` / `ckobjIds` / `ckcovIntervals` calls answer from the index and
+// return packed arrays instead of filling SPICE cells and windows. Entries are keyed by path and
+// revalidated against the file's mtime and size on every lookup, so rewriting a file in place
+// rebuilds its entry.
+//
+// CK coverage depends on `needav`, `level`, `tol` and `timsys` (and, for TDB, on the loaded SCLK
+// kernels), so it is computed by `ckcov_c` on first use and memoized per argument tuple.
+//
+// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller. `unload` /
+// `kclear` call `InvalidateCoverageIndex()`; `furnsh` / `p*pool` only change what SCLK data is
+// loaded, so they call `InvalidateCkCoverageMemos()` and keep the summary scans.
+
+void InvalidateCoverageIndex();
+void InvalidateCkCoverageMemos();
+
+// Sorted, unique body IDs with at least one segment in `path` (spkobj_c). Returns 0 on success or 1
+// with `err` filled.
+int CoverageIndexSpkObjects(const std::string& path, std::vector<int>* out, char* err, int errMaxBytes);
+
+// Merged coverage of `idcode` in `path` as `[left0, right0, left1, right1, ...]` TDB seconds
+// (spkcov_c). Unknown IDs produce an empty vector.
+int CoverageIndexSpkCoverage(
+    const std::string& path,
+    int idcode,
+    std::vector<double>* out,
+    char* err,
+    int errMaxBytes);
+
+// Sorted, unique instrument IDs with at least one segment in `path` (ckobj_c).
+int CoverageIndexCkObjects(const std::string& path, std::vector<int>* out, char* err, int errMaxBytes);
+
+// Coverage of `idcode` in `path` as packed interval endpoints (ckcov_c).
+int CoverageIndexCkCoverage(
+    const std::string& path,
+    int idcode,
+    bool needav,
+    const std::string& level,
+    double tol,
+    const std::string& timsys,
+    std::vector<double>* out,
+    char* err,
+    int errMaxBytes);
+
+// Cheap pre-check for speculative `spkezr`-style queries against every SPK currently loaded
+// (`ktotal_c` / `kdata_c` plus the per-file index). Sets `*outMayCover = false` only when the
+// state of `target` relative to `observer` certainly cannot be computed anywhere in
+// `[etMin, etMax]`: one of the two bodies has no segment over that range and is not a center in
+// the other's possible chain. Anything the index cannot rule out (including loaded files it
+// cannot scan) reports true. The loaded-file snapshot is rebuilt when the kernel-pool generation
+// moves; the lazy kernel manager calls `InvalidateLoadedSpkCoverage()` when it opens or closes
+// files.
+int LoadedSpkMayCover(
+    int target,
+    int observer,
+    double etMin,
+    double etMax,
+    bool* outMayCover,
+    char* err,
+    int errMaxBytes);
+
+void InvalidateLoadedSpkCoverage();
+
+// Copy index results into fresh JS typed arrays.
+Napi::Float64Array IntervalsToFloat64Array(Napi::Env env, const std::vector<double>& intervals);
+Napi::Int32Array IdsToInt32Array(Napi::Env env, const std::vector<int>& ids);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,218 @@
+#include "cspice_executor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "mpsc_ring.h"
+#include "napi_helpers.h"
+
+using tspice_napi::SetExportChecked;
+using tspice_napi::ThrowSpiceError;
+
+namespace tspice_backend_node {
+
+namespace {
+
+struct QueuedTask;
+
+void CallJsComplete(Napi::Env env, Napi::Function, std::nullptr_t*, QueuedTask* queued);
+
+using CompletionTsfn = Napi::TypedThreadSafeFunction<std::nullptr_t, QueuedTask, CallJsComplete>;
+
+struct QueuedTask {
+  std::unique_ptr<CspiceTask> task;
+  // One TSFN per task keeps completions routed to the submitting env (main thread or a
+  // worker_thread) without any per-env registry.
+  CompletionTsfn tsfn;
+};
+
+void CallJsComplete(Napi::Env env, Napi::Function, std::nullptr_t*, QueuedTask* queued) {
+  // `env` is null when the submitting environment is tearing down; just drop the task.
+  if (env != nullptr && queued != nullptr) {
+    Napi::HandleScope scope(env);
+    queued->task->OnComplete(env);
+  }
+  delete queued;
+}
+
+// Fallback path (executor disabled or ring full): run the same task on the libuv threadpool.
+class CspiceTaskWorker : public Napi::AsyncWorker {
+ public:
+  CspiceTaskWorker(Napi::Env env, std::unique_ptr<CspiceTask> task, const char* resourceName)
+      : Napi::AsyncWorker(env, resourceName), task_(std::move(task)) {}
+
+  void Execute() override {
+    CspiceLock lock;
+    task_->Execute(lock);
+  }
+
+  void OnOK() override {
+    Napi::HandleScope scope(Env());
+    task_->OnComplete(Env());
+  }
+
+  void OnError(const Napi::Error&) override { OnOK(); }
+
+ private:
+  std::unique_ptr<CspiceTask> task_;
+};
+
+constexpr size_t kRingCapacity = 1024;
+
+MpscRing<QueuedTask*, kRingCapacity> g_ring;
+std::atomic<bool> g_enabled{false};
+std::once_flag g_thread_started;
+
+// Wakeup for the idle executor. Producers only take `g_wake_mutex` when the executor has
+// advertised that it is about to sleep, so the submission fast path stays lock-free.
+std::mutex g_wake_mutex;
+std::condition_variable g_wake_cv;
+std::atomic<bool> g_sleeping{false};
+bool g_wake_pending = false;
+
+void RunQueued(QueuedTask* queued) {
+  {
+    CspiceLock lock;
+    queued->task->Execute(lock);
+  }
+
+  // `BlockingCall` with an unbounded TSFN queue never actually blocks. On `napi_closing` the
+  // target env is gone and `CallJsComplete` will not run, so free the task here.
+  CompletionTsfn tsfn = queued->tsfn;
+  if (tsfn.BlockingCall(queued) != napi_ok) {
+    delete queued;
+    return;
+  }
+  tsfn.Release();
+}
+
+void ExecutorLoop() {
+  for (;;) {
+    QueuedTask* queued = nullptr;
+    if (g_ring.TryPop(&queued)) {
+      RunQueued(queued);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lk(g_wake_mutex);
+    g_sleeping.store(true, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Re-check after advertising: a producer that published before seeing `g_sleeping` would
+    // otherwise leave its task stranded.
+    if (g_ring.TryPop(&queued)) {
+      g_sleeping.store(false, std::memory_order_relaxed);
+      lk.unlock();
+      RunQueued(queued);
+      continue;
+    }
+
+    g_wake_cv.wait(lk, [] { return g_wake_pending; });
+    g_wake_pending = false;
+    g_sleeping.store(false, std::memory_order_relaxed);
+  }
+}
+
+void WakeExecutor() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!g_sleeping.load(std::memory_order_seq_cst)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk(g_wake_mutex);
+    g_wake_pending = true;
+  }
+  g_wake_cv.notify_one();
+}
+
+bool TrySubmitToExecutor(Napi::Env env, std::unique_ptr<CspiceTask>& task, const char* resourceName) {
+  auto* queued = new QueuedTask{nullptr, CompletionTsfn::New(env, resourceName, 0, 1)};
+  if (env.IsExceptionPending()) {
+    delete queued;
+    return false;
+  }
+
+  queued->task = std::move(task);
+  if (!g_ring.TryPush(queued)) {
+    task = std::move(queued->task);
+    queued->tsfn.Release();
+    delete queued;
+    return false;
+  }
+
+  WakeExecutor();
+  return true;
+}
+
+}  // namespace
+
+bool IsCspiceExecutorEnabled() {
+  return g_enabled.load(std::memory_order_acquire);
+}
+
+void SetCspiceExecutorEnabled(bool enabled) {
+  if (enabled) {
+    // The executor thread is started once and then idles on `g_wake_cv`; disabling only stops new
+    // submissions (already-queued tasks still run).
+    std::call_once(g_thread_started, [] { std::thread(ExecutorLoop).detach(); });
+  }
+  g_enabled.store(enabled, std::memory_order_release);
+}
+
+void DispatchCspiceTask(Napi::Env env, std::unique_ptr<CspiceTask> task, const char* resourceName) {
+  if (IsCspiceExecutorEnabled() && TrySubmitToExecutor(env, task, resourceName)) {
+    return;
+  }
+  if (env.IsExceptionPending()) {
+    return;
+  }
+
+  // The worker deletes itself after OnOK/OnError.
+  auto* worker = new CspiceTaskWorker(env, std::move(task), resourceName);
+  worker->Queue();
+}
+
+}  // namespace tspice_backend_node
+
+static void SetCspiceExecutorEnabledJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsBoolean()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "setCspiceExecutorEnabled(enabled: boolean) expects exactly one boolean argument"));
+    return;
+  }
+
+  tspice_backend_node::SetCspiceExecutorEnabled(info[0].As<Napi::Boolean>().Value());
+}
+
+static Napi::Boolean IsCspiceExecutorEnabledJs(const Napi::CallbackInfo& info) {
+  return Napi::Boolean::New(info.Env(), tspice_backend_node::IsCspiceExecutorEnabled());
+}
+
+namespace tspice_backend_node {
+
+void RegisterCspiceExecutor(Napi::Env env, Napi::Object exports) {
+  if (!SetExportChecked(
+          env,
+          exports,
+          "setCspiceExecutorEnabled",
+          Napi::Function::New(env, SetCspiceExecutorEnabledJs),
+          __func__)) {
+    return;
+  }
+  if (!SetExportChecked(
+          env,
+          exports,
+          "isCspiceExecutorEnabled",
+          Napi::Function::New(env, IsCspiceExecutorEnabledJs),
+          __func__)) {
+    return;
+  }
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <napi.h>
+
+#include <memory>
+
+#include "addon_common.h"
+
+namespace tspice_backend_node {
+
+// A unit of CSPICE work that runs off the JS thread and settles back on it.
+//
+// `Execute()` runs with the CSPICE mutex held, either on the dedicated executor thread (when
+// enabled) or on a libuv threadpool thread. It must not touch `Napi::Env` or any JS values.
+// `OnComplete()` then runs on the JS thread that submitted the task, typically to settle a
+// `Napi::Promise::Deferred` created at submission time.
+class CspiceTask {
+ public:
+  virtual ~CspiceTask() = default;
+
+  virtual void Execute(const CspiceLock& lock) = 0;
+  virtual void OnComplete(Napi::Env env) = 0;
+};
+
+// Opt-in: when enabled, tasks are pushed onto a lock-free MPSC ring and executed in FIFO order by
+// a single native thread that owns CSPICE; results are delivered back through a
+// `Napi::ThreadSafeFunction`. When disabled (the default), or if the ring is full, tasks fall back
+// to a `Napi::AsyncWorker` on the libuv threadpool.
+//
+// Synchronous entrypoints are unaffected either way and keep serializing on `g_cspice_mutex`.
+bool IsCspiceExecutorEnabled();
+void SetCspiceExecutorEnabled(bool enabled);
+
+// Schedules `task` and takes ownership of it.
+void DispatchCspiceTask(Napi::Env env, std::unique_ptr<CspiceTask> task, const char* resourceName);
+
+void RegisterCspiceExecutor(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
@@ -2,16 +2,42 @@
 
 #include "../addon_common.h"
 #include "../cell_handles.h"
+#include "../instance_data.h"
 #include "../napi_helpers.h"
+#include "../window_algebra.h"
 
 #include "tspice_backend_shim.h"
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 
+// Reads of cell data (`card`, `size`, `cellGet*`, `wncard`, `wnfetd`) first try the cell directly,
+// without the CSPICE lock, so they don't queue behind an async GF search on another cell (see
+// `CellHandleTable::ReadUnpinned`). `read` returns false to fall back to the locked path through the
+// shim, which also produces every error message.
+template <typename Read>
+static bool ReadCellUnlocked(Napi::Env env, uint32_t handle, Read&& read) {
+  return tspice_backend_node::GetInstanceData(env).cells->ReadUnpinned(handle, std::forward<Read>(read));
+}
+
+static bool SpiceIntToInt(SpiceInt value, int* out) {
+  if (value < (SpiceInt)std::numeric_limits<int>::min() || value > (SpiceInt)std::numeric_limits<int>::max()) {
+    return false;
+  }
+  *out = (int)value;
+  return true;
+}
+
 static Napi::Number NewIntCell(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -121,7 +147,8 @@ static Napi::Number NewWindow(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  const uint32_t handle = tspice_backend_node::AddCellHandle(lock, env, ptr, "newWindow");
+  const uint32_t handle = tspice_backend_node::AddCellHandle(
+      lock, env, ptr, "newWindow", tspice_backend_node::NativeMemoryKind::kWindows);
   if (handle == 0) {
     // Best-effort: avoid leaking the newly allocated window.
     (void)tspice_free_window(ptr, err, (int)sizeof(err));
@@ -141,7 +168,7 @@ static void FreeHandleCommon(
   tspice_backend_node::CspiceLock lock;
 
   uintptr_t ptr = 0;
-  if (!tspice_backend_node::RemoveCellPtr(lock, handle, &ptr) || ptr == 0) {
+  if (!tspice_backend_node::RemoveCellPtr(lock, env, handle, &ptr) || ptr == 0) {
     ThrowSpiceError(
         Napi::RangeError::New(
             env,
@@ -253,6 +280,11 @@ static Napi::Number Card(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
+  int fast = 0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) { return SpiceIntToInt(cell.card, &fast); })) {
+    return Napi::Number::New(env, (double)fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, "card", "cell");
   if (env.IsExceptionPending()) return Napi::Number::New(env, 0);
@@ -279,6 +311,11 @@ static Napi::Number Size(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
+  int fast = 0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) { return SpiceIntToInt(cell.size, &fast); })) {
+    return Napi::Number::New(env, (double)fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, "size", "cell");
   if (env.IsExceptionPending()) return Napi::Number::New(env, 0);
@@ -410,6 +447,14 @@ static Napi::Number CellGeti(const Napi::CallbackInfo& info) {
   }
   const int index = info[1].As<Napi::Number>().Int32Value();
 
+  int fast = 0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) {
+        if (cell.dtype != SPICE_INT || index < 0 || index >= cell.card) return false;
+        return SpiceIntToInt(static_cast<const SpiceInt*>(cell.data)[index], &fast);
+      })) {
+    return Napi::Number::New(env, (double)fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_INT, "cellGeti", "cell");
   if (env.IsExceptionPending()) return Napi::Number::New(env, 0);
@@ -439,6 +484,15 @@ static Napi::Number CellGetd(const Napi::CallbackInfo& info) {
   }
   const int index = info[1].As<Napi::Number>().Int32Value();
 
+  double fast = 0.0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) {
+        if (cell.dtype != SPICE_DP || index < 0 || index >= cell.card) return false;
+        fast = static_cast<const SpiceDouble*>(cell.data)[index];
+        return true;
+      })) {
+    return Napi::Number::New(env, fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_DP, "cellGetd", "cell");
   if (env.IsExceptionPending()) return Napi::Number::New(env, 0);
@@ -468,6 +522,17 @@ static Napi::String CellGetc(const Napi::CallbackInfo& info) {
   }
   const int index = info[1].As<Napi::Number>().Int32Value();
 
+  std::string fast;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) {
+        if (cell.dtype != SPICE_CHR || cell.length <= 0 || index < 0 || index >= cell.card) return false;
+        // Same bytes SPICE_CELL_GET_C copies: at most `length - 1`, up to the first NUL.
+        const char* elem = static_cast<const char*>(cell.data) + (size_t)index * (size_t)cell.length;
+        fast.assign(elem, strnlen(elem, (size_t)cell.length - 1));
+        return true;
+      })) {
+    return Napi::String::New(env, fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_CHR, "cellGetc", "cell");
   if (env.IsExceptionPending()) return Napi::String::New(env, "");
@@ -535,6 +600,15 @@ static Napi::Number Wncard(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
+  int fast = 0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) {
+        // An odd cardinality is an invalid window; let wncard_c report it.
+        if (cell.dtype != SPICE_DP || cell.card % 2 != 0) return false;
+        return SpiceIntToInt(cell.card / 2, &fast);
+      })) {
+    return Napi::Number::New(env, (double)fast);
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_DP, "wncard", "window");
   if (env.IsExceptionPending()) return Napi::Number::New(env, 0);
@@ -563,6 +637,21 @@ static Napi::Array Wnfetd(const Napi::CallbackInfo& info) {
   }
   const int index = info[1].As<Napi::Number>().Int32Value();
 
+  double fastLeft = 0;
+  double fastRight = 0;
+  if (ReadCellUnlocked(env, handle, [&](const SpiceCell& cell) {
+        if (cell.dtype != SPICE_DP || cell.card % 2 != 0 || index < 0 || index >= cell.card / 2) return false;
+        const SpiceDouble* endpoints = static_cast<const SpiceDouble*>(cell.data);
+        fastLeft = endpoints[2 * (size_t)index];
+        fastRight = endpoints[2 * (size_t)index + 1];
+        return true;
+      })) {
+    Napi::Array out = Napi::Array::New(env, 2);
+    out.Set((uint32_t)0, Napi::Number::New(env, fastLeft));
+    out.Set((uint32_t)1, Napi::Number::New(env, fastRight));
+    return out;
+  }
+
   tspice_backend_node::CspiceLock lock;
   const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_DP, "wnfetd", "window");
   if (env.IsExceptionPending()) return Napi::Array::New(env);
@@ -609,6 +698,429 @@ static Napi::Value Wnvald(const Napi::CallbackInfo& info) {
   return env.Undefined();
 }
 
+// --- Bulk copies -------------------------------------------------------------
+//
+// One lock, one handle lookup and one memcpy per call instead of one `cellGet*` / `wnfetd` /
+// `insrt*` / `wninsd` round trip per element.
+
+// Reads an optional non-negative capacity argument, defaulting to `fallback`.
+static bool ReadOptionalCapacityArg(
+    Napi::Env env,
+    const Napi::Value& value,
+    const char* label,
+    size_t fallback,
+    size_t* out) {
+  if (value.IsUndefined()) {
+    *out = fallback;
+    return true;
+  }
+  if (!value.IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(label) + " must be a number"));
+    return false;
+  }
+  const double d = value.As<Napi::Number>().DoubleValue();
+  if (!(d >= 0.0) || d != (double)(int64_t)d || d > (double)std::numeric_limits<int32_t>::max()) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(label) + " must be a non-negative integer"));
+    return false;
+  }
+  *out = (size_t)d;
+  return true;
+}
+
+static Napi::Value CellToTypedArray(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "cellToTypedArray(cellHandle: number) expects 1 argument"));
+    return env.Undefined();
+  }
+
+  uint32_t handle = 0;
+  if (!tspice_backend_node::ReadCellHandleArg(env, info[0], "cell", &handle)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, "cellToTypedArray", "cell");
+  if (env.IsExceptionPending()) return env.Undefined();
+
+  const SpiceDataType dtype = reinterpret_cast<SpiceCell*>(ptr)->dtype;
+  if (dtype != SPICE_INT && dtype != SPICE_DP) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "cellToTypedArray(): only SpiceIntCell and SpiceDoubleCell handles are supported"));
+    return env.Undefined();
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  int card = 0;
+  if (tspice_card(ptr, &card, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling cellToTypedArray", err);
+    return env.Undefined();
+  }
+
+  if (dtype == SPICE_INT) {
+    Napi::Int32Array out = Napi::Int32Array::New(env, (size_t)card);
+    if (tspice_cell_export_int(ptr, out.Data(), card, &card, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling cellToTypedArray", err);
+      return env.Undefined();
+    }
+    return out;
+  }
+
+  Napi::Float64Array out = Napi::Float64Array::New(env, (size_t)card);
+  if (tspice_cell_export_double(ptr, out.Data(), card, &card, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling cellToTypedArray", err);
+    return env.Undefined();
+  }
+  return out;
+}
+
+static Napi::Value WindowToFloat64Array(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "windowToFloat64Array(windowHandle: number) expects 1 argument"));
+    return env.Undefined();
+  }
+
+  uint32_t handle = 0;
+  if (!tspice_backend_node::ReadCellHandleArg(env, info[0], "window", &handle)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  const uintptr_t ptr =
+      tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, handle, SPICE_DP, "windowToFloat64Array", "window");
+  if (env.IsExceptionPending()) return env.Undefined();
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  int card = 0;
+  if (tspice_card(ptr, &card, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling windowToFloat64Array", err);
+    return env.Undefined();
+  }
+
+  Napi::Float64Array out = Napi::Float64Array::New(env, (size_t)card);
+  if (tspice_cell_export_double(ptr, out.Data(), card, &card, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling windowToFloat64Array", err);
+    return env.Undefined();
+  }
+  return out;
+}
+
+static Napi::Number CellFromTypedArray(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 || info.Length() > 2 || !info[0].IsTypedArray()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "cellFromTypedArray(values: Int32Array | Float64Array, size?: number) expects 1-2 arguments"));
+    return Napi::Number::New(env, 0);
+  }
+
+  Napi::TypedArray values = info[0].As<Napi::TypedArray>();
+  const napi_typedarray_type type = values.TypedArrayType();
+  if (type != napi_int32_array && type != napi_float64_array) {
+    ThrowSpiceError(Napi::TypeError::New(env, "cellFromTypedArray(values): expected an Int32Array or Float64Array"));
+    return Napi::Number::New(env, 0);
+  }
+
+  const size_t n = values.ElementLength();
+  if (n > (size_t)std::numeric_limits<int32_t>::max()) {
+    ThrowSpiceError(Napi::RangeError::New(env, "cellFromTypedArray(values): too many elements"));
+    return Napi::Number::New(env, 0);
+  }
+  size_t size = 0;
+  if (!ReadOptionalCapacityArg(env, info.Length() > 1 ? info[1] : env.Undefined(), "cellFromTypedArray(size)", n, &size)) {
+    return Napi::Number::New(env, 0);
+  }
+  if (size < n) {
+    ThrowSpiceError(Napi::RangeError::New(env, "cellFromTypedArray(size): must be >= values.length"));
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+
+  uintptr_t ptr = 0;
+  int code = type == napi_int32_array ? tspice_new_int_cell((int)size, &ptr, err, (int)sizeof(err))
+                                      : tspice_new_double_cell((int)size, &ptr, err, (int)sizeof(err));
+  if (code == 0) {
+    code = type == napi_int32_array
+               ? tspice_cell_import_int(ptr, values.As<Napi::Int32Array>().Data(), (int)n, err, (int)sizeof(err))
+               : tspice_cell_import_double(
+                     ptr, values.As<Napi::Float64Array>().Data(), (int)n, err, (int)sizeof(err));
+    if (code != 0) {
+      (void)tspice_free_cell(ptr, nullptr, 0);
+    }
+  }
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling cellFromTypedArray", err);
+    return Napi::Number::New(env, 0);
+  }
+
+  const uint32_t handle = tspice_backend_node::AddCellHandle(lock, env, ptr, "cellFromTypedArray");
+  if (handle == 0) {
+    // Best-effort: avoid leaking the newly allocated cell.
+    (void)tspice_free_cell(ptr, err, (int)sizeof(err));
+    return Napi::Number::New(env, 0);
+  }
+  return Napi::Number::New(env, (double)handle);
+}
+
+static Napi::Number WindowFromFloat64Array(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 || info.Length() > 2) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "windowFromFloat64Array(endpoints: Float64Array, maxIntervals?: number) expects 1-2 arguments"));
+    return Napi::Number::New(env, 0);
+  }
+
+  const double* endpoints = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[0], &endpoints, &n, "windowFromFloat64Array(endpoints)")) {
+    return Napi::Number::New(env, 0);
+  }
+  if (n % 2 != 0) {
+    ThrowSpiceError(Napi::RangeError::New(env, "windowFromFloat64Array(endpoints): length must be even"));
+    return Napi::Number::New(env, 0);
+  }
+  if (n / 2 > (size_t)(std::numeric_limits<int32_t>::max() / 2)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "windowFromFloat64Array(endpoints): too many intervals"));
+    return Napi::Number::New(env, 0);
+  }
+
+  size_t maxIntervals = 0;
+  if (!ReadOptionalCapacityArg(
+          env, info.Length() > 1 ? info[1] : env.Undefined(), "windowFromFloat64Array(maxIntervals)", n / 2, &maxIntervals)) {
+    return Napi::Number::New(env, 0);
+  }
+  if (maxIntervals < n / 2 || maxIntervals > (size_t)(std::numeric_limits<int32_t>::max() / 2)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env, "windowFromFloat64Array(maxIntervals): must be >= endpoints.length / 2"));
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+
+  uintptr_t ptr = 0;
+  if (tspice_new_window((int)maxIntervals, &ptr, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling windowFromFloat64Array", err);
+    return Napi::Number::New(env, 0);
+  }
+  if (tspice_window_import(ptr, endpoints, (int)n, err, (int)sizeof(err)) != 0) {
+    (void)tspice_free_window(ptr, nullptr, 0);
+    ThrowSpiceError(env, "CSPICE failed while calling windowFromFloat64Array", err);
+    return Napi::Number::New(env, 0);
+  }
+
+  const uint32_t handle = tspice_backend_node::AddCellHandle(
+      lock, env, ptr, "windowFromFloat64Array", tspice_backend_node::NativeMemoryKind::kWindows);
+  if (handle == 0) {
+    // Best-effort: avoid leaking the newly allocated window.
+    (void)tspice_free_window(ptr, err, (int)sizeof(err));
+    return Napi::Number::New(env, 0);
+  }
+  return Napi::Number::New(env, (double)handle);
+}
+
+// --- Window set algebra --------------------------------------------------------
+//
+// `wn*Packed(a, b?, ..., out?)` operands are either SpiceWindow handles or packed Float64Array
+// windows. The merge itself runs in `window_algebra.h` without CSPICE; the lock is only taken to
+// read handle operands and to write the optional `out` handle. Without `out` the result is
+// returned as a packed Float64Array.
+
+namespace {
+
+struct WindowOperand {
+  bool isHandle = false;
+  uint32_t handle = 0;
+  const double* data = nullptr;
+  size_t n = 0;
+  std::vector<double> storage;
+};
+
+bool ParseWindowOperand(Napi::Env env, const Napi::Value& value, const std::string& label, WindowOperand* out) {
+  if (value.IsTypedArray()) {
+    if (!tspice_napi::ReadFloat64ArrayArg(env, value, &out->data, &out->n, label.c_str())) {
+      return false;
+    }
+    if (!tspice_backend_node::window_algebra::IsValidWindow(out->data, out->n)) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          label + ": expected sorted, disjoint [left, right] pairs (use windowFromFloat64Array to normalize)"));
+      return false;
+    }
+    return true;
+  }
+
+  out->isHandle = true;
+  return tspice_backend_node::ReadCellHandleArg(env, value, label.c_str(), &out->handle);
+}
+
+bool LoadWindowOperand(
+    const tspice_backend_node::CspiceLock& lock,
+    Napi::Env env,
+    const char* context,
+    WindowOperand* op) {
+  if (!op->isHandle) return true;
+
+  const uintptr_t ptr = tspice_backend_node::GetCellHandlePtrOrThrow(lock, env, op->handle, SPICE_DP, context, "window");
+  if (env.IsExceptionPending()) return false;
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  int card = 0;
+  if (tspice_card(ptr, &card, err, (int)sizeof(err)) == 0) {
+    op->storage.resize((size_t)card);
+    if (tspice_cell_export_double(ptr, op->storage.data(), card, &card, err, (int)sizeof(err)) == 0) {
+      op->data = op->storage.data();
+      op->n = op->storage.size();
+      return true;
+    }
+  }
+  ThrowSpiceError(env, std::string("CSPICE failed while calling ") + context, err);
+  return false;
+}
+
+template <typename Compute>
+Napi::Value RunWindowOp(
+    Napi::Env env,
+    const char* context,
+    WindowOperand* a,
+    WindowOperand* b,
+    const Napi::Value& outArg,
+    Compute compute) {
+  const bool hasOut = !outArg.IsUndefined();
+  uint32_t outHandle = 0;
+  if (hasOut && !tspice_backend_node::ReadCellHandleArg(env, outArg, "out", &outHandle)) {
+    return env.Undefined();
+  }
+
+  std::optional<tspice_backend_node::CspiceLock> lock;
+  if (hasOut || a->isHandle || (b != nullptr && b->isHandle)) {
+    lock.emplace();
+    if (!LoadWindowOperand(*lock, env, context, a)) return env.Undefined();
+    if (b != nullptr && !LoadWindowOperand(*lock, env, context, b)) return env.Undefined();
+    if (!hasOut) lock.reset();
+  }
+
+  std::vector<double> result;
+  compute(&result);
+
+  if (!hasOut) {
+    Napi::Float64Array out = Napi::Float64Array::New(env, result.size());
+    if (!result.empty()) {
+      std::memcpy(out.Data(), result.data(), result.size() * sizeof(double));
+    }
+    return out;
+  }
+
+  const uintptr_t outPtr = tspice_backend_node::GetCellHandlePtrOrThrow(*lock, env, outHandle, SPICE_DP, context, "window");
+  if (env.IsExceptionPending()) return env.Undefined();
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_window_import(outPtr, result.data(), (int)result.size(), err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + context, err);
+  }
+  return env.Undefined();
+}
+
+using BinaryWindowFn = void (*)(const double*, size_t, const double*, size_t, std::vector<double>*);
+
+Napi::Value BinaryWindowOp(const Napi::CallbackInfo& info, const char* name, BinaryWindowFn fn) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 2 || info.Length() > 3) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(a: SpiceWindow | Float64Array, b: SpiceWindow | Float64Array, out?: SpiceWindow) expects 2-3 arguments"));
+    return env.Undefined();
+  }
+
+  WindowOperand a;
+  WindowOperand b;
+  if (!ParseWindowOperand(env, info[0], std::string(name) + "(a)", &a)) return env.Undefined();
+  if (!ParseWindowOperand(env, info[1], std::string(name) + "(b)", &b)) return env.Undefined();
+
+  return RunWindowOp(env, name, &a, &b, info.Length() > 2 ? info[2] : env.Undefined(), [&](std::vector<double>* out) {
+    fn(a.data, a.n, b.data, b.n, out);
+  });
+}
+
+// (window, p1, p2?, out?) with finite number parameters.
+Napi::Value UnaryWindowOp(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* signature,
+    size_t numParams,
+    void (*fn)(const double*, size_t, const double* params, std::vector<double>*)) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 + numParams || info.Length() > 2 + numParams) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + signature));
+    return env.Undefined();
+  }
+
+  double params[2] = {0.0, 0.0};
+  for (size_t i = 0; i < numParams; i++) {
+    if (!info[1 + i].IsNumber() || !std::isfinite(info[1 + i].As<Napi::Number>().DoubleValue())) {
+      ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + signature));
+      return env.Undefined();
+    }
+    params[i] = info[1 + i].As<Napi::Number>().DoubleValue();
+  }
+
+  WindowOperand a;
+  if (!ParseWindowOperand(env, info[0], std::string(name) + "(window)", &a)) return env.Undefined();
+
+  const Napi::Value outArg = info.Length() > 1 + numParams ? info[1 + numParams] : env.Undefined();
+  return RunWindowOp(env, name, &a, nullptr, outArg, [&](std::vector<double>* out) { fn(a.data, a.n, params, out); });
+}
+
+}  // namespace
+
+static Napi::Value WnunidPacked(const Napi::CallbackInfo& info) {
+  return BinaryWindowOp(info, "wnunidPacked", tspice_backend_node::window_algebra::Union);
+}
+
+static Napi::Value WnintdPacked(const Napi::CallbackInfo& info) {
+  return BinaryWindowOp(info, "wnintdPacked", tspice_backend_node::window_algebra::Intersect);
+}
+
+static Napi::Value WndifdPacked(const Napi::CallbackInfo& info) {
+  return BinaryWindowOp(info, "wndifdPacked", tspice_backend_node::window_algebra::Difference);
+}
+
+static Napi::Value WnexpdPacked(const Napi::CallbackInfo& info) {
+  return UnaryWindowOp(
+      info,
+      "wnexpdPacked",
+      "(window: SpiceWindow | Float64Array, left: number, right: number, out?: SpiceWindow) expects 3-4 arguments",
+      2,
+      [](const double* w, size_t n, const double* p, std::vector<double>* out) {
+        tspice_backend_node::window_algebra::Expand(w, n, p[0], p[1], out);
+      });
+}
+
+static Napi::Value WncondPacked(const Napi::CallbackInfo& info) {
+  return UnaryWindowOp(
+      info,
+      "wncondPacked",
+      "(window: SpiceWindow | Float64Array, left: number, right: number, out?: SpiceWindow) expects 3-4 arguments",
+      2,
+      [](const double* w, size_t n, const double* p, std::vector<double>* out) {
+        tspice_backend_node::window_algebra::Contract(w, n, p[0], p[1], out);
+      });
+}
+
+static Napi::Value WnfltdPacked(const Napi::CallbackInfo& info) {
+  return UnaryWindowOp(
+      info,
+      "wnfltdPacked",
+      "(window: SpiceWindow | Float64Array, small: number, out?: SpiceWindow) expects 2-3 arguments",
+      1,
+      [](const double* w, size_t n, const double* p, std::vector<double>* out) {
+        tspice_backend_node::window_algebra::Filter(w, n, p[0], out);
+      });
+}
+
 namespace tspice_backend_node {
 
 void RegisterCellsWindows(Napi::Env env, Napi::Object exports) {
@@ -680,6 +1192,39 @@ void RegisterCellsWindows(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "wnvald", Napi::Function::New(env, Wnvald), __func__)) {
     return;
   }
+
+  if (!SetExportChecked(env, exports, "cellToTypedArray", Napi::Function::New(env, CellToTypedArray), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "cellFromTypedArray", Napi::Function::New(env, CellFromTypedArray), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "windowToFloat64Array", Napi::Function::New(env, WindowToFloat64Array), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(
+          env, exports, "windowFromFloat64Array", Napi::Function::New(env, WindowFromFloat64Array), __func__)) {
+    return;
+  }
+
+  if (!SetExportChecked(env, exports, "wnunidPacked", Napi::Function::New(env, WnunidPacked), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "wnintdPacked", Napi::Function::New(env, WnintdPacked), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "wndifdPacked", Napi::Function::New(env, WndifdPacked), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "wnexpdPacked", Napi::Function::New(env, WnexpdPacked), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "wncondPacked", Napi::Function::New(env, WncondPacked), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "wnfltdPacked", Napi::Function::New(env, WnfltdPacked), __func__)) {
+    return;
+  }
 }
 
 }  // namespace tspice_backend_node
@@ -1,13 +1,19 @@
 #include "coords_vectors.h"
 
+#include <climits>
+#include <string>
+
 #include "../addon_common.h"
 #include "../napi_helpers.h"
+#include "../vector_math.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::MakeNumberArray;
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 
+namespace vector_math = tspice_backend_node::vector_math;
+
 static Napi::Object Reclat(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -21,7 +27,7 @@ static Napi::Object Reclat(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double radius = 0.0;
   double lon = 0.0;
@@ -53,7 +59,7 @@ static Napi::Array Latrec(const Napi::CallbackInfo& info) {
   const double lon = info[1].As<Napi::Number>().DoubleValue();
   const double lat = info[2].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double rect[3] = {0};
   const int code = tspice_latrec(radius, lon, lat, rect, err, (int)sizeof(err));
@@ -78,7 +84,7 @@ static Napi::Object Recsph(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double radius = 0.0;
   double colat = 0.0;
@@ -110,7 +116,7 @@ static Napi::Array Sphrec(const Napi::CallbackInfo& info) {
   const double colat = info[1].As<Napi::Number>().DoubleValue();
   const double lon = info[2].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double rect[3] = {0};
   const int code = tspice_sphrec(radius, colat, lon, rect, err, (int)sizeof(err));
@@ -122,6 +128,11 @@ static Napi::Array Sphrec(const Napi::CallbackInfo& info) {
   return MakeNumberArray(env, rect, 3);
 }
 
+// --- pure vector/matrix math -----------------------------------------------
+//
+// These are stateless, so they run the lock-free ports in `vector_math.h` instead of going through
+// the shim and never wait on `g_cspice_mutex`.
+
 static Napi::Number Vnorm(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -135,14 +146,7 @@ static Napi::Number Vnorm(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
-  double out = 0.0;
-  const int code = tspice_vnorm(v, &out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vnorm", err);
-    return Napi::Number::New(env, 0);
-  }
+  const double out = vector_math::Vnorm(v);
 
   return Napi::Number::New(env, out);
 }
@@ -160,14 +164,8 @@ static Napi::Array Vhat(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vhat(v, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vhat", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vhat(v, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -189,14 +187,7 @@ static Napi::Number Vdot(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
-  double out = 0.0;
-  const int code = tspice_vdot(a, b, &out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vdot", err);
-    return Napi::Number::New(env, 0);
-  }
+  const double out = vector_math::Vdot(a, b);
 
   return Napi::Number::New(env, out);
 }
@@ -218,14 +209,8 @@ static Napi::Array Vcrss(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vcrss(a, b, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vcrss", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vcrss(a, b, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -247,14 +232,8 @@ static Napi::Array Mxv(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_mxv(m, v, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling mxv", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Mxv(m, v, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -276,14 +255,8 @@ static Napi::Array Mtxv(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_mtxv(m, v, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling mtxv", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Mtxv(m, v, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -306,14 +279,8 @@ static Napi::Array Vadd(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vadd(a, b, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vadd", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vadd(a, b, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -335,14 +302,8 @@ static Napi::Array Vsub(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vsub(a, b, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vsub", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vsub(a, b, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -360,14 +321,8 @@ static Napi::Array Vminus(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vminus(v, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vminus", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vminus(v, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -387,14 +342,8 @@ static Napi::Array Vscl(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
-  const int code = tspice_vscl(s, v, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling vscl", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Vscl(s, v, out);
 
   return MakeNumberArray(env, out, 3);
 }
@@ -416,14 +365,8 @@ static Napi::Array Mxm(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[9] = {0};
-  const int code = tspice_mxm(a, b, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling mxm", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Mxm(a, b, out);
 
   return MakeNumberArray(env, out, 9);
 }
@@ -439,14 +382,8 @@ static Napi::Array Rotate(const Napi::CallbackInfo& info) {
   const double angle = info[0].As<Napi::Number>().DoubleValue();
   const int axis = info[1].As<Napi::Number>().Int32Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[9] = {0};
-  const int code = tspice_rotate(angle, axis, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling rotate", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Rotate(angle, axis, out);
 
   return MakeNumberArray(env, out, 9);
 }
@@ -467,14 +404,8 @@ static Napi::Array Rotmat(const Napi::CallbackInfo& info) {
   const double angle = info[1].As<Napi::Number>().DoubleValue();
   const int axis = info[2].As<Napi::Number>().Int32Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[9] = {0};
-  const int code = tspice_rotmat(m, angle, axis, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling rotmat", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Rotmat(m, angle, axis, out);
 
   return MakeNumberArray(env, out, 9);
 }
@@ -494,14 +425,8 @@ static Napi::Array Axisar(const Napi::CallbackInfo& info) {
 
   const double angle = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double out[9] = {0};
-  const int code = tspice_axisar(axisVec, angle, out, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling axisar", err);
-    return Napi::Array::New(env);
-  }
+  vector_math::Axisar(axisVec, angle, out);
 
   return MakeNumberArray(env, out, 9);
 }
@@ -523,7 +448,7 @@ static Napi::Array Georec(const Napi::CallbackInfo& info) {
   const double re = info[3].As<Napi::Number>().DoubleValue();
   const double f = info[4].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double out[3] = {0};
   const int code = tspice_georec(lon, lat, alt, re, f, out, err, (int)sizeof(err));
@@ -551,7 +476,7 @@ static Napi::Object Recgeo(const Napi::CallbackInfo& info) {
   const double re = info[1].As<Napi::Number>().DoubleValue();
   const double f = info[2].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double lon = 0.0;
   double lat = 0.0;
@@ -569,6 +494,213 @@ static Napi::Object Recgeo(const Napi::CallbackInfo& info) {
   return out;
 }
 
+// --- `*Into` variants -------------------------------------------------------
+//
+// Same math as the boxed entrypoints above, but the result is written straight into a
+// caller-supplied `Float64Array` and the call returns `undefined`. Inputs are still copied into
+// locals first, so `out` may alias one of the inputs.
+
+using BinaryVecIntoFn = void (*)(const double*, const double*, double*);
+
+static Napi::Value BinaryInto(
+    const Napi::CallbackInfo& info,
+    const char* signature,
+    size_t aLength,
+    size_t bLength,
+    size_t outLength,
+    BinaryVecIntoFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(signature) + " expects 3 arguments"));
+    return env.Undefined();
+  }
+
+  double a[9] = {0};
+  double b[9] = {0};
+  if (!tspice_backend_node::ReadNumberArrayFixed(env, info[0], aLength, a, "a")) {
+    return env.Undefined();
+  }
+  if (!tspice_backend_node::ReadNumberArrayFixed(env, info[1], bLength, b, "b")) {
+    return env.Undefined();
+  }
+
+  double* out = nullptr;
+  if (!tspice_napi::ReadFloat64ArrayOut(env, info[2], outLength, &out, "out")) {
+    return env.Undefined();
+  }
+
+  fn(a, b, out);
+  return env.Undefined();
+}
+
+static Napi::Value VcrssInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "vcrssInto(a: number[3], b: number[3], out: Float64Array)", 3, 3, 3,
+      vector_math::Vcrss);
+}
+
+static Napi::Value VaddInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "vaddInto(a: number[3], b: number[3], out: Float64Array)", 3, 3, 3,
+      vector_math::Vadd);
+}
+
+static Napi::Value VsubInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "vsubInto(a: number[3], b: number[3], out: Float64Array)", 3, 3, 3,
+      vector_math::Vsub);
+}
+
+static Napi::Value MxvInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "mxvInto(m: number[9], v: number[3], out: Float64Array)", 9, 3, 3,
+      vector_math::Mxv);
+}
+
+static Napi::Value MtxvInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "mtxvInto(m: number[9], v: number[3], out: Float64Array)", 9, 3, 3,
+      vector_math::Mtxv);
+}
+
+static Napi::Value MxmInto(const Napi::CallbackInfo& info) {
+  return BinaryInto(
+      info, "mxmInto(a: number[9], b: number[9], out: Float64Array)", 9, 9, 9,
+      vector_math::Mxm);
+}
+
+// --- batched coordinate conversions ----------------------------------------
+//
+// `in` is a packed `Float64Array` of 3-vectors (length a multiple of 3). The result goes into
+// `out` when given (same length; may be `in` itself) or a fresh `Float64Array`, and is returned.
+
+using Coord3BatchFn = int (*)(const double*, int, double*, char*, int);
+using GeodeticBatchFn = int (*)(const double*, int, double, double, double*, char*, int);
+
+static bool ReadPacked3Batch(
+    Napi::Env env,
+    const Napi::Value& inValue,
+    const Napi::Value* outValue,
+    const char* name,
+    const double** in,
+    int* n,
+    Napi::Float64Array* out) {
+  size_t length = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, inValue, in, &length, "in")) {
+    return false;
+  }
+  if (length % 3 != 0 || length / 3 > static_cast<size_t>(INT_MAX)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        std::string(name) + "(): in.length must be a multiple of 3 (got " + std::to_string(length) + ")"));
+    return false;
+  }
+  *n = static_cast<int>(length / 3);
+
+  if (outValue != nullptr && !outValue->IsUndefined()) {
+    double* outData = nullptr;
+    if (!tspice_napi::ReadFloat64ArrayOut(env, *outValue, length, &outData, "out")) {
+      return false;
+    }
+    *out = outValue->As<Napi::Float64Array>();
+  } else {
+    *out = Napi::Float64Array::New(env, length);
+  }
+  return true;
+}
+
+static Napi::Value Coord3Batch(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* signature,
+    Coord3BatchFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 1 || info.Length() > 2) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(signature) + " expects 1 or 2 arguments"));
+    return env.Undefined();
+  }
+
+  const double* in = nullptr;
+  int n = 0;
+  Napi::Float64Array out;
+  const Napi::Value outArg = info[1];
+  if (!ReadPacked3Batch(env, info[0], &outArg, name, &in, &n, &out)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = fn(in, n, out.Data(), err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+    return env.Undefined();
+  }
+  return out;
+}
+
+static Napi::Value GeodeticBatch(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* signature,
+    GeodeticBatchFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 3 || info.Length() > 4 || !info[1].IsNumber() || !info[2].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(signature) + " expects (Float64Array, number, number, Float64Array?)"));
+    return env.Undefined();
+  }
+
+  const double re = info[1].As<Napi::Number>().DoubleValue();
+  const double f = info[2].As<Napi::Number>().DoubleValue();
+
+  const double* in = nullptr;
+  int n = 0;
+  Napi::Float64Array out;
+  const Napi::Value outArg = info[3];
+  if (!ReadPacked3Batch(env, info[0], &outArg, name, &in, &n, &out)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = fn(in, n, re, f, out.Data(), err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+    return env.Undefined();
+  }
+  return out;
+}
+
+static Napi::Value ReclatBatch(const Napi::CallbackInfo& info) {
+  return Coord3Batch(info, "reclatBatch", "reclatBatch(rect: Float64Array, out?: Float64Array)", tspice_reclat_batch);
+}
+
+static Napi::Value LatrecBatch(const Napi::CallbackInfo& info) {
+  return Coord3Batch(info, "latrecBatch", "latrecBatch(lat: Float64Array, out?: Float64Array)", tspice_latrec_batch);
+}
+
+static Napi::Value RecsphBatch(const Napi::CallbackInfo& info) {
+  return Coord3Batch(info, "recsphBatch", "recsphBatch(rect: Float64Array, out?: Float64Array)", tspice_recsph_batch);
+}
+
+static Napi::Value SphrecBatch(const Napi::CallbackInfo& info) {
+  return Coord3Batch(info, "sphrecBatch", "sphrecBatch(sph: Float64Array, out?: Float64Array)", tspice_sphrec_batch);
+}
+
+static Napi::Value GeorecBatch(const Napi::CallbackInfo& info) {
+  return GeodeticBatch(
+      info, "georecBatch", "georecBatch(geo: Float64Array, re: number, f: number, out?: Float64Array)",
+      tspice_georec_batch);
+}
+
+static Napi::Value RecgeoBatch(const Napi::CallbackInfo& info) {
+  return GeodeticBatch(
+      info, "recgeoBatch", "recgeoBatch(rect: Float64Array, re: number, f: number, out?: Float64Array)",
+      tspice_recgeo_batch);
+}
+
 namespace tspice_backend_node {
 
 void RegisterCoordsVectors(Napi::Env env, Napi::Object exports) {
@@ -593,6 +725,20 @@ void RegisterCoordsVectors(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "axisar", Napi::Function::New(env, Axisar), __func__)) return;
   if (!SetExportChecked(env, exports, "georec", Napi::Function::New(env, Georec), __func__)) return;
   if (!SetExportChecked(env, exports, "recgeo", Napi::Function::New(env, Recgeo), __func__)) return;
+
+  if (!SetExportChecked(env, exports, "vcrssInto", Napi::Function::New(env, VcrssInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "vaddInto", Napi::Function::New(env, VaddInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "vsubInto", Napi::Function::New(env, VsubInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "mxvInto", Napi::Function::New(env, MxvInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "mtxvInto", Napi::Function::New(env, MtxvInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "mxmInto", Napi::Function::New(env, MxmInto), __func__)) return;
+
+  if (!SetExportChecked(env, exports, "reclatBatch", Napi::Function::New(env, ReclatBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "latrecBatch", Napi::Function::New(env, LatrecBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "recsphBatch", Napi::Function::New(env, RecsphBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "sphrecBatch", Napi::Function::New(env, SphrecBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "georecBatch", Napi::Function::New(env, GeorecBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "recgeoBatch", Napi::Function::New(env, RecgeoBatch), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
@@ -3,11 +3,16 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "../addon_common.h"
 #include "../cell_handles.h"
+#include "../dsk_bvh.h"
+#include "../instance_data.h"
 #include "../napi_helpers.h"
+#include "../native_memory.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::SetExportChecked;
@@ -259,6 +264,231 @@ static Napi::Value Dskb02(const Napi::CallbackInfo& info) {
   return result;
 }
 
+static Napi::Value Dskx02(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 4) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "dskx02(handle: SpiceHandle, dladsc: DlaDescriptor, vertex: SpiceVector3, raydir: SpiceVector3) expects 4 args"));
+    return env.Undefined();
+  }
+
+  int32_t handle = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &handle)) {
+    return env.Undefined();
+  }
+
+  int32_t descr8[8];
+  if (!ReadDlaDescriptor(env, info[1], descr8)) {
+    return env.Undefined();
+  }
+
+  double vertex[3];
+  double raydir[3];
+  if (!tspice_backend_node::ReadVec3(env, info[2], vertex, "vertex") ||
+      !tspice_backend_node::ReadVec3(env, info[3], raydir, "raydir")) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+
+  int32_t plid = 0;
+  double xpt[3];
+  int32_t found = 0;
+  const int code = tspice_dskx02(handle, descr8, vertex, raydir, &plid, xpt, &found, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling dskx02", err);
+    return env.Undefined();
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("found", Napi::Boolean::New(env, found != 0));
+  if (found != 0) {
+    result.Set("plid", Napi::Number::New(env, (double)plid));
+    Napi::Array point = Napi::Array::New(env, 3);
+    for (uint32_t i = 0; i < 3; i++) {
+      point.Set(i, Napi::Number::New(env, xpt[i]));
+    }
+    result.Set("xpt", point);
+  }
+  return result;
+}
+
+// --- Plate BVH ---------------------------------------------------------------
+
+static Napi::Value DskBvhBuild(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 2) {
+    ThrowSpiceError(Napi::TypeError::New(env, "dskBvhBuild(handle: SpiceHandle, dladsc: DlaDescriptor) expects 2 args"));
+    return env.Undefined();
+  }
+
+  int32_t handle = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &handle)) {
+    return env.Undefined();
+  }
+
+  int32_t descr8[8];
+  if (!ReadDlaDescriptor(env, info[1], descr8)) {
+    return env.Undefined();
+  }
+
+  std::vector<double> vertices;
+  std::vector<int32_t> plates;
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+
+    int32_t ints10[10];
+    double doubles10[10];
+    if (tspice_dskb02(handle, descr8, ints10, doubles10, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling dskBvhBuild (dskb02)", err);
+      return env.Undefined();
+    }
+    const int nv = ints10[0];
+    const int np = ints10[1];
+
+    vertices.resize(static_cast<size_t>(nv) * 3);
+    plates.resize(static_cast<size_t>(np) * 3);
+    int got = 0;
+    if (nv > 0 && tspice_dskv02(handle, descr8, 1, nv, &got, vertices.data(), err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling dskBvhBuild (dskv02)", err);
+      return env.Undefined();
+    }
+    if (np > 0 && tspice_dskp02(handle, descr8, 1, np, &got, plates.data(), err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling dskBvhBuild (dskp02)", err);
+      return env.Undefined();
+    }
+  }
+
+  // The tree is built from the copy, outside the CSPICE lock.
+  std::shared_ptr<const tspice_backend_node::DskPlateBvh> bvh = tspice_backend_node::DskPlateBvh::Build(vertices, plates);
+  if (bvh == nullptr) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskBvhBuild(): segment has a plate that refers to a missing vertex"));
+    return env.Undefined();
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("nv", Napi::Number::New(env, (double)(vertices.size() / 3)));
+  result.Set("np", Napi::Number::New(env, (double)bvh->PlateCount()));
+  result.Set("nodes", Napi::Number::New(env, (double)bvh->NodeCount()));
+  const size_t bytes = bvh->ByteSize();
+  const uint32_t id = tspice_backend_node::RegisterDskBvh(std::move(bvh));
+  tspice_backend_node::GetInstanceData(env).dskBvhs.insert(id);
+  tspice_backend_node::TrackNativeAllocation(env, tspice_backend_node::NativeMemoryKind::kDskBvhs, bytes);
+  result.Set("id", Napi::Number::New(env, (double)id));
+  return result;
+}
+
+static bool ReadDskBvhId(Napi::Env env, const Napi::Value& value, const char* fn, uint32_t* out) {
+  int32_t id = 0;
+  if (!ReadInt32Checked(env, value, "index", &id)) return false;
+  if (id <= 0) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(fn) + "(): unknown or disposed index " + std::to_string(id)));
+    return false;
+  }
+  *out = static_cast<uint32_t>(id);
+  return true;
+}
+
+// Casts rays against a built index. No CSPICE state is touched, so the CSPICE lock is not taken
+// and the rays are spread across native threads.
+static Napi::Value DskBvhRaycast(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 4 || !info[3].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "dskBvhRaycast(index: number, vertices: Float64Array, raydirs: Float64Array, threads: number) expects (number, Float64Array, Float64Array, number)"));
+    return env.Undefined();
+  }
+
+  uint32_t id = 0;
+  if (!ReadDskBvhId(env, info[0], "dskBvhRaycast", &id)) return env.Undefined();
+
+  const double* vertices = nullptr;
+  size_t verticesLen = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &vertices, &verticesLen, "vertices")) return env.Undefined();
+  const double* raydirs = nullptr;
+  size_t raydirsLen = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[2], &raydirs, &raydirsLen, "raydirs")) return env.Undefined();
+
+  if (verticesLen % 3 != 0 || raydirsLen % 3 != 0 ||
+      (verticesLen != raydirsLen && verticesLen != 3 && raydirsLen != 3)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        "dskBvhRaycast(): vertices and raydirs must hold 3 doubles (shared) or 3 per ray, got lengths " +
+            std::to_string(verticesLen) + " and " + std::to_string(raydirsLen)));
+    return env.Undefined();
+  }
+  const size_t n = (verticesLen == 0 || raydirsLen == 0) ? 0 : std::max(verticesLen, raydirsLen) / 3;
+
+  const double threadsArg = info[3].As<Napi::Number>().DoubleValue();
+  if (!std::isfinite(threadsArg) || std::floor(threadsArg) != threadsArg || threadsArg < 0 || threadsArg > 1024) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskBvhRaycast(): threads must be an integer in [0, 1024]"));
+    return env.Undefined();
+  }
+
+  for (size_t i = 0; i < raydirsLen; i += 3) {
+    if (raydirs[i] == 0 && raydirs[i + 1] == 0 && raydirs[i + 2] == 0) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env, "dskBvhRaycast(): raydirs[" + std::to_string(i / 3) + "] is the zero vector"));
+      return env.Undefined();
+    }
+  }
+
+  // Indexes belong to the environment that built them.
+  std::shared_ptr<const tspice_backend_node::DskPlateBvh> bvh =
+      tspice_backend_node::GetInstanceData(env).dskBvhs.count(id) != 0 ? tspice_backend_node::LookupDskBvh(id)
+                                                                        : nullptr;
+  if (bvh == nullptr) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskBvhRaycast(): unknown or disposed index " + std::to_string(id)));
+    return env.Undefined();
+  }
+
+  Napi::Float64Array points = Napi::Float64Array::New(env, n * 3);
+  Napi::Int32Array plates = Napi::Int32Array::New(env, n);
+  Napi::Uint8Array found = Napi::Uint8Array::New(env, (n + 7) / 8);
+  if (env.IsExceptionPending()) return env.Undefined();
+
+  if (n > 0) {
+    tspice_backend_node::RaycastDskBvhBatch(
+        *bvh,
+        vertices,
+        verticesLen == 3,
+        raydirs,
+        raydirsLen == 3,
+        n,
+        static_cast<unsigned>(threadsArg),
+        points.Data(),
+        plates.Data(),
+        found.Data());
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("points", points);
+  result.Set("plates", plates);
+  result.Set("found", found);
+  return result;
+}
+
+static void DskBvhFree(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "dskBvhFree(index: number) expects 1 arg"));
+    return;
+  }
+
+  uint32_t id = 0;
+  if (!ReadDskBvhId(env, info[0], "dskBvhFree", &id)) return;
+  size_t bytes = 0;
+  if (tspice_backend_node::GetInstanceData(env).dskBvhs.erase(id) == 0 ||
+      !tspice_backend_node::ReleaseDskBvh(id, &bytes)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskBvhFree(): unknown or disposed index " + std::to_string(id)));
+    return;
+  }
+  tspice_backend_node::TrackNativeRelease(env, tspice_backend_node::NativeMemoryKind::kDskBvhs, bytes);
+}
+
 namespace tspice_backend_node {
 
 void RegisterDsk(Napi::Env env, Napi::Object exports) {
@@ -266,6 +496,10 @@ void RegisterDsk(Napi::Env env, Napi::Object exports) {
   SetExportChecked(env, exports, "dsksrf", Napi::Function::New(env, Dsksrf), "RegisterDsk");
   SetExportChecked(env, exports, "dskgd", Napi::Function::New(env, Dskgd), "RegisterDsk");
   SetExportChecked(env, exports, "dskb02", Napi::Function::New(env, Dskb02), "RegisterDsk");
+  SetExportChecked(env, exports, "dskx02", Napi::Function::New(env, Dskx02), "RegisterDsk");
+  SetExportChecked(env, exports, "dskBvhBuild", Napi::Function::New(env, DskBvhBuild), "RegisterDsk");
+  SetExportChecked(env, exports, "dskBvhRaycast", Napi::Function::New(env, DskBvhRaycast), "RegisterDsk");
+  SetExportChecked(env, exports, "dskBvhFree", Napi::Function::New(env, DskBvhFree), "RegisterDsk");
 }
 
 }  // namespace tspice_backend_node
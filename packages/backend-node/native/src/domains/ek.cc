@@ -1,16 +1,22 @@
 #include "ek.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <cmath>
 #include <cstdint>
 #include <limits>
 
 #include "../addon_common.h"
+#include "../cspice_executor.h"
+#include "../instance_data.h"
 #include "../napi_helpers.h"
+#include "../pool_generation.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::FixedWidthToJsString;
@@ -253,7 +259,7 @@ static Napi::Number Ekopr(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_ekopr(path.c_str(), &handle, err, (int)sizeof(err));
@@ -280,7 +286,7 @@ static Napi::Number Ekopw(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_ekopw(path.c_str(), &handle, err, (int)sizeof(err));
@@ -320,7 +326,7 @@ static Napi::Number Ekopn(const Napi::CallbackInfo& info) {
   const std::string path = info[0].As<Napi::String>().Utf8Value();
   const std::string ifname = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_ekopn(path.c_str(), ifname.c_str(), ncomch, &handle, err, (int)sizeof(err));
@@ -354,7 +360,7 @@ static void Ekcls(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekcls(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -375,7 +381,7 @@ static Napi::Number Ekntab(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int n = 0;
   const int code = tspice_ekntab(&n, err, (int)sizeof(err));
@@ -405,7 +411,7 @@ static Napi::String Ektnam(const Napi::CallbackInfo& info) {
     return Napi::String::New(env, "");
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
 
@@ -436,7 +442,7 @@ static Napi::Number Eknseg(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int nseg = 0;
   const int code = tspice_eknseg(handle, &nseg, err, (int)sizeof(err));
@@ -453,6 +459,11 @@ static Napi::Number Eknseg(const Napi::CallbackInfo& info) {
   return Napi::Number::New(env, (double)nseg);
 }
 
+// Bumped by every `ekfind` the addon runs (guarded by `g_cspice_mutex`). CSPICE
+// keeps a single query result, so a cursor whose stamp no longer matches must
+// re-run its own query before reading more rows.
+static uint64_t g_ek_find_epoch = 0;
+
 static Napi::Object Ekfind(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -466,7 +477,7 @@ static Napi::Object Ekfind(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char errmsg[tspice_backend_node::kOutMaxBytes];
   int nmrows = 0;
@@ -480,6 +491,7 @@ static Napi::Object Ekfind(const Napi::CallbackInfo& info) {
       errmsg,
       err,
       (int)sizeof(err));
+  g_ek_find_epoch++;
 
   if (code != 0) {
     ThrowSpiceError(
@@ -525,7 +537,7 @@ static Napi::Object Ekgc(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   int isNull = 0;
@@ -594,7 +606,7 @@ static Napi::Object Ekgd(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double out = 0;
   int isNull = 0;
@@ -653,7 +665,7 @@ static Napi::Object Ekgi(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int out = 0;
   int isNull = 0;
@@ -690,6 +702,746 @@ static Napi::Object Ekgi(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// --- Columnar query ---------------------------------------------------------
+
+// Matches `ekpsel_c`'s own SPICE_EK_MAXQSEL limit for the SELECT clause.
+constexpr int kMaxEkQueryColumns = 50;
+// Large enough for `SPICE_EK_CSTRLN` (table + column + NUL).
+constexpr int kEkColumnNameMaxBytes = 128;
+
+// One selected column of an `ekfind` result, gathered under the CSPICE lock.
+//
+// Every entry occupies at least one element slot; null entries (and entries
+// with zero elements) occupy exactly one zeroed / empty slot so `values[r]`
+// lines up with row `r` for scalar columns.
+struct EkColumnData {
+  std::string table;
+  std::string name;
+  int type = 0;  // SpiceEKDataType: 0=CHR, 1=DP, 2=INT, 3=TIME
+  std::vector<uint8_t> nulls;  // one bit per row, LSB-first; set = null
+  std::vector<int32_t> ints;
+  std::vector<double> doubles;
+  std::vector<int32_t> offsets;  // CHR: element i is bytes[offsets[i], offsets[i + 1])
+  std::string bytes;
+  std::vector<int32_t> rowOffsets;  // row r is elements [rowOffsets[r], rowOffsets[r + 1])
+  bool multiValued = false;
+};
+
+static const char* EkTypeName(int type) {
+  switch (type) {
+    case 0:
+      return "CHR";
+    case 1:
+      return "DP";
+    case 2:
+      return "INT";
+    case 3:
+      return "TIME";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+static size_t EkElementCount(const EkColumnData& col) {
+  if (col.type == 0) return col.offsets.size() - 1;
+  if (col.type == 2) return col.ints.size();
+  return col.doubles.size();
+}
+
+// Reads one entry of column `selidx` into `col`, as its `slot`-th row (the
+// null bit index; equal to `row` unless reading a cursor batch). Returns the
+// shim status code; on failure `*failedOp` names the CSPICE routine that failed.
+static int ReadEkEntry(
+    int selidx,
+    int row,
+    int slot,
+    EkColumnData* col,
+    char* cbuf,
+    int cbufMaxBytes,
+    const char** failedOp,
+    char* err,
+    int errMaxBytes) {
+  int nelt = 0;
+  *failedOp = "eknelt";
+  int code = tspice_eknelt(selidx, row, &nelt, err, errMaxBytes);
+  if (code != 0) return code;
+
+  *failedOp = col->type == 0 ? "ekgc" : col->type == 2 ? "ekgi" : "ekgd";
+
+  const size_t before = EkElementCount(*col);
+  bool isNullEntry = false;
+
+  for (int elment = 0; elment < std::max(nelt, 1); elment++) {
+    int isNull = 0;
+    int found = 0;
+    if (col->type == 0) {
+      code = tspice_ekgc(selidx, row, elment, cbuf, cbufMaxBytes, &isNull, &found, err, errMaxBytes);
+      if (code != 0) return code;
+      if (found && !isNull) {
+        size_t len = std::strlen(cbuf);
+        while (len > 0 && tspice_napi::IsAsciiWhitespace(static_cast<unsigned char>(cbuf[len - 1]))) {
+          len--;
+        }
+        col->bytes.append(cbuf, len);
+      }
+      col->offsets.push_back(static_cast<int32_t>(col->bytes.size()));
+    } else if (col->type == 2) {
+      int value = 0;
+      code = tspice_ekgi(selidx, row, elment, &value, &isNull, &found, err, errMaxBytes);
+      if (code != 0) return code;
+      col->ints.push_back((found && !isNull) ? value : 0);
+    } else {
+      double value = 0;
+      code = tspice_ekgd(selidx, row, elment, &value, &isNull, &found, err, errMaxBytes);
+      if (code != 0) return code;
+      col->doubles.push_back((found && !isNull) ? value : 0.0);
+    }
+
+    if (isNull) {
+      // A null entry has no elements; keep the single placeholder slot.
+      isNullEntry = true;
+      break;
+    }
+  }
+
+  if (isNullEntry) {
+    col->nulls[static_cast<size_t>(slot) >> 3] |= static_cast<uint8_t>(1u << (slot & 7));
+  }
+
+  const size_t after = EkElementCount(*col);
+  if (after - before != 1) {
+    col->multiValued = true;
+  }
+  col->rowOffsets.push_back(static_cast<int32_t>(after));
+  return 0;
+}
+
+// `ekpsel` for `query`: fills `table`, `name` and `type` of one `EkColumnData`
+// per selected column. Returns the shim status code; a malformed query instead
+// sets `*qerr` and `errmsg`.
+static int SelectEkColumns(
+    const std::string& query,
+    std::vector<EkColumnData>* out,
+    int* qerr,
+    char* errmsg,
+    int errmsgMaxBytes,
+    char* err,
+    int errMaxBytes) {
+  int ncols = 0;
+  int types[kMaxEkQueryColumns];
+  std::vector<char> tabs(static_cast<size_t>(kMaxEkQueryColumns) * kEkColumnNameMaxBytes);
+  std::vector<char> cols(static_cast<size_t>(kMaxEkQueryColumns) * kEkColumnNameMaxBytes);
+  const int code = tspice_ekpsel(
+      query.c_str(),
+      kMaxEkQueryColumns,
+      kEkColumnNameMaxBytes,
+      errmsgMaxBytes,
+      &ncols,
+      types,
+      tabs.data(),
+      cols.data(),
+      qerr,
+      errmsg,
+      err,
+      errMaxBytes);
+  if (code != 0 || *qerr != 0) return code;
+
+  out->assign(static_cast<size_t>(ncols), EkColumnData());
+  for (int c = 0; c < ncols; c++) {
+    EkColumnData& col = (*out)[static_cast<size_t>(c)];
+    const char* tab = &tabs[static_cast<size_t>(c) * kEkColumnNameMaxBytes];
+    const char* name = &cols[static_cast<size_t>(c) * kEkColumnNameMaxBytes];
+    col.table = TrimAsciiWhitespace(std::string_view(tab, strnlen(tab, kEkColumnNameMaxBytes)));
+    col.name = TrimAsciiWhitespace(std::string_view(name, strnlen(name, kEkColumnNameMaxBytes)));
+    col.type = types[c];
+  }
+  return 0;
+}
+
+static Napi::Object EkQueryColumnar(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekQueryColumnar(query: string) expects exactly one string argument"));
+    return Napi::Object::New(env);
+  }
+
+  const std::string query = info[0].As<Napi::String>().Utf8Value();
+  if (!ValidateNonEmptyString(env, "ekQueryColumnar", "query", query)) {
+    return Napi::Object::New(env);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  char errmsg[tspice_backend_node::kOutMaxBytes];
+
+  const auto throwCspice = [&](const char* op) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling ekQueryColumnar(query) (") + op + ")",
+        err,
+        op,
+        [&](Napi::Object& obj) { obj.Set("query", Napi::String::New(env, query)); });
+  };
+  const auto makeQueryError = [&]() {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("ok", Napi::Boolean::New(env, false));
+    result.Set("errmsg", Napi::String::New(env, TrimAsciiWhitespace(errmsg)));
+    return result;
+  };
+
+  std::vector<EkColumnData> data;
+  int qerr = 0;
+  if (SelectEkColumns(query, &data, &qerr, errmsg, (int)sizeof(errmsg), err, (int)sizeof(err)) != 0) {
+    throwCspice("ekpsel");
+    return Napi::Object::New(env);
+  }
+  if (qerr != 0) {
+    return makeQueryError();
+  }
+
+  int nmrows = 0;
+  const int findCode =
+      tspice_ekfind(query.c_str(), (int)sizeof(errmsg), &nmrows, &qerr, errmsg, err, (int)sizeof(err));
+  g_ek_find_epoch++;
+  if (findCode != 0) {
+    throwCspice("ekfind");
+    return Napi::Object::New(env);
+  }
+  if (qerr != 0) {
+    return makeQueryError();
+  }
+
+  std::vector<char> cbuf(static_cast<size_t>(tspice_backend_node::kOutMaxBytes));
+  size_t totalBytes = 0;
+
+  for (int c = 0; c < static_cast<int>(data.size()); c++) {
+    EkColumnData& col = data[static_cast<size_t>(c)];
+    col.nulls.assign((static_cast<size_t>(nmrows) + 7) / 8, 0);
+    col.rowOffsets.reserve(static_cast<size_t>(nmrows) + 1);
+    col.rowOffsets.push_back(0);
+    if (col.type == 0) {
+      col.offsets.reserve(static_cast<size_t>(nmrows) + 1);
+      col.offsets.push_back(0);
+    } else if (col.type == 2) {
+      col.ints.reserve(static_cast<size_t>(nmrows));
+    } else {
+      col.doubles.reserve(static_cast<size_t>(nmrows));
+    }
+
+    for (int row = 0; row < nmrows; row++) {
+      const char* failedOp = nullptr;
+      if (ReadEkEntry(c, row, row, &col, cbuf.data(), (int)cbuf.size(), &failedOp, err, (int)sizeof(err)) != 0) {
+        throwCspice(failedOp);
+        return Napi::Object::New(env);
+      }
+      if (col.bytes.size() > kMaxEkCvalsBytes || col.rowOffsets.back() > (int32_t)kMaxEkArrayLen) {
+        ThrowSpiceError(Napi::RangeError::New(env, "ekQueryColumnar(): result column exceeds the maximum size"));
+        return Napi::Object::New(env);
+      }
+    }
+
+    totalBytes += col.bytes.size();
+    if (totalBytes > kMaxEkCvalsBytes) {
+      ThrowSpiceError(Napi::RangeError::New(env, "ekQueryColumnar(): result exceeds the maximum size"));
+      return Napi::Object::New(env);
+    }
+  }
+
+  const auto copyInt32 = [&](const std::vector<int32_t>& src) {
+    Napi::Int32Array arr = Napi::Int32Array::New(env, src.size());
+    if (!src.empty()) std::memcpy(arr.Data(), src.data(), src.size() * sizeof(int32_t));
+    return arr;
+  };
+
+  Napi::Array columns = Napi::Array::New(env, data.size());
+  for (size_t c = 0; c < data.size(); c++) {
+    const EkColumnData& col = data[c];
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("table", Napi::String::New(env, col.table));
+    obj.Set("name", Napi::String::New(env, col.name));
+    obj.Set("type", Napi::String::New(env, EkTypeName(col.type)));
+
+    Napi::Uint8Array nulls = Napi::Uint8Array::New(env, col.nulls.size());
+    if (!col.nulls.empty()) std::memcpy(nulls.Data(), col.nulls.data(), col.nulls.size());
+    obj.Set("nulls", nulls);
+
+    if (col.type == 0) {
+      obj.Set("offsets", copyInt32(col.offsets));
+      Napi::Uint8Array bytes = Napi::Uint8Array::New(env, col.bytes.size());
+      if (!col.bytes.empty()) std::memcpy(bytes.Data(), col.bytes.data(), col.bytes.size());
+      obj.Set("bytes", bytes);
+    } else if (col.type == 2) {
+      obj.Set("values", copyInt32(col.ints));
+    } else {
+      Napi::Float64Array values = Napi::Float64Array::New(env, col.doubles.size());
+      if (!col.doubles.empty()) std::memcpy(values.Data(), col.doubles.data(), col.doubles.size() * sizeof(double));
+      obj.Set("values", values);
+    }
+
+    if (col.multiValued) {
+      obj.Set("rowOffsets", copyInt32(col.rowOffsets));
+    }
+    columns.Set(static_cast<uint32_t>(c), obj);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("ok", Napi::Boolean::New(env, true));
+  result.Set("nmrows", Napi::Number::New(env, (double)nmrows));
+  result.Set("columns", columns);
+  return result;
+}
+
+// --- Query cursor -------------------------------------------------------------
+
+// Rows per cursor batch: enough to amortize the per-call overhead, small
+// enough that a batch of wide rows stays well under `kMaxEkCvalsBytes`.
+constexpr int kMaxEkCursorBatchRows = 1 << 20;
+
+// An `ekfind` result read `batchRows` rows at a time.
+//
+// The column scratch (`columns`) is cleared rather than reallocated between
+// batches, and `ekCursorTake` copies it into the typed arrays of the previous
+// batch whenever they are large enough, so memory stays bounded by one batch.
+// Cursors live in `g_ek_cursors` (guarded by `g_cspice_mutex`) and belong to
+// the environment that opened them.
+struct EkCursor {
+  std::string query;
+  int nmrows = 0;
+  int batchRows = 0;
+  int nextRow = 0;
+  // `g_ek_find_epoch` right after this cursor's own `ekfind`.
+  uint64_t findEpoch = 0;
+  // Kernel generation at open; loading or unloading kernels ends the cursor.
+  uint64_t kernels = 0;
+  std::vector<EkColumnData> columns;
+  std::vector<char> cbuf = std::vector<char>(static_cast<size_t>(tspice_backend_node::kOutMaxBytes));
+  // The batch currently held in `columns`, until `ekCursorTake` hands it out.
+  bool ready = false;
+  int batchStart = 0;
+  int batchCount = 0;
+  // Set while an `ekCursorReadAsync` is in flight; only touched on the JS thread.
+  std::atomic<bool> reading{false};
+};
+
+static std::unordered_map<uint32_t, std::shared_ptr<EkCursor>> g_ek_cursors;
+static uint32_t g_next_ek_cursor_id = 1;
+
+// Reads the next batch into `cursor.columns`. Returns the shim status code with
+// `*failedOp` set, or 0; `*invalidated` is set (and nothing read) when the
+// cursor can no longer continue.
+static int ReadEkCursorBatch(
+    const CspiceLock& lock,
+    EkCursor& cursor,
+    const char** failedOp,
+    std::string* invalidated,
+    char* err,
+    int errMaxBytes) {
+  (void)lock;
+  if (PoolGeneration(kPoolChangeKernels) != cursor.kernels) {
+    *invalidated = "kernels were loaded or unloaded since the cursor was opened";
+    return 0;
+  }
+
+  if (cursor.findEpoch != g_ek_find_epoch) {
+    // Another query ran in between; restore ours. Same files, same query: same rows.
+    char errmsg[tspice_backend_node::kOutMaxBytes];
+    int nmrows = 0;
+    int qerr = 0;
+    *failedOp = "ekfind";
+    const int code = tspice_ekfind(
+        cursor.query.c_str(), (int)sizeof(errmsg), &nmrows, &qerr, errmsg, err, errMaxBytes);
+    cursor.findEpoch = ++g_ek_find_epoch;
+    if (code != 0) return code;
+    if (qerr != 0 || nmrows != cursor.nmrows) {
+      *invalidated = "the query no longer matches the same rows";
+      return 0;
+    }
+  }
+
+  const int start = cursor.nextRow;
+  const int count = std::min(cursor.batchRows, cursor.nmrows - start);
+  size_t totalBytes = 0;
+
+  for (size_t c = 0; c < cursor.columns.size(); c++) {
+    EkColumnData& col = cursor.columns[c];
+    col.nulls.assign((static_cast<size_t>(count) + 7) / 8, 0);
+    col.ints.clear();
+    col.doubles.clear();
+    col.bytes.clear();
+    col.offsets.clear();
+    col.rowOffsets.clear();
+    col.rowOffsets.push_back(0);
+    col.multiValued = false;
+    if (col.type == 0) col.offsets.push_back(0);
+
+    for (int slot = 0; slot < count; slot++) {
+      const int code = ReadEkEntry(
+          static_cast<int>(c), start + slot, slot, &col, cursor.cbuf.data(), (int)cursor.cbuf.size(), failedOp, err, errMaxBytes);
+      if (code != 0) return code;
+    }
+
+    totalBytes += col.bytes.size();
+    if (totalBytes > kMaxEkCvalsBytes || col.rowOffsets.back() > (int32_t)kMaxEkArrayLen) {
+      *invalidated = "a batch exceeds the maximum size; use a smaller batchRows";
+      return 0;
+    }
+  }
+
+  cursor.nextRow = start + count;
+  cursor.batchStart = start;
+  cursor.batchCount = count;
+  cursor.ready = true;
+  return 0;
+}
+
+static std::shared_ptr<EkCursor> LookupEkCursor(Napi::Env env, const Napi::Value& value, const char* fn, uint32_t* outId) {
+  int32_t id = 0;
+  if (!ReadInt32Checked(env, value, "cursor", &id)) return nullptr;
+  const bool owned =
+      id > 0 && tspice_backend_node::GetInstanceData(env).ekCursors.count(static_cast<uint32_t>(id)) != 0;
+  auto it = owned ? g_ek_cursors.find(static_cast<uint32_t>(id)) : g_ek_cursors.end();
+  if (it == g_ek_cursors.end()) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(fn) + "(): unknown or closed cursor " + std::to_string(id)));
+    return nullptr;
+  }
+  if (outId != nullptr) *outId = it->first;
+  return it->second;
+}
+
+// `prev` is the same field of the previous batch (or undefined). Its buffer is
+// reused when it has room for `n` elements.
+template <typename T>
+static Napi::TypedArrayOf<T> CopyIntoReusable(
+    Napi::Env env,
+    const Napi::Value& prev,
+    napi_typedarray_type type,
+    const T* src,
+    size_t n) {
+  Napi::TypedArrayOf<T> out;
+  if (prev.IsTypedArray() && prev.As<Napi::TypedArray>().TypedArrayType() == type) {
+    Napi::ArrayBuffer buffer = prev.As<Napi::TypedArray>().ArrayBuffer();
+    if (buffer.ByteLength() >= n * sizeof(T)) {
+      out = Napi::TypedArrayOf<T>::New(env, n, buffer, 0);
+    }
+  }
+  if (out.IsEmpty()) out = Napi::TypedArrayOf<T>::New(env, n);
+  if (n > 0) std::memcpy(out.Data(), src, n * sizeof(T));
+  return out;
+}
+
+static Napi::Value PrevField(const Napi::Value& prevColumns, uint32_t c, const char* key) {
+  if (!prevColumns.IsArray()) return Napi::Value();
+  Napi::Array arr = prevColumns.As<Napi::Array>();
+  if (c >= arr.Length()) return Napi::Value();
+  Napi::Value col = arr.Get(c);
+  if (!col.IsObject()) return Napi::Value();
+  return col.As<Napi::Object>().Get(key);
+}
+
+// Hands the batch held by `cursor` to JS (see `ekCursorTake`).
+static Napi::Value TakeEkCursorBatch(Napi::Env env, EkCursor& cursor, const Napi::Value& reuse) {
+  if (!cursor.ready) return env.Null();
+  cursor.ready = false;
+
+  Napi::Value prevColumns;
+  if (reuse.IsObject()) prevColumns = reuse.As<Napi::Object>().Get("columns");
+
+  Napi::Array columns = Napi::Array::New(env, cursor.columns.size());
+  for (uint32_t c = 0; c < cursor.columns.size(); c++) {
+    const EkColumnData& col = cursor.columns[c];
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("nulls", CopyIntoReusable<uint8_t>(env, PrevField(prevColumns, c, "nulls"), napi_uint8_array, col.nulls.data(), col.nulls.size()));
+    if (col.type == 0) {
+      obj.Set(
+          "offsets",
+          CopyIntoReusable<int32_t>(env, PrevField(prevColumns, c, "offsets"), napi_int32_array, col.offsets.data(), col.offsets.size()));
+      obj.Set(
+          "bytes",
+          CopyIntoReusable<uint8_t>(
+              env,
+              PrevField(prevColumns, c, "bytes"),
+              napi_uint8_array,
+              reinterpret_cast<const uint8_t*>(col.bytes.data()),
+              col.bytes.size()));
+    } else if (col.type == 2) {
+      obj.Set("values", CopyIntoReusable<int32_t>(env, PrevField(prevColumns, c, "values"), napi_int32_array, col.ints.data(), col.ints.size()));
+    } else {
+      obj.Set(
+          "values",
+          CopyIntoReusable<double>(env, PrevField(prevColumns, c, "values"), napi_float64_array, col.doubles.data(), col.doubles.size()));
+    }
+    if (col.multiValued) {
+      obj.Set(
+          "rowOffsets",
+          CopyIntoReusable<int32_t>(
+              env, PrevField(prevColumns, c, "rowOffsets"), napi_int32_array, col.rowOffsets.data(), col.rowOffsets.size()));
+    }
+    columns.Set(c, obj);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("rowStart", Napi::Number::New(env, (double)cursor.batchStart));
+  result.Set("rows", Napi::Number::New(env, (double)cursor.batchCount));
+  result.Set("columns", columns);
+  return result;
+}
+
+static void ThrowEkCursorFailure(
+    Napi::Env env,
+    const char* fn,
+    const EkCursor& cursor,
+    const char* failedOp,
+    const std::string& invalidated,
+    const char* err) {
+  if (!invalidated.empty()) {
+    ThrowSpiceError(Napi::Error::New(env, std::string(fn) + "(): " + invalidated));
+    return;
+  }
+  ThrowSpiceError(
+      env,
+      std::string("CSPICE failed while calling ") + fn + "() (" + failedOp + ")",
+      err,
+      failedOp,
+      [&](Napi::Object& obj) { obj.Set("query", Napi::String::New(env, cursor.query)); });
+}
+
+static Napi::Object EkCursorOpen(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekCursorOpen(query: string, batchRows: number) expects (string, number)"));
+    return Napi::Object::New(env);
+  }
+
+  const std::string query = info[0].As<Napi::String>().Utf8Value();
+  if (!ValidateNonEmptyString(env, "ekCursorOpen", "query", query)) {
+    return Napi::Object::New(env);
+  }
+  int32_t batchRows = 0;
+  if (!ReadInt32Checked(env, info[1], "batchRows", &batchRows)) return Napi::Object::New(env);
+  if (batchRows < 1 || batchRows > kMaxEkCursorBatchRows) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env, "ekCursorOpen(): batchRows must be in [1, " + std::to_string(kMaxEkCursorBatchRows) + "]"));
+    return Napi::Object::New(env);
+  }
+
+  auto cursor = std::make_shared<EkCursor>();
+  cursor->query = query;
+  cursor->batchRows = batchRows;
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  char errmsg[tspice_backend_node::kOutMaxBytes];
+
+  const auto throwCspice = [&](const char* op) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling ekCursorOpen(query) (") + op + ")",
+        err,
+        op,
+        [&](Napi::Object& obj) { obj.Set("query", Napi::String::New(env, query)); });
+  };
+  const auto makeQueryError = [&]() {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("ok", Napi::Boolean::New(env, false));
+    result.Set("errmsg", Napi::String::New(env, TrimAsciiWhitespace(errmsg)));
+    return result;
+  };
+
+  int qerr = 0;
+  if (SelectEkColumns(query, &cursor->columns, &qerr, errmsg, (int)sizeof(errmsg), err, (int)sizeof(err)) != 0) {
+    throwCspice("ekpsel");
+    return Napi::Object::New(env);
+  }
+  if (qerr != 0) {
+    return makeQueryError();
+  }
+
+  const int findCode =
+      tspice_ekfind(query.c_str(), (int)sizeof(errmsg), &cursor->nmrows, &qerr, errmsg, err, (int)sizeof(err));
+  cursor->findEpoch = ++g_ek_find_epoch;
+  if (findCode != 0) {
+    throwCspice("ekfind");
+    return Napi::Object::New(env);
+  }
+  if (qerr != 0) {
+    return makeQueryError();
+  }
+  cursor->kernels = PoolGeneration(kPoolChangeKernels);
+
+  Napi::Array columns = Napi::Array::New(env, cursor->columns.size());
+  for (uint32_t c = 0; c < cursor->columns.size(); c++) {
+    const EkColumnData& col = cursor->columns[c];
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("table", Napi::String::New(env, col.table));
+    obj.Set("name", Napi::String::New(env, col.name));
+    obj.Set("type", Napi::String::New(env, EkTypeName(col.type)));
+    columns.Set(c, obj);
+  }
+
+  const uint32_t id = g_next_ek_cursor_id++;
+  const int nmrows = cursor->nmrows;
+  g_ek_cursors.emplace(id, std::move(cursor));
+  tspice_backend_node::GetInstanceData(env).ekCursors.insert(id);
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("ok", Napi::Boolean::New(env, true));
+  result.Set("cursor", Napi::Number::New(env, (double)id));
+  result.Set("nmrows", Napi::Number::New(env, (double)nmrows));
+  result.Set("columns", columns);
+  return result;
+}
+
+static Napi::Value EkCursorNext(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekCursorNext(cursor: number, reuse: EkCursorBatch | undefined) expects 2 arguments"));
+    return env.Null();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  std::shared_ptr<EkCursor> cursor = LookupEkCursor(env, info[0], "ekCursorNext", nullptr);
+  if (!cursor) return env.Null();
+  if (cursor->reading.load()) {
+    ThrowSpiceError(Napi::Error::New(env, "ekCursorNext(): an ekCursorReadAsync() is still in flight"));
+    return env.Null();
+  }
+
+  if (!cursor->ready) {
+    if (cursor->nextRow >= cursor->nmrows) return env.Null();
+
+    char err[tspice_backend_node::kErrMaxBytes];
+    const char* failedOp = "ekfind";
+    std::string invalidated;
+    if (ReadEkCursorBatch(lock, *cursor, &failedOp, &invalidated, err, (int)sizeof(err)) != 0 ||
+        !invalidated.empty()) {
+      ThrowEkCursorFailure(env, "ekCursorNext", *cursor, failedOp, invalidated, err);
+      return env.Null();
+    }
+  }
+  return TakeEkCursorBatch(env, *cursor, info[1]);
+}
+
+// Reads the next batch off the JS thread (see `DispatchCspiceTask`); the
+// promise resolves with its row count (0 once exhausted) and `ekCursorTake`
+// then hands the rows to JS.
+//
+// SPICE error fields are captured before the mutex is released, since a later
+// call would overwrite the shim's out-of-band error state before `OnComplete()`.
+class EkCursorReadTask : public CspiceTask {
+ public:
+  EkCursorReadTask(Napi::Promise::Deferred deferred, std::shared_ptr<EkCursor> cursor)
+      : deferred_(deferred), cursor_(std::move(cursor)) {
+    err_[0] = '\0';
+  }
+
+  void Execute(const CspiceLock& lock) override {
+    if (cursor_->ready || cursor_->nextRow >= cursor_->nmrows) return;
+    if (ReadEkCursorBatch(lock, *cursor_, &failedOp_, &invalidated_, err_, (int)sizeof(err_)) != 0) {
+      failed_ = true;
+      errorFields_ = tspice_napi::CaptureLastSpiceErrorFields();
+    }
+  }
+
+  void OnComplete(Napi::Env env) override {
+    cursor_->reading.store(false);
+    if (!invalidated_.empty()) {
+      deferred_.Reject(Napi::Error::New(env, "ekCursorReadAsync(): " + invalidated_).Value());
+      return;
+    }
+    if (failed_) {
+      deferred_.Reject(tspice_napi::MakeSpiceError(
+                           env,
+                           std::string("CSPICE failed while calling ekCursorReadAsync() (") + failedOp_ + ")",
+                           err_,
+                           errorFields_,
+                           failedOp_)
+                           .Value());
+      return;
+    }
+    // `ready` and `batchCount` are only written under the mutex by this task,
+    // which has finished; nothing else reads a batch while `reading` was set.
+    deferred_.Resolve(Napi::Number::New(env, cursor_->ready ? (double)cursor_->batchCount : 0.0));
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  // Keeps the cursor alive if it is closed (or its environment torn down) meanwhile.
+  std::shared_ptr<EkCursor> cursor_;
+
+  const char* failedOp_ = "ekfind";
+  std::string invalidated_;
+  bool failed_ = false;
+  char err_[tspice_backend_node::kErrMaxBytes];
+  tspice_napi::SpiceErrorFields errorFields_;
+};
+
+static Napi::Value EkCursorReadAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekCursorReadAsync(cursor: number) expects 1 argument"));
+    return env.Undefined();
+  }
+
+  std::shared_ptr<EkCursor> cursor;
+  {
+    tspice_backend_node::CspiceLock lock;
+    cursor = LookupEkCursor(env, info[0], "ekCursorReadAsync", nullptr);
+  }
+  if (!cursor) return env.Undefined();
+  if (cursor->reading.exchange(true)) {
+    ThrowSpiceError(Napi::Error::New(env, "ekCursorReadAsync(): a read is already in flight"));
+    return env.Undefined();
+  }
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  DispatchCspiceTask(env, std::make_unique<EkCursorReadTask>(deferred, std::move(cursor)), "ekCursorReadAsync");
+  return deferred.Promise();
+}
+
+static Napi::Value EkCursorTake(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekCursorTake(cursor: number, reuse: EkCursorBatch | undefined) expects 2 arguments"));
+    return env.Null();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  std::shared_ptr<EkCursor> cursor = LookupEkCursor(env, info[0], "ekCursorTake", nullptr);
+  if (!cursor) return env.Null();
+  if (cursor->reading.load()) {
+    ThrowSpiceError(Napi::Error::New(env, "ekCursorTake(): an ekCursorReadAsync() is still in flight"));
+    return env.Null();
+  }
+  return TakeEkCursorBatch(env, *cursor, info[1]);
+}
+
+static void EkCursorClose(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ekCursorClose(cursor: number) expects 1 argument"));
+    return;
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  uint32_t id = 0;
+  if (!LookupEkCursor(env, info[0], "ekCursorClose", &id)) return;
+  g_ek_cursors.erase(id);
+  tspice_backend_node::GetInstanceData(env).ekCursors.erase(id);
+}
+
+void DropEkCursors(const CspiceLock& lock, const std::unordered_set<uint32_t>& ids) {
+  (void)lock;
+  for (uint32_t id : ids) {
+    g_ek_cursors.erase(id);
+  }
+}
+
 static Napi::Object Ekifld(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -768,7 +1520,7 @@ static Napi::Object Ekifld(const Napi::CallbackInfo& info) {
   std::vector<int> rcptrs(static_cast<size_t>(nrows));
   int segno = 0;
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekifld(
       handle,
@@ -845,7 +1597,7 @@ static void Ekacli(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekacli(
       handle,
@@ -915,7 +1667,7 @@ static void Ekacld(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekacld(
       handle,
@@ -1032,7 +1784,7 @@ static void Ekaclc(const Napi::CallbackInfo& info) {
     cvalsBuf[i * vallen + std::min(s.size(), vallen - 1)] = '\0';
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekaclc(
       handle,
@@ -1080,7 +1832,7 @@ static void Ekffld(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ekffld(handle, segno, rcptrs.data(), err, (int)sizeof(err));
   if (code != 0) {
@@ -1088,6 +1840,332 @@ static void Ekffld(const Napi::CallbackInfo& info) {
   }
 }
 
+// --- One-shot segment writer ---------------------------------------------
+
+// One column of an `ekWriteSegment` call, resolved from its JS typed arrays.
+//
+// Numeric values alias the caller's typed-array backing store; only CHR
+// columns are repacked, into the fixed-width layout `ekaclc_c` requires.
+struct EkColumnWrite {
+  std::string name;
+  int kind = 0;  // 0=CHR, 1=DP, 2=INT
+  const int32_t* ints = nullptr;
+  const double* doubles = nullptr;
+  size_t nvals = 0;
+  int vallen = 0;
+  std::vector<char> cvals;
+  std::vector<int> entszs;
+  std::vector<int> nlflgs;
+};
+
+static_assert(sizeof(int) == sizeof(int32_t), "ekWriteSegment passes Int32Array data as int*");
+
+static bool ReadTypedArrayProp(
+    Napi::Env env,
+    const Napi::Object& obj,
+    const char* key,
+    napi_typedarray_type type,
+    const char* typeName,
+    const std::string& label,
+    Napi::TypedArray* out) {
+  const Napi::Value v = obj.Get(key);
+  if (!v.IsTypedArray() || v.As<Napi::TypedArray>().TypedArrayType() != type) {
+    ThrowSpiceError(Napi::TypeError::New(env, label + "." + key + " must be a " + typeName));
+    return false;
+  }
+  *out = v.As<Napi::TypedArray>();
+  return true;
+}
+
+static bool ReadEkColumnWrite(
+    Napi::Env env,
+    const Napi::Value& value,
+    const std::string& label,
+    bool first,
+    EkColumnWrite* col,
+    size_t* inOutNrows) {
+  if (!value.IsObject()) {
+    ThrowSpiceError(Napi::TypeError::New(env, label + " must be an object"));
+    return false;
+  }
+  const Napi::Object obj = value.As<Napi::Object>();
+
+  Napi::TypedArray offsetsArr;
+  Napi::TypedArray bytesArr;
+  if (obj.Has("bytes")) {
+    if (!ReadTypedArrayProp(env, obj, "offsets", napi_int32_array, "Int32Array", label, &offsetsArr)) return false;
+    if (!ReadTypedArrayProp(env, obj, "bytes", napi_uint8_array, "Uint8Array", label, &bytesArr)) return false;
+    col->kind = 0;
+    if (offsetsArr.ElementLength() == 0) {
+      ThrowSpiceError(Napi::RangeError::New(env, label + ".offsets must have length >= 1"));
+      return false;
+    }
+    col->nvals = offsetsArr.ElementLength() - 1;
+  } else {
+    const Napi::Value v = obj.Get("values");
+    if (!v.IsTypedArray()) {
+      ThrowSpiceError(Napi::TypeError::New(env, label + ".values must be an Int32Array or Float64Array"));
+      return false;
+    }
+    const Napi::TypedArray values = v.As<Napi::TypedArray>();
+    if (values.TypedArrayType() == napi_int32_array) {
+      col->kind = 2;
+      col->ints = values.As<Napi::Int32Array>().Data();
+    } else if (values.TypedArrayType() == napi_float64_array) {
+      col->kind = 1;
+      col->doubles = values.As<Napi::Float64Array>().Data();
+    } else {
+      ThrowSpiceError(Napi::TypeError::New(env, label + ".values must be an Int32Array or Float64Array"));
+      return false;
+    }
+    col->nvals = values.ElementLength();
+  }
+
+  if (col->nvals > kMaxEkArrayLen) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        label + " element count must be <= " + std::to_string(kMaxEkArrayLen)));
+    return false;
+  }
+
+  // Row layout: one element per row unless `rowOffsets` says otherwise.
+  size_t nrows = col->nvals;
+  if (!obj.Get("rowOffsets").IsUndefined()) {
+    Napi::TypedArray rowOffsetsArr;
+    if (!ReadTypedArrayProp(env, obj, "rowOffsets", napi_int32_array, "Int32Array", label, &rowOffsetsArr)) {
+      return false;
+    }
+    const int32_t* rowOffsets = rowOffsetsArr.As<Napi::Int32Array>().Data();
+    const size_t len = rowOffsetsArr.ElementLength();
+    if (len < 2 || rowOffsets[0] != 0 || (size_t)rowOffsets[len - 1] != col->nvals) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          label + ".rowOffsets must start at 0 and end at the element count"));
+      return false;
+    }
+    nrows = len - 1;
+    col->entszs.resize(nrows);
+    for (size_t r = 0; r < nrows; r++) {
+      if (rowOffsets[r + 1] < rowOffsets[r]) {
+        ThrowSpiceError(Napi::RangeError::New(env, label + ".rowOffsets must be non-decreasing"));
+        return false;
+      }
+      col->entszs[r] = rowOffsets[r + 1] - rowOffsets[r];
+    }
+  } else {
+    col->entszs.assign(nrows, 1);
+  }
+
+  if (first) {
+    *inOutNrows = nrows;
+  } else if (nrows != *inOutNrows) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        label + " has " + std::to_string(nrows) + " rows; expected " + std::to_string(*inOutNrows)));
+    return false;
+  }
+
+  col->nlflgs.assign(nrows, 0);
+  if (!obj.Get("nulls").IsUndefined()) {
+    Napi::TypedArray nullsArr;
+    if (!ReadTypedArrayProp(env, obj, "nulls", napi_uint8_array, "Uint8Array", label, &nullsArr)) return false;
+    if (nullsArr.ElementLength() < (nrows + 7) / 8) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          label + ".nulls must have at least " + std::to_string((nrows + 7) / 8) + " bytes"));
+      return false;
+    }
+    const uint8_t* nulls = nullsArr.As<Napi::Uint8Array>().Data();
+    for (size_t r = 0; r < nrows; r++) {
+      col->nlflgs[r] = (nulls[r >> 3] >> (r & 7)) & 1;
+    }
+  }
+
+  int required = 0;
+  std::string sumErr;
+  if (!SumEntszsChecked(col->entszs, col->nlflgs, &required, &sumErr)) {
+    ThrowSpiceError(Napi::RangeError::New(env, label + " invalid rowOffsets/nulls: " + sumErr));
+    return false;
+  }
+
+  if (col->kind == 1) {
+    for (size_t i = 0; i < col->nvals; i++) {
+      if (!std::isfinite(col->doubles[i])) {
+        ThrowSpiceError(Napi::RangeError::New(env, label + ".values must be finite"));
+        return false;
+      }
+    }
+  }
+
+  if (col->kind == 0) {
+    const int32_t* offsets = offsetsArr.As<Napi::Int32Array>().Data();
+    const uint8_t* bytes = bytesArr.As<Napi::Uint8Array>().Data();
+    const size_t nbytes = bytesArr.ElementLength();
+
+    size_t vallen = 1;
+    for (size_t i = 0; i < col->nvals; i++) {
+      if (offsets[i] < 0 || offsets[i + 1] < offsets[i] || (size_t)offsets[i + 1] > nbytes) {
+        ThrowSpiceError(Napi::RangeError::New(
+            env,
+            label + ".offsets must be non-decreasing and within bytes.length"));
+        return false;
+      }
+      const size_t len = (size_t)(offsets[i + 1] - offsets[i]) + 1;
+      if (len > kMaxEkVallenBytes) {
+        ThrowSpiceError(Napi::RangeError::New(
+            env,
+            label + " value byte length exceeds cap (" + std::to_string(kMaxEkVallenBytes) + ")"));
+        return false;
+      }
+      vallen = std::max(vallen, len);
+    }
+    if (col->nvals > 0 && col->nvals > (kMaxEkCvalsBytes / vallen)) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          label + " packed string buffer too large (" + std::to_string((uint64_t)col->nvals * vallen) + " bytes)"));
+      return false;
+    }
+
+    col->vallen = (int)vallen;
+    col->cvals.assign(std::max<size_t>(col->nvals, 1) * vallen, '\0');
+    for (size_t i = 0; i < col->nvals; i++) {
+      memcpy(&col->cvals[i * vallen], bytes + offsets[i], (size_t)(offsets[i + 1] - offsets[i]));
+    }
+  }
+
+  return true;
+}
+
+static Napi::Number EkWriteSegment(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 5 || !info[1].IsString() || !info[4].IsArray()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "ekWriteSegment(handle: number, tabnam: string, cnames: string[], decls: string[], columns: object[]) expects (number, string, string[], string[], object[])"));
+    return Napi::Number::New(env, 0);
+  }
+
+  int32_t handle = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &handle)) return Napi::Number::New(env, 0);
+
+  const std::string tabnam = info[1].As<Napi::String>().Utf8Value();
+  if (!ValidateNonEmptyString(env, "ekWriteSegment", "tabnam", tabnam)) {
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_napi::JsStringArrayArg cnames;
+  tspice_napi::JsStringArrayArg decls;
+  if (!ReadStringArray(env, info[2], &cnames, "cnames")) return Napi::Number::New(env, 0);
+  if (!ReadStringArray(env, info[3], &decls, "decls")) return Napi::Number::New(env, 0);
+
+  const Napi::Array columnsArr = info[4].As<Napi::Array>();
+  const size_t ncols = cnames.values.size();
+  if (ncols == 0) {
+    ThrowSpiceError(Napi::RangeError::New(env, "ekWriteSegment() expects at least one column"));
+    return Napi::Number::New(env, 0);
+  }
+  if (decls.values.size() != ncols || columnsArr.Length() != ncols) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        "ekWriteSegment() expects cnames, decls and columns to have the same length"));
+    return Napi::Number::New(env, 0);
+  }
+
+  size_t cnamln = 2;
+  size_t declen = 2;
+  for (size_t i = 0; i < ncols; i++) {
+    if (!ValidateNonEmptyString(env, "ekWriteSegment", "cnames[i]", cnames.values[i])) {
+      return Napi::Number::New(env, 0);
+    }
+    if (!ValidateNonEmptyString(env, "ekWriteSegment", "decls[i]", decls.values[i])) {
+      return Napi::Number::New(env, 0);
+    }
+    cnamln = std::max(cnamln, cnames.values[i].size() + 1);
+    declen = std::max(declen, decls.values[i].size() + 1);
+  }
+
+  std::vector<EkColumnWrite> cols(ncols);
+  size_t nrows = 0;
+  for (size_t i = 0; i < ncols; i++) {
+    cols[i].name = cnames.values[i];
+    const std::string label = "ekWriteSegment() columns[" + std::to_string(i) + "] (" + cnames.values[i] + ")";
+    if (!ReadEkColumnWrite(env, columnsArr.Get(static_cast<uint32_t>(i)), label, i == 0, &cols[i], &nrows)) {
+      return Napi::Number::New(env, 0);
+    }
+  }
+  if (nrows == 0) {
+    ThrowSpiceError(Napi::RangeError::New(env, "ekWriteSegment() expects at least one row"));
+    return Napi::Number::New(env, 0);
+  }
+
+  std::vector<char> cnamesBuf(ncols * cnamln, '\0');
+  std::vector<char> declsBuf(ncols * declen, '\0');
+  for (size_t i = 0; i < ncols; i++) {
+    memcpy(&cnamesBuf[i * cnamln], cnames.values[i].data(), cnames.values[i].size());
+    memcpy(&declsBuf[i * declen], decls.values[i].data(), decls.values[i].size());
+  }
+
+  std::vector<int> rcptrs(nrows);
+  int segno = 0;
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_ekifld(
+          handle,
+          tabnam.c_str(),
+          (int)ncols,
+          (int)nrows,
+          (int)cnamln,
+          cnamesBuf.data(),
+          (int)declen,
+          declsBuf.data(),
+          &segno,
+          rcptrs.data(),
+          err,
+          (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling ekWriteSegment() (ekifld)", err, "ekifld");
+    return Napi::Number::New(env, 0);
+  }
+
+  for (EkColumnWrite& col : cols) {
+    int code = 0;
+    const char* op = nullptr;
+    if (col.kind == 2) {
+      op = "ekacli";
+      code = tspice_ekacli(
+          handle, segno, col.name.c_str(), (int)nrows, col.ints, (int)col.nvals,
+          col.entszs.data(), col.nlflgs.data(), rcptrs.data(), err, (int)sizeof(err));
+    } else if (col.kind == 1) {
+      op = "ekacld";
+      code = tspice_ekacld(
+          handle, segno, col.name.c_str(), (int)nrows, col.doubles, (int)col.nvals,
+          col.entszs.data(), col.nlflgs.data(), rcptrs.data(), err, (int)sizeof(err));
+    } else {
+      op = "ekaclc";
+      code = tspice_ekaclc(
+          handle, segno, col.name.c_str(), (int)nrows, (int)col.nvals, col.vallen, (int)col.cvals.size(),
+          col.cvals.data(), col.entszs.data(), col.nlflgs.data(), rcptrs.data(), err, (int)sizeof(err));
+    }
+    if (code != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling ekWriteSegment() (") + op + ")",
+          err,
+          op,
+          [&](Napi::Object& obj) { obj.Set("column", Napi::String::New(env, col.name)); });
+      return Napi::Number::New(env, 0);
+    }
+  }
+
+  if (tspice_ekffld(handle, segno, rcptrs.data(), err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling ekWriteSegment() (ekffld)", err, "ekffld");
+    return Napi::Number::New(env, 0);
+  }
+
+  return Napi::Number::New(env, (double)segno);
+}
+
 void RegisterEk(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "ekopr", Napi::Function::New(env, Ekopr), __func__)) return;
   if (!SetExportChecked(env, exports, "ekopw", Napi::Function::New(env, Ekopw), __func__)) return;
@@ -1101,12 +2179,19 @@ void RegisterEk(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "ekgc", Napi::Function::New(env, Ekgc), __func__)) return;
   if (!SetExportChecked(env, exports, "ekgd", Napi::Function::New(env, Ekgd), __func__)) return;
   if (!SetExportChecked(env, exports, "ekgi", Napi::Function::New(env, Ekgi), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekQueryColumnar", Napi::Function::New(env, EkQueryColumnar), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekCursorOpen", Napi::Function::New(env, EkCursorOpen), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekCursorNext", Napi::Function::New(env, EkCursorNext), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekCursorReadAsync", Napi::Function::New(env, EkCursorReadAsync), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekCursorTake", Napi::Function::New(env, EkCursorTake), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekCursorClose", Napi::Function::New(env, EkCursorClose), __func__)) return;
 
   if (!SetExportChecked(env, exports, "ekifld", Napi::Function::New(env, Ekifld), __func__)) return;
   if (!SetExportChecked(env, exports, "ekacli", Napi::Function::New(env, Ekacli), __func__)) return;
   if (!SetExportChecked(env, exports, "ekacld", Napi::Function::New(env, Ekacld), __func__)) return;
   if (!SetExportChecked(env, exports, "ekaclc", Napi::Function::New(env, Ekaclc), __func__)) return;
   if (!SetExportChecked(env, exports, "ekffld", Napi::Function::New(env, Ekffld), __func__)) return;
+  if (!SetExportChecked(env, exports, "ekWriteSegment", Napi::Function::New(env, EkWriteSegment), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
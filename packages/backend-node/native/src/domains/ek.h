@@ -1,9 +1,17 @@
 #pragma once
 
+#include <cstdint>
+#include <unordered_set>
+
 #include <napi.h>
 
+#include "../addon_common.h"
+
 namespace tspice_backend_node {
 
 void RegisterEk(Napi::Env env, Napi::Object exports);
 
+// Closes the given `ekCursorOpen` cursors (environment teardown; see instance_data.h).
+void DropEkCursors(const CspiceLock& lock, const std::unordered_set<uint32_t>& ids);
+
 }  // namespace tspice_backend_node
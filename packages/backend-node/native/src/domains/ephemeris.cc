@@ -1,13 +1,30 @@
 #include "ephemeris.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "../addon_common.h"
+#include "../cancellation.h"
 #include "../cell_handles.h"
+#include "../coverage_index.h"
+#include "../ephemeris_table.h"
+#include "../id_cache.h"
+#include "../instance_data.h"
+#include "../lazy_kernels.h"
 #include "../napi_helpers.h"
+#include "../native_memory.h"
+#include "../pool_generation.h"
+#include "../query_cache.h"
+#include "../spk_evaluator.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::FixedWidthToJsString;
@@ -40,6 +57,34 @@ static bool ReadInt32Checked(Napi::Env env, const Napi::Value& value, const char
   return true;
 }
 
+// Opens the lazily registered SPKs a query needs (see lazy_kernels.h). Returns false after
+// throwing. Requires `g_cspice_mutex`.
+static bool EnsureLazySpkResult(Napi::Env env, const char* name, int code, const char* err) {
+  if (code == 0) return true;
+  ThrowSpiceError(env, std::string("CSPICE failed while opening lazily registered SPKs for ") + name, err);
+  return false;
+}
+
+static bool EnsureLazySpk(
+    Napi::Env env,
+    const char* name,
+    const std::string& target,
+    const std::string& observer,
+    double etMin,
+    double etMax) {
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code =
+      tspice_backend_node::EnsureLazySpkForNames(target, observer, etMin, etMax, err, (int)sizeof(err));
+  return EnsureLazySpkResult(env, name, code, err);
+}
+
+static bool EnsureLazySpk(Napi::Env env, const char* name, int target, int observer, double etMin, double etMax) {
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code =
+      tspice_backend_node::EnsureLazySpkForBodies(target, observer, etMin, etMax, err, (int)sizeof(err));
+  return EnsureLazySpkResult(env, name, code, err);
+}
+
 static Napi::Object Ckgp(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -56,7 +101,7 @@ static Napi::Object Ckgp(const Napi::CallbackInfo& info) {
   const double tol = info[2].As<Napi::Number>().DoubleValue();
   const std::string ref = info[3].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double cmat[9] = {0};
   double clkout = 0.0;
@@ -95,7 +140,7 @@ static Napi::Object Ckgpav(const Napi::CallbackInfo& info) {
   const double tol = info[2].As<Napi::Number>().DoubleValue();
   const std::string ref = info[3].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double cmat[9] = {0};
   double av[3] = {0};
@@ -129,6 +174,118 @@ static Napi::Object Ckgpav(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// Shared body for `ckgpBatch` / `ckgpavBatch`: one instrument and frame, many SCLK ticks (an image
+// sequence), with the frame name copied and the lock taken once. Pointing comes back packed:
+// `cmats` (9 per tick, row-major), `avs` (3 per tick, `ckgpavBatch` only), `clkouts` and a `found`
+// bitmap (bit `i % 8` of byte `i / 8`); rows for ticks without pointing are zero.
+static Napi::Object CkBatch(const Napi::CallbackInfo& info, const char* name, bool withAv) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 4 || !info[0].IsNumber() || !info[2].IsNumber() || !info[3].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(inst: number, sclkdp: Float64Array, tol: number, ref: string) expects (number, Float64Array, number, string)"));
+    return Napi::Object::New(env);
+  }
+
+  int32_t inst = 0;
+  if (!ReadInt32Checked(env, info[0], "inst", &inst)) {
+    return Napi::Object::New(env);
+  }
+
+  const double* sclkdps = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &sclkdps, &n, "sclkdp")) {
+    return Napi::Object::New(env);
+  }
+  if (n > static_cast<size_t>(std::numeric_limits<int>::max()) / 9) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): sclkdp is too long"));
+    return Napi::Object::New(env);
+  }
+
+  const double tol = info[2].As<Napi::Number>().DoubleValue();
+  const std::string ref = info[3].As<Napi::String>().Utf8Value();
+
+  Napi::Float64Array cmats = Napi::Float64Array::New(env, n * 9);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  Napi::Float64Array avs = Napi::Float64Array::New(env, withAv ? n * 3 : 0);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  Napi::Float64Array clkouts = Napi::Float64Array::New(env, n);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  Napi::Uint8Array found = Napi::Uint8Array::New(env, (n + 7) / 8);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (n > 0) {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    const int code = withAv
+        ? tspice_ckgpav_batch(
+              inst,
+              sclkdps,
+              (int)n,
+              tol,
+              ref.c_str(),
+              cmats.Data(),
+              avs.Data(),
+              clkouts.Data(),
+              found.Data(),
+              &failedIndex,
+              err,
+              (int)sizeof(err))
+        : tspice_ckgp_batch(
+              inst,
+              sclkdps,
+              (int)n,
+              tol,
+              ref.c_str(),
+              cmats.Data(),
+              clkouts.Data(),
+              found.Data(),
+              &failedIndex,
+              err,
+              (int)sizeof(err));
+    if (code != 0) {
+      std::string context = std::string("CSPICE failed while calling ") + name;
+      if (failedIndex >= 0) {
+        context += "(sclkdp[" + std::to_string(failedIndex) + "])";
+      }
+      ThrowSpiceError(env, context, err, name, [&](Napi::Object& obj) {
+        if (failedIndex >= 0) {
+          obj.Set("index", Napi::Number::New(env, failedIndex));
+        }
+      });
+      return Napi::Object::New(env);
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("cmats", cmats);
+  if (withAv) {
+    result.Set("avs", avs);
+  }
+  result.Set("clkouts", clkouts);
+  result.Set("found", found);
+  return result;
+}
+
+static Napi::Object CkgpBatch(const Napi::CallbackInfo& info) {
+  return CkBatch(info, "ckgpBatch", false);
+}
+
+static Napi::Object CkgpavBatch(const Napi::CallbackInfo& info) {
+  return CkBatch(info, "ckgpavBatch", true);
+}
+
+// `out` is [state(6), lt].
+static Napi::Object MakeSpkezrResult(Napi::Env env, const double* out) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("state", MakeNumberArray(env, out, 6));
+  result.Set("lt", Napi::Number::New(env, out[6]));
+  return result;
+}
+
 static Napi::Object Spkezr(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -146,18 +303,32 @@ static Napi::Object Spkezr(const Napi::CallbackInfo& info) {
   const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
   const std::string observer = info[4].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  // [state(6), lt]
+  double out[7] = {0};
+  const bool memo = tspice_backend_node::QueryCacheEnabled();
+  tspice_backend_node::QueryKey key(tspice_backend_node::QueryKind::kSpkezr);
+  if (memo) {
+    key.Add(target).Add(et).Add(ref).Add(abcorr).Add(observer);
+    std::vector<double> cached;
+    if (tspice_backend_node::QueryCacheLookup(key, &cached)) {
+      std::copy(cached.begin(), cached.end(), out);
+      return MakeSpkezrResult(env, out);
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkezr", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
-  double state[6] = {0};
-  double lt = 0.0;
   const int code = tspice_spkezr(
       target.c_str(),
       et,
       ref.c_str(),
       abcorr.c_str(),
       observer.c_str(),
-      state,
-      &lt,
+      out,
+      &out[6],
       err,
       (int)sizeof(err));
   if (code != 0) {
@@ -165,10 +336,8 @@ static Napi::Object Spkezr(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  Napi::Object result = Napi::Object::New(env);
-  result.Set("state", MakeNumberArray(env, state, 6));
-  result.Set("lt", Napi::Number::New(env, lt));
-  return result;
+  if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), out, 7);
+  return MakeSpkezrResult(env, out);
 }
 
 static Napi::Object Spkpos(const Napi::CallbackInfo& info) {
@@ -188,7 +357,10 @@ static Napi::Object Spkpos(const Napi::CallbackInfo& info) {
   const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
   const std::string observer = info[4].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkpos", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
   double pos[3] = {0};
   double lt = 0.0;
@@ -213,6 +385,289 @@ static Napi::Object Spkpos(const Napi::CallbackInfo& info) {
   return result;
 }
 
+using SpkBatchFn = int (*)(
+    const char*,
+    const double*,
+    int,
+    const char*,
+    const char*,
+    const char*,
+    double*,
+    double*,
+    int*,
+    char*,
+    int);
+
+// Shared implementation for `spkezrBatch` / `spkposBatch`.
+//
+// Strings are copied once per batch, the CSPICE mutex is taken once, and the
+// shim writes directly into freshly-allocated Float64Array backing stores. An
+// optional trailing `{ token?, timeoutMs? }` stops the batch between epochs
+// (see `cancellation.h`).
+static Napi::Object SpkBatch(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* valuesKey,
+    size_t stride,
+    SpkBatchFn fn) {
+  Napi::Env env = info.Env();
+
+  if ((info.Length() != 5 && info.Length() != 6) || !info[0].IsString() || !info[2].IsString() ||
+      !info[3].IsString() || !info[4].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(target: string, ets: Float64Array, ref: string, abcorr: string, observer: string, options?) expects (string, Float64Array, string, string, string, object?)"));
+    return Napi::Object::New(env);
+  }
+
+  tspice_backend_node::CallCancellation cancellation;
+  if (info.Length() == 6 && !tspice_backend_node::ReadCallCancellation(env, info[5], name, &cancellation)) {
+    return Napi::Object::New(env);
+  }
+
+  const double* ets = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &ets, &n, "ets")) {
+    return Napi::Object::New(env);
+  }
+  if (n > static_cast<size_t>(std::numeric_limits<int>::max()) / stride) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): ets is too long"));
+    return Napi::Object::New(env);
+  }
+
+  const std::string target = info[0].As<Napi::String>().Utf8Value();
+  const std::string ref = info[2].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
+  const std::string observer = info[4].As<Napi::String>().Utf8Value();
+
+  Napi::Float64Array values = Napi::Float64Array::New(env, n * stride);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  Napi::Float64Array lts = Napi::Float64Array::New(env, n);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (n > 0) {
+    const auto [etMin, etMax] = std::minmax_element(ets, ets + n);
+    tspice_backend_node::CspiceLock lock;
+    if (!EnsureLazySpk(env, name, target, observer, *etMin, *etMax)) {
+      return Napi::Object::New(env);
+    }
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    tspice_backend_node::InterruptScope interrupt(lock, cancellation);
+    const int code = fn(
+        target.c_str(),
+        ets,
+        (int)n,
+        ref.c_str(),
+        abcorr.c_str(),
+        observer.c_str(),
+        values.Data(),
+        lts.Data(),
+        &failedIndex,
+        err,
+        (int)sizeof(err));
+    if (code == TSPICE_INTERRUPTED) {
+      ThrowSpiceError(tspice_backend_node::MakeCancellationError(env, name, interrupt.reason()));
+      return Napi::Object::New(env);
+    }
+    if (code != 0) {
+      std::string context = std::string("CSPICE failed while calling ") + name;
+      if (failedIndex >= 0) {
+        context += "(ets[" + std::to_string(failedIndex) + "])";
+      }
+      ThrowSpiceError(env, context, err, name, [&](Napi::Object& obj) {
+        if (failedIndex >= 0) {
+          obj.Set("index", Napi::Number::New(env, failedIndex));
+        }
+      });
+      return Napi::Object::New(env);
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set(valuesKey, values);
+  result.Set("lts", lts);
+  return result;
+}
+
+static Napi::Object SpkezrBatch(const Napi::CallbackInfo& info) {
+  return SpkBatch(info, "spkezrBatch", "states", 6, tspice_spkezr_batch);
+}
+
+static Napi::Object SpkposBatch(const Napi::CallbackInfo& info) {
+  return SpkBatch(info, "spkposBatch", "positions", 3, tspice_spkpos_batch);
+}
+
+using SpkIntoFn = int (*)(
+    const char*, double, const char*, const char*, const char*, double*, double*, char*, int);
+
+// Shared body for `spkezrInto` / `spkposInto`: the state/position is written into a caller-owned
+// `Float64Array` and only the light time is returned, so a hot loop allocates nothing per call.
+//
+// With `reportStatus` (`spkezrIntoStatus` / `spkposIntoStatus`) the light time goes into one extra
+// trailing element of `out` and a CSPICE failure is returned as its `TSPICE_ERROR_*` class instead
+// of thrown: the shim only captures the message parts (read later via `lastSpiceError()`), and no
+// message string or JS error is built.
+static Napi::Value SpkInto(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    size_t outLength,
+    SpkIntoFn fn,
+    bool reportStatus = false) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 6 || !info[0].IsString() || !info[1].IsNumber() || !info[2].IsString() ||
+      !info[3].IsString() || !info[4].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(target: string, et: number, ref: string, abcorr: string, observer: string, out: Float64Array) expects (string, number, string, string, string, Float64Array)"));
+    return env.Undefined();
+  }
+
+  const std::string target = info[0].As<Napi::String>().Utf8Value();
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+  const std::string ref = info[2].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
+  const std::string observer = info[4].As<Napi::String>().Utf8Value();
+
+  double* out = nullptr;
+  if (!tspice_napi::ReadFloat64ArrayOut(
+          env, info[5], reportStatus ? outLength + 1 : outLength, &out, "out")) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, name, target, observer, et, et)) {
+    return env.Undefined();
+  }
+
+  if (reportStatus) {
+    const int code = fn(
+        target.c_str(), et, ref.c_str(), abcorr.c_str(), observer.c_str(), out, out + outLength, nullptr, 0);
+    return Napi::Number::New(env, code == 0 ? TSPICE_ERROR_NONE : tspice_last_error_class());
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  double lt = 0.0;
+  const int code = fn(
+      target.c_str(),
+      et,
+      ref.c_str(),
+      abcorr.c_str(),
+      observer.c_str(),
+      out,
+      &lt,
+      err,
+      (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+    return env.Undefined();
+  }
+
+  return Napi::Number::New(env, lt);
+}
+
+static Napi::Value SpkezrInto(const Napi::CallbackInfo& info) {
+  return SpkInto(info, "spkezrInto", 6, tspice_spkezr);
+}
+
+static Napi::Value SpkposInto(const Napi::CallbackInfo& info) {
+  return SpkInto(info, "spkposInto", 3, tspice_spkpos);
+}
+
+static Napi::Value SpkezrIntoStatus(const Napi::CallbackInfo& info) {
+  return SpkInto(info, "spkezrIntoStatus", 6, tspice_spkezr, true);
+}
+
+static Napi::Value SpkposIntoStatus(const Napi::CallbackInfo& info) {
+  return SpkInto(info, "spkposIntoStatus", 3, tspice_spkpos, true);
+}
+
+// Light-time corrections evaluate the target up to a light time away from `et`; `trySpkezr` widens
+// its coverage pre-check by the same day the lazy kernel manager uses.
+constexpr double kTryLightTimeMarginSeconds = 86400.0;
+
+static bool IsAbcorrNone(const std::string& abcorr) {
+  std::string upper;
+  for (const unsigned char c : abcorr) {
+    if (!tspice_napi::IsAsciiWhitespace(c)) upper.push_back((char)std::toupper(c));
+  }
+  return upper == "NONE";
+}
+
+// `trySpkezr`: `spkezr` for speculative queries. A coverage gap is `{ found: false }` instead of a
+// thrown error: the coverage index rules out most misses without calling CSPICE at all, and the
+// rest take the shim's message-free failure path (no signalling round trip through
+// `tspice_get_spice_error_message_and_reset` formatting). Every other failure still throws.
+static Napi::Object TrySpkezr(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 5 || !info[0].IsString() || !info[1].IsNumber() || !info[2].IsString() ||
+      !info[3].IsString() || !info[4].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "trySpkezr(target: string, et: number, ref: string, abcorr: string, observer: string) expects (string, number, string, string, string)"));
+    return Napi::Object::New(env);
+  }
+
+  const std::string target = info[0].As<Napi::String>().Utf8Value();
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+  const std::string ref = info[2].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
+  const std::string observer = info[4].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "trySpkezr", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  int targetId = 0;
+  int observerId = 0;
+  bool targetFound = false;
+  bool observerFound = false;
+  if (tspice_backend_node::InternBodyCode(target, &targetId, &targetFound, err, (int)sizeof(err)) != 0 ||
+      tspice_backend_node::InternBodyCode(observer, &observerId, &observerFound, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling trySpkezr", err);
+    return Napi::Object::New(env);
+  }
+
+  // Unknown names skip the pre-check; `spkezr_c` reports them below.
+  if (targetFound && observerFound) {
+    const double margin = IsAbcorrNone(abcorr) ? 0.0 : kTryLightTimeMarginSeconds;
+    bool mayCover = true;
+    if (tspice_backend_node::LoadedSpkMayCover(
+            targetId, observerId, et - margin, et + margin, &mayCover, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling trySpkezr", err);
+      return Napi::Object::New(env);
+    }
+    if (!mayCover) {
+      return MakeNotFound(env);
+    }
+  }
+
+  double state[6] = {0};
+  double lt = 0.0;
+  const int code = tspice_spkezr(
+      target.c_str(), et, ref.c_str(), abcorr.c_str(), observer.c_str(), state, &lt, nullptr, 0);
+  if (code != 0) {
+    if (tspice_last_error_class() == TSPICE_ERROR_COVERAGE_GAP) {
+      return MakeNotFound(env);
+    }
+    tspice_format_last_error(err, (int)sizeof(err));
+    ThrowSpiceError(env, "CSPICE failed while calling trySpkezr", err);
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("found", Napi::Boolean::New(env, true));
+  result.Set("state", MakeNumberArray(env, state, 6));
+  result.Set("lt", Napi::Number::New(env, lt));
+  return result;
+}
+
 static Napi::Object Spkez(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -237,7 +692,10 @@ static Napi::Object Spkez(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkez", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
   double state[6] = {0};
   double lt = 0.0;
@@ -278,7 +736,10 @@ static Napi::Object Spkezp(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkezp", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
   double pos[3] = {0};
   double lt = 0.0;
@@ -318,7 +779,10 @@ static Napi::Object Spkgeo(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkgeo", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
   double state[6] = {0};
   double lt = 0.0;
@@ -335,6 +799,97 @@ static Napi::Object Spkgeo(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// `spkezId` / `spkgeoId`: `spkez` / `spkgeo` with the reference frame given by ID (see
+// `internFrame`), so the hot path passes no frame string.
+static Napi::Object SpkezId(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 5 || !info[1].IsNumber() || !info[3].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "spkezId(target: number, et: number, refId: number, abcorr: string, observer: number) expects (number, number, number, string, number)"));
+    return Napi::Object::New(env);
+  }
+
+  int32_t target = 0;
+  int32_t refId = 0;
+  int32_t observer = 0;
+  if (!ReadInt32Checked(env, info[0], "target", &target) || !ReadInt32Checked(env, info[2], "refId", &refId) ||
+      !ReadInt32Checked(env, info[4], "observer", &observer)) {
+    return Napi::Object::New(env);
+  }
+
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+  const std::string abcorr = info[3].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkezId", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
+  char ref[TSPICE_FRNAME_MAX_BYTES];
+  if (!tspice_backend_node::ResolveFrameNameOrThrow(env, refId, ref, "spkezId")) {
+    return Napi::Object::New(env);
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  double state[6] = {0};
+  double lt = 0.0;
+  const int code = tspice_spkez(target, et, ref, abcorr.c_str(), observer, state, &lt, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling spkezId", err);
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("state", MakeNumberArray(env, state, 6));
+  result.Set("lt", Napi::Number::New(env, lt));
+  return result;
+}
+
+static Napi::Object SpkgeoId(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 4 || !info[1].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "spkgeoId(target: number, et: number, refId: number, observer: number) expects (number, number, number, number)"));
+    return Napi::Object::New(env);
+  }
+
+  int32_t target = 0;
+  int32_t refId = 0;
+  int32_t observer = 0;
+  if (!ReadInt32Checked(env, info[0], "target", &target) || !ReadInt32Checked(env, info[2], "refId", &refId) ||
+      !ReadInt32Checked(env, info[3], "observer", &observer)) {
+    return Napi::Object::New(env);
+  }
+
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkgeoId", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
+  char ref[TSPICE_FRNAME_MAX_BYTES];
+  if (!tspice_backend_node::ResolveFrameNameOrThrow(env, refId, ref, "spkgeoId")) {
+    return Napi::Object::New(env);
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  double state[6] = {0};
+  double lt = 0.0;
+  const int code = tspice_spkgeo(target, et, ref, observer, state, &lt, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling spkgeoId", err);
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("state", MakeNumberArray(env, state, 6));
+  result.Set("lt", Napi::Number::New(env, lt));
+  return result;
+}
+
 static Napi::Object Spkgps(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -358,7 +913,10 @@ static Napi::Object Spkgps(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkgps", target, observer, et, et)) {
+    return Napi::Object::New(env);
+  }
   char err[tspice_backend_node::kErrMaxBytes];
   double pos[3] = {0};
   double lt = 0.0;
@@ -388,20 +946,163 @@ static Napi::Array Spkssb(const Napi::CallbackInfo& info) {
     return Napi::Array::New(env);
   }
 
-  const double et = info[1].As<Napi::Number>().DoubleValue();
-  const std::string ref = info[2].As<Napi::String>().Utf8Value();
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+  const std::string ref = info[2].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, "spkssb", target, 0, et, et)) {
+    return Napi::Array::New(env);
+  }
+  char err[tspice_backend_node::kErrMaxBytes];
+  double state[6] = {0};
+
+  const int code = tspice_spkssb(target, et, ref.c_str(), state, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling spkssb", err);
+    return Napi::Array::New(env);
+  }
+
+  return MakeNumberArray(env, state, 6);
+}
+
+// `spkgeoCached` / `spkgeoCachedBatch`: `spkgeo` through the native Chebyshev/Hermite evaluator
+// (see spk_evaluator.h).
+static bool ReadSpkgeoCachedArgs(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    bool batch,
+    int32_t* target,
+    std::string* ref,
+    int32_t* observer) {
+  Napi::Env env = info.Env();
+  if (info.Length() != 4 || (!batch && !info[1].IsNumber()) || !info[2].IsString()) {
+    const std::string signature = batch
+        ? "(target: number, ets: Float64Array, ref: string, observer: number) expects (number, Float64Array, string, number)"
+        : "(target: number, et: number, ref: string, observer: number) expects (number, number, string, number)";
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + signature));
+    return false;
+  }
+  if (!ReadInt32Checked(env, info[0], "target", target) || !ReadInt32Checked(env, info[3], "observer", observer)) {
+    return false;
+  }
+  *ref = info[2].As<Napi::String>().Utf8Value();
+  return true;
+}
+
+static bool EvaluateSpkgeoCached(
+    Napi::Env env,
+    const char* name,
+    int32_t target,
+    const double* ets,
+    size_t n,
+    const std::string& ref,
+    int32_t observer,
+    double* states,
+    double* lts,
+    bool reportIndex) {
+  const auto [etMin, etMax] = std::minmax_element(ets, ets + n);
+  tspice_backend_node::CspiceLock lock;
+  if (!EnsureLazySpk(env, name, target, observer, *etMin, *etMax)) {
+    return false;
+  }
+  char err[tspice_backend_node::kErrMaxBytes];
+  int failedIndex = -1;
+  const int code = tspice_backend_node::EvaluateSpkGeoBatch(
+      target, ets, (int)n, ref.c_str(), observer, states, lts, &failedIndex, err, (int)sizeof(err));
+  if (code != 0) {
+    std::string context = std::string("CSPICE failed while calling ") + name;
+    if (reportIndex && failedIndex >= 0) {
+      context += "(ets[" + std::to_string(failedIndex) + "])";
+    }
+    ThrowSpiceError(env, context, err, name, [&](Napi::Object& obj) {
+      if (reportIndex && failedIndex >= 0) {
+        obj.Set("index", Napi::Number::New(env, failedIndex));
+      }
+    });
+    return false;
+  }
+  return true;
+}
+
+static Napi::Object SpkgeoCached(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  int32_t target = 0;
+  int32_t observer = 0;
+  std::string ref;
+  if (!ReadSpkgeoCachedArgs(info, "spkgeoCached", false, &target, &ref, &observer)) {
+    return Napi::Object::New(env);
+  }
+  const double et = info[1].As<Napi::Number>().DoubleValue();
+
+  double state[6] = {0};
+  double lt = 0.0;
+  if (!EvaluateSpkgeoCached(env, "spkgeoCached", target, &et, 1, ref, observer, state, &lt, false)) {
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("state", MakeNumberArray(env, state, 6));
+  result.Set("lt", Napi::Number::New(env, lt));
+  return result;
+}
+
+static Napi::Object SpkgeoCachedBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  int32_t target = 0;
+  int32_t observer = 0;
+  std::string ref;
+  if (!ReadSpkgeoCachedArgs(info, "spkgeoCachedBatch", true, &target, &ref, &observer)) {
+    return Napi::Object::New(env);
+  }
+
+  const double* ets = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &ets, &n, "ets")) {
+    return Napi::Object::New(env);
+  }
+  if (n > static_cast<size_t>(std::numeric_limits<int>::max()) / 6) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkgeoCachedBatch(): ets is too long"));
+    return Napi::Object::New(env);
+  }
+
+  Napi::Float64Array states = Napi::Float64Array::New(env, n * 6);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  Napi::Float64Array lts = Napi::Float64Array::New(env, n);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (n > 0 &&
+      !EvaluateSpkgeoCached(env, "spkgeoCachedBatch", target, ets, n, ref, observer, states.Data(), lts.Data(), true)) {
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("states", states);
+  result.Set("lts", lts);
+  return result;
+}
+
+static Napi::Object SpkEvaluatorStatsJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
-  double state[6] = {0};
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "spkEvaluatorStats() does not take any arguments"));
+    return Napi::Object::New(env);
+  }
 
-  const int code = tspice_spkssb(target, et, ref.c_str(), state, err, (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(env, "CSPICE failed while calling spkssb", err);
-    return Napi::Array::New(env);
+  tspice_backend_node::SpkEvaluatorStats stats;
+  {
+    tspice_backend_node::CspiceLock lock;
+    stats = tspice_backend_node::GetSpkEvaluatorStats();
   }
 
-  return MakeNumberArray(env, state, 6);
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("segments", Napi::Number::New(env, stats.segments));
+  result.Set("recordHits", Napi::Number::New(env, stats.recordHits));
+  result.Set("recordReads", Napi::Number::New(env, stats.recordReads));
+  result.Set("fallbacks", Napi::Number::New(env, stats.fallbacks));
+  return result;
 }
 
 static Napi::Value Spkcov(const Napi::CallbackInfo& info) {
@@ -478,6 +1179,54 @@ static Napi::Value Spkobj(const Napi::CallbackInfo& info) {
   return env.Undefined();
 }
 
+static Napi::Value SpkcovIntervals(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsString()) {
+    ThrowSpiceError(
+        Napi::TypeError::New(env, "spkcovIntervals(spk: string, idcode: number) expects (string, number)"));
+    return env.Undefined();
+  }
+
+  const std::string spk = info[0].As<Napi::String>().Utf8Value();
+
+  int32_t idcode = 0;
+  if (!ReadInt32Checked(env, info[1], "idcode", &idcode)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  std::vector<double> intervals;
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_backend_node::CoverageIndexSpkCoverage(spk, idcode, &intervals, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling spkcovIntervals", err);
+    return env.Undefined();
+  }
+
+  return tspice_backend_node::IntervalsToFloat64Array(env, intervals);
+}
+
+static Napi::Value SpkobjIds(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "spkobjIds(spk: string) expects exactly one string argument"));
+    return env.Undefined();
+  }
+
+  const std::string spk = info[0].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  std::vector<int> ids;
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_backend_node::CoverageIndexSpkObjects(spk, &ids, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling spkobjIds", err);
+    return env.Undefined();
+  }
+
+  return tspice_backend_node::IdsToInt32Array(env, ids);
+}
+
 static Napi::Object Spksfs(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -493,7 +1242,7 @@ static Napi::Object Spksfs(const Napi::CallbackInfo& info) {
 
   const double et = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   double descr[5] = {0};
@@ -549,7 +1298,7 @@ static Napi::Array Spkpds(const Napi::CallbackInfo& info) {
   const double first = info[4].As<Napi::Number>().DoubleValue();
   const double last = info[5].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double descr[5] = {0};
 
@@ -575,7 +1324,7 @@ static Napi::Object Spkuds(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
 
   int body = 0;
@@ -635,7 +1384,7 @@ static Napi::Number Spkopn(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_spkopn(path.c_str(), ifname.c_str(), ncomch, &handle, err, (int)sizeof(err));
@@ -660,7 +1409,7 @@ static Napi::Number Spkopa(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_spkopa(path.c_str(), &handle, err, (int)sizeof(err));
@@ -688,7 +1437,7 @@ static void Spkcls(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_spkcls(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -696,6 +1445,192 @@ static void Spkcls(const Napi::CallbackInfo& info) {
   }
 }
 
+// Longest SPK segment identifier (`dafgn_c` on an SPK), plus the terminator.
+static constexpr int kSpkSegmentIdMaxBytes = 41;
+
+// One source segment selected by `spkSubset`: its source file, unpacked summary and name.
+struct SpkSubsetSegment {
+  int handle = 0;
+  double dc[2];
+  int ic[6];
+  char ident[kSpkSegmentIdMaxBytes];
+};
+
+// Scans the SPK at `path` (already open as `handle`) and appends every segment whose body is in
+// `bodies` (every segment when empty) and whose coverage overlaps `[first, last]`.
+static int SelectSpkSubsetSegments(
+    int handle,
+    const std::unordered_set<int>& bodies,
+    double first,
+    double last,
+    std::vector<SpkSubsetSegment>* out,
+    char* err,
+    int errMaxBytes) {
+  int code = tspice_dafbfs(handle, err, errMaxBytes);
+  while (code == 0) {
+    int found = 0;
+    code = tspice_daffna(handle, &found, err, errMaxBytes);
+    if (code != 0 || !found) break;
+
+    SpkSubsetSegment seg;
+    seg.handle = handle;
+    code = tspice_dafgsu(handle, 2, 6, seg.dc, seg.ic, err, errMaxBytes);
+    if (code != 0) break;
+    if (!bodies.empty() && bodies.count(seg.ic[0]) == 0) continue;
+    if (seg.dc[1] < first || seg.dc[0] > last) continue;
+
+    code = tspice_dafgn(handle, seg.ident, (int)sizeof(seg.ident), err, errMaxBytes);
+    if (code != 0) break;
+    out->push_back(seg);
+  }
+  return code;
+}
+
+// Writes a new SPK holding only what `bodies` need over `[first, last]`, spkmerge-style but in one
+// native call under one lock.
+//
+// Every segment of `sources` for one of `bodies` (every body when `bodies` is empty) that overlaps
+// the window is trimmed to it with `spksub`, which copies just the records covering the window
+// (plus the data type's interpolation context). Segments keep their source order, so later
+// sources, and later segments within a file, still take precedence as they would under `furnsh`.
+// Chains are not followed: list every body a query needs (e.g. 399, 3 and 10 for Earth relative
+// to the Sun). Returns the number of segments written; on failure the output file is removed.
+static Napi::Number SpkSubset(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 6 || !info[1].IsString() || !info[2].IsString() || !info[3].IsTypedArray() ||
+      info[3].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array || !info[4].IsNumber() ||
+      !info[5].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "spkSubset(sources: string[], outPath: string, ifname: string, bodies: Int32Array, first: number, last: number) expects (string[], string, string, Int32Array, number, number)"));
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_napi::JsStringArrayArg sources;
+  if (!tspice_napi::ReadStringArray(env, info[0], &sources, "sources")) {
+    return Napi::Number::New(env, 0);
+  }
+  const std::string outPath = info[1].As<Napi::String>().Utf8Value();
+  const std::string ifname = info[2].As<Napi::String>().Utf8Value();
+  Napi::Int32Array bodiesArg = info[3].As<Napi::Int32Array>();
+  const std::unordered_set<int> bodies(bodiesArg.Data(), bodiesArg.Data() + bodiesArg.ElementLength());
+  const double first = info[4].As<Napi::Number>().DoubleValue();
+  const double last = info[5].As<Napi::Number>().DoubleValue();
+
+  if (sources.values.empty()) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkSubset(): sources must not be empty"));
+    return Napi::Number::New(env, 0);
+  }
+  if (!std::isfinite(first) || !std::isfinite(last) || first > last) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkSubset(): expected finite first <= last"));
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+
+  // Sources are closed even after a failure. The shim's error fields are captured before any
+  // cleanup call, which would otherwise overwrite the error being reported.
+  std::vector<int> opened;
+  const auto closeSources = [&]() {
+    for (int handle : opened) tspice_dafcls(handle, nullptr, 0);
+    opened.clear();
+  };
+
+  std::vector<SpkSubsetSegment> segments;
+  for (const std::string& path : sources.values) {
+    char arch[tspice_backend_node::kOutMaxBytes];
+    char type[tspice_backend_node::kOutMaxBytes];
+    int handle = 0;
+    int code = tspice_getfat(path.c_str(), arch, (int)sizeof(arch), type, (int)sizeof(type), err, (int)sizeof(err));
+    if (code == 0 && (std::strcmp(arch, "DAF") != 0 || std::strcmp(type, "SPK") != 0)) {
+      closeSources();
+      ThrowSpiceError(Napi::TypeError::New(
+          env, "spkSubset(): \"" + PreviewForError(path) + "\" is not an SPK file (" + arch + "/" + type + ")"));
+      return Napi::Number::New(env, 0);
+    }
+    if (code == 0) code = tspice_dafopr(path.c_str(), &handle, err, (int)sizeof(err));
+    if (code == 0) {
+      opened.push_back(handle);
+      code = SelectSpkSubsetSegments(handle, bodies, first, last, &segments, err, (int)sizeof(err));
+    }
+    if (code != 0) {
+      const tspice_napi::SpiceErrorFields fields = tspice_napi::CaptureLastSpiceErrorFields();
+      closeSources();
+      ThrowSpiceError(tspice_napi::MakeSpiceError(
+          env,
+          std::string("CSPICE failed while calling spkSubset() reading \"") + PreviewForError(path) + "\"",
+          err,
+          fields));
+      return Napi::Number::New(env, 0);
+    }
+  }
+
+  if (segments.empty()) {
+    closeSources();
+    ThrowSpiceError(Napi::RangeError::New(
+        env, "spkSubset(): no segment for the requested bodies overlaps [" + std::to_string(first) + ", " +
+                 std::to_string(last) + "]"));
+    return Napi::Number::New(env, 0);
+  }
+
+  int newHandle = 0;
+  int code = tspice_spkopn(outPath.c_str(), ifname.c_str(), 0, &newHandle, err, (int)sizeof(err));
+  const char* failedOp = "spkopn";
+  tspice_napi::SpiceErrorFields fields;
+  if (code != 0) {
+    fields = tspice_napi::CaptureLastSpiceErrorFields();
+  } else {
+    failedOp = "spksub";
+    for (const SpkSubsetSegment& seg : segments) {
+      code = tspice_spksub(
+          seg.handle,
+          seg.dc,
+          seg.ic,
+          seg.ident,
+          std::max(first, seg.dc[0]),
+          std::min(last, seg.dc[1]),
+          newHandle,
+          err,
+          (int)sizeof(err));
+      if (code != 0) break;
+    }
+    if (code == 0) {
+      failedOp = "spkcls";
+      code = tspice_spkcls(newHandle, err, (int)sizeof(err));
+      if (code != 0) fields = tspice_napi::CaptureLastSpiceErrorFields();
+    } else {
+      // Snapshot the `spksub` failure first: the cleanup below can fail too and would overwrite it.
+      fields = tspice_napi::CaptureLastSpiceErrorFields();
+      if (tspice_spkcls(newHandle, nullptr, 0) != 0) {
+        // A half-written segment makes `spkcls` refuse; the partial file is removed anyway.
+        tspice_dafcls(newHandle, nullptr, 0);
+      }
+    }
+    if (code != 0) std::remove(outPath.c_str());
+  }
+  if (code != 0) {
+    closeSources();
+    ThrowSpiceError(tspice_napi::MakeSpiceError(
+        env,
+        std::string("CSPICE failed while calling spkSubset(\"") + PreviewForError(outPath) + "\") (" + failedOp + ")",
+        err,
+        fields,
+        failedOp));
+    return Napi::Number::New(env, 0);
+  }
+
+  for (size_t i = 0; i < opened.size(); i++) {
+    if (tspice_dafcls(opened[i], err, (int)sizeof(err)) != 0) {
+      for (size_t j = i + 1; j < opened.size(); j++) tspice_dafcls(opened[j], nullptr, 0);
+      ThrowSpiceError(env, "CSPICE failed while calling spkSubset() (dafcls)", err, "dafcls");
+      return Napi::Number::New(env, 0);
+    }
+  }
+  return Napi::Number::New(env, (double)segments.size());
+}
+
 static void Spkw08(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -789,7 +1724,7 @@ static void Spkw08(const Napi::CallbackInfo& info) {
     }
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_spkw08_v2(
       handle,
@@ -812,26 +1747,514 @@ static void Spkw08(const Napi::CallbackInfo& info) {
   }
 }
 
+// --- Streaming SPK segment writer -------------------------------------------
+//
+// States are buffered natively up to `capacity` rows. Each time the buffer
+// fills, the buffered rows are written as one type 8/9/12/13 segment and the
+// last `2 * context + 1` rows are carried into the next buffer. Segment `k`
+// covers `[coverStart, epoch(rows - 1 - context)]`, so every epoch it covers
+// has at least `context` states on either side and gets the same
+// interpolation window it would get from a single segment holding the whole
+// history.
+
+struct SpkSegmentStream {
+  int handle = 0;
+  int type = 0;
+  int body = 0;
+  int center = 0;
+  int degree = 0;
+  std::string frame;
+  std::string segid;
+  double first = 0;
+  double last = 0;
+  double epoch1 = 0;  // types 8/12
+  double step = 0;    // types 8/12
+  size_t capacity = 0;
+  size_t context = 0;
+  std::vector<double> states;  // 6 per buffered row
+  std::vector<double> epochs;  // types 9/13: 1 per buffered row
+  uint64_t bufferStart = 0;    // types 8/12: global index of buffered row 0
+  double coverStart = 0;
+  bool done = false;  // a segment already reached `last`
+  size_t trackedBytes = 0;  // buffer capacity reported to V8 (see native_memory.h)
+};
+
+// Guarded by `g_cspice_mutex`, like the CSPICE handle the stream writes to.
+static std::unordered_map<uint32_t, SpkSegmentStream> g_spk_streams;
+static uint32_t g_next_spk_stream_id = 1;
+
+constexpr size_t kMaxSpkStreamChunkStates = 16u * 1024u * 1024u;
+
+static bool IsEqualStepSpkType(int type) {
+  return type == 8 || type == 12;
+}
+
+static const char* SpkWriterName(int type) {
+  switch (type) {
+    case 8:
+      return "spkw08";
+    case 9:
+      return "spkw09";
+    case 12:
+      return "spkw12";
+    default:
+      return "spkw13";
+  }
+}
+
+static double SpkStreamEpochAt(const SpkSegmentStream& s, size_t row) {
+  if (IsEqualStepSpkType(s.type)) {
+    return s.epoch1 + static_cast<double>(s.bufferStart + row) * s.step;
+  }
+  return s.epochs[row];
+}
+
+// Writes buffered rows `[0, rows)` as one segment covering `[coverStart, coverEnd]`.
+static int WriteSpkStreamSegment(SpkSegmentStream& s, double coverEnd, char* err, int errMaxBytes) {
+  const int n = static_cast<int>(s.states.size() / 6);
+  switch (s.type) {
+    case 8:
+      return tspice_spkw08(
+          s.handle, s.body, s.center, s.frame.c_str(), s.coverStart, coverEnd, s.segid.c_str(), s.degree, n,
+          s.states.data(), SpkStreamEpochAt(s, 0), s.step, err, errMaxBytes);
+    case 12:
+      return tspice_spkw12(
+          s.handle, s.body, s.center, s.frame.c_str(), s.coverStart, coverEnd, s.segid.c_str(), s.degree, n,
+          s.states.data(), SpkStreamEpochAt(s, 0), s.step, err, errMaxBytes);
+    case 9:
+      return tspice_spkw09(
+          s.handle, s.body, s.center, s.frame.c_str(), s.coverStart, coverEnd, s.segid.c_str(), s.degree, n,
+          s.states.data(), s.epochs.data(), err, errMaxBytes);
+    default:
+      return tspice_spkw13(
+          s.handle, s.body, s.center, s.frame.c_str(), s.coverStart, coverEnd, s.segid.c_str(), s.degree, n,
+          s.states.data(), s.epochs.data(), err, errMaxBytes);
+  }
+}
+
+// Called when the buffer is full: write a segment (if it covers anything) and
+// carry the trailing rows over.
+static int FlushSpkStream(SpkSegmentStream& s, char* err, int errMaxBytes) {
+  const size_t rows = s.states.size() / 6;
+  const size_t keepFrom = rows - 1 - 2 * s.context;
+  double coverEnd = SpkStreamEpochAt(s, rows - 1 - s.context);
+
+  if (coverEnd > s.coverStart) {
+    if (coverEnd >= s.last) {
+      coverEnd = s.last;
+      s.done = true;
+    }
+    const int code = WriteSpkStreamSegment(s, coverEnd, err, errMaxBytes);
+    if (code != 0) return code;
+    s.coverStart = coverEnd;
+  }
+
+  s.states.erase(s.states.begin(), s.states.begin() + static_cast<std::ptrdiff_t>(keepFrom * 6));
+  if (!IsEqualStepSpkType(s.type)) {
+    s.epochs.erase(s.epochs.begin(), s.epochs.begin() + static_cast<std::ptrdiff_t>(keepFrom));
+  }
+  s.bufferStart += keepFrom;
+  return 0;
+}
+
+static bool ReadFiniteNumberArg(Napi::Env env, const Napi::Value& value, const char* what, double* out) {
+  if (!value.IsNumber() || !std::isfinite(value.As<Napi::Number>().DoubleValue())) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string("Expected ") + what + " to be a finite number"));
+    return false;
+  }
+  *out = value.As<Napi::Number>().DoubleValue();
+  return true;
+}
+
+static Napi::Number SpkwStreamOpen(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 12 || !info[5].IsString() || !info[6].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "spkwStreamOpen(handle: number, type: number, body: number, center: number, degree: number, frame: string, segid: string, first: number, last: number, epoch1: number, step: number, chunkStates: number) expects (number, number, number, number, number, string, string, number, number, number, number, number)"));
+    return Napi::Number::New(env, 0);
+  }
+
+  SpkSegmentStream s;
+  int32_t type = 0;
+  int32_t chunkStates = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &s.handle)) return Napi::Number::New(env, 0);
+  if (!ReadInt32Checked(env, info[1], "type", &type)) return Napi::Number::New(env, 0);
+  if (!ReadInt32Checked(env, info[2], "body", &s.body)) return Napi::Number::New(env, 0);
+  if (!ReadInt32Checked(env, info[3], "center", &s.center)) return Napi::Number::New(env, 0);
+  if (!ReadInt32Checked(env, info[4], "degree", &s.degree)) return Napi::Number::New(env, 0);
+  s.frame = info[5].As<Napi::String>().Utf8Value();
+  s.segid = info[6].As<Napi::String>().Utf8Value();
+  if (!ReadFiniteNumberArg(env, info[7], "first", &s.first)) return Napi::Number::New(env, 0);
+  if (!ReadFiniteNumberArg(env, info[8], "last", &s.last)) return Napi::Number::New(env, 0);
+  if (!ReadFiniteNumberArg(env, info[9], "epoch1", &s.epoch1)) return Napi::Number::New(env, 0);
+  if (!ReadFiniteNumberArg(env, info[10], "step", &s.step)) return Napi::Number::New(env, 0);
+  if (!ReadInt32Checked(env, info[11], "chunkStates", &chunkStates)) return Napi::Number::New(env, 0);
+
+  if (type != 8 && type != 9 && type != 12 && type != 13) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamOpen(): type must be 8, 9, 12 or 13"));
+    return Napi::Number::New(env, 0);
+  }
+  s.type = type;
+  if (s.degree < 1) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamOpen(): degree must be >= 1"));
+    return Napi::Number::New(env, 0);
+  }
+  if (!(s.last > s.first)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamOpen(): last must be > first"));
+    return Napi::Number::New(env, 0);
+  }
+  if (IsEqualStepSpkType(s.type) && !(s.step > 0)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamOpen(): step must be > 0"));
+    return Napi::Number::New(env, 0);
+  }
+
+  // A full window (degree + 1 states) on either side of every covered epoch.
+  s.context = static_cast<size_t>(s.degree) + 1;
+  const size_t minChunk = 2 * s.context + 2;
+  if (chunkStates < 0 || static_cast<size_t>(chunkStates) < minChunk ||
+      static_cast<size_t>(chunkStates) > kMaxSpkStreamChunkStates) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        std::string("spkwStreamOpen(): chunkStates must be in [") + std::to_string(minChunk) + ", " +
+            std::to_string(kMaxSpkStreamChunkStates) + "] for degree " + std::to_string(s.degree)));
+    return Napi::Number::New(env, 0);
+  }
+  s.capacity = static_cast<size_t>(chunkStates);
+  s.coverStart = s.first;
+  s.states.reserve(s.capacity * 6);
+  if (!IsEqualStepSpkType(s.type)) {
+    s.epochs.reserve(s.capacity);
+  }
+
+  s.trackedBytes = (s.states.capacity() + s.epochs.capacity()) * sizeof(double);
+  const size_t trackedBytes = s.trackedBytes;
+
+  tspice_backend_node::CspiceLock lock;
+  const uint32_t id = g_next_spk_stream_id++;
+  g_spk_streams.emplace(id, std::move(s));
+  tspice_backend_node::GetInstanceData(env).spkStreams.insert(id);
+  tspice_backend_node::TrackNativeAllocation(env, tspice_backend_node::NativeMemoryKind::kSpkStreams, trackedBytes);
+  return Napi::Number::New(env, (double)id);
+}
+
+static SpkSegmentStream* LookupSpkStream(
+    Napi::Env env,
+    const Napi::Value& value,
+    const char* fn,
+    uint32_t* outId) {
+  int32_t id = 0;
+  if (!ReadInt32Checked(env, value, "stream", &id)) return nullptr;
+  // Streams belong to the environment that opened them.
+  const bool owned = id > 0 && tspice_backend_node::GetInstanceData(env).spkStreams.count(static_cast<uint32_t>(id)) != 0;
+  auto it = owned ? g_spk_streams.find(static_cast<uint32_t>(id)) : g_spk_streams.end();
+  if (it == g_spk_streams.end()) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(fn) + "(): unknown or closed stream " + std::to_string(id)));
+    return nullptr;
+  }
+  *outId = it->first;
+  return &it->second;
+}
+
+static void SpkwStreamAppend(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "spkwStreamAppend(stream: number, states: Float64Array, epochs: Float64Array | undefined) expects 3 arguments"));
+    return;
+  }
+
+  const double* states = nullptr;
+  size_t statesLen = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &states, &statesLen, "states")) return;
+  if (statesLen % 6 != 0) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamAppend(): states.length must be a multiple of 6"));
+    return;
+  }
+  const size_t rows = statesLen / 6;
+  for (size_t i = 0; i < statesLen; i++) {
+    if (!std::isfinite(states[i])) {
+      ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamAppend(): states must contain only finite numbers"));
+      return;
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  uint32_t id = 0;
+  SpkSegmentStream* s = LookupSpkStream(env, info[0], "spkwStreamAppend", &id);
+  if (s == nullptr) return;
+
+  const double* epochs = nullptr;
+  if (IsEqualStepSpkType(s->type)) {
+    if (!info[2].IsUndefined()) {
+      ThrowSpiceError(Napi::TypeError::New(env, "spkwStreamAppend(): epochs must be omitted for equal-step types 8/12"));
+      return;
+    }
+  } else {
+    size_t epochsLen = 0;
+    if (!tspice_napi::ReadFloat64ArrayArg(env, info[2], &epochs, &epochsLen, "epochs")) return;
+    if (epochsLen != rows) {
+      ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamAppend(): expected epochs.length === states.length / 6"));
+      return;
+    }
+    for (size_t i = 0; i < rows; i++) {
+      if (!std::isfinite(epochs[i])) {
+        ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamAppend(): epochs must contain only finite numbers"));
+        return;
+      }
+    }
+  }
+
+  if (s->done) {
+    // Everything up to `last` (plus interpolation context) is already on disk.
+    return;
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  size_t row = 0;
+  while (row < rows) {
+    const size_t buffered = s->states.size() / 6;
+    const size_t take = std::min(rows - row, s->capacity - buffered);
+    s->states.insert(s->states.end(), states + row * 6, states + (row + take) * 6);
+    if (epochs != nullptr) {
+      s->epochs.insert(s->epochs.end(), epochs + row, epochs + row + take);
+    }
+    row += take;
+
+    if (s->states.size() / 6 == s->capacity) {
+      if (FlushSpkStream(*s, err, (int)sizeof(err)) != 0) {
+        // A failed write leaves the stream unusable; drop it.
+        const std::string context =
+            std::string("CSPICE failed while calling spkwStreamAppend() (") + SpkWriterName(s->type) + ")";
+        tspice_backend_node::TrackNativeRelease(
+            env, tspice_backend_node::NativeMemoryKind::kSpkStreams, s->trackedBytes);
+        g_spk_streams.erase(id);
+        tspice_backend_node::GetInstanceData(env).spkStreams.erase(id);
+        ThrowSpiceError(env, context, err);
+        return;
+      }
+      if (s->done) return;
+    }
+  }
+}
+
+static void SpkwStreamClose(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[1].IsBoolean()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "spkwStreamClose(stream: number, abort: boolean) expects (number, boolean)"));
+    return;
+  }
+  const bool abort = info[1].As<Napi::Boolean>().Value();
+
+  tspice_backend_node::CspiceLock lock;
+  uint32_t id = 0;
+  SpkSegmentStream* s = LookupSpkStream(env, info[0], "spkwStreamClose", &id);
+  if (s == nullptr) return;
+
+  // The stream is gone after this call whether or not the final write succeeds.
+  SpkSegmentStream stream = std::move(*s);
+  g_spk_streams.erase(id);
+  tspice_backend_node::GetInstanceData(env).spkStreams.erase(id);
+  tspice_backend_node::TrackNativeRelease(env, tspice_backend_node::NativeMemoryKind::kSpkStreams, stream.trackedBytes);
+  if (abort || stream.done) return;
+
+  if (stream.states.empty()) {
+    ThrowSpiceError(Napi::RangeError::New(env, "spkwStreamClose(): no states were appended"));
+    return;
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = WriteSpkStreamSegment(stream, stream.last, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling spkwStreamClose() (") + SpkWriterName(stream.type) + ")",
+        err);
+  }
+}
+
+// Largest table `ephemerisTableBuild` will produce (~310 MB of breakpoints and coefficients, far
+// past any display use; a span that needs this many pieces has too tight a tolerance).
+constexpr uint32_t kMaxEphemerisTableSegments = 1u << 20;
+
+// Default velocity tolerance (km/s) per km of position tolerance: the position tolerance drifted
+// over this many seconds.
+constexpr double kEphemerisTableDefaultVelocitySeconds = 1000.0;
+
+static Napi::Value EphemerisTableBuild(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if ((info.Length() != 7 && info.Length() != 8) || !info[0].IsString() || !info[1].IsNumber() ||
+      !info[2].IsNumber() || !info[3].IsString() || !info[4].IsString() || !info[5].IsString() ||
+      !info[6].IsNumber() || (info.Length() == 8 && !info[7].IsNumber() && !info[7].IsUndefined())) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "ephemerisTableBuild(target: string, et0: number, et1: number, ref: string, abcorr: string, observer: string, tolerance: number, velocityTolerance?: number) expects (string, number, number, string, string, string, number, number?)"));
+    return env.Undefined();
+  }
+
+  const std::string target = info[0].As<Napi::String>().Utf8Value();
+  const double et0 = info[1].As<Napi::Number>().DoubleValue();
+  const double et1 = info[2].As<Napi::Number>().DoubleValue();
+  const std::string ref = info[3].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[4].As<Napi::String>().Utf8Value();
+  const std::string observer = info[5].As<Napi::String>().Utf8Value();
+  const double tolerance = info[6].As<Napi::Number>().DoubleValue();
+  const double velocityTolerance = info.Length() == 8 && info[7].IsNumber()
+      ? info[7].As<Napi::Number>().DoubleValue()
+      : tolerance / kEphemerisTableDefaultVelocitySeconds;
+  if (!std::isfinite(et0) || !std::isfinite(et1) || !(et1 > et0)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "ephemerisTableBuild(): expected finite et0 < et1"));
+    return env.Undefined();
+  }
+  if (!std::isfinite(tolerance) || !(tolerance > 0.0)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "ephemerisTableBuild(): tolerance must be a positive finite number (km)"));
+    return env.Undefined();
+  }
+  if (!std::isfinite(velocityTolerance) || !(velocityTolerance > 0.0)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env, "ephemerisTableBuild(): velocityTolerance must be a positive finite number (km/s)"));
+    return env.Undefined();
+  }
+
+  std::vector<uint8_t> table;
+  {
+    tspice_backend_node::CspiceLock lock;
+    if (!EnsureLazySpk(env, "ephemerisTableBuild", target, observer, et0, et1)) {
+      return env.Undefined();
+    }
+
+    char err[tspice_backend_node::kErrMaxBytes];
+    double failedEt = 0.0;
+    const int code = tspice_backend_node::BuildEphemerisTable(
+        et0,
+        et1,
+        tolerance,
+        velocityTolerance,
+        kMaxEphemerisTableSegments,
+        [&](double et, double state[6], char* sampleErr, int sampleErrMaxBytes) {
+          double lt = 0.0;
+          return tspice_spkezr(
+              target.c_str(), et, ref.c_str(), abcorr.c_str(), observer.c_str(), state, &lt, sampleErr, sampleErrMaxBytes);
+        },
+        &table,
+        &failedEt,
+        err,
+        (int)sizeof(err));
+    if (code == 1) {
+      ThrowSpiceError(
+          env, "CSPICE failed while calling ephemerisTableBuild (spkezr at et " + std::to_string(failedEt) + ")", err);
+      return env.Undefined();
+    }
+    if (code == 2) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          "ephemerisTableBuild(): tolerance too tight for this span (more than " +
+              std::to_string(kMaxEphemerisTableSegments) + " pieces)"));
+      return env.Undefined();
+    }
+  }
+
+  Napi::ArrayBuffer out = Napi::ArrayBuffer::New(env, table.size());
+  if (env.IsExceptionPending()) return env.Undefined();
+  std::memcpy(out.Data(), table.data(), table.size());
+  return out;
+}
+
+// Evaluates a table from `ephemerisTableBuild` at every epoch in `ets` into `out` (6 per epoch).
+// Touches nothing but its arguments, so it never takes the CSPICE lock.
+static void EphemerisTableEval(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3 || !info[0].IsArrayBuffer()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "ephemerisTableEval(table: ArrayBuffer, ets: Float64Array, out: Float64Array) expects (ArrayBuffer, Float64Array, Float64Array)"));
+    return;
+  }
+
+  Napi::ArrayBuffer buffer = info[0].As<Napi::ArrayBuffer>();
+  tspice_backend_node::EphemerisTableView table;
+  std::string why;
+  if (!tspice_backend_node::ParseEphemerisTable(
+          static_cast<const uint8_t*>(buffer.Data()), buffer.ByteLength(), &table, &why)) {
+    ThrowSpiceError(Napi::RangeError::New(env, "ephemerisTableEval(): " + why));
+    return;
+  }
+
+  const double* ets = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[1], &ets, &n, "ets")) return;
+  double* out = nullptr;
+  if (!tspice_napi::ReadFloat64ArrayOut(env, info[2], n * 6, &out, "out")) return;
+
+  for (size_t i = 0; i < n; i++) {
+    if (!tspice_backend_node::EvaluateEphemerisTable(table, ets[i], out + i * 6)) {
+      Napi::Error error =
+          Napi::RangeError::New(env, "ephemerisTableEval(): ets[" + std::to_string(i) + "] is outside the table's span");
+      error.Value().Set("index", Napi::Number::New(env, (double)i));
+      ThrowSpiceError(error);
+      return;
+    }
+  }
+}
+
 namespace tspice_backend_node {
 
+void DropSpkStreams(const CspiceLock& lock, const std::unordered_set<uint32_t>& ids) {
+  (void)lock;
+  // Abandoned like `spkwStreamClose(id, true)`: nothing more is written for them.
+  for (uint32_t id : ids) {
+    auto it = g_spk_streams.find(id);
+    if (it == g_spk_streams.end()) continue;
+    TrackNativeRelease(NativeMemoryKind::kSpkStreams, it->second.trackedBytes);
+    g_spk_streams.erase(it);
+  }
+}
+
 void RegisterEphemeris(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "ckgp", Napi::Function::New(env, Ckgp), __func__)) return;
   if (!SetExportChecked(env, exports, "ckgpav", Napi::Function::New(env, Ckgpav), __func__)) return;
+  if (!SetExportChecked(env, exports, "ckgpBatch", Napi::Function::New(env, CkgpBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "ckgpavBatch", Napi::Function::New(env, CkgpavBatch), __func__)) return;
   if (!SetExportChecked(env, exports, "spkezr", Napi::Function::New(env, Spkezr), __func__)) return;
   if (!SetExportChecked(env, exports, "spkpos", Napi::Function::New(env, Spkpos), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkezrBatch", Napi::Function::New(env, SpkezrBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkposBatch", Napi::Function::New(env, SpkposBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkezrInto", Napi::Function::New(env, SpkezrInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkposInto", Napi::Function::New(env, SpkposInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkezrIntoStatus", Napi::Function::New(env, SpkezrIntoStatus), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkposIntoStatus", Napi::Function::New(env, SpkposIntoStatus), __func__)) return;
+  if (!SetExportChecked(env, exports, "trySpkezr", Napi::Function::New(env, TrySpkezr), __func__)) return;
   if (!SetExportChecked(env, exports, "spkopn", Napi::Function::New(env, Spkopn), __func__)) return;
   if (!SetExportChecked(env, exports, "spkopa", Napi::Function::New(env, Spkopa), __func__)) return;
   if (!SetExportChecked(env, exports, "spkw08", Napi::Function::New(env, Spkw08), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkwStreamOpen", Napi::Function::New(env, SpkwStreamOpen), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkwStreamAppend", Napi::Function::New(env, SpkwStreamAppend), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkwStreamClose", Napi::Function::New(env, SpkwStreamClose), __func__)) return;
+  if (!SetExportChecked(env, exports, "ephemerisTableBuild", Napi::Function::New(env, EphemerisTableBuild), __func__)) return;
+  if (!SetExportChecked(env, exports, "ephemerisTableEval", Napi::Function::New(env, EphemerisTableEval), __func__)) return;
   if (!SetExportChecked(env, exports, "spkcls", Napi::Function::New(env, Spkcls), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkSubset", Napi::Function::New(env, SpkSubset), __func__)) return;
 
   if (!SetExportChecked(env, exports, "spkez", Napi::Function::New(env, Spkez), __func__)) return;
   if (!SetExportChecked(env, exports, "spkezp", Napi::Function::New(env, Spkezp), __func__)) return;
   if (!SetExportChecked(env, exports, "spkgeo", Napi::Function::New(env, Spkgeo), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkezId", Napi::Function::New(env, SpkezId), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkgeoId", Napi::Function::New(env, SpkgeoId), __func__)) return;
   if (!SetExportChecked(env, exports, "spkgps", Napi::Function::New(env, Spkgps), __func__)) return;
   if (!SetExportChecked(env, exports, "spkssb", Napi::Function::New(env, Spkssb), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkgeoCached", Napi::Function::New(env, SpkgeoCached), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkgeoCachedBatch", Napi::Function::New(env, SpkgeoCachedBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkEvaluatorStats", Napi::Function::New(env, SpkEvaluatorStatsJs), __func__)) return;
 
   if (!SetExportChecked(env, exports, "spkcov", Napi::Function::New(env, Spkcov), __func__)) return;
   if (!SetExportChecked(env, exports, "spkobj", Napi::Function::New(env, Spkobj), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkcovIntervals", Napi::Function::New(env, SpkcovIntervals), __func__)) return;
+  if (!SetExportChecked(env, exports, "spkobjIds", Napi::Function::New(env, SpkobjIds), __func__)) return;
   if (!SetExportChecked(env, exports, "spksfs", Napi::Function::New(env, Spksfs), __func__)) return;
   if (!SetExportChecked(env, exports, "spkpds", Napi::Function::New(env, Spkpds), __func__)) return;
   if (!SetExportChecked(env, exports, "spkuds", Napi::Function::New(env, Spkuds), __func__)) return;
@@ -1,9 +1,18 @@
 #pragma once
 
+#include <cstdint>
+#include <unordered_set>
+
 #include <napi.h>
 
+#include "../addon_common.h"
+
 namespace tspice_backend_node {
 
 void RegisterEphemeris(Napi::Env env, Napi::Object exports);
 
+// Discards the given `spkwStreamOpen` streams without writing their buffered states (environment
+// teardown; see instance_data.h).
+void DropSpkStreams(const CspiceLock& lock, const std::unordered_set<uint32_t>& ids);
+
 }  // namespace tspice_backend_node
@@ -17,7 +17,7 @@ static Napi::Boolean Failed(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, false);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   int outFailed = 0;
   char err[tspice_backend_node::kErrMaxBytes];
@@ -38,7 +38,7 @@ static void Reset(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_reset(err, (int)sizeof(err));
   if (code != 0) {
@@ -58,7 +58,7 @@ static Napi::String Getmsg(const Napi::CallbackInfo& info) {
 
   const std::string which = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char out[tspice_backend_node::kOutMaxBytes];
   char err[tspice_backend_node::kErrMaxBytes];
@@ -81,7 +81,7 @@ static void Setmsg(const Napi::CallbackInfo& info) {
 
   const std::string msg = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_setmsg(msg.c_str(), err, (int)sizeof(err));
   if (code != 0) {
@@ -99,7 +99,7 @@ static void Sigerr(const Napi::CallbackInfo& info) {
 
   const std::string shortMsg = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_sigerr(shortMsg.c_str(), err, (int)sizeof(err));
   if (code != 0) {
@@ -117,7 +117,7 @@ static void Chkin(const Napi::CallbackInfo& info) {
 
   const std::string name = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_chkin(name.c_str(), err, (int)sizeof(err));
   if (code != 0) {
@@ -135,7 +135,7 @@ static void Chkout(const Napi::CallbackInfo& info) {
 
   const std::string name = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_chkout(name.c_str(), err, (int)sizeof(err));
   if (code != 0) {
@@ -143,6 +143,36 @@ static void Chkout(const Napi::CallbackInfo& info) {
   }
 }
 
+// The message parts of the last captured CSPICE failure, or null. This is where callers of the
+// `*IntoStatus` exports materialise the long message and trace, and only when they want them; the
+// parts are overwritten by the next failure (from any thread).
+static Napi::Value LastSpiceError(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "lastSpiceError() does not take any arguments"));
+    return env.Undefined();
+  }
+
+  tspice_napi::SpiceErrorFields fields;
+  int errorClass = TSPICE_ERROR_NONE;
+  {
+    tspice_backend_node::CspiceLock lock;
+    errorClass = tspice_last_error_class();
+    if (errorClass == TSPICE_ERROR_NONE) {
+      return env.Null();
+    }
+    fields = tspice_napi::CaptureLastSpiceErrorFields();
+  }
+
+  Napi::Object out = Napi::Object::New(env);
+  out.Set("class", Napi::Number::New(env, errorClass));
+  out.Set("short", Napi::String::New(env, fields.shortMsg));
+  out.Set("long", Napi::String::New(env, fields.longMsg));
+  out.Set("trace", Napi::String::New(env, fields.traceMsg));
+  return out;
+}
+
 namespace tspice_backend_node {
 
 void RegisterError(Napi::Env env, Napi::Object exports) {
@@ -153,6 +183,7 @@ void RegisterError(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "sigerr", Napi::Function::New(env, Sigerr), __func__)) return;
   if (!SetExportChecked(env, exports, "chkin", Napi::Function::New(env, Chkin), __func__)) return;
   if (!SetExportChecked(env, exports, "chkout", Napi::Function::New(env, Chkout), __func__)) return;
+  if (!SetExportChecked(env, exports, "lastSpiceError", Napi::Function::New(env, LastSpiceError), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
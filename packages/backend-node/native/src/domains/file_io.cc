@@ -3,6 +3,7 @@
 #include <string>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <vector>
 
@@ -15,6 +16,7 @@ using tspice_napi::PreviewForError;
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 using tspice_napi::FixedWidthToJsString;
+using tspice_napi::MakePackedStrings;
 
 static bool ReadInt32Checked(Napi::Env env, const Napi::Value& value, const char* what, int32_t* out) {
   const std::string label = (what != nullptr && what[0] != '\0') ? std::string(what) : std::string("value");
@@ -93,7 +95,7 @@ static Napi::Boolean Exists(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int exists = 0;
   const int code = tspice_exists(path.c_str(), &exists, err, (int)sizeof(err));
@@ -118,7 +120,7 @@ static Napi::Object Getfat(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char arch[tspice_backend_node::kOutMaxBytes];
   char type[tspice_backend_node::kOutMaxBytes];
@@ -155,7 +157,7 @@ static Napi::Number Dafopr(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_dafopr(path.c_str(), &handle, err, (int)sizeof(err));
@@ -183,7 +185,7 @@ static void Dafcls(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_dafcls(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -204,7 +206,7 @@ static void Dafbfs(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_dafbfs(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -225,7 +227,7 @@ static Napi::Boolean Daffna(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, false);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int found = 0;
   const int code = tspice_daffna(handle, &found, err, (int)sizeof(err));
@@ -237,6 +239,117 @@ static Napi::Boolean Daffna(const Napi::CallbackInfo& info) {
   return Napi::Boolean::New(env, found != 0);
 }
 
+static Napi::Value Dafgda(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "dafgda(handle: number, baddr: number, eaddr: number) expects exactly 3 arguments"));
+    return env.Undefined();
+  }
+
+  int32_t handle = 0;
+  int32_t baddr = 0;
+  int32_t eaddr = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &handle)) return env.Undefined();
+  if (!ReadInt32Checked(env, info[1], "baddr", &baddr)) return env.Undefined();
+  if (!ReadInt32Checked(env, info[2], "eaddr", &eaddr)) return env.Undefined();
+
+  if (baddr < 1 || eaddr < baddr) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dafgda(): expected 1 <= baddr <= eaddr"));
+    return env.Undefined();
+  }
+
+  const size_t count = static_cast<size_t>(eaddr) - static_cast<size_t>(baddr) + 1;
+  Napi::Float64Array out = Napi::Float64Array::New(env, count);
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code =
+      tspice_dafgda(handle, baddr, eaddr, out.Data(), static_cast<int>(count), err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling dafgda(handle=") + std::to_string(handle) + ")",
+        err);
+    return env.Undefined();
+  }
+
+  return out;
+}
+
+static void SetDafMmapEnabled(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsBoolean()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "setDafMmapEnabled(enabled: boolean) expects exactly one boolean argument"));
+    return;
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  tspice_daf_mmap_set_enabled(info[0].As<Napi::Boolean>().Value() ? 1 : 0);
+}
+
+static Napi::Boolean IsDafMmapEnabled(const Napi::CallbackInfo& info) {
+  tspice_backend_node::CspiceLock lock;
+  return Napi::Boolean::New(info.Env(), tspice_daf_mmap_enabled() != 0);
+}
+
+// Maps a closed output file (e.g. a staged `VirtualOutput`) and returns it as an ArrayBuffer over
+// the mapping itself, unmapped when the buffer is collected. Returns null where that is not
+// possible (no mmap, or a runtime that refuses external buffers), so callers can read the file
+// the ordinary way instead. Meant for files that are removed as soon as this returns: the private
+// mapping still shows later writes to pages it has not copied, and reading past a truncated end
+// raises SIGBUS.
+static Napi::Value MapOutputFile(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "mapOutputFile(path: string) expects exactly one string argument"));
+    return env.Undefined();
+  }
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+#if defined(NODE_API_NO_EXTERNAL_BUFFERS_ALLOWED)
+  return env.Null();
+#else
+  if (!tspice_output_map_supported()) return env.Null();
+
+  // Plain file I/O on a file no CSPICE handle has open: no CSPICE lock needed.
+  char err[tspice_backend_node::kErrMaxBytes];
+  void* base = nullptr;
+  size_t length = 0;
+  if (tspice_map_output_file(path.c_str(), &base, &length, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(Napi::Error::New(
+        env, std::string("mapOutputFile(\"") + PreviewForError(path) + "\") failed: " + err));
+    return env.Undefined();
+  }
+  if (length == 0) return Napi::ArrayBuffer::New(env, 0);
+
+  size_t* hint = new size_t(length);
+  Napi::ArrayBuffer out = Napi::ArrayBuffer::New(
+      env,
+      base,
+      length,
+      [](Napi::Env /*env*/, void* data, size_t* mappedLength) {
+        tspice_unmap_output_file(data, *mappedLength);
+        delete mappedLength;
+      },
+      hint);
+  if (env.IsExceptionPending()) {
+    // External buffers are disabled in this runtime (e.g. a V8 sandbox build).
+    env.GetAndClearPendingException();
+    tspice_unmap_output_file(base, length);
+    delete hint;
+    return env.Null();
+  }
+  return out;
+#endif
+}
+
 static Napi::Number Dasopr(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -247,7 +360,7 @@ static Napi::Number Dasopr(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_dasopr(path.c_str(), &handle, err, (int)sizeof(err));
@@ -275,7 +388,7 @@ static void Dascls(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_dascls(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -296,7 +409,7 @@ static void Dlacls(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_dlacls(handle, err, (int)sizeof(err));
   if (code != 0) {
@@ -326,7 +439,7 @@ static Napi::Number Dlaopn(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_dlaopn(
@@ -368,7 +481,7 @@ static Napi::Number Dskopn(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_dskopn(
@@ -536,7 +649,7 @@ static Napi::Object Dskmi2(const Napi::CallbackInfo& info) {
   std::vector<int32_t> spaixi;
   spaixi.resize((size_t)spxisz);
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
 
   const int code = tspice_dskmi2(
@@ -764,7 +877,7 @@ static void Dskw02(const Napi::CallbackInfo& info) {
     }
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
 
   const int code = tspice_dskw02(
@@ -798,6 +911,160 @@ static void Dskw02(const Napi::CallbackInfo& info) {
   }
 }
 
+// --- Typed-array DSK type 2 writer ------------------------------------------
+//
+// `dskWriteType2` runs `dskmi2_c` and `dskw02_c` back to back on the caller's
+// `Float64Array` / `Int32Array` storage, so neither the mesh nor the spatial
+// index is copied through boxed JS arrays. The index workspace and the integer
+// index component are scratch owned here and reused across calls; buffers for
+// very large models are released afterwards rather than pinned for the life of
+// the process.
+
+static_assert(sizeof(int32_t) == sizeof(int), "dskWriteType2 passes Int32Array plates as SpiceInt");
+
+constexpr int32_t kMaxDskWriteScratchInts = 1 << 28;
+constexpr size_t kRetainedDskWriteScratchInts = size_t{16} << 20;
+
+// Guarded by `g_cspice_mutex`.
+static std::vector<int32_t> g_dsk_write_work;
+static std::vector<int32_t> g_dsk_write_spaixi;
+
+static bool ReadDskScratchSize(Napi::Env env, const Napi::Value& value, const char* what, bool allowZero, int32_t* out) {
+  if (!ReadInt32Checked(env, value, what, out)) return false;
+  if ((allowZero ? *out < 0 : *out <= 0) || *out > kMaxDskWriteScratchInts) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        std::string("dskWriteType2(): ") + what + " must be in [" + (allowZero ? "0" : "1") + ", " +
+            std::to_string(kMaxDskWriteScratchInts) + "]"));
+    return false;
+  }
+  return true;
+}
+
+static void DskWriteType2(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 17 || !info[4].IsString() || !info[10].IsNumber() || !info[15].IsBoolean()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "dskWriteType2(handle, center, surfid, dclass, frame, corsys, corpar, bounds, vertices, plates, finscl, corscl, worksz, voxpsz, voxlsz, makvtl, spxisz) expects 17 args"));
+    return;
+  }
+
+  int32_t handle = 0;
+  int32_t center = 0;
+  int32_t surfid = 0;
+  int32_t dclass = 0;
+  int32_t corsys = 0;
+  if (!ReadInt32Checked(env, info[0], "handle", &handle) || !ReadInt32Checked(env, info[1], "center", &center) ||
+      !ReadInt32Checked(env, info[2], "surfid", &surfid) || !ReadInt32Checked(env, info[3], "dclass", &dclass) ||
+      !ReadInt32Checked(env, info[5], "corsys", &corsys)) {
+    return;
+  }
+  const std::string frame = info[4].As<Napi::String>().Utf8Value();
+
+  double corpar[10] = {0};
+  if (!tspice_backend_node::ReadNumberArrayFixed(env, info[6], 10, corpar, "corpar")) {
+    return;
+  }
+
+  const double* bounds = nullptr;
+  size_t boundsLen = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[7], &bounds, &boundsLen, "bounds")) return;
+  if (boundsLen != 8) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env, "dskWriteType2(): bounds must be [mncor1, mxcor1, mncor2, mxcor2, mncor3, mxcor3, first, last]"));
+    return;
+  }
+
+  const double* vertices = nullptr;
+  size_t verticesLen = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[8], &vertices, &verticesLen, "vertices")) return;
+  if (!info[9].IsTypedArray() || info[9].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array) {
+    ThrowSpiceError(Napi::TypeError::New(env, "plates must be an Int32Array"));
+    return;
+  }
+  Napi::Int32Array platesArr = info[9].As<Napi::Int32Array>();
+  const int32_t* plates = platesArr.Data();
+  const size_t platesLen = platesArr.ElementLength();
+
+  if (verticesLen == 0 || verticesLen % 3 != 0 || verticesLen / 3 > (size_t)std::numeric_limits<int32_t>::max()) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskWriteType2(): vertices.length must be a positive multiple of 3"));
+    return;
+  }
+  if (platesLen == 0 || platesLen % 3 != 0 || platesLen / 3 > (size_t)std::numeric_limits<int32_t>::max()) {
+    ThrowSpiceError(Napi::RangeError::New(env, "dskWriteType2(): plates.length must be a positive multiple of 3"));
+    return;
+  }
+  const int32_t nv = (int32_t)(verticesLen / 3);
+  const int32_t np = (int32_t)(platesLen / 3);
+  for (size_t i = 0; i < platesLen; i++) {
+    if (plates[i] < 1 || plates[i] > nv) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env,
+          std::string("dskWriteType2(): plates[") + std::to_string(i) + "] must be in [1, nv]"));
+      return;
+    }
+  }
+
+  const double finscl = info[10].As<Napi::Number>().DoubleValue();
+  int32_t corscl = 0;
+  if (!ReadInt32Checked(env, info[11], "corscl", &corscl)) return;
+
+  int32_t worksz = 0;
+  int32_t voxpsz = 0;
+  int32_t voxlsz = 0;
+  int32_t spxisz = 0;
+  if (!ReadDskScratchSize(env, info[12], "worksz", false, &worksz) ||
+      !ReadDskScratchSize(env, info[13], "voxpsz", true, &voxpsz) ||
+      !ReadDskScratchSize(env, info[14], "voxlsz", true, &voxlsz) ||
+      !ReadDskScratchSize(env, info[16], "spxisz", false, &spxisz)) {
+    return;
+  }
+  const bool makvtl = info[15].As<Napi::Boolean>().Value();
+
+  tspice_backend_node::CspiceLock lock;
+
+  // Grow only: CSPICE overwrites whatever the scratch holds.
+  if (g_dsk_write_work.size() < (size_t)worksz * 2) g_dsk_write_work.resize((size_t)worksz * 2);
+  if (g_dsk_write_spaixi.size() < (size_t)spxisz) g_dsk_write_spaixi.resize((size_t)spxisz);
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = tspice_dsk_write_type2(
+      handle,
+      center,
+      surfid,
+      dclass,
+      frame.c_str(),
+      corsys,
+      corpar,
+      bounds,
+      nv,
+      vertices,
+      np,
+      plates,
+      finscl,
+      corscl,
+      worksz,
+      voxpsz,
+      voxlsz,
+      makvtl ? 1 : 0,
+      spxisz,
+      g_dsk_write_work.data(),
+      g_dsk_write_spaixi.data(),
+      err,
+      (int)sizeof(err));
+
+  if (g_dsk_write_work.size() + g_dsk_write_spaixi.size() > kRetainedDskWriteScratchInts) {
+    std::vector<int32_t>().swap(g_dsk_write_work);
+    std::vector<int32_t>().swap(g_dsk_write_spaixi);
+  }
+
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling dskWriteType2", err);
+  }
+}
+
 static Napi::Object Dlabfs(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -811,7 +1078,7 @@ static Napi::Object Dlabfs(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int32_t descr8[8] = {0};
   int32_t found = 0;
@@ -848,7 +1115,7 @@ static Napi::Object Dlafns(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int32_t nextDescr8[8] = {0};
   int32_t found = 0;
@@ -868,6 +1135,180 @@ static Napi::Object Dlafns(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// Longest DAF array name (`dafgn_c`), plus the terminator.
+static constexpr int kDafNameMaxBytes = 1001;
+
+// Opens `path` with `dafopr`, walks every array summary and closes it again, all under one lock.
+// Summaries are unpacked with the file's own `nd` / `ni`.
+static Napi::Value DafSummaries(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "dafSummaries(path: string) expects exactly one string argument"));
+    return env.Undefined();
+  }
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+  int nd = 0;
+  int ni = 0;
+  std::vector<double> doubles;
+  std::vector<int32_t> ints;
+  std::string names;
+  std::vector<int32_t> nameOffsets(1, 0);
+
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int handle = 0;
+    if (tspice_dafopr(path.c_str(), &handle, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling dafSummaries(\"") + PreviewForError(path) + "\")",
+          err);
+      return env.Undefined();
+    }
+
+    int code = tspice_dafhsf(handle, &nd, &ni, err, (int)sizeof(err));
+    if (code == 0) code = tspice_dafbfs(handle, err, (int)sizeof(err));
+
+    double dc[125];
+    int ic[250];
+    char name[kDafNameMaxBytes];
+    while (code == 0) {
+      int found = 0;
+      code = tspice_daffna(handle, &found, err, (int)sizeof(err));
+      if (code != 0 || !found) break;
+      code = tspice_dafgsu(handle, nd, ni, dc, ic, err, (int)sizeof(err));
+      if (code == 0) code = tspice_dafgn(handle, name, (int)sizeof(name), err, (int)sizeof(err));
+      if (code != 0) break;
+
+      doubles.insert(doubles.end(), dc, dc + nd);
+      ints.insert(ints.end(), ic, ic + ni);
+      names.append(name, std::strlen(name));
+      if (names.size() > (size_t)INT32_MAX) {
+        tspice_dafcls(handle, nullptr, 0);
+        ThrowSpiceError(Napi::RangeError::New(env, "dafSummaries(): names exceed 2 GiB"));
+        return env.Undefined();
+      }
+      nameOffsets.push_back((int32_t)names.size());
+    }
+
+    // Close even after a failure, without clobbering the error being reported.
+    if (code != 0) {
+      tspice_dafcls(handle, nullptr, 0);
+    } else {
+      code = tspice_dafcls(handle, err, (int)sizeof(err));
+    }
+    if (code != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling dafSummaries(\"") + PreviewForError(path) + "\")",
+          err);
+      return env.Undefined();
+    }
+  }
+
+  Napi::Float64Array doublesOut = Napi::Float64Array::New(env, doubles.size());
+  if (!doubles.empty()) std::memcpy(doublesOut.Data(), doubles.data(), doubles.size() * sizeof(double));
+  Napi::Int32Array intsOut = Napi::Int32Array::New(env, ints.size());
+  if (!ints.empty()) std::memcpy(intsOut.Data(), ints.data(), ints.size() * sizeof(int32_t));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("nd", Napi::Number::New(env, (double)nd));
+  result.Set("ni", Napi::Number::New(env, (double)ni));
+  result.Set("count", Napi::Number::New(env, (double)(nameOffsets.size() - 1)));
+  result.Set("doubles", doublesOut);
+  result.Set("ints", intsOut);
+  result.Set("names", MakePackedStrings(env, names, nameOffsets));
+  return result;
+}
+
+// Opens `path` with `dasopr`, walks every DLA segment descriptor and closes it again, all under one
+// lock. For DSK files each segment's DSK descriptor (`dskgd`) is read as well.
+static Napi::Value DlaDescriptors(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "dlaDescriptors(path: string) expects exactly one string argument"));
+    return env.Undefined();
+  }
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+  std::vector<int32_t> descrs;
+  std::vector<int32_t> dskInts;
+  std::vector<double> dskDoubles;
+  bool isDsk = false;
+
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    char arch[tspice_backend_node::kOutMaxBytes];
+    char type[tspice_backend_node::kOutMaxBytes];
+    int handle = 0;
+    if (tspice_getfat(path.c_str(), arch, (int)sizeof(arch), type, (int)sizeof(type), err, (int)sizeof(err)) != 0 ||
+        tspice_dasopr(path.c_str(), &handle, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling dlaDescriptors(\"") + PreviewForError(path) + "\")",
+          err);
+      return env.Undefined();
+    }
+    isDsk = std::strcmp(type, "DSK") == 0;
+
+    int32_t descr8[8] = {0};
+    int32_t found = 0;
+    int code = tspice_dlabfs(handle, descr8, &found, err, (int)sizeof(err));
+    while (code == 0 && found) {
+      descrs.insert(descrs.end(), descr8, descr8 + 8);
+      if (isDsk) {
+        int32_t ints6[6];
+        double doubles18[18];
+        code = tspice_dskgd(handle, descr8, ints6, doubles18, err, (int)sizeof(err));
+        if (code != 0) break;
+        dskInts.insert(dskInts.end(), ints6, ints6 + 6);
+        dskDoubles.insert(dskDoubles.end(), doubles18, doubles18 + 18);
+      }
+      int32_t next8[8] = {0};
+      code = tspice_dlafns(handle, descr8, next8, &found, err, (int)sizeof(err));
+      std::memcpy(descr8, next8, sizeof(descr8));
+    }
+
+    if (code != 0) {
+      tspice_dascls(handle, nullptr, 0);
+    } else {
+      code = tspice_dascls(handle, err, (int)sizeof(err));
+    }
+    if (code != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling dlaDescriptors(\"") + PreviewForError(path) + "\")",
+          err);
+      return env.Undefined();
+    }
+  }
+
+  Napi::Int32Array descrsOut = Napi::Int32Array::New(env, descrs.size());
+  if (!descrs.empty()) std::memcpy(descrsOut.Data(), descrs.data(), descrs.size() * sizeof(int32_t));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("count", Napi::Number::New(env, (double)(descrs.size() / 8)));
+  result.Set("descrs", descrsOut);
+  if (isDsk) {
+    Napi::Int32Array intsOut = Napi::Int32Array::New(env, dskInts.size());
+    if (!dskInts.empty()) std::memcpy(intsOut.Data(), dskInts.data(), dskInts.size() * sizeof(int32_t));
+    Napi::Float64Array doublesOut = Napi::Float64Array::New(env, dskDoubles.size());
+    if (!dskDoubles.empty()) {
+      std::memcpy(doublesOut.Data(), dskDoubles.data(), dskDoubles.size() * sizeof(double));
+    }
+    result.Set("dskInts", intsOut);
+    result.Set("dskDoubles", doublesOut);
+  } else {
+    result.Set("dskInts", env.Null());
+    result.Set("dskDoubles", env.Null());
+  }
+  return result;
+}
+
 namespace tspice_backend_node {
 
 void RegisterFileIo(Napi::Env env, Napi::Object exports) {
@@ -878,6 +1319,10 @@ void RegisterFileIo(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "dafcls", Napi::Function::New(env, Dafcls), __func__)) return;
   if (!SetExportChecked(env, exports, "dafbfs", Napi::Function::New(env, Dafbfs), __func__)) return;
   if (!SetExportChecked(env, exports, "daffna", Napi::Function::New(env, Daffna), __func__)) return;
+  if (!SetExportChecked(env, exports, "dafgda", Napi::Function::New(env, Dafgda), __func__)) return;
+  if (!SetExportChecked(env, exports, "setDafMmapEnabled", Napi::Function::New(env, SetDafMmapEnabled), __func__)) return;
+  if (!SetExportChecked(env, exports, "isDafMmapEnabled", Napi::Function::New(env, IsDafMmapEnabled), __func__)) return;
+  if (!SetExportChecked(env, exports, "mapOutputFile", Napi::Function::New(env, MapOutputFile), __func__)) return;
 
   if (!SetExportChecked(env, exports, "dasopr", Napi::Function::New(env, Dasopr), __func__)) return;
   if (!SetExportChecked(env, exports, "dascls", Napi::Function::New(env, Dascls), __func__)) return;
@@ -887,10 +1332,13 @@ void RegisterFileIo(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "dlaopn", Napi::Function::New(env, Dlaopn), __func__)) return;
   if (!SetExportChecked(env, exports, "dlabfs", Napi::Function::New(env, Dlabfs), __func__)) return;
   if (!SetExportChecked(env, exports, "dlafns", Napi::Function::New(env, Dlafns), __func__)) return;
+  if (!SetExportChecked(env, exports, "dafSummaries", Napi::Function::New(env, DafSummaries), __func__)) return;
+  if (!SetExportChecked(env, exports, "dlaDescriptors", Napi::Function::New(env, DlaDescriptors), __func__)) return;
 
   if (!SetExportChecked(env, exports, "dskopn", Napi::Function::New(env, Dskopn), __func__)) return;
   if (!SetExportChecked(env, exports, "dskmi2", Napi::Function::New(env, Dskmi2), __func__)) return;
   if (!SetExportChecked(env, exports, "dskw02", Napi::Function::New(env, Dskw02), __func__)) return;
+  if (!SetExportChecked(env, exports, "dskWriteType2", Napi::Function::New(env, DskWriteType2), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
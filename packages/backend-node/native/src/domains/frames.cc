@@ -2,21 +2,52 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "../addon_common.h"
 #include "../cell_handles.h"
+#include "../coverage_index.h"
+#include "../frame_cache.h"
+#include "../id_cache.h"
 #include "../napi_helpers.h"
+#include "../pool_generation.h"
+#include "../query_cache.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::MakeFound;
 using tspice_napi::MakeNotFound;
 using tspice_napi::MakeNumberArray;
+using tspice_napi::MakePackedStrings;
 using tspice_napi::PreviewForError;
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 
+static bool ReadInt32Checked(Napi::Env env, const Napi::Value& value, const char* what, int32_t* out) {
+  const std::string label = (what != nullptr && what[0] != '\0') ? std::string(what) : std::string("value");
+
+  if (!value.IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string("Expected ") + label + " to be a number"));
+    return false;
+  }
+
+  const double d = value.As<Napi::Number>().DoubleValue();
+  const double lo = (double)std::numeric_limits<int32_t>::min();
+  const double hi = (double)std::numeric_limits<int32_t>::max();
+  if (!std::isfinite(d) || std::floor(d) != d || d < lo || d > hi) {
+    ThrowSpiceError(
+        Napi::TypeError::New(env, std::string("Expected ") + label + " to be a 32-bit signed integer"));
+    return false;
+  }
+
+  if (out) {
+    *out = (int32_t)d;
+  }
+  return true;
+}
+
 static Napi::Object Namfrm(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -26,7 +57,7 @@ static Napi::Object Namfrm(const Napi::CallbackInfo& info) {
   }
 
   const std::string name = info[0].As<Napi::String>().Utf8Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   int codeOut = 0;
@@ -56,7 +87,7 @@ static Napi::Object Frmnam(const Napi::CallbackInfo& info) {
   }
 
   const int codeIn = info[0].As<Napi::Number>().Int32Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char nameOut[tspice_backend_node::kOutMaxBytes];
@@ -74,6 +105,56 @@ static Napi::Object Frmnam(const Napi::CallbackInfo& info) {
   return MakeFound<const char*>(env, "name", nameOut);
 }
 
+// First guess for `tspice_frame_table`; retried once with the exact count when more frames exist.
+static constexpr int kFrameTableInitialRoom = 1024;
+
+// Every named frame (built-in and kernel-pool), ascending by ID, as packed codes + names.
+static Napi::Value ExportFrameTable(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "exportFrameTable() expects no arguments"));
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const uint64_t generation = tspice_backend_node::PoolGeneration();
+
+  std::vector<int32_t> codes;
+  std::vector<char> names;
+  int total = 0;
+  for (int room = kFrameTableInitialRoom;; room = total) {
+    codes.assign((size_t)room, 0);
+    names.assign((size_t)room * TSPICE_FRNAME_MAX_BYTES, '\0');
+    if (tspice_frame_table(room, codes.data(), names.data(), TSPICE_FRNAME_MAX_BYTES, &total, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while listing frames", err);
+      return env.Undefined();
+    }
+    if (total <= room) break;
+  }
+  codes.resize((size_t)total);
+
+  std::string bytes;
+  std::vector<int32_t> offsets{0};
+  for (int i = 0; i < total; i++) {
+    const char* name = names.data() + (size_t)i * TSPICE_FRNAME_MAX_BYTES;
+    bytes.append(name, strnlen(name, TSPICE_FRNAME_MAX_BYTES));
+    offsets.push_back((int32_t)bytes.size());
+  }
+
+  Napi::Int32Array codesOut = Napi::Int32Array::New(env, codes.size());
+  if (!codes.empty()) {
+    std::memcpy(codesOut.Data(), codes.data(), codes.size() * sizeof(int32_t));
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("generation", Napi::Number::New(env, static_cast<double>(generation)));
+  result.Set("codes", codesOut);
+  result.Set("names", MakePackedStrings(env, bytes, offsets));
+  return result;
+}
+
 static Napi::Object Cidfrm(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -83,7 +164,7 @@ static Napi::Object Cidfrm(const Napi::CallbackInfo& info) {
   }
 
   const int center = info[0].As<Napi::Number>().Int32Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char frname[tspice_backend_node::kOutMaxBytes];
@@ -115,7 +196,7 @@ static Napi::Object Cnmfrm(const Napi::CallbackInfo& info) {
   }
 
   const std::string centerName = info[0].As<Napi::String>().Utf8Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char frname[tspice_backend_node::kOutMaxBytes];
@@ -157,7 +238,7 @@ static Napi::Object Frinfo(const Napi::CallbackInfo& info) {
   }
 
   const int frameId = info[0].As<Napi::Number>().Int32Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   int center = 0;
@@ -193,7 +274,7 @@ static Napi::Object Ccifrm(const Napi::CallbackInfo& info) {
   const int frameClass = info[0].As<Napi::Number>().Int32Value();
   const int classId = info[1].As<Napi::Number>().Int32Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char frname[tspice_backend_node::kOutMaxBytes];
@@ -241,15 +322,27 @@ static Napi::Array Pxform(const Napi::CallbackInfo& info) {
   const std::string to = info[1].As<Napi::String>().Utf8Value();
   const double et = info[2].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  const bool memo = tspice_backend_node::QueryCacheEnabled();
+  tspice_backend_node::QueryKey key(tspice_backend_node::QueryKind::kPxform);
+  if (memo) {
+    key.Add(from).Add(to).Add(et);
+    std::vector<double> cached;
+    if (tspice_backend_node::QueryCacheLookup(key, &cached)) {
+      return MakeNumberArray(env, cached.data(), cached.size());
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double m[9] = {0};
-  const int code = tspice_pxform(from.c_str(), to.c_str(), et, m, err, (int)sizeof(err));
+  const int code =
+      tspice_backend_node::CachedPxform(from.c_str(), to.c_str(), et, m, err, (int)sizeof(err));
   if (code != 0) {
     ThrowSpiceError(env, "CSPICE failed while calling pxform", err);
     return Napi::Array::New(env);
   }
 
+  if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), m, 9);
   return MakeNumberArray(env, m, 9);
 }
 
@@ -267,18 +360,336 @@ static Napi::Array Sxform(const Napi::CallbackInfo& info) {
   const std::string to = info[1].As<Napi::String>().Utf8Value();
   const double et = info[2].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  const bool memo = tspice_backend_node::QueryCacheEnabled();
+  tspice_backend_node::QueryKey key(tspice_backend_node::QueryKind::kSxform);
+  if (memo) {
+    key.Add(from).Add(to).Add(et);
+    std::vector<double> cached;
+    if (tspice_backend_node::QueryCacheLookup(key, &cached)) {
+      return MakeNumberArray(env, cached.data(), cached.size());
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double m[36] = {0};
-  const int code = tspice_sxform(from.c_str(), to.c_str(), et, m, err, (int)sizeof(err));
+  const int code =
+      tspice_backend_node::CachedSxform(from.c_str(), to.c_str(), et, m, err, (int)sizeof(err));
   if (code != 0) {
     ThrowSpiceError(env, "CSPICE failed while calling sxform", err);
     return Napi::Array::New(env);
   }
 
+  if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), m, 36);
   return MakeNumberArray(env, m, 36);
 }
 
+using FrameXformIntoFn = int (*)(const char*, const char*, double, double*, char*, int);
+
+// Shared body for `pxformInto` / `sxformInto`: writes the row-major transform into a caller-owned
+// `Float64Array` instead of allocating a boxed JS array per call.
+//
+// With `reportStatus` (`pxformIntoStatus` / `sxformIntoStatus`) a CSPICE failure is returned as its
+// `TSPICE_ERROR_*` class instead of thrown, without formatting a message (see `SpkInto`).
+static Napi::Value FrameXformInto(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    size_t outLength,
+    FrameXformIntoFn fn,
+    bool reportStatus = false) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 4 || !info[0].IsString() || !info[1].IsString() || !info[2].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(from: string, to: string, et: number, out: Float64Array) expects (string, string, number, Float64Array)"));
+    return env.Undefined();
+  }
+
+  const std::string from = info[0].As<Napi::String>().Utf8Value();
+  const std::string to = info[1].As<Napi::String>().Utf8Value();
+  const double et = info[2].As<Napi::Number>().DoubleValue();
+
+  double* out = nullptr;
+  if (!tspice_napi::ReadFloat64ArrayOut(env, info[3], outLength, &out, "out")) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  if (reportStatus) {
+    const int code = fn(from.c_str(), to.c_str(), et, out, nullptr, 0);
+    return Napi::Number::New(env, code == 0 ? TSPICE_ERROR_NONE : tspice_last_error_class());
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = fn(from.c_str(), to.c_str(), et, out, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+  }
+  return env.Undefined();
+}
+
+static Napi::Value PxformInto(const Napi::CallbackInfo& info) {
+  return FrameXformInto(info, "pxformInto", 9, tspice_backend_node::CachedPxform);
+}
+
+static Napi::Value SxformInto(const Napi::CallbackInfo& info) {
+  return FrameXformInto(info, "sxformInto", 36, tspice_backend_node::CachedSxform);
+}
+
+static Napi::Value PxformIntoStatus(const Napi::CallbackInfo& info) {
+  return FrameXformInto(info, "pxformIntoStatus", 9, tspice_backend_node::CachedPxform, true);
+}
+
+static Napi::Value SxformIntoStatus(const Napi::CallbackInfo& info) {
+  return FrameXformInto(info, "sxformIntoStatus", 36, tspice_backend_node::CachedSxform, true);
+}
+
+// Shared body for `tryPxform` / `trySxform`: a coverage gap (e.g. no CK data at `et`) is
+// `{ found: false }` instead of a thrown error, reported through the shim's message-free failure
+// path. Frame chains have no addon-side coverage index to consult first (CK frames depend on SCLK
+// conversion and frame-kernel lookups), so unlike `trySpkezr` every miss still enters CSPICE.
+// Every other failure still throws.
+static Napi::Object TryFrameXform(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    size_t outLength,
+    FrameXformIntoFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3 || !info[0].IsString() || !info[1].IsString() || !info[2].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) + "(from: string, to: string, et: number) expects (string, string, number)"));
+    return Napi::Object::New(env);
+  }
+
+  const std::string from = info[0].As<Napi::String>().Utf8Value();
+  const std::string to = info[1].As<Napi::String>().Utf8Value();
+  const double et = info[2].As<Napi::Number>().DoubleValue();
+
+  tspice_backend_node::CspiceLock lock;
+  double m[36] = {0};
+  const int code = fn(from.c_str(), to.c_str(), et, m, nullptr, 0);
+  if (code != 0) {
+    if (tspice_last_error_class() == TSPICE_ERROR_COVERAGE_GAP) {
+      return MakeNotFound(env);
+    }
+    char err[tspice_backend_node::kErrMaxBytes];
+    tspice_format_last_error(err, (int)sizeof(err));
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+    return Napi::Object::New(env);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("found", Napi::Boolean::New(env, true));
+  result.Set("value", MakeNumberArray(env, m, outLength));
+  return result;
+}
+
+static Napi::Object TryPxform(const Napi::CallbackInfo& info) {
+  return TryFrameXform(info, "tryPxform", 9, tspice_backend_node::CachedPxform);
+}
+
+static Napi::Object TrySxform(const Napi::CallbackInfo& info) {
+  return TryFrameXform(info, "trySxform", 36, tspice_backend_node::CachedSxform);
+}
+
+// `pxformId` / `pxformIdInto`: frame-ID variants of `pxform` / `pxformInto` for callers that
+// resolved their frames once via `internFrame`. The names come from the addon's ID cache, so a hot
+// loop passes numbers only.
+static bool ReadFrameIdPair(
+    const Napi::CallbackInfo& info,
+    const char* signature,
+    size_t expectedArgs,
+    int32_t* fromId,
+    int32_t* toId,
+    double* et) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != expectedArgs || !info[0].IsNumber() || !info[1].IsNumber() || !info[2].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(signature) + " expects " + std::to_string(expectedArgs) + " arguments"));
+    return false;
+  }
+  if (!ReadInt32Checked(env, info[0], "fromId", fromId) || !ReadInt32Checked(env, info[1], "toId", toId)) {
+    return false;
+  }
+  *et = info[2].As<Napi::Number>().DoubleValue();
+  return true;
+}
+
+static bool PxformIdLocked(Napi::Env env, const char* name, int fromId, int toId, double et, double* out) {
+  char from[TSPICE_FRNAME_MAX_BYTES];
+  char to[TSPICE_FRNAME_MAX_BYTES];
+  if (!tspice_backend_node::ResolveFrameNameOrThrow(env, fromId, from, name) ||
+      !tspice_backend_node::ResolveFrameNameOrThrow(env, toId, to, name)) {
+    return false;
+  }
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = tspice_backend_node::CachedPxform(from, to, et, out, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name, err);
+    return false;
+  }
+  return true;
+}
+
+static Napi::Value PxformId(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  int32_t fromId = 0;
+  int32_t toId = 0;
+  double et = 0.0;
+  if (!ReadFrameIdPair(info, "pxformId(fromId: number, toId: number, et: number)", 3, &fromId, &toId, &et)) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  double m[9] = {0};
+  if (!PxformIdLocked(env, "pxformId", fromId, toId, et, m)) {
+    return env.Undefined();
+  }
+  return MakeNumberArray(env, m, 9);
+}
+
+static Napi::Value PxformIdInto(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  int32_t fromId = 0;
+  int32_t toId = 0;
+  double et = 0.0;
+  if (!ReadFrameIdPair(
+          info, "pxformIdInto(fromId: number, toId: number, et: number, out: Float64Array)", 4,
+          &fromId, &toId, &et)) {
+    return env.Undefined();
+  }
+
+  double* out = nullptr;
+  if (!tspice_napi::ReadFloat64ArrayOut(env, info[3], 9, &out, "out")) {
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  PxformIdLocked(env, "pxformIdInto", fromId, toId, et, out);
+  return env.Undefined();
+}
+
+using FrameXformBatchFn = int (*)(const char*, const char*, const double*, int, double*, int*, char*, int);
+
+// Shared body for `transformVectors` / `transformStates`: computes one transform per epoch under
+// the CSPICE lock, then applies it to a packed buffer of `dim`-vectors after releasing the lock
+// (the matrix products don't touch CSPICE state). Vectors are grouped epoch-major, so with `n`
+// epochs and `k` vectors each epoch owns `k / n` consecutive rows.
+static Napi::Value TransformVectorsImpl(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    size_t dim,
+    FrameXformBatchFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 4 || info.Length() > 5 || !info[0].IsString() || !info[1].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(from: string, to: string, ets: Float64Array, vecs: Float64Array, out?: Float64Array) expects (string, string, Float64Array, Float64Array, Float64Array?)"));
+    return env.Undefined();
+  }
+
+  const double* ets = nullptr;
+  size_t n = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[2], &ets, &n, "ets")) {
+    return env.Undefined();
+  }
+  const double* vecs = nullptr;
+  size_t length = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[3], &vecs, &length, "vecs")) {
+    return env.Undefined();
+  }
+
+  const size_t count = length / dim;
+  if (length % dim != 0 || (n == 0 && count != 0) || (n != 0 && count % n != 0)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        std::string(name) + "(): vecs.length must be " + std::to_string(dim) +
+            " * ets.length * k (got vecs.length=" + std::to_string(length) +
+            ", ets.length=" + std::to_string(n) + ")"));
+    return env.Undefined();
+  }
+  if (n > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): ets is too long"));
+    return env.Undefined();
+  }
+
+  Napi::Float64Array out;
+  if (info.Length() == 5 && !info[4].IsUndefined()) {
+    double* outData = nullptr;
+    if (!tspice_napi::ReadFloat64ArrayOut(env, info[4], length, &outData, "out")) {
+      return env.Undefined();
+    }
+    out = info[4].As<Napi::Float64Array>();
+  } else {
+    out = Napi::Float64Array::New(env, length);
+    if (env.IsExceptionPending()) return env.Undefined();
+  }
+  if (count == 0) {
+    return out;
+  }
+
+  const std::string from = info[0].As<Napi::String>().Utf8Value();
+  const std::string to = info[1].As<Napi::String>().Utf8Value();
+
+  std::vector<double> matrices(n * dim * dim);
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    const int code = fn(from.c_str(), to.c_str(), ets, (int)n, matrices.data(), &failedIndex, err, (int)sizeof(err));
+    if (code != 0) {
+      std::string context = std::string("CSPICE failed while calling ") + name;
+      if (failedIndex >= 0) {
+        context += "(ets[" + std::to_string(failedIndex) + "])";
+      }
+      ThrowSpiceError(env, context, err, name, [&](Napi::Object& obj) {
+        if (failedIndex >= 0) {
+          obj.Set("index", Napi::Number::New(env, failedIndex));
+        }
+      });
+      return env.Undefined();
+    }
+  }
+
+  // `out` may alias `vecs`, so each row is copied before it is overwritten.
+  double* dst = out.Data();
+  const size_t perEpoch = count / n;
+  double row[6];
+  for (size_t e = 0; e < n; e++) {
+    const double* m = &matrices[e * dim * dim];
+    for (size_t v = e * perEpoch; v < (e + 1) * perEpoch; v++) {
+      const double* src = vecs + v * dim;
+      for (size_t j = 0; j < dim; j++) row[j] = src[j];
+      double* o = dst + v * dim;
+      for (size_t i = 0; i < dim; i++) {
+        // Same summation order as CSPICE's `mxv_c` / `mxvg_c`, so results match bit-for-bit.
+        double acc = m[i * dim] * row[0];
+        for (size_t j = 1; j < dim; j++) acc += m[i * dim + j] * row[j];
+        o[i] = acc;
+      }
+    }
+  }
+
+  return out;
+}
+
+static Napi::Value TransformVectors(const Napi::CallbackInfo& info) {
+  return TransformVectorsImpl(info, "transformVectors", 3, tspice_pxform_batch);
+}
+
+static Napi::Value TransformStates(const Napi::CallbackInfo& info) {
+  return TransformVectorsImpl(info, "transformStates", 6, tspice_sxform_batch);
+}
+
 // --- CK file query / management --------------------------------------------
 
 static Napi::Number Cklpf(const Napi::CallbackInfo& info) {
@@ -295,6 +706,8 @@ static Napi::Number Cklpf(const Napi::CallbackInfo& info) {
   char err[tspice_backend_node::kErrMaxBytes];
   int handle = 0;
   const int code = tspice_cklpf(ck.c_str(), &handle, err, (int)sizeof(err));
+  // Loaded CK segments change frame transformations, so memoized results must be recomputed.
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -331,6 +744,7 @@ static void Ckupf(const Napi::CallbackInfo& info) {
 
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_ckupf(handle, err, (int)sizeof(err));
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
   if (code != 0) {
     ThrowSpiceError(env, "CSPICE failed while calling ckupf", err);
   }
@@ -416,11 +830,86 @@ static void Ckcov(const Napi::CallbackInfo& info) {
   }
 }
 
+static Napi::Value CkobjIds(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "ckobjIds(ck: string) expects exactly one string argument"));
+    return env.Undefined();
+  }
+
+  const std::string ck = info[0].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  std::vector<int> ids;
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_backend_node::CoverageIndexCkObjects(ck, &ids, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling ckobjIds", err);
+    return env.Undefined();
+  }
+
+  return tspice_backend_node::IdsToInt32Array(env, ids);
+}
+
+static Napi::Value CkcovIntervals(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 6 || !info[0].IsString() || !info[1].IsNumber() || !info[2].IsBoolean() ||
+      !info[3].IsString() || !info[4].IsNumber() || !info[5].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "ckcovIntervals(ck: string, idcode: number, needav: boolean, level: string, tol: number, timsys: string) expects 6 args"));
+    return env.Undefined();
+  }
+
+  const std::string ck = info[0].As<Napi::String>().Utf8Value();
+  const int idcode = info[1].As<Napi::Number>().Int32Value();
+  const bool needav = info[2].As<Napi::Boolean>().Value();
+  const std::string level = info[3].As<Napi::String>().Utf8Value();
+  const double tol = info[4].As<Napi::Number>().DoubleValue();
+  const std::string timsys = info[5].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  std::vector<double> intervals;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = tspice_backend_node::CoverageIndexCkCoverage(
+      ck, idcode, needav, level, tol, timsys, &intervals, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling ckcovIntervals", err);
+    return env.Undefined();
+  }
+
+  return tspice_backend_node::IntervalsToFloat64Array(env, intervals);
+}
+
+static Napi::Object FrameCacheStatsJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "frameCacheStats() does not take any arguments"));
+    return Napi::Object::New(env);
+  }
+
+  tspice_backend_node::FrameCacheStats stats;
+  {
+    tspice_backend_node::CspiceLock lock;
+    stats = tspice_backend_node::GetFrameCacheStats();
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("fixedChains", Napi::Number::New(env, stats.fixedChains));
+  result.Set("recent", Napi::Number::New(env, stats.recent));
+  result.Set("hits", Napi::Number::New(env, stats.hits));
+  result.Set("misses", Napi::Number::New(env, stats.misses));
+  return result;
+}
+
 namespace tspice_backend_node {
 
 void RegisterFrames(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "namfrm", Napi::Function::New(env, Namfrm), __func__)) return;
   if (!SetExportChecked(env, exports, "frmnam", Napi::Function::New(env, Frmnam), __func__)) return;
+  if (!SetExportChecked(env, exports, "exportFrameTable", Napi::Function::New(env, ExportFrameTable), __func__)) return;
   if (!SetExportChecked(env, exports, "cidfrm", Napi::Function::New(env, Cidfrm), __func__)) return;
   if (!SetExportChecked(env, exports, "cnmfrm", Napi::Function::New(env, Cnmfrm), __func__)) return;
   if (!SetExportChecked(env, exports, "frinfo", Napi::Function::New(env, Frinfo), __func__)) return;
@@ -431,9 +920,22 @@ void RegisterFrames(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "ckupf", Napi::Function::New(env, Ckupf), __func__)) return;
   if (!SetExportChecked(env, exports, "ckobj", Napi::Function::New(env, Ckobj), __func__)) return;
   if (!SetExportChecked(env, exports, "ckcov", Napi::Function::New(env, Ckcov), __func__)) return;
+  if (!SetExportChecked(env, exports, "ckobjIds", Napi::Function::New(env, CkobjIds), __func__)) return;
+  if (!SetExportChecked(env, exports, "ckcovIntervals", Napi::Function::New(env, CkcovIntervals), __func__)) return;
 
   if (!SetExportChecked(env, exports, "pxform", Napi::Function::New(env, Pxform), __func__)) return;
   if (!SetExportChecked(env, exports, "sxform", Napi::Function::New(env, Sxform), __func__)) return;
+  if (!SetExportChecked(env, exports, "pxformInto", Napi::Function::New(env, PxformInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "sxformInto", Napi::Function::New(env, SxformInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "pxformIntoStatus", Napi::Function::New(env, PxformIntoStatus), __func__)) return;
+  if (!SetExportChecked(env, exports, "sxformIntoStatus", Napi::Function::New(env, SxformIntoStatus), __func__)) return;
+  if (!SetExportChecked(env, exports, "tryPxform", Napi::Function::New(env, TryPxform), __func__)) return;
+  if (!SetExportChecked(env, exports, "trySxform", Napi::Function::New(env, TrySxform), __func__)) return;
+  if (!SetExportChecked(env, exports, "pxformId", Napi::Function::New(env, PxformId), __func__)) return;
+  if (!SetExportChecked(env, exports, "pxformIdInto", Napi::Function::New(env, PxformIdInto), __func__)) return;
+  if (!SetExportChecked(env, exports, "transformVectors", Napi::Function::New(env, TransformVectors), __func__)) return;
+  if (!SetExportChecked(env, exports, "transformStates", Napi::Function::New(env, TransformStates), __func__)) return;
+  if (!SetExportChecked(env, exports, "frameCacheStats", Napi::Function::New(env, FrameCacheStatsJs), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
@@ -1,9 +1,14 @@
 #include "geometry.h"
 
+#include <algorithm>
+#include <climits>
 #include <string>
+#include <vector>
 
 #include "../addon_common.h"
 #include "../napi_helpers.h"
+#include "../pool_generation.h"
+#include "../query_cache.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::MakeNotFound;
@@ -11,6 +16,15 @@ using tspice_napi::MakeNumberArray;
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 
+// `out` is [spoint(3), trgepc, srfvec(3)].
+static Napi::Object MakeSubpntResult(Napi::Env env, const double* out) {
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("spoint", MakeNumberArray(env, out, 3));
+  result.Set("trgepc", Napi::Number::New(env, out[3]));
+  result.Set("srfvec", MakeNumberArray(env, out + 4, 3));
+  return result;
+}
+
 static Napi::Object Subpnt(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -29,11 +43,20 @@ static Napi::Object Subpnt(const Napi::CallbackInfo& info) {
   const std::string abcorr = info[4].As<Napi::String>().Utf8Value();
   const std::string observer = info[5].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  double out[7] = {0};
+  const bool memo = tspice_backend_node::QueryCacheEnabled();
+  tspice_backend_node::QueryKey key(tspice_backend_node::QueryKind::kSubpnt);
+  if (memo) {
+    key.Add(method).Add(target).Add(et).Add(fixref).Add(abcorr).Add(observer);
+    std::vector<double> cached;
+    if (tspice_backend_node::QueryCacheLookup(key, &cached)) {
+      std::copy(cached.begin(), cached.end(), out);
+      return MakeSubpntResult(env, out);
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
-  double spoint[3] = {0};
-  double trgepc = 0.0;
-  double srfvec[3] = {0};
   const int code = tspice_subpnt(
       method.c_str(),
       target.c_str(),
@@ -41,9 +64,9 @@ static Napi::Object Subpnt(const Napi::CallbackInfo& info) {
       fixref.c_str(),
       abcorr.c_str(),
       observer.c_str(),
-      spoint,
-      &trgepc,
-      srfvec,
+      out,
+      &out[3],
+      &out[4],
       err,
       (int)sizeof(err));
   if (code != 0) {
@@ -51,11 +74,8 @@ static Napi::Object Subpnt(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  Napi::Object result = Napi::Object::New(env);
-  result.Set("spoint", MakeNumberArray(env, spoint, 3));
-  result.Set("trgepc", Napi::Number::New(env, trgepc));
-  result.Set("srfvec", MakeNumberArray(env, srfvec, 3));
-  return result;
+  if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), out, 7);
+  return MakeSubpntResult(env, out);
 }
 
 static Napi::Object Subslr(const Napi::CallbackInfo& info) {
@@ -76,7 +96,7 @@ static Napi::Object Subslr(const Napi::CallbackInfo& info) {
   const std::string abcorr = info[4].As<Napi::String>().Utf8Value();
   const std::string observer = info[5].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double spoint[3] = {0};
   double trgepc = 0.0;
@@ -130,7 +150,7 @@ static Napi::Object Sincpt(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double spoint[3] = {0};
   double trgepc = 0.0;
@@ -191,7 +211,7 @@ static Napi::Object Ilumin(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double trgepc = 0.0;
   double srfvec[3] = {0};
@@ -252,7 +272,7 @@ static Napi::Object Illumg(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double trgepc = 0.0;
   double srfvec[3] = {0};
@@ -314,7 +334,7 @@ static Napi::Object Illumf(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double trgepc = 0.0;
   double srfvec[3] = {0};
@@ -357,6 +377,219 @@ static Napi::Object Illumf(const Napi::CallbackInfo& info) {
   return result;
 }
 
+// Reads a packed `Float64Array` of 3-vectors for the `*Batch` entrypoints.
+static bool ReadPackedVec3s(
+    Napi::Env env,
+    const Napi::Value& value,
+    const char* name,
+    const char* what,
+    const double** out,
+    int* n) {
+  size_t length = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, value, out, &length, what)) {
+    return false;
+  }
+  if (length % 3 != 0 || length / 3 > static_cast<size_t>(INT_MAX)) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        std::string(name) + "(): " + what + ".length must be a multiple of 3 (got " + std::to_string(length) + ")"));
+    return false;
+  }
+  *n = static_cast<int>(length / 3);
+  return true;
+}
+
+static void ThrowBatchError(Napi::Env env, const char* name, const char* what, int failedIndex, const char* err) {
+  std::string context = std::string("CSPICE failed while calling ") + name;
+  if (failedIndex >= 0) {
+    context += "(" + std::string(what) + "[" + std::to_string(failedIndex) + "])";
+  }
+  ThrowSpiceError(env, context, err, name, [&](Napi::Object& obj) {
+    if (failedIndex >= 0) {
+      obj.Set("index", Napi::Number::New(env, failedIndex));
+    }
+  });
+}
+
+// `sincptBatch`: one observer, one epoch, many rays (footprints, pixel back-projection).
+static Napi::Object SincptBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 8 || !info[0].IsString() || !info[1].IsString() || !info[2].IsNumber() ||
+      !info[3].IsString() || !info[4].IsString() || !info[5].IsString() || !info[6].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "sincptBatch(method: string, target: string, et: number, fixref: string, abcorr: string, observer: string, dref: string, dirs: Float64Array) expects (string, string, number, string, string, string, string, Float64Array)"));
+    return Napi::Object::New(env);
+  }
+
+  const double* dirs = nullptr;
+  int n = 0;
+  if (!ReadPackedVec3s(env, info[7], "sincptBatch", "dirs", &dirs, &n)) {
+    return Napi::Object::New(env);
+  }
+
+  const std::string method = info[0].As<Napi::String>().Utf8Value();
+  const std::string target = info[1].As<Napi::String>().Utf8Value();
+  const double et = info[2].As<Napi::Number>().DoubleValue();
+  const std::string fixref = info[3].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[4].As<Napi::String>().Utf8Value();
+  const std::string observer = info[5].As<Napi::String>().Utf8Value();
+  const std::string dref = info[6].As<Napi::String>().Utf8Value();
+
+  Napi::Float64Array spoints = Napi::Float64Array::New(env, (size_t)n * 3);
+  Napi::Float64Array trgepcs = Napi::Float64Array::New(env, (size_t)n);
+  Napi::Float64Array srfvecs = Napi::Float64Array::New(env, (size_t)n * 3);
+  Napi::Uint8Array found = Napi::Uint8Array::New(env, ((size_t)n + 7) / 8);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (n > 0) {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    const int code = tspice_sincpt_batch(
+        method.c_str(),
+        target.c_str(),
+        et,
+        fixref.c_str(),
+        abcorr.c_str(),
+        observer.c_str(),
+        dref.c_str(),
+        dirs,
+        n,
+        spoints.Data(),
+        trgepcs.Data(),
+        srfvecs.Data(),
+        found.Data(),
+        &failedIndex,
+        err,
+        (int)sizeof(err));
+    if (code != 0) {
+      ThrowBatchError(env, "sincptBatch", "dirs", failedIndex, err);
+      return Napi::Object::New(env);
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("spoints", spoints);
+  result.Set("trgepcs", trgepcs);
+  result.Set("srfvecs", srfvecs);
+  result.Set("found", found);
+  return result;
+}
+
+// Shared implementation for `iluminBatch` / `illumfBatch` (`withSource`: illumf with `ilusrc`
+// and the visibility/lighting flags).
+static Napi::Object IllumBatch(const Napi::CallbackInfo& info, const char* name, bool withSource) {
+  Napi::Env env = info.Env();
+
+  const size_t argc = withSource ? 8 : 7;
+  const size_t etIndex = withSource ? 3 : 2;
+  bool ok = info.Length() == argc && info[etIndex].IsNumber();
+  for (size_t i = 0; ok && i + 1 < argc; i++) {
+    if (i != etIndex && !info[i].IsString()) ok = false;
+  }
+  if (!ok) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        withSource
+            ? "illumfBatch(method: string, target: string, ilusrc: string, et: number, fixref: string, abcorr: string, observer: string, spoints: Float64Array) expects (string, string, string, number, string, string, string, Float64Array)"
+            : "iluminBatch(method: string, target: string, et: number, fixref: string, abcorr: string, observer: string, spoints: Float64Array) expects (string, string, number, string, string, string, Float64Array)"));
+    return Napi::Object::New(env);
+  }
+
+  const double* spoints = nullptr;
+  int n = 0;
+  if (!ReadPackedVec3s(env, info[argc - 1], name, "spoints", &spoints, &n)) {
+    return Napi::Object::New(env);
+  }
+
+  const std::string method = info[0].As<Napi::String>().Utf8Value();
+  const std::string target = info[1].As<Napi::String>().Utf8Value();
+  const std::string ilusrc = withSource ? info[2].As<Napi::String>().Utf8Value() : std::string();
+  const double et = info[etIndex].As<Napi::Number>().DoubleValue();
+  const std::string fixref = info[etIndex + 1].As<Napi::String>().Utf8Value();
+  const std::string abcorr = info[etIndex + 2].As<Napi::String>().Utf8Value();
+  const std::string observer = info[etIndex + 3].As<Napi::String>().Utf8Value();
+
+  Napi::Float64Array trgepcs = Napi::Float64Array::New(env, (size_t)n);
+  Napi::Float64Array srfvecs = Napi::Float64Array::New(env, (size_t)n * 3);
+  Napi::Float64Array phase = Napi::Float64Array::New(env, (size_t)n);
+  Napi::Float64Array incdnc = Napi::Float64Array::New(env, (size_t)n);
+  Napi::Float64Array emissn = Napi::Float64Array::New(env, (size_t)n);
+  Napi::Uint8Array visibl = Napi::Uint8Array::New(env, withSource ? (size_t)n : 0);
+  Napi::Uint8Array lit = Napi::Uint8Array::New(env, withSource ? (size_t)n : 0);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (n > 0) {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    const int code = withSource
+        ? tspice_illumf_batch(
+              method.c_str(),
+              target.c_str(),
+              ilusrc.c_str(),
+              et,
+              fixref.c_str(),
+              abcorr.c_str(),
+              observer.c_str(),
+              spoints,
+              n,
+              trgepcs.Data(),
+              srfvecs.Data(),
+              phase.Data(),
+              incdnc.Data(),
+              emissn.Data(),
+              visibl.Data(),
+              lit.Data(),
+              &failedIndex,
+              err,
+              (int)sizeof(err))
+        : tspice_ilumin_batch(
+              method.c_str(),
+              target.c_str(),
+              et,
+              fixref.c_str(),
+              abcorr.c_str(),
+              observer.c_str(),
+              spoints,
+              n,
+              trgepcs.Data(),
+              srfvecs.Data(),
+              phase.Data(),
+              incdnc.Data(),
+              emissn.Data(),
+              &failedIndex,
+              err,
+              (int)sizeof(err));
+    if (code != 0) {
+      ThrowBatchError(env, name, "spoints", failedIndex, err);
+      return Napi::Object::New(env);
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("trgepcs", trgepcs);
+  result.Set("srfvecs", srfvecs);
+  result.Set("phase", phase);
+  result.Set("incdnc", incdnc);
+  result.Set("emissn", emissn);
+  if (withSource) {
+    result.Set("visibl", visibl);
+    result.Set("lit", lit);
+  }
+  return result;
+}
+
+static Napi::Object IluminBatch(const Napi::CallbackInfo& info) {
+  return IllumBatch(info, "iluminBatch", false);
+}
+
+static Napi::Object IllumfBatch(const Napi::CallbackInfo& info) {
+  return IllumBatch(info, "illumfBatch", true);
+}
+
 static Napi::Array Nvc2pl(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -371,7 +604,7 @@ static Napi::Array Nvc2pl(const Napi::CallbackInfo& info) {
   }
   const double konst = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double plane[4] = {0};
   const int code = tspice_nvc2pl(normal, konst, plane, err, (int)sizeof(err));
@@ -396,7 +629,7 @@ static Napi::Object Pl2nvc(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double normal[3] = {0};
   double konst = 0.0;
@@ -434,7 +667,7 @@ static Napi::Number Occult(const Napi::CallbackInfo& info) {
   const std::string observer = info[7].As<Napi::String>().Utf8Value();
   const double et = info[8].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int ocltid = 0;
   const int code = tspice_occult(
@@ -458,6 +691,107 @@ static Napi::Number Occult(const Napi::CallbackInfo& info) {
   return Napi::Number::New(env, static_cast<double>(ocltid));
 }
 
+// `occultBatch`: many (targ1, targ2, observer) triples over one epoch grid. Codes are packed
+// triple-major (`codes[t * ets.length + e]`). With `transitions`, also returns the run-length
+// encoding of each triple's code sequence: runs `[offsets[t], offsets[t + 1])` of
+// `runStarts` / `runCodes`, the first run of each triple starting at epoch 0.
+static Napi::Object OccultBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 10 || !info[7].IsString() || !info[9].IsBoolean()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "occultBatch(targ1s: string[], shape1s: string[], frame1s: string[], targ2s: string[], shape2s: string[], frame2s: string[], observers: string[], abcorr: string, ets: Float64Array, transitions: boolean) expects (string[] x7, string, Float64Array, boolean)"));
+    return Napi::Object::New(env);
+  }
+
+  static const char* const kFields[7] = {"targ1s", "shape1s", "frame1s", "targ2s", "shape2s", "frame2s", "observers"};
+  tspice_napi::JsStringArrayArg fields[7];
+  for (int i = 0; i < 7; i++) {
+    if (!tspice_napi::ReadStringArray(env, info[i], &fields[i], kFields[i])) return Napi::Object::New(env);
+    if (fields[i].ptrs.size() != fields[0].ptrs.size()) {
+      ThrowSpiceError(Napi::RangeError::New(
+          env, std::string("occultBatch(): ") + kFields[i] + ".length must equal targ1s.length"));
+      return Napi::Object::New(env);
+    }
+  }
+  const std::string abcorr = info[7].As<Napi::String>().Utf8Value();
+  const double* ets = nullptr;
+  size_t nEts = 0;
+  if (!tspice_napi::ReadFloat64ArrayArg(env, info[8], &ets, &nEts, "ets")) return Napi::Object::New(env);
+  const bool withTransitions = info[9].As<Napi::Boolean>().Value();
+
+  const size_t nTriples = fields[0].ptrs.size();
+  if (nEts > 0 && nTriples > (size_t)INT_MAX / nEts) {
+    ThrowSpiceError(Napi::RangeError::New(env, "occultBatch(): targ1s.length * ets.length is too large"));
+    return Napi::Object::New(env);
+  }
+
+  Napi::Int8Array codes = Napi::Int8Array::New(env, nTriples * nEts);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+
+  if (nTriples > 0 && nEts > 0) {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    int failedIndex = -1;
+    const int code = tspice_occult_batch(
+        fields[0].ptrs.data(),
+        fields[1].ptrs.data(),
+        fields[2].ptrs.data(),
+        fields[3].ptrs.data(),
+        fields[4].ptrs.data(),
+        fields[5].ptrs.data(),
+        fields[6].ptrs.data(),
+        (int)nTriples,
+        abcorr.c_str(),
+        ets,
+        (int)nEts,
+        reinterpret_cast<signed char*>(codes.Data()),
+        &failedIndex,
+        err,
+        (int)sizeof(err));
+    if (code != 0) {
+      ThrowBatchError(env, "occultBatch", "codes", failedIndex, err);
+      return Napi::Object::New(env);
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("codes", codes);
+  if (!withTransitions) {
+    return result;
+  }
+
+  const int8_t* c = codes.Data();
+  size_t nRuns = 0;
+  for (size_t t = 0; t < nTriples; t++) {
+    for (size_t e = 0; e < nEts; e++) {
+      if (e == 0 || c[t * nEts + e] != c[t * nEts + e - 1]) nRuns++;
+    }
+  }
+  Napi::Int32Array offsets = Napi::Int32Array::New(env, nTriples + 1);
+  Napi::Int32Array runStarts = Napi::Int32Array::New(env, nRuns);
+  Napi::Int8Array runCodes = Napi::Int8Array::New(env, nRuns);
+  if (env.IsExceptionPending()) return Napi::Object::New(env);
+  size_t run = 0;
+  for (size_t t = 0; t < nTriples; t++) {
+    offsets[t] = (int32_t)run;
+    for (size_t e = 0; e < nEts; e++) {
+      if (e == 0 || c[t * nEts + e] != c[t * nEts + e - 1]) {
+        runStarts[run] = (int32_t)e;
+        runCodes[run] = c[t * nEts + e];
+        run++;
+      }
+    }
+  }
+  offsets[nTriples] = (int32_t)run;
+
+  result.Set("offsets", offsets);
+  result.Set("runStarts", runStarts);
+  result.Set("runCodes", runCodes);
+  return result;
+}
+
 namespace tspice_backend_node {
 
 void RegisterGeometry(Napi::Env env, Napi::Object exports) {
@@ -467,7 +801,11 @@ void RegisterGeometry(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "ilumin", Napi::Function::New(env, Ilumin), __func__)) return;
   if (!SetExportChecked(env, exports, "illumg", Napi::Function::New(env, Illumg), __func__)) return;
   if (!SetExportChecked(env, exports, "illumf", Napi::Function::New(env, Illumf), __func__)) return;
+  if (!SetExportChecked(env, exports, "sincptBatch", Napi::Function::New(env, SincptBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "iluminBatch", Napi::Function::New(env, IluminBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "illumfBatch", Napi::Function::New(env, IllumfBatch), __func__)) return;
   if (!SetExportChecked(env, exports, "occult", Napi::Function::New(env, Occult), __func__)) return;
+  if (!SetExportChecked(env, exports, "occultBatch", Napi::Function::New(env, OccultBatch), __func__)) return;
   if (!SetExportChecked(env, exports, "nvc2pl", Napi::Function::New(env, Nvc2pl), __func__)) return;
   if (!SetExportChecked(env, exports, "pl2nvc", Napi::Function::New(env, Pl2nvc), __func__)) return;
 }
@@ -1,9 +1,15 @@
 #include "geometry_gf.h"
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "../addon_common.h"
+#include "../cancellation.h"
 #include "../cell_handles.h"
+#include "../cspice_executor.h"
+#include "../instance_data.h"
 #include "../napi_helpers.h"
 #include "tspice_backend_shim.h"
 
@@ -143,10 +149,47 @@ static void Gfrepf(const Napi::CallbackInfo& info) {
   }
 }
 
-static void Gfsep(const Napi::CallbackInfo& info) {
+// --- gfsep / gfdist -----------------------------------------------------------
+//
+// Arguments are parsed into owned structs so the same validation and shim call is shared by the
+// synchronous entrypoints and their `*Async` (libuv threadpool) variants. The async variants also
+// take a trailing `{ token?, timeoutMs? }` options argument (see `cancellation.h`).
+
+struct GfsepArgs {
+  std::string targ1;
+  std::string shape1;
+  std::string frame1;
+  std::string targ2;
+  std::string shape2;
+  std::string frame2;
+  std::string abcorr;
+  std::string obsrvr;
+  std::string relate;
+  double refval = 0.0;
+  double adjust = 0.0;
+  double step = 0.0;
+  int nintvls = 0;
+  uint32_t cnfineHandle = 0;
+  uint32_t resultHandle = 0;
+};
+
+struct GfdistArgs {
+  std::string target;
+  std::string abcorr;
+  std::string obsrvr;
+  std::string relate;
+  double refval = 0.0;
+  double adjust = 0.0;
+  double step = 0.0;
+  int nintvls = 0;
+  uint32_t cnfineHandle = 0;
+  uint32_t resultHandle = 0;
+};
+
+static bool ReadGfsepArgs(const Napi::CallbackInfo& info, const char* name, bool withOptions, GfsepArgs* out) {
   Napi::Env env = info.Env();
 
-  if (info.Length() != 15 ||
+  if ((info.Length() != 15 && !(withOptions && info.Length() == 16)) ||
       !info[0].IsString() || !info[1].IsString() || !info[2].IsString() ||
       !info[3].IsString() || !info[4].IsString() || !info[5].IsString() ||
       !info[6].IsString() || !info[7].IsString() || !info[8].IsString() ||
@@ -154,106 +197,134 @@ static void Gfsep(const Napi::CallbackInfo& info) {
       !info[12].IsNumber()) {
     ThrowSpiceError(Napi::TypeError::New(
         env,
-        "gfsep(targ1, shape1, frame1, targ2, shape2, frame2, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result) expects 15 args"));
-    return;
+        std::string(name) +
+            "(targ1, shape1, frame1, targ2, shape2, frame2, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result" +
+            (withOptions ? ", options?) expects 15 or 16 args" : ") expects 15 args")));
+    return false;
   }
 
-  const std::string targ1 = info[0].As<Napi::String>().Utf8Value();
-  const std::string shape1 = info[1].As<Napi::String>().Utf8Value();
-  const std::string frame1 = info[2].As<Napi::String>().Utf8Value();
-  const std::string targ2 = info[3].As<Napi::String>().Utf8Value();
-  const std::string shape2 = info[4].As<Napi::String>().Utf8Value();
-  const std::string frame2 = info[5].As<Napi::String>().Utf8Value();
-  const std::string abcorr = info[6].As<Napi::String>().Utf8Value();
-  const std::string obsrvr = info[7].As<Napi::String>().Utf8Value();
-  const std::string relate = info[8].As<Napi::String>().Utf8Value();
-  const double refval = info[9].As<Napi::Number>().DoubleValue();
-  const double adjust = info[10].As<Napi::Number>().DoubleValue();
-  const double step = info[11].As<Napi::Number>().DoubleValue();
-  const int nintvls = info[12].As<Napi::Number>().Int32Value();
+  out->targ1 = info[0].As<Napi::String>().Utf8Value();
+  out->shape1 = info[1].As<Napi::String>().Utf8Value();
+  out->frame1 = info[2].As<Napi::String>().Utf8Value();
+  out->targ2 = info[3].As<Napi::String>().Utf8Value();
+  out->shape2 = info[4].As<Napi::String>().Utf8Value();
+  out->frame2 = info[5].As<Napi::String>().Utf8Value();
+  out->abcorr = info[6].As<Napi::String>().Utf8Value();
+  out->obsrvr = info[7].As<Napi::String>().Utf8Value();
+  out->relate = info[8].As<Napi::String>().Utf8Value();
+  out->refval = info[9].As<Napi::Number>().DoubleValue();
+  out->adjust = info[10].As<Napi::Number>().DoubleValue();
+  out->step = info[11].As<Napi::Number>().DoubleValue();
+  out->nintvls = info[12].As<Napi::Number>().Int32Value();
+
+  if (!tspice_backend_node::ReadCellHandleArg(env, info[13], "cnfine", &out->cnfineHandle)) {
+    return false;
+  }
+  return tspice_backend_node::ReadCellHandleArg(env, info[14], "result", &out->resultHandle);
+}
 
-  uint32_t cnfineHandle = 0;
-  if (!tspice_backend_node::ReadCellHandleArg(env, info[13], "cnfine", &cnfineHandle)) {
-    return;
+static bool ReadGfdistArgs(const Napi::CallbackInfo& info, const char* name, bool withOptions, GfdistArgs* out) {
+  Napi::Env env = info.Env();
+
+  if ((info.Length() != 10 && !(withOptions && info.Length() == 11)) ||
+      !info[0].IsString() || !info[1].IsString() || !info[2].IsString() || !info[3].IsString() ||
+      !info[4].IsNumber() || !info[5].IsNumber() || !info[6].IsNumber() || !info[7].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) +
+            "(target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result" +
+            (withOptions ? ", options?) expects 10 or 11 args" : ") expects 10 args")));
+    return false;
   }
-  uint32_t resultHandle = 0;
-  if (!tspice_backend_node::ReadCellHandleArg(env, info[14], "result", &resultHandle)) {
-    return;
+
+  out->target = info[0].As<Napi::String>().Utf8Value();
+  out->abcorr = info[1].As<Napi::String>().Utf8Value();
+  out->obsrvr = info[2].As<Napi::String>().Utf8Value();
+  out->relate = info[3].As<Napi::String>().Utf8Value();
+  out->refval = info[4].As<Napi::Number>().DoubleValue();
+  out->adjust = info[5].As<Napi::Number>().DoubleValue();
+  out->step = info[6].As<Napi::Number>().DoubleValue();
+  out->nintvls = info[7].As<Napi::Number>().Int32Value();
+
+  if (!tspice_backend_node::ReadCellHandleArg(env, info[8], "cnfine", &out->cnfineHandle)) {
+    return false;
   }
+  return tspice_backend_node::ReadCellHandleArg(env, info[9], "result", &out->resultHandle);
+}
 
-  tspice_backend_node::CspiceLock lock;
-  const uintptr_t cnfinePtr = tspice_backend_node::GetCellHandlePtrOrThrow(
-      lock,
-      env,
-      cnfineHandle,
-      SPICE_DP,
-      "gfsep(cnfine)",
-      "SpiceWindow");
-  if (env.IsExceptionPending()) return;
-  const uintptr_t resultPtr = tspice_backend_node::GetCellHandlePtrOrThrow(
-      lock,
-      env,
-      resultHandle,
-      SPICE_DP,
-      "gfsep(result)",
-      "SpiceWindow");
-  if (env.IsExceptionPending()) return;
+static int CallGfsep(
+    const GfsepArgs& a,
+    uintptr_t cnfinePtr,
+    uintptr_t resultPtr,
+    char* err,
+    int errMaxBytes) {
+  return tspice_gfsep(
+      a.targ1.c_str(),
+      a.shape1.c_str(),
+      a.frame1.c_str(),
+      a.targ2.c_str(),
+      a.shape2.c_str(),
+      a.frame2.c_str(),
+      a.abcorr.c_str(),
+      a.obsrvr.c_str(),
+      a.relate.c_str(),
+      a.refval,
+      a.adjust,
+      a.step,
+      a.nintvls,
+      cnfinePtr,
+      resultPtr,
+      err,
+      errMaxBytes);
+}
 
-  char err[tspice_backend_node::kErrMaxBytes];
-  const int code = tspice_gfsep(
-      targ1.c_str(),
-      shape1.c_str(),
-      frame1.c_str(),
-      targ2.c_str(),
-      shape2.c_str(),
-      frame2.c_str(),
-      abcorr.c_str(),
-      obsrvr.c_str(),
-      relate.c_str(),
-      refval,
-      adjust,
-      step,
-      nintvls,
+static int CallGfdist(
+    const GfdistArgs& a,
+    uintptr_t cnfinePtr,
+    uintptr_t resultPtr,
+    char* err,
+    int errMaxBytes) {
+  return tspice_gfdist(
+      a.target.c_str(),
+      a.abcorr.c_str(),
+      a.obsrvr.c_str(),
+      a.relate.c_str(),
+      a.refval,
+      a.adjust,
+      a.step,
+      a.nintvls,
       cnfinePtr,
       resultPtr,
       err,
-      (int)sizeof(err));
-  if (code != 0) {
-    ThrowSpiceError(
-        env,
-        std::string("CSPICE failed while calling gfsep(") + PreviewForError(targ1) + ", " +
-            PreviewForError(targ2) + ")",
-        err);
-  }
+      errMaxBytes);
 }
 
-static void Gfdist(const Napi::CallbackInfo& info) {
-  Napi::Env env = info.Env();
+static std::string GfsepErrorContext(const GfsepArgs& a, const char* name) {
+  return std::string("CSPICE failed while calling ") + name + "(" + PreviewForError(a.targ1) +
+      ", " + PreviewForError(a.targ2) + ")";
+}
 
-  if (info.Length() != 10 ||
-      !info[0].IsString() || !info[1].IsString() || !info[2].IsString() || !info[3].IsString() ||
-      !info[4].IsNumber() || !info[5].IsNumber() || !info[6].IsNumber() || !info[7].IsNumber()) {
-    ThrowSpiceError(Napi::TypeError::New(
-        env,
-        "gfdist(target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result) expects 10 args"));
-    return;
-  }
+static std::string GfdistErrorContext(const GfdistArgs& a, const char* name) {
+  return std::string("CSPICE failed while calling ") + name + "(" + PreviewForError(a.target) + ")";
+}
 
-  const std::string target = info[0].As<Napi::String>().Utf8Value();
-  const std::string abcorr = info[1].As<Napi::String>().Utf8Value();
-  const std::string obsrvr = info[2].As<Napi::String>().Utf8Value();
-  const std::string relate = info[3].As<Napi::String>().Utf8Value();
-  const double refval = info[4].As<Napi::Number>().DoubleValue();
-  const double adjust = info[5].As<Napi::Number>().DoubleValue();
-  const double step = info[6].As<Napi::Number>().DoubleValue();
-  const int nintvls = info[7].As<Napi::Number>().Int32Value();
+template <typename Args>
+using GfCallFn = int (*)(const Args&, uintptr_t, uintptr_t, char*, int);
 
-  uint32_t cnfineHandle = 0;
-  if (!tspice_backend_node::ReadCellHandleArg(env, info[8], "cnfine", &cnfineHandle)) {
-    return;
-  }
-  uint32_t resultHandle = 0;
-  if (!tspice_backend_node::ReadCellHandleArg(env, info[9], "result", &resultHandle)) {
+template <typename Args>
+using GfErrorContextFn = std::string (*)(const Args&, const char*);
+
+template <typename Args>
+static void RunGfSync(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    bool (*read)(const Napi::CallbackInfo&, const char*, bool, Args*),
+    GfCallFn<Args> call,
+    GfErrorContextFn<Args> errorContext) {
+  Napi::Env env = info.Env();
+
+  Args args;
+  if (!read(info, name, false, &args)) {
     return;
   }
 
@@ -261,40 +332,200 @@ static void Gfdist(const Napi::CallbackInfo& info) {
   const uintptr_t cnfinePtr = tspice_backend_node::GetCellHandlePtrOrThrow(
       lock,
       env,
-      cnfineHandle,
+      args.cnfineHandle,
       SPICE_DP,
-      "gfdist(cnfine)",
+      (std::string(name) + "(cnfine)").c_str(),
       "SpiceWindow");
   if (env.IsExceptionPending()) return;
   const uintptr_t resultPtr = tspice_backend_node::GetCellHandlePtrOrThrow(
       lock,
       env,
-      resultHandle,
+      args.resultHandle,
       SPICE_DP,
-      "gfdist(result)",
+      (std::string(name) + "(result)").c_str(),
       "SpiceWindow");
   if (env.IsExceptionPending()) return;
 
   char err[tspice_backend_node::kErrMaxBytes];
-  const int code = tspice_gfdist(
-      target.c_str(),
-      abcorr.c_str(),
-      obsrvr.c_str(),
-      relate.c_str(),
-      refval,
-      adjust,
-      step,
-      nintvls,
-      cnfinePtr,
-      resultPtr,
-      err,
-      (int)sizeof(err));
+  const int code = call(args, cnfinePtr, resultPtr, err, (int)sizeof(err));
   if (code != 0) {
-    ThrowSpiceError(
-        env,
-        std::string("CSPICE failed while calling gfdist(") + PreviewForError(target) + ")",
-        err);
+    ThrowSpiceError(env, errorContext(args, name), err);
+  }
+}
+
+// Runs a GF search off the JS thread (see `DispatchCspiceTask`) so long confinement windows don't
+// block the event loop.
+//
+// Window handles are resolved inside `Execute()` while holding the CSPICE mutex for the whole
+// search, so a concurrent `freeWindow()` from JS simply waits for the search to finish. Any other
+// CSPICE call made from JS in the meantime also waits on the mutex; only non-SPICE work proceeds.
+//
+// SPICE error fields are captured before the mutex is released, since a later call would overwrite
+// the shim's out-of-band error state before `OnComplete()` runs.
+//
+// A search whose token is set or whose deadline passes is abandoned with `result` emptied: before
+// it starts if that happened while it was queued, otherwise at the next poll of gfevnt_c's bail
+// hook.
+template <typename Args>
+class GfSearchTask : public tspice_backend_node::CspiceTask {
+ public:
+  GfSearchTask(
+      Napi::Promise::Deferred deferred,
+      std::shared_ptr<tspice_backend_node::CellHandleTable> cells,
+      const char* name,
+      Args args,
+      tspice_backend_node::CallCancellation cancellation,
+      GfCallFn<Args> call,
+      GfErrorContextFn<Args> errorContext)
+      : deferred_(deferred),
+        cells_(std::move(cells)),
+        name_(name),
+        args_(std::move(args)),
+        cancellation_(std::move(cancellation)),
+        call_(call),
+        errorContext_(errorContext) {
+    err_[0] = '\0';
   }
+
+  void Execute(const tspice_backend_node::CspiceLock& lock) override {
+    const uintptr_t cnfinePtr = tspice_backend_node::ResolveCellHandlePtr(
+        lock,
+        *cells_,
+        args_.cnfineHandle,
+        SPICE_DP,
+        (name_ + "(cnfine)").c_str(),
+        "SpiceWindow",
+        &argError_,
+        &argIsTypeError_);
+    if (cnfinePtr == 0) return;
+    const uintptr_t resultPtr = tspice_backend_node::ResolveCellHandlePtr(
+        lock,
+        *cells_,
+        args_.resultHandle,
+        SPICE_DP,
+        (name_ + "(result)").c_str(),
+        "SpiceWindow",
+        &argError_,
+        &argIsTypeError_);
+    if (resultPtr == 0) return;
+
+    // CSPICE writes both windows (even `cnfine`'s header gets re-synced), so keep the lock-free
+    // cell reads off them until the search is done.
+    tspice_backend_node::CellPin cnfinePin(*cells_, args_.cnfineHandle);
+    tspice_backend_node::CellPin resultPin(*cells_, args_.resultHandle);
+
+    cancelReason_ = cancellation_.Check();
+    if (cancelReason_ != tspice_backend_node::CancelReason::kNone) {
+      // Same outcome as a search stopped midway.
+      tspice_scard(0, resultPtr, nullptr, 0);
+      return;
+    }
+
+    tspice_backend_node::InterruptScope interrupt(lock, cancellation_);
+    const int code = call_(args_, cnfinePtr, resultPtr, err_, (int)sizeof(err_));
+    if (code == TSPICE_INTERRUPTED) {
+      cancelReason_ = interrupt.reason();
+      return;
+    }
+    if (code != 0) {
+      failed_ = true;
+      errorFields_ = tspice_napi::CaptureLastSpiceErrorFields();
+    }
+  }
+
+  void OnComplete(Napi::Env env) override {
+    if (cancelReason_ != tspice_backend_node::CancelReason::kNone) {
+      deferred_.Reject(tspice_backend_node::MakeCancellationError(env, name_, cancelReason_).Value());
+      return;
+    }
+
+    if (!argError_.empty()) {
+      if (argIsTypeError_) {
+        deferred_.Reject(Napi::TypeError::New(env, argError_).Value());
+      } else {
+        deferred_.Reject(Napi::RangeError::New(env, argError_).Value());
+      }
+      return;
+    }
+
+    if (failed_) {
+      deferred_.Reject(tspice_napi::MakeSpiceError(
+                           env, errorContext_(args_, name_.c_str()), err_, errorFields_)
+                           .Value());
+      return;
+    }
+
+    deferred_.Resolve(Napi::Number::New(env, static_cast<double>(args_.resultHandle)));
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  // The submitting environment's handle table; a worker may be torn down before `Execute()` runs.
+  std::shared_ptr<tspice_backend_node::CellHandleTable> cells_;
+  std::string name_;
+  Args args_;
+  tspice_backend_node::CallCancellation cancellation_;
+  GfCallFn<Args> call_;
+  GfErrorContextFn<Args> errorContext_;
+
+  tspice_backend_node::CancelReason cancelReason_ = tspice_backend_node::CancelReason::kNone;
+  std::string argError_;
+  bool argIsTypeError_ = false;
+  bool failed_ = false;
+  char err_[tspice_backend_node::kErrMaxBytes];
+  tspice_napi::SpiceErrorFields errorFields_;
+};
+
+template <typename Args>
+static Napi::Value RunGfAsync(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    size_t expectedArgs,
+    bool (*read)(const Napi::CallbackInfo&, const char*, bool, Args*),
+    GfCallFn<Args> call,
+    GfErrorContextFn<Args> errorContext) {
+  Napi::Env env = info.Env();
+
+  Args args;
+  if (!read(info, name, true, &args)) {
+    return env.Undefined();
+  }
+  // The options argument follows the search arguments; reading it now starts the deadline clock.
+  tspice_backend_node::CallCancellation cancellation;
+  if (info.Length() == expectedArgs + 1 &&
+      !tspice_backend_node::ReadCallCancellation(env, info[expectedArgs], name, &cancellation)) {
+    return env.Undefined();
+  }
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  tspice_backend_node::DispatchCspiceTask(
+      env,
+      std::make_unique<GfSearchTask<Args>>(
+          deferred,
+          tspice_backend_node::GetInstanceData(env).cells,
+          name,
+          std::move(args),
+          std::move(cancellation),
+          call,
+          errorContext),
+      name);
+  return deferred.Promise();
+}
+
+static void Gfsep(const Napi::CallbackInfo& info) {
+  RunGfSync<GfsepArgs>(info, "gfsep", ReadGfsepArgs, CallGfsep, GfsepErrorContext);
+}
+
+static void Gfdist(const Napi::CallbackInfo& info) {
+  RunGfSync<GfdistArgs>(info, "gfdist", ReadGfdistArgs, CallGfdist, GfdistErrorContext);
+}
+
+static Napi::Value GfsepAsync(const Napi::CallbackInfo& info) {
+  return RunGfAsync<GfsepArgs>(info, "gfsepAsync", 15, ReadGfsepArgs, CallGfsep, GfsepErrorContext);
+}
+
+static Napi::Value GfdistAsync(const Napi::CallbackInfo& info) {
+  return RunGfAsync<GfdistArgs>(info, "gfdistAsync", 10, ReadGfdistArgs, CallGfdist, GfdistErrorContext);
 }
 
 namespace tspice_backend_node {
@@ -308,6 +539,8 @@ void RegisterGeometryGf(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "gfrepf", Napi::Function::New(env, Gfrepf), __func__)) return;
   if (!SetExportChecked(env, exports, "gfsep", Napi::Function::New(env, Gfsep), __func__)) return;
   if (!SetExportChecked(env, exports, "gfdist", Napi::Function::New(env, Gfdist), __func__)) return;
+  if (!SetExportChecked(env, exports, "gfsepAsync", Napi::Function::New(env, GfsepAsync), __func__)) return;
+  if (!SetExportChecked(env, exports, "gfdistAsync", Napi::Function::New(env, GfdistAsync), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
@@ -1,16 +1,23 @@
 #include "ids_names.h"
 
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "../addon_common.h"
+#include "../id_cache.h"
 #include "../napi_helpers.h"
+#include "../pool_generation.h"
+#include "../query_cache.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::MakeFound;
 using tspice_napi::MakeNotFound;
 using tspice_napi::PreviewForError;
 using tspice_napi::MakeNumberArray;
+using tspice_napi::MakePackedStrings;
 using tspice_napi::SetExportChecked;
 using tspice_napi::ThrowSpiceError;
 
@@ -55,7 +62,7 @@ static Napi::Object Bodn2c(const Napi::CallbackInfo& info) {
   }
 
   const std::string name = info[0].As<Napi::String>().Utf8Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   int codeOut = 0;
@@ -85,7 +92,7 @@ static Napi::Object Bodc2n(const Napi::CallbackInfo& info) {
   }
 
   const int codeIn = info[0].As<Napi::Number>().Int32Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char nameOut[tspice_backend_node::kOutMaxBytes];
@@ -112,7 +119,7 @@ static Napi::String Bodc2s(const Napi::CallbackInfo& info) {
   }
 
   const int codeIn = info[0].As<Napi::Number>().Int32Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char nameOut[tspice_backend_node::kOutMaxBytes];
@@ -134,7 +141,7 @@ static Napi::Object Bods2c(const Napi::CallbackInfo& info) {
   }
 
   const std::string name = info[0].As<Napi::String>().Utf8Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   int codeOut = 0;
@@ -152,6 +159,51 @@ static Napi::Object Bods2c(const Napi::CallbackInfo& info) {
   return MakeFound<double>(env, "code", static_cast<double>(codeOut));
 }
 
+using InternFn = int (*)(const std::string&, int*, bool*, char*, int);
+
+// Shared body for `internBody` / `internFrame`: resolve a name once through the addon-level ID
+// cache so callers can switch to the integer-ID entrypoints for the hot path.
+static Napi::Number Intern(const Napi::CallbackInfo& info, const char* name, const char* kind, InternFn fn) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(name) + "(name: string) expects exactly one string argument"));
+    return Napi::Number::New(env, 0);
+  }
+
+  const std::string value = info[0].As<Napi::String>().Utf8Value();
+  tspice_backend_node::CspiceLock lock;
+
+  char err[tspice_backend_node::kErrMaxBytes];
+  int codeOut = 0;
+  bool found = false;
+  const int code = fn(value, &codeOut, &found, err, (int)sizeof(err));
+  if (code != 0) {
+    ThrowSpiceError(env, std::string("CSPICE failed while calling ") + name + "(\"" + PreviewForError(value) + "\")", err);
+    return Napi::Number::New(env, 0);
+  }
+  if (!found) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env, std::string(name) + "(): unknown " + kind + " \"" + PreviewForError(value) + "\""));
+    return Napi::Number::New(env, 0);
+  }
+
+  return Napi::Number::New(env, static_cast<double>(codeOut));
+}
+
+static Napi::Number InternBody(const Napi::CallbackInfo& info) {
+  return Intern(info, "internBody", "body", tspice_backend_node::InternBodyCode);
+}
+
+static Napi::Number InternFrame(const Napi::CallbackInfo& info) {
+  return Intern(info, "internFrame", "frame", tspice_backend_node::InternFrameCode);
+}
+
+// Names passed to `boddef`, most recent last. CSPICE keeps its own runtime definitions private, so
+// the body table needs this record to list them (definitions survive `kclear`, and so does this).
+// Guarded by `g_cspice_mutex`.
+static std::vector<std::string> g_boddefNames;
+
 static void Boddef(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -163,12 +215,158 @@ static void Boddef(const Napi::CallbackInfo& info) {
   const std::string name = info[0].As<Napi::String>().Utf8Value();
   const int codeIn = info[1].As<Napi::Number>().Int32Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_boddef(name.c_str(), codeIn, err, (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeBodies);
   if (code != 0) {
     ThrowSpiceError(env, std::string("CSPICE failed while calling boddef(\"") + PreviewForError(name) + "\", " + std::to_string(codeIn) + ")", err);
+    return;
+  }
+  g_boddefNames.push_back(name);
+}
+
+// CSPICE's name comparison key: upper case, blanks trimmed, runs of blanks collapsed to one.
+static std::string NormalizeBodyName(const std::string& name) {
+  std::string out;
+  out.reserve(name.size());
+  bool pendingSpace = false;
+  for (char ch : ToUpperAscii(TrimAsciiWhitespace(name))) {
+    if (IsAsciiWhitespace(static_cast<unsigned char>(ch))) {
+      pendingSpace = true;
+      continue;
+    }
+    if (pendingSpace) out.push_back(' ');
+    pendingSpace = false;
+    out.push_back(ch);
+  }
+  return out;
+}
+
+// Comfortably above CSPICE's built-in table (`NPERM`, a few hundred entries).
+static constexpr int kMaxBuiltinBodies = 4096;
+// `NAIF_BODY_NAME` values are capped at 36 characters; leave room for longer (invalid) entries.
+static constexpr int kPoolBodyNameMaxBytes = 81;
+
+// Reads every value of character pool variable `name` (missing variables yield nothing).
+static bool ReadPoolStrings(const char* name, std::vector<std::string>* out, char* err, int errMaxBytes) {
+  int found = 0;
+  int n = 0;
+  char type[2] = {0};
+  if (tspice_dtpool(name, &found, &n, type, (int)sizeof(type), err, errMaxBytes) != 0) return false;
+  if (!found || n <= 0 || type[0] != 'C') return true;
+
+  std::vector<char> buf((size_t)n * kPoolBodyNameMaxBytes, '\0');
+  int got = 0;
+  if (tspice_gcpool(name, 0, n, kPoolBodyNameMaxBytes, &got, buf.data(), &found, err, errMaxBytes) != 0) {
+    return false;
   }
+  for (int i = 0; i < got; i++) {
+    const char* value = buf.data() + (size_t)i * kPoolBodyNameMaxBytes;
+    out->emplace_back(value, strnlen(value, kPoolBodyNameMaxBytes));
+  }
+  return true;
+}
+
+// Every body name CSPICE currently resolves, with its code: `boddef` definitions, then
+// `NAIF_BODY_NAME` pool entries, then the built-in table (CSPICE's precedence order). Each distinct
+// name (by `NormalizeBodyName`) appears once, spelled as first found, with the code `bodn2c`
+// returns for it now; `primary[i]` is 1 when name i is the one `bodc2n` returns for its code.
+static Napi::Value ExportBodyNameTable(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "exportBodyNameTable() expects no arguments"));
+    return env.Undefined();
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const uint64_t generation = tspice_backend_node::PoolGeneration();
+
+  std::vector<std::string> candidates(g_boddefNames.rbegin(), g_boddefNames.rend());
+
+  std::vector<std::string> poolNames;
+  if (!ReadPoolStrings("NAIF_BODY_NAME", &poolNames, err, (int)sizeof(err))) {
+    ThrowSpiceError(env, "CSPICE failed while reading NAIF_BODY_NAME", err);
+    return env.Undefined();
+  }
+  candidates.insert(candidates.end(), poolNames.rbegin(), poolNames.rend());
+
+  std::vector<int> builtinCodes((size_t)kMaxBuiltinBodies, 0);
+  std::vector<char> builtinNames((size_t)kMaxBuiltinBodies * TSPICE_BODY_NAME_MAX_BYTES, '\0');
+  int nBuiltin = 0;
+  if (tspice_body_builtin_names(
+          kMaxBuiltinBodies,
+          builtinCodes.data(),
+          builtinNames.data(),
+          TSPICE_BODY_NAME_MAX_BYTES,
+          &nBuiltin,
+          err,
+          (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while reading the built-in body table", err);
+    return env.Undefined();
+  }
+  for (int i = 0; i < nBuiltin; i++) {
+    candidates.emplace_back(builtinNames.data() + (size_t)i * TSPICE_BODY_NAME_MAX_BYTES);
+  }
+
+  std::vector<int32_t> codes;
+  std::vector<std::string> keys;
+  std::string bytes;
+  std::vector<int32_t> offsets{0};
+  std::unordered_set<std::string> seen;
+  for (const std::string& name : candidates) {
+    std::string key = NormalizeBodyName(name);
+    if (key.empty() || !seen.insert(key).second) continue;
+
+    int codeOut = 0;
+    int found = 0;
+    if (tspice_bodn2c(name.c_str(), &codeOut, &found, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, std::string("CSPICE failed while calling bodn2c(\"") + PreviewForError(name) + "\")", err);
+      return env.Undefined();
+    }
+    if (!found) continue;
+
+    codes.push_back(codeOut);
+    keys.push_back(std::move(key));
+    bytes += TrimAsciiWhitespace(name);
+    offsets.push_back((int32_t)bytes.size());
+  }
+
+  Napi::Uint8Array primary = Napi::Uint8Array::New(env, codes.size());
+  std::unordered_set<int32_t> resolved;
+  for (size_t i = 0; i < codes.size(); i++) {
+    if (!resolved.insert(codes[i]).second) continue;
+
+    char nameOut[TSPICE_BODY_NAME_MAX_BYTES];
+    int found = 0;
+    if (tspice_bodc2n(codes[i], nameOut, (int)sizeof(nameOut), &found, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, std::string("CSPICE failed while calling bodc2n(") + std::to_string(codes[i]) + ")", err);
+      return env.Undefined();
+    }
+    if (!found) continue;
+    const std::string canonical = NormalizeBodyName(nameOut);
+    for (size_t j = i; j < codes.size(); j++) {
+      if (codes[j] == codes[i] && keys[j] == canonical) {
+        primary[j] = 1;
+        break;
+      }
+    }
+  }
+
+  Napi::Int32Array codesOut = Napi::Int32Array::New(env, codes.size());
+  if (!codes.empty()) {
+    std::memcpy(codesOut.Data(), codes.data(), codes.size() * sizeof(int32_t));
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("generation", Napi::Number::New(env, static_cast<double>(generation)));
+  result.Set("codes", codesOut);
+  result.Set("names", MakePackedStrings(env, bytes, offsets));
+  result.Set("primary", primary);
+  return result;
 }
 
 static Napi::Boolean Bodfnd(const Napi::CallbackInfo& info) {
@@ -183,7 +381,7 @@ static Napi::Boolean Bodfnd(const Napi::CallbackInfo& info) {
   const std::string itemRaw = info[1].As<Napi::String>().Utf8Value();
   const std::string item = NormalizeBodItem(itemRaw);
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int found = 0;
   const int code = tspice_bodfnd(body, item.c_str(), &found, err, (int)sizeof(err));
@@ -212,7 +410,17 @@ static Napi::Array Bodvar(const Napi::CallbackInfo& info) {
   const std::string itemRaw = info[1].As<Napi::String>().Utf8Value();
   const std::string item = NormalizeBodItem(itemRaw);
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  const bool memo = tspice_backend_node::QueryCacheEnabled();
+  tspice_backend_node::QueryKey key(tspice_backend_node::QueryKind::kBodvar);
+  if (memo) {
+    key.Add(body).Add(item);
+    std::vector<double> cached;
+    if (tspice_backend_node::QueryCacheLookup(key, &cached)) {
+      return MakeNumberArray(env, cached.data(), cached.size());
+    }
+  }
+
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
 
   const std::string poolVar = std::string("BODY") + std::to_string(body) + "_" + item;
@@ -224,15 +432,10 @@ static Napi::Array Bodvar(const Napi::CallbackInfo& info) {
     ThrowSpiceError(env, std::string("CSPICE failed while calling dtpool(\"") + PreviewForError(poolVar) + "\")", err);
     return Napi::Array::New(env);
   }
-  if (!found) {
-    // Missing body constants are a normal miss; callers that need strict checks can use bodfnd().
-    return Napi::Array::New(env, 0);
-  }
-  if (typeOut[0] != 'N') {
-    // Missing / non-numeric pool vars are treated as a normal miss; use bodfnd() for strict presence.
-    return Napi::Array::New(env, 0);
-  }
-  if (n <= 0) {
+  if (!found || typeOut[0] != 'N' || n <= 0) {
+    // Missing / non-numeric pool vars are treated as a normal miss; callers that need strict
+    // checks can use bodfnd().
+    if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), nullptr, 0);
     return Napi::Array::New(env, 0);
   }
 
@@ -254,6 +457,7 @@ static Napi::Array Bodvar(const Napi::CallbackInfo& info) {
 
   if (dim < 0) dim = 0;
   if (dim > n) dim = n;
+  if (memo) tspice_backend_node::QueryCacheStore(key, tspice_backend_node::PoolGeneration(), values.data(), (size_t)dim);
   return MakeNumberArray(env, values.data(), (size_t)dim);
 }
 
@@ -264,7 +468,10 @@ void RegisterIdsNames(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "bodc2n", Napi::Function::New(env, Bodc2n), __func__)) return;
   if (!SetExportChecked(env, exports, "bodc2s", Napi::Function::New(env, Bodc2s), __func__)) return;
   if (!SetExportChecked(env, exports, "bods2c", Napi::Function::New(env, Bods2c), __func__)) return;
+  if (!SetExportChecked(env, exports, "internBody", Napi::Function::New(env, InternBody), __func__)) return;
+  if (!SetExportChecked(env, exports, "internFrame", Napi::Function::New(env, InternFrame), __func__)) return;
   if (!SetExportChecked(env, exports, "boddef", Napi::Function::New(env, Boddef), __func__)) return;
+  if (!SetExportChecked(env, exports, "exportBodyNameTable", Napi::Function::New(env, ExportBodyNameTable), __func__)) return;
   if (!SetExportChecked(env, exports, "bodfnd", Napi::Function::New(env, Bodfnd), __func__)) return;
   if (!SetExportChecked(env, exports, "bodvar", Napi::Function::New(env, Bodvar), __func__)) return;
 }
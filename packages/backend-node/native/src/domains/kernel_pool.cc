@@ -3,13 +3,20 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "../addon_common.h"
+#include "../coverage_index.h"
+#include "../id_cache.h"
+#include "../leapseconds.h"
 #include "../napi_helpers.h"
+#include "../pool_generation.h"
+#include "../text_kernel.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::FixedWidthToJsString;
@@ -103,7 +110,7 @@ static Napi::Object Gdpool(const Napi::CallbackInfo& info) {
 
   std::vector<double> values(static_cast<size_t>(room));
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int nOut = 0;
   int found = 0;
@@ -169,7 +176,7 @@ static Napi::Object Gipool(const Napi::CallbackInfo& info) {
 
   std::vector<int> values(static_cast<size_t>(room));
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int nOut = 0;
   int found = 0;
@@ -236,7 +243,7 @@ static Napi::Object Gcpool(const Napi::CallbackInfo& info) {
   // Fixed-width 2D buffer: room x kPoolStringMaxBytes.
   std::vector<std::array<char, kPoolStringMaxBytes>> cvals(static_cast<size_t>(room));
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int nOut = 0;
   int found = 0;
@@ -309,7 +316,7 @@ static Napi::Object Gnpool(const Napi::CallbackInfo& info) {
   // Fixed-width 2D buffer: room x kPoolNameMaxBytes.
   std::vector<std::array<char, kPoolNameMaxBytes>> cvals(static_cast<size_t>(room));
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int nOut = 0;
   int found = 0;
@@ -365,7 +372,7 @@ static Napi::Object Dtpool(const Napi::CallbackInfo& info) {
     return Napi::Object::New(env);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int found = 0;
   int nOut = 0;
@@ -438,9 +445,13 @@ static void Pdpool(const Napi::CallbackInfo& info) {
     values.push_back(d);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_pdpool(name.c_str(), (int)values.size(), values.data(), err, (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeVariables);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -496,9 +507,13 @@ static void Pipool(const Napi::CallbackInfo& info) {
     values.push_back(static_cast<int>(d));
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_pipool(name.c_str(), (int)values.size(), values.data(), err, (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeVariables);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -532,7 +547,7 @@ static void Pcpool(const Napi::CallbackInfo& info) {
     CopyToFixedWidth(cvals[i], values.values[i]);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_pcpool(
       name.c_str(),
@@ -541,6 +556,10 @@ static void Pcpool(const Napi::CallbackInfo& info) {
       cvals.data(),
       err,
       (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeVariables);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -583,7 +602,7 @@ static void Swpool(const Napi::CallbackInfo& info) {
     CopyToFixedWidth(namesBuf[i], names.values[i]);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_swpool(
       agent.c_str(),
@@ -614,7 +633,7 @@ static Napi::Boolean Cvpool(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, false);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int update = 0;
   const int code = tspice_cvpool(agent.c_str(), &update, err, (int)sizeof(err));
@@ -643,7 +662,7 @@ static Napi::Boolean Expool(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, false);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int found = 0;
   const int code = tspice_expool(name.c_str(), &found, err, (int)sizeof(err));
@@ -658,6 +677,314 @@ static Napi::Boolean Expool(const Napi::CallbackInfo& info) {
   return Napi::Boolean::New(env, found != 0);
 }
 
+// poolSnapshot(pattern): every variable matching a `gnpool` template, read under one lock.
+//
+// Names are paged through `gnpool`, numeric values are read with one `gdpool` per variable
+// straight into the output, and character values are paged through a module-level scratch buffer
+// of `kPoolSnapshotChunkRows` full-width (`kPoolStringMaxBytes`) rows that is reused across calls,
+// so no variable needs more than one pass from JS regardless of its length.
+constexpr int kPoolSnapshotChunkRows = 64;
+
+// Guarded by `g_cspice_mutex`.
+static std::vector<char> g_pool_snapshot_scratch;
+
+static void AppendTrimmed(tspice_backend_node::PoolSnapshotData* out, const char* buf, size_t width) {
+  size_t len = 0;
+  while (len < width && buf[len] != '\0') len++;
+  while (len > 0 && tspice_napi::IsAsciiWhitespace(static_cast<unsigned char>(buf[len - 1]))) len--;
+  out->stringBytes.insert(out->stringBytes.end(), buf, buf + len);
+  out->stringOffsets.push_back(static_cast<int32_t>(out->stringBytes.size()));
+}
+
+namespace tspice_backend_node {
+
+bool ReadPoolSnapshot(
+    const std::string& pattern,
+    PoolSnapshotData* out,
+    std::string* outCall,
+    char* err,
+    int errMaxBytes) {
+  const size_t rowBytes = static_cast<size_t>(kPoolSnapshotChunkRows) * kPoolStringMaxBytes;
+  if (g_pool_snapshot_scratch.size() < rowBytes) g_pool_snapshot_scratch.resize(rowBytes);
+  char* scratch = g_pool_snapshot_scratch.data();
+
+  for (int start = 0;;) {
+    int nOut = 0;
+    int found = 0;
+    const int room = static_cast<int>(rowBytes / kPoolNameMaxBytes);
+    if (tspice_gnpool(pattern.c_str(), start, room, (int)kPoolNameMaxBytes, &nOut, scratch, &found, err, errMaxBytes) != 0) {
+      *outCall = "gnpool(\"" + PreviewForError(pattern) + "\")";
+      return false;
+    }
+    if (!found || nOut <= 0) break;
+    nOut = std::min(nOut, room);
+    for (int i = 0; i < nOut; i++) {
+      const char* row = scratch + static_cast<size_t>(i) * kPoolNameMaxBytes;
+      size_t len = 0;
+      while (len < kPoolNameMaxBytes && row[len] != '\0') len++;
+      while (len > 0 && tspice_napi::IsAsciiWhitespace(static_cast<unsigned char>(row[len - 1]))) len--;
+      out->names.emplace_back(row, len);
+    }
+    start += nOut;
+    if (nOut < room) break;
+  }
+
+  out->types.reserve(out->names.size());
+  out->start.reserve(out->names.size());
+  out->count.reserve(out->names.size());
+
+  for (const std::string& name : out->names) {
+    int found = 0;
+    int n = 0;
+    char type[2] = {'X', '\0'};
+    if (tspice_dtpool(name.c_str(), &found, &n, type, (int)sizeof(type), err, errMaxBytes) != 0) {
+      *outCall = "dtpool(\"" + PreviewForError(name) + "\")";
+      return false;
+    }
+    if (!found || n < 0) n = 0;
+
+    if (type[0] == 'N') {
+      const size_t base = out->numbers.size();
+      out->numbers.resize(base + static_cast<size_t>(n));
+      int nOut = 0;
+      if (n > 0 &&
+          tspice_gdpool(name.c_str(), 0, n, &nOut, out->numbers.data() + base, &found, err, errMaxBytes) != 0) {
+        *outCall = "gdpool(\"" + PreviewForError(name) + "\")";
+        return false;
+      }
+      nOut = std::max(0, std::min(nOut, n));
+      out->numbers.resize(base + static_cast<size_t>(nOut));
+      out->types.push_back('N');
+      out->start.push_back(static_cast<int32_t>(base));
+      out->count.push_back(nOut);
+      continue;
+    }
+
+    const size_t base = out->stringOffsets.size() - 1;
+    int read = 0;
+    while (read < n) {
+      const int room = std::min(kPoolSnapshotChunkRows, n - read);
+      int nOut = 0;
+      if (tspice_gcpool(name.c_str(), read, room, (int)kPoolStringMaxBytes, &nOut, scratch, &found, err, errMaxBytes) != 0) {
+        *outCall = "gcpool(\"" + PreviewForError(name) + "\")";
+        return false;
+      }
+      nOut = std::min(nOut, room);
+      if (!found || nOut <= 0) break;
+      for (int i = 0; i < nOut; i++) {
+        AppendTrimmed(out, scratch + static_cast<size_t>(i) * kPoolStringMaxBytes, kPoolStringMaxBytes);
+      }
+      read += nOut;
+    }
+    if (out->stringBytes.size() > static_cast<size_t>(INT32_MAX)) {
+      snprintf(err, (size_t)errMaxBytes, "poolSnapshot(): character values exceed 2 GiB");
+      *outCall = "gcpool(\"" + PreviewForError(name) + "\")";
+      return false;
+    }
+    out->types.push_back('C');
+    out->start.push_back(static_cast<int32_t>(base));
+    out->count.push_back(read);
+  }
+
+  return true;
+}
+
+}  // namespace tspice_backend_node
+
+static Napi::Value PoolSnapshot(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "poolSnapshot(pattern: string) expects exactly one string argument"));
+    return env.Null();
+  }
+
+  const std::string pattern = info[0].As<Napi::String>().Utf8Value();
+  if (!ValidateNonEmptyString(env, "poolSnapshot", "pattern", pattern)) {
+    return env.Null();
+  }
+
+  tspice_backend_node::PoolSnapshotData data;
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    std::string call;
+    if (!tspice_backend_node::ReadPoolSnapshot(pattern, &data, &call, err, (int)sizeof(err))) {
+      ThrowSpiceError(env, "CSPICE failed while calling " + call + " in poolSnapshot()", err);
+      return env.Null();
+    }
+  }
+
+  const auto copyInt32 = [&](const std::vector<int32_t>& src) {
+    Napi::Int32Array arr = Napi::Int32Array::New(env, src.size());
+    if (!src.empty()) std::memcpy(arr.Data(), src.data(), src.size() * sizeof(int32_t));
+    return arr;
+  };
+
+  Napi::Array names = Napi::Array::New(env, data.names.size());
+  for (size_t i = 0; i < data.names.size(); i++) {
+    names.Set(static_cast<uint32_t>(i), Napi::String::New(env, data.names[i]));
+  }
+
+  Napi::Float64Array numbers = Napi::Float64Array::New(env, data.numbers.size());
+  if (!data.numbers.empty()) {
+    std::memcpy(numbers.Data(), data.numbers.data(), data.numbers.size() * sizeof(double));
+  }
+
+  Napi::Object strings = Napi::Object::New(env);
+  strings.Set("offsets", copyInt32(data.stringOffsets));
+  Napi::Uint8Array bytes = Napi::Uint8Array::New(env, data.stringBytes.size());
+  if (!data.stringBytes.empty()) std::memcpy(bytes.Data(), data.stringBytes.data(), data.stringBytes.size());
+  strings.Set("bytes", bytes);
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("names", names);
+  result.Set("types", Napi::String::New(env, data.types));
+  result.Set("start", copyInt32(data.start));
+  result.Set("count", copyInt32(data.count));
+  result.Set("numbers", numbers);
+  result.Set("strings", strings);
+  return result;
+}
+
+// Writes the variables parsed by `ParseTextKernel()` into the pool. Requires `g_cspice_mutex`.
+//
+// Everything that can fail on the kernel's contents (`@` dates, `+=` onto a pool variable of the
+// other type) is checked before the first write. Returns false with `err` filled and `*outCall`
+// naming the failing CSPICE call, or with `*outCall` empty for a type mismatch.
+static bool WriteTextKernel(
+    std::vector<tspice_backend_node::TextKernelVariable>* variables,
+    std::string* outCall,
+    char* err,
+    int errMaxBytes) {
+  for (tspice_backend_node::TextKernelVariable& v : *variables) {
+    for (const tspice_backend_node::TextKernelDate& date : v.dates) {
+      if (tspice_tparse(date.text.c_str(), &v.numbers[date.index], err, errMaxBytes) != 0) {
+        *outCall = "tparse(\"" + PreviewForError(date.text) + "\") for " + v.name + " on line " +
+            std::to_string(date.line);
+        return false;
+      }
+    }
+    if (!v.append) continue;
+
+    int found = 0;
+    int n = 0;
+    char type[2] = {'X', '\0'};
+    if (tspice_dtpool(v.name.c_str(), &found, &n, type, (int)sizeof(type), err, errMaxBytes) != 0) {
+      *outCall = "dtpool(\"" + PreviewForError(v.name) + "\")";
+      return false;
+    }
+    if (!found || n <= 0) continue;
+    if ((type[0] == 'C') != v.isString) {
+      snprintf(err, (size_t)errMaxBytes, "cannot append %s values to %s variable %s",
+          v.isString ? "string" : "numeric", type[0] == 'C' ? "string" : "numeric", v.name.c_str());
+      outCall->clear();
+      return false;
+    }
+
+    // Prepend the pool's current values, so the write below replaces them with the whole list.
+    int nOut = 0;
+    if (!v.isString) {
+      std::vector<double> current(static_cast<size_t>(n));
+      if (tspice_gdpool(v.name.c_str(), 0, n, &nOut, current.data(), &found, err, errMaxBytes) != 0) {
+        *outCall = "gdpool(\"" + PreviewForError(v.name) + "\")";
+        return false;
+      }
+      current.resize(static_cast<size_t>(std::max(0, std::min(nOut, n))));
+      v.numbers.insert(v.numbers.begin(), current.begin(), current.end());
+      continue;
+    }
+    std::vector<char> rows(static_cast<size_t>(n) * kPoolStringMaxBytes);
+    if (tspice_gcpool(v.name.c_str(), 0, n, (int)kPoolStringMaxBytes, &nOut, rows.data(), &found, err, errMaxBytes) != 0) {
+      *outCall = "gcpool(\"" + PreviewForError(v.name) + "\")";
+      return false;
+    }
+    std::vector<std::string> current;
+    for (int i = 0; i < std::max(0, std::min(nOut, n)); i++) {
+      const char* row = rows.data() + static_cast<size_t>(i) * kPoolStringMaxBytes;
+      current.emplace_back(row, strnlen(row, kPoolStringMaxBytes));
+    }
+    v.strings.insert(v.strings.begin(), current.begin(), current.end());
+  }
+
+  std::vector<char> rows;
+  for (const tspice_backend_node::TextKernelVariable& v : *variables) {
+    if (!v.isString) {
+      if (tspice_pdpool(v.name.c_str(), (int)v.numbers.size(), v.numbers.data(), err, errMaxBytes) != 0) {
+        *outCall = "pdpool(\"" + PreviewForError(v.name) + "\")";
+        return false;
+      }
+      continue;
+    }
+
+    size_t width = 1;
+    for (const std::string& value : v.strings) width = std::max(width, value.size() + 1);
+    rows.assign(v.strings.size() * width, '\0');
+    for (size_t i = 0; i < v.strings.size(); i++) {
+      memcpy(rows.data() + i * width, v.strings[i].data(), v.strings[i].size());
+    }
+    if (tspice_pcpool(v.name.c_str(), (int)v.strings.size(), (int)width, rows.data(), err, errMaxBytes) != 0) {
+      *outCall = "pcpool(\"" + PreviewForError(v.name) + "\")";
+      return false;
+    }
+  }
+  return true;
+}
+
+static Napi::Value LoadTextKernelFromBuffer(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsString() || !info[1].IsTypedArray() ||
+      info[1].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "loadTextKernelFromBuffer(name: string, bytes: Uint8Array) expects a string and a Uint8Array"));
+    return env.Undefined();
+  }
+
+  const std::string name = info[0].As<Napi::String>().Utf8Value();
+  Napi::Uint8Array bytes = info[1].As<Napi::Uint8Array>();
+  const std::string context = "loadTextKernelFromBuffer(\"" + PreviewForError(name) + "\")";
+
+  // Parsing needs no CSPICE state, so it runs before taking the lock.
+  std::vector<tspice_backend_node::TextKernelVariable> variables;
+  std::string parseError;
+  if (!tspice_backend_node::ParseTextKernel(
+          std::string_view(reinterpret_cast<const char*>(bytes.Data()), bytes.ByteLength()),
+          &variables,
+          &parseError)) {
+    ThrowSpiceError(env, context + ": " + parseError);
+    return env.Undefined();
+  }
+  for (const tspice_backend_node::TextKernelVariable& v : variables) {
+    if (v.name == "KERNELS_TO_LOAD") {
+      ThrowSpiceError(env, context + ": meta-kernels (KERNELS_TO_LOAD) must be loaded with furnsh");
+      return env.Undefined();
+    }
+  }
+  if (variables.empty()) {
+    return Napi::Number::New(env, 0);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  std::string call;
+  const bool ok = WriteTextKernel(&variables, &call, err, (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeVariables);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
+  if (!ok) {
+    if (call.empty()) {
+      ThrowSpiceError(env, context + ": " + err);
+    } else {
+      ThrowSpiceError(env, "CSPICE failed while calling " + call + " in " + context, err);
+    }
+    return env.Undefined();
+  }
+  return Napi::Number::New(env, static_cast<double>(variables.size()));
+}
+
 namespace tspice_backend_node {
 
 void RegisterKernelPool(Napi::Env env, Napi::Object exports) {
@@ -666,10 +993,15 @@ void RegisterKernelPool(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "gcpool", Napi::Function::New(env, Gcpool), __func__)) return;
   if (!SetExportChecked(env, exports, "gnpool", Napi::Function::New(env, Gnpool), __func__)) return;
   if (!SetExportChecked(env, exports, "dtpool", Napi::Function::New(env, Dtpool), __func__)) return;
+  if (!SetExportChecked(env, exports, "poolSnapshot", Napi::Function::New(env, PoolSnapshot), __func__)) return;
 
   if (!SetExportChecked(env, exports, "pdpool", Napi::Function::New(env, Pdpool), __func__)) return;
   if (!SetExportChecked(env, exports, "pipool", Napi::Function::New(env, Pipool), __func__)) return;
   if (!SetExportChecked(env, exports, "pcpool", Napi::Function::New(env, Pcpool), __func__)) return;
+  if (!SetExportChecked(
+          env, exports, "loadTextKernelFromBuffer", Napi::Function::New(env, LoadTextKernelFromBuffer), __func__)) {
+    return;
+  }
 
   if (!SetExportChecked(env, exports, "swpool", Napi::Function::New(env, Swpool), __func__)) return;
   if (!SetExportChecked(env, exports, "cvpool", Napi::Function::New(env, Cvpool), __func__)) return;
@@ -1,9 +1,35 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <napi.h>
 
 namespace tspice_backend_node {
 
+// Every kernel-pool variable matching a `gnpool` template, as gathered by `poolSnapshot()`.
+// Variable `i` has `count[i]` values starting at `start[i]` in `numbers` (`types[i] == 'N'`) or in
+// the packed strings (`'C'`, string `k` is `stringBytes[stringOffsets[k], stringOffsets[k + 1])`).
+struct PoolSnapshotData {
+  std::vector<std::string> names;
+  std::string types;
+  std::vector<int32_t> start;
+  std::vector<int32_t> count;
+  std::vector<double> numbers;
+  std::vector<int32_t> stringOffsets{0};
+  std::vector<uint8_t> stringBytes;
+};
+
+// Requires `g_cspice_mutex` to be held by the caller. Returns false with `err` filled (and
+// `*outCall` naming the failing call) on a CSPICE error.
+bool ReadPoolSnapshot(
+    const std::string& pattern,
+    PoolSnapshotData* out,
+    std::string* outCall,
+    char* err,
+    int errMaxBytes);
+
 void RegisterKernelPool(Napi::Env env, Napi::Object exports);
 
 }  // namespace tspice_backend_node
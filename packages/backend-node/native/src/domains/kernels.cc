@@ -3,13 +3,21 @@
 #include "cell_handles.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
 
 #include "../addon_common.h"
+#include "../coverage_index.h"
+#include "../id_cache.h"
+#include "../kernel_set.h"
+#include "../lazy_kernels.h"
+#include "../leapseconds.h"
 #include "../napi_helpers.h"
+#include "../native_memory.h"
+#include "../pool_generation.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::MakeNotFound;
@@ -29,7 +37,7 @@ static Napi::String SpiceVersion(const Napi::CallbackInfo& info) {
     return Napi::String::New(env, "");
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char out[tspice_backend_node::kOutMaxBytes];
   char err[tspice_backend_node::kErrMaxBytes];
@@ -54,9 +62,14 @@ static void Furnsh(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_furnsh(path.c_str(), err, (int)sizeof(err));
+  // Invalidate even on failure: a kernel can be partially loaded.
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -76,9 +89,14 @@ static void Unload(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_unload(path.c_str(), err, (int)sizeof(err));
+  tspice_backend_node::ForgetLazyKernel(path);
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCoverageIndex();
   if (code != 0) {
     ThrowSpiceError(
         env,
@@ -95,14 +113,235 @@ static void Kclear(const Napi::CallbackInfo& info) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_kclear(err, (int)sizeof(err));
+  tspice_backend_node::InvalidateLazyKernels();
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCoverageIndex();
   if (code != 0) {
     ThrowSpiceError(env, "CSPICE failed while calling kclear()", err);
   }
 }
 
+static Napi::Value KernelSetSnapshot(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "kernelSetSnapshot() does not take any arguments"));
+    return env.Null();
+  }
+
+  std::vector<uint8_t> bytes;
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    if (tspice_backend_node::SerializeKernelSet(&bytes, err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(env, "CSPICE failed while calling kernelSetSnapshot()", err);
+      return env.Null();
+    }
+  }
+
+  Napi::Uint8Array out = Napi::Uint8Array::New(env, bytes.size());
+  if (!bytes.empty()) std::memcpy(out.Data(), bytes.data(), bytes.size());
+  return out;
+}
+
+static void KernelSetRestore(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+    ThrowSpiceError(Napi::TypeError::New(env, "kernelSetRestore(snapshot: Uint8Array) expects exactly one Uint8Array"));
+    return;
+  }
+
+  Napi::Uint8Array bytes = info[0].As<Napi::Uint8Array>();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = tspice_backend_node::RestoreKernelSet(bytes.Data(), bytes.ByteLength(), err, (int)sizeof(err));
+  if (code == 2) {
+    ThrowSpiceError(Napi::RangeError::New(env, err));
+    return;
+  }
+  tspice_backend_node::InvalidateLazyKernels();
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCoverageIndex();
+  if (code != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling kernelSetRestore()", err);
+  }
+}
+
+static void RegisterLazyKernelJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "registerLazyKernel(path: string) expects exactly one string argument"));
+    return;
+  }
+
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  if (tspice_backend_node::RegisterLazyKernel(path, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling registerLazyKernel(\"") + PreviewForError(path) + "\")",
+        err);
+    return;
+  }
+  // Registered files change what ephemeris queries can answer, just as a furnsh would.
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+}
+
+static Napi::Value UnregisterLazyKernelJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "unregisterLazyKernel(path: string) expects exactly one string argument"));
+    return env.Null();
+  }
+
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  bool found = false;
+  const int code = tspice_backend_node::UnregisterLazyKernel(path, &found, err, (int)sizeof(err));
+  if (found) tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  if (code != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling unregisterLazyKernel(\"") + PreviewForError(path) + "\")",
+        err);
+    return env.Null();
+  }
+  return Napi::Boolean::New(env, found);
+}
+
+static void SetLazyKernelBudgetJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(env, "setLazyKernelBudget(maxOpen: number) expects exactly one number"));
+    return;
+  }
+
+  const double maxOpen = info[0].As<Napi::Number>().DoubleValue();
+  if (!(maxOpen >= 1) || maxOpen > 4096 || std::floor(maxOpen) != maxOpen) {
+    ThrowSpiceError(Napi::RangeError::New(env, "setLazyKernelBudget(): maxOpen must be an integer in [1, 4096]"));
+    return;
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  tspice_backend_node::SetLazyKernelBudget(static_cast<uint32_t>(maxOpen));
+}
+
+static Napi::Value LazyKernelStatsJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  tspice_backend_node::LazyKernelStats stats;
+  {
+    tspice_backend_node::CspiceLock lock;
+    stats = tspice_backend_node::GetLazyKernelStats();
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("registered", Napi::Number::New(env, stats.registered));
+  result.Set("open", Napi::Number::New(env, stats.open));
+  result.Set("budget", Napi::Number::New(env, stats.budget));
+  result.Set("opens", Napi::Number::New(env, stats.opens));
+  result.Set("closes", Napi::Number::New(env, stats.closes));
+  return result;
+}
+
+static Napi::Boolean KernelBuffersSupported(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "kernelBuffersSupported() does not take any arguments"));
+    return Napi::Boolean::New(env, false);
+  }
+
+  return Napi::Boolean::New(env, tspice_kernel_buffers_supported() != 0);
+}
+
+static Napi::Value FurnshBuffer(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsString() || !info[1].IsTypedArray() ||
+      info[1].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "furnshBuffer(name: string, bytes: Uint8Array) expects a string and a Uint8Array"));
+    return env.Undefined();
+  }
+
+  const std::string name = info[0].As<Napi::String>().Utf8Value();
+  Napi::Uint8Array bytes = info[1].As<Napi::Uint8Array>();
+
+  tspice_backend_node::CspiceLock lock;
+  char spicePath[64];
+  char err[tspice_backend_node::kErrMaxBytes];
+  const int code = tspice_furnsh_buffer(
+      name.c_str(),
+      bytes.Data(),
+      bytes.ByteLength(),
+      spicePath,
+      (int)sizeof(spicePath),
+      err,
+      (int)sizeof(err));
+  tspice_backend_node::InvalidateIdCache();
+  tspice_backend_node::BumpPoolGeneration(tspice_backend_node::kPoolChangeKernels);
+  tspice_backend_node::InvalidateLeapsecondTable();
+  tspice_backend_node::InvalidateCkCoverageMemos();
+  if (code != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("CSPICE failed while calling furnshBuffer(\"") + PreviewForError(name) + "\")",
+        err);
+    return env.Undefined();
+  }
+
+  // The memfd holds a copy of the kernel until `releaseKernelBuffer`.
+  tspice_backend_node::TrackNativeAllocation(
+      env, tspice_backend_node::NativeMemoryKind::kKernelBuffers, bytes.ByteLength());
+  return Napi::String::New(env, spicePath);
+}
+
+static void ReleaseKernelBuffer(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "releaseKernelBuffer(path: string) expects exactly one string argument"));
+    return;
+  }
+
+  const std::string path = info[0].As<Napi::String>().Utf8Value();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  size_t byteLength = 0;
+  const int code = tspice_release_kernel_buffer(path.c_str(), &byteLength, err, (int)sizeof(err));
+  if (byteLength > 0) {
+    tspice_backend_node::TrackNativeRelease(env, tspice_backend_node::NativeMemoryKind::kKernelBuffers, byteLength);
+  }
+  if (code != 0) {
+    ThrowSpiceError(
+        env,
+        std::string("Failed while calling releaseKernelBuffer(\"") + PreviewForError(path) + "\")",
+        err);
+  }
+}
+
 static Napi::Number Ktotal(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -120,7 +359,7 @@ static Napi::Number Ktotal(const Napi::CallbackInfo& info) {
     kind = info[0].As<Napi::String>().Utf8Value();
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   int count = 0;
   const int code = tspice_ktotal(kind.c_str(), &count, err, (int)sizeof(err));
@@ -164,7 +403,7 @@ static Napi::Object Kdata(const Napi::CallbackInfo& info) {
     kind = info[1].As<Napi::String>().Utf8Value();
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char file[tspice_backend_node::kOutMaxBytes];
@@ -218,7 +457,7 @@ static Napi::Object Kinfo(const Napi::CallbackInfo& info) {
 
   const std::string path = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   char filtyp[tspice_backend_node::kOutMaxBytes];
@@ -325,7 +564,7 @@ static Napi::Object Kxtrct(const Napi::CallbackInfo& info) {
   std::vector<char> wordsqOut(wordsqOutMaxBytes);
   std::vector<char> substr(substrMaxBytes);
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   int found = 0;
@@ -374,7 +613,7 @@ static Napi::Value Kplfrm(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   const uintptr_t idsetPtr = tspice_backend_node::GetCellHandlePtrOrThrow(env, idsetHandle, "kplfrm(idset)", "cell");
   if (env.IsExceptionPending()) {
     return env.Undefined();
@@ -396,7 +635,7 @@ static Napi::Number KtotalAll(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0);
   }
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int total = tspice_ktotal_all(err, (int)sizeof(err));
   if (total < 0) {
@@ -413,6 +652,15 @@ void RegisterKernels(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "furnsh", Napi::Function::New(env, Furnsh), __func__)) return;
   if (!SetExportChecked(env, exports, "unload", Napi::Function::New(env, Unload), __func__)) return;
   if (!SetExportChecked(env, exports, "kclear", Napi::Function::New(env, Kclear), __func__)) return;
+  if (!SetExportChecked(env, exports, "kernelSetSnapshot", Napi::Function::New(env, KernelSetSnapshot), __func__)) return;
+  if (!SetExportChecked(env, exports, "kernelSetRestore", Napi::Function::New(env, KernelSetRestore), __func__)) return;
+  if (!SetExportChecked(env, exports, "registerLazyKernel", Napi::Function::New(env, RegisterLazyKernelJs), __func__)) return;
+  if (!SetExportChecked(env, exports, "unregisterLazyKernel", Napi::Function::New(env, UnregisterLazyKernelJs), __func__)) return;
+  if (!SetExportChecked(env, exports, "setLazyKernelBudget", Napi::Function::New(env, SetLazyKernelBudgetJs), __func__)) return;
+  if (!SetExportChecked(env, exports, "lazyKernelStats", Napi::Function::New(env, LazyKernelStatsJs), __func__)) return;
+  if (!SetExportChecked(env, exports, "kernelBuffersSupported", Napi::Function::New(env, KernelBuffersSupported), __func__)) return;
+  if (!SetExportChecked(env, exports, "furnshBuffer", Napi::Function::New(env, FurnshBuffer), __func__)) return;
+  if (!SetExportChecked(env, exports, "releaseKernelBuffer", Napi::Function::New(env, ReleaseKernelBuffer), __func__)) return;
   if (!SetExportChecked(env, exports, "ktotal", Napi::Function::New(env, Ktotal), __func__)) return;
   if (!SetExportChecked(env, exports, "kdata", Napi::Function::New(env, Kdata), __func__)) return;
   if (!SetExportChecked(env, exports, "kinfo", Napi::Function::New(env, Kinfo), __func__)) return;
@@ -1,13 +1,23 @@
 #include "time.h"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "../addon_common.h"
+#include "../leapseconds.h"
 #include "../napi_helpers.h"
+#include "../sclk_model.h"
 #include "tspice_backend_shim.h"
 
 using tspice_napi::SetExportChecked;
+using tspice_napi::JsStringArrayArg;
 using tspice_napi::PreviewForError;
+using tspice_napi::ReadFloat64ArrayArg;
+using tspice_napi::ReadStringArray;
 using tspice_napi::ThrowSpiceError;
 
 static Napi::Number Str2et(const Napi::CallbackInfo& info) {
@@ -19,7 +29,7 @@ static Napi::Number Str2et(const Napi::CallbackInfo& info) {
   }
 
   const std::string time = info[0].As<Napi::String>().Utf8Value();
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
 
   char err[tspice_backend_node::kErrMaxBytes];
   double et = 0.0;
@@ -49,7 +59,7 @@ static Napi::String Et2utc(const Napi::CallbackInfo& info) {
   const std::string format = info[1].As<Napi::String>().Utf8Value();
   const int prec = info[2].As<Napi::Number>().Int32Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code =
@@ -62,6 +72,134 @@ static Napi::String Et2utc(const Napi::CallbackInfo& info) {
   return Napi::String::New(env, out);
 }
 
+static Napi::Value Str2etBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    ThrowSpiceError(Napi::TypeError::New(env, "str2etBatch(times: string[]) expects exactly one argument"));
+    return env.Undefined();
+  }
+
+  JsStringArrayArg times;
+  if (!ReadStringArray(env, info[0], &times, "times")) {
+    return env.Undefined();
+  }
+
+  const size_t n = times.values.size();
+  Napi::Float64Array out = Napi::Float64Array::New(env, n);
+  double* ets = out.Data();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+
+  std::shared_ptr<const tspice_backend_node::LeapsecondTable> table =
+      tspice_backend_node::EnsureLeapsecondTable();
+  bool utcDefault = false;
+  if (tspice_backend_node::DefaultTimeSystemIsUtc(&utcDefault, err, (int)sizeof(err)) != 0) {
+    ThrowSpiceError(env, "CSPICE failed while calling str2etBatch", err);
+    return env.Undefined();
+  }
+  if (!utcDefault) {
+    table.reset();
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    const std::string& time = times.values[i];
+    double utc = 0.0;
+    if (table != nullptr && tspice_backend_node::ParseIsoUtc(time, &utc) &&
+        tspice_backend_node::UtcToTdb(*table, utc, &ets[i])) {
+      continue;
+    }
+
+    if (tspice_str2et(time.c_str(), &ets[i], err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling str2etBatch(times[") + std::to_string(i) + "]=\"" +
+              PreviewForError(time) + "\")",
+          err,
+          "str2etBatch",
+          [&](Napi::Object& obj) { obj.Set("index", Napi::Number::New(env, (double)i)); });
+      return env.Undefined();
+    }
+  }
+
+  return out;
+}
+
+static Napi::Value Et2utcBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3 || !info[1].IsString() || !info[2].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "et2utcBatch(ets: Float64Array, format: string, prec: number) expects (Float64Array, string, number)"));
+    return env.Undefined();
+  }
+
+  const double* ets = nullptr;
+  size_t n = 0;
+  if (!ReadFloat64ArrayArg(env, info[0], &ets, &n, "ets")) {
+    return env.Undefined();
+  }
+  const std::string format = info[1].As<Napi::String>().Utf8Value();
+  const int prec = info[2].As<Napi::Number>().Int32Value();
+
+  tspice_backend_node::UtcFormat fastFormat = tspice_backend_node::UtcFormat::kCalendar;
+  const bool fastFormatOk = tspice_backend_node::ParseUtcFormat(format, &fastFormat);
+
+  // Element i is bytes[offsets[i], offsets[i + 1]).
+  std::string bytes;
+  std::vector<int32_t> offsets;
+  offsets.reserve(n + 1);
+  offsets.push_back(0);
+
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+
+    std::shared_ptr<const tspice_backend_node::LeapsecondTable> table;
+    if (fastFormatOk) {
+      table = tspice_backend_node::EnsureLeapsecondTable();
+    }
+
+    std::string text;
+    char out[tspice_backend_node::kOutMaxBytes];
+    for (size_t i = 0; i < n; i++) {
+      if (table != nullptr && tspice_backend_node::FormatTdbAsUtc(*table, ets[i], fastFormat, prec, &text)) {
+        bytes += text;
+      } else {
+        if (tspice_et2utc(ets[i], format.c_str(), prec, out, (int)sizeof(out), err, (int)sizeof(err)) != 0) {
+          ThrowSpiceError(
+              env,
+              std::string("CSPICE failed while calling et2utcBatch(ets[") + std::to_string(i) + "])",
+              err,
+              "et2utcBatch",
+              [&](Napi::Object& obj) { obj.Set("index", Napi::Number::New(env, (double)i)); });
+          return env.Undefined();
+        }
+        bytes.append(out, std::strlen(out));
+      }
+      if (bytes.size() > (size_t)INT32_MAX) {
+        ThrowSpiceError(Napi::RangeError::New(env, "et2utcBatch(): output exceeds 2 GiB"));
+        return env.Undefined();
+      }
+      offsets.push_back((int32_t)bytes.size());
+    }
+  }
+
+  Napi::Uint8Array bytesOut = Napi::Uint8Array::New(env, bytes.size());
+  if (!bytes.empty()) {
+    std::memcpy(bytesOut.Data(), bytes.data(), bytes.size());
+  }
+  Napi::Int32Array offsetsOut = Napi::Int32Array::New(env, offsets.size());
+  std::memcpy(offsetsOut.Data(), offsets.data(), offsets.size() * sizeof(int32_t));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("offsets", offsetsOut);
+  result.Set("bytes", bytesOut);
+  return result;
+}
+
 static Napi::String Timout(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -74,7 +212,7 @@ static Napi::String Timout(const Napi::CallbackInfo& info) {
   const double et = info[0].As<Napi::Number>().DoubleValue();
   const std::string picture = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code = tspice_timout(et, picture.c_str(), out, (int)sizeof(out), err, (int)sizeof(err));
@@ -86,6 +224,123 @@ static Napi::String Timout(const Napi::CallbackInfo& info) {
   return Napi::String::New(env, out);
 }
 
+// Snapshot-backed deltet/unitim. `table` may be null (no LSK, or not rebuilt yet); false means the
+// caller must go through CSPICE under the mutex.
+static bool FastDeltet(
+    const tspice_backend_node::LeapsecondTable* table,
+    double epoch,
+    const std::string& eptype,
+    double* outDelta) {
+  if (table == nullptr || (eptype != "ET" && eptype != "UTC")) return false;
+  return tspice_backend_node::DeltetFromTable(*table, epoch, eptype == "UTC", outDelta);
+}
+
+static bool FastUnitim(
+    const tspice_backend_node::LeapsecondTable* table,
+    double epoch,
+    const std::string& insys,
+    const std::string& outsys,
+    double* outEpoch) {
+  return table != nullptr && std::isfinite(epoch) &&
+      tspice_backend_node::UnitimFromTable(*table, epoch, insys, outsys, outEpoch);
+}
+
+// Shared driver for deltetBatch/unitimBatch: the snapshot answers every epoch it can without the
+// CSPICE mutex, and the rest go through CSPICE under a single lock.
+template <typename Fast, typename Slow>
+static Napi::Value TimeConversionBatch(
+    Napi::Env env,
+    const Napi::Value& epochsArg,
+    const char* name,
+    Fast fast,
+    Slow slow) {
+  const double* epochs = nullptr;
+  size_t n = 0;
+  if (!ReadFloat64ArrayArg(env, epochsArg, &epochs, &n, "epochs")) {
+    return env.Undefined();
+  }
+
+  Napi::Float64Array out = Napi::Float64Array::New(env, n);
+  double* values = out.Data();
+
+  std::vector<size_t> pending;
+  {
+    std::shared_ptr<const tspice_backend_node::LeapsecondTable> table =
+        tspice_backend_node::LeapsecondSnapshot();
+    for (size_t i = 0; i < n; i++) {
+      if (!fast(table.get(), epochs[i], &values[i])) pending.push_back(i);
+    }
+  }
+  if (pending.empty()) {
+    return out;
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  std::shared_ptr<const tspice_backend_node::LeapsecondTable> table =
+      tspice_backend_node::EnsureLeapsecondTable();
+  char err[tspice_backend_node::kErrMaxBytes];
+  for (size_t i : pending) {
+    if (fast(table.get(), epochs[i], &values[i])) continue;
+    if (slow(epochs[i], &values[i], err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling ") + name + "(epochs[" + std::to_string(i) + "])",
+          err,
+          name,
+          [&](Napi::Object& obj) { obj.Set("index", Napi::Number::New(env, (double)i)); });
+      return env.Undefined();
+    }
+  }
+  return out;
+}
+
+static Napi::Value DeltetBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[1].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "deltetBatch(epochs: Float64Array, eptype: string) expects (Float64Array, string)"));
+    return env.Undefined();
+  }
+  const std::string eptype = info[1].As<Napi::String>().Utf8Value();
+
+  return TimeConversionBatch(
+      env,
+      info[0],
+      "deltetBatch",
+      [&](const tspice_backend_node::LeapsecondTable* table, double epoch, double* out) {
+        return FastDeltet(table, epoch, eptype, out);
+      },
+      [&](double epoch, double* out, char* err, int errMaxBytes) {
+        return tspice_deltet(epoch, eptype.c_str(), out, err, errMaxBytes);
+      });
+}
+
+static Napi::Value UnitimBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 3 || !info[1].IsString() || !info[2].IsString()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "unitimBatch(epochs: Float64Array, insys: string, outsys: string) expects (Float64Array, string, string)"));
+    return env.Undefined();
+  }
+  const std::string insys = info[1].As<Napi::String>().Utf8Value();
+  const std::string outsys = info[2].As<Napi::String>().Utf8Value();
+
+  return TimeConversionBatch(
+      env,
+      info[0],
+      "unitimBatch",
+      [&](const tspice_backend_node::LeapsecondTable* table, double epoch, double* out) {
+        return FastUnitim(table, epoch, insys, outsys, out);
+      },
+      [&](double epoch, double* out, char* err, int errMaxBytes) {
+        return tspice_unitim(epoch, insys.c_str(), outsys.c_str(), out, err, errMaxBytes);
+      });
+}
+
 static Napi::Number Deltet(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -99,9 +354,16 @@ static Napi::Number Deltet(const Napi::CallbackInfo& info) {
   const double epoch = info[0].As<Napi::Number>().DoubleValue();
   const std::string eptype = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double delta = 0.0;
+  if (FastDeltet(tspice_backend_node::LeapsecondSnapshot().get(), epoch, eptype, &delta)) {
+    return Napi::Number::New(env, delta);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  if (FastDeltet(tspice_backend_node::EnsureLeapsecondTable().get(), epoch, eptype, &delta)) {
+    return Napi::Number::New(env, delta);
+  }
+  char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_deltet(epoch, eptype.c_str(), &delta, err, (int)sizeof(err));
   if (code != 0) {
     ThrowSpiceError(env, "CSPICE failed while calling deltet", err);
@@ -125,9 +387,16 @@ static Napi::Number Unitim(const Napi::CallbackInfo& info) {
   const std::string insys = info[1].As<Napi::String>().Utf8Value();
   const std::string outsys = info[2].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
-  char err[tspice_backend_node::kErrMaxBytes];
   double outEpoch = 0.0;
+  if (FastUnitim(tspice_backend_node::LeapsecondSnapshot().get(), epoch, insys, outsys, &outEpoch)) {
+    return Napi::Number::New(env, outEpoch);
+  }
+
+  tspice_backend_node::CspiceLock lock;
+  if (FastUnitim(tspice_backend_node::EnsureLeapsecondTable().get(), epoch, insys, outsys, &outEpoch)) {
+    return Napi::Number::New(env, outEpoch);
+  }
+  char err[tspice_backend_node::kErrMaxBytes];
   const int code =
       tspice_unitim(epoch, insys.c_str(), outsys.c_str(), &outEpoch, err, (int)sizeof(err));
   if (code != 0) {
@@ -148,7 +417,7 @@ static Napi::Number Tparse(const Napi::CallbackInfo& info) {
 
   const std::string timstr = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double et = 0.0;
   const int code = tspice_tparse(timstr.c_str(), &et, err, (int)sizeof(err));
@@ -175,7 +444,7 @@ static Napi::String Tpictr(const Napi::CallbackInfo& info) {
   const std::string sample = info[0].As<Napi::String>().Utf8Value();
   const std::string picturIn = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code =
@@ -198,7 +467,7 @@ static Napi::String TimdefGet(const Napi::CallbackInfo& info) {
 
   const std::string item = info[0].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code = tspice_timdef_get(item.c_str(), out, (int)sizeof(out), err, (int)sizeof(err));
@@ -223,7 +492,7 @@ static void TimdefSet(const Napi::CallbackInfo& info) {
   const std::string item = info[0].As<Napi::String>().Utf8Value();
   const std::string value = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   const int code = tspice_timdef_set(item.c_str(), value.c_str(), err, (int)sizeof(err));
   if (code != 0) {
@@ -243,7 +512,7 @@ static Napi::Number Scs2e(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const std::string sclkch = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double et = 0.0;
   const int code = tspice_scs2e(sc, sclkch.c_str(), &et, err, (int)sizeof(err));
@@ -266,7 +535,7 @@ static Napi::String Sce2s(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const double et = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code = tspice_sce2s(sc, et, out, (int)sizeof(out), err, (int)sizeof(err));
@@ -290,7 +559,7 @@ static Napi::Number Scencd(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const std::string sclkch = info[1].As<Napi::String>().Utf8Value();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double sclkdp = 0.0;
   const int code = tspice_scencd(sc, sclkch.c_str(), &sclkdp, err, (int)sizeof(err));
@@ -314,7 +583,7 @@ static Napi::String Scdecd(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const double sclkdp = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   char out[tspice_backend_node::kOutMaxBytes];
   const int code = tspice_scdecd(sc, sclkdp, out, (int)sizeof(out), err, (int)sizeof(err));
@@ -337,7 +606,7 @@ static Napi::Number Sct2e(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const double sclkdp = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double et = 0.0;
   const int code = tspice_sct2e(sc, sclkdp, &et, err, (int)sizeof(err));
@@ -360,7 +629,7 @@ static Napi::Number Sce2c(const Napi::CallbackInfo& info) {
   const int sc = info[0].As<Napi::Number>().Int32Value();
   const double et = info[1].As<Napi::Number>().DoubleValue();
 
-  std::lock_guard<std::mutex> lock(tspice_backend_node::g_cspice_mutex);
+  tspice_backend_node::CspiceLock lock;
   char err[tspice_backend_node::kErrMaxBytes];
   double sclkdp = 0.0;
   const int code = tspice_sce2c(sc, et, &sclkdp, err, (int)sizeof(err));
@@ -372,15 +641,241 @@ static Napi::Number Sce2c(const Napi::CallbackInfo& info) {
   return Napi::Number::New(env, sclkdp);
 }
 
+// --- SCLK batches ---
+//
+// Ticks <-> ET go through the native type 1 model when it covers the value (see sclk_model.h) and
+// through `sct2e_c` / `sce2c_c` otherwise; string encoding and decoding stay in CSPICE. Each batch
+// takes the CSPICE mutex once.
+
+// Native ticks <-> ET for one spacecraft, resolved once per batch.
+struct SclkFastPath {
+  std::shared_ptr<const tspice_backend_node::SclkModel> model;
+  std::shared_ptr<const tspice_backend_node::LeapsecondTable> lsk;
+
+  explicit SclkFastPath(int sc) : model(tspice_backend_node::EnsureSclkModel(sc)) {
+    if (model != nullptr && model->tdt) lsk = tspice_backend_node::EnsureLeapsecondTable();
+  }
+
+  int TicksToEt(int sc, double ticks, double* outEt, char* err, int errMaxBytes) const {
+    if (model != nullptr && tspice_backend_node::SclkTicksToEt(*model, lsk.get(), ticks, outEt)) return 0;
+    return tspice_sct2e(sc, ticks, outEt, err, errMaxBytes);
+  }
+
+  int EtToTicks(int sc, double et, double* outTicks, char* err, int errMaxBytes) const {
+    if (model != nullptr && tspice_backend_node::SclkEtToTicks(*model, lsk.get(), et, outTicks)) return 0;
+    return tspice_sce2c(sc, et, outTicks, err, errMaxBytes);
+  }
+};
+
+static void ThrowSclkBatchError(
+    Napi::Env env,
+    const char* name,
+    const char* argName,
+    size_t i,
+    const char* err) {
+  ThrowSpiceError(
+      env,
+      std::string("CSPICE failed while calling ") + name + "(" + argName + "[" + std::to_string(i) + "])",
+      err,
+      name,
+      [&](Napi::Object& obj) { obj.Set("index", Napi::Number::New(env, (double)i)); });
+}
+
+// (sc, Float64Array) -> Float64Array.
+template <typename Convert>
+static Napi::Value SclkNumericBatch(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* argName,
+    Convert convert) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) + "(sc: number, " + argName + ": Float64Array) expects (number, Float64Array)"));
+    return env.Undefined();
+  }
+  const int sc = info[0].As<Napi::Number>().Int32Value();
+  const double* values = nullptr;
+  size_t n = 0;
+  if (!ReadFloat64ArrayArg(env, info[1], &values, &n, argName)) {
+    return env.Undefined();
+  }
+
+  Napi::Float64Array out = Napi::Float64Array::New(env, n);
+  double* outValues = out.Data();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const SclkFastPath fast(sc);
+  for (size_t i = 0; i < n; i++) {
+    if (convert(fast, sc, values[i], &outValues[i], err, (int)sizeof(err)) != 0) {
+      ThrowSclkBatchError(env, name, argName, i, err);
+      return env.Undefined();
+    }
+  }
+  return out;
+}
+
+// (sc, string[]) -> Float64Array.
+template <typename Convert>
+static Napi::Value SclkParseBatch(const Napi::CallbackInfo& info, const char* name, Convert convert) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, std::string(name) + "(sc: number, sclkchs: string[]) expects (number, string[])"));
+    return env.Undefined();
+  }
+  const int sc = info[0].As<Napi::Number>().Int32Value();
+  JsStringArrayArg sclkchs;
+  if (!ReadStringArray(env, info[1], &sclkchs, "sclkchs")) {
+    return env.Undefined();
+  }
+
+  const size_t n = sclkchs.values.size();
+  Napi::Float64Array out = Napi::Float64Array::New(env, n);
+  double* outValues = out.Data();
+
+  tspice_backend_node::CspiceLock lock;
+  char err[tspice_backend_node::kErrMaxBytes];
+  const SclkFastPath fast(sc);
+  for (size_t i = 0; i < n; i++) {
+    if (convert(fast, sc, sclkchs.values[i].c_str(), &outValues[i], err, (int)sizeof(err)) != 0) {
+      ThrowSpiceError(
+          env,
+          std::string("CSPICE failed while calling ") + name + "(sclkchs[" + std::to_string(i) + "]=\"" +
+              PreviewForError(sclkchs.values[i]) + "\")",
+          err,
+          name,
+          [&](Napi::Object& obj) { obj.Set("index", Napi::Number::New(env, (double)i)); });
+      return env.Undefined();
+    }
+  }
+  return out;
+}
+
+// (sc, Float64Array) -> { offsets, bytes }, like et2utcBatch.
+static Napi::Value SclkFormatBatch(
+    const Napi::CallbackInfo& info,
+    const char* name,
+    const char* argName,
+    int (*format)(int, double, char*, int, char*, int)) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 2 || !info[0].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(name) + "(sc: number, " + argName + ": Float64Array) expects (number, Float64Array)"));
+    return env.Undefined();
+  }
+  const int sc = info[0].As<Napi::Number>().Int32Value();
+  const double* values = nullptr;
+  size_t n = 0;
+  if (!ReadFloat64ArrayArg(env, info[1], &values, &n, argName)) {
+    return env.Undefined();
+  }
+
+  // Element i is bytes[offsets[i], offsets[i + 1]).
+  std::string bytes;
+  std::vector<int32_t> offsets;
+  offsets.reserve(n + 1);
+  offsets.push_back(0);
+
+  {
+    tspice_backend_node::CspiceLock lock;
+    char err[tspice_backend_node::kErrMaxBytes];
+    char out[tspice_backend_node::kOutMaxBytes];
+    for (size_t i = 0; i < n; i++) {
+      if (format(sc, values[i], out, (int)sizeof(out), err, (int)sizeof(err)) != 0) {
+        ThrowSclkBatchError(env, name, argName, i, err);
+        return env.Undefined();
+      }
+      bytes.append(out, std::strlen(out));
+      if (bytes.size() > (size_t)INT32_MAX) {
+        ThrowSpiceError(Napi::RangeError::New(env, std::string(name) + "(): output exceeds 2 GiB"));
+        return env.Undefined();
+      }
+      offsets.push_back((int32_t)bytes.size());
+    }
+  }
+
+  Napi::Uint8Array bytesOut = Napi::Uint8Array::New(env, bytes.size());
+  if (!bytes.empty()) {
+    std::memcpy(bytesOut.Data(), bytes.data(), bytes.size());
+  }
+  Napi::Int32Array offsetsOut = Napi::Int32Array::New(env, offsets.size());
+  std::memcpy(offsetsOut.Data(), offsets.data(), offsets.size() * sizeof(int32_t));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("offsets", offsetsOut);
+  result.Set("bytes", bytesOut);
+  return result;
+}
+
+static Napi::Value Sct2eBatch(const Napi::CallbackInfo& info) {
+  return SclkNumericBatch(
+      info,
+      "sct2eBatch",
+      "sclkdps",
+      [](const SclkFastPath& fast, int sc, double sclkdp, double* out, char* err, int errMaxBytes) {
+        return fast.TicksToEt(sc, sclkdp, out, err, errMaxBytes);
+      });
+}
+
+static Napi::Value Sce2cBatch(const Napi::CallbackInfo& info) {
+  return SclkNumericBatch(
+      info,
+      "sce2cBatch",
+      "ets",
+      [](const SclkFastPath& fast, int sc, double et, double* out, char* err, int errMaxBytes) {
+        return fast.EtToTicks(sc, et, out, err, errMaxBytes);
+      });
+}
+
+static Napi::Value ScencdBatch(const Napi::CallbackInfo& info) {
+  return SclkParseBatch(
+      info,
+      "scencdBatch",
+      [](const SclkFastPath&, int sc, const char* sclkch, double* out, char* err, int errMaxBytes) {
+        return tspice_scencd(sc, sclkch, out, err, errMaxBytes);
+      });
+}
+
+// scs2e_c is scencd_c followed by sct2e_c; only the second half has a native path.
+static Napi::Value Scs2eBatch(const Napi::CallbackInfo& info) {
+  return SclkParseBatch(
+      info,
+      "scs2eBatch",
+      [](const SclkFastPath& fast, int sc, const char* sclkch, double* out, char* err, int errMaxBytes) {
+        double sclkdp = 0.0;
+        if (tspice_scencd(sc, sclkch, &sclkdp, err, errMaxBytes) != 0) return 1;
+        return fast.TicksToEt(sc, sclkdp, out, err, errMaxBytes);
+      });
+}
+
+static Napi::Value ScdecdBatch(const Napi::CallbackInfo& info) {
+  return SclkFormatBatch(info, "scdecdBatch", "sclkdps", tspice_scdecd);
+}
+
+static Napi::Value Sce2sBatch(const Napi::CallbackInfo& info) {
+  return SclkFormatBatch(info, "sce2sBatch", "ets", tspice_sce2s);
+}
+
 namespace tspice_backend_node {
 
 void RegisterTime(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "str2et", Napi::Function::New(env, Str2et), __func__)) return;
   if (!SetExportChecked(env, exports, "et2utc", Napi::Function::New(env, Et2utc), __func__)) return;
+  if (!SetExportChecked(env, exports, "str2etBatch", Napi::Function::New(env, Str2etBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "et2utcBatch", Napi::Function::New(env, Et2utcBatch), __func__)) return;
   if (!SetExportChecked(env, exports, "timout", Napi::Function::New(env, Timout), __func__)) return;
 
   if (!SetExportChecked(env, exports, "deltet", Napi::Function::New(env, Deltet), __func__)) return;
   if (!SetExportChecked(env, exports, "unitim", Napi::Function::New(env, Unitim), __func__)) return;
+  if (!SetExportChecked(env, exports, "deltetBatch", Napi::Function::New(env, DeltetBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "unitimBatch", Napi::Function::New(env, UnitimBatch), __func__)) return;
   if (!SetExportChecked(env, exports, "tparse", Napi::Function::New(env, Tparse), __func__)) return;
   if (!SetExportChecked(env, exports, "tpictr", Napi::Function::New(env, Tpictr), __func__)) return;
   if (!SetExportChecked(env, exports, "timdefGet", Napi::Function::New(env, TimdefGet), __func__)) return;
@@ -392,6 +887,12 @@ void RegisterTime(Napi::Env env, Napi::Object exports) {
   if (!SetExportChecked(env, exports, "scdecd", Napi::Function::New(env, Scdecd), __func__)) return;
   if (!SetExportChecked(env, exports, "sct2e", Napi::Function::New(env, Sct2e), __func__)) return;
   if (!SetExportChecked(env, exports, "sce2c", Napi::Function::New(env, Sce2c), __func__)) return;
+  if (!SetExportChecked(env, exports, "scs2eBatch", Napi::Function::New(env, Scs2eBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "sce2sBatch", Napi::Function::New(env, Sce2sBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "scencdBatch", Napi::Function::New(env, ScencdBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "scdecdBatch", Napi::Function::New(env, ScdecdBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "sct2eBatch", Napi::Function::New(env, Sct2eBatch), __func__)) return;
+  if (!SetExportChecked(env, exports, "sce2cBatch", Napi::Function::New(env, Sce2cBatch), __func__)) return;
 }
 
 }  // namespace tspice_backend_node
@@ -0,0 +1,416 @@
+#include "dsk_bvh.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace tspice_backend_node {
+
+namespace {
+
+constexpr uint32_t kLeafPlates = 4;
+// Past this depth nodes become leaves whatever their size, so traversal fits a fixed stack.
+constexpr int kMaxDepth = 60;
+constexpr int kBins = 16;
+// A multiple of 8, so no two threads ever write the same byte of the found bitmap.
+constexpr size_t kRaysPerBlock = 256;
+// Barycentric slack so a ray through an edge shared by two plates cannot slip between them.
+constexpr double kEdgeTol = 1e-10;
+// Boxes are padded by this fraction of the mesh extent for the same reason.
+constexpr double kBoxPad = 1e-9;
+
+struct Bounds {
+  double lo[3];
+  double hi[3];
+
+  void Reset() {
+    for (int k = 0; k < 3; k++) {
+      lo[k] = std::numeric_limits<double>::infinity();
+      hi[k] = -std::numeric_limits<double>::infinity();
+    }
+  }
+
+  void Grow(const double p[3]) {
+    for (int k = 0; k < 3; k++) {
+      lo[k] = std::min(lo[k], p[k]);
+      hi[k] = std::max(hi[k], p[k]);
+    }
+  }
+
+  void Grow(const Bounds& b) {
+    for (int k = 0; k < 3; k++) {
+      lo[k] = std::min(lo[k], b.lo[k]);
+      hi[k] = std::max(hi[k], b.hi[k]);
+    }
+  }
+
+  bool Empty() const { return lo[0] > hi[0]; }
+
+  double HalfArea() const {
+    if (Empty()) return 0;
+    const double dx = hi[0] - lo[0];
+    const double dy = hi[1] - lo[1];
+    const double dz = hi[2] - lo[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+};
+
+// Slab test; returns the entry distance, or infinity when the ray misses the box or enters it
+// beyond `tmax`.
+inline double EnterBox(
+    const double lo[3],
+    const double hi[3],
+    const double o[3],
+    const double d[3],
+    const double inv[3],
+    double tmax) {
+  double t0 = 0;
+  double t1 = tmax;
+  for (int k = 0; k < 3; k++) {
+    if (d[k] == 0) {
+      if (o[k] < lo[k] || o[k] > hi[k]) return std::numeric_limits<double>::infinity();
+      continue;
+    }
+    double a = (lo[k] - o[k]) * inv[k];
+    double b = (hi[k] - o[k]) * inv[k];
+    if (a > b) std::swap(a, b);
+    t0 = std::max(t0, a);
+    t1 = std::min(t1, b);
+    if (t0 > t1) return std::numeric_limits<double>::infinity();
+  }
+  return t0;
+}
+
+uint32_t RegistryNextId = 1;
+std::mutex& RegistryMutex() {
+  static std::mutex m;
+  return m;
+}
+std::unordered_map<uint32_t, std::shared_ptr<const DskPlateBvh>>& Registry() {
+  static std::unordered_map<uint32_t, std::shared_ptr<const DskPlateBvh>> m;
+  return m;
+}
+
+}  // namespace
+
+// Binned surface-area-heuristic build over plate centroids, iterative so that a badly clustered
+// mesh cannot overflow the native stack.
+class DskPlateBvhBuilder {
+ public:
+  static std::shared_ptr<const DskPlateBvh> Build(const std::vector<double>& vertices, const std::vector<int32_t>& plates) {
+    const size_t nv = vertices.size() / 3;
+    const size_t np = plates.size() / 3;
+    for (int32_t idx : plates) {
+      if (idx < 1 || static_cast<size_t>(idx) > nv) return nullptr;
+    }
+
+    auto out = std::make_shared<DskPlateBvh>();
+    if (np == 0) return out;
+
+    double scale = 0;
+    for (double c : vertices) scale = std::max(scale, std::fabs(c));
+    const double pad = kBoxPad * scale;
+
+    std::vector<Bounds> boxes(np);
+    std::vector<double> centroids(np * 3);
+    for (size_t p = 0; p < np; p++) {
+      boxes[p].Reset();
+      for (int j = 0; j < 3; j++) {
+        boxes[p].Grow(&vertices[(static_cast<size_t>(plates[p * 3 + j]) - 1) * 3]);
+      }
+      for (int k = 0; k < 3; k++) {
+        boxes[p].lo[k] -= pad;
+        boxes[p].hi[k] += pad;
+        centroids[p * 3 + k] = 0.5 * (boxes[p].lo[k] + boxes[p].hi[k]);
+      }
+    }
+
+    std::vector<uint32_t> order(np);
+    for (size_t p = 0; p < np; p++) order[p] = static_cast<uint32_t>(p);
+
+    struct Pending {
+      uint32_t node;
+      uint32_t begin;
+      uint32_t end;
+      int depth;
+    };
+    std::vector<Pending> stack;
+    out->nodes_.reserve(2 * np / kLeafPlates + 1);
+    out->nodes_.push_back({});
+    stack.push_back({0, 0, static_cast<uint32_t>(np), 0});
+
+    while (!stack.empty()) {
+      const Pending job = stack.back();
+      stack.pop_back();
+
+      Bounds box;
+      Bounds cbox;
+      box.Reset();
+      cbox.Reset();
+      for (uint32_t i = job.begin; i < job.end; i++) {
+        box.Grow(boxes[order[i]]);
+        cbox.Grow(&centroids[order[i] * 3]);
+      }
+
+      const uint32_t count = job.end - job.begin;
+      uint32_t mid = job.begin;
+      if (count > kLeafPlates && job.depth < kMaxDepth) {
+        mid = SplitSah(box, cbox, boxes, centroids, order, job.begin, job.end);
+      }
+
+      DskPlateBvh::Node& node = out->nodes_[job.node];
+      for (int k = 0; k < 3; k++) {
+        node.lo[k] = box.lo[k];
+        node.hi[k] = box.hi[k];
+      }
+      if (mid == job.begin || mid == job.end) {
+        node.first = job.begin;
+        node.count = count;
+        continue;
+      }
+
+      // Siblings are adjacent, so an interior node only stores its left child.
+      const uint32_t left = static_cast<uint32_t>(out->nodes_.size());
+      out->nodes_.push_back({});
+      out->nodes_.push_back({});
+      out->nodes_[job.node].first = left;
+      out->nodes_[job.node].count = 0;
+      stack.push_back({left + 1, mid, job.end, job.depth + 1});
+      stack.push_back({left, job.begin, mid, job.depth + 1});
+    }
+
+    out->tris_.resize(np * 9);
+    out->plateIds_.resize(np);
+    for (size_t i = 0; i < np; i++) {
+      const size_t p = order[i];
+      const double* v1 = &vertices[(static_cast<size_t>(plates[p * 3]) - 1) * 3];
+      const double* v2 = &vertices[(static_cast<size_t>(plates[p * 3 + 1]) - 1) * 3];
+      const double* v3 = &vertices[(static_cast<size_t>(plates[p * 3 + 2]) - 1) * 3];
+      double* t = &out->tris_[i * 9];
+      for (int k = 0; k < 3; k++) {
+        t[k] = v1[k];
+        t[3 + k] = v2[k] - v1[k];
+        t[6 + k] = v3[k] - v1[k];
+      }
+      out->plateIds_[i] = static_cast<int32_t>(p + 1);
+    }
+    return out;
+  }
+
+ private:
+  // Partitions `order[begin, end)` and returns the split point; `begin` means "make a leaf".
+  static uint32_t SplitSah(
+      const Bounds& box,
+      const Bounds& cbox,
+      const std::vector<Bounds>& boxes,
+      const std::vector<double>& centroids,
+      std::vector<uint32_t>& order,
+      uint32_t begin,
+      uint32_t end) {
+    const uint32_t count = end - begin;
+    int bestAxis = -1;
+    int bestBin = 0;
+    double bestCost = std::numeric_limits<double>::infinity();
+
+    for (int axis = 0; axis < 3; axis++) {
+      const double extent = cbox.hi[axis] - cbox.lo[axis];
+      if (!(extent > 0)) continue;
+      const double k = kBins / extent;
+
+      Bounds binBox[kBins];
+      uint32_t binCount[kBins] = {};
+      for (int b = 0; b < kBins; b++) binBox[b].Reset();
+      for (uint32_t i = begin; i < end; i++) {
+        const uint32_t p = order[i];
+        const int b = std::min(kBins - 1, static_cast<int>((centroids[p * 3 + axis] - cbox.lo[axis]) * k));
+        binCount[b]++;
+        binBox[b].Grow(boxes[p]);
+      }
+
+      // Right-to-left sweep first, then evaluate every split from the left.
+      double rightArea[kBins];
+      uint32_t rightCount[kBins];
+      Bounds acc;
+      acc.Reset();
+      uint32_t n = 0;
+      for (int b = kBins - 1; b > 0; b--) {
+        acc.Grow(binBox[b]);
+        n += binCount[b];
+        rightArea[b] = acc.HalfArea();
+        rightCount[b] = n;
+      }
+      acc.Reset();
+      n = 0;
+      for (int b = 0; b < kBins - 1; b++) {
+        acc.Grow(binBox[b]);
+        n += binCount[b];
+        if (n == 0 || rightCount[b + 1] == 0) continue;
+        const double cost = acc.HalfArea() * n + rightArea[b + 1] * rightCount[b + 1];
+        if (cost < bestCost) {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = b;
+        }
+      }
+    }
+
+    if (bestAxis < 0) {
+      // Every centroid coincides: no spatial split exists, so halve the range instead.
+      return begin + count / 2;
+    }
+    if (count <= 4 * kLeafPlates && bestCost >= box.HalfArea() * count) {
+      return begin;
+    }
+
+    const double lo = cbox.lo[bestAxis];
+    const double k = kBins / (cbox.hi[bestAxis] - lo);
+    auto* first = order.data() + begin;
+    auto* split = std::partition(first, order.data() + end, [&](uint32_t p) {
+      return std::min(kBins - 1, static_cast<int>((centroids[p * 3 + bestAxis] - lo) * k)) <= bestBin;
+    });
+    return begin + static_cast<uint32_t>(split - first);
+  }
+};
+
+std::shared_ptr<const DskPlateBvh> DskPlateBvh::Build(
+    const std::vector<double>& vertices,
+    const std::vector<int32_t>& plates) {
+  return DskPlateBvhBuilder::Build(vertices, plates);
+}
+
+bool DskPlateBvh::Raycast(const double o[3], const double d[3], double outPoint[3], int32_t* outPlate) const {
+  if (nodes_.empty() || plateIds_.empty()) return false;
+
+  double inv[3];
+  for (int k = 0; k < 3; k++) inv[k] = d[k] != 0 ? 1 / d[k] : 0;
+
+  double best = std::numeric_limits<double>::infinity();
+  size_t bestTri = 0;
+  bool hit = false;
+
+  uint32_t stack[kMaxDepth + 4];
+  int top = 0;
+  stack[top++] = 0;
+
+  while (top > 0) {
+    const Node& node = nodes_[stack[--top]];
+    // Skip subtrees whose box lies beyond a hit found since they were pushed.
+    if (EnterBox(node.lo, node.hi, o, d, inv, best) == std::numeric_limits<double>::infinity()) continue;
+
+    if (node.count == 0) {
+      const uint32_t l = node.first;
+      const double tl = EnterBox(nodes_[l].lo, nodes_[l].hi, o, d, inv, best);
+      const double tr = EnterBox(nodes_[l + 1].lo, nodes_[l + 1].hi, o, d, inv, best);
+      const bool lHit = tl != std::numeric_limits<double>::infinity();
+      const bool rHit = tr != std::numeric_limits<double>::infinity();
+      // Push the farther child first so the nearer one is visited (and can shrink `best`) first.
+      if (lHit && rHit) {
+        stack[top++] = tl <= tr ? l + 1 : l;
+        stack[top++] = tl <= tr ? l : l + 1;
+      } else if (lHit) {
+        stack[top++] = l;
+      } else if (rHit) {
+        stack[top++] = l + 1;
+      }
+      continue;
+    }
+
+    for (uint32_t i = node.first; i < node.first + node.count; i++) {
+      // Moller-Trumbore.
+      const double* t = &tris_[static_cast<size_t>(i) * 9];
+      const double* e1 = t + 3;
+      const double* e2 = t + 6;
+      const double p[3] = {d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0]};
+      const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+      if (det == 0) continue;
+      const double invDet = 1 / det;
+      const double s[3] = {o[0] - t[0], o[1] - t[1], o[2] - t[2]};
+      const double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+      if (u < -kEdgeTol || u > 1 + kEdgeTol) continue;
+      const double q[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+      const double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * invDet;
+      if (v < -kEdgeTol || u + v > 1 + kEdgeTol) continue;
+      const double dist = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+      if (dist < 0 || dist >= best) continue;
+      best = dist;
+      bestTri = i;
+      hit = true;
+    }
+  }
+
+  if (!hit) return false;
+  for (int k = 0; k < 3; k++) outPoint[k] = o[k] + best * d[k];
+  *outPlate = plateIds_[bestTri];
+  return true;
+}
+
+void RaycastDskBvhBatch(
+    const DskPlateBvh& bvh,
+    const double* vertices,
+    bool sharedVertex,
+    const double* raydirs,
+    bool sharedRaydir,
+    size_t n,
+    unsigned threads,
+    double* outPoints,
+    int32_t* outPlates,
+    uint8_t* outFoundBits) {
+  const size_t blocks = (n + kRaysPerBlock - 1) / kRaysPerBlock;
+  std::atomic<size_t> next{0};
+
+  auto work = [&]() {
+    for (size_t b = next.fetch_add(1); b < blocks; b = next.fetch_add(1)) {
+      const size_t end = std::min(n, (b + 1) * kRaysPerBlock);
+      std::fill(outFoundBits + b * kRaysPerBlock / 8, outFoundBits + (end + 7) / 8, uint8_t{0});
+      for (size_t i = b * kRaysPerBlock; i < end; i++) {
+        const double* o = sharedVertex ? vertices : vertices + i * 3;
+        const double* d = sharedRaydir ? raydirs : raydirs + i * 3;
+        double* point = outPoints + i * 3;
+        if (bvh.Raycast(o, d, point, &outPlates[i])) {
+          outFoundBits[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+        } else {
+          point[0] = point[1] = point[2] = 0;
+          outPlates[i] = 0;
+        }
+      }
+    }
+  };
+
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const size_t workers = std::min<size_t>(threads, blocks);
+  std::vector<std::thread> pool;
+  for (size_t t = 1; t < workers; t++) pool.emplace_back(work);
+  work();
+  for (std::thread& t : pool) t.join();
+}
+
+uint32_t RegisterDskBvh(std::shared_ptr<const DskPlateBvh> bvh) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  const uint32_t id = RegistryNextId++;
+  Registry().emplace(id, std::move(bvh));
+  return id;
+}
+
+std::shared_ptr<const DskPlateBvh> LookupDskBvh(uint32_t id) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  auto it = Registry().find(id);
+  return it == Registry().end() ? nullptr : it->second;
+}
+
+bool ReleaseDskBvh(uint32_t id, size_t* outBytes) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  auto it = Registry().find(id);
+  if (it == Registry().end()) return false;
+  if (outBytes != nullptr) *outBytes = it->second->ByteSize();
+  Registry().erase(it);
+  return true;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace tspice_backend_node {
+
+// In-memory bounding volume hierarchy over the plates of one type 2 DSK segment.
+//
+// The mesh is copied out of the DSK once (`dskv02_c` / `dskp02_c`, under the CSPICE lock) and the
+// tree is built from that copy, so a built index never touches CSPICE again: ray casts take no
+// lock and may run on several threads at once. Coordinates are those of the segment's reference
+// frame; plate IDs are one-based, as in the DSK.
+class DskPlateBvh {
+ public:
+  // `vertices` holds 3 doubles per vertex; `plates` holds 3 one-based vertex indices per plate.
+  // Returns null when a plate refers to a vertex outside `[1, nv]`.
+  static std::shared_ptr<const DskPlateBvh> Build(const std::vector<double>& vertices, const std::vector<int32_t>& plates);
+
+  size_t PlateCount() const { return plateIds_.size(); }
+  size_t NodeCount() const { return nodes_.size(); }
+  // Bytes held by the tree and its plate copy.
+  size_t ByteSize() const {
+    return nodes_.capacity() * sizeof(Node) + tris_.capacity() * sizeof(double) + plateIds_.capacity() * sizeof(int32_t);
+  }
+
+  // Nearest intersection of the ray `vertex + t * raydir` (t >= 0) with the mesh. On a hit writes
+  // the surface point and the one-based plate ID and returns true.
+  bool Raycast(const double vertex[3], const double raydir[3], double outPoint[3], int32_t* outPlate) const;
+
+ private:
+  struct Node {
+    double lo[3];
+    double hi[3];
+    // Interior nodes: `first` is the left child (the right child is `first + 1`) and `count` is
+    // 0. Leaves: plates `[first, first + count)` of the reordered plate arrays.
+    uint32_t first;
+    uint32_t count;
+  };
+
+  std::vector<Node> nodes_;
+  // Per plate, in leaf order: vertex 1 and the two edges from it (9 doubles).
+  std::vector<double> tris_;
+  std::vector<int32_t> plateIds_;
+
+  friend class DskPlateBvhBuilder;
+};
+
+// Casts `n` rays against `bvh`. `vertices` and `raydirs` hold either 3 doubles (one ray origin or
+// direction shared by every ray) or `3 * n`. Writes `3 * n` points, `n` plate IDs (0 on a miss)
+// and a found bitmap of `ceil(n / 8)` bytes (bit `i % 8` of byte `i / 8`). Work is split into
+// blocks across up to `threads` threads (0 = hardware concurrency).
+void RaycastDskBvhBatch(
+    const DskPlateBvh& bvh,
+    const double* vertices,
+    bool sharedVertex,
+    const double* raydirs,
+    bool sharedRaydir,
+    size_t n,
+    unsigned threads,
+    double* outPoints,
+    int32_t* outPlates,
+    uint8_t* outFoundBits);
+
+// Built indexes, keyed by the ids handed out to JS. Guarded by their own mutex (not the CSPICE
+// one); lookups return a reference that keeps the index alive for the duration of a cast even if
+// JS frees it concurrently.
+uint32_t RegisterDskBvh(std::shared_ptr<const DskPlateBvh> bvh);
+std::shared_ptr<const DskPlateBvh> LookupDskBvh(uint32_t id);
+// On success, `*outBytes` (when given) is the released index's `ByteSize()`.
+bool ReleaseDskBvh(uint32_t id, size_t* outBytes = nullptr);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,202 @@
+#include "ephemeris_table.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace tspice_backend_node {
+
+namespace {
+
+constexpr uint32_t kCoefficients = 12;
+const double kPi = std::acos(-1.0);
+
+// Pieces are not split below this width (seconds); a piece that still misses a tolerance there is
+// kept, and its position error is reported through `maxError`.
+constexpr double kMinWidth = 1.0;
+
+// Chebyshev coefficients of degree `kCoefficients - 1` interpolating `values` at the first-kind
+// nodes `cos(pi (k + 1/2) / N)`. `c[0]` is already halved, so the series is `sum c[j] T_j(x)`.
+void FitChebyshev(const double* values, size_t stride, double* out) {
+  const uint32_t n = kCoefficients;
+  for (uint32_t j = 0; j < n; j++) {
+    double sum = 0.0;
+    for (uint32_t k = 0; k < n; k++) {
+      sum += values[k * stride] * std::cos(kPi * j * (k + 0.5) / n);
+    }
+    out[j] = (j == 0 ? 1.0 : 2.0) * sum / n;
+  }
+}
+
+// Value and d/dx of `sum c[j] T_j(x)`.
+void EvalChebyshev(const double* c, uint32_t n, double x, double* outValue, double* outSlope) {
+  double t0 = 1.0;
+  double t1 = x;
+  double d0 = 0.0;
+  double d1 = 1.0;
+  double value = c[0];
+  double slope = 0.0;
+  if (n > 1) {
+    value += c[1] * x;
+    slope += c[1];
+  }
+  for (uint32_t j = 2; j < n; j++) {
+    const double t2 = 2.0 * x * t1 - t0;
+    const double d2 = 2.0 * t1 + 2.0 * x * d1 - d0;
+    value += c[j] * t2;
+    slope += c[j] * d2;
+    t0 = t1;
+    t1 = t2;
+    d0 = d1;
+    d1 = d2;
+  }
+  *outValue = value;
+  *outSlope = slope;
+}
+
+struct Piece {
+  double a;
+  double b;
+};
+
+}  // namespace
+
+int BuildEphemerisTable(
+    double et0,
+    double et1,
+    double tolerance,
+    double velocityTolerance,
+    uint32_t maxSegments,
+    const EphemerisSampler& sample,
+    std::vector<uint8_t>* out,
+    double* outFailedEt,
+    char* err,
+    int errMaxBytes) {
+  const uint32_t n = kCoefficients;
+  std::vector<double> breaks{et0};
+  std::vector<double> coeffs;
+  double maxError = 0.0;
+
+  double nodes[kCoefficients * 6];
+  double fit[3 * kCoefficients];
+  std::vector<Piece> stack{{et0, et1}};
+  while (!stack.empty()) {
+    const Piece piece = stack.back();
+    stack.pop_back();
+    const double mid = 0.5 * (piece.a + piece.b);
+    const double half = 0.5 * (piece.b - piece.a);
+
+    for (uint32_t k = 0; k < n; k++) {
+      const double et = mid + half * std::cos(kPi * (k + 0.5) / n);
+      if (sample(et, &nodes[k * 6], err, errMaxBytes) != 0) {
+        *outFailedEt = et;
+        return 1;
+      }
+    }
+    for (int axis = 0; axis < 3; axis++) {
+      FitChebyshev(&nodes[axis], 6, &fit[axis * n]);
+    }
+
+    // Check at both ends and at the extrema of T_N, which sit between the nodes.
+    double error = 0.0;
+    double velocityError = 0.0;
+    for (uint32_t k = 0; k <= n; k++) {
+      const double x = std::cos(kPi * k / n);
+      double truth[6];
+      if (sample(mid + half * x, truth, err, errMaxBytes) != 0) {
+        *outFailedEt = mid + half * x;
+        return 1;
+      }
+      double d2 = 0.0;
+      double v2 = 0.0;
+      for (int axis = 0; axis < 3; axis++) {
+        double value = 0.0;
+        double slope = 0.0;
+        EvalChebyshev(&fit[axis * n], n, x, &value, &slope);
+        d2 += (value - truth[axis]) * (value - truth[axis]);
+        const double dv = slope / half - truth[axis + 3];
+        v2 += dv * dv;
+      }
+      error = std::max(error, std::sqrt(d2));
+      velocityError = std::max(velocityError, std::sqrt(v2));
+    }
+
+    if ((error > tolerance || velocityError > velocityTolerance) && piece.b - piece.a > 2.0 * kMinWidth) {
+      if (breaks.size() - 1 + stack.size() + 2 > maxSegments) return 2;
+      // Right half first, so pieces come off the stack in time order.
+      stack.push_back({mid, piece.b});
+      stack.push_back({piece.a, mid});
+      continue;
+    }
+    maxError = std::max(maxError, error);
+    breaks.push_back(piece.b);
+    coeffs.insert(coeffs.end(), fit, fit + 3 * n);
+  }
+
+  const uint32_t segments = (uint32_t)(breaks.size() - 1);
+  out->assign(kEphemerisTableHeaderBytes + (breaks.size() + coeffs.size()) * sizeof(double), 0);
+  uint8_t* p = out->data();
+  const uint32_t header[4] = {kEphemerisTableMagic, kEphemerisTableVersion, segments, n};
+  std::memcpy(p, header, sizeof(header));
+  std::memcpy(p + 16, &tolerance, sizeof(double));
+  std::memcpy(p + 24, &maxError, sizeof(double));
+  std::memcpy(p + kEphemerisTableHeaderBytes, breaks.data(), breaks.size() * sizeof(double));
+  std::memcpy(
+      p + kEphemerisTableHeaderBytes + breaks.size() * sizeof(double), coeffs.data(), coeffs.size() * sizeof(double));
+  return 0;
+}
+
+bool ParseEphemerisTable(const uint8_t* data, size_t length, EphemerisTableView* out, std::string* why) {
+  if (length < kEphemerisTableHeaderBytes) {
+    *why = "buffer is shorter than the table header";
+    return false;
+  }
+  uint32_t header[4];
+  std::memcpy(header, data, sizeof(header));
+  if (header[0] != kEphemerisTableMagic || header[1] != kEphemerisTableVersion) {
+    *why = "not an ephemeris table (bad magic or version)";
+    return false;
+  }
+  const uint64_t segments = header[2];
+  const uint64_t coefficients = header[3];
+  const uint64_t doubles = segments + 1 + segments * 3 * coefficients;
+  if (segments == 0 || coefficients == 0 || length != kEphemerisTableHeaderBytes + doubles * sizeof(double)) {
+    *why = "table size does not match its header";
+    return false;
+  }
+  out->segments = (uint32_t)segments;
+  out->coefficients = (uint32_t)coefficients;
+  std::memcpy(&out->tolerance, data + 16, sizeof(double));
+  std::memcpy(&out->maxError, data + 24, sizeof(double));
+  out->breaks = reinterpret_cast<const double*>(data + kEphemerisTableHeaderBytes);
+  out->coeffs = out->breaks + segments + 1;
+  return true;
+}
+
+bool EvaluateEphemerisTable(const EphemerisTableView& table, double et, double outState[6]) {
+  const double* first = table.breaks;
+  const double* last = table.breaks + table.segments;
+  if (!(et >= *first && et <= *last)) return false;
+
+  // Last breakpoint <= et, clamped so `et1` itself falls in the final piece.
+  size_t i = (size_t)(std::upper_bound(first, last + 1, et) - first) - 1;
+  if (i >= table.segments) i = table.segments - 1;
+
+  const double a = table.breaks[i];
+  const double b = table.breaks[i + 1];
+  const double x = (2.0 * et - (a + b)) / (b - a);
+  const double dxdt = 2.0 / (b - a);
+  const uint32_t n = table.coefficients;
+  const double* c = table.coeffs + i * 3 * n;
+  for (int axis = 0; axis < 3; axis++) {
+    double value = 0.0;
+    double slope = 0.0;
+    EvalChebyshev(c + axis * n, n, x, &value, &slope);
+    outState[axis] = value;
+    outState[axis + 3] = slope * dxdt;
+  }
+  return true;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace tspice_backend_node {
+
+// Piecewise-Chebyshev position tables for display-quality ephemerides.
+//
+// `BuildEphemerisTable` samples a state function over `[et0, et1]` and fits degree-11 Chebyshev
+// series per position component, bisecting any piece whose position or velocity error at the check
+// points (both ends and the extrema between interpolation nodes) exceeds its tolerance. Velocities
+// come from the derivative of the fit. The table is a flat little-endian buffer (layout below,
+// mirrored by `@rybosome/tspice-core`'s `evaluateEphemerisTable`), so it can be transferred to a
+// worker or a browser and evaluated there without any kernel or CSPICE access:
+//
+//   u32 magic "TSET", u32 version (1), u32 segments, u32 coefficients per component,
+//   f64 tolerance (km), f64 largest position error seen at a check point (km),
+//   f64 breakpoints[segments + 1],
+//   f64 coefficients[segments][3][coefficients per component]
+//
+// Only the sampler passed to the builder touches CSPICE; evaluation reads the buffer it is given
+// and needs no lock.
+
+constexpr uint32_t kEphemerisTableMagic = 0x54455354;  // "TSET"
+constexpr uint32_t kEphemerisTableVersion = 1;
+constexpr size_t kEphemerisTableHeaderBytes = 32;
+
+// State (km, km/s) at `et`. Returns 0, or 1 with `err` filled.
+using EphemerisSampler = std::function<int(double et, double outState[6], char* err, int errMaxBytes)>;
+
+struct EphemerisTableView {
+  uint32_t segments = 0;
+  uint32_t coefficients = 0;
+  double tolerance = 0.0;
+  double maxError = 0.0;
+  const double* breaks = nullptr;
+  const double* coeffs = nullptr;
+};
+
+// Fits `sample` over `[et0, et1]` to `tolerance` km in position and `velocityTolerance` km/s in
+// velocity, and writes the serialized table to `out`. Returns 0; 1 with `err` filled and
+// `*outFailedEt` set when sampling fails; or 2 when the span would need more than `maxSegments`
+// pieces (a tolerance is too tight for the data).
+int BuildEphemerisTable(
+    double et0,
+    double et1,
+    double tolerance,
+    double velocityTolerance,
+    uint32_t maxSegments,
+    const EphemerisSampler& sample,
+    std::vector<uint8_t>* out,
+    double* outFailedEt,
+    char* err,
+    int errMaxBytes);
+
+// Validates `data` as a table and points `out` into it. `data` must be 8-byte aligned. Returns
+// false with `why` set when it is not a well-formed table.
+bool ParseEphemerisTable(const uint8_t* data, size_t length, EphemerisTableView* out, std::string* why);
+
+// State (km, km/s) at `et`. Returns false when `et` is outside the table's span.
+bool EvaluateEphemerisTable(const EphemerisTableView& table, double et, double outState[6]);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,216 @@
+#include "frame_cache.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include "id_cache.h"
+#include "pool_generation.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// `frinfo_c` frame classes.
+constexpr int kFrameClassInertial = 1;
+constexpr int kFrameClassTk = 4;
+
+// Every inertial frame reduces to this base: rotations between inertial frames are constant.
+constexpr int kInertialBase = std::numeric_limits<int>::min();
+
+// TK chains are a few links deep; anything longer (or cyclic) is treated as time-dependent.
+constexpr int kMaxTkDepth = 32;
+
+// Same cap-and-drop policy as the ID cache.
+constexpr size_t kMaxChains = 4096;
+constexpr size_t kRecentSlots = 64;
+
+struct Chain {
+  bool fixed = false;
+  bool haveRotation = false;
+  bool haveState = false;
+  double rotation[9];
+  double state[36];
+};
+
+struct RecentEntry {
+  std::string key;
+  bool isState = false;
+  double et = 0.0;
+  uint64_t lastUse = 0;
+  double m[36];
+};
+
+std::unordered_map<std::string, Chain> g_chains;
+RecentEntry g_recent[kRecentSlots];
+size_t g_recent_used = 0;
+uint64_t g_clock = 0;
+uint64_t g_generation = 0;
+double g_hits = 0;
+double g_misses = 0;
+
+void DropIfStale() {
+  const uint64_t generation = PoolGeneration();
+  if (generation != g_generation) {
+    g_chains.clear();
+    g_recent_used = 0;
+    g_generation = generation;
+  }
+}
+
+// `TKFRAME_<key>_RELATIVE`, as a frame ID. Returns false when the variable is missing or names an
+// unknown frame.
+bool LookupTkRelative(const std::string& key, int* outFrame) {
+  const std::string name = "TKFRAME_" + key + "_RELATIVE";
+  char relative[TSPICE_FRNAME_MAX_BYTES];
+  relative[0] = '\0';
+  int n = 0;
+  int found = 0;
+  if (tspice_gcpool(name.c_str(), 0, 1, (int)sizeof(relative), &n, relative, &found, nullptr, 0) != 0 ||
+      !found || n < 1) {
+    return false;
+  }
+  bool known = false;
+  return InternFrameCode(relative, outFrame, &known, nullptr, 0) == 0 && known;
+}
+
+// Follow TK frames to the first non-TK frame (inertial frames all reduce to `kInertialBase`).
+// Returns false when the chain cannot be resolved.
+bool ReduceToBase(int frame, int* outBase) {
+  for (int depth = 0; depth < kMaxTkDepth; depth++) {
+    int center = 0;
+    int frameClass = 0;
+    int classId = 0;
+    int found = 0;
+    if (tspice_frinfo(frame, &center, &frameClass, &classId, &found, nullptr, 0) != 0 || !found) {
+      return false;
+    }
+    if (frameClass == kFrameClassInertial) {
+      *outBase = kInertialBase;
+      return true;
+    }
+    if (frameClass != kFrameClassTk) {
+      *outBase = frame;
+      return true;
+    }
+
+    // `tkfram_c` accepts the keywords under the class ID or the frame name.
+    int relative = 0;
+    if (!LookupTkRelative(std::to_string(classId), &relative)) {
+      char name[TSPICE_FRNAME_MAX_BYTES];
+      bool named = false;
+      if (LookupFrameName(frame, name, &named, nullptr, 0) != 0 || !named ||
+          !LookupTkRelative(name, &relative)) {
+        return false;
+      }
+    }
+    frame = relative;
+  }
+  return false;
+}
+
+bool IsFixedChain(const char* from, const char* to) {
+  int fromId = 0;
+  int toId = 0;
+  bool fromFound = false;
+  bool toFound = false;
+  if (InternFrameCode(from, &fromId, &fromFound, nullptr, 0) != 0 || !fromFound ||
+      InternFrameCode(to, &toId, &toFound, nullptr, 0) != 0 || !toFound) {
+    return false;
+  }
+  int fromBase = 0;
+  int toBase = 0;
+  return ReduceToBase(fromId, &fromBase) && ReduceToBase(toId, &toBase) && fromBase == toBase;
+}
+
+using XformFn = int (*)(const char*, const char*, double, double*, char*, int);
+
+int CachedXform(
+    const char* from,
+    const char* to,
+    double et,
+    bool isState,
+    XformFn fn,
+    double* out,
+    char* err,
+    int errMaxBytes) {
+  DropIfStale();
+  const size_t n = isState ? 36 : 9;
+
+  std::string key(from);
+  key.push_back('\0');
+  key.append(to);
+
+  auto it = g_chains.find(key);
+  if (it == g_chains.end()) {
+    if (g_chains.size() >= kMaxChains) g_chains.clear();
+    Chain chain;
+    chain.fixed = IsFixedChain(from, to);
+    it = g_chains.emplace(key, chain).first;
+  }
+
+  Chain& chain = it->second;
+  if (chain.fixed) {
+    double* cached = isState ? chain.state : chain.rotation;
+    bool& have = isState ? chain.haveState : chain.haveRotation;
+    if (have) {
+      std::memcpy(out, cached, n * sizeof(double));
+      g_hits++;
+      return 0;
+    }
+    g_misses++;
+    if (fn(from, to, et, out, err, errMaxBytes) != 0) return 1;
+    std::memcpy(cached, out, n * sizeof(double));
+    have = true;
+    return 0;
+  }
+
+  size_t victim = g_recent_used;
+  for (size_t i = 0; i < g_recent_used; i++) {
+    RecentEntry& e = g_recent[i];
+    if (e.et == et && e.isState == isState && e.key == key) {
+      e.lastUse = ++g_clock;
+      std::memcpy(out, e.m, n * sizeof(double));
+      g_hits++;
+      return 0;
+    }
+    if (victim == g_recent_used || e.lastUse < g_recent[victim].lastUse) victim = i;
+  }
+
+  g_misses++;
+  if (fn(from, to, et, out, err, errMaxBytes) != 0) return 1;
+  if (g_recent_used < kRecentSlots) victim = g_recent_used++;
+  RecentEntry& e = g_recent[victim];
+  e.key = key;
+  e.isState = isState;
+  e.et = et;
+  e.lastUse = ++g_clock;
+  std::memcpy(e.m, out, n * sizeof(double));
+  return 0;
+}
+
+}  // namespace
+
+int CachedPxform(const char* from, const char* to, double et, double* out, char* err, int errMaxBytes) {
+  return CachedXform(from, to, et, false, tspice_pxform, out, err, errMaxBytes);
+}
+
+int CachedSxform(const char* from, const char* to, double et, double* out, char* err, int errMaxBytes) {
+  return CachedXform(from, to, et, true, tspice_sxform, out, err, errMaxBytes);
+}
+
+FrameCacheStats GetFrameCacheStats() {
+  DropIfStale();
+  FrameCacheStats stats;
+  for (const auto& entry : g_chains) {
+    if (entry.second.fixed) stats.fixedChains++;
+  }
+  stats.recent = (uint32_t)g_recent_used;
+  stats.hits = g_hits;
+  stats.misses = g_misses;
+  return stats;
+}
+
+}  // namespace tspice_backend_node
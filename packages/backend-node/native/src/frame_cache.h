@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tspice_backend_node {
+
+// Addon-level memo for `pxform` / `sxform`.
+//
+// Each (from, to) pair is classified once: when both frames reduce, through TK frames (constant
+// offsets by definition) and inertial frames (constant relative to each other), to the same base
+// frame, the chain is time-invariant and its rotation is cached for good after the first
+// successful call. Any other chain (PCK, CK, dynamic, ...) goes through a small LRU keyed by the
+// exact epoch, which serves repeated queries at the same `et` (e.g. several instruments sampled
+// at one time step). Results are the ones CSPICE returned, so cached and uncached calls agree
+// bit for bit; failures are never cached and report the same errors as the shim.
+//
+// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller. The cache
+// drops itself whenever the kernel-pool generation moves.
+
+struct FrameCacheStats {
+  uint32_t fixedChains = 0;
+  uint32_t recent = 0;
+  double hits = 0;
+  double misses = 0;
+};
+
+// Drop-in replacements for `tspice_pxform` / `tspice_sxform` (same signature and error
+// contract, including the cheap null-`err` path).
+int CachedPxform(const char* from, const char* to, double et, double* out, char* err, int errMaxBytes);
+int CachedSxform(const char* from, const char* to, double et, double* out, char* err, int errMaxBytes);
+
+FrameCacheStats GetFrameCacheStats();
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,118 @@
+#include "id_cache.h"
+
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+
+#include "addon_common.h"
+#include "napi_helpers.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// Keeps a pathological caller (e.g. interning every numeric string) from growing the table
+// without bound; hitting the cap just drops the cache.
+constexpr size_t kMaxEntries = 4096;
+
+std::unordered_map<std::string, int> g_body_codes;
+std::unordered_map<std::string, int> g_frame_codes;
+std::unordered_map<int, std::string> g_frame_names;
+
+template <typename Map>
+void ReserveSlot(Map& map) {
+  if (map.size() >= kMaxEntries) {
+    map.clear();
+  }
+}
+
+}  // namespace
+
+void InvalidateIdCache() {
+  g_body_codes.clear();
+  g_frame_codes.clear();
+  g_frame_names.clear();
+}
+
+int InternBodyCode(const std::string& name, int* outCode, bool* outFound, char* err, int errMaxBytes) {
+  auto it = g_body_codes.find(name);
+  if (it != g_body_codes.end()) {
+    *outCode = it->second;
+    *outFound = true;
+    return 0;
+  }
+
+  int code = 0;
+  int found = 0;
+  if (tspice_bods2c(name.c_str(), &code, &found, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  *outFound = found != 0;
+  *outCode = code;
+  if (found) {
+    ReserveSlot(g_body_codes);
+    g_body_codes.emplace(name, code);
+  }
+  return 0;
+}
+
+int InternFrameCode(const std::string& name, int* outCode, bool* outFound, char* err, int errMaxBytes) {
+  auto it = g_frame_codes.find(name);
+  if (it != g_frame_codes.end()) {
+    *outCode = it->second;
+    *outFound = true;
+    return 0;
+  }
+
+  int code = 0;
+  int found = 0;
+  if (tspice_namfrm(name.c_str(), &code, &found, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  *outFound = found != 0 && code != 0;
+  *outCode = code;
+  if (*outFound) {
+    ReserveSlot(g_frame_codes);
+    g_frame_codes.emplace(name, code);
+  }
+  return 0;
+}
+
+int LookupFrameName(int frameId, char* outName, bool* outFound, char* err, int errMaxBytes) {
+  auto it = g_frame_names.find(frameId);
+  if (it != g_frame_names.end()) {
+    std::memcpy(outName, it->second.c_str(), it->second.size() + 1);
+    *outFound = true;
+    return 0;
+  }
+
+  int found = 0;
+  outName[0] = '\0';
+  if (tspice_frmnam(frameId, outName, TSPICE_FRNAME_MAX_BYTES, &found, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  *outFound = found != 0 && outName[0] != '\0';
+  if (*outFound) {
+    ReserveSlot(g_frame_names);
+    g_frame_names.emplace(frameId, std::string(outName));
+  }
+  return 0;
+}
+
+bool ResolveFrameNameOrThrow(Napi::Env env, int frameId, char* outName, const char* context) {
+  char err[kErrMaxBytes];
+  bool found = false;
+  if (LookupFrameName(frameId, outName, &found, err, (int)sizeof(err)) != 0) {
+    tspice_napi::ThrowSpiceError(env, std::string("CSPICE failed while calling ") + context, err);
+    return false;
+  }
+  if (!found) {
+    tspice_napi::ThrowSpiceError(Napi::RangeError::New(
+        env, std::string(context) + ": unknown frame ID " + std::to_string(frameId)));
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tspice_backend_node
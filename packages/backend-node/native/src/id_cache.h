@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Addon-level intern table for body/frame name resolution.
+//
+// Hot calls can resolve names once (`internBody` / `internFrame`) and then pass integer IDs; the
+// ID-taking entrypoints (`spkezId`, `spkgeoId`, `pxformId`, ...) look the frame name up here
+// instead of copying a JS string per call.
+//
+// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller. Mappings
+// can change whenever kernels or pool variables change, so every `furnsh` / `unload` / `kclear` /
+// `boddef` / `p*pool` entrypoint calls `InvalidateIdCache()` after touching CSPICE.
+
+void InvalidateIdCache();
+
+// bods2c_c, memoized. Returns 0 on success (with `*outFound` set) or 1 with `err` filled.
+int InternBodyCode(const std::string& name, int* outCode, bool* outFound, char* err, int errMaxBytes);
+
+// namfrm_c, memoized. Unknown frames report `*outFound = false`.
+int InternFrameCode(const std::string& name, int* outCode, bool* outFound, char* err, int errMaxBytes);
+
+// frmnam_c, memoized. `outName` must hold `TSPICE_FRNAME_MAX_BYTES`; unknown IDs report
+// `*outFound = false`.
+int LookupFrameName(int frameId, char* outName, bool* outFound, char* err, int errMaxBytes);
+
+// LookupFrameName for the ID-taking entrypoints: throws (and returns false) when CSPICE fails or
+// the ID is unknown. `context` names the caller in the error message.
+bool ResolveFrameNameOrThrow(Napi::Env env, int frameId, char* outName, const char* context);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,40 @@
+#include "instance_data.h"
+
+#include <vector>
+
+#include "addon_common.h"
+#include "domains/ek.h"
+#include "domains/ephemeris.h"
+#include "dsk_bvh.h"
+#include "native_memory.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+InstanceData::~InstanceData() {
+  // Runs from the environment's cleanup hook: on worker termination, or at process exit for the
+  // main thread.
+  for (uint32_t id : dskBvhs) {
+    size_t bytes = 0;
+    if (ReleaseDskBvh(id, &bytes)) TrackNativeRelease(NativeMemoryKind::kDskBvhs, bytes);
+  }
+
+  CspiceLock lock;
+  DropSpkStreams(lock, spkStreams);
+  DropEkCursors(lock, ekCursors);
+  for (const CellHandleTable::Allocation& allocation : cells->LiveAllocations()) {
+    tspice_free_cell(allocation.ptr, nullptr, 0);
+    TrackNativeRelease(allocation.kind, allocation.bytes);
+  }
+  cells->Clear();
+}
+
+void InitInstanceData(Napi::Env env) {
+  env.SetInstanceData<InstanceData>(new InstanceData());
+}
+
+InstanceData& GetInstanceData(Napi::Env env) {
+  return *env.GetInstanceData<InstanceData>();
+}
+
+}  // namespace tspice_backend_node
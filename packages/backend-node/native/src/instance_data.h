@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <napi.h>
+
+#include "cancellation.h"
+#include "cell_handles.h"
+
+namespace tspice_backend_node {
+
+// Per-environment addon state.
+//
+// The addon is context-aware: every `worker_thread` that loads it gets its own `Init()` and its
+// own copy of this struct, so handles issued in one environment are unknown to every other one
+// and a terminated worker releases what it owned. Everything derived from CSPICE itself (the ID,
+// frame, coverage and SPK evaluator caches, the leap-second snapshot, kernel-pool generations)
+// stays process-wide, because CSPICE is: there is one kernel pool and one `g_cspice_mutex` for all
+// environments. Native stats are process-wide for the same reason (they measure that one mutex).
+struct InstanceData {
+  ~InstanceData();
+
+  // SpiceCell / SpiceWindow handles. Shared with in-flight off-thread tasks (see
+  // `ResolveCellHandlePtr`), which may outlive the environment; the table is emptied on teardown.
+  std::shared_ptr<CellHandleTable> cells = std::make_shared<CellHandleTable>();
+
+  // Ids of the `spkwStreamOpen` streams this environment owns. Guarded by `g_cspice_mutex`.
+  std::unordered_set<uint32_t> spkStreams;
+
+  // Ids of the `ekCursorOpen` cursors this environment owns. Guarded by `g_cspice_mutex`.
+  std::unordered_set<uint32_t> ekCursors;
+
+  // Ids of the `dskBvhBuild` indexes this environment owns. Only touched on its JS thread.
+  std::unordered_set<uint32_t> dskBvhs;
+
+  // `newCancelToken()` flags by id. Only touched on its JS thread; calls in flight hold their own
+  // reference, so freeing a token (or the environment) never pulls it out from under them.
+  std::unordered_map<uint32_t, std::shared_ptr<CancelFlag>> cancelTokens;
+  uint32_t nextCancelToken = 1;
+};
+
+// Installs a fresh `InstanceData` on `env`; first thing `Init()` does.
+void InitInstanceData(Napi::Env env);
+
+// The calling environment's state. Only valid on that environment's JS thread.
+InstanceData& GetInstanceData(Napi::Env env);
+
+}  // namespace tspice_backend_node
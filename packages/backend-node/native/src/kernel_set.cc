@@ -0,0 +1,288 @@
+#include "kernel_set.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+#include "addon_common.h"
+#include "domains/kernel_pool.h"
+#include "napi_helpers.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'S', 'P', 'K', 'S', 'E', 'T', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrderMarker = 0x01020304u;
+
+// `kdata` kinds that are reopened by path on restore; text kernels are captured by the pool dump.
+constexpr const char* kBinaryKinds = "SPK CK PCK DSK EK";
+constexpr int kPathMaxBytes = 2048;
+
+void SetError(char* err, int errMaxBytes, const std::string& message) {
+  if (err != nullptr && errMaxBytes > 0) {
+    snprintf(err, (size_t)errMaxBytes, "%s", message.c_str());
+  }
+}
+
+void PutU32(std::vector<uint8_t>* out, uint32_t v) {
+  const size_t at = out->size();
+  out->resize(at + sizeof(v));
+  std::memcpy(out->data() + at, &v, sizeof(v));
+}
+
+void PutBytes(std::vector<uint8_t>* out, const void* data, size_t n) {
+  PutU32(out, static_cast<uint32_t>(n));
+  const auto* p = static_cast<const uint8_t*>(data);
+  out->insert(out->end(), p, p + n);
+}
+
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  bool Raw(void* out, size_t n) {
+    if (size_ - pos_ < n) return false;
+    std::memcpy(out, data_ + pos_, n);
+    pos_ += n;
+    return true;
+  }
+
+  bool U32(uint32_t* out) { return Raw(out, sizeof(*out)); }
+
+  bool Bytes(std::string_view* out) {
+    uint32_t n = 0;
+    if (!U32(&n) || size_ - pos_ < n) return false;
+    *out = std::string_view(reinterpret_cast<const char*>(data_ + pos_), n);
+    pos_ += n;
+    return true;
+  }
+
+  bool AtEnd() const { return pos_ == size_; }
+  size_t Remaining() const { return size_ - pos_; }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+struct ParsedVariable {
+  std::string name;
+  char type = 'N';
+  std::vector<double> numbers;
+  std::vector<std::string_view> strings;
+};
+
+struct ParsedKernelSet {
+  std::vector<std::string> binaries;
+  std::vector<ParsedVariable> variables;
+};
+
+bool ParseKernelSet(const uint8_t* bytes, size_t byteLength, ParsedKernelSet* out, std::string* why) {
+  Reader r(bytes, byteLength);
+
+  char magic[sizeof(kMagic)];
+  uint32_t version = 0;
+  uint32_t marker = 0;
+  if (!r.Raw(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    *why = "not a kernel-set snapshot";
+    return false;
+  }
+  if (!r.U32(&version) || version != kVersion) {
+    *why = "unsupported snapshot version";
+    return false;
+  }
+  if (!r.U32(&marker) || marker != kByteOrderMarker) {
+    *why = "snapshot was written on a host with a different byte order";
+    return false;
+  }
+
+  uint32_t nBinary = 0;
+  if (!r.U32(&nBinary) || nBinary > r.Remaining() / sizeof(uint32_t)) {
+    *why = "truncated binary kernel list";
+    return false;
+  }
+  out->binaries.reserve(nBinary);
+  for (uint32_t i = 0; i < nBinary; i++) {
+    std::string_view path;
+    if (!r.Bytes(&path) || path.empty() || path.size() >= static_cast<size_t>(kPathMaxBytes)) {
+      *why = "malformed binary kernel path";
+      return false;
+    }
+    out->binaries.emplace_back(path);
+  }
+
+  uint32_t nVars = 0;
+  if (!r.U32(&nVars) || nVars > r.Remaining() / (2 * sizeof(uint32_t) + 1)) {
+    *why = "truncated variable list";
+    return false;
+  }
+  out->variables.resize(nVars);
+  for (ParsedVariable& var : out->variables) {
+    std::string_view name;
+    uint8_t type = 0;
+    uint32_t n = 0;
+    if (!r.Bytes(&name) || name.empty() || !r.Raw(&type, 1) || (type != 'N' && type != 'C') || !r.U32(&n)) {
+      *why = "malformed variable header";
+      return false;
+    }
+    var.name.assign(name);
+    var.type = static_cast<char>(type);
+
+    if (type == 'N') {
+      if (n > r.Remaining() / sizeof(double)) {
+        *why = "truncated numeric values for " + tspice_napi::PreviewForError(var.name);
+        return false;
+      }
+      var.numbers.resize(n);
+      if (n > 0) r.Raw(var.numbers.data(), n * sizeof(double));
+      continue;
+    }
+
+    if (n > r.Remaining() / sizeof(uint32_t)) {
+      *why = "truncated character values for " + tspice_napi::PreviewForError(var.name);
+      return false;
+    }
+    var.strings.resize(n);
+    for (std::string_view& value : var.strings) {
+      if (!r.Bytes(&value) || value.size() >= static_cast<size_t>(kOutMaxBytes)) {
+        *why = "malformed character value for " + tspice_napi::PreviewForError(var.name);
+        return false;
+      }
+    }
+  }
+
+  if (!r.AtEnd()) {
+    *why = "trailing bytes after the last variable";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int SerializeKernelSet(std::vector<uint8_t>* out, char* err, int errMaxBytes) {
+  out->clear();
+  out->insert(out->end(), kMagic, kMagic + sizeof(kMagic));
+  PutU32(out, kVersion);
+  PutU32(out, kByteOrderMarker);
+
+  int count = 0;
+  if (tspice_ktotal(kBinaryKinds, &count, err, errMaxBytes) != 0) return 1;
+  PutU32(out, static_cast<uint32_t>(std::max(count, 0)));
+  for (int i = 0; i < count; i++) {
+    char file[kPathMaxBytes];
+    char filtyp[32];
+    char source[kPathMaxBytes];
+    int handle = 0;
+    int found = 0;
+    if (tspice_kdata(
+            i,
+            kBinaryKinds,
+            file,
+            (int)sizeof(file),
+            filtyp,
+            (int)sizeof(filtyp),
+            source,
+            (int)sizeof(source),
+            &handle,
+            &found,
+            err,
+            errMaxBytes) != 0) {
+      return 1;
+    }
+    if (!found) {
+      SetError(err, errMaxBytes, "kernelSetSnapshot(): kdata() lost track of a loaded kernel");
+      return 1;
+    }
+    const std::string_view path(file, strnlen(file, sizeof(file)));
+    if (path.rfind("/proc/self/fd/", 0) == 0) {
+      SetError(
+          err,
+          errMaxBytes,
+          "kernelSetSnapshot(): binary kernels loaded from memory cannot be snapshotted (" + std::string(path) +
+              ")");
+      return 1;
+    }
+    PutBytes(out, path.data(), path.size());
+  }
+
+  PoolSnapshotData pool;
+  std::string call;
+  if (!ReadPoolSnapshot("*", &pool, &call, err, errMaxBytes)) return 1;
+
+  PutU32(out, static_cast<uint32_t>(pool.names.size()));
+  for (size_t i = 0; i < pool.names.size(); i++) {
+    PutBytes(out, pool.names[i].data(), pool.names[i].size());
+    out->push_back(static_cast<uint8_t>(pool.types[i]));
+    const size_t start = static_cast<size_t>(pool.start[i]);
+    const size_t n = static_cast<size_t>(pool.count[i]);
+    PutU32(out, static_cast<uint32_t>(n));
+    if (pool.types[i] == 'N') {
+      const size_t at = out->size();
+      out->resize(at + n * sizeof(double));
+      if (n > 0) std::memcpy(out->data() + at, pool.numbers.data() + start, n * sizeof(double));
+      continue;
+    }
+    for (size_t k = start; k < start + n; k++) {
+      const size_t begin = static_cast<size_t>(pool.stringOffsets[k]);
+      const size_t end = static_cast<size_t>(pool.stringOffsets[k + 1]);
+      PutBytes(out, pool.stringBytes.data() + begin, end - begin);
+    }
+  }
+
+  return 0;
+}
+
+int RestoreKernelSet(const uint8_t* bytes, size_t byteLength, char* err, int errMaxBytes) {
+  ParsedKernelSet set;
+  std::string why;
+  if (!ParseKernelSet(bytes, byteLength, &set, &why)) {
+    SetError(err, errMaxBytes, "kernelSetRestore(): " + why);
+    return 2;
+  }
+
+  if (tspice_kclear(err, errMaxBytes) != 0) return 1;
+
+  const auto fail = [&]() {
+    // Leave a clean slate rather than a half-restored kernel set; keep the original error.
+    char ignored[kErrMaxBytes];
+    tspice_kclear(ignored, (int)sizeof(ignored));
+    return 1;
+  };
+
+  std::vector<char> cvals;
+  for (const ParsedVariable& var : set.variables) {
+    // The pool never holds empty variables; skip rather than have p*pool reject them.
+    if (var.numbers.empty() && var.strings.empty()) continue;
+
+    if (var.type == 'N') {
+      if (tspice_pdpool(var.name.c_str(), (int)var.numbers.size(), var.numbers.data(), err, errMaxBytes) != 0) {
+        return fail();
+      }
+      continue;
+    }
+
+    size_t width = 1;
+    for (std::string_view value : var.strings) width = std::max(width, value.size() + 1);
+    cvals.assign(width * std::max<size_t>(var.strings.size(), 1), '\0');
+    for (size_t i = 0; i < var.strings.size(); i++) {
+      std::memcpy(cvals.data() + i * width, var.strings[i].data(), var.strings[i].size());
+    }
+    if (tspice_pcpool(var.name.c_str(), (int)var.strings.size(), (int)width, cvals.data(), err, errMaxBytes) != 0) {
+      return fail();
+    }
+  }
+
+  for (const std::string& path : set.binaries) {
+    if (tspice_furnsh(path.c_str(), err, errMaxBytes) != 0) return fail();
+  }
+
+  return 0;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tspice_backend_node {
+
+// Compact binary snapshot of the loaded kernel set: every kernel-pool variable (whatever text
+// kernel or `p*pool` call defined it) plus the binary kernels (SPK, CK, PCK, DSK, EK) in load
+// order.
+//
+// Restoring clears CSPICE, re-inserts the pool variables with `pdpool` / `pcpool` (no text-kernel
+// parsing) and re-`furnsh`es the binary kernels by path, which only reopens their DAF/DAS files.
+// Afterwards `ktotal("TEXT")` / `kdata` no longer list the original text kernels (their variables
+// are pool-defined), and `boddef` mappings and `swpool` watchers are not part of the snapshot.
+//
+// Layout (host byte order, checked by a marker on restore):
+//
+//   "TSPKSET\0"  u32 version  u32 0x01020304
+//   u32 nBinary  { u32 len, path bytes }*
+//   u32 nVars    { u32 len, name bytes, u8 'N' | 'C', u32 n, f64[n] | { u32 len, bytes }[n] }*
+//
+// NOTE: both functions require `g_cspice_mutex` to be held by the caller; `RestoreKernelSet`
+// callers must run the usual kernel-change invalidation hooks afterwards, even on failure.
+
+// Returns 0 on success or 1 with `err` filled. Binary kernels loaded from in-memory buffers
+// (`/proc/self/fd/...`) cannot be reopened elsewhere, so they are reported as an error.
+int SerializeKernelSet(std::vector<uint8_t>* out, char* err, int errMaxBytes);
+
+// Returns 0 on success, 1 with `err` filled when CSPICE fails (the kernel set is then cleared), or
+// 2 with `err` filled when `bytes` is not a valid snapshot (CSPICE is not touched).
+int RestoreKernelSet(const uint8_t* bytes, size_t byteLength, char* err, int errMaxBytes);
+
+}  // namespace tspice_backend_node
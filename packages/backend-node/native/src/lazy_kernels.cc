@@ -0,0 +1,261 @@
+#include "lazy_kernels.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "coverage_index.h"
+#include "id_cache.h"
+#include "spk_evaluator.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// Light-time corrections evaluate the target up to the one-way light time before (or after) `et`;
+// a day covers anything in the solar system and only widens which files are considered.
+constexpr double kLightTimeMarginSeconds = 86400.0;
+constexpr uint32_t kDefaultBudget = 64;
+
+constexpr int kSummaryNd = 2;
+constexpr int kSummaryNi = 6;
+
+struct LazySegment {
+  int body = 0;
+  int center = 0;
+  double start = 0.0;
+  double stop = 0.0;
+};
+
+struct LazyKernel {
+  std::string path;
+  std::vector<LazySegment> segments;
+  bool open = false;
+  uint64_t lastUse = 0;
+};
+
+// Slots are never reused while registered; unregistering clears the path and segments.
+std::vector<LazyKernel> g_kernels;
+std::unordered_map<std::string, size_t> g_by_path;
+std::unordered_map<int, std::vector<size_t>> g_by_body;
+uint32_t g_budget = kDefaultBudget;
+uint32_t g_open = 0;
+uint64_t g_clock = 0;
+double g_opens = 0;
+double g_closes = 0;
+
+int Fail(char* err, int errMaxBytes, const std::string& message) {
+  if (err && errMaxBytes > 0) {
+    std::snprintf(err, (size_t)errMaxBytes, "%s", message.c_str());
+  }
+  return 1;
+}
+
+int ScanSpkSegments(const std::string& path, std::vector<LazySegment>* out, char* err, int errMaxBytes) {
+  char arch[16];
+  char type[16];
+  if (tspice_getfat(path.c_str(), arch, (int)sizeof(arch), type, (int)sizeof(type), err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (std::strcmp(arch, "DAF") != 0 || std::strcmp(type, "SPK") != 0) {
+    return Fail(err, errMaxBytes, "registerLazyKernel(): " + path + " is not an SPK file");
+  }
+
+  int handle = 0;
+  if (tspice_dafopr(path.c_str(), &handle, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  int code = tspice_dafbfs(handle, err, errMaxBytes);
+  while (code == 0) {
+    int found = 0;
+    code = tspice_daffna(handle, &found, err, errMaxBytes);
+    if (code != 0 || !found) break;
+
+    double dc[kSummaryNd];
+    int ic[kSummaryNi];
+    code = tspice_dafgsu(handle, kSummaryNd, kSummaryNi, dc, ic, err, errMaxBytes);
+    if (code != 0) break;
+
+    // SPK summaries: dc = [start, stop], ic = [body, center, frame, type, begin, end].
+    out->push_back(LazySegment{ic[0], ic[1], dc[0], dc[1]});
+  }
+
+  if (code != 0) {
+    tspice_dafcls(handle, nullptr, 0);
+    return 1;
+  }
+  return tspice_dafcls(handle, err, errMaxBytes) != 0 ? 1 : 0;
+}
+
+void RemoveFromBodyIndex(size_t slot) {
+  for (const LazySegment& seg : g_kernels[slot].segments) {
+    auto it = g_by_body.find(seg.body);
+    if (it == g_by_body.end()) continue;
+    std::vector<size_t>& slots = it->second;
+    slots.erase(std::remove(slots.begin(), slots.end(), slot), slots.end());
+    if (slots.empty()) g_by_body.erase(it);
+  }
+}
+
+void Forget(size_t slot) {
+  LazyKernel& k = g_kernels[slot];
+  RemoveFromBodyIndex(slot);
+  g_by_path.erase(k.path);
+  if (k.open) g_open--;
+  k = LazyKernel{};
+  while (!g_kernels.empty() && g_kernels.back().path.empty()) g_kernels.pop_back();
+}
+
+int Close(size_t slot, char* err, int errMaxBytes) {
+  LazyKernel& k = g_kernels[slot];
+  if (tspice_unload(k.path.c_str(), err, errMaxBytes) != 0) return 1;
+  // CSPICE hands the freed DAF handle to the next file it opens.
+  InvalidateSpkEvaluator();
+  InvalidateLoadedSpkCoverage();
+  k.open = false;
+  g_open--;
+  g_closes++;
+  return 0;
+}
+
+}  // namespace
+
+int RegisterLazyKernel(const std::string& path, char* err, int errMaxBytes) {
+  if (g_by_path.count(path) != 0) return 0;
+
+  LazyKernel k;
+  k.path = path;
+  if (ScanSpkSegments(path, &k.segments, err, errMaxBytes) != 0) return 1;
+
+  const size_t slot = g_kernels.size();
+  for (const LazySegment& seg : k.segments) {
+    std::vector<size_t>& slots = g_by_body[seg.body];
+    if (slots.empty() || slots.back() != slot) slots.push_back(slot);
+  }
+  g_by_path.emplace(path, slot);
+  g_kernels.push_back(std::move(k));
+  return 0;
+}
+
+int UnregisterLazyKernel(const std::string& path, bool* outFound, char* err, int errMaxBytes) {
+  auto it = g_by_path.find(path);
+  *outFound = it != g_by_path.end();
+  if (!*outFound) return 0;
+
+  const size_t slot = it->second;
+  if (g_kernels[slot].open && Close(slot, err, errMaxBytes) != 0) return 1;
+  Forget(slot);
+  return 0;
+}
+
+void ForgetLazyKernel(const std::string& path) {
+  auto it = g_by_path.find(path);
+  if (it != g_by_path.end()) Forget(it->second);
+}
+
+void InvalidateLazyKernels() {
+  g_kernels.clear();
+  g_by_path.clear();
+  g_by_body.clear();
+  g_open = 0;
+}
+
+void SetLazyKernelBudget(uint32_t budget) {
+  g_budget = std::max<uint32_t>(budget, 1);
+}
+
+LazyKernelStats GetLazyKernelStats() {
+  LazyKernelStats stats;
+  stats.registered = static_cast<uint32_t>(g_by_path.size());
+  stats.open = g_open;
+  stats.budget = g_budget;
+  stats.opens = g_opens;
+  stats.closes = g_closes;
+  return stats;
+}
+
+int EnsureLazySpkForBodies(int target, int observer, double etMin, double etMax, char* err, int errMaxBytes) {
+  if (g_by_body.empty()) return 0;
+
+  const double lo = etMin - kLightTimeMarginSeconds;
+  const double hi = etMax + kLightTimeMarginSeconds;
+
+  // Walk target/observer -> segment centers -> ... through the registered files.
+  std::vector<int> pending{target, observer};
+  std::unordered_set<int> seenBodies;
+  std::vector<size_t> needed;
+  std::unordered_set<size_t> neededSet;
+  while (!pending.empty()) {
+    const int body = pending.back();
+    pending.pop_back();
+    if (!seenBodies.insert(body).second) continue;
+
+    auto it = g_by_body.find(body);
+    if (it == g_by_body.end()) continue;
+    for (size_t slot : it->second) {
+      for (const LazySegment& seg : g_kernels[slot].segments) {
+        if (seg.body != body || seg.stop < lo || seg.start > hi) continue;
+        if (neededSet.insert(slot).second) needed.push_back(slot);
+        pending.push_back(seg.center);
+      }
+    }
+  }
+  if (needed.empty()) return 0;
+
+  const uint64_t now = ++g_clock;
+  uint32_t toOpen = 0;
+  for (size_t slot : needed) {
+    g_kernels[slot].lastUse = now;
+    if (!g_kernels[slot].open) toOpen++;
+  }
+
+  // Make room first so CSPICE's open-file limit is never exceeded by the budget.
+  while (g_open > 0 && g_open + toOpen > g_budget) {
+    size_t victim = g_kernels.size();
+    for (size_t slot = 0; slot < g_kernels.size(); slot++) {
+      const LazyKernel& k = g_kernels[slot];
+      if (!k.open || neededSet.count(slot) != 0) continue;
+      if (victim == g_kernels.size() || k.lastUse < g_kernels[victim].lastUse) victim = slot;
+    }
+    if (victim == g_kernels.size()) break;
+    if (Close(victim, err, errMaxBytes) != 0) return 1;
+  }
+
+  for (size_t slot : needed) {
+    LazyKernel& k = g_kernels[slot];
+    if (k.open) continue;
+    if (tspice_furnsh(k.path.c_str(), err, errMaxBytes) != 0) return 1;
+    InvalidateLoadedSpkCoverage();
+    k.open = true;
+    g_open++;
+    g_opens++;
+  }
+  return 0;
+}
+
+int EnsureLazySpkForNames(
+    const std::string& target,
+    const std::string& observer,
+    double etMin,
+    double etMax,
+    char* err,
+    int errMaxBytes) {
+  if (g_by_body.empty()) return 0;
+
+  int targetId = 0;
+  int observerId = 0;
+  bool targetFound = false;
+  bool observerFound = false;
+  if (InternBodyCode(target, &targetId, &targetFound, err, errMaxBytes) != 0) return 1;
+  if (InternBodyCode(observer, &observerId, &observerFound, err, errMaxBytes) != 0) return 1;
+  // The query itself will fail on an unknown name; let CSPICE report it.
+  if (!targetFound || !observerFound) return 0;
+  return EnsureLazySpkForBodies(targetId, observerId, etMin, etMax, err, errMaxBytes);
+}
+
+}  // namespace tspice_backend_node
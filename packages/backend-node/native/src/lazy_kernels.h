@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace tspice_backend_node {
+
+// Addon-level lazy SPK manager for large catalogs of small SPK files.
+//
+// `RegisterLazyKernel()` scans a file's DAF summaries once (body, center and time span of every
+// segment) and closes it again. The ephemeris entrypoints (`spkezr`, `spkpos`, `spkez`, `spkgeo`,
+// their `*Id` / `*Into` / batch variants, ...) then call `EnsureLazySpkForBodies()` before
+// touching CSPICE: registered files with a segment for the target or observer over the requested
+// epochs (with a light-time margin), and transitively for those segments' centers, are
+// `furnsh`ed. When more than the budget of lazy files is open, the least-recently-used ones that
+// the current query does not need are unloaded again.
+//
+// Lazily opened files are loaded after (and so take priority over) anything loaded before them,
+// in the order queries first need them, so registered files should not overlap each other or the
+// eagerly loaded kernels for the same body and time. Other SPK readers (geometry, GF) only see
+// the files that are currently open.
+//
+// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller. `kclear`
+// drops every registration (`InvalidateLazyKernels()`); `unload(path)` forgets `path`
+// (`ForgetLazyKernel()`).
+
+struct LazyKernelStats {
+  uint32_t registered = 0;
+  uint32_t open = 0;
+  uint32_t budget = 0;
+  double opens = 0;
+  double closes = 0;
+};
+
+// Returns 0 on success or 1 with `err` filled (not an SPK, unreadable file). Registering the
+// same path twice is a no-op.
+int RegisterLazyKernel(const std::string& path, char* err, int errMaxBytes);
+
+// Unregisters `path`, unloading it if open. Returns 0 (with `*outFound`) or 1 with `err` filled.
+int UnregisterLazyKernel(const std::string& path, bool* outFound, char* err, int errMaxBytes);
+
+// Forget `path` without touching CSPICE (it was just unloaded by the caller).
+void ForgetLazyKernel(const std::string& path);
+
+// Forget every registration without touching CSPICE (after `kclear`).
+void InvalidateLazyKernels();
+
+// Maximum number of lazily opened files kept open (at least 1).
+void SetLazyKernelBudget(uint32_t budget);
+
+LazyKernelStats GetLazyKernelStats();
+
+// Open whatever registered files serve `target` relative to `observer` over `[etMin, etMax]`.
+// Cheap no-op when nothing is registered. Returns 0 or 1 with `err` filled when a `furnsh` fails.
+int EnsureLazySpkForBodies(int target, int observer, double etMin, double etMax, char* err, int errMaxBytes);
+
+// Same, resolving body names through the ID cache first. Unknown names are skipped (CSPICE reports
+// them when the query itself runs).
+int EnsureLazySpkForNames(
+    const std::string& target,
+    const std::string& observer,
+    double etMin,
+    double etMax,
+    char* err,
+    int errMaxBytes);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,439 @@
+#include "leapseconds.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+constexpr int64_t kSecondsPerDay = 86400;
+// J2000 is 2000-01-01T12:00:00, `kJ2000Day` days after 1970-01-01 plus half a day.
+constexpr int64_t kJ2000Day = 10957;
+constexpr int64_t kHalfDay = kSecondsPerDay / 2;
+
+// The fast paths stay this far away from every leap second so `:60` handling is left to CSPICE.
+constexpr double kLeapGuardSeconds = 2.0;
+
+constexpr int kMinYear = 1000;
+constexpr int kMaxYear = 9999;
+
+const char* const kMonthNames[12] = {
+    "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
+
+constexpr double kJ2000JulianDate = 2451545.0;
+
+// Written only with `g_cspice_mutex` held; read lock-free through `std::atomic_load`.
+std::shared_ptr<const LeapsecondTable> g_snapshot;
+// Guarded by `g_cspice_mutex`.
+bool g_snapshot_stale = true;
+
+bool IsLeapYear(int64_t y) {
+  return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+int DaysInMonth(int64_t y, int m) {
+  static const int kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return m == 2 && IsLeapYear(y) ? 29 : kDays[m - 1];
+}
+
+// Proleptic Gregorian date to days since 1970-01-01.
+int64_t DaysFromCivil(int64_t y, int m, int d) {
+  y -= m <= 2 ? 1 : 0;
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const int64_t yoe = y - era * 400;
+  const int64_t mp = (m + 9) % 12;
+  const int64_t doy = (153 * mp + 2) / 5 + d - 1;
+  const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+void CivilFromDays(int64_t z, int64_t* outY, int* outM, int* outD) {
+  z += 719468;
+  const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const int64_t doe = z - era * 146097;
+  const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const int64_t mp = (5 * doy + 2) / 153;
+  const int d = (int)(doy - (153 * mp + 2) / 5 + 1);
+  const int m = (int)(mp < 10 ? mp + 3 : mp - 9);
+  *outY = yoe + era * 400 + (m <= 2 ? 1 : 0);
+  *outM = m;
+  *outD = d;
+}
+
+int64_t FloorDiv(int64_t a, int64_t b) {
+  const int64_t q = a / b;
+  return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+bool ReadDigits(std::string_view s, size_t pos, size_t count, int* out) {
+  if (pos + count > s.size()) return false;
+  int v = 0;
+  for (size_t i = pos; i < pos + count; i++) {
+    const char c = s[i];
+    if (c < '0' || c > '9') return false;
+    v = v * 10 + (c - '0');
+  }
+  *out = v;
+  return true;
+}
+
+bool ReadPoolDoubles(const char* name, int expected, double* out, bool* outOk, char* err, int errMaxBytes) {
+  int n = 0;
+  int found = 0;
+  if (tspice_gdpool(name, 0, expected, &n, out, &found, err, errMaxBytes) != 0) {
+    return false;
+  }
+  *outOk = found != 0 && n == expected;
+  return true;
+}
+
+int LoadTable(LeapsecondTable* table, bool* outValid, char* err, int errMaxBytes) {
+  *outValid = false;
+
+  bool ok = false;
+  if (!ReadPoolDoubles("DELTET/DELTA_T_A", 1, &table->deltaTA, &ok, err, errMaxBytes)) return 1;
+  if (!ok) return 0;
+  if (!ReadPoolDoubles("DELTET/K", 1, &table->k, &ok, err, errMaxBytes)) return 1;
+  if (!ok) return 0;
+  if (!ReadPoolDoubles("DELTET/EB", 1, &table->eb, &ok, err, errMaxBytes)) return 1;
+  if (!ok) return 0;
+  double m[2] = {0.0, 0.0};
+  if (!ReadPoolDoubles("DELTET/M", 2, m, &ok, err, errMaxBytes)) return 1;
+  if (!ok) return 0;
+  table->m0 = m[0];
+  table->m1 = m[1];
+
+  int found = 0;
+  int n = 0;
+  char type[8];
+  if (tspice_dtpool("DELTET/DELTA_AT", &found, &n, type, (int)sizeof(type), err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (!found || n < 2 || n % 2 != 0 || std::strcmp(type, "N") != 0) return 0;
+
+  std::vector<double> pairs((size_t)n);
+  if (!ReadPoolDoubles("DELTET/DELTA_AT", n, pairs.data(), &ok, err, errMaxBytes)) return 1;
+  if (!ok) return 0;
+
+  table->deltaAt.clear();
+  table->leapUtc.clear();
+  for (int i = 0; i < n; i += 2) {
+    if (!table->leapUtc.empty() && !(pairs[(size_t)i + 1] > table->leapUtc.back())) return 0;
+    table->deltaAt.push_back(pairs[(size_t)i]);
+    table->leapUtc.push_back(pairs[(size_t)i + 1]);
+  }
+
+  *outValid = true;
+  return 0;
+}
+
+// Index of the last leap epoch at or before `utc`, or -1.
+ptrdiff_t LeapIndexForUtc(const LeapsecondTable& table, double utc) {
+  auto it = std::upper_bound(table.leapUtc.begin(), table.leapUtc.end(), utc);
+  return (it - table.leapUtc.begin()) - 1;
+}
+
+bool NearLeap(const LeapsecondTable& table, double utc) {
+  auto it = std::lower_bound(table.leapUtc.begin(), table.leapUtc.end(), utc - kLeapGuardSeconds);
+  return it != table.leapUtc.end() && *it <= utc + kLeapGuardSeconds;
+}
+
+double PeriodicTerm(const LeapsecondTable& table, double t) {
+  const double m = table.m0 + table.m1 * t;
+  return table.k * std::sin(m + table.eb * std::sin(m));
+}
+
+}  // namespace
+
+void InvalidateLeapsecondTable() {
+  g_snapshot_stale = true;
+  std::atomic_store(&g_snapshot, std::shared_ptr<const LeapsecondTable>());
+}
+
+std::shared_ptr<const LeapsecondTable> EnsureLeapsecondTable() {
+  if (g_snapshot_stale) {
+    auto table = std::make_shared<LeapsecondTable>();
+    bool valid = false;
+    // A CSPICE failure here just means no snapshot; the caller's CSPICE fallback reports it.
+    char err[256];
+    if (LoadTable(table.get(), &valid, err, (int)sizeof(err)) != 0) {
+      valid = false;
+    }
+    std::atomic_store(&g_snapshot, valid ? std::shared_ptr<const LeapsecondTable>(std::move(table)) : nullptr);
+    g_snapshot_stale = false;
+  }
+  return std::atomic_load(&g_snapshot);
+}
+
+std::shared_ptr<const LeapsecondTable> LeapsecondSnapshot() {
+  return std::atomic_load(&g_snapshot);
+}
+
+int DefaultTimeSystemIsUtc(bool* outIsUtc, char* err, int errMaxBytes) {
+  char system[32];
+  char calendar[32];
+  char zone[64];
+  if (tspice_timdef_get("SYSTEM", system, (int)sizeof(system), err, errMaxBytes) != 0 ||
+      tspice_timdef_get("CALENDAR", calendar, (int)sizeof(calendar), err, errMaxBytes) != 0 ||
+      tspice_timdef_get("ZONE", zone, (int)sizeof(zone), err, errMaxBytes) != 0) {
+    return 1;
+  }
+  const bool zoneUnset = zone[std::strspn(zone, " ")] == '\0';
+  *outIsUtc = std::strcmp(system, "UTC") == 0 &&
+      (std::strcmp(calendar, "GREGORIAN") == 0 || std::strcmp(calendar, "MIXED") == 0) && zoneUnset;
+  return 0;
+}
+
+bool ParseIsoUtc(std::string_view s, double* outUtc) {
+  int year = 0;
+  if (!ReadDigits(s, 0, 4, &year) || s.size() < 8 || s[4] != '-') return false;
+  if (year < kMinYear || year > kMaxYear) return false;
+
+  // `YYYY-MM-DD` or `YYYY-DDD`, distinguished by the position of the second `-`.
+  int64_t days = 0;
+  size_t pos = 0;
+  int month = 0;
+  int day = 0;
+  if (s.size() >= 10 && s[7] == '-') {
+    if (!ReadDigits(s, 5, 2, &month) || !ReadDigits(s, 8, 2, &day)) return false;
+    if (month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month)) return false;
+    days = DaysFromCivil(year, month, day);
+    pos = 10;
+  } else {
+    int doy = 0;
+    if (!ReadDigits(s, 5, 3, &doy)) return false;
+    if (doy < 1 || doy > (IsLeapYear(year) ? 366 : 365)) return false;
+    days = DaysFromCivil(year, 1, 1) + doy - 1;
+    pos = 8;
+  }
+
+  int hour = 0;
+  int minute = 0;
+  double seconds = 0.0;
+  if (pos < s.size()) {
+    // `THH:MM:SS` with optional fractional seconds.
+    if (s.size() < pos + 9 || s[pos] != 'T' || s[pos + 3] != ':' || s[pos + 6] != ':') return false;
+    int whole = 0;
+    if (!ReadDigits(s, pos + 1, 2, &hour) || !ReadDigits(s, pos + 4, 2, &minute) ||
+        !ReadDigits(s, pos + 7, 2, &whole)) {
+      return false;
+    }
+    if (hour > 23 || minute > 59 || whole > 59) return false;
+
+    size_t end = pos + 9;
+    if (end < s.size()) {
+      if (s[end] != '.' || end + 1 == s.size()) return false;
+      for (size_t i = end + 1; i < s.size(); i++) {
+        if (s[i] < '0' || s[i] > '9') return false;
+      }
+      // strtod needs a terminated buffer; the seconds field of any sane input is short.
+      const size_t len = s.size() - (pos + 7);
+      char buf[40];
+      if (len >= sizeof(buf)) return false;
+      std::memcpy(buf, s.data() + pos + 7, len);
+      buf[len] = '\0';
+      seconds = std::strtod(buf, nullptr);
+    } else {
+      seconds = (double)whole;
+    }
+  }
+
+  const int64_t wholeSeconds =
+      (days - kJ2000Day) * kSecondsPerDay - kHalfDay + (int64_t)hour * 3600 + (int64_t)minute * 60;
+  *outUtc = (double)wholeSeconds + seconds;
+  return true;
+}
+
+bool UtcToTdb(const LeapsecondTable& table, double utc, double* outEt) {
+  double delta = 0.0;
+  if (!DeltetFromTable(table, utc, true, &delta)) return false;
+  *outEt = utc + delta;
+  return true;
+}
+
+bool DeltetFromTable(const LeapsecondTable& table, double epoch, bool isUtc, double* outDelta) {
+  if (!std::isfinite(epoch)) return false;
+
+  ptrdiff_t i = -1;
+  double aet = epoch;
+  if (isUtc) {
+    i = LeapIndexForUtc(table, epoch);
+    if (i < 0 || NearLeap(table, epoch)) return false;
+    aet = epoch + table.deltaAt[(size_t)i] + table.deltaTA;
+  } else {
+    // A leap applies once ET reaches its epoch plus the new offset.
+    i = (ptrdiff_t)table.leapUtc.size() - 1;
+    while (i >= 0 && epoch < table.leapUtc[(size_t)i] + table.deltaTA + table.deltaAt[(size_t)i]) i--;
+    if (i < 0) return false;
+    const double threshold = table.leapUtc[(size_t)i] + table.deltaTA + table.deltaAt[(size_t)i];
+    if (epoch - threshold < kLeapGuardSeconds) return false;
+    if ((size_t)i + 1 < table.leapUtc.size()) {
+      const size_t j = (size_t)i + 1;
+      if (table.leapUtc[j] + table.deltaTA + table.deltaAt[j] - epoch < kLeapGuardSeconds) return false;
+    }
+  }
+
+  *outDelta = table.deltaTA + table.deltaAt[(size_t)i] + PeriodicTerm(table, aet);
+  return true;
+}
+
+namespace {
+
+enum class TimeSystem { kTai, kTdt, kTdb, kJdTdt, kJdTdb };
+
+bool ParseTimeSystem(std::string_view name, TimeSystem* out) {
+  if (name == "TAI") {
+    *out = TimeSystem::kTai;
+  } else if (name == "TDT") {
+    *out = TimeSystem::kTdt;
+  } else if (name == "TDB" || name == "ET") {
+    *out = TimeSystem::kTdb;
+  } else if (name == "JDTDT") {
+    *out = TimeSystem::kJdTdt;
+  } else if (name == "JDTDB" || name == "JED") {
+    *out = TimeSystem::kJdTdb;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool UnitimFromTable(
+    const LeapsecondTable& table,
+    double epoch,
+    std::string_view insys,
+    std::string_view outsys,
+    double* outEpoch) {
+  TimeSystem in = TimeSystem::kTai;
+  TimeSystem out = TimeSystem::kTai;
+  if (!ParseTimeSystem(insys, &in) || !ParseTimeSystem(outsys, &out)) return false;
+  if (in == out) {
+    *outEpoch = epoch;
+    return true;
+  }
+
+  // Everything goes through TDT seconds past J2000.
+  double tdt = 0.0;
+  switch (in) {
+    case TimeSystem::kTai:
+      tdt = epoch + table.deltaTA;
+      break;
+    case TimeSystem::kTdt:
+      tdt = epoch;
+      break;
+    case TimeSystem::kJdTdt:
+      tdt = (epoch - kJ2000JulianDate) * (double)kSecondsPerDay;
+      break;
+    case TimeSystem::kTdb:
+    case TimeSystem::kJdTdb: {
+      const double tdb =
+          in == TimeSystem::kTdb ? epoch : (epoch - kJ2000JulianDate) * (double)kSecondsPerDay;
+      // TDB = TDT + K sin(E(TDT)); the fixed point converges to double precision in a few steps.
+      tdt = tdb;
+      for (int iter = 0; iter < 3; iter++) tdt = tdb - PeriodicTerm(table, tdt);
+      break;
+    }
+  }
+
+  switch (out) {
+    case TimeSystem::kTai:
+      *outEpoch = tdt - table.deltaTA;
+      break;
+    case TimeSystem::kTdt:
+      *outEpoch = tdt;
+      break;
+    case TimeSystem::kJdTdt:
+      *outEpoch = kJ2000JulianDate + tdt / (double)kSecondsPerDay;
+      break;
+    case TimeSystem::kTdb:
+      *outEpoch = tdt + PeriodicTerm(table, tdt);
+      break;
+    case TimeSystem::kJdTdb:
+      *outEpoch = kJ2000JulianDate + (tdt + PeriodicTerm(table, tdt)) / (double)kSecondsPerDay;
+      break;
+  }
+  return true;
+}
+
+bool ParseUtcFormat(std::string_view format, UtcFormat* outFormat) {
+  if (format == "C") {
+    *outFormat = UtcFormat::kCalendar;
+  } else if (format == "D") {
+    *outFormat = UtcFormat::kDayOfYear;
+  } else if (format == "ISOC") {
+    *outFormat = UtcFormat::kIsoCalendar;
+  } else if (format == "ISOD") {
+    *outFormat = UtcFormat::kIsoDayOfYear;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool FormatTdbAsUtc(const LeapsecondTable& table, double et, UtcFormat format, int prec, std::string* out) {
+  if (prec < 0 || prec > kMaxFastUtcPrecision || !std::isfinite(et)) return false;
+
+  double delta = 0.0;
+  if (!DeltetFromTable(table, et, false, &delta)) return false;
+  const double utc = et - delta;
+  if (NearLeap(table, utc)) return false;
+
+  int64_t scale = 1;
+  for (int p = 0; p < prec; p++) scale *= 10;
+  const int64_t ticks = (int64_t)std::floor(utc * (double)scale + 0.5);
+  const int64_t fraction = ticks - FloorDiv(ticks, scale) * scale;
+  const int64_t seconds = FloorDiv(ticks, scale) + kHalfDay;
+
+  const int64_t dayNumber = FloorDiv(seconds, kSecondsPerDay) + kJ2000Day;
+  const int64_t secOfDay = seconds - FloorDiv(seconds, kSecondsPerDay) * kSecondsPerDay;
+  int64_t year = 0;
+  int month = 0;
+  int day = 0;
+  CivilFromDays(dayNumber, &year, &month, &day);
+  if (year < kMinYear || year > kMaxYear) return false;
+  const int64_t doy = dayNumber - DaysFromCivil(year, 1, 1) + 1;
+
+  char date[32];
+  switch (format) {
+    case UtcFormat::kCalendar:
+      std::snprintf(date, sizeof(date), "%04d %s %02d ", (int)year, kMonthNames[month - 1], day);
+      break;
+    case UtcFormat::kDayOfYear:
+      std::snprintf(date, sizeof(date), "%04d-%03d // ", (int)year, (int)doy);
+      break;
+    case UtcFormat::kIsoCalendar:
+      std::snprintf(date, sizeof(date), "%04d-%02d-%02dT", (int)year, month, day);
+      break;
+    case UtcFormat::kIsoDayOfYear:
+      std::snprintf(date, sizeof(date), "%04d-%03dT", (int)year, (int)doy);
+      break;
+  }
+
+  char buf[64];
+  int len = std::snprintf(
+      buf,
+      sizeof(buf),
+      "%s%02d:%02d:%02d",
+      date,
+      (int)(secOfDay / 3600),
+      (int)(secOfDay / 60 % 60),
+      (int)(secOfDay % 60));
+  if (prec > 0) {
+    len += std::snprintf(buf + len, sizeof(buf) - (size_t)len, ".%0*lld", prec, (long long)fraction);
+  }
+  out->assign(buf, (size_t)len);
+  return true;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tspice_backend_node {
+
+// Addon-level immutable snapshot of the loaded LSK's `DELTET/*` constants, plus native UTC <-> TDB
+// conversion for strict ISO-8601 input and the fixed `et2utc` output formats.
+//
+// The snapshot is published through an atomic `shared_ptr`, so `deltet`, `unitim` and their batch
+// variants read it without taking `g_cspice_mutex`. Pool changes only invalidate it (publishing
+// null, without calling into CSPICE); the next caller that holds the mutex rebuilds it with
+// `EnsureLeapsecondTable()`. Epochs the snapshot does not cover (pre-1972, within a couple of
+// seconds of a leap second) and unknown systems still go through CSPICE under the mutex.
+//
+// `str2etBatch` / `et2utcBatch` try the fast paths first and fall back to `str2et_c` /
+// `et2utc_c` for anything else: other input syntaxes, non-default `TIMDEF` settings, `"J"` output
+// and precisions above `kMaxFastUtcPrecision`. The conversion follows `deltet_c`:
+//
+//   ET - UTC = DELTA_T_A + DELTA_AT + K * sin(M + EB * sin(M)),  M = M0 + M1 * t
+//
+// NOTE: `InvalidateLeapsecondTable()` and `EnsureLeapsecondTable()` require `g_cspice_mutex` to be
+// held by the caller; every `furnsh` / `unload` / `kclear` / `p*pool` entrypoint calls
+// `InvalidateLeapsecondTable()` after touching CSPICE. Everything else is safe from any thread.
+
+struct LeapsecondTable {
+  double deltaTA = 0.0;
+  double k = 0.0;
+  double eb = 0.0;
+  double m0 = 0.0;
+  double m1 = 0.0;
+  // `DELTET/DELTA_AT` pairs: leap epochs (UTC seconds past J2000) and the TAI-UTC offset that
+  // applies from each epoch on.
+  std::vector<double> leapUtc;
+  std::vector<double> deltaAt;
+};
+
+enum class UtcFormat { kCalendar, kDayOfYear, kIsoCalendar, kIsoDayOfYear };
+
+constexpr int kMaxFastUtcPrecision = 6;
+
+void InvalidateLeapsecondTable();
+
+// Returns the current snapshot, rebuilding it from the kernel pool if it was invalidated. Null when
+// no LSK is loaded or its `DELTET/*` variables are malformed, in which case callers should let
+// CSPICE report the error.
+std::shared_ptr<const LeapsecondTable> EnsureLeapsecondTable();
+
+// Lock-free read of the published snapshot (null if none, or if it has not been rebuilt since the
+// last invalidation).
+std::shared_ptr<const LeapsecondTable> LeapsecondSnapshot();
+
+// Whether `str2et_c` would currently read an ISO string as a Gregorian UTC epoch (`TIMDEF`
+// `SYSTEM = UTC`, no `ZONE`, calendar `MIXED` or `GREGORIAN`).
+int DefaultTimeSystemIsUtc(bool* outIsUtc, char* err, int errMaxBytes);
+
+// `YYYY-MM-DD[THH:MM:SS[.fff]]` or `YYYY-DDD[THH:MM:SS[.fff]]` to UTC seconds past J2000. Returns
+// false (without touching `*outUtc`) for anything else, including out-of-range fields and
+// `:60` leap seconds.
+bool ParseIsoUtc(std::string_view text, double* outUtc);
+
+// UTC seconds past J2000 to TDB (deltet_c with `"UTC"`). False when `utc` is outside the range
+// the fast path handles.
+bool UtcToTdb(const LeapsecondTable& table, double utc, double* outEt);
+
+// deltet_c (`isUtc` selects `"UTC"` vs `"ET"` epochs). False when `epoch` is outside the range the
+// snapshot handles.
+bool DeltetFromTable(const LeapsecondTable& table, double epoch, bool isUtc, double* outDelta);
+
+// unitim_c between `TAI`, `TDT`, `TDB`, `ET`, `JDTDT`, `JDTDB` and `JED`. False for any other
+// system name.
+bool UnitimFromTable(
+    const LeapsecondTable& table,
+    double epoch,
+    std::string_view insys,
+    std::string_view outsys,
+    double* outEpoch);
+
+// `"C"`, `"D"`, `"ISOC"` or `"ISOD"`.
+bool ParseUtcFormat(std::string_view format, UtcFormat* outFormat);
+
+// et2utc_c for the formats above and `0 <= prec <= kMaxFastUtcPrecision`. False when the epoch
+// needs CSPICE (see above).
+bool FormatTdbAsUtc(const LeapsecondTable& table, double et, UtcFormat format, int prec, std::string* out);
+
+}  // namespace tspice_backend_node
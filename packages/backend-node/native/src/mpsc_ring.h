@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace tspice_backend_node {
+
+// Bounded lock-free multi-producer / single-consumer ring buffer.
+//
+// Each slot carries a sequence number (Vyukov's bounded queue): producers claim a slot with a CAS
+// on `head_` and publish it by bumping the slot's sequence; the single consumer reads slots in
+// order without any atomic RMW. `TryPush` fails (instead of blocking) when the ring is full.
+//
+// `T` must be trivially copyable; the executor stores raw task pointers.
+template <typename T, size_t Capacity>
+class MpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+ public:
+  MpscRing() {
+    for (size_t i = 0; i < Capacity; i++) {
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRing(const MpscRing&) = delete;
+  MpscRing& operator=(const MpscRing&) = delete;
+
+  // Safe to call from any thread.
+  bool TryPush(T value) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = cells_[pos & (Capacity - 1)];
+      const size_t seq = cell.seq.load(std::memory_order_acquire);
+      const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // full
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Must only be called from the single consumer thread.
+  bool TryPop(T* out) {
+    Cell& cell = cells_[tail_ & (Capacity - 1)];
+    const size_t seq = cell.seq.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail_ + 1) < 0) {
+      return false;  // empty (or the producer that claimed this slot hasn't published yet)
+    }
+    *out = cell.value;
+    cell.seq.store(tail_ + Capacity, std::memory_order_release);
+    tail_++;
+    return true;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T value;
+  };
+
+  Cell cells_[Capacity];
+  alignas(64) std::atomic<size_t> head_{0};
+  alignas(64) size_t tail_ = 0;
+};
+
+}  // namespace tspice_backend_node
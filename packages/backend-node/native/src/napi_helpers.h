@@ -4,10 +4,12 @@
 
 #include "tspice_backend_shim.h"
 
+#include <cstring>
 #include <functional>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace tspice_napi {
@@ -24,14 +26,38 @@ inline void ThrowSpiceError(Napi::Env env, const char* message) {
   ThrowSpiceError(env, std::string(message ? message : ""));
 }
 
-inline void ThrowSpiceError(
+// SPICE short/long/traceback fields captured from the C shim's out-of-band error state.
+struct SpiceErrorFields {
+  std::string shortMsg;
+  std::string longMsg;
+  std::string traceMsg;
+};
+
+// Snapshots the shim's last-error fields. Callers running off the JS thread (e.g. an
+// `AsyncWorker::Execute`) must do this while still holding the CSPICE mutex, since a later call
+// will overwrite them.
+inline SpiceErrorFields CaptureLastSpiceErrorFields() {
+  char shortMsg[1841];
+  char longMsg[1841];
+  char traceMsg[1841];
+  shortMsg[0] = '\0';
+  longMsg[0] = '\0';
+  traceMsg[0] = '\0';
+
+  tspice_get_last_error_short(shortMsg, (int)sizeof(shortMsg));
+  tspice_get_last_error_long(longMsg, (int)sizeof(longMsg));
+  tspice_get_last_error_trace(traceMsg, (int)sizeof(traceMsg));
+
+  return SpiceErrorFields{shortMsg, longMsg, traceMsg};
+}
+
+inline Napi::Error MakeSpiceError(
     Napi::Env env,
     const std::string& context,
     const char* err,
+    const SpiceErrorFields& fields,
     const char* spiceOp = nullptr,
     std::function<void(Napi::Object&)> attachContext = {}) {
-  // This overload is used for CSPICE-signaled failures, where the C shim has
-  // already captured/cleared SPICE error status and produced an error message.
   std::string message = (err && err[0] != '\0') ? std::string(err) : "Unknown CSPICE error";
   if (!context.empty()) {
     message = context + ":\n" + message;
@@ -55,33 +81,32 @@ inline void ThrowSpiceError(
   // The C shim stores SPICE fields out-of-band, so for non-CSPICE validation
   // errors we must avoid accidentally attaching stale fields from a previous
   // CSPICE failure.
-  char shortMsg[1841];
-  char longMsg[1841];
-  char traceMsg[1841];
-  shortMsg[0] = '\0';
-  longMsg[0] = '\0';
-  traceMsg[0] = '\0';
-
-  tspice_get_last_error_short(shortMsg, (int)sizeof(shortMsg));
-  tspice_get_last_error_long(longMsg, (int)sizeof(longMsg));
-  tspice_get_last_error_trace(traceMsg, (int)sizeof(traceMsg));
-
   const bool shouldAttachSpiceFields =
-      (shortMsg[0] != '\0') && (message.find(shortMsg) != std::string::npos);
+      !fields.shortMsg.empty() && (message.find(fields.shortMsg) != std::string::npos);
 
   if (shouldAttachSpiceFields) {
-    if (shortMsg[0] != '\0') {
-      obj.Set("spiceShort", Napi::String::New(env, shortMsg));
-    }
-    if (longMsg[0] != '\0') {
-      obj.Set("spiceLong", Napi::String::New(env, longMsg));
+    obj.Set("spiceShort", Napi::String::New(env, fields.shortMsg));
+    if (!fields.longMsg.empty()) {
+      obj.Set("spiceLong", Napi::String::New(env, fields.longMsg));
     }
-    if (traceMsg[0] != '\0') {
-      obj.Set("spiceTrace", Napi::String::New(env, traceMsg));
+    if (!fields.traceMsg.empty()) {
+      obj.Set("spiceTrace", Napi::String::New(env, fields.traceMsg));
     }
   }
 
-  ThrowSpiceError(jsErr);
+  return jsErr;
+}
+
+inline void ThrowSpiceError(
+    Napi::Env env,
+    const std::string& context,
+    const char* err,
+    const char* spiceOp = nullptr,
+    std::function<void(Napi::Object&)> attachContext = {}) {
+  // This overload is used for CSPICE-signaled failures, where the C shim has
+  // already captured/cleared SPICE error status and produced an error message.
+  ThrowSpiceError(MakeSpiceError(
+      env, context, err, CaptureLastSpiceErrorFields(), spiceOp, std::move(attachContext)));
 }
 
 /**
@@ -145,6 +170,77 @@ inline Napi::Array MakeNumberArray(Napi::Env env, const double* values, size_t c
   return arr;
 }
 
+/**
+* Reads a `Float64Array` argument without copying.
+*
+* The returned pointer aliases the typed array's backing store and is only valid for the
+* duration of the current (synchronous) native call.
+*/
+inline bool ReadFloat64ArrayArg(
+    Napi::Env env,
+    const Napi::Value& value,
+    const double** outData,
+    size_t* outLength,
+    const char* name) {
+  const char* safeName = (name != nullptr) ? name : "<unnamed>";
+
+  if (outData == nullptr || outLength == nullptr) {
+    ThrowSpiceError(
+        Napi::Error::New(env, std::string("Internal error: out is null while reading ") + safeName));
+    return false;
+  }
+
+  if (!value.IsTypedArray() ||
+      value.As<Napi::TypedArray>().TypedArrayType() != napi_float64_array) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(safeName) + " must be a Float64Array"));
+    return false;
+  }
+
+  Napi::Float64Array arr = value.As<Napi::Float64Array>();
+  *outData = arr.Data();
+  *outLength = arr.ElementLength();
+  return true;
+}
+
+/**
+* Resolves a caller-supplied `Float64Array` output argument of exactly `expectedLength` elements.
+*
+* Used by the `*Into` entrypoints, which write results straight into the typed array's backing
+* store instead of allocating a boxed JS array. To write into a larger buffer at an offset, pass
+* a `subarray()` view.
+*/
+inline bool ReadFloat64ArrayOut(
+    Napi::Env env,
+    const Napi::Value& value,
+    size_t expectedLength,
+    double** outData,
+    const char* name) {
+  const char* safeName = (name != nullptr) ? name : "<unnamed>";
+
+  if (outData == nullptr) {
+    ThrowSpiceError(
+        Napi::Error::New(env, std::string("Internal error: out is null while reading ") + safeName));
+    return false;
+  }
+
+  if (!value.IsTypedArray() ||
+      value.As<Napi::TypedArray>().TypedArrayType() != napi_float64_array) {
+    ThrowSpiceError(Napi::TypeError::New(env, std::string(safeName) + " must be a Float64Array"));
+    return false;
+  }
+
+  Napi::Float64Array arr = value.As<Napi::Float64Array>();
+  if (arr.ElementLength() != expectedLength) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        std::string(safeName) + " must have length " + std::to_string(expectedLength)));
+    return false;
+  }
+
+  *outData = arr.Data();
+  return true;
+}
+
 inline bool SetExportChecked(
     Napi::Env env,
     Napi::Object exports,
@@ -277,6 +373,21 @@ inline Napi::String FixedWidthToJsString(Napi::Env env, const char* buf, size_t
   return Napi::String::New(env, out);
 }
 
+// Packs `names` as `{ offsets, bytes }`: name i is bytes[offsets[i], offsets[i + 1]).
+inline Napi::Object MakePackedStrings(Napi::Env env, const std::string& bytes, const std::vector<int32_t>& offsets) {
+  Napi::Uint8Array bytesOut = Napi::Uint8Array::New(env, bytes.size());
+  if (!bytes.empty()) {
+    std::memcpy(bytesOut.Data(), bytes.data(), bytes.size());
+  }
+  Napi::Int32Array offsetsOut = Napi::Int32Array::New(env, offsets.size());
+  std::memcpy(offsetsOut.Data(), offsets.data(), offsets.size() * sizeof(int32_t));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("offsets", offsetsOut);
+  result.Set("bytes", bytesOut);
+  return result;
+}
+
 /**
 * Parsed JS `string[]` argument with stable `c_str()` pointers for the duration of the call.
 */
@@ -0,0 +1,63 @@
+#include "native_memory.h"
+
+#include <atomic>
+
+namespace tspice_backend_node {
+
+namespace {
+
+struct KindTotals {
+  const char* name;
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> bytes{0};
+};
+
+KindTotals g_totals[] = {{"cells"}, {"windows"}, {"spkStreams"}, {"dskBvhs"}, {"kernelBuffers"}};
+
+KindTotals& TotalsFor(NativeMemoryKind kind) {
+  return g_totals[static_cast<size_t>(kind)];
+}
+
+void ReportToV8(Napi::Env env, int64_t delta) {
+  int64_t adjusted = 0;
+  // Only fails for invalid arguments; nothing useful to do about it.
+  (void)napi_adjust_external_memory(env, delta, &adjusted);
+}
+
+}  // namespace
+
+void TrackNativeAllocation(Napi::Env env, NativeMemoryKind kind, size_t bytes) {
+  KindTotals& totals = TotalsFor(kind);
+  totals.count.fetch_add(1, std::memory_order_relaxed);
+  totals.bytes.fetch_add(bytes, std::memory_order_relaxed);
+  ReportToV8(env, static_cast<int64_t>(bytes));
+}
+
+void TrackNativeRelease(Napi::Env env, NativeMemoryKind kind, size_t bytes) {
+  TrackNativeRelease(kind, bytes);
+  ReportToV8(env, -static_cast<int64_t>(bytes));
+}
+
+void TrackNativeRelease(NativeMemoryKind kind, size_t bytes) {
+  KindTotals& totals = TotalsFor(kind);
+  totals.count.fetch_sub(1, std::memory_order_relaxed);
+  totals.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+Napi::Object NativeMemoryStatsToJs(Napi::Env env) {
+  Napi::Object out = Napi::Object::New(env);
+  uint64_t totalBytes = 0;
+  for (const KindTotals& totals : g_totals) {
+    const uint64_t bytes = totals.bytes.load(std::memory_order_relaxed);
+    totalBytes += bytes;
+
+    Napi::Object kind = Napi::Object::New(env);
+    kind.Set("count", Napi::Number::New(env, static_cast<double>(totals.count.load(std::memory_order_relaxed))));
+    kind.Set("bytes", Napi::Number::New(env, static_cast<double>(bytes)));
+    out.Set(totals.name, kind);
+  }
+  out.Set("totalBytes", Napi::Number::New(env, static_cast<double>(totalBytes)));
+  return out;
+}
+
+}  // namespace tspice_backend_node
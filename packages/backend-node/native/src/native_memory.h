@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Accounting for long-lived native allocations that JS holds by id or handle.
+//
+// V8 only sees the small numbers JS keeps for these, so a worker can hold gigabytes of cells or
+// DSK indexes without ever feeling GC pressure. Every allocation is reported to the owning
+// environment with `napi_adjust_external_memory` (and taken back when it is freed), and counted
+// in process-wide per-kind totals that `getNativeStats().memory` reports. Sizes are the bytes the
+// addon asked for (element storage plus headers), not allocator overhead.
+//
+// Releases during environment teardown use the counters-only overload: the isolate is going away
+// and no longer needs telling.
+
+enum class NativeMemoryKind : uint8_t {
+  kCells = 0,
+  kWindows = 1,
+  kSpkStreams = 2,
+  kDskBvhs = 3,
+  // In-memory kernels (`furnshBuffer`) until `releaseKernelBuffer`. Process-wide like the kernel
+  // pool; a worker that exits with some still loaded leaves them counted.
+  kKernelBuffers = 4,
+};
+
+void TrackNativeAllocation(Napi::Env env, NativeMemoryKind kind, size_t bytes);
+void TrackNativeRelease(Napi::Env env, NativeMemoryKind kind, size_t bytes);
+void TrackNativeRelease(NativeMemoryKind kind, size_t bytes);
+
+// `{ cells, windows, spkStreams, dskBvhs, kernelBuffers }`, each `{ count, bytes }`, plus `totalBytes`.
+Napi::Object NativeMemoryStatsToJs(Napi::Env env);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,335 @@
+#include "native_stats.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "addon_common.h"
+#include "napi_helpers.h"
+#include "native_memory.h"
+
+using tspice_napi::SetExportChecked;
+
+namespace tspice_backend_node {
+
+std::atomic<bool> g_native_stats_enabled{false};
+
+namespace {
+
+constexpr unsigned kSubBucketBits = 2;
+constexpr uint64_t kSubBuckets = uint64_t{1} << kSubBucketBits;
+// Values from 2^kMaxPow ns (~4.9 hours) up land in the last bucket.
+constexpr unsigned kMaxPow = 44;
+constexpr size_t kBuckets = static_cast<size_t>(kMaxPow) << kSubBucketBits;
+
+uint64_t NowNs() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+// Values below `kSubBuckets` get a bucket each; above that, every power of two is split into
+// `kSubBuckets` equal parts.
+size_t BucketIndex(uint64_t ns) {
+  if (ns < kSubBuckets) return static_cast<size_t>(ns);
+  unsigned pow = kSubBucketBits;
+  while (pow + 1 < 64 && (ns >> (pow + 1)) != 0) ++pow;
+  const size_t sub = static_cast<size_t>((ns >> (pow - kSubBucketBits)) & (kSubBuckets - 1));
+  const size_t index = (static_cast<size_t>(pow - kSubBucketBits + 1) << kSubBucketBits) + sub;
+  return index < kBuckets ? index : kBuckets - 1;
+}
+
+uint64_t BucketLowerBound(size_t index) {
+  if (index < kSubBuckets) return index;
+  const unsigned pow = static_cast<unsigned>(index >> kSubBucketBits) + kSubBucketBits - 1;
+  return (kSubBuckets + (index & (kSubBuckets - 1))) << (pow - kSubBucketBits);
+}
+
+struct Histogram {
+  std::atomic<uint64_t> buckets[kBuckets];
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> sumNs{0};
+  std::atomic<uint64_t> maxNs{0};
+
+  Histogram() { Reset(); }
+
+  void Record(uint64_t ns) {
+    buckets[BucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sumNs.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t prev = maxNs.load(std::memory_order_relaxed);
+    while (ns > prev && !maxNs.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {
+    }
+  }
+
+  void Reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sumNs.store(0, std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+  }
+};
+
+struct ExportStats {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> errors{0};
+  Histogram total;
+  Histogram lockWait;
+  Histogram cspice;
+  Histogram marshal;
+
+  void Reset() {
+    calls.store(0, std::memory_order_relaxed);
+    errors.store(0, std::memory_order_relaxed);
+    total.Reset();
+    lockWait.Reset();
+    cspice.Reset();
+    marshal.Reset();
+  }
+};
+
+constexpr const char* kUnattributed = "(unattributed)";
+
+// Entries are never removed, so the raw pointers handed to trampolines stay valid; one entry per
+// export name is shared by every env (main thread and workers) that loads the addon.
+std::mutex g_stats_mutex;
+std::map<std::string, std::unique_ptr<ExportStats>> g_stats;
+ExportStats g_unattributed;
+
+ExportStats* StatsFor(const std::string& name) {
+  std::lock_guard<std::mutex> lock(g_stats_mutex);
+  auto& slot = g_stats[name];
+  if (!slot) slot = std::make_unique<ExportStats>();
+  return slot.get();
+}
+
+// The instrumented call running on this thread, if any.
+struct CallState {
+  ExportStats* stats;
+  uint64_t lockedNs;
+};
+thread_local CallState* t_call = nullptr;
+
+ExportStats& CurrentStats() {
+  return t_call != nullptr ? *t_call->stats : g_unattributed;
+}
+
+struct InstrumentedExport {
+  Napi::FunctionReference fn;
+  ExportStats* stats;
+  const char* traceName;
+};
+
+constexpr const char* kTraceLockWait = "CspiceLock wait";
+constexpr const char* kTraceCspice = "CSPICE (lock held)";
+
+constexpr size_t kInlineArgs = 8;
+
+Napi::Value InstrumentedCall(const Napi::CallbackInfo& info) {
+  auto* target = static_cast<InstrumentedExport*>(info.Data());
+  Napi::Env env = info.Env();
+
+  const size_t argc = info.Length();
+  napi_value inlineArgs[kInlineArgs];
+  std::vector<napi_value> heapArgs;
+  napi_value* argv = inlineArgs;
+  if (argc > kInlineArgs) {
+    heapArgs.resize(argc);
+    argv = heapArgs.data();
+  }
+  for (size_t i = 0; i < argc; i++) argv[i] = info[i];
+
+  CallState state{target->stats, 0};
+  CallState* outer = t_call;
+  t_call = &state;
+  const uint64_t start = NowNs();
+  Napi::Value result = target->fn.Value().Call(info.This(), argc, argv);
+  const uint64_t elapsed = NowNs() - start;
+  t_call = outer;
+
+  if (NativeTraceEnabled()) RecordTraceSpan(TraceCategory::kExport, target->traceName, start, elapsed);
+  if (!NativeStatsEnabled()) return result;
+
+  ExportStats& stats = *target->stats;
+  stats.calls.fetch_add(1, std::memory_order_relaxed);
+  if (env.IsExceptionPending()) stats.errors.fetch_add(1, std::memory_order_relaxed);
+  stats.total.Record(elapsed);
+  stats.marshal.Record(elapsed > state.lockedNs ? elapsed - state.lockedNs : 0);
+  return result;
+}
+
+uint64_t Quantile(const Histogram& h, uint64_t count, double q) {
+  const uint64_t maxNs = h.maxNs.load(std::memory_order_relaxed);
+  const uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(count) + 0.5);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    seen += h.buckets[i].load(std::memory_order_relaxed);
+    if (seen >= rank && seen > 0) {
+      // Highest value the bucket can hold, capped at the recorded maximum.
+      const uint64_t upper = i + 1 < kBuckets ? BucketLowerBound(i + 1) - 1 : maxNs;
+      return upper < maxNs ? upper : maxNs;
+    }
+  }
+  return maxNs;
+}
+
+Napi::Object HistogramToJs(Napi::Env env, const Histogram& h) {
+  const uint64_t count = h.count.load(std::memory_order_relaxed);
+
+  std::vector<double> packed;
+  for (size_t i = 0; i < kBuckets; i++) {
+    const uint64_t n = h.buckets[i].load(std::memory_order_relaxed);
+    if (n == 0) continue;
+    packed.push_back(static_cast<double>(BucketLowerBound(i)));
+    packed.push_back(static_cast<double>(n));
+  }
+  Napi::Float64Array buckets = Napi::Float64Array::New(env, packed.size());
+  if (!packed.empty()) std::memcpy(buckets.Data(), packed.data(), packed.size() * sizeof(double));
+
+  Napi::Object out = Napi::Object::New(env);
+  out.Set("count", Napi::Number::New(env, static_cast<double>(count)));
+  out.Set("sumNs", Napi::Number::New(env, static_cast<double>(h.sumNs.load(std::memory_order_relaxed))));
+  out.Set("maxNs", Napi::Number::New(env, static_cast<double>(h.maxNs.load(std::memory_order_relaxed))));
+  out.Set("p50Ns", Napi::Number::New(env, static_cast<double>(Quantile(h, count, 0.5))));
+  out.Set("p90Ns", Napi::Number::New(env, static_cast<double>(Quantile(h, count, 0.9))));
+  out.Set("p99Ns", Napi::Number::New(env, static_cast<double>(Quantile(h, count, 0.99))));
+  out.Set("buckets", buckets);
+  return out;
+}
+
+Napi::Object ExportStatsToJs(Napi::Env env, const ExportStats& stats) {
+  Napi::Object out = Napi::Object::New(env);
+  out.Set("calls", Napi::Number::New(env, static_cast<double>(stats.calls.load(std::memory_order_relaxed))));
+  out.Set("errors", Napi::Number::New(env, static_cast<double>(stats.errors.load(std::memory_order_relaxed))));
+  out.Set("total", HistogramToJs(env, stats.total));
+  out.Set("lockWait", HistogramToJs(env, stats.lockWait));
+  out.Set("cspice", HistogramToJs(env, stats.cspice));
+  out.Set("marshal", HistogramToJs(env, stats.marshal));
+  return out;
+}
+
+bool IsUsed(const ExportStats& stats) {
+  return stats.calls.load(std::memory_order_relaxed) != 0 ||
+      stats.lockWait.count.load(std::memory_order_relaxed) != 0;
+}
+
+bool IsStatsExport(const std::string& name) {
+  return name == "getNativeStats" || name == "resetNativeStats" || name == "takeNativeTrace";
+}
+
+}  // namespace
+
+uint64_t LockCspiceMutexTimed() {
+  const uint64_t start = NowNs();
+  g_cspice_mutex.lock();
+  const uint64_t acquired = NowNs();
+
+  const uint64_t waited = acquired - start;
+  if (NativeStatsEnabled()) {
+    CurrentStats().lockWait.Record(waited);
+    if (t_call != nullptr) t_call->lockedNs += waited;
+  }
+  if (NativeTraceEnabled()) RecordTraceSpan(TraceCategory::kLockWait, kTraceLockWait, start, waited);
+  // 0 marks an untimed lock in `CspiceLock`.
+  return acquired != 0 ? acquired : 1;
+}
+
+void UnlockCspiceMutexTimed(uint64_t acquiredNs) {
+  const uint64_t held = NowNs() - acquiredNs;
+  g_cspice_mutex.unlock();
+
+  if (NativeStatsEnabled()) {
+    CurrentStats().cspice.Record(held);
+    if (t_call != nullptr) t_call->lockedNs += held;
+  }
+  if (NativeTraceEnabled()) RecordTraceSpan(TraceCategory::kCspice, kTraceCspice, acquiredNs, held);
+}
+
+}  // namespace tspice_backend_node
+
+static Napi::Value GetNativeStats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Object out = Napi::Object::New(env);
+  out.Set("enabled", Napi::Boolean::New(env, tspice_backend_node::NativeStatsEnabled()));
+
+  Napi::Object exportsOut = Napi::Object::New(env);
+  {
+    std::lock_guard<std::mutex> lock(tspice_backend_node::g_stats_mutex);
+    for (const auto& entry : tspice_backend_node::g_stats) {
+      if (!tspice_backend_node::IsUsed(*entry.second)) continue;
+      exportsOut.Set(entry.first, tspice_backend_node::ExportStatsToJs(env, *entry.second));
+    }
+  }
+  if (tspice_backend_node::IsUsed(tspice_backend_node::g_unattributed)) {
+    exportsOut.Set(
+        tspice_backend_node::kUnattributed,
+        tspice_backend_node::ExportStatsToJs(env, tspice_backend_node::g_unattributed));
+  }
+  out.Set("exports", exportsOut);
+  // Always collected, unlike the per-export numbers above.
+  out.Set("memory", tspice_backend_node::NativeMemoryStatsToJs(env));
+  return out;
+}
+
+static Napi::Value ResetNativeStats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  {
+    std::lock_guard<std::mutex> lock(tspice_backend_node::g_stats_mutex);
+    for (auto& entry : tspice_backend_node::g_stats) entry.second->Reset();
+  }
+  tspice_backend_node::g_unattributed.Reset();
+  return env.Undefined();
+}
+
+namespace tspice_backend_node {
+
+void RegisterNativeStats(Napi::Env env, Napi::Object exports) {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    const char* flag = std::getenv("TSPICE_NATIVE_STATS");
+    const bool enabled = flag != nullptr && flag[0] != '\0' && std::strcmp(flag, "0") != 0;
+    g_native_stats_enabled.store(enabled, std::memory_order_relaxed);
+  });
+
+  if (!SetExportChecked(env, exports, "getNativeStats", Napi::Function::New(env, GetNativeStats), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "resetNativeStats", Napi::Function::New(env, ResetNativeStats), __func__)) {
+    return;
+  }
+}
+
+void InstrumentExports(Napi::Env env, Napi::Object exports) {
+  if (!NativeInstrumentationEnabled()) return;
+
+  Napi::Array names = exports.GetPropertyNames();
+  if (env.IsExceptionPending()) return;
+
+  for (uint32_t i = 0; i < names.Length(); i++) {
+    const std::string name = names.Get(i).As<Napi::String>().Utf8Value();
+    if (IsStatsExport(name)) continue;
+
+    Napi::Value value = exports.Get(name);
+    if (!value.IsFunction()) continue;
+
+    auto* target = new InstrumentedExport{
+        Napi::Persistent(value.As<Napi::Function>()), StatsFor(name), InternTraceName(name.c_str())};
+    Napi::Function wrapper = Napi::Function::New(env, InstrumentedCall, name.c_str(), target);
+    if (env.IsExceptionPending()) {
+      delete target;
+      return;
+    }
+    wrapper.AddFinalizer([](Napi::Env, InstrumentedExport* data) { delete data; }, target);
+    exports.Set(name, wrapper);
+    if (env.IsExceptionPending()) return;
+  }
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <napi.h>
+
+#include "native_trace.h"
+
+namespace tspice_backend_node {
+
+// Opt-in per-export instrumentation.
+//
+// Enabled for the life of the process by setting `TSPICE_NATIVE_STATS` (to anything but "" or
+// "0") before the addon is loaded. When enabled, every export is replaced by a trampoline that
+// counts calls and times them, and `CspiceLock` records how long each call waited for and then
+// held `g_cspice_mutex`; whatever remains of a call's wall time is reported as marshalling. The
+// same trampolines and lock hooks feed the trace recorder (`native_trace.h`). With neither
+// enabled nothing is wrapped and `CspiceLock` costs two relaxed atomic loads.
+//
+// Times are recorded into log-linear histograms (4 sub-buckets per power of two nanoseconds, so
+// any reported quantile is within ~19% of the recorded value). Lock time taken outside an
+// instrumented call (async workers, the CSPICE executor thread) is attributed to "(unattributed)".
+
+extern std::atomic<bool> g_native_stats_enabled;
+
+inline bool NativeStatsEnabled() {
+  return g_native_stats_enabled.load(std::memory_order_relaxed);
+}
+
+// Stats or tracing: whether exports are wrapped and `CspiceLock` is timed.
+inline bool NativeInstrumentationEnabled() {
+  return NativeStatsEnabled() || NativeTraceEnabled();
+}
+
+// `CspiceLock` hooks: lock/unlock `g_cspice_mutex`, recording the wait and hold times. The lock
+// returns the acquisition timestamp for the matching unlock.
+uint64_t LockCspiceMutexTimed();
+void UnlockCspiceMutexTimed(uint64_t acquiredNs);
+
+// Reads `TSPICE_NATIVE_STATS` (once per process) and registers `getNativeStats()` /
+// `resetNativeStats()`. Call before any other domain registers its exports.
+void RegisterNativeStats(Napi::Env env, Napi::Object exports);
+
+// When stats or tracing are enabled, wraps every function already on `exports` in the timing
+// trampoline.
+// Call after every domain has registered its exports.
+void InstrumentExports(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,218 @@
+#include "native_trace.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "napi_helpers.h"
+
+using tspice_napi::SetExportChecked;
+using tspice_napi::ThrowSpiceError;
+
+namespace tspice_backend_node {
+
+std::atomic<bool> g_native_trace_enabled{false};
+
+namespace {
+
+constexpr uint64_t kRingMask = kTraceRingEvents - 1;
+static_assert((kTraceRingEvents & kRingMask) == 0, "kTraceRingEvents must be a power of two");
+
+constexpr const char* kCategoryNames[] = {"export", "lock", "cspice"};
+
+// A drain may read a slot while its owner overwrites it, so each slot carries a sequence stamp
+// (event index + 1, 0 while being written) checked on both sides of the read.
+struct TraceEvent {
+  std::atomic<uint64_t> seq{0};
+  std::atomic<uint64_t> startNs{0};
+  std::atomic<uint64_t> durNs{0};
+  std::atomic<const char*> name{nullptr};
+  std::atomic<uint8_t> category{0};
+};
+
+// Single producer (the owning thread), single consumer (a drain, under `g_rings_mutex`).
+struct TraceRing {
+  uint32_t tid = 0;
+  // Events ever written; slot `i & kRingMask` holds event `i`. Published with release.
+  std::atomic<uint64_t> head{0};
+  // First event not yet drained. Consumer only.
+  uint64_t tail = 0;
+  std::unique_ptr<TraceEvent[]> events{new TraceEvent[kTraceRingEvents]};
+};
+
+// Rings are only ever added, so the pointer each thread caches stays valid.
+std::mutex g_rings_mutex;
+std::vector<std::unique_ptr<TraceRing>> g_rings;
+uint64_t g_dropped = 0;
+
+thread_local TraceRing* t_ring = nullptr;
+
+std::mutex g_names_mutex;
+std::set<std::string> g_names;
+
+TraceRing* RingForThisThread() {
+  if (t_ring == nullptr) {
+    auto ring = std::make_unique<TraceRing>();
+    std::lock_guard<std::mutex> lock(g_rings_mutex);
+    ring->tid = static_cast<uint32_t>(g_rings.size() + 1);
+    t_ring = ring.get();
+    g_rings.push_back(std::move(ring));
+  }
+  return t_ring;
+}
+
+struct DrainedEvent {
+  uint64_t startNs;
+  uint64_t durNs;
+  const char* name;
+  uint8_t category;
+};
+
+// Copies the undrained events of `ring` into `out`. Requires `g_rings_mutex`.
+void DrainRing(TraceRing& ring, std::vector<DrainedEvent>* out) {
+  const uint64_t head = ring.head.load(std::memory_order_acquire);
+  uint64_t from = ring.tail;
+  if (head - from > kTraceRingEvents) from = head - kTraceRingEvents;
+
+  uint64_t overwritten = 0;
+  for (uint64_t i = from; i < head; i++) {
+    const TraceEvent& e = ring.events[i & kRingMask];
+    const uint64_t before = e.seq.load(std::memory_order_acquire);
+    DrainedEvent copy{
+        e.startNs.load(std::memory_order_relaxed),
+        e.durNs.load(std::memory_order_relaxed),
+        e.name.load(std::memory_order_relaxed),
+        e.category.load(std::memory_order_relaxed)};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (before != i + 1 || e.seq.load(std::memory_order_relaxed) != i + 1) {
+      // Overwritten by a newer event while we were copying.
+      overwritten++;
+      continue;
+    }
+    out->push_back(copy);
+  }
+
+  g_dropped += from - ring.tail + overwritten;
+  ring.tail = head;
+}
+
+void AppendJsonString(std::string* out, const char* s) {
+  out->push_back('"');
+  for (; *s != '\0'; s++) {
+    const unsigned char c = static_cast<unsigned char>(*s);
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(static_cast<char>(c));
+    } else if (c < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out->append(buf);
+    } else {
+      out->push_back(static_cast<char>(c));
+    }
+  }
+  out->push_back('"');
+}
+
+// Chrome trace timestamps are microseconds; keep nanosecond resolution in the fraction.
+void AppendMicros(std::string* out, uint64_t ns) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%" PRIu64 ".%03u", ns / 1000, static_cast<unsigned>(ns % 1000));
+  out->append(buf);
+}
+
+std::string TakeTraceJson() {
+  std::string json = "{\"traceEvents\":[";
+  bool first = true;
+  auto separator = [&] {
+    if (!first) json.push_back(',');
+    first = false;
+  };
+
+  std::lock_guard<std::mutex> lock(g_rings_mutex);
+  std::vector<DrainedEvent> events;
+  for (const auto& ring : g_rings) {
+    events.clear();
+    DrainRing(*ring, &events);
+
+    const std::string tid = std::to_string(ring->tid);
+    separator();
+    json += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" + tid +
+        ",\"args\":{\"name\":\"tspice native thread " + tid + "\"}}";
+
+    for (const DrainedEvent& e : events) {
+      if (e.name == nullptr || e.category >= sizeof(kCategoryNames) / sizeof(kCategoryNames[0])) continue;
+      separator();
+      json += "{\"ph\":\"X\",\"name\":";
+      AppendJsonString(&json, e.name);
+      json += ",\"cat\":\"";
+      json += kCategoryNames[e.category];
+      json += "\",\"pid\":1,\"tid\":" + tid + ",\"ts\":";
+      AppendMicros(&json, e.startNs);
+      json += ",\"dur\":";
+      AppendMicros(&json, e.durNs);
+      json.push_back('}');
+    }
+  }
+
+  json += "],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" + std::to_string(g_dropped) + "}}";
+  g_dropped = 0;
+  return json;
+}
+
+}  // namespace
+
+const char* InternTraceName(const char* name) {
+  std::lock_guard<std::mutex> lock(g_names_mutex);
+  return g_names.emplace(name).first->c_str();
+}
+
+void RecordTraceSpan(TraceCategory category, const char* name, uint64_t startNs, uint64_t durNs) {
+  TraceRing* ring = RingForThisThread();
+  const uint64_t i = ring->head.load(std::memory_order_relaxed);
+  TraceEvent& e = ring->events[i & kRingMask];
+  e.seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  e.startNs.store(startNs, std::memory_order_relaxed);
+  e.durNs.store(durNs, std::memory_order_relaxed);
+  e.name.store(name, std::memory_order_relaxed);
+  e.category.store(static_cast<uint8_t>(category), std::memory_order_relaxed);
+  e.seq.store(i + 1, std::memory_order_release);
+  ring->head.store(i + 1, std::memory_order_release);
+}
+
+}  // namespace tspice_backend_node
+
+static Napi::Value TakeNativeTrace(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "takeNativeTrace() does not take any arguments"));
+    return env.Undefined();
+  }
+  if (!tspice_backend_node::NativeTraceEnabled()) return env.Null();
+  return Napi::String::New(env, tspice_backend_node::TakeTraceJson());
+}
+
+namespace tspice_backend_node {
+
+void RegisterNativeTrace(Napi::Env env, Napi::Object exports) {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    const char* flag = std::getenv("TSPICE_NATIVE_TRACE");
+    const bool enabled = flag != nullptr && flag[0] != '\0' && std::strcmp(flag, "0") != 0;
+    g_native_trace_enabled.store(enabled, std::memory_order_relaxed);
+  });
+
+  if (!SetExportChecked(env, exports, "takeNativeTrace", Napi::Function::New(env, TakeNativeTrace), __func__)) {
+    return;
+  }
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Opt-in timeline recorder, the per-event companion to `native_stats.h`.
+//
+// Enabled for the life of the process by setting `TSPICE_NATIVE_TRACE` (to anything but "" or
+// "0") before the addon is loaded. When enabled, the export trampolines from `InstrumentExports()`
+// record one span per call, and `CspiceLock` records one span for the wait on `g_cspice_mutex`
+// and one for the time it was held (the CSPICE section). Whatever part of a call's span is not
+// covered by its lock spans is argument/result marshalling.
+//
+// Each thread writes to its own fixed-size ring (kTraceRingEvents events; the oldest are
+// overwritten) without taking any lock; the rings are registered once per thread and kept for the
+// life of the process. `takeNativeTrace()` drains every ring into Chrome Trace Event JSON
+// (complete "X" events, one track per native thread), which chrome://tracing and the Perfetto UI
+// both load.
+
+constexpr uint64_t kTraceRingEvents = uint64_t{1} << 16;
+
+enum class TraceCategory : uint8_t {
+  kExport = 0,
+  kLockWait = 1,
+  kCspice = 2,
+};
+
+extern std::atomic<bool> g_native_trace_enabled;
+
+inline bool NativeTraceEnabled() {
+  return g_native_trace_enabled.load(std::memory_order_relaxed);
+}
+
+// Returns a copy of `name` that lives as long as the process (for span names that must outlive
+// the export that recorded them).
+const char* InternTraceName(const char* name);
+
+// Appends a finished span to the calling thread's ring. `name` must live as long as the process
+// (a literal or `InternTraceName()`); `startNs` is on the `std::chrono::steady_clock` timeline.
+void RecordTraceSpan(TraceCategory category, const char* name, uint64_t startNs, uint64_t durNs);
+
+// Reads `TSPICE_NATIVE_TRACE` (once per process) and registers `takeNativeTrace()`. Call before
+// any other domain registers its exports.
+void RegisterNativeTrace(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
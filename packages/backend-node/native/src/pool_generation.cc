@@ -0,0 +1,93 @@
+#include "pool_generation.h"
+
+#include <atomic>
+#include <string>
+
+#include "napi_helpers.h"
+
+using tspice_napi::SetExportChecked;
+using tspice_napi::ThrowSpiceError;
+
+namespace tspice_backend_node {
+
+namespace {
+
+std::atomic<uint64_t> g_total{0};
+std::atomic<uint64_t> g_kernels{0};
+std::atomic<uint64_t> g_variables{0};
+std::atomic<uint64_t> g_bodies{0};
+
+// JS numbers are exact up to 2^53; at one bump per nanosecond that is ~104 days of continuous
+// mutation, so no wraparound handling is needed in practice.
+Napi::Number ToJsNumber(Napi::Env env, const std::atomic<uint64_t>& counter) {
+  return Napi::Number::New(env, static_cast<double>(counter.load(std::memory_order_acquire)));
+}
+
+}  // namespace
+
+void BumpPoolGeneration(unsigned kinds) {
+  if ((kinds & kPoolChangeKernels) != 0) g_kernels.fetch_add(1, std::memory_order_relaxed);
+  if ((kinds & kPoolChangeVariables) != 0) g_variables.fetch_add(1, std::memory_order_relaxed);
+  if ((kinds & kPoolChangeBodies) != 0) g_bodies.fetch_add(1, std::memory_order_relaxed);
+  // Released last: a reader that sees the new total also sees the per-kind counters it covers.
+  g_total.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t PoolGeneration() {
+  return g_total.load(std::memory_order_acquire);
+}
+
+uint64_t PoolGeneration(PoolChangeKind kind) {
+  switch (kind) {
+    case kPoolChangeKernels:
+      return g_kernels.load(std::memory_order_acquire);
+    case kPoolChangeVariables:
+      return g_variables.load(std::memory_order_acquire);
+    case kPoolChangeBodies:
+      return g_bodies.load(std::memory_order_acquire);
+  }
+  return g_total.load(std::memory_order_acquire);
+}
+
+}  // namespace tspice_backend_node
+
+static Napi::Value KernelPoolGeneration(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() > 1 || (info.Length() == 1 && !info[0].IsUndefined() && !info[0].IsString())) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env,
+        "kernelPoolGeneration(kind?: \"kernels\" | \"variables\" | \"bodies\") expects at most one string"));
+    return env.Null();
+  }
+
+  if (info.Length() == 0 || info[0].IsUndefined()) {
+    return Napi::Number::New(env, static_cast<double>(tspice_backend_node::PoolGeneration()));
+  }
+
+  const std::string kind = info[0].As<Napi::String>().Utf8Value();
+  if (kind == "kernels") return tspice_backend_node::ToJsNumber(env, tspice_backend_node::g_kernels);
+  if (kind == "variables") return tspice_backend_node::ToJsNumber(env, tspice_backend_node::g_variables);
+  if (kind == "bodies") return tspice_backend_node::ToJsNumber(env, tspice_backend_node::g_bodies);
+
+  ThrowSpiceError(Napi::RangeError::New(
+      env,
+      std::string("kernelPoolGeneration(): unknown kind \"") + kind +
+          "\" (expected \"kernels\", \"variables\" or \"bodies\")"));
+  return env.Null();
+}
+
+namespace tspice_backend_node {
+
+void RegisterPoolGeneration(Napi::Env env, Napi::Object exports) {
+  if (!SetExportChecked(
+          env,
+          exports,
+          "kernelPoolGeneration",
+          Napi::Function::New(env, KernelPoolGeneration),
+          __func__)) {
+    return;
+  }
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Addon-level change counters for CSPICE's kernel/pool state.
+//
+// Every `furnsh` / `unload` / `kclear` entrypoint bumps `kKernels`, `p*pool` bumps `kVariables`
+// and `boddef` bumps `kBodies`; each bump also advances the total. The counters are plain atomics,
+// so `kernelPoolGeneration()` reads them without taking `g_cspice_mutex`, and JS-side caches can
+// compare generations instead of polling `cvpool`.
+//
+// Bumps happen while the mutating entrypoint still holds the mutex (after CSPICE has been
+// touched, even on failure), so any call that observes the new kernel/pool state also observes
+// the new generation.
+
+enum PoolChangeKind : unsigned {
+  kPoolChangeKernels = 1u << 0,
+  kPoolChangeVariables = 1u << 1,
+  kPoolChangeBodies = 1u << 2,
+};
+
+void BumpPoolGeneration(unsigned kinds);
+
+// Total number of bumps so far (0 until the first mutation).
+uint64_t PoolGeneration();
+
+// Bumps of one kind only (e.g. `kPoolChangeKernels` for state that pool writes cannot affect).
+uint64_t PoolGeneration(PoolChangeKind kind);
+
+void RegisterPoolGeneration(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,189 @@
+#include "query_cache.h"
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "napi_helpers.h"
+#include "pool_generation.h"
+
+using tspice_napi::SetExportChecked;
+using tspice_napi::ThrowSpiceError;
+
+namespace tspice_backend_node {
+
+namespace {
+
+constexpr size_t kShards = 16;
+
+// Keeps a typo from pinning gigabytes: `sxform` entries are ~350 bytes each.
+constexpr double kMaxCapacity = 1 << 22;
+
+struct Entry {
+  uint64_t generation = 0;
+  std::vector<double> values;
+  std::list<std::string>::iterator lru;
+};
+
+struct Shard {
+  std::mutex mutex;
+  std::unordered_map<std::string, Entry> entries;
+  // Most recently used at the front.
+  std::list<std::string> lru;
+};
+
+Shard g_shards[kShards];
+// Per-shard entry cap; 0 disables the cache.
+std::atomic<size_t> g_shard_capacity{0};
+// As requested by the caller (reported by `queryCacheStats()`).
+std::atomic<size_t> g_capacity{0};
+std::atomic<uint64_t> g_hits{0};
+std::atomic<uint64_t> g_misses{0};
+
+Shard& ShardFor(const std::string& key) {
+  return g_shards[std::hash<std::string>{}(key) % kShards];
+}
+
+void EraseLocked(Shard& shard, std::unordered_map<std::string, Entry>::iterator it) {
+  shard.lru.erase(it->second.lru);
+  shard.entries.erase(it);
+}
+
+void SetCapacity(size_t maxEntries) {
+  // Round up so a small non-zero capacity still leaves room in every shard.
+  const size_t perShard = maxEntries == 0 ? 0 : (maxEntries + kShards - 1) / kShards;
+  g_shard_capacity.store(perShard, std::memory_order_relaxed);
+  g_capacity.store(maxEntries, std::memory_order_relaxed);
+  for (Shard& shard : g_shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.entries.clear();
+    shard.lru.clear();
+  }
+  g_hits.store(0, std::memory_order_relaxed);
+  g_misses.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+bool QueryCacheEnabled() {
+  return g_shard_capacity.load(std::memory_order_relaxed) != 0;
+}
+
+bool QueryCacheLookup(const QueryKey& key, std::vector<double>* out) {
+  if (!QueryCacheEnabled()) return false;
+
+  const uint64_t generation = PoolGeneration();
+  Shard& shard = ShardFor(key.bytes());
+  std::lock_guard<std::mutex> guard(shard.mutex);
+
+  auto it = shard.entries.find(key.bytes());
+  if (it == shard.entries.end()) {
+    g_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  if (it->second.generation != generation) {
+    EraseLocked(shard, it);
+    g_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru);
+  *out = it->second.values;
+  g_hits.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void QueryCacheStore(const QueryKey& key, uint64_t generation, const double* values, size_t n) {
+  const size_t capacity = g_shard_capacity.load(std::memory_order_relaxed);
+  if (capacity == 0) return;
+
+  Shard& shard = ShardFor(key.bytes());
+  std::lock_guard<std::mutex> guard(shard.mutex);
+
+  auto it = shard.entries.find(key.bytes());
+  if (it != shard.entries.end()) {
+    it->second.generation = generation;
+    it->second.values.assign(values, values + n);
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru);
+    return;
+  }
+
+  while (shard.entries.size() >= capacity && !shard.lru.empty()) {
+    EraseLocked(shard, shard.entries.find(shard.lru.back()));
+  }
+
+  shard.lru.push_front(key.bytes());
+  Entry& entry = shard.entries[key.bytes()];
+  entry.generation = generation;
+  entry.values.assign(values, values + n);
+  entry.lru = shard.lru.begin();
+}
+
+}  // namespace tspice_backend_node
+
+static void SetQueryCacheCapacityJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1 || !info[0].IsNumber()) {
+    ThrowSpiceError(Napi::TypeError::New(
+        env, "setQueryCacheCapacity(maxEntries: number) expects exactly one number argument"));
+    return;
+  }
+
+  const double maxEntries = info[0].As<Napi::Number>().DoubleValue();
+  if (!(maxEntries >= 0) || maxEntries > tspice_backend_node::kMaxCapacity ||
+      std::floor(maxEntries) != maxEntries) {
+    ThrowSpiceError(Napi::RangeError::New(
+        env,
+        "setQueryCacheCapacity(maxEntries): expected an integer between 0 and " +
+            std::to_string((long long)tspice_backend_node::kMaxCapacity)));
+    return;
+  }
+
+  tspice_backend_node::SetCapacity((size_t)maxEntries);
+}
+
+static Napi::Object QueryCacheStatsJs(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 0) {
+    ThrowSpiceError(Napi::TypeError::New(env, "queryCacheStats() does not take any arguments"));
+    return Napi::Object::New(env);
+  }
+
+  size_t entries = 0;
+  for (tspice_backend_node::Shard& shard : tspice_backend_node::g_shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    entries += shard.entries.size();
+  }
+
+  const size_t capacity = tspice_backend_node::g_capacity.load(std::memory_order_relaxed);
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("capacity", Napi::Number::New(env, (double)capacity));
+  result.Set("entries", Napi::Number::New(env, (double)entries));
+  result.Set(
+      "hits",
+      Napi::Number::New(env, (double)tspice_backend_node::g_hits.load(std::memory_order_relaxed)));
+  result.Set(
+      "misses",
+      Napi::Number::New(env, (double)tspice_backend_node::g_misses.load(std::memory_order_relaxed)));
+  return result;
+}
+
+namespace tspice_backend_node {
+
+void RegisterQueryCache(Napi::Env env, Napi::Object exports) {
+  if (!SetExportChecked(
+          env, exports, "setQueryCacheCapacity", Napi::Function::New(env, SetQueryCacheCapacityJs), __func__)) {
+    return;
+  }
+  if (!SetExportChecked(env, exports, "queryCacheStats", Napi::Function::New(env, QueryCacheStatsJs), __func__)) {
+    return;
+  }
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <napi.h>
+
+namespace tspice_backend_node {
+
+// Optional, process-wide memo for pure queries (`spkezr`, `pxform`, `sxform`, `bodvar`,
+// `subpnt`).
+//
+// Off until `setQueryCacheCapacity(n)` is called with `n > 0`. Each entry is keyed on the query
+// kind plus the raw bytes of its numeric arguments and its strings (exactly as passed: "earth"
+// and "EARTH" are separate entries), and stamped with the kernel-pool generation it was computed
+// under. A lookup whose stamp no longer matches `PoolGeneration()` is dropped, so any `furnsh` /
+// `unload` / `kclear` / `p*pool` / `boddef` invalidates every entry without a sweep.
+//
+// Entries live in 16 shards, each behind its own mutex with its own LRU; lookups never take
+// `g_cspice_mutex`, so hits do not wait behind an ephemeris call on another thread. Only
+// successful results are stored (callers compute, then `Store()` while still holding the CSPICE
+// lock so the stamp matches what they read). Results are the ones CSPICE returned, so cached and
+// uncached calls agree bit for bit.
+
+enum class QueryKind : uint8_t {
+  kSpkezr = 1,
+  kPxform = 2,
+  kSxform = 3,
+  kBodvar = 4,
+  kSubpnt = 5,
+};
+
+// Packs a query into its cache key. Arguments must be appended in a fixed order per kind.
+class QueryKey {
+public:
+  explicit QueryKey(QueryKind kind) { bytes_.push_back(static_cast<char>(kind)); }
+
+  QueryKey& Add(double value) {
+    bytes_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    return *this;
+  }
+
+  QueryKey& Add(int value) {
+    bytes_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    return *this;
+  }
+
+  // Strings are length-prefixed so ("AB", "C") and ("A", "BC") differ.
+  QueryKey& Add(const std::string& value) {
+    const uint32_t n = static_cast<uint32_t>(value.size());
+    bytes_.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    bytes_.append(value);
+    return *this;
+  }
+
+  const std::string& bytes() const { return bytes_; }
+
+private:
+  std::string bytes_;
+};
+
+bool QueryCacheEnabled();
+
+// Copies the cached values into `out` and returns true on a hit for the current generation.
+bool QueryCacheLookup(const QueryKey& key, std::vector<double>* out);
+
+// Stores `values` under `key`, stamped with `generation` (read by the caller under the CSPICE
+// lock). No-op while the cache is disabled.
+void QueryCacheStore(const QueryKey& key, uint64_t generation, const double* values, size_t n);
+
+// Registers `setQueryCacheCapacity(maxEntries)` and `queryCacheStats()`.
+void RegisterQueryCache(Napi::Env env, Napi::Object exports);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,151 @@
+#include "sclk_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "pool_generation.h"
+#include "tspice_backend_shim.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// SCLK type 1 limits (`sclu01`).
+constexpr int kMaxFields = 10;
+constexpr int kTimeSystemTdb = 1;
+constexpr int kTimeSystemTdt = 2;
+
+std::unordered_map<int, std::shared_ptr<const SclkModel>> g_models;
+uint64_t g_generation = 0;
+
+void DropIfStale() {
+  const uint64_t generation = PoolGeneration();
+  if (generation != g_generation) {
+    g_models.clear();
+    g_generation = generation;
+  }
+}
+
+// Reads all of numeric variable `name`. False when it is missing, not numeric, or CSPICE fails
+// (the caller falls back to CSPICE, which reports the problem).
+bool ReadPoolDoubles(const std::string& name, std::vector<double>* out) {
+  int found = 0;
+  int n = 0;
+  char type[8];
+  if (tspice_dtpool(name.c_str(), &found, &n, type, (int)sizeof(type), nullptr, 0) != 0 || !found ||
+      n < 1 || std::strcmp(type, "N") != 0) {
+    return false;
+  }
+  out->assign((size_t)n, 0.0);
+  int got = 0;
+  return tspice_gdpool(name.c_str(), 0, n, &got, out->data(), &found, nullptr, 0) == 0 && found && got == n;
+}
+
+bool ReadPoolInt(const std::string& name, int* out, bool* outFound) {
+  int n = 0;
+  int found = 0;
+  if (tspice_gipool(name.c_str(), 0, 1, &n, out, &found, nullptr, 0) != 0) return false;
+  *outFound = found && n == 1;
+  return true;
+}
+
+std::shared_ptr<const SclkModel> LoadModel(int sc) {
+  const std::string id = std::to_string(-(long long)sc);
+
+  int type = 0;
+  bool found = false;
+  if (!ReadPoolInt("SCLK_DATA_TYPE_" + id, &type, &found) || !found || type != 1) return nullptr;
+
+  auto model = std::make_shared<SclkModel>();
+
+  int system = kTimeSystemTdb;
+  if (!ReadPoolInt("SCLK01_TIME_SYSTEM_" + id, &system, &found)) return nullptr;
+  if (found && system != kTimeSystemTdb && system != kTimeSystemTdt) return nullptr;
+  model->tdt = found && system == kTimeSystemTdt;
+
+  int nFields = 0;
+  if (!ReadPoolInt("SCLK01_N_FIELDS_" + id, &nFields, &found) || !found || nFields < 1 ||
+      nFields > kMaxFields) {
+    return nullptr;
+  }
+  std::vector<double> moduli;
+  if (!ReadPoolDoubles("SCLK01_MODULI_" + id, &moduli) || moduli.size() != (size_t)nFields) return nullptr;
+  for (int i = 1; i < nFields; i++) {
+    if (!(moduli[(size_t)i] >= 1.0)) return nullptr;
+    model->ticksPerCount *= moduli[(size_t)i];
+  }
+
+  std::vector<double> starts;
+  std::vector<double> ends;
+  if (!ReadPoolDoubles("SCLK_PARTITION_START_" + id, &starts) ||
+      !ReadPoolDoubles("SCLK_PARTITION_END_" + id, &ends) || starts.size() != ends.size()) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < starts.size(); i++) {
+    if (!(ends[i] >= starts[i])) return nullptr;
+    model->maxTicks += ends[i] - starts[i];
+  }
+
+  std::vector<double> coeffs;
+  if (!ReadPoolDoubles("SCLK01_COEFFICIENTS_" + id, &coeffs) || coeffs.size() % 3 != 0) return nullptr;
+  const size_t records = coeffs.size() / 3;
+  model->ticks.reserve(records);
+  model->partime.reserve(records);
+  model->rate.reserve(records);
+  for (size_t i = 0; i < records; i++) {
+    const double ticks = coeffs[3 * i];
+    const double partime = coeffs[3 * i + 1];
+    if (i > 0 && !(ticks > model->ticks.back() && partime >= model->partime.back())) return nullptr;
+    model->ticks.push_back(ticks);
+    model->partime.push_back(partime);
+    model->rate.push_back(coeffs[3 * i + 2]);
+  }
+  return model;
+}
+
+}  // namespace
+
+std::shared_ptr<const SclkModel> EnsureSclkModel(int sc) {
+  DropIfStale();
+  auto it = g_models.find(sc);
+  if (it == g_models.end()) {
+    it = g_models.emplace(sc, LoadModel(sc)).first;
+  }
+  return it->second;
+}
+
+bool SclkTicksToEt(const SclkModel& model, const LeapsecondTable* lsk, double ticks, double* outEt) {
+  if (!(ticks >= model.ticks.front() && ticks <= model.maxTicks)) return false;
+  if (model.tdt && lsk == nullptr) return false;
+
+  const size_t i = (size_t)(std::upper_bound(model.ticks.begin(), model.ticks.end(), ticks) - model.ticks.begin()) - 1;
+  const double partime = model.partime[i] + model.rate[i] * ((ticks - model.ticks[i]) / model.ticksPerCount);
+  if (!model.tdt) {
+    *outEt = partime;
+    return true;
+  }
+  return UnitimFromTable(*lsk, partime, "TDT", "TDB", outEt);
+}
+
+bool SclkEtToTicks(const SclkModel& model, const LeapsecondTable* lsk, double et, double* outTicks) {
+  if (!std::isfinite(et)) return false;
+  double partime = et;
+  if (model.tdt && (lsk == nullptr || !UnitimFromTable(*lsk, et, "TDB", "TDT", &partime))) return false;
+
+  auto it = std::upper_bound(model.partime.begin(), model.partime.end(), partime);
+  if (it == model.partime.begin()) return false;
+  const size_t i = (size_t)(it - model.partime.begin()) - 1;
+  if (!(model.rate[i] > 0.0)) return false;
+
+  const double ticks = model.ticks[i] + (partime - model.partime[i]) * (model.ticksPerCount / model.rate[i]);
+  // Past the next record (a rate discontinuity) or the clock's end: let CSPICE decide.
+  if (i + 1 < model.ticks.size() && ticks > model.ticks[i + 1]) return false;
+  if (ticks > model.maxTicks) return false;
+  *outTicks = ticks;
+  return true;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "leapseconds.h"
+
+namespace tspice_backend_node {
+
+// Addon-level model of a type 1 SCLK kernel, for native ticks <-> ET conversion.
+//
+// One model per spacecraft is read from the kernel pool (`SCLK01_*_<id>` / `SCLK_PARTITION_*_<id>`,
+// `<id>` being `-sc`) on first use and kept until the kernel-pool generation moves. With it, the
+// SCLK batch entrypoints convert encoded ticks to ET (and back) by interpolating the coefficient
+// table directly:
+//
+//   parallel time = PARTIM(i) + RATE(i) * (ticks - TICKS(i)) / (ticks per most significant count)
+//
+// followed by `unitim` TDT -> TDB when `SCLK01_TIME_SYSTEM` selects TDT. Anything the model does
+// not cover (other SCLK types, ticks before the table or past the last partition, epochs whose
+// inverse lands outside the record it came from, TDT clocks without a leap-second snapshot) returns
+// false so the caller can go through CSPICE.
+//
+// NOTE: `EnsureSclkModel()` requires `g_cspice_mutex` to be held by the caller. The conversion
+// functions only read the model they are given.
+
+struct SclkModel {
+  // `SCLK01_TIME_SYSTEM`: parallel time is TDT (2) rather than TDB (1, the default).
+  bool tdt = false;
+  // Product of the moduli of every field but the first.
+  double ticksPerCount = 1.0;
+  // Total ticks over all partitions (the largest valid encoded SCLK).
+  double maxTicks = 0.0;
+  // `SCLK01_COEFFICIENTS` triples, split into columns.
+  std::vector<double> ticks;
+  std::vector<double> partime;
+  std::vector<double> rate;
+};
+
+// Model for spacecraft `sc`, or null when its SCLK is not a well-formed type 1 kernel (callers
+// should then let CSPICE report whatever is wrong).
+std::shared_ptr<const SclkModel> EnsureSclkModel(int sc);
+
+// sct2e_c. `lsk` may be null; TDT clocks then return false.
+bool SclkTicksToEt(const SclkModel& model, const LeapsecondTable* lsk, double ticks, double* outEt);
+
+// sce2c_c. Same contract as above.
+bool SclkEtToTicks(const SclkModel& model, const LeapsecondTable* lsk, double et, double* outTicks);
+
+}  // namespace tspice_backend_node
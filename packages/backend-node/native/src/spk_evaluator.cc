@@ -0,0 +1,463 @@
+#include "spk_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "frame_cache.h"
+#include "id_cache.h"
+#include "pool_generation.h"
+#include "tspice_backend_shim.h"
+#include "vector_math.h"
+
+namespace tspice_backend_node {
+
+namespace {
+
+// Drop everything rather than track recency; a full table means the working set is not dense.
+constexpr size_t kMaxSegments = 1024;
+
+// spkgeo_c gives up on chains longer than this (CHLEN); real kernels need a handful of links.
+constexpr int kMaxChainLinks = 20;
+
+// Type 13 stores the window size; current toolkits write at most 14 states per window.
+constexpr int kMaxHermiteWindow = 32;
+
+constexpr int kSpkIdentMaxBytes = 41;
+
+// clight_c, km/s.
+constexpr double kClight = 299792.458;
+
+struct Segment {
+  int body = 0;
+  int center = 0;
+  int frame = 0;
+  int type = 0;
+  int baddr = 0;
+  int eaddr = 0;
+  bool supported = false;
+
+  // Types 2 and 3: fixed-length records after a 4-word directory at the end of the segment.
+  double init = 0.0;
+  double intlen = 0.0;
+  int rsize = 0;
+  int nrec = 0;
+
+  // Type 13: `n` states (6 words each), `n` epochs, then the window size and count.
+  int window = 0;
+  int n = 0;
+  std::vector<double> epochs;
+
+  // Most recently read record (types 2/3) or window start (type 13), and its words.
+  int cached = -1;
+  std::vector<double> record;
+};
+
+std::unordered_map<uint64_t, Segment> g_segments;
+uint64_t g_generation = 0;
+double g_record_hits = 0;
+double g_record_reads = 0;
+double g_fallbacks = 0;
+
+uint64_t SegmentKey(int handle, int baddr) {
+  return ((uint64_t)(uint32_t)handle << 32) | (uint32_t)baddr;
+}
+
+void DropIfStale() {
+  const uint64_t generation = PoolGeneration();
+  if (generation != g_generation) {
+    g_segments.clear();
+    g_generation = generation;
+  }
+}
+
+// Reads the segment directory. Unknown types and directories that do not look like one are
+// flagged unsupported and left to `spkgeo_c`, which reports them properly.
+int LoadSegment(int handle, const double* descr, Segment* seg, char* err, int errMaxBytes) {
+  double first = 0.0;
+  double last = 0.0;
+  if (tspice_spkuds(
+          descr,
+          &seg->body,
+          &seg->center,
+          &seg->frame,
+          &seg->type,
+          &first,
+          &last,
+          &seg->baddr,
+          &seg->eaddr,
+          err,
+          errMaxBytes) != 0) {
+    return 1;
+  }
+
+  if (seg->type == 2 || seg->type == 3) {
+    double dir[4];
+    if (seg->eaddr - seg->baddr < 3) return 0;
+    if (tspice_dafgda(handle, seg->eaddr - 3, seg->eaddr, dir, 4, err, errMaxBytes) != 0) return 1;
+    seg->init = dir[0];
+    seg->intlen = dir[1];
+    seg->rsize = (int)dir[2];
+    seg->nrec = (int)dir[3];
+    const int components = seg->type == 2 ? 3 : 6;
+    seg->supported = seg->intlen > 0.0 && seg->nrec >= 1 && seg->rsize > 2 &&
+        (seg->rsize - 2) % components == 0;
+  } else if (seg->type == 13) {
+    double dir[2];
+    if (seg->eaddr - seg->baddr < 1) return 0;
+    if (tspice_dafgda(handle, seg->eaddr - 1, seg->eaddr, dir, 2, err, errMaxBytes) != 0) return 1;
+    seg->window = (int)std::lround(dir[0]) + 1;
+    seg->n = (int)std::lround(dir[1]);
+    if (seg->window < 1 || seg->window > kMaxHermiteWindow || seg->n < seg->window) return 0;
+
+    seg->epochs.resize((size_t)seg->n);
+    const int begin = seg->baddr + 6 * seg->n;
+    if (tspice_dafgda(handle, begin, begin + seg->n - 1, seg->epochs.data(), seg->n, err, errMaxBytes) != 0) {
+      return 1;
+    }
+    seg->supported = true;
+  }
+  return 0;
+}
+
+int FindSegment(int handle, const double* descr, Segment** out, char* err, int errMaxBytes) {
+  // spkuds_c puts the initial address in the fifth integer; unpack just that to form the key.
+  int body = 0;
+  int center = 0;
+  int frame = 0;
+  int type = 0;
+  double first = 0.0;
+  double last = 0.0;
+  int baddr = 0;
+  int eaddr = 0;
+  if (tspice_spkuds(descr, &body, &center, &frame, &type, &first, &last, &baddr, &eaddr, err, errMaxBytes) !=
+      0) {
+    return 1;
+  }
+
+  const uint64_t key = SegmentKey(handle, baddr);
+  auto it = g_segments.find(key);
+  if (it != g_segments.end()) {
+    *out = &it->second;
+    return 0;
+  }
+
+  Segment seg;
+  if (LoadSegment(handle, descr, &seg, err, errMaxBytes) != 0) return 1;
+  if (g_segments.size() >= kMaxSegments) g_segments.clear();
+  *out = &g_segments.emplace(key, std::move(seg)).first->second;
+  return 0;
+}
+
+int ReadWords(int handle, Segment* seg, int index, int begin, int count, char* err, int errMaxBytes) {
+  if (seg->cached == index) {
+    g_record_hits++;
+    return 0;
+  }
+  seg->record.resize((size_t)count);
+  if (tspice_dafgda(handle, begin, begin + count - 1, seg->record.data(), count, err, errMaxBytes) != 0) {
+    seg->cached = -1;
+    return 1;
+  }
+  seg->cached = index;
+  g_record_reads++;
+  return 0;
+}
+
+// chbint_c: value and derivative of a Chebyshev expansion, expression for expression.
+void Chbint(const double* cp, int degp, const double* x2s, double x, double* p, double* dpdx) {
+  const double s = (x - x2s[0]) / x2s[1];
+  const double s2 = s * 2.0;
+  double w[3] = {0.0, 0.0, 0.0};
+  double dw[3] = {0.0, 0.0, 0.0};
+  for (int j = degp + 1; j > 1; j--) {
+    w[2] = w[1];
+    w[1] = w[0];
+    w[0] = cp[j - 1] + (s2 * w[1] - w[2]);
+    dw[2] = dw[1];
+    dw[1] = dw[0];
+    dw[0] = w[1] * 2.0 + dw[1] * s2 - dw[2];
+  }
+  *p = cp[0] + (s * w[0] - w[1]);
+  *dpdx = (w[0] + s * dw[0] - dw[1]) / x2s[1];
+}
+
+// chbval_c.
+double Chbval(const double* cp, int degp, const double* x2s, double x) {
+  const double s = (x - x2s[0]) / x2s[1];
+  const double s2 = s * 2.0;
+  double w[3] = {0.0, 0.0, 0.0};
+  for (int j = degp + 1; j > 1; j--) {
+    w[2] = w[1];
+    w[1] = w[0];
+    w[0] = cp[j - 1] + (s2 * w[1] - w[2]);
+  }
+  return s * w[0] - w[1] + cp[0];
+}
+
+// spkr02 / spkr03 record selection followed by spke02 / spke03.
+int EvaluateChebyshev(int handle, Segment* seg, double et, double* state, char* err, int errMaxBytes) {
+  int recno = (int)((et - seg->init) / seg->intlen);
+  recno = std::max(0, std::min(recno, seg->nrec - 1));
+  const int begin = seg->baddr + recno * seg->rsize;
+  if (ReadWords(handle, seg, recno, begin, seg->rsize, err, errMaxBytes) != 0) return 1;
+
+  // Each record is [mid, radius, coefficients...], one block of `ncof` per component.
+  const double* rec = seg->record.data();
+  if (seg->type == 2) {
+    const int ncof = (seg->rsize - 2) / 3;
+    for (int i = 0; i < 3; i++) {
+      Chbint(rec + 2 + ncof * i, ncof - 1, rec, et, &state[i], &state[i + 3]);
+    }
+  } else {
+    const int ncof = (seg->rsize - 2) / 6;
+    for (int i = 0; i < 6; i++) {
+      state[i] = Chbval(rec + 2 + ncof * i, ncof - 1, rec, et);
+    }
+  }
+  return 0;
+}
+
+// Hermite interpolation of values `f` and derivatives `df` at nodes `t` (hrmint_c), through the
+// Newton form over doubled nodes.
+void Hermite(int n, const double* t, const double* f, const double* df, double x, double* p, double* dp) {
+  const int m = 2 * n;
+  double z[2 * kMaxHermiteWindow];
+  double q[2 * kMaxHermiteWindow];
+  for (int i = 0; i < n; i++) {
+    z[2 * i] = t[i];
+    z[2 * i + 1] = t[i];
+    q[2 * i] = f[i];
+    q[2 * i + 1] = f[i];
+  }
+
+  // In-place divided differences; repeated nodes take the derivative at the first order.
+  for (int j = 1; j < m; j++) {
+    for (int i = m - 1; i >= j; i--) {
+      if (j == 1 && (i % 2) == 1) {
+        q[i] = df[i / 2];
+      } else {
+        q[i] = (q[i] - q[i - 1]) / (z[i] - z[i - j]);
+      }
+    }
+  }
+
+  double value = q[m - 1];
+  double deriv = 0.0;
+  for (int k = m - 2; k >= 0; k--) {
+    deriv = deriv * (x - z[k]) + value;
+    value = value * (x - z[k]) + q[k];
+  }
+  *p = value;
+  *dp = deriv;
+}
+
+// spkr13 window selection followed by spke13.
+int EvaluateHermite(int handle, Segment* seg, double et, double* state, char* err, int errMaxBytes) {
+  const std::vector<double>& epochs = seg->epochs;
+  const int w = seg->window;
+
+  int first = 0;
+  if (w % 2 == 0) {
+    // Half the window at or before `et`, half after.
+    const int lower = (int)(std::upper_bound(epochs.begin(), epochs.end(), et) - epochs.begin()) - 1;
+    first = lower - w / 2 + 1;
+  } else {
+    // Centered on the nearest epoch.
+    int near = (int)(std::lower_bound(epochs.begin(), epochs.end(), et) - epochs.begin());
+    if (near >= seg->n || (near > 0 && et - epochs[near - 1] <= epochs[near] - et)) near--;
+    first = near - (w - 1) / 2;
+  }
+  first = std::max(0, std::min(first, seg->n - w));
+
+  if (ReadWords(handle, seg, first, seg->baddr + 6 * first, 6 * w, err, errMaxBytes) != 0) return 1;
+
+  double f[kMaxHermiteWindow];
+  double df[kMaxHermiteWindow];
+  for (int i = 0; i < 3; i++) {
+    for (int k = 0; k < w; k++) {
+      f[k] = seg->record[(size_t)(6 * k + i)];
+      df[k] = seg->record[(size_t)(6 * k + i + 3)];
+    }
+    Hermite(w, epochs.data() + first, f, df, et, &state[i], &state[i + 3]);
+  }
+  return 0;
+}
+
+struct Link {
+  int body = 0;
+  int frame = 0;
+  double state[6] = {0.0};
+};
+
+// Chain of `body` relative to its segment centers, stopping at the first body with no segment.
+// `nodes` receives the bodies visited (one more than `links`). Returns false when the chain needs
+// `spkgeo_c` (unsupported segment type, too long, or any CSPICE failure).
+bool BuildChain(
+    int body,
+    double et,
+    std::vector<Link>* links,
+    std::vector<int>* nodes,
+    char* err,
+    int errMaxBytes) {
+  links->clear();
+  nodes->assign(1, body);
+
+  char ident[kSpkIdentMaxBytes];
+  while (body != 0) {
+    if ((int)links->size() >= kMaxChainLinks) return false;
+
+    int handle = 0;
+    double descr[5];
+    int found = 0;
+    if (tspice_spksfs(body, et, &handle, descr, ident, (int)sizeof(ident), &found, err, errMaxBytes) != 0) {
+      return false;
+    }
+    if (!found) break;
+
+    Segment* seg = nullptr;
+    if (FindSegment(handle, descr, &seg, err, errMaxBytes) != 0 || !seg->supported) return false;
+
+    Link link;
+    link.body = body;
+    link.frame = seg->frame;
+    const int code = seg->type == 13 ? EvaluateHermite(handle, seg, et, link.state, err, errMaxBytes)
+                                     : EvaluateChebyshev(handle, seg, et, link.state, err, errMaxBytes);
+    if (code != 0) return false;
+
+    links->push_back(link);
+    body = seg->center;
+    nodes->push_back(body);
+  }
+  return true;
+}
+
+void Accumulate(std::vector<Link>* sums, int frame, const double* state, double sign) {
+  for (Link& sum : *sums) {
+    if (sum.frame == frame) {
+      for (int k = 0; k < 6; k++) sum.state[k] += sign * state[k];
+      return;
+    }
+  }
+  Link sum;
+  sum.frame = frame;
+  for (int k = 0; k < 6; k++) sum.state[k] = sign * state[k];
+  sums->push_back(sum);
+}
+
+// Same as `BuildChain()`: false means "ask `spkgeo_c`".
+bool EvaluateOne(
+    int target,
+    double et,
+    const char* ref,
+    int refId,
+    int observer,
+    double* state,
+    double* lt,
+    char* err,
+    int errMaxBytes) {
+  static thread_local std::vector<Link> targetLinks;
+  static thread_local std::vector<Link> observerLinks;
+  static thread_local std::vector<int> targetNodes;
+  static thread_local std::vector<int> observerNodes;
+  static thread_local std::vector<Link> sums;
+
+  if (!BuildChain(target, et, &targetLinks, &targetNodes, err, errMaxBytes) ||
+      !BuildChain(observer, et, &observerLinks, &observerNodes, err, errMaxBytes)) {
+    return false;
+  }
+
+  // First body on the observer's chain that is also on the target's (the common ancestor).
+  size_t ti = 0;
+  size_t oi = 0;
+  bool common = false;
+  for (oi = 0; oi < observerNodes.size() && !common; oi++) {
+    auto it = std::find(targetNodes.begin(), targetNodes.end(), observerNodes[oi]);
+    if (it != targetNodes.end()) {
+      ti = (size_t)(it - targetNodes.begin());
+      common = true;
+    }
+  }
+  if (!common) return false;
+  oi--;
+
+  sums.clear();
+  for (size_t i = 0; i < ti; i++) Accumulate(&sums, targetLinks[i].frame, targetLinks[i].state, 1.0);
+  for (size_t i = 0; i < oi; i++) Accumulate(&sums, observerLinks[i].frame, observerLinks[i].state, -1.0);
+
+  for (int k = 0; k < 6; k++) state[k] = 0.0;
+  for (const Link& sum : sums) {
+    if (sum.frame == refId) {
+      for (int k = 0; k < 6; k++) state[k] += sum.state[k];
+      continue;
+    }
+
+    char frameName[TSPICE_FRNAME_MAX_BYTES];
+    bool found = false;
+    if (LookupFrameName(sum.frame, frameName, &found, err, errMaxBytes) != 0 || !found) return false;
+
+    double xform[36];
+    if (CachedSxform(frameName, ref, et, xform, err, errMaxBytes) != 0) return false;
+    for (int r = 0; r < 6; r++) {
+      double acc = 0.0;
+      for (int c = 0; c < 6; c++) acc += xform[r * 6 + c] * sum.state[c];
+      state[r] += acc;
+    }
+  }
+
+  *lt = vector_math::Vnorm(state) / kClight;
+  return true;
+}
+
+}  // namespace
+
+void InvalidateSpkEvaluator() {
+  g_segments.clear();
+}
+
+SpkEvaluatorStats GetSpkEvaluatorStats() {
+  DropIfStale();
+  SpkEvaluatorStats stats;
+  stats.segments = (uint32_t)g_segments.size();
+  stats.recordHits = g_record_hits;
+  stats.recordReads = g_record_reads;
+  stats.fallbacks = g_fallbacks;
+  return stats;
+}
+
+int EvaluateSpkGeoBatch(
+    int target,
+    const double* ets,
+    int n,
+    const char* ref,
+    int observer,
+    double* outStates,
+    double* outLts,
+    int* outFailedIndex,
+    char* err,
+    int errMaxBytes) {
+  *outFailedIndex = -1;
+  DropIfStale();
+
+  int refId = 0;
+  bool refFound = false;
+  if (InternFrameCode(ref, &refId, &refFound, err, errMaxBytes) != 0) return 1;
+
+  for (int i = 0; i < n; i++) {
+    double* state = outStates + 6 * (size_t)i;
+    if (refFound && EvaluateOne(target, ets[i], ref, refId, observer, state, &outLts[i], err, errMaxBytes)) {
+      continue;
+    }
+
+    // CSPICE reports its own error for anything the evaluator could not resolve.
+    g_fallbacks++;
+    if (tspice_spkgeo(target, ets[i], ref, observer, state, &outLts[i], err, errMaxBytes) != 0) {
+      *outFailedIndex = i;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tspice_backend_node {
+
+// Addon-level evaluator for Chebyshev (SPK types 2 and 3) and Hermite (type 13) segments.
+//
+// `spkgeoCached` / `spkgeoCachedBatch` walk the same chain of segments as `spkgeo_c` (`spksfs_c`
+// still picks the segment for every body, so file and segment priorities are unchanged), but keep
+// each segment's directory and its most recently used coefficient record (or Hermite window) in
+// memory and evaluate the polynomials here instead of re-reading the record through `spkpvn_c`.
+// Dense sampling inside one record costs one segment lookup and one recurrence per link.
+//
+// An epoch whose chain goes through any other segment type (or that CSPICE cannot resolve) is
+// handed to `spkgeo_c` unchanged, so results and error messages always match `spkgeo`.
+//
+// NOTE: all functions in this file require `g_cspice_mutex` to be held by the caller. Entries are
+// keyed by DAF handle, which CSPICE reuses after `unload`: the cache drops itself whenever the
+// kernel-pool generation moves, and the lazy kernel manager calls `InvalidateSpkEvaluator()` when
+// it closes a file.
+
+struct SpkEvaluatorStats {
+  uint32_t segments = 0;
+  double recordHits = 0;
+  double recordReads = 0;
+  double fallbacks = 0;
+};
+
+void InvalidateSpkEvaluator();
+
+SpkEvaluatorStats GetSpkEvaluatorStats();
+
+// Geometric states of `target` relative to `observer` in frame `ref` at each of `n` epochs:
+// `6*n` doubles into `outStates` and `n` one-way light times into `outLts`. Stops at the first
+// failure; returns 0, or 1 with `err` filled and `*outFailedIndex` set to the failing epoch (-1
+// when the failure is not tied to an epoch).
+int EvaluateSpkGeoBatch(
+    int target,
+    const double* ets,
+    int n,
+    const char* ref,
+    int observer,
+    double* outStates,
+    double* outLts,
+    int* outFailedIndex,
+    char* err,
+    int errMaxBytes);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,270 @@
+#include "text_kernel.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+namespace tspice_backend_node {
+
+namespace {
+
+bool IsBlank(char c) {
+  return c == ' ' || c == '\t';
+}
+
+std::string_view Trim(std::string_view s) {
+  size_t begin = 0;
+  size_t end = s.size();
+  while (begin < end && IsBlank(s[begin])) begin++;
+  while (end > begin && IsBlank(s[end - 1])) end--;
+  return s.substr(begin, end - begin);
+}
+
+// Fortran-style real or integer: digits, sign, point and an `E` / `D` exponent only (so no `inf`,
+// `nan` or hex, which `strtod` would take).
+bool ParseNumber(std::string_view token, double* out) {
+  std::string buf;
+  buf.reserve(token.size());
+  for (char c : token) {
+    if (c == 'd' || c == 'D') c = 'E';
+    if (!((c >= '0' && c <= '9') || c == '+' || c == '-' || c == '.' || c == 'e' || c == 'E')) {
+      return false;
+    }
+    buf.push_back(c);
+  }
+  if (buf.empty()) return false;
+  char* end = nullptr;
+  const double value = std::strtod(buf.c_str(), &end);
+  if (end != buf.c_str() + buf.size() || !std::isfinite(value)) return false;
+  *out = value;
+  return true;
+}
+
+class DataSectionParser {
+ public:
+  DataSectionParser(std::vector<TextKernelVariable>* out, std::string* error) : out_(out), error_(error) {}
+
+  bool inVector() const { return inVector_; }
+  size_t assignmentLine() const { return current_.line; }
+
+  bool Line(std::string_view line, size_t lineNo) {
+    lineNo_ = lineNo;
+    size_t pos = 0;
+    if (!inVector_) {
+      if (Trim(line).empty()) return true;
+
+      const size_t eq = line.find('=');
+      if (eq == std::string_view::npos) return Fail("expected an assignment (NAME = value or NAME += value)");
+      const bool append = eq > 0 && line[eq - 1] == '+';
+      const std::string_view name = Trim(line.substr(0, append ? eq - 1 : eq));
+      if (name.empty()) return Fail("missing variable name before '='");
+      for (char c : name) {
+        if (IsBlank(c)) return Fail("variable name '" + std::string(name) + "' contains blanks");
+      }
+      if (name.size() > kTextKernelMaxNameBytes) {
+        return Fail("variable name '" + std::string(name) + "' is longer than " +
+            std::to_string(kTextKernelMaxNameBytes) + " characters");
+      }
+
+      current_ = Assignment();
+      current_.variable.name = std::string(name);
+      current_.variable.append = append;
+      current_.line = lineNo;
+
+      pos = SkipBlanks(line, eq + 1);
+      if (pos == line.size()) return Fail("missing value for " + current_.variable.name);
+      if (line[pos] != '(') {
+        if (!Value(line, &pos)) return false;
+        if (!Trim(line.substr(pos)).empty()) {
+          return Fail("unexpected text after the value of " + current_.variable.name +
+              " (use parentheses for several values)");
+        }
+        return Commit();
+      }
+      inVector_ = true;
+      pos++;
+    }
+
+    while (true) {
+      while (pos < line.size() && (IsBlank(line[pos]) || line[pos] == ',')) pos++;
+      if (pos == line.size()) return true;  // the vector continues on the next line
+      if (line[pos] == ')') {
+        inVector_ = false;
+        if (!Trim(line.substr(pos + 1)).empty()) {
+          return Fail("unexpected text after ')' in the value of " + current_.variable.name);
+        }
+        if (current_.count == 0) return Fail("empty value list for " + current_.variable.name);
+        return Commit();
+      }
+      if (!Value(line, &pos)) return false;
+    }
+  }
+
+ private:
+  struct Assignment {
+    TextKernelVariable variable;
+    size_t line = 0;
+    size_t count = 0;
+  };
+
+  static size_t SkipBlanks(std::string_view line, size_t pos) {
+    while (pos < line.size() && IsBlank(line[pos])) pos++;
+    return pos;
+  }
+
+  bool Fail(const std::string& message) {
+    *error_ = "line " + std::to_string(lineNo_) + ": " + message;
+    return false;
+  }
+
+  bool SetType(bool isString) {
+    TextKernelVariable& v = current_.variable;
+    if (current_.count > 0 && v.isString != isString) {
+      return Fail("values of " + v.name + " mix strings and numbers");
+    }
+    v.isString = isString;
+    current_.count++;
+    return true;
+  }
+
+  bool Value(std::string_view line, size_t* pos) {
+    TextKernelVariable& v = current_.variable;
+    if (line[*pos] == '\'') {
+      std::string s;
+      size_t i = *pos + 1;
+      while (true) {
+        if (i >= line.size()) return Fail("unterminated string in the value of " + v.name);
+        if (line[i] == '\'') {
+          if (i + 1 < line.size() && line[i + 1] == '\'') {
+            s.push_back('\'');
+            i += 2;
+            continue;
+          }
+          i++;
+          break;
+        }
+        s.push_back(line[i++]);
+      }
+      if (s.size() > kTextKernelMaxStringBytes) {
+        return Fail("string value of " + v.name + " is longer than " +
+            std::to_string(kTextKernelMaxStringBytes) + " characters");
+      }
+      if (!SetType(true)) return false;
+      v.strings.push_back(std::move(s));
+      *pos = i;
+      return true;
+    }
+
+    size_t end = *pos;
+    while (end < line.size() && !IsBlank(line[end]) && line[end] != ',' && line[end] != '(' &&
+           line[end] != ')' && line[end] != '\'') {
+      end++;
+    }
+    const std::string_view token = line.substr(*pos, end - *pos);
+    if (token.empty()) return Fail("unexpected '" + std::string(1, line[*pos]) + "' in the value of " + v.name);
+    *pos = end;
+
+    if (token[0] == '@') {
+      if (token.size() == 1) return Fail("empty date in the value of " + v.name);
+      if (!SetType(false)) return false;
+      v.dates.push_back(TextKernelDate{v.numbers.size(), lineNo_, std::string(token.substr(1))});
+      v.numbers.push_back(0.0);
+      return true;
+    }
+
+    double number = 0.0;
+    if (!ParseNumber(token, &number)) {
+      return Fail("invalid value '" + std::string(token) + "' for " + v.name);
+    }
+    if (!SetType(false)) return false;
+    v.numbers.push_back(number);
+    return true;
+  }
+
+  bool Commit() {
+    TextKernelVariable& v = current_.variable;
+    auto it = index_.find(v.name);
+    if (it == index_.end()) {
+      index_.emplace(v.name, out_->size());
+      out_->push_back(std::move(v));
+      return true;
+    }
+
+    TextKernelVariable& existing = (*out_)[it->second];
+    if (!v.append) {
+      // A plain `=` replaces whatever came before, in the kernel and in the pool.
+      existing = std::move(v);
+      return true;
+    }
+    if (existing.isString != v.isString) {
+      return Fail("values appended to " + v.name + " do not match the type of its earlier values");
+    }
+    for (TextKernelDate& date : v.dates) {
+      date.index += existing.numbers.size();
+      existing.dates.push_back(std::move(date));
+    }
+    existing.numbers.insert(existing.numbers.end(), v.numbers.begin(), v.numbers.end());
+    for (std::string& s : v.strings) existing.strings.push_back(std::move(s));
+    return true;
+  }
+
+  std::vector<TextKernelVariable>* out_;
+  std::string* error_;
+  std::unordered_map<std::string, size_t> index_;
+  Assignment current_;
+  bool inVector_ = false;
+  size_t lineNo_ = 0;
+};
+
+}  // namespace
+
+bool ParseTextKernel(std::string_view text, std::vector<TextKernelVariable>* out, std::string* outError) {
+  out->clear();
+  if (std::memchr(text.data(), '\0', text.size()) != nullptr) {
+    *outError = "not a text kernel (contains NUL bytes)";
+    return false;
+  }
+
+  DataSectionParser parser(out, outError);
+  bool inData = false;
+  size_t lineNo = 0;
+  size_t begin = 0;
+  while (begin < text.size()) {
+    size_t end = text.find('\n', begin);
+    if (end == std::string_view::npos) end = text.size();
+    std::string_view line = text.substr(begin, end - begin);
+    begin = end + 1;
+    lineNo++;
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+    const std::string_view trimmed = Trim(line);
+    if (trimmed == "\\begindata" || trimmed == "\\begintext") {
+      if (parser.inVector()) {
+        *outError = "line " + std::to_string(lineNo) + ": " + std::string(trimmed) +
+            " inside the value list started on line " + std::to_string(parser.assignmentLine());
+        return false;
+      }
+      inData = trimmed == "\\begindata";
+      continue;
+    }
+    if (!inData) continue;
+
+    for (char c : line) {
+      const unsigned char u = static_cast<unsigned char>(c);
+      if ((u < 0x20 && c != '\t') || u >= 0x7f) {
+        *outError = "line " + std::to_string(lineNo) + ": non-printing or non-ASCII character in a data section";
+        return false;
+      }
+    }
+    if (!parser.Line(line, lineNo)) return false;
+  }
+
+  if (parser.inVector()) {
+    *outError = "line " + std::to_string(parser.assignmentLine()) + ": value list is never closed with ')'";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tspice_backend_node
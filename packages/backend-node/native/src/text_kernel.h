@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tspice_backend_node {
+
+// Native reader for the data sections of SPICE text kernels (FK, IK, PCK, LSK, SCLK), used by
+// `loadTextKernelFromBuffer()` to fill the kernel pool from memory without staging a file for
+// `furnsh`.
+//
+// Follows the kernel-pool assignment syntax: everything outside `\begindata` ... `\begintext` is
+// commentary; each assignment is `NAME = value`, `NAME = ( value, value ... )` (which may span
+// lines; commas are optional) or the same with `+=`, which appends to the variable's current
+// values. Values are numbers (Fortran exponents such as `1.5D3` included), quoted strings (`''`
+// inside one is a quote) or `@` dates, which are numeric. A variable's values must all be of one
+// type.
+//
+// Parsing touches no CSPICE state; `@` dates are kept as text so that the caller can convert them
+// with `tparse_c` under the CSPICE lock, as the kernel reader does.
+
+// Kernel-pool limits on names and string values.
+constexpr size_t kTextKernelMaxNameBytes = 32;
+constexpr size_t kTextKernelMaxStringBytes = 80;
+
+struct TextKernelDate {
+  // Index of the value in `TextKernelVariable::numbers` the date stands for.
+  size_t index = 0;
+  // One-based line of the date, for errors.
+  size_t line = 0;
+  // The date, without its `@`.
+  std::string text;
+};
+
+// Every assignment to one name in a kernel, merged in order: a later `=` replaces earlier values,
+// and a `+=` extends them.
+struct TextKernelVariable {
+  std::string name;
+  // The kernel never replaced the variable, so its values extend what the pool already holds.
+  bool append = false;
+  bool isString = false;
+  std::vector<double> numbers;
+  // Entries of `numbers` still to be filled from `@` dates.
+  std::vector<TextKernelDate> dates;
+  std::vector<std::string> strings;
+};
+
+// Parses `text` into `out`, one entry per variable in order of first assignment. Returns false with
+// `*outError` set (`line N: ...`) on malformed input.
+bool ParseTextKernel(std::string_view text, std::vector<TextKernelVariable>* out, std::string* outError);
+
+}  // namespace tspice_backend_node
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cmath>
+
+// Lock-free ports of the stateless CSPICE vector/matrix routines.
+//
+// These never touch CSPICE state (no error subsystem, no kernel pool), so the addon calls them
+// without taking `g_cspice_mutex`. Each one mirrors the corresponding `*_c` routine expression
+// for expression (same operation order, same scaling steps) so results are bit-identical to
+// CSPICE when built with the same compiler flags. Matrices are 3x3 row-major, matching the
+// layout CSPICE uses for `SpiceDouble[3][3]`.
+
+namespace tspice_backend_node {
+namespace vector_math {
+
+// SpiceZim.h `MaxAbs`.
+inline double MaxAbs(double a, double b) {
+  const double absA = std::fabs(a);
+  const double absB = std::fabs(b);
+  return absA < absB ? absB : absA;
+}
+
+// vdot_c
+inline double Vdot(const double* v1, const double* v2) {
+  return v1[0] * v2[0] + v1[1] * v2[1] + v1[2] * v2[2];
+}
+
+// vnorm_c: scale by the largest component first to avoid overflow.
+inline double Vnorm(const double* v1) {
+  const double v1max = MaxAbs(v1[0], MaxAbs(v1[1], v1[2]));
+  if (v1max == 0.0) {
+    return 0.0;
+  }
+  const double tmp0 = v1[0] / v1max;
+  const double tmp1 = v1[1] / v1max;
+  const double tmp2 = v1[2] / v1max;
+  const double normSqr = tmp0 * tmp0 + tmp1 * tmp1 + tmp2 * tmp2;
+  return v1max * std::sqrt(normSqr);
+}
+
+// vhat_c: the zero vector maps to the zero vector.
+inline void Vhat(const double* v1, double* vout) {
+  const double vmag = Vnorm(v1);
+  if (vmag > 0.0) {
+    vout[0] = v1[0] / vmag;
+    vout[1] = v1[1] / vmag;
+    vout[2] = v1[2] / vmag;
+  } else {
+    vout[0] = 0.0;
+    vout[1] = 0.0;
+    vout[2] = 0.0;
+  }
+}
+
+// vcrss_c
+inline void Vcrss(const double* v1, const double* v2, double* vout) {
+  const double vtemp0 = v1[1] * v2[2] - v1[2] * v2[1];
+  const double vtemp1 = v1[2] * v2[0] - v1[0] * v2[2];
+  const double vtemp2 = v1[0] * v2[1] - v1[1] * v2[0];
+  vout[0] = vtemp0;
+  vout[1] = vtemp1;
+  vout[2] = vtemp2;
+}
+
+// vadd_c
+inline void Vadd(const double* v1, const double* v2, double* vout) {
+  vout[0] = v1[0] + v2[0];
+  vout[1] = v1[1] + v2[1];
+  vout[2] = v1[2] + v2[2];
+}
+
+// vsub_c
+inline void Vsub(const double* v1, const double* v2, double* vout) {
+  vout[0] = v1[0] - v2[0];
+  vout[1] = v1[1] - v2[1];
+  vout[2] = v1[2] - v2[2];
+}
+
+// vminus_c
+inline void Vminus(const double* v1, double* vout) {
+  vout[0] = -v1[0];
+  vout[1] = -v1[1];
+  vout[2] = -v1[2];
+}
+
+// vscl_c
+inline void Vscl(double s, const double* v1, double* vout) {
+  vout[0] = s * v1[0];
+  vout[1] = s * v1[1];
+  vout[2] = s * v1[2];
+}
+
+// vlcom_c
+inline void Vlcom(double a, const double* v1, double b, const double* v2, double* sum) {
+  sum[0] = a * v1[0] + b * v2[0];
+  sum[1] = a * v1[1] + b * v2[1];
+  sum[2] = a * v1[2] + b * v2[2];
+}
+
+// mxv_c
+inline void Mxv(const double* m1, const double* vin, double* vout) {
+  double vtemp[3];
+  for (int i = 0; i < 3; i++) {
+    vtemp[i] = m1[i * 3 + 0] * vin[0] + m1[i * 3 + 1] * vin[1] + m1[i * 3 + 2] * vin[2];
+  }
+  vout[0] = vtemp[0];
+  vout[1] = vtemp[1];
+  vout[2] = vtemp[2];
+}
+
+// mtxv_c
+inline void Mtxv(const double* m1, const double* vin, double* vout) {
+  double vtemp[3];
+  for (int i = 0; i < 3; i++) {
+    vtemp[i] = m1[0 * 3 + i] * vin[0] + m1[1 * 3 + i] * vin[1] + m1[2 * 3 + i] * vin[2];
+  }
+  vout[0] = vtemp[0];
+  vout[1] = vtemp[1];
+  vout[2] = vtemp[2];
+}
+
+// mxm_c
+inline void Mxm(const double* m1, const double* m2, double* mout) {
+  double mtemp[9];
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      mtemp[i * 3 + j] =
+          m1[i * 3 + 0] * m2[0 * 3 + j] + m1[i * 3 + 1] * m2[1 * 3 + j] + m1[i * 3 + 2] * m2[2 * 3 + j];
+    }
+  }
+  for (int k = 0; k < 9; k++) {
+    mout[k] = mtemp[k];
+  }
+}
+
+// rotate_c / rotmat_c axis indexing: the rotation axis, then the other two in right-hand order.
+inline void RotationAxes(int iaxis, int* i1, int* i2, int* i3) {
+  static const int kIndexs[5] = {2, 0, 1, 2, 0};
+  const int temp = ((iaxis % 3) + 3) % 3;
+  *i1 = kIndexs[temp];
+  *i2 = kIndexs[temp + 1];
+  *i3 = kIndexs[temp + 2];
+}
+
+// rotate_c
+inline void Rotate(double angle, int iaxis, double* mout) {
+  const double s = std::sin(angle);
+  const double c = std::cos(angle);
+  int i1 = 0;
+  int i2 = 0;
+  int i3 = 0;
+  RotationAxes(iaxis, &i1, &i2, &i3);
+
+  mout[i1 * 3 + i1] = 1.0;
+  mout[i2 * 3 + i1] = 0.0;
+  mout[i3 * 3 + i1] = 0.0;
+  mout[i1 * 3 + i2] = 0.0;
+  mout[i2 * 3 + i2] = c;
+  mout[i3 * 3 + i2] = -s;
+  mout[i1 * 3 + i3] = 0.0;
+  mout[i2 * 3 + i3] = s;
+  mout[i3 * 3 + i3] = c;
+}
+
+// rotmat_c
+inline void Rotmat(const double* m1, double angle, int iaxis, double* mout) {
+  const double s = std::sin(angle);
+  const double c = std::cos(angle);
+  int i1 = 0;
+  int i2 = 0;
+  int i3 = 0;
+  RotationAxes(iaxis, &i1, &i2, &i3);
+
+  double prodm[9];
+  for (int j = 0; j < 3; j++) {
+    prodm[i1 * 3 + j] = m1[i1 * 3 + j];
+    prodm[i2 * 3 + j] = c * m1[i2 * 3 + j] + s * m1[i3 * 3 + j];
+    prodm[i3 * 3 + j] = -s * m1[i2 * 3 + j] + c * m1[i3 * 3 + j];
+  }
+  for (int k = 0; k < 9; k++) {
+    mout[k] = prodm[k];
+  }
+}
+
+// vproj_c: both inputs are rescaled by their largest component before the dot products.
+inline void Vproj(const double* a, const double* b, double* p) {
+  const double biga = MaxAbs(a[0], MaxAbs(a[1], a[2]));
+  const double bigb = MaxAbs(b[0], MaxAbs(b[1], b[2]));
+  if (biga == 0.0 || bigb == 0.0) {
+    p[0] = 0.0;
+    p[1] = 0.0;
+    p[2] = 0.0;
+    return;
+  }
+
+  const double r[3] = {b[0] / bigb, b[1] / bigb, b[2] / bigb};
+  const double t[3] = {a[0] / biga, a[1] / biga, a[2] / biga};
+  const double scale = Vdot(t, r) * biga / Vdot(r, r);
+  Vscl(scale, r, p);
+}
+
+// vrotv_c: a zero axis leaves `v` unchanged.
+inline void Vrotv(const double* v, const double* axis, double theta, double* r) {
+  if (axis[0] == 0.0 && axis[1] == 0.0 && axis[2] == 0.0) {
+    r[0] = v[0];
+    r[1] = v[1];
+    r[2] = v[2];
+    return;
+  }
+
+  double x[3];
+  double p[3];
+  double v1[3];
+  double v2[3];
+  double rplane[3];
+  Vhat(axis, x);
+  Vproj(v, x, p);
+  Vsub(v, p, v1);
+  Vcrss(x, v1, v2);
+  const double c = std::cos(theta);
+  const double s = std::sin(theta);
+  Vlcom(c, v1, s, v2, rplane);
+  Vadd(rplane, p, r);
+}
+
+// axisar_c: rotate each basis vector, then transpose so the images become columns.
+inline void Axisar(const double* axis, double angle, double* r) {
+  double rows[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  for (int i = 0; i < 3; i++) {
+    double vtemp[3];
+    Vrotv(&rows[i * 3], axis, angle, vtemp);
+    rows[i * 3 + 0] = vtemp[0];
+    rows[i * 3 + 1] = vtemp[1];
+    rows[i * 3 + 2] = vtemp[2];
+  }
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      r[i * 3 + j] = rows[j * 3 + i];
+    }
+  }
+}
+
+}  // namespace vector_math
+}  // namespace tspice_backend_node
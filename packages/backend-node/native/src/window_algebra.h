@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Lock-free set algebra on packed SPICE windows.
+//
+// A packed window is `[left0, right0, left1, right1, ...]` with `left_i <= right_i` and
+// `right_i < left_{i+1}` (the layout of a SPICE window's data segment). Each routine is a single
+// O(n + m) merge pass that follows the closed-interval semantics of the corresponding `wn*_c`
+// routine, and never touches CSPICE state, so callers only need `g_cspice_mutex` to read or
+// write window handles.
+
+namespace tspice_backend_node {
+namespace window_algebra {
+
+// Whether `w` (n doubles) is a valid packed window.
+inline bool IsValidWindow(const double* w, size_t n) {
+  if (n % 2 != 0) return false;
+  for (size_t i = 0; i < n; i += 2) {
+    if (!(w[i] <= w[i + 1])) return false;
+    if (i + 2 < n && !(w[i + 1] < w[i + 2])) return false;
+  }
+  return true;
+}
+
+// Appends `[left, right]`, merging it into the last interval when they overlap or touch. Inputs
+// must arrive in non-decreasing `left` order.
+inline void AppendMerged(std::vector<double>* out, double left, double right) {
+  if (!out->empty() && left <= out->back()) {
+    if (right > out->back()) out->back() = right;
+    return;
+  }
+  out->push_back(left);
+  out->push_back(right);
+}
+
+// wnunid_c
+inline void Union(const double* a, size_t na, const double* b, size_t nb, std::vector<double>* out) {
+  out->clear();
+  out->reserve(na + nb);
+  size_t i = 0;
+  size_t j = 0;
+  while (i < na || j < nb) {
+    if (j >= nb || (i < na && a[i] <= b[j])) {
+      AppendMerged(out, a[i], a[i + 1]);
+      i += 2;
+    } else {
+      AppendMerged(out, b[j], b[j + 1]);
+      j += 2;
+    }
+  }
+}
+
+// wnintd_c: touching intervals intersect in a singleton.
+inline void Intersect(const double* a, size_t na, const double* b, size_t nb, std::vector<double>* out) {
+  out->clear();
+  size_t i = 0;
+  size_t j = 0;
+  while (i < na && j < nb) {
+    const double left = a[i] > b[j] ? a[i] : b[j];
+    const double right = a[i + 1] < b[j + 1] ? a[i + 1] : b[j + 1];
+    if (left <= right) {
+      out->push_back(left);
+      out->push_back(right);
+    }
+    if (a[i + 1] < b[j + 1]) {
+      i += 2;
+    } else {
+      j += 2;
+    }
+  }
+}
+
+// wndifd_c: intervals are closed, so a cut keeps its endpoints ([1, 5] - [2, 3] = [1, 2], [3, 5]).
+// Removing a single point changes nothing.
+inline void Difference(const double* a, size_t na, const double* b, size_t nb, std::vector<double>* out) {
+  out->clear();
+  out->reserve(na + nb);
+  size_t j = 0;
+  for (size_t i = 0; i < na; i += 2) {
+    double left = a[i];
+    const double right = a[i + 1];
+
+    // Subtrahends that end before this interval also end before every later one.
+    while (j < nb && b[j + 1] < left) j += 2;
+
+    bool remaining = true;
+    for (size_t k = j; k < nb && b[k] <= right; k += 2) {
+      if (b[k] == b[k + 1]) continue;
+      if (b[k] > left) AppendMerged(out, left, b[k]);
+      if (b[k + 1] >= right) {
+        remaining = false;
+        break;
+      }
+      if (b[k + 1] > left) left = b[k + 1];
+    }
+    if (remaining) AppendMerged(out, left, right);
+  }
+}
+
+// wnexpd_c: widen each interval by `left` / `right` (negative values shrink it), drop intervals
+// that invert, then merge the ones that now overlap.
+inline void Expand(const double* w, size_t n, double left, double right, std::vector<double>* out) {
+  out->clear();
+  out->reserve(n);
+  for (size_t i = 0; i < n; i += 2) {
+    const double l = w[i] - left;
+    const double r = w[i + 1] + right;
+    if (l <= r) AppendMerged(out, l, r);
+  }
+}
+
+// wncond_c: wnexpd_c with the adjustments negated.
+inline void Contract(const double* w, size_t n, double left, double right, std::vector<double>* out) {
+  Expand(w, n, -left, -right, out);
+}
+
+// wnfltd_c: drop intervals whose measure is <= `small`.
+inline void Filter(const double* w, size_t n, double small, std::vector<double>* out) {
+  out->clear();
+  out->reserve(n);
+  for (size_t i = 0; i < n; i += 2) {
+    if (w[i + 1] - w[i] > small) {
+      out->push_back(w[i]);
+      out->push_back(w[i + 1]);
+    }
+  }
+}
+
+}  // namespace window_algebra
+}  // namespace tspice_backend_node
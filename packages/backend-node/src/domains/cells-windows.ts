@@ -13,9 +13,191 @@ import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
 
+/**
+ * Node-only bulk cell/window copies (not part of the backend contract).
+ *
+ * Each call copies a whole cell or window data segment under one lock, instead
+ * of one `cellGet*` / `wnfetd` / `insrt*` / `wninsd` call per element. Windows
+ * are packed as `[left0, right0, left1, right1, ...]`.
+ *
+ * `cellFromTypedArray` stores the values as given (no sorting or
+ * de-duplication); `size` defaults to `values.length`.
+ * `windowFromFloat64Array` accepts intervals in any order and merges
+ * overlapping ones like `wnvald`; `maxIntervals` defaults to
+ * `endpoints.length / 2`. Both return new handles the caller must free.
+ */
+export interface NodeCellsWindowsBulkApi {
+  cellToTypedArray(cell: SpiceIntCell): Int32Array;
+  cellToTypedArray(cell: SpiceDoubleCell): Float64Array;
+  cellFromTypedArray(values: Int32Array, size?: number): SpiceIntCell;
+  cellFromTypedArray(values: Float64Array, size?: number): SpiceDoubleCell;
+  windowToFloat64Array(window: SpiceWindow): Float64Array;
+  windowFromFloat64Array(endpoints: Float64Array, maxIntervals?: number): SpiceWindow;
+}
+
+/** A cell or window handle that is freed once its wrapper is garbage collected. */
+export interface ManagedSpiceHandle<H> {
+  readonly handle: H;
+  /** Free the cell or window now. Idempotent; `handle` must not be used afterwards. */
+  free(): void;
+}
+
+/**
+ * Node-only GC-backed release for cells and windows (not part of the backend contract).
+ *
+ * `manageCell` / `manageWindow` take ownership of a handle and return a wrapper that frees it
+ * (`freeCell` / `freeWindow`) when the wrapper is collected, for code where a missed or late
+ * free would otherwise leak native memory. The addon reports every cell's and window's storage
+ * to V8 (see `getNativeStats().memory`), so a heap full of unreferenced wrappers produces GC
+ * pressure that reclaims them. Keep the wrapper reachable for as long as its handle is in use,
+ * including across async calls, and do not free the raw handle yourself; a stale free is
+ * rejected by the handle table and ignored.
+ */
+export interface NodeCellsWindowsManagedApi {
+  manageCell<H extends SpiceIntCell | SpiceDoubleCell | SpiceCharCell>(cell: H): ManagedSpiceHandle<H>;
+  manageWindow(window: SpiceWindow): ManagedSpiceHandle<SpiceWindow>;
+}
+
+/** A window operand for {@link NodeCellsWindowsAlgebraApi}: a handle or a packed window. */
+export type WindowOperand = SpiceWindow | Float64Array;
+
+/**
+ * Node-only window set algebra (not part of the backend contract).
+ *
+ * Native `wnunid` / `wnintd` / `wndifd` / `wnexpd` / `wncond` / `wnfltd`
+ * equivalents, each a single O(n + m) merge over the operands. Operands are
+ * window handles or packed `[left, right, ...]` Float64Arrays, which must
+ * already be sorted and disjoint (a RangeError otherwise). The result is
+ * returned packed, or written into `out` when given; packed-only calls run
+ * without taking the CSPICE lock.
+ */
+export interface NodeCellsWindowsAlgebraApi {
+  wnunidPacked(a: WindowOperand, b: WindowOperand): Float64Array;
+  wnunidPacked(a: WindowOperand, b: WindowOperand, out: SpiceWindow): void;
+  wnintdPacked(a: WindowOperand, b: WindowOperand): Float64Array;
+  wnintdPacked(a: WindowOperand, b: WindowOperand, out: SpiceWindow): void;
+  wndifdPacked(a: WindowOperand, b: WindowOperand): Float64Array;
+  wndifdPacked(a: WindowOperand, b: WindowOperand, out: SpiceWindow): void;
+  wnexpdPacked(window: WindowOperand, left: number, right: number): Float64Array;
+  wnexpdPacked(window: WindowOperand, left: number, right: number, out: SpiceWindow): void;
+  wncondPacked(window: WindowOperand, left: number, right: number): Float64Array;
+  wncondPacked(window: WindowOperand, left: number, right: number, out: SpiceWindow): void;
+  wnfltdPacked(window: WindowOperand, small: number): Float64Array;
+  wnfltdPacked(window: WindowOperand, small: number, out: SpiceWindow): void;
+}
+
+function checkAlgebraResult(out: unknown, hasOut: boolean, label: string): Float64Array | undefined {
+  if (hasOut) {
+    invariant(out === undefined, `Expected ${label}() to return undefined when writing into out`);
+    return undefined;
+  }
+  invariant(
+    out instanceof Float64Array && out.length % 2 === 0,
+    `Expected ${label}() to return an even-length Float64Array`,
+  );
+  return out;
+}
+
 /** Create a {@link CellsWindowsApi} implementation backed by the native Node addon. */
-export function createCellsWindowsApi(native: NativeAddon): CellsWindowsApi {
+export function createCellsWindowsApi(
+  native: NativeAddon,
+): CellsWindowsApi & NodeCellsWindowsBulkApi & NodeCellsWindowsAlgebraApi & NodeCellsWindowsManagedApi {
+  const bulk: NodeCellsWindowsBulkApi = {
+    cellToTypedArray: ((cell: SpiceIntCell | SpiceDoubleCell) => {
+      const out = native.cellToTypedArray(cell);
+      invariant(
+        out instanceof Int32Array || out instanceof Float64Array,
+        "Expected cellToTypedArray() to return an Int32Array or Float64Array",
+      );
+      return out;
+    }) as NodeCellsWindowsBulkApi["cellToTypedArray"],
+    cellFromTypedArray: ((values: Int32Array | Float64Array, size?: number) => {
+      invariant(
+        values instanceof Int32Array || values instanceof Float64Array,
+        "cellFromTypedArray(values): expected an Int32Array or Float64Array",
+      );
+      if (size !== undefined) assertSpiceInt32NonNegative(size, "cellFromTypedArray(size)");
+      const handle = native.cellFromTypedArray(values, size);
+      invariant(typeof handle === "number", "Expected cellFromTypedArray() to return a number handle");
+      return handle as SpiceIntCell | SpiceDoubleCell;
+    }) as NodeCellsWindowsBulkApi["cellFromTypedArray"],
+    windowToFloat64Array: (window) => {
+      const out = native.windowToFloat64Array(window);
+      invariant(
+        out instanceof Float64Array && out.length % 2 === 0,
+        "Expected windowToFloat64Array() to return an even-length Float64Array",
+      );
+      return out;
+    },
+    windowFromFloat64Array: (endpoints, maxIntervals) => {
+      invariant(endpoints instanceof Float64Array, "windowFromFloat64Array(endpoints): expected a Float64Array");
+      if (maxIntervals !== undefined) {
+        assertSpiceInt32NonNegative(maxIntervals, "windowFromFloat64Array(maxIntervals)");
+      }
+      const handle = native.windowFromFloat64Array(endpoints, maxIntervals);
+      invariant(typeof handle === "number", "Expected windowFromFloat64Array() to return a number handle");
+      return handle as SpiceWindow;
+    },
+  };
+
+  const algebra = {
+    wnunidPacked: (a: WindowOperand, b: WindowOperand, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wnunidPacked(a, b, out), out !== undefined, "wnunidPacked"),
+    wnintdPacked: (a: WindowOperand, b: WindowOperand, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wnintdPacked(a, b, out), out !== undefined, "wnintdPacked"),
+    wndifdPacked: (a: WindowOperand, b: WindowOperand, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wndifdPacked(a, b, out), out !== undefined, "wndifdPacked"),
+    wnexpdPacked: (window: WindowOperand, left: number, right: number, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wnexpdPacked(window, left, right, out), out !== undefined, "wnexpdPacked"),
+    wncondPacked: (window: WindowOperand, left: number, right: number, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wncondPacked(window, left, right, out), out !== undefined, "wncondPacked"),
+    wnfltdPacked: (window: WindowOperand, small: number, out?: SpiceWindow) =>
+      checkAlgebraResult(native.wnfltdPacked(window, small, out), out !== undefined, "wnfltdPacked"),
+  } as NodeCellsWindowsAlgebraApi;
+
+  type Held = { handle: number; window: boolean };
+  const freeHeld = ({ handle, window }: Held) => {
+    if (window) {
+      native.freeWindow(handle as SpiceWindow);
+    } else {
+      native.freeCell(handle as SpiceIntCell);
+    }
+  };
+  const finalizers = new FinalizationRegistry<Held>((held) => {
+    try {
+      freeHeld(held);
+    } catch {
+      // Already freed through the raw handle; nothing left to release.
+    }
+  });
+
+  function manage<H>(handle: H, window: boolean, context: string): ManagedSpiceHandle<H> {
+    assertSpiceInt32NonNegative(handle as unknown as number, `${context}(handle)`);
+    const held: Held = { handle: handle as unknown as number, window };
+    let freed = false;
+    const managed: ManagedSpiceHandle<H> = {
+      handle,
+      free: () => {
+        if (freed) return;
+        freed = true;
+        finalizers.unregister(managed);
+        freeHeld(held);
+      },
+    };
+    finalizers.register(managed, held, managed);
+    return managed;
+  }
+
+  const managedApi: NodeCellsWindowsManagedApi = {
+    manageCell: (cell) => manage(cell, false, "manageCell"),
+    manageWindow: (window) => manage(window, true, "manageWindow"),
+  };
+
   return {
+    ...bulk,
+    ...algebra,
+    ...managedApi,
+
     newIntCell: (size) => {
       assertSpiceInt32NonNegative(size, "newIntCell(size)");
       const handle = native.newIntCell(size);
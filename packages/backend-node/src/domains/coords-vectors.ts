@@ -8,8 +8,65 @@ function isPlainObject(value: unknown): value is Record<string, unknown> {
   return value !== null && typeof value === "object" && !Array.isArray(value);
 }
 
+/**
+ * Node-only allocation-free vector/matrix helpers (not part of the backend contract).
+ *
+ * Inputs may be plain arrays or `Float64Array`s; the result is written into the
+ * caller-owned `out` array (3 elements for vectors, 9 for row-major matrices).
+ * `out` may alias an input.
+ */
+export interface NodeCoordsVectorsIntoApi {
+  vcrssInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  vaddInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  vsubInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  mxvInto(m: ArrayLike<number>, v: ArrayLike<number>, out: Float64Array): void;
+  mtxvInto(m: ArrayLike<number>, v: ArrayLike<number>, out: Float64Array): void;
+  mxmInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+}
+
+/**
+ * Node-only batched coordinate conversions (not part of the backend contract).
+ *
+ * `input` packs one 3-vector per row (length a multiple of 3). Rows are
+ * `(x, y, z)` for rectangular, `(radius, lon, lat)` for latitudinal,
+ * `(r, colat, lon)` for spherical and `(lon, lat, alt)` for geodetic
+ * coordinates (radians).
+ *
+ * Results are written into `out` when given (same length as `input`; may be
+ * `input` itself) or a new `Float64Array`, and returned. Each point is
+ * converted by the same CSPICE routine as the scalar helpers.
+ */
+export interface NodeCoordsVectorsBatchApi {
+  reclatBatch(rect: Float64Array, out?: Float64Array): Float64Array;
+  latrecBatch(lat: Float64Array, out?: Float64Array): Float64Array;
+  recsphBatch(rect: Float64Array, out?: Float64Array): Float64Array;
+  sphrecBatch(sph: Float64Array, out?: Float64Array): Float64Array;
+  georecBatch(geo: Float64Array, re: number, f: number, out?: Float64Array): Float64Array;
+  recgeoBatch(rect: Float64Array, re: number, f: number, out?: Float64Array): Float64Array;
+}
+
+function assertPacked3(input: unknown, out: unknown, context: string): asserts input is Float64Array {
+  invariant(
+    input instanceof Float64Array && input.length % 3 === 0,
+    `${context}: expected a Float64Array whose length is a multiple of 3`,
+  );
+  invariant(
+    out === undefined || (out instanceof Float64Array && out.length === input.length),
+    `${context}: expected out to be a Float64Array of length ${input.length}`,
+  );
+}
+
+function assertFloat64Out(out: unknown, length: number, context: string): asserts out is Float64Array {
+  invariant(
+    out instanceof Float64Array && out.length === length,
+    `${context}: expected a length-${length} Float64Array`,
+  );
+}
+
 /** Create a {@link CoordsVectorsApi} implementation backed by the native Node addon. */
-export function createCoordsVectorsApi(native: NativeAddon): CoordsVectorsApi {
+export function createCoordsVectorsApi(
+  native: NativeAddon,
+): CoordsVectorsApi & NodeCoordsVectorsIntoApi & NodeCoordsVectorsBatchApi {
   return {
     reclat: (rect) => {
       const out = native.reclat(rect);
@@ -149,5 +206,65 @@ export function createCoordsVectorsApi(native: NativeAddon): CoordsVectorsApi {
 
       return { lon, lat, alt };
     },
+
+    vcrssInto: (a, b, out) => {
+      assertFloat64Out(out, 3, "vcrssInto(out)");
+      native.vcrssInto(a, b, out);
+    },
+
+    vaddInto: (a, b, out) => {
+      assertFloat64Out(out, 3, "vaddInto(out)");
+      native.vaddInto(a, b, out);
+    },
+
+    vsubInto: (a, b, out) => {
+      assertFloat64Out(out, 3, "vsubInto(out)");
+      native.vsubInto(a, b, out);
+    },
+
+    mxvInto: (m, v, out) => {
+      assertFloat64Out(out, 3, "mxvInto(out)");
+      native.mxvInto(m, v, out);
+    },
+
+    mtxvInto: (m, v, out) => {
+      assertFloat64Out(out, 3, "mtxvInto(out)");
+      native.mtxvInto(m, v, out);
+    },
+
+    mxmInto: (a, b, out) => {
+      assertFloat64Out(out, 9, "mxmInto(out)");
+      native.mxmInto(a, b, out);
+    },
+
+    reclatBatch: (rect, out) => {
+      assertPacked3(rect, out, "reclatBatch()");
+      return native.reclatBatch(rect, out);
+    },
+
+    latrecBatch: (lat, out) => {
+      assertPacked3(lat, out, "latrecBatch()");
+      return native.latrecBatch(lat, out);
+    },
+
+    recsphBatch: (rect, out) => {
+      assertPacked3(rect, out, "recsphBatch()");
+      return native.recsphBatch(rect, out);
+    },
+
+    sphrecBatch: (sph, out) => {
+      assertPacked3(sph, out, "sphrecBatch()");
+      return native.sphrecBatch(sph, out);
+    },
+
+    georecBatch: (geo, re, f, out) => {
+      assertPacked3(geo, out, "georecBatch()");
+      return native.georecBatch(geo, re, f, out);
+    },
+
+    recgeoBatch: (rect, re, f, out) => {
+      assertPacked3(rect, out, "recgeoBatch()");
+      return native.recgeoBatch(rect, re, f, out);
+    },
   };
 }
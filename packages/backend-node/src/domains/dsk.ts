@@ -3,8 +3,10 @@ import type {
   DskApi,
   DskDescriptor,
   DskType2Bookkeeping,
+  Found,
   SpiceHandle,
   SpiceIntCell,
+  SpiceVector3,
 } from "@rybosome/tspice-backend-contract";
 import { invariant } from "@rybosome/tspice-core";
 
@@ -119,8 +121,59 @@ function normalizeDskType2Bookkeeping(value: unknown, context: string): DskType2
   return obj as unknown as DskType2Bookkeeping;
 }
 
+/** Result of {@link NodeDskPlateIndex.raycast}. */
+export type DskRaycastBatchResult = {
+  /** Packed 3-vector surface points (zeros for rays that miss). */
+  points: Float64Array;
+  /** One-based plate ID hit by each ray (0 for a miss). */
+  plates: Int32Array;
+  /** Hit bitmap: ray `i` hit iff bit `i % 8` of `found[i >> 3]` is set. */
+  found: Uint8Array;
+};
+
+/**
+ * A bounding volume hierarchy over the plates of one type 2 DSK segment,
+ * returned by {@link NodeDskIndexApi.dskPlateIndex}.
+ *
+ * The index holds its own copy of the mesh: it stays valid after the DSK is
+ * closed or unloaded, and must be released with `dispose()`.
+ */
+export interface NodeDskPlateIndex {
+  readonly nv: number;
+  readonly np: number;
+  /**
+   * Nearest intersection of each ray with the mesh, in the segment's frame.
+   * `vertices` and `raydirs` are packed 3-vectors; either one may hold a
+   * single vector shared by every ray (e.g. one sun direction for many
+   * shadow rays). `threads` defaults to the hardware concurrency.
+   */
+  raycast(vertices: Float64Array, raydirs: Float64Array, options?: { threads?: number }): DskRaycastBatchResult;
+  dispose(): void;
+}
+
+/**
+ * Node-only DSK plate index (not part of the backend contract).
+ *
+ * `dskPlateIndex` reads a segment's vertices and plates once and builds a
+ * native BVH. Ray casts against it never touch CSPICE, so they take no CSPICE
+ * lock and are spread across native threads; other CSPICE calls (including
+ * async GF searches) proceed meanwhile.
+ *
+ * `dskx02` is CSPICE's own single-ray intercept for the same segment (plate ID
+ * and point, in the segment's frame), the reference an index answers match.
+ */
+export interface NodeDskIndexApi {
+  dskPlateIndex(handle: SpiceHandle, dladsc: DlaDescriptor): NodeDskPlateIndex;
+  dskx02(
+    handle: SpiceHandle,
+    dladsc: DlaDescriptor,
+    vertex: SpiceVector3,
+    raydir: SpiceVector3,
+  ): Found<{ plid: number; xpt: SpiceVector3 }>;
+}
+
 /** Create a {@link DskApi} implementation backed by the native Node addon. */
-export function createDskApi(native: NativeAddon, handles: SpiceHandleRegistry): DskApi {
+export function createDskApi(native: NativeAddon, handles: SpiceHandleRegistry): DskApi & NodeDskIndexApi {
   return {
     dskobj: (dsk: string, bodids: SpiceIntCell) => {
       native.dskobj(dsk, bodids as unknown as number);
@@ -144,5 +197,45 @@ export function createDskApi(native: NativeAddon, handles: SpiceHandleRegistry):
         "dskb02()",
       );
     },
-  } satisfies DskApi;
+
+    dskx02: (handle: SpiceHandle, dladsc: DlaDescriptor, vertex: SpiceVector3, raydir: SpiceVector3) => {
+      assertDlaDescriptor(dladsc, "dskx02(dladsc)");
+      const entry = handles.lookup(handle, DAS_BACKED, "dskx02");
+      const out = native.dskx02(entry.nativeHandle, dladsc as unknown as Record<string, unknown>, vertex, raydir);
+      if (!out.found) {
+        return { found: false };
+      }
+      invariant(typeof out.plid === "number", "Expected dskx02().plid to be a number");
+      invariant(Array.isArray(out.xpt) && out.xpt.length === 3, "Expected dskx02().xpt to be a length-3 array");
+      return { found: true, plid: out.plid, xpt: out.xpt as SpiceVector3 };
+    },
+
+    dskPlateIndex: (handle: SpiceHandle, dladsc: DlaDescriptor) => {
+      assertDlaDescriptor(dladsc, "dskPlateIndex(dladsc)");
+      const entry = handles.lookup(handle, DAS_BACKED, "dskPlateIndex");
+      const built = native.dskBvhBuild(entry.nativeHandle, dladsc as unknown as Record<string, unknown>);
+
+      let disposed = false;
+      return {
+        nv: built.nv,
+        np: built.np,
+        raycast: (vertices: Float64Array, raydirs: Float64Array, options?: { threads?: number }) => {
+          invariant(!disposed, "dskPlateIndex().raycast(): index is disposed");
+          invariant(vertices instanceof Float64Array, "dskPlateIndex().raycast(vertices): expected a Float64Array");
+          invariant(raydirs instanceof Float64Array, "dskPlateIndex().raycast(raydirs): expected a Float64Array");
+          const threads = options?.threads ?? 0;
+          invariant(
+            Number.isInteger(threads) && threads >= 0,
+            "dskPlateIndex().raycast(options.threads): expected a non-negative integer",
+          );
+          return native.dskBvhRaycast(built.id, vertices, raydirs, threads);
+        },
+        dispose: () => {
+          if (disposed) return;
+          disposed = true;
+          native.dskBvhFree(built.id);
+        },
+      };
+    },
+  } satisfies DskApi & NodeDskIndexApi;
 }
@@ -27,20 +27,159 @@ type NativeEkDeps = Pick<
   | "ekgc"
   | "ekgd"
   | "ekgi"
+  | "ekQueryColumnar"
+  | "ekCursorOpen"
+  | "ekCursorNext"
+  | "ekCursorReadAsync"
+  | "ekCursorTake"
+  | "ekCursorClose"
   | "ekifld"
   | "ekacli"
   | "ekacld"
   | "ekaclc"
   | "ekffld"
+  | "ekWriteSegment"
 >;
 
 type KernelStagerEkDeps = Pick<KernelStager, "resolvePath">;
 
+/**
+ * One selected column of an {@link NodeEkColumnarApi.ekQueryColumnar} result.
+ *
+ * Bit `r` of `nulls` (LSB-first, `nulls[r >> 3] & (1 << (r & 7))`) is set when
+ * row `r` is null. Every row occupies at least one element slot (null rows hold
+ * a single `0` / empty string), so for scalar columns element `r` is row `r`.
+ * `rowOffsets` is only present when some row has more than one element: row
+ * `r` is then elements `[rowOffsets[r], rowOffsets[r + 1])`.
+ */
+export type EkColumnarColumn = {
+  table: string;
+  name: string;
+  nulls: Uint8Array;
+  rowOffsets?: Int32Array;
+} & (
+  | { type: "INT"; values: Int32Array }
+  | { type: "DP" | "TIME"; values: Float64Array }
+  /** Element `i` is the UTF-8 text `bytes.subarray(offsets[i], offsets[i + 1])`. */
+  | { type: "CHR"; offsets: Int32Array; bytes: Uint8Array }
+);
+
+export type EkQueryColumnarResult =
+  | { ok: true; nmrows: number; columns: EkColumnarColumn[] }
+  | { ok: false; errmsg: string };
+
+/** Name, table and data type of one column selected by an {@link NodeEkCursor}. */
+export type EkCursorColumnInfo = {
+  table: string;
+  name: string;
+  type: EkColumnarColumn["type"];
+};
+
+/**
+ * One column of an {@link EkCursorBatch}: the {@link EkColumnarColumn} layout
+ * over the batch's rows (row `r` of the batch is row `rowStart + r` of the
+ * query).
+ */
+export type EkCursorBatchColumn = {
+  nulls: Uint8Array;
+  rowOffsets?: Int32Array;
+} & ({ values: Int32Array | Float64Array } | { offsets: Int32Array; bytes: Uint8Array });
+
+export type EkCursorBatch = {
+  rowStart: number;
+  rows: number;
+  columns: EkCursorBatchColumn[];
+};
+
+export type EkCursorOpenResult =
+  | { ok: true; cursor: number; nmrows: number; columns: EkCursorColumnInfo[] }
+  | { ok: false; errmsg: string };
+
+/** Options for {@link NodeEkColumnarApi.ekQueryCursor}. */
+export type EkQueryCursorOptions = {
+  /** Rows per batch. Defaults to 4096. */
+  batchRows?: number;
+};
+
+/**
+ * A streaming EK query returned by {@link NodeEkColumnarApi.ekQueryCursor}.
+ *
+ * Each batch reuses the typed arrays of the one before it whenever they are
+ * large enough, so a batch is only valid until the next `next()` /
+ * `nextAsync()` call (copy anything that must outlive it). Iterating with
+ * `for...of` / `for await...of` closes the cursor when the loop ends; otherwise
+ * call `close()`. Loading or unloading kernels while a cursor is open makes its
+ * next read throw.
+ */
+export interface NodeEkCursor extends Iterable<EkCursorBatch>, AsyncIterable<EkCursorBatch> {
+  readonly nmrows: number;
+  readonly columns: readonly EkCursorColumnInfo[];
+  /** The next batch, or `null` once every row has been read. */
+  next(): EkCursorBatch | null;
+  /**
+   * Same as `next()`, but reads the rows off the JS thread (through the CSPICE
+   * executor when enabled). One read per cursor may be in flight at a time.
+   */
+  nextAsync(): Promise<EkCursorBatch | null>;
+  close(): void;
+}
+
+/**
+ * Node-only columnar EK queries (not part of the backend contract).
+ *
+ * `ekQueryColumnar(query)` runs `ekfind` and reads every selected column in a
+ * single native call, instead of one `ekgc` / `ekgd` / `ekgi` call per
+ * element. Query parse errors are returned as `{ ok: false, errmsg }`, like
+ * `ekfind`. Character values have trailing whitespace trimmed, as with `ekgc`.
+ *
+ * `ekWriteSegment` is the inverse: it writes a segment from typed-array
+ * columns in the same layout.
+ */
+/** Name and `ekifld`-style declaration (e.g. `"DATATYPE = INTEGER, INDEXED = TRUE"`) of one column. */
+export type EkSegmentColumnSchema = { name: string; decl: string };
+
+/**
+ * Data for one column of an {@link NodeEkColumnarApi.ekWriteSegment} call,
+ * in the same layout {@link EkColumnarColumn} uses (so a query result can be
+ * written back as-is).
+ *
+ * Without `rowOffsets` each row is one element. With it, row `r` is elements
+ * `[rowOffsets[r], rowOffsets[r + 1])`; null rows may span zero elements.
+ */
+export type EkSegmentColumn = {
+  nulls?: Uint8Array;
+  rowOffsets?: Int32Array;
+} & ({ values: Int32Array | Float64Array } | { offsets: Int32Array; bytes: Uint8Array });
+
+export interface NodeEkColumnarApi {
+  ekQueryColumnar(query: string): EkQueryColumnarResult;
+  /**
+   * Run `query` and read its rows `batchRows` at a time, in the
+   * `ekQueryColumnar` layout, instead of materializing every row at once.
+   * Memory stays bounded by one batch however many rows match.
+   */
+  ekQueryCursor(
+    query: string,
+    options?: EkQueryCursorOptions,
+  ): { ok: true; cursor: NodeEkCursor } | { ok: false; errmsg: string };
+  /**
+   * Write a whole segment (`ekifld` → one `ekacli` / `ekacld` / `ekaclc` per
+   * column → `ekffld`) in a single native call and return its segment number.
+   * Numeric columns are read straight from their typed arrays.
+   */
+  ekWriteSegment(
+    handle: SpiceHandle,
+    table: string,
+    schema: readonly EkSegmentColumnSchema[],
+    columns: readonly EkSegmentColumn[],
+  ): number;
+}
+
 /** Create an {@link EkApi} implementation backed by the native Node addon. */
 export function createEkApi<
   N extends NativeEkDeps,
   S extends KernelStagerEkDeps | undefined,
->(native: N, handles: SpiceHandleRegistry, stager?: S): EkApi {
+>(native: N, handles: SpiceHandleRegistry, stager?: S): EkApi & NodeEkColumnarApi {
   const registerEkHandle = (nativeHandle: number, context: string): SpiceHandle => {
     invariant(typeof nativeHandle === "number", `Expected native backend ${context} to return a number handle`);
     assertSpiceInt32(nativeHandle, `native backend ${context} handle`);
@@ -128,6 +267,77 @@ export function createEkApi<
       return native.ekgi(selidx, row, elment);
     },
 
+    ekQueryColumnar: (query: string) => native.ekQueryColumnar(query),
+
+    ekQueryCursor: (query: string, options?: EkQueryCursorOptions) => {
+      const batchRows = options?.batchRows ?? 4096;
+      assertSpiceInt32(batchRows, "ekQueryCursor(batchRows)", { min: 1 });
+      const opened = native.ekCursorOpen(query, batchRows);
+      if (!opened.ok) return opened;
+
+      const id = opened.cursor;
+      let open = true;
+      let reading = false;
+      let prev: EkCursorBatch | undefined;
+
+      const settle = (batch: EkCursorBatch | null) => {
+        if (batch === null) {
+          cursor.close();
+          return null;
+        }
+        prev = batch;
+        return batch;
+      };
+
+      const cursor: NodeEkCursor = {
+        nmrows: opened.nmrows,
+        columns: opened.columns,
+        next: () => {
+          if (!open) return null;
+          invariant(!reading, "ekQueryCursor().next(): a nextAsync() read is still in flight");
+          return settle(native.ekCursorNext(id, prev));
+        },
+        nextAsync: async () => {
+          if (!open) return null;
+          invariant(!reading, "ekQueryCursor().nextAsync(): a read is already in flight");
+          reading = true;
+          try {
+            await native.ekCursorReadAsync(id);
+          } finally {
+            reading = false;
+          }
+          // Closed while the read was in flight.
+          if (!open) return null;
+          return settle(native.ekCursorTake(id, prev));
+        },
+        close: () => {
+          if (!open) return;
+          open = false;
+          prev = undefined;
+          native.ekCursorClose(id);
+        },
+        [Symbol.iterator]: function* () {
+          try {
+            for (let batch = cursor.next(); batch !== null; batch = cursor.next()) {
+              yield batch;
+            }
+          } finally {
+            cursor.close();
+          }
+        },
+        [Symbol.asyncIterator]: async function* () {
+          try {
+            for (let batch = await cursor.nextAsync(); batch !== null; batch = await cursor.nextAsync()) {
+              yield batch;
+            }
+          } finally {
+            cursor.close();
+          }
+        },
+      };
+      return { ok: true as const, cursor };
+    },
+
     ekifld: (
       handle: SpiceHandle,
       tabnam: string,
@@ -206,7 +416,32 @@ export function createEkApi<
       assertSpiceInt32NonNegative(segno, "ekffld(segno)");
       native.ekffld(handles.lookup(handle, EK_ONLY, "ekffld").nativeHandle, segno, rcptrs);
     },
-  } satisfies EkApi;
+
+    ekWriteSegment: (
+      handle: SpiceHandle,
+      table: string,
+      schema: readonly EkSegmentColumnSchema[],
+      columns: readonly EkSegmentColumn[],
+    ) => {
+      invariant(Array.isArray(schema), "ekWriteSegment(schema): expected an array");
+      invariant(
+        Array.isArray(columns) && columns.length === schema.length,
+        "ekWriteSegment(columns): expected one entry per schema column",
+      );
+      const segno = native.ekWriteSegment(
+        handles.lookup(handle, EK_ONLY, "ekWriteSegment").nativeHandle,
+        table,
+        schema.map((c) => c.name),
+        schema.map((c) => c.decl),
+        columns,
+      );
+      invariant(
+        typeof segno === "number" && Number.isInteger(segno) && segno >= 0,
+        "Expected native backend ekWriteSegment() to return a non-negative segment number",
+      );
+      return segno;
+    },
+  } satisfies EkApi & NodeEkColumnarApi;
 
   return api;
 }
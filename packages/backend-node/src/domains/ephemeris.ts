@@ -1,5 +1,7 @@
 import type {
+  AbCorr,
   EphemerisApi,
+  Found,
   SpiceIntCell,
   SpiceStateVector,
   SpiceVector3,
@@ -14,10 +16,13 @@ import type {
 import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { withCallOptionsSync, type NodeCallOptions } from "../runtime/cancellation.js";
 import type { KernelStager } from "../runtime/kernel-staging.js";
 import type { SpiceHandleRegistry } from "../runtime/spice-handles.js";
 import type { VirtualOutputStager } from "../runtime/virtual-output-staging.js";
 
+import { toSpiceCallStatus, type SpiceCallStatus } from "./error.js";
+
 const I32_MAX = 2147483647;
 
 function assertSpkPackedDescriptor(out: unknown, label: string): asserts out is SpkPackedDescriptor {
@@ -47,13 +52,306 @@ function resolveSpkPath(outputs: VirtualOutputStager, file: string | VirtualOutp
   return outputs.resolvePathForSpice(file);
 }
 
+/** Packed result of {@link NodeEphemerisBatchApi.spkezrBatch}. */
+export type SpkezrBatchResult = {
+  /** `6*n` doubles: one `[x, y, z, vx, vy, vz]` state per input epoch. */
+  states: Float64Array;
+  /** `n` one-way light times, one per input epoch. */
+  lts: Float64Array;
+};
+
+/** Packed result of {@link NodeEphemerisBatchApi.spkposBatch}. */
+export type SpkposBatchResult = {
+  /** `3*n` doubles: one `[x, y, z]` position per input epoch. */
+  positions: Float64Array;
+  /** `n` one-way light times, one per input epoch. */
+  lts: Float64Array;
+};
+
+/**
+ * Node-only batched ephemeris evaluation (not part of the backend contract).
+ *
+ * Each call evaluates one target/observer pair at every epoch in `ets`, paying
+ * argument marshalling and CSPICE locking once per batch instead of once per
+ * epoch. Throws on the first CSPICE failure, or once `options.timeoutMs` has
+ * passed (checked between epochs; see {@link NodeCallOptions}).
+ */
+export interface NodeEphemerisBatchApi {
+  spkezrBatch(
+    target: string,
+    ets: Float64Array,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    options?: NodeCallOptions,
+  ): SpkezrBatchResult;
+
+  spkposBatch(
+    target: string,
+    ets: Float64Array,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    options?: NodeCallOptions,
+  ): SpkposBatchResult;
+}
+
+/**
+ * Node-only allocation-free ephemeris evaluation (not part of the backend contract).
+ *
+ * The state/position is written into the caller-owned `out` array (exact
+ * length; pass a `subarray()` view to target an offset in a larger buffer) and
+ * the one-way light time is returned.
+ */
+export interface NodeEphemerisIntoApi {
+  spkezrInto(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    out: Float64Array,
+  ): number;
+
+  spkposInto(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    out: Float64Array,
+  ): number;
+
+  /**
+   * Non-throwing `spkezrInto`: `out` has 7 elements (state, then light time)
+   * and a CSPICE failure is returned as a status without building an error
+   * message. Use `lastSpiceError()` for the details. Invalid arguments still
+   * throw.
+   */
+  spkezrIntoStatus(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    out: Float64Array,
+  ): SpiceCallStatus;
+
+  /** Non-throwing `spkposInto`; `out` has 4 elements (position, then light time). */
+  spkposIntoStatus(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    out: Float64Array,
+  ): SpiceCallStatus;
+}
+
+/**
+ * Node-only speculative ephemeris lookups (not part of the backend contract).
+ *
+ * `trySpkezr` is `spkezr` for callers probing whether data exists: when the
+ * loaded SPKs have no data for the target/observer at `et` it returns
+ * `{ found: false }` instead of throwing. Most misses are ruled out by the
+ * native coverage index without calling CSPICE; other failures still throw.
+ */
+export interface NodeEphemerisTryApi {
+  trySpkezr(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+  ): Found<SpkezrResult>;
+}
+
+/**
+ * Node-only frame-ID ephemeris calls (not part of the backend contract).
+ *
+ * Same as `spkez` / `spkgeo`, but the reference frame is an ID from
+ * `internFrame()` / `namfrm()`.
+ */
+export interface NodeEphemerisIdApi {
+  spkezId(target: number, et: number, refId: number, abcorr: AbCorr | string, observer: number): SpkezrResult;
+  spkgeoId(target: number, et: number, refId: number, observer: number): SpkezrResult;
+}
+
+/** Counters reported by {@link NodeEphemerisCachedApi.spkEvaluatorStats}. */
+export type SpkEvaluatorStats = {
+  /** Segment directories currently held by the evaluator. */
+  segments: number;
+  /** Link evaluations served from an already-read coefficient record / Hermite window. */
+  recordHits: number;
+  /** Coefficient records / Hermite windows read from a DAF. */
+  recordReads: number;
+  /** Epochs handed to `spkgeo` unchanged (unsupported segment types, errors). */
+  fallbacks: number;
+};
+
+/**
+ * Node-only cached geometric ephemeris (not part of the backend contract).
+ *
+ * Same answers as `spkgeo` (to round-off), but Chebyshev (SPK types 2 and 3) and Hermite
+ * (type 13) segments are evaluated natively from an in-memory copy of the segment directory and
+ * the most recently used coefficient record, so dense sampling inside one record skips the DAF
+ * reads. Epochs that need any other segment type go through `spkgeo` unchanged. The cache follows
+ * kernel changes on its own.
+ */
+export interface NodeEphemerisCachedApi {
+  spkgeoCached(target: number, et: number, ref: string, observer: number): SpkezrResult;
+  spkgeoCachedBatch(target: number, ets: Float64Array, ref: string, observer: number): SpkezrBatchResult;
+  spkEvaluatorStats(): SpkEvaluatorStats;
+}
+
+/** Options for {@link NodeEphemerisSpkStreamApi.spkwStream}. */
+export type SpkSegmentStreamOptions = {
+  /**
+   * SPK data type: 8 / 12 (equally spaced states, Lagrange / Hermite) or
+   * 9 / 13 (unequally spaced states, Lagrange / Hermite).
+   */
+  type: 8 | 9 | 12 | 13;
+  body: number;
+  center: number;
+  frame: string;
+  segid: string;
+  degree: number;
+  /** Coverage of the whole stream; `last` must not pass the last appended epoch. */
+  first: number;
+  last: number;
+  /** Types 8 / 12: epoch of the first state and the step between states. */
+  epoch1?: number;
+  step?: number;
+  /** States buffered natively before a segment is written. Defaults to 65536. */
+  chunkStates?: number;
+};
+
+/**
+ * A segment writer returned by {@link NodeEphemerisSpkStreamApi.spkwStream}.
+ *
+ * `append` takes packed 6-vector states (and, for types 9 / 13, their epochs)
+ * in chunks of any size. `close` writes whatever is still buffered; `abort`
+ * drops it. Either one must be called, and the SPK handle must stay open
+ * until then.
+ */
+export interface NodeSpkSegmentStream {
+  append(states: Float64Array, epochs?: Float64Array): void;
+  close(): void;
+  abort(): void;
+}
+
+/**
+ * Node-only streaming SPK writer (not part of the backend contract).
+ *
+ * Peak memory is bounded by `chunkStates`: each time the native buffer fills,
+ * its states are written as one segment, so a long history becomes a run of
+ * contiguous segments. Neighbouring segments share `degree + 1` states of
+ * context on each side of their boundary, so interpolation anywhere in the
+ * coverage matches a single segment holding the whole history. A CSPICE
+ * failure discards the stream.
+ */
+export interface NodeEphemerisSpkStreamApi {
+  spkwStream(handle: SpiceHandle, options: SpkSegmentStreamOptions): NodeSpkSegmentStream;
+}
+
+/** Options for {@link NodeEphemerisSubsetApi.spkSubset}. */
+export type SpkSubsetOptions = {
+  /** NAIF IDs of the bodies to keep. Omit (or pass an empty list) to keep every body. */
+  bodies?: readonly number[] | Int32Array;
+  /** Window to keep (TDB seconds past J2000). */
+  first: number;
+  last: number;
+  /** Internal file name of the new SPK. Defaults to `"tspice spkSubset"`. */
+  ifname?: string;
+};
+
+/**
+ * Node-only SPK subsetting (not part of the backend contract).
+ *
+ * `spkSubset` writes a new SPK holding only the data `bodies` need over
+ * `[first, last]`, like `spkmerge` but in process: each matching segment of
+ * `sources` is cut down to the window with `spksub`, which copies only the
+ * records that cover it. Segments keep their source order, so precedence is
+ * the same as loading `sources` in order. Centers are not added
+ * automatically: list every body in the chains you will query (e.g. `399`,
+ * `3` and `10` for the Earth relative to the Sun). Write to a
+ * `VirtualOutput` and read it back with `readVirtualOutput` to get the bytes
+ * (e.g. to ship to a WASM backend). Returns the number of segments written.
+ */
+export interface NodeEphemerisSubsetApi {
+  spkSubset(sources: readonly string[], out: string | VirtualOutput, options: SpkSubsetOptions): number;
+}
+
+/**
+ * Node-only indexed coverage queries (not part of the backend contract).
+ *
+ * Same answers as `spkobj` / `spkcov` / `ckobj` / `ckcov`, served from a
+ * native per-file index instead of filling cells and windows. The first query
+ * against a file scans its DAF summaries once; later queries against the same
+ * path (and unchanged mtime/size) come from memory. Intervals are packed as
+ * `[left0, right0, left1, right1, ...]`; IDs are sorted and unique. `unload`
+ * and `kclear` drop the index.
+ */
+export interface NodeEphemerisCoverageApi {
+  spkobjIds(spk: string): Int32Array;
+  spkcovIntervals(spk: string, idcode: number): Float64Array;
+  ckobjIds(ck: string): Int32Array;
+  ckcovIntervals(
+    ck: string,
+    idcode: number,
+    needav: boolean,
+    level: string,
+    tol: number,
+    timsys: string,
+  ): Float64Array;
+}
+
+/**
+ * Node-only display-quality ephemeris tables (not part of the backend contract).
+ *
+ * `ephemerisTableBuild` samples `spkezr` over `[et0, et1]` and fits piecewise Chebyshev
+ * series until, at the fit's check points, the position error is within `tolerance` km and the
+ * error of the fit's derivative within `velocityTolerance` km/s (default `tolerance / 1000`). The
+ * result is a self-contained `ArrayBuffer` (format in `@rybosome/tspice-core`'s
+ * `parseEphemerisTable`), small enough to transfer to workers or a browser.
+ *
+ * `ephemerisTableEval` evaluates a table natively without taking the CSPICE lock, so it never
+ * waits on other backend calls. States are `[x, y, z, vx, vy, vz]` per epoch (km, km/s),
+ * velocities being the derivative of the fit. `@rybosome/tspice-core`'s
+ * `evaluateEphemerisTable` gives the same answers in plain JS wherever the addon is not available.
+ */
+export interface NodeEphemerisTableApi {
+  ephemerisTableBuild(
+    target: string,
+    et0: number,
+    et1: number,
+    ref: string,
+    abcorr: AbCorr | string,
+    observer: string,
+    tolerance: number,
+    velocityTolerance?: number,
+  ): ArrayBuffer;
+
+  /** Throws a `RangeError` (with `error.index`) for epochs outside the table. */
+  ephemerisTableEval(table: ArrayBuffer, ets: Float64Array, out?: Float64Array): Float64Array;
+}
+
 /** Create an {@link EphemerisApi} implementation backed by the native Node addon. */
 export function createEphemerisApi(
   native: NativeAddon,
   handles: SpiceHandleRegistry,
   stager: KernelStager,
   outputs: VirtualOutputStager,
-): EphemerisApi {
+): EphemerisApi &
+  NodeEphemerisBatchApi &
+  NodeEphemerisIntoApi &
+  NodeEphemerisTryApi &
+  NodeEphemerisIdApi &
+  NodeEphemerisCachedApi &
+  NodeEphemerisSpkStreamApi &
+  NodeEphemerisSubsetApi &
+  NodeEphemerisCoverageApi &
+  NodeEphemerisTableApi {
   const virtualOutputByHandle = new Map<SpiceHandle, VirtualOutput>();
 
   return {
@@ -67,6 +365,17 @@ export function createEphemerisApi(
       return result;
     },
 
+    trySpkezr: (target, et, ref, abcorr, observer) => {
+      const out = native.trySpkezr(target, et, ref, abcorr, observer);
+      invariant(out && typeof out === "object", "Expected trySpkezr() to return an object");
+      if (!out.found) {
+        return { found: false };
+      }
+      invariant(Array.isArray(out.state) && out.state.length === 6, "Expected trySpkezr().state to be a length-6 array");
+      invariant(typeof out.lt === "number", "Expected trySpkezr().lt to be a number");
+      return { found: true, state: out.state as SpiceStateVector, lt: out.lt };
+    },
+
     spkpos: (target, et, ref, abcorr, observer) => {
       const out = native.spkpos(target, et, ref, abcorr, observer);
       invariant(out && typeof out === "object", "Expected spkpos() to return an object");
@@ -77,6 +386,76 @@ export function createEphemerisApi(
       return result;
     },
 
+    spkezrBatch: (target, ets, ref, abcorr, observer, options) => {
+      invariant(ets instanceof Float64Array, "spkezrBatch(ets): expected a Float64Array");
+      const out = withCallOptionsSync("spkezrBatch", options, (nativeOptions) =>
+        native.spkezrBatch(target, ets, ref, abcorr, observer, nativeOptions),
+      );
+      invariant(out && typeof out === "object", "Expected spkezrBatch() to return an object");
+      invariant(
+        out.states instanceof Float64Array && out.states.length === ets.length * 6,
+        "Expected spkezrBatch().states to be a Float64Array of length 6*n",
+      );
+      invariant(
+        out.lts instanceof Float64Array && out.lts.length === ets.length,
+        "Expected spkezrBatch().lts to be a Float64Array of length n",
+      );
+      return { states: out.states, lts: out.lts };
+    },
+
+    spkposBatch: (target, ets, ref, abcorr, observer, options) => {
+      invariant(ets instanceof Float64Array, "spkposBatch(ets): expected a Float64Array");
+      const out = withCallOptionsSync("spkposBatch", options, (nativeOptions) =>
+        native.spkposBatch(target, ets, ref, abcorr, observer, nativeOptions),
+      );
+      invariant(out && typeof out === "object", "Expected spkposBatch() to return an object");
+      invariant(
+        out.positions instanceof Float64Array && out.positions.length === ets.length * 3,
+        "Expected spkposBatch().positions to be a Float64Array of length 3*n",
+      );
+      invariant(
+        out.lts instanceof Float64Array && out.lts.length === ets.length,
+        "Expected spkposBatch().lts to be a Float64Array of length n",
+      );
+      return { positions: out.positions, lts: out.lts };
+    },
+
+    spkezrInto: (target, et, ref, abcorr, observer, out) => {
+      invariant(out instanceof Float64Array && out.length === 6, "spkezrInto(out): expected a length-6 Float64Array");
+      const lt = native.spkezrInto(target, et, ref, abcorr, observer, out);
+      invariant(typeof lt === "number", "Expected spkezrInto() to return a number");
+      return lt;
+    },
+
+    spkposInto: (target, et, ref, abcorr, observer, out) => {
+      invariant(out instanceof Float64Array && out.length === 3, "spkposInto(out): expected a length-3 Float64Array");
+      const lt = native.spkposInto(target, et, ref, abcorr, observer, out);
+      invariant(typeof lt === "number", "Expected spkposInto() to return a number");
+      return lt;
+    },
+
+    spkezrIntoStatus: (target, et, ref, abcorr, observer, out) => {
+      invariant(
+        out instanceof Float64Array && out.length === 7,
+        "spkezrIntoStatus(out): expected a length-7 Float64Array",
+      );
+      return toSpiceCallStatus(
+        native.spkezrIntoStatus(target, et, ref, abcorr, observer, out),
+        "spkezrIntoStatus()",
+      );
+    },
+
+    spkposIntoStatus: (target, et, ref, abcorr, observer, out) => {
+      invariant(
+        out instanceof Float64Array && out.length === 4,
+        "spkposIntoStatus(out): expected a length-4 Float64Array",
+      );
+      return toSpiceCallStatus(
+        native.spkposIntoStatus(target, et, ref, abcorr, observer, out),
+        "spkposIntoStatus()",
+      );
+    },
+
     spkez: (target, et, ref, abcorr, observer) => {
       const out = native.spkez(target, et, ref, abcorr, observer);
       invariant(out && typeof out === "object", "Expected spkez() to return an object");
@@ -107,6 +486,75 @@ export function createEphemerisApi(
       return result;
     },
 
+    spkezId: (target, et, refId, abcorr, observer) => {
+      const out = native.spkezId(target, et, refId, abcorr, observer);
+      invariant(out && typeof out === "object", "Expected spkezId() to return an object");
+      invariant(Array.isArray(out.state) && out.state.length === 6, "Expected spkezId().state to be a length-6 array");
+      invariant(typeof out.lt === "number", "Expected spkezId().lt to be a number");
+      return { state: out.state as SpiceStateVector, lt: out.lt };
+    },
+
+    spkgeoId: (target, et, refId, observer) => {
+      const out = native.spkgeoId(target, et, refId, observer);
+      invariant(out && typeof out === "object", "Expected spkgeoId() to return an object");
+      invariant(Array.isArray(out.state) && out.state.length === 6, "Expected spkgeoId().state to be a length-6 array");
+      invariant(typeof out.lt === "number", "Expected spkgeoId().lt to be a number");
+      return { state: out.state as SpiceStateVector, lt: out.lt };
+    },
+
+    spkgeoCached: (target, et, ref, observer) => {
+      const out = native.spkgeoCached(target, et, ref, observer);
+      invariant(out && typeof out === "object", "Expected spkgeoCached() to return an object");
+      invariant(
+        Array.isArray(out.state) && out.state.length === 6,
+        "Expected spkgeoCached().state to be a length-6 array",
+      );
+      invariant(typeof out.lt === "number", "Expected spkgeoCached().lt to be a number");
+      return { state: out.state as SpiceStateVector, lt: out.lt };
+    },
+
+    spkgeoCachedBatch: (target, ets, ref, observer) => {
+      invariant(ets instanceof Float64Array, "spkgeoCachedBatch(ets): expected a Float64Array");
+      const out = native.spkgeoCachedBatch(target, ets, ref, observer);
+      invariant(out && typeof out === "object", "Expected spkgeoCachedBatch() to return an object");
+      invariant(
+        out.states instanceof Float64Array && out.states.length === ets.length * 6,
+        "Expected spkgeoCachedBatch().states to be a Float64Array of length 6*n",
+      );
+      invariant(
+        out.lts instanceof Float64Array && out.lts.length === ets.length,
+        "Expected spkgeoCachedBatch().lts to be a Float64Array of length n",
+      );
+      return { states: out.states, lts: out.lts };
+    },
+
+    ephemerisTableBuild: (target, et0, et1, ref, abcorr, observer, tolerance, velocityTolerance) => {
+      const out = native.ephemerisTableBuild(target, et0, et1, ref, abcorr, observer, tolerance, velocityTolerance);
+      invariant(out instanceof ArrayBuffer, "Expected ephemerisTableBuild() to return an ArrayBuffer");
+      return out;
+    },
+
+    ephemerisTableEval: (table, ets, out) => {
+      invariant(table instanceof ArrayBuffer, "ephemerisTableEval(table): expected an ArrayBuffer");
+      invariant(ets instanceof Float64Array, "ephemerisTableEval(ets): expected a Float64Array");
+      const states = out ?? new Float64Array(ets.length * 6);
+      invariant(
+        states instanceof Float64Array && states.length === ets.length * 6,
+        "ephemerisTableEval(out): expected a Float64Array of length 6*ets.length",
+      );
+      native.ephemerisTableEval(table, ets, states);
+      return states;
+    },
+
+    spkEvaluatorStats: () => {
+      const out = native.spkEvaluatorStats();
+      invariant(out && typeof out === "object", "Expected spkEvaluatorStats() to return an object");
+      for (const key of ["segments", "recordHits", "recordReads", "fallbacks"] as const) {
+        invariant(typeof out[key] === "number", `Expected spkEvaluatorStats().${key} to be a number`);
+      }
+      return { ...out };
+    },
+
     spkgps: (target, et, ref, observer) => {
       const out = native.spkgps(target, et, ref, observer);
       invariant(out && typeof out === "object", "Expected spkgps() to return an object");
@@ -133,6 +581,36 @@ export function createEphemerisApi(
       native.spkobj(resolved, ids);
     },
 
+    spkobjIds: (spk: string) => {
+      const out = native.spkobjIds(stager.resolvePathForSpice(spk));
+      invariant(out instanceof Int32Array, "Expected spkobjIds() to return an Int32Array");
+      return out;
+    },
+
+    spkcovIntervals: (spk: string, idcode: number) => {
+      const out = native.spkcovIntervals(stager.resolvePathForSpice(spk), idcode);
+      invariant(
+        out instanceof Float64Array && out.length % 2 === 0,
+        "Expected spkcovIntervals() to return an even-length Float64Array",
+      );
+      return out;
+    },
+
+    ckobjIds: (ck: string) => {
+      const out = native.ckobjIds(stager.resolvePathForSpice(ck));
+      invariant(out instanceof Int32Array, "Expected ckobjIds() to return an Int32Array");
+      return out;
+    },
+
+    ckcovIntervals: (ck: string, idcode: number, needav: boolean, level: string, tol: number, timsys: string) => {
+      const out = native.ckcovIntervals(stager.resolvePathForSpice(ck), idcode, needav, level, tol, timsys);
+      invariant(
+        out instanceof Float64Array && out.length % 2 === 0,
+        "Expected ckcovIntervals() to return an even-length Float64Array",
+      );
+      return out;
+    },
+
     spksfs: (body: number, et: number) => {
       const out = native.spksfs(body, et);
       invariant(out && typeof out === "object", "Expected spksfs() to return an object");
@@ -244,5 +722,82 @@ export function createEphemerisApi(
       const nativeHandle = handles.lookup(handle, ["SPK"], "spkw08").nativeHandle;
       native.spkw08(nativeHandle, body, center, frame, first, last, segid, degree, states, epoch1, step);
     },
+
+    spkSubset: (sources: readonly string[], out: string | VirtualOutput, options: SpkSubsetOptions) => {
+      invariant(Array.isArray(sources), "spkSubset(sources): expected an array of paths");
+      invariant(options && typeof options === "object", "spkSubset(options): expected an object");
+      const bodies = options.bodies instanceof Int32Array ? options.bodies : Int32Array.from(options.bodies ?? []);
+      const segments = native.spkSubset(
+        sources.map((spk) => stager.resolvePathForSpice(spk)),
+        resolveSpkPath(outputs, out, "spkSubset(out)"),
+        options.ifname ?? "tspice spkSubset",
+        bodies,
+        options.first,
+        options.last,
+      );
+      invariant(
+        typeof segments === "number" && Number.isInteger(segments) && segments > 0,
+        "Expected spkSubset() to return a positive segment count",
+      );
+      return segments;
+    },
+
+    spkwStream: (handle: SpiceHandle, options: SpkSegmentStreamOptions) => {
+      invariant(options && typeof options === "object", "spkwStream(options): expected an object");
+      const { type, body, center, frame, segid, degree, first, last } = options;
+      const equalStep = type === 8 || type === 12;
+      invariant(
+        !equalStep || (typeof options.epoch1 === "number" && typeof options.step === "number"),
+        `spkwStream(): type ${type} requires epoch1 and step`,
+      );
+
+      const nativeHandle = handles.lookup(handle, ["SPK"], "spkwStream").nativeHandle;
+      const stream = native.spkwStreamOpen(
+        nativeHandle,
+        type,
+        body,
+        center,
+        degree,
+        frame,
+        segid,
+        first,
+        last,
+        options.epoch1 ?? 0,
+        options.step ?? 0,
+        options.chunkStates ?? 65_536,
+      );
+
+      let open = true;
+      const assertOpen = (context: string) => invariant(open, `${context}: stream is closed`);
+      return {
+        append: (states: Float64Array, epochs?: Float64Array) => {
+          assertOpen("spkwStream().append()");
+          invariant(states instanceof Float64Array, "spkwStream().append(states): expected a Float64Array");
+          invariant(
+            equalStep ? epochs === undefined : epochs instanceof Float64Array,
+            equalStep
+              ? `spkwStream().append(epochs): not used for type ${type}`
+              : `spkwStream().append(epochs): type ${type} requires a Float64Array of epochs`,
+          );
+          try {
+            native.spkwStreamAppend(stream, states, epochs);
+          } catch (error) {
+            // The native side drops a stream whose segment write failed.
+            open = false;
+            throw error;
+          }
+        },
+        close: () => {
+          assertOpen("spkwStream().close()");
+          open = false;
+          native.spkwStreamClose(stream, false);
+        },
+        abort: () => {
+          if (!open) return;
+          open = false;
+          native.spkwStreamClose(stream, true);
+        },
+      };
+    },
   };
 }
@@ -3,8 +3,44 @@ import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
 
+/**
+ * Outcome of a Node-only `*IntoStatus` call. `"coverage-gap"` means the kernels
+ * have no data for the requested epoch (`SPICE(SPKINSUFFDATA)`,
+ * `SPICE(NOFRAMECONNECT)`); any other CSPICE failure is `"error"`.
+ */
+export type SpiceCallStatus = "ok" | "coverage-gap" | "error";
+
+// Indexed by the shim's `TSPICE_ERROR_*` class.
+const CALL_STATUSES: readonly SpiceCallStatus[] = ["ok", "coverage-gap", "error"];
+
+/** @internal Map a native `TSPICE_ERROR_*` class to a {@link SpiceCallStatus}. */
+export function toSpiceCallStatus(errorClass: unknown, context: string): SpiceCallStatus {
+  const status = typeof errorClass === "number" ? CALL_STATUSES[errorClass] : undefined;
+  invariant(status !== undefined, `Expected ${context} to return a TSPICE_ERROR_* class`);
+  return status;
+}
+
+/** Message parts of the last CSPICE failure. */
+export interface SpiceErrorParts {
+  status: Exclude<SpiceCallStatus, "ok">;
+  short: string;
+  long: string;
+  trace: string;
+}
+
+/**
+ * Node-only error inspection (not part of the backend contract).
+ *
+ * `*IntoStatus` calls report failures without building a message or throwing;
+ * `lastSpiceError()` returns the parts of the most recent failure on demand.
+ * They are process-global and overwritten by the next CSPICE failure.
+ */
+export interface NodeErrorStatusApi {
+  lastSpiceError(): SpiceErrorParts | null;
+}
+
 /** Create an {@link ErrorApi} implementation backed by the native Node addon. */
-export function createErrorApi(native: NativeAddon): ErrorApi {
+export function createErrorApi(native: NativeAddon): ErrorApi & NodeErrorStatusApi {
   return {
     failed: () => {
       const out = native.failed();
@@ -38,5 +74,18 @@ export function createErrorApi(native: NativeAddon): ErrorApi {
     chkout: (name) => {
       native.chkout(name);
     },
+
+    lastSpiceError: () => {
+      const out = native.lastSpiceError();
+      if (out === null) return null;
+      invariant(typeof out === "object", "Expected native backend lastSpiceError() to return an object or null");
+      const status = toSpiceCallStatus(out.class, "lastSpiceError().class");
+      invariant(status !== "ok", "Expected native backend lastSpiceError() to report a failure class");
+      invariant(
+        typeof out.short === "string" && typeof out.long === "string" && typeof out.trace === "string",
+        "Expected native backend lastSpiceError() parts to be strings",
+      );
+      return { status, short: out.short, long: out.long, trace: out.trace };
+    },
   };
 }
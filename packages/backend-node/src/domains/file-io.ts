@@ -58,8 +58,126 @@ function normalizeFoundDlaDescriptor(value: unknown, context: string): FoundDlaD
   return { found: true, descr: obj.descr };
 }
 
+/**
+ * Node-only raw DAF access.
+ *
+ * `dafgda` reads double-precision words `baddr..eaddr` (1-based, inclusive)
+ * from a DAF opened with `dafopr()`. With `setDafMmapEnabled(true)`, reads
+ * of native-format files are served from a read-only memory map.
+ */
+export interface NodeFileIoDafApi {
+  dafgda(handle: SpiceHandle, baddr: number, eaddr: number): Float64Array;
+}
+
+/** Packed result of {@link NodeFileIoInventoryApi.dafSummaries}. */
+export type DafSummariesResult = {
+  /** Summary format of the file (SPK and CK: `nd = 2`, `ni = 6`). */
+  nd: number;
+  ni: number;
+  /** Number of arrays (segments). */
+  count: number;
+  /** `nd * count` doubles: the unpacked double components of each summary. */
+  doubles: Float64Array;
+  /** `ni * count` integers: the unpacked integer components of each summary. */
+  ints: Int32Array;
+  /** Array name `i` is the ASCII text `names.bytes.subarray(names.offsets[i], names.offsets[i + 1])`. */
+  names: { offsets: Int32Array; bytes: Uint8Array };
+};
+
+/** Packed result of {@link NodeFileIoInventoryApi.dlaDescriptors}. */
+export type DlaDescriptorsResult = {
+  /** Number of DLA segments. */
+  count: number;
+  /** `8 * count` integers: `[bwdptr, fwdptr, ibase, isize, dbase, dsize, cbase, csize]` per segment. */
+  descrs: Int32Array;
+  /**
+   * DSK files only (otherwise `null`): `6 * count` integers per `dskgd`,
+   * `[surfce, center, dclass, dtype, frmcde, corsys]`.
+   */
+  dskInts: Int32Array | null;
+  /**
+   * DSK files only (otherwise `null`): `18 * count` doubles per `dskgd`,
+   * `[corpar(10), co1min, co1max, co2min, co2max, co3min, co3max, start, stop]`.
+   */
+  dskDoubles: Float64Array | null;
+};
+
+/**
+ * Node-only one-call segment inventory (not part of the backend contract).
+ *
+ * Each call opens the file, walks every DAF summary (`dafbfs` / `daffna` /
+ * `dafgs` / `dafgn`) or DLA descriptor (`dlabfs` / `dlafns`) natively, and
+ * closes it again, under a single CSPICE lock and with packed outputs instead
+ * of one object per segment.
+ */
+export interface NodeFileIoInventoryApi {
+  dafSummaries(path: string): DafSummariesResult;
+  dlaDescriptors(path: string): DlaDescriptorsResult;
+}
+
+/** Options for {@link NodeFileIoDskWriteApi.dskWriteType2}; names follow `dskw02` / `dskmi2`. */
+export type DskType2WriteOptions = {
+  center: number;
+  surfid: number;
+  dclass: number;
+  frame: string;
+  corsys: number;
+  /** Defaults to ten zeros (no parameters, as for rectangular / latitudinal systems). */
+  corpar?: readonly number[];
+  mncor1: number;
+  mxcor1: number;
+  mncor2: number;
+  mxcor2: number;
+  mncor3: number;
+  mxcor3: number;
+  first: number;
+  last: number;
+  finscl: number;
+  corscl: number;
+  worksz: number;
+  voxpsz: number;
+  voxlsz: number;
+  /** Defaults to `true`. */
+  makvtl?: boolean;
+  spxisz: number;
+};
+
+/**
+ * Node-only typed-array DSK writer (not part of the backend contract).
+ *
+ * `dskWriteType2` is `dskmi2` followed by `dskw02` in one native call. The
+ * mesh is read straight from the `Float64Array` of vertices and the
+ * `Int32Array` of one-based plate vertex indices, and the spatial index never
+ * leaves native memory.
+ */
+export interface NodeFileIoDskWriteApi {
+  dskWriteType2(
+    handle: SpiceHandle,
+    vertices: Float64Array,
+    plates: Int32Array,
+    options: DskType2WriteOptions,
+  ): void;
+}
+
+/**
+ * Node-only `VirtualOutput` hand-off.
+ *
+ * `takeVirtualOutput` returns the same bytes as `readVirtualOutput`, then
+ * deletes the staged file. Where the platform allows it the bytes are a
+ * private memory map of the file (an external `ArrayBuffer`), so a large
+ * generated kernel reaches `furnsh` or an upload without being copied onto the
+ * JS heap. Calling it twice on one output throws.
+ */
+export interface NodeFileIoOutputApi {
+  takeVirtualOutput(output: VirtualOutput): Uint8Array;
+}
+
 /** Create a {@link FileIoApi} implementation backed by the native Node addon. */
-export function createFileIoApi(native: NativeAddon, handles: SpiceHandleRegistry, outputs: VirtualOutputStager): FileIoApi {
+export function createFileIoApi(
+  native: NativeAddon,
+  handles: SpiceHandleRegistry,
+  outputs: VirtualOutputStager,
+): FileIoApi & NodeFileIoDafApi & NodeFileIoDskWriteApi & NodeFileIoInventoryApi & NodeFileIoOutputApi {
   function closeDasBacked(handle: SpiceHandle, context: string): void {
     handles.close(
       handle,
@@ -97,6 +215,14 @@ export function createFileIoApi(native: NativeAddon, handles: SpiceHandleRegistr
       return outputs.readVirtualOutput({ kind: "virtual-output", path: obj.path });
     },
 
+    takeVirtualOutput: (output: VirtualOutput) => {
+      invariant(output && typeof output === "object", "takeVirtualOutput(output): expected an object");
+      const obj = output as { kind?: unknown; path?: unknown };
+      invariant(obj.kind === "virtual-output", "takeVirtualOutput(output): expected kind='virtual-output'");
+      invariant(typeof obj.path === "string", "takeVirtualOutput(output): expected path to be a string");
+      return outputs.takeVirtualOutput({ kind: "virtual-output", path: obj.path });
+    },
+
     dafopr: (path: string) => handles.register("DAF", native.dafopr(path)),
     dafcls: (handle: SpiceHandle) =>
       handles.close(handle, ["DAF"], (e) => native.dafcls(e.nativeHandle), "dafcls"),
@@ -108,6 +234,64 @@ export function createFileIoApi(native: NativeAddon, handles: SpiceHandleRegistr
       return found;
     },
 
+    dafgda: (handle: SpiceHandle, baddr: number, eaddr: number) => {
+      invariant(
+        Number.isInteger(baddr) && Number.isInteger(eaddr) && baddr >= 1 && eaddr >= baddr && eaddr <= I32_MAX,
+        "dafgda(baddr, eaddr): expected integers with 1 <= baddr <= eaddr",
+      );
+      const out = native.dafgda(handles.lookup(handle, ["DAF"], "dafgda").nativeHandle, baddr, eaddr);
+      invariant(
+        out instanceof Float64Array && out.length === eaddr - baddr + 1,
+        "Expected native backend dafgda() to return a Float64Array of eaddr - baddr + 1 words",
+      );
+      return out;
+    },
+
+    dafSummaries: (path: string) => {
+      const out = native.dafSummaries(path);
+      invariant(out && typeof out === "object", "Expected native backend dafSummaries() to return an object");
+      const { nd, ni, count } = out;
+      invariant(
+        Number.isInteger(nd) && Number.isInteger(ni) && Number.isInteger(count),
+        "Expected dafSummaries() nd/ni/count to be integers",
+      );
+      invariant(
+        out.doubles instanceof Float64Array && out.doubles.length === nd * count,
+        "Expected dafSummaries().doubles to be a Float64Array of length nd*count",
+      );
+      invariant(
+        out.ints instanceof Int32Array && out.ints.length === ni * count,
+        "Expected dafSummaries().ints to be an Int32Array of length ni*count",
+      );
+      invariant(
+        out.names.offsets instanceof Int32Array &&
+          out.names.offsets.length === count + 1 &&
+          out.names.bytes instanceof Uint8Array,
+        "Expected dafSummaries().names to be { offsets: Int32Array, bytes: Uint8Array }",
+      );
+      return { nd, ni, count, doubles: out.doubles, ints: out.ints, names: out.names };
+    },
+
+    dlaDescriptors: (path: string) => {
+      const out = native.dlaDescriptors(path);
+      invariant(out && typeof out === "object", "Expected native backend dlaDescriptors() to return an object");
+      const { count } = out;
+      invariant(Number.isInteger(count), "Expected dlaDescriptors().count to be an integer");
+      invariant(
+        out.descrs instanceof Int32Array && out.descrs.length === 8 * count,
+        "Expected dlaDescriptors().descrs to be an Int32Array of length 8*count",
+      );
+      invariant(
+        out.dskInts === null || (out.dskInts instanceof Int32Array && out.dskInts.length === 6 * count),
+        "Expected dlaDescriptors().dskInts to be null or an Int32Array of length 6*count",
+      );
+      invariant(
+        out.dskDoubles === null || (out.dskDoubles instanceof Float64Array && out.dskDoubles.length === 18 * count),
+        "Expected dlaDescriptors().dskDoubles to be null or a Float64Array of length 18*count",
+      );
+      return { count, descrs: out.descrs, dskInts: out.dskInts, dskDoubles: out.dskDoubles };
+    },
+
     dasopr: (path: string) => handles.register("DAS", native.dasopr(path)),
     dascls: (handle: SpiceHandle) => closeDasBacked(handle, "dascls"),
 
@@ -218,7 +402,33 @@ export function createFileIoApi(native: NativeAddon, handles: SpiceHandleRegistr
         spaixd,
         spaixi,
       ),
-  } satisfies FileIoApi;
+
+    dskWriteType2: (handle: SpiceHandle, vertices: Float64Array, plates: Int32Array, options: DskType2WriteOptions) => {
+      invariant(vertices instanceof Float64Array, "dskWriteType2(vertices): expected a Float64Array");
+      invariant(plates instanceof Int32Array, "dskWriteType2(plates): expected an Int32Array");
+      invariant(options && typeof options === "object", "dskWriteType2(options): expected an object");
+      const o = options;
+      native.dskWriteType2(
+        handles.lookup(handle, ["DAS"], "dskWriteType2").nativeHandle,
+        o.center,
+        o.surfid,
+        o.dclass,
+        o.frame,
+        o.corsys,
+        o.corpar ?? new Array<number>(10).fill(0),
+        new Float64Array([o.mncor1, o.mxcor1, o.mncor2, o.mxcor2, o.mncor3, o.mxcor3, o.first, o.last]),
+        vertices,
+        plates,
+        o.finscl,
+        o.corscl,
+        o.worksz,
+        o.voxpsz,
+        o.voxlsz,
+        o.makvtl ?? true,
+        o.spxisz,
+      );
+    },
+  } satisfies FileIoApi & NodeFileIoDafApi & NodeFileIoDskWriteApi & NodeFileIoInventoryApi & NodeFileIoOutputApi;
 
   Object.defineProperty(api, "__debugOpenHandleCount", {
     value: () => handles.size(),
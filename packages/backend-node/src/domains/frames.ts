@@ -1,5 +1,7 @@
 import type {
+  Found,
   FramesApi,
+  Mat3RowMajor,
   SpiceMatrix6x6,
   SpiceVector3,
 } from "@rybosome/tspice-backend-contract";
@@ -7,6 +9,9 @@ import { brandMat3RowMajor } from "@rybosome/tspice-backend-contract";
 import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { publishKernelPoolChanges } from "../runtime/kernel-pool-changes.js";
+
+import { toSpiceCallStatus, type SpiceCallStatus } from "./error.js";
 
 const UINT32_MAX = 0xffff_ffff;
 
@@ -25,8 +30,188 @@ function assertOpaqueHandle(handle: unknown, context: string): asserts handle is
   }
 }
 
+/**
+ * Node-only allocation-free frame transforms (not part of the backend contract).
+ *
+ * The row-major matrix is written into the caller-owned `out` array, which must
+ * have exactly 9 (`pxformInto`) or 36 (`sxformInto`) elements.
+ */
+export interface NodeFramesIntoApi {
+  pxformInto(from: string, to: string, et: number, out: Float64Array): void;
+  sxformInto(from: string, to: string, et: number, out: Float64Array): void;
+
+  /**
+   * Non-throwing variants: a CSPICE failure is returned as a status without
+   * building an error message (see `lastSpiceError()`). Invalid arguments
+   * still throw.
+   */
+  pxformIntoStatus(from: string, to: string, et: number, out: Float64Array): SpiceCallStatus;
+  sxformIntoStatus(from: string, to: string, et: number, out: Float64Array): SpiceCallStatus;
+}
+
+/**
+ * Node-only speculative frame transforms (not part of the backend contract).
+ *
+ * Same as `pxform` / `sxform`, but a missing-data failure (e.g. no CK
+ * coverage at `et`, `SPICE(NOFRAMECONNECT)`) is `{ found: false }` instead of a
+ * thrown error. Other failures still throw.
+ */
+export interface NodeFramesTryApi {
+  tryPxform(from: string, to: string, et: number): Found<{ value: Mat3RowMajor }>;
+  trySxform(from: string, to: string, et: number): Found<{ value: SpiceMatrix6x6 }>;
+}
+
+/**
+ * Node-only frame-ID transforms (not part of the backend contract).
+ *
+ * Same as `pxform` / `pxformInto`, but the frames are IDs from
+ * `internFrame()` / `namfrm()`.
+ */
+export interface NodeFramesIdApi {
+  pxformId(fromId: number, toId: number, et: number): Mat3RowMajor;
+  pxformIdInto(fromId: number, toId: number, et: number, out: Float64Array): void;
+}
+
+/**
+ * Node-only fused frame transforms (not part of the backend contract).
+ *
+ * One transform is computed per epoch in `ets` (`pxform` for
+ * `transformVectors`, `sxform` for `transformStates`) and applied to the
+ * packed 3-vectors / 6-vector states in `vecs` in a single native call.
+ * `vecs` is grouped epoch-major: with `n` epochs and `k` rows, epoch `i`
+ * applies to rows `[i * k / n, (i + 1) * k / n)`, so `k` must be a multiple of
+ * `n` (a single epoch applies to every row). `out` may alias `vecs`.
+ */
+export interface NodeFramesTransformApi {
+  transformVectors(
+    from: string,
+    to: string,
+    ets: Float64Array,
+    vecs: Float64Array,
+    out?: Float64Array,
+  ): Float64Array;
+  transformStates(
+    from: string,
+    to: string,
+    ets: Float64Array,
+    states: Float64Array,
+    out?: Float64Array,
+  ): Float64Array;
+}
+
+/** Packed result of {@link NodeFramesCkBatchApi.ckgpBatch}. */
+export type CkgpBatchResult = {
+  /** `9*n` doubles: row-major C-matrix per tick (zeros when not found). */
+  cmats: Float64Array;
+  /** `n` output encoded SCLK times (0 when not found). */
+  clkouts: Float64Array;
+  /** `ceil(n/8)` bytes: bit `i % 8` of byte `i >> 3` is set when tick `i` has pointing. */
+  found: Uint8Array;
+};
+
+/** Packed result of {@link NodeFramesCkBatchApi.ckgpavBatch}. */
+export type CkgpavBatchResult = CkgpBatchResult & {
+  /** `3*n` doubles: angular velocity per tick (zeros when not found). */
+  avs: Float64Array;
+};
+
+/**
+ * Node-only batched CK attitude lookups (not part of the backend contract).
+ *
+ * Same as `ckgp` / `ckgpav` for one instrument and frame over every encoded
+ * SCLK time in `sclkdp`, in a single native call.
+ */
+export interface NodeFramesCkBatchApi {
+  ckgpBatch(inst: number, sclkdp: Float64Array, tol: number, ref: string): CkgpBatchResult;
+  ckgpavBatch(inst: number, sclkdp: Float64Array, tol: number, ref: string): CkgpavBatchResult;
+}
+
+/** Counters reported by {@link NodeFramesCacheApi.frameCacheStats}. */
+export type FrameCacheStats = {
+  /** (from, to) pairs classified as time-invariant (TK / inertial chains). */
+  fixedChains: number;
+  /** Occupied slots of the per-epoch cache for time-dependent chains. */
+  recent: number;
+  /** Transforms served from the cache. */
+  hits: number;
+  /** Transforms computed by CSPICE. */
+  misses: number;
+};
+
+/**
+ * Node-only frame-transform cache counters (not part of the backend contract).
+ *
+ * `pxform` / `sxform` and their `*Into` / `*Id` / `try*` variants go through a
+ * native memo: chains made only of TK (fixed-offset) and inertial frames are
+ * computed once, and other chains are remembered for a few recent exact
+ * epochs. Results are exactly what CSPICE returned; the cache is dropped on
+ * any kernel or pool change.
+ */
+export interface NodeFramesCacheApi {
+  frameCacheStats(): FrameCacheStats;
+}
+
+function assertTransformArgs(
+  ets: unknown,
+  vecs: unknown,
+  out: unknown,
+  dim: number,
+  context: string,
+): asserts vecs is Float64Array {
+  invariant(ets instanceof Float64Array, `${context}: expected ets to be a Float64Array`);
+  invariant(
+    vecs instanceof Float64Array && vecs.length % dim === 0,
+    `${context}: expected a Float64Array whose length is a multiple of ${dim}`,
+  );
+  const rows = vecs.length / dim;
+  invariant(
+    ets.length === 0 ? rows === 0 : rows % ets.length === 0,
+    `${context}: expected the row count (${rows}) to be a multiple of ets.length (${ets.length})`,
+  );
+  invariant(
+    out === undefined || (out instanceof Float64Array && out.length === vecs.length),
+    `${context}: expected out to be a Float64Array of length ${vecs.length}`,
+  );
+}
+
+function assertFloat64Out(out: unknown, length: number, context: string): asserts out is Float64Array {
+  invariant(
+    out instanceof Float64Array && out.length === length,
+    `${context}: expected a length-${length} Float64Array`,
+  );
+}
+
+function checkCkBatch(
+  out: { cmats: Float64Array; clkouts: Float64Array; found: Uint8Array },
+  n: number,
+  name: string,
+): CkgpBatchResult {
+  invariant(out && typeof out === "object", `Expected ${name}() to return an object`);
+  invariant(
+    out.cmats instanceof Float64Array && out.cmats.length === n * 9,
+    `Expected ${name}().cmats to be a Float64Array of length 9*n`,
+  );
+  invariant(
+    out.clkouts instanceof Float64Array && out.clkouts.length === n,
+    `Expected ${name}().clkouts to be a Float64Array of length n`,
+  );
+  invariant(
+    out.found instanceof Uint8Array && out.found.length === Math.ceil(n / 8),
+    `Expected ${name}().found to be a Uint8Array of length ceil(n/8)`,
+  );
+  return { cmats: out.cmats, clkouts: out.clkouts, found: out.found };
+}
+
 /** Create a {@link FramesApi} implementation backed by the native Node addon. */
-export function createFramesApi(native: NativeAddon): FramesApi {
+export function createFramesApi(
+  native: NativeAddon,
+): FramesApi &
+  NodeFramesIntoApi &
+  NodeFramesTryApi &
+  NodeFramesIdApi &
+  NodeFramesTransformApi &
+  NodeFramesCacheApi &
+  NodeFramesCkBatchApi {
   return {
     namfrm: (name) => {
       const out = native.namfrm(name);
@@ -114,14 +299,41 @@ export function createFramesApi(native: NativeAddon): FramesApi {
       };
     },
 
+    ckgpBatch: (inst, sclkdp, tol, ref) => {
+      invariant(sclkdp instanceof Float64Array, "ckgpBatch(sclkdp): expected a Float64Array");
+      const out = native.ckgpBatch(inst, sclkdp, tol, ref);
+      return checkCkBatch(out, sclkdp.length, "ckgpBatch");
+    },
+
+    ckgpavBatch: (inst, sclkdp, tol, ref) => {
+      invariant(sclkdp instanceof Float64Array, "ckgpavBatch(sclkdp): expected a Float64Array");
+      const n = sclkdp.length;
+      const out = native.ckgpavBatch(inst, sclkdp, tol, ref);
+      const checked = checkCkBatch(out, n, "ckgpavBatch");
+      invariant(
+        out.avs instanceof Float64Array && out.avs.length === n * 3,
+        "Expected ckgpavBatch().avs to be a Float64Array of length 3*n",
+      );
+      return { ...checked, avs: out.avs };
+    },
+
     cklpf: (ck) => {
-      const handle = native.cklpf(ck);
+      let handle: number;
+      try {
+        handle = native.cklpf(ck);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
       invariant(typeof handle === "number" && Number.isInteger(handle), "Expected cklpf() to return an integer handle");
       return handle;
     },
 
     ckupf: (handle) => {
-      native.ckupf(handle);
+      try {
+        native.ckupf(handle);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     ckobj: (ck, ids) => {
@@ -152,5 +364,71 @@ export function createFramesApi(native: NativeAddon): FramesApi {
       invariant(Array.isArray(m) && m.length === 36, "Expected sxform() to return a length-36 array");
       return m as SpiceMatrix6x6;
     },
+
+    frameCacheStats: () => {
+      const out = native.frameCacheStats();
+      invariant(out && typeof out === "object", "Expected frameCacheStats() to return an object");
+      for (const key of ["fixedChains", "recent", "hits", "misses"] as const) {
+        invariant(typeof out[key] === "number", `Expected frameCacheStats().${key} to be a number`);
+      }
+      return { ...out };
+    },
+
+    tryPxform: (from, to, et) => {
+      const out = native.tryPxform(from, to, et);
+      if (!out.found) {
+        return { found: false };
+      }
+      return { found: true, value: brandMat3RowMajor(out.value, { label: "tryPxform().value" }) };
+    },
+
+    trySxform: (from, to, et) => {
+      const out = native.trySxform(from, to, et);
+      if (!out.found) {
+        return { found: false };
+      }
+      invariant(Array.isArray(out.value) && out.value.length === 36, "Expected trySxform().value to be a length-36 array");
+      return { found: true, value: out.value as SpiceMatrix6x6 };
+    },
+
+    pxformInto: (from, to, et, out) => {
+      assertFloat64Out(out, 9, "pxformInto(out)");
+      native.pxformInto(from, to, et, out);
+    },
+
+    sxformInto: (from, to, et, out) => {
+      assertFloat64Out(out, 36, "sxformInto(out)");
+      native.sxformInto(from, to, et, out);
+    },
+
+    pxformIntoStatus: (from, to, et, out) => {
+      assertFloat64Out(out, 9, "pxformIntoStatus(out)");
+      return toSpiceCallStatus(native.pxformIntoStatus(from, to, et, out), "pxformIntoStatus()");
+    },
+
+    sxformIntoStatus: (from, to, et, out) => {
+      assertFloat64Out(out, 36, "sxformIntoStatus(out)");
+      return toSpiceCallStatus(native.sxformIntoStatus(from, to, et, out), "sxformIntoStatus()");
+    },
+
+    pxformId: (fromId, toId, et) => {
+      const m = native.pxformId(fromId, toId, et);
+      return brandMat3RowMajor(m, { label: "pxformId()" });
+    },
+
+    pxformIdInto: (fromId, toId, et, out) => {
+      assertFloat64Out(out, 9, "pxformIdInto(out)");
+      native.pxformIdInto(fromId, toId, et, out);
+    },
+
+    transformVectors: (from, to, ets, vecs, out) => {
+      assertTransformArgs(ets, vecs, out, 3, "transformVectors()");
+      return native.transformVectors(from, to, ets, vecs, out);
+    },
+
+    transformStates: (from, to, ets, states, out) => {
+      assertTransformArgs(ets, states, out, 6, "transformStates()");
+      return native.transformStates(from, to, ets, states, out);
+    },
   };
 }
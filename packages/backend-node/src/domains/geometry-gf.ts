@@ -1,10 +1,12 @@
 import type {
   GeometryGfApi,
+  SpiceWindow,
 } from "@rybosome/tspice-backend-contract";
 import { assertSpiceInt32 } from "@rybosome/tspice-backend-contract";
 import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { withCallOptions, type NodeCallOptions } from "../runtime/cancellation.js";
 
 const UINT32_MAX = 0xffff_ffff;
 
@@ -29,8 +31,87 @@ function assertFiniteNumber(value: unknown, context: string): asserts value is n
   }
 }
 
+function assertGfSearchArgs(
+  name: string,
+  nintvls: number,
+  refval: number,
+  adjust: number,
+  step: number,
+  cnfine: SpiceWindow,
+  result: SpiceWindow,
+): void {
+  assertSpiceInt32(nintvls, `${name}(nintvls)`, { min: 1 });
+  assertFiniteNumber(refval, `${name}(refval)`);
+  assertFiniteNumber(adjust, `${name}(adjust)`);
+  assertFiniteNumber(step, `${name}(step)`);
+  assertOpaqueHandle(cnfine as unknown as number, `${name}(cnfine)`);
+  assertOpaqueHandle(result as unknown as number, `${name}(result)`);
+}
+
+/**
+ * Node-only asynchronous GF searches (not part of the backend contract).
+ *
+ * Same arguments as the synchronous `gfsep` / `gfdist`, but the search runs on
+ * the libuv threadpool and the returned promise resolves with `result` once it
+ * has been filled. The CSPICE mutex is held for the whole search, so other
+ * SPICE calls still wait for it; only non-SPICE work on the event loop keeps
+ * running.
+ *
+ * A trailing {@link NodeCallOptions} bounds that wait: the search stops at its
+ * next step once `options.signal` aborts or `options.timeoutMs` passes,
+ * releasing the mutex and rejecting the promise.
+ */
+export interface NodeGeometryGfAsyncApi {
+  gfsepAsync(...args: [...Parameters<GeometryGfApi["gfsep"]>, options?: NodeCallOptions]): Promise<SpiceWindow>;
+  gfdistAsync(...args: [...Parameters<GeometryGfApi["gfdist"]>, options?: NodeCallOptions]): Promise<SpiceWindow>;
+}
+
+type WithPackedWindows<F> = F extends (...args: [...infer Head, SpiceWindow, SpiceWindow]) => void
+  ? (...args: [...Head, Float64Array]) => Float64Array
+  : never;
+
+/**
+ * Node-only GF searches over packed windows (not part of the backend contract).
+ *
+ * Same arguments as `gfsep` / `gfdist` minus `result`, with `cnfine` passed
+ * as a packed `[left0, right0, left1, right1, ...]` Float64Array and the
+ * result returned the same way. The result window holds up to `nintvls`
+ * intervals. Being handle-free, these are the GF entrypoints the process pool
+ * can run (and partition; see `NodeBackendPool.gfPartitioned`).
+ */
+export interface NodeGeometryGfPackedApi {
+  gfsepPacked: WithPackedWindows<GeometryGfApi["gfsep"]>;
+  gfdistPacked: WithPackedWindows<GeometryGfApi["gfdist"]>;
+}
+
 /** Create a {@link GeometryGfApi} implementation backed by the native Node addon. */
-export function createGeometryGfApi(native: NativeAddon): GeometryGfApi {
+export function createGeometryGfApi(
+  native: NativeAddon,
+): GeometryGfApi & NodeGeometryGfAsyncApi & NodeGeometryGfPackedApi {
+  // Runs `search` between temporary `cnfine` / `result` windows built from and read back into
+  // packed form; both are freed whatever happens.
+  const withPackedWindows = (
+    name: string,
+    nintvls: number,
+    cnfine: Float64Array,
+    search: (cnfine: SpiceWindow, result: SpiceWindow) => void,
+  ): Float64Array => {
+    assertSpiceInt32(nintvls, `${name}(nintvls)`, { min: 1 });
+    invariant(cnfine instanceof Float64Array, `${name}(cnfine): expected a Float64Array`);
+    const cnfineWindow = native.windowFromFloat64Array(cnfine, undefined) as SpiceWindow;
+    try {
+      const resultWindow = native.newWindow(nintvls) as SpiceWindow;
+      try {
+        search(cnfineWindow, resultWindow);
+        return native.windowToFloat64Array(resultWindow);
+      } finally {
+        native.freeWindow(resultWindow);
+      }
+    } finally {
+      native.freeWindow(cnfineWindow);
+    }
+  };
+
   return {
     gfsstp: (step) => {
       assertFiniteNumber(step, "gfsstp(step)");
@@ -83,12 +164,7 @@ export function createGeometryGfApi(native: NativeAddon): GeometryGfApi {
       cnfine,
       result,
     ) => {
-      assertSpiceInt32(nintvls, "gfsep(nintvls)", { min: 1 });
-      assertFiniteNumber(refval, "gfsep(refval)");
-      assertFiniteNumber(adjust, "gfsep(adjust)");
-      assertFiniteNumber(step, "gfsep(step)");
-      assertOpaqueHandle(cnfine as unknown as number, "gfsep(cnfine)");
-      assertOpaqueHandle(result as unknown as number, "gfsep(result)");
+      assertGfSearchArgs("gfsep", nintvls, refval, adjust, step, cnfine, result);
 
       native.gfsep(
         targ1,
@@ -110,12 +186,7 @@ export function createGeometryGfApi(native: NativeAddon): GeometryGfApi {
     },
 
     gfdist: (target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result) => {
-      assertSpiceInt32(nintvls, "gfdist(nintvls)", { min: 1 });
-      assertFiniteNumber(refval, "gfdist(refval)");
-      assertFiniteNumber(adjust, "gfdist(adjust)");
-      assertFiniteNumber(step, "gfdist(step)");
-      assertOpaqueHandle(cnfine as unknown as number, "gfdist(cnfine)");
-      assertOpaqueHandle(result as unknown as number, "gfdist(result)");
+      assertGfSearchArgs("gfdist", nintvls, refval, adjust, step, cnfine, result);
 
       native.gfdist(
         target,
@@ -130,5 +201,114 @@ export function createGeometryGfApi(native: NativeAddon): GeometryGfApi {
         result,
       );
     },
+
+    gfsepAsync: async (
+      targ1,
+      shape1,
+      frame1,
+      targ2,
+      shape2,
+      frame2,
+      abcorr,
+      obsrvr,
+      relate,
+      refval,
+      adjust,
+      step,
+      nintvls,
+      cnfine,
+      result,
+      options,
+    ) => {
+      assertGfSearchArgs("gfsepAsync", nintvls, refval, adjust, step, cnfine, result);
+
+      const handle = await withCallOptions(native, "gfsepAsync", options, (nativeOptions) =>
+        native.gfsepAsync(
+          targ1,
+          shape1,
+          frame1,
+          targ2,
+          shape2,
+          frame2,
+          abcorr,
+          obsrvr,
+          relate,
+          refval,
+          adjust,
+          step,
+          nintvls,
+          cnfine,
+          result,
+          nativeOptions,
+        ),
+      );
+      invariant(handle === (result as unknown as number), "Expected gfsepAsync() to resolve with the result handle");
+      return result;
+    },
+
+    gfdistAsync: async (target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result, options) => {
+      assertGfSearchArgs("gfdistAsync", nintvls, refval, adjust, step, cnfine, result);
+
+      const handle = await withCallOptions(native, "gfdistAsync", options, (nativeOptions) =>
+        native.gfdistAsync(
+          target,
+          abcorr,
+          obsrvr,
+          relate,
+          refval,
+          adjust,
+          step,
+          nintvls,
+          cnfine,
+          result,
+          nativeOptions,
+        ),
+      );
+      invariant(handle === (result as unknown as number), "Expected gfdistAsync() to resolve with the result handle");
+      return result;
+    },
+
+    gfsepPacked: (
+      targ1,
+      shape1,
+      frame1,
+      targ2,
+      shape2,
+      frame2,
+      abcorr,
+      obsrvr,
+      relate,
+      refval,
+      adjust,
+      step,
+      nintvls,
+      cnfine,
+    ) =>
+      withPackedWindows("gfsepPacked", nintvls, cnfine, (cnfineWindow, resultWindow) => {
+        assertGfSearchArgs("gfsepPacked", nintvls, refval, adjust, step, cnfineWindow, resultWindow);
+        native.gfsep(
+          targ1,
+          shape1,
+          frame1,
+          targ2,
+          shape2,
+          frame2,
+          abcorr,
+          obsrvr,
+          relate,
+          refval,
+          adjust,
+          step,
+          nintvls,
+          cnfineWindow,
+          resultWindow,
+        );
+      }),
+
+    gfdistPacked: (target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine) =>
+      withPackedWindows("gfdistPacked", nintvls, cnfine, (cnfineWindow, resultWindow) => {
+        assertGfSearchArgs("gfdistPacked", nintvls, refval, adjust, step, cnfineWindow, resultWindow);
+        native.gfdist(target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfineWindow, resultWindow);
+      }),
   };
 }
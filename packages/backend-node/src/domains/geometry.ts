@@ -21,8 +21,144 @@ function assertFiniteNumberArrayFixed(value: unknown, expectedLength: number, la
   }
 }
 
+/** Packed result of {@link NodeGeometryBatchApi.sincptBatch}. */
+export type SincptBatchResult = {
+  /** `3*n` doubles: the intercept of each ray (zeros for misses). */
+  spoints: Float64Array;
+  /** `n` target epochs (0 for misses). */
+  trgepcs: Float64Array;
+  /** `3*n` doubles: observer-to-intercept vectors (zeros for misses). */
+  srfvecs: Float64Array;
+  /** `ceil(n/8)` bytes: bit `i % 8` of byte `i >> 3` is set when ray `i` hit the target. */
+  found: Uint8Array;
+};
+
+/** Packed result of {@link NodeGeometryBatchApi.iluminBatch}. */
+export type IluminBatchResult = {
+  trgepcs: Float64Array;
+  /** `3*n` doubles. */
+  srfvecs: Float64Array;
+  phase: Float64Array;
+  incdnc: Float64Array;
+  emissn: Float64Array;
+};
+
+/** Packed result of {@link NodeGeometryBatchApi.illumfBatch}; flags are 0/1 bytes. */
+export type IllumfBatchResult = IluminBatchResult & {
+  visibl: Uint8Array;
+  lit: Uint8Array;
+};
+
+/** One (targ1, targ2, observer) combination for {@link NodeGeometryBatchApi.occultBatch}, as in `occult`. */
+export type OccultTriple = {
+  targ1: string;
+  shape1: string;
+  frame1: string;
+  targ2: string;
+  shape2: string;
+  frame2: string;
+  observer: string;
+};
+
+/** Packed result of {@link NodeGeometryBatchApi.occultBatch}. */
+export type OccultBatchResult = {
+  /** `triples.length * ets.length` `occult` codes; triple `t` at epoch `e` is `codes[t * ets.length + e]`. */
+  codes: Int8Array;
+  /**
+   * With `{ transitions: true }`: the runs of equal codes, per triple. Triple `t` owns runs
+   * `[offsets[t], offsets[t + 1])`; run `r` starts at epoch index `runStarts[r]` with code
+   * `runCodes[r]` (each triple's first run starts at 0).
+   */
+  transitions?: { offsets: Int32Array; runStarts: Int32Array; runCodes: Int8Array };
+};
+
+/**
+ * Node-only batched surface geometry (not part of the backend contract).
+ *
+ * One observer and epoch, many rays (`dirs`, packed 3-vectors in `dref`) or surface points
+ * (`spoints`, packed body-fixed 3-vectors), in a single native call. `ELLIPSOID` intercepts
+ * without aberration correction look up the observer position, frame rotation and radii once and
+ * intersect every ray directly; everything else runs the CSPICE routine per row. Throws on the
+ * first CSPICE failure with the row in `error.index`.
+ */
+export interface NodeGeometryBatchApi {
+  sincptBatch(
+    method: string,
+    target: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    dref: string,
+    dirs: Float64Array,
+  ): SincptBatchResult;
+
+  iluminBatch(
+    method: string,
+    target: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    spoints: Float64Array,
+  ): IluminBatchResult;
+
+  illumfBatch(
+    method: string,
+    target: string,
+    ilusrc: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    spoints: Float64Array,
+  ): IllumfBatchResult;
+
+  /**
+   * `occult` for every triple at every epoch of `ets`, in one native call. For `POINT` /
+   * `ELLIPSOID` shapes each epoch looks up the position of every distinct (target, observer) once
+   * and answers 0 directly when the targets' bounding spheres are clearly apart, so a dense grid
+   * is a cheap coarse pass before refining transitions with GF. Throws on the first CSPICE failure
+   * with `error.index` set to `t * ets.length + e`.
+   */
+  occultBatch(
+    triples: readonly OccultTriple[],
+    abcorr: string,
+    ets: Float64Array,
+    options?: { transitions?: boolean },
+  ): OccultBatchResult;
+}
+
+function assertPackedVec3s(value: unknown, label: string): asserts value is Float64Array {
+  invariant(
+    value instanceof Float64Array && value.length % 3 === 0,
+    `${label}: expected a Float64Array with a length that is a multiple of 3`,
+  );
+}
+
+function checkIluminBatch(out: IluminBatchResult, n: number, name: string): IluminBatchResult {
+  invariant(out && typeof out === "object", `Expected ${name}() to return an object`);
+  invariant(
+    out.srfvecs instanceof Float64Array && out.srfvecs.length === n * 3,
+    `Expected ${name}().srfvecs to be a Float64Array of length 3*n`,
+  );
+  for (const key of ["trgepcs", "phase", "incdnc", "emissn"] as const) {
+    invariant(
+      out[key] instanceof Float64Array && out[key].length === n,
+      `Expected ${name}().${key} to be a Float64Array of length n`,
+    );
+  }
+  return {
+    trgepcs: out.trgepcs,
+    srfvecs: out.srfvecs,
+    phase: out.phase,
+    incdnc: out.incdnc,
+    emissn: out.emissn,
+  };
+}
+
 /** Create a {@link GeometryApi} implementation backed by the native Node addon. */
-export function createGeometryApi(native: NativeAddon): GeometryApi {
+export function createGeometryApi(native: NativeAddon): GeometryApi & NodeGeometryBatchApi {
   return {
     subpnt: (method, target, et, fixref, abcorr, observer) => {
       const out = native.subpnt(method, target, et, fixref, abcorr, observer);
@@ -152,6 +288,101 @@ export function createGeometryApi(native: NativeAddon): GeometryApi {
       } satisfies IllumfResult;
     },
 
+    sincptBatch: (method, target, et, fixref, abcorr, observer, dref, dirs) => {
+      assertPackedVec3s(dirs, "sincptBatch(dirs)");
+      const n = dirs.length / 3;
+      const out = native.sincptBatch(method, target, et, fixref, abcorr, observer, dref, dirs);
+      invariant(out && typeof out === "object", "Expected sincptBatch() to return an object");
+      invariant(
+        out.spoints instanceof Float64Array && out.spoints.length === n * 3,
+        "Expected sincptBatch().spoints to be a Float64Array of length 3*n",
+      );
+      invariant(
+        out.trgepcs instanceof Float64Array && out.trgepcs.length === n,
+        "Expected sincptBatch().trgepcs to be a Float64Array of length n",
+      );
+      invariant(
+        out.srfvecs instanceof Float64Array && out.srfvecs.length === n * 3,
+        "Expected sincptBatch().srfvecs to be a Float64Array of length 3*n",
+      );
+      invariant(
+        out.found instanceof Uint8Array && out.found.length === Math.ceil(n / 8),
+        "Expected sincptBatch().found to be a Uint8Array of length ceil(n/8)",
+      );
+      return { spoints: out.spoints, trgepcs: out.trgepcs, srfvecs: out.srfvecs, found: out.found };
+    },
+
+    iluminBatch: (method, target, et, fixref, abcorr, observer, spoints) => {
+      assertPackedVec3s(spoints, "iluminBatch(spoints)");
+      const out = native.iluminBatch(method, target, et, fixref, abcorr, observer, spoints);
+      return checkIluminBatch(out, spoints.length / 3, "iluminBatch");
+    },
+
+    illumfBatch: (method, target, ilusrc, et, fixref, abcorr, observer, spoints) => {
+      assertPackedVec3s(spoints, "illumfBatch(spoints)");
+      const n = spoints.length / 3;
+      const out = native.illumfBatch(method, target, ilusrc, et, fixref, abcorr, observer, spoints);
+      const angles = checkIluminBatch(out, n, "illumfBatch");
+      for (const key of ["visibl", "lit"] as const) {
+        invariant(
+          out[key] instanceof Uint8Array && out[key].length === n,
+          `Expected illumfBatch().${key} to be a Uint8Array of length n`,
+        );
+      }
+      return { ...angles, visibl: out.visibl, lit: out.lit };
+    },
+
+    occultBatch: (triples, abcorr, ets, options) => {
+      invariant(Array.isArray(triples), "occultBatch(triples): expected an array");
+      invariant(ets instanceof Float64Array, "occultBatch(ets): expected a Float64Array");
+      const fields = ["targ1", "shape1", "frame1", "targ2", "shape2", "frame2", "observer"] as const;
+      const columns = fields.map((key) =>
+        triples.map((triple, i) => {
+          const value = triple?.[key];
+          invariant(typeof value === "string", `occultBatch(triples[${i}].${key}): expected a string`);
+          return value;
+        }),
+      );
+      const transitions = options?.transitions === true;
+
+      const out = native.occultBatch(
+        columns[0]!,
+        columns[1]!,
+        columns[2]!,
+        columns[3]!,
+        columns[4]!,
+        columns[5]!,
+        columns[6]!,
+        abcorr,
+        ets,
+        transitions,
+      );
+      invariant(out && typeof out === "object", "Expected occultBatch() to return an object");
+      invariant(
+        out.codes instanceof Int8Array && out.codes.length === triples.length * ets.length,
+        "Expected occultBatch().codes to be an Int8Array of length triples.length * ets.length",
+      );
+      if (!transitions) return { codes: out.codes };
+
+      invariant(
+        out.offsets instanceof Int32Array && out.offsets.length === triples.length + 1,
+        "Expected occultBatch().offsets to be an Int32Array of length triples.length + 1",
+      );
+      const runs = out.offsets[triples.length]!;
+      invariant(
+        out.runStarts instanceof Int32Array && out.runStarts.length === runs,
+        "Expected occultBatch().runStarts to be an Int32Array with one entry per run",
+      );
+      invariant(
+        out.runCodes instanceof Int8Array && out.runCodes.length === runs,
+        "Expected occultBatch().runCodes to be an Int8Array with one entry per run",
+      );
+      return {
+        codes: out.codes,
+        transitions: { offsets: out.offsets, runStarts: out.runStarts, runCodes: out.runCodes },
+      };
+    },
+
     occult: (targ1, shape1, frame1, targ2, shape2, frame2, abcorr, observer, et) => {
       const out = native.occult(targ1, shape1, frame1, targ2, shape2, frame2, abcorr, observer, et);
       invariant(typeof out === "number", "Expected occult() to return a number");
@@ -1,10 +1,69 @@
 import { type IdsNamesApi } from "@rybosome/tspice-backend-contract";
-import { invariant } from "@rybosome/tspice-core";
+import { invariant, type PackedNameTable } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { publishKernelPoolChanges } from "../runtime/kernel-pool-changes.js";
+
+/**
+ * Node-only name interning (not part of the backend contract).
+ *
+ * Resolves a body (`bods2c`) or frame (`namfrm`) name to its integer ID
+ * through an addon-level cache, so hot loops can resolve once and then use the
+ * ID-taking entrypoints (`spkez`, `spkezId`, `spkgeoId`, `pxformId`, ...). The
+ * cache is dropped whenever kernels or kernel-pool variables change
+ * (`furnsh`, `unload`, `kclear`, `boddef`, `p*pool`).
+ *
+ * Unknown names throw a `RangeError`.
+ */
+export interface NodeIdsNamesInternApi {
+  internBody(name: string): number;
+  internFrame(name: string): number;
+}
+
+/** {@link NodeIdsNamesTableApi.exportBodyNameTable} result. */
+export type BodyNameTable = PackedNameTable & { primary: Uint8Array };
+
+/** {@link NodeIdsNamesTableApi.exportFrameTable} result. */
+export type FrameNameTable = PackedNameTable;
+
+/**
+ * Node-only bulk ID/name tables (not part of the backend contract), for
+ * resolving many names client-side (see `indexNameTable` in
+ * `@rybosome/tspice-core`).
+ *
+ * - `exportBodyNameTable()`: every body name `bodn2c` resolves (`boddef`
+ *   definitions, `NAIF_BODY_NAME` kernel entries and the built-in table), once
+ *   per distinct name, with its current code. `primary[i]` marks the name
+ *   `bodc2n` returns for that code.
+ * - `exportFrameTable()`: every named frame (built-in and kernel-pool), in
+ *   ascending ID order.
+ *
+ * Each is one native call under one lock. `generation` is
+ * `kernelPoolGeneration()` at the time of the read; keep a table until the
+ * generation moves.
+ */
+export interface NodeIdsNamesTableApi {
+  exportBodyNameTable(): BodyNameTable;
+  exportFrameTable(): FrameNameTable;
+}
+
+function checkNameTable<T extends PackedNameTable>(out: T, name: string): T {
+  invariant(out && typeof out === "object", `Expected ${name}() to return an object`);
+  invariant(typeof out.generation === "number", `Expected ${name}().generation to be a number`);
+  invariant(out.codes instanceof Int32Array, `Expected ${name}().codes to be an Int32Array`);
+  invariant(
+    out.names?.offsets instanceof Int32Array &&
+      out.names.offsets.length === out.codes.length + 1 &&
+      out.names.bytes instanceof Uint8Array,
+    `Expected ${name}().names to be { offsets: Int32Array (codes + 1), bytes: Uint8Array }`,
+  );
+  return out;
+}
 
 /** Create an {@link IdsNamesApi} implementation backed by the native Node addon. */
-export function createIdsNamesApi(native: NativeAddon): IdsNamesApi {
+export function createIdsNamesApi(
+  native: NativeAddon,
+): IdsNamesApi & NodeIdsNamesInternApi & NodeIdsNamesTableApi {
   return {
     bodn2c: (name) => {
       const out = native.bodn2c(name);
@@ -39,8 +98,35 @@ export function createIdsNamesApi(native: NativeAddon): IdsNamesApi {
       return { found: true, code: out.code };
     },
 
+    internBody: (name) => {
+      const code = native.internBody(name);
+      invariant(typeof code === "number", "Expected internBody() to return a number");
+      return code;
+    },
+
+    internFrame: (name) => {
+      const code = native.internFrame(name);
+      invariant(typeof code === "number", "Expected internFrame() to return a number");
+      return code;
+    },
+
+    exportBodyNameTable: () => {
+      const out = checkNameTable(native.exportBodyNameTable(), "exportBodyNameTable");
+      invariant(
+        out.primary instanceof Uint8Array && out.primary.length === out.codes.length,
+        "Expected exportBodyNameTable().primary to be a Uint8Array of length codes.length",
+      );
+      return out;
+    },
+
+    exportFrameTable: () => checkNameTable(native.exportFrameTable(), "exportFrameTable"),
+
     boddef: (name, code) => {
-      native.boddef(name, code);
+      try {
+        native.boddef(name, code);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     bodfnd: (body, item) => {
@@ -5,9 +5,81 @@ import type {
 import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { publishKernelPoolChanges, subscribeKernelPoolChanges } from "../runtime/kernel-pool-changes.js";
+import type { KernelPoolChangeKind, KernelPoolChangeListener } from "../runtime/kernel-pool-changes.js";
+
+/**
+ * Packed result of {@link NodeKernelPoolSnapshotApi.poolSnapshot}.
+ *
+ * Variable `i` is `names[i]`, of type `types[i]` (`"N"` or `"C"`), with
+ * `count[i]` values starting at `start[i]`: `numbers[start[i] + j]` for
+ * numeric variables, and for character variables string `start[i] + j`, the
+ * ASCII text `strings.bytes.subarray(strings.offsets[k], strings.offsets[k + 1])`
+ * (trailing blanks trimmed, as in `gcpool`).
+ */
+export type KernelPoolSnapshot = {
+  names: string[];
+  types: string;
+  start: Int32Array;
+  count: Int32Array;
+  numbers: Float64Array;
+  strings: { offsets: Int32Array; bytes: Uint8Array };
+};
+
+/** Node-only bulk kernel-pool reads (not part of the backend contract). */
+export interface NodeKernelPoolSnapshotApi {
+  /**
+   * Every variable matching the `gnpool` template `pattern` (e.g.
+   * `"INS-98*"`), with all of its values, read under a single CSPICE lock
+   * instead of a `gnpool` / `dtpool` / `g*pool` round-trip per variable and
+   * page.
+   */
+  poolSnapshot(pattern: string): KernelPoolSnapshot;
+}
+
+/** Node-only in-memory text-kernel loading (not part of the backend contract). */
+export interface NodeKernelPoolLoadApi {
+  /**
+   * Assign every variable in the `\begindata` sections of the text kernel
+   * `bytes` (an FK, IK, PCK, LSK or SCLK kernel) straight into the kernel
+   * pool, and return how many variables were written.
+   *
+   * The kernel is parsed natively, without staging a file for `furnsh`, and
+   * written under a single CSPICE lock instead of one `p*pool` call per
+   * variable. `NAME += values` appends to what the pool already holds and
+   * `@` dates are converted as `furnsh` would (`tparse`). `name` only labels
+   * errors: malformed kernels throw before anything is written.
+   *
+   * Like `pdpool`, the variables are not tied to a loaded kernel: they are not
+   * listed by `ktotal` / `kdata` and `unload` does not remove them (`kclear`
+   * does). Meta-kernels are rejected; load those with `furnsh`.
+   */
+  loadTextKernelFromBuffer(name: string, bytes: Uint8Array): number;
+}
+
+/**
+ * Node-only kernel-pool change tracking (not part of the backend contract).
+ *
+ * The native addon keeps process-wide generation counters that every
+ * `furnsh` / `unload` / `kclear` / `p*pool` / `boddef` bumps. Reading them
+ * does not take the CSPICE lock, so caches can check for changes instead of
+ * polling `cvpool`.
+ */
+export interface NodeKernelPoolChangesApi {
+  /** Total generation, or the generation of one kind of change. */
+  kernelPoolGeneration(kind?: KernelPoolChangeKind): number;
+  /**
+   * Call `listener` after each mutating call made through any Node backend in
+   * this realm, with the kinds of change since the previous notification.
+   * Returns an unsubscribe function.
+   */
+  subscribeKernelPoolChanges(listener: KernelPoolChangeListener): () => void;
+}
 
 /** Create a {@link KernelPoolApi} implementation backed by the native Node addon. */
-export function createKernelPoolApi(native: NativeAddon): KernelPoolApi {
+export function createKernelPoolApi(
+  native: NativeAddon,
+): KernelPoolApi & NodeKernelPoolSnapshotApi & NodeKernelPoolLoadApi & NodeKernelPoolChangesApi {
   return {
     gdpool: (name, start, room) => {
       const out = native.gdpool(name, start, room);
@@ -59,16 +131,64 @@ export function createKernelPoolApi(native: NativeAddon): KernelPoolApi {
       return { found: true, n: out.n, type: t };
     },
 
+    poolSnapshot: (pattern) => {
+      const out = native.poolSnapshot(pattern);
+      invariant(Array.isArray(out.names), "Expected poolSnapshot().names to be an array");
+      const n = out.names.length;
+      invariant(
+        typeof out.types === "string" && out.types.length === n,
+        "Expected poolSnapshot().types to have one entry per name",
+      );
+      invariant(
+        out.start instanceof Int32Array && out.start.length === n,
+        "Expected poolSnapshot().start to be an Int32Array with one entry per name",
+      );
+      invariant(
+        out.count instanceof Int32Array && out.count.length === n,
+        "Expected poolSnapshot().count to be an Int32Array with one entry per name",
+      );
+      invariant(out.numbers instanceof Float64Array, "Expected poolSnapshot().numbers to be a Float64Array");
+      invariant(
+        out.strings.offsets instanceof Int32Array && out.strings.bytes instanceof Uint8Array,
+        "Expected poolSnapshot().strings to be { offsets: Int32Array, bytes: Uint8Array }",
+      );
+      return out;
+    },
+
     pdpool: (name, values) => {
-      native.pdpool(name, values);
+      try {
+        native.pdpool(name, values);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     pipool: (name, values) => {
-      native.pipool(name, values);
+      try {
+        native.pipool(name, values);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     pcpool: (name, values) => {
-      native.pcpool(name, values);
+      try {
+        native.pcpool(name, values);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
+    },
+
+    loadTextKernelFromBuffer: (name, bytes) => {
+      invariant(typeof name === "string", "loadTextKernelFromBuffer(name): expected a string");
+      invariant(bytes instanceof Uint8Array, "loadTextKernelFromBuffer(bytes): expected a Uint8Array");
+      try {
+        const count = native.loadTextKernelFromBuffer(name, bytes);
+        invariant(typeof count === "number", "Expected loadTextKernelFromBuffer() to return a number");
+        return count;
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     swpool: (agent, names) => {
@@ -86,5 +206,13 @@ export function createKernelPoolApi(native: NativeAddon): KernelPoolApi {
       invariant(typeof out === "boolean", "Expected expool() to return a boolean");
       return out;
     },
-  } satisfies KernelPoolApi;
+
+    kernelPoolGeneration: (kind) => {
+      const generation = native.kernelPoolGeneration(kind);
+      invariant(typeof generation === "number", "Expected kernelPoolGeneration() to return a number");
+      return generation;
+    },
+
+    subscribeKernelPoolChanges: (listener) => subscribeKernelPoolChanges(native, listener),
+  } satisfies KernelPoolApi & NodeKernelPoolSnapshotApi & NodeKernelPoolLoadApi & NodeKernelPoolChangesApi;
 }
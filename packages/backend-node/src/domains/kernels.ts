@@ -14,10 +14,75 @@ import {
 import { invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
+import { publishKernelPoolChanges } from "../runtime/kernel-pool-changes.js";
 import type { KernelStager } from "../runtime/kernel-staging.js";
 
+/**
+ * Node-only kernel-set snapshots (not part of the backend contract).
+ *
+ * `kernelSetSnapshot()` serializes every kernel-pool variable plus the paths
+ * of the loaded binary kernels (SPK, CK, PCK, DSK, EK) into a compact buffer;
+ * `kernelSetRestore(snapshot)` replaces the current kernel set with it in one
+ * native call, inserting the variables directly (no text-kernel parsing) and
+ * re-`furnsh`ing the binary kernels by path. Restored text-kernel data is
+ * pool-defined, so `ktotal("TEXT")` / `kdata` no longer list those files, and
+ * `boddef` mappings are not included.
+ *
+ * Binary kernels must be loaded from OS paths that the restoring process can
+ * open; byte-backed binary kernels are rejected at snapshot time. Snapshots
+ * are only portable between hosts with the same byte order.
+ */
+export interface NodeKernelSetApi {
+  kernelSetSnapshot(): Uint8Array;
+  kernelSetRestore(snapshot: Uint8Array): void;
+}
+
+/** Counters reported by {@link NodeLazyKernelApi.lazyKernelStats}. */
+export type LazyKernelStats = {
+  /** Registered files. */
+  registered: number;
+  /** Registered files currently open in CSPICE. */
+  open: number;
+  /** Maximum number of registered files kept open. */
+  budget: number;
+  /** Lazy opens / LRU closes since the process started. */
+  opens: number;
+  closes: number;
+};
+
+/**
+ * Node-only lazy SPK loading (not part of the backend contract).
+ *
+ * `registerLazyKernel(path)` reads an SPK's segment summaries once and leaves
+ * the file closed. The ephemeris entrypoints (`spkezr`, `spkpos`, `spkez`,
+ * `spkgeo`, ... and their `*Id` / `*Into` / batch variants) open the
+ * registered files their target, observer and segment centers need at the
+ * requested epochs, and close the least-recently-used ones beyond
+ * `setLazyKernelBudget(maxOpen)` (default 64), so open files scale with the
+ * working set rather than the catalog.
+ *
+ * Lazily opened files take priority over everything loaded before them, so
+ * registered files should not overlap each other or eagerly loaded kernels
+ * for the same body and time. Other SPK readers (geometry, GF searches) only
+ * see the files that happen to be open. `unload(path)` unregisters a file;
+ * `kclear()` drops every registration. The registry and budget are
+ * process-wide.
+ */
+export interface NodeLazyKernelApi {
+  registerLazyKernel(path: string): void;
+  /** Returns `false` if `path` was not registered. */
+  unregisterLazyKernel(path: string): boolean;
+  setLazyKernelBudget(maxOpen: number): void;
+  lazyKernelStats(): LazyKernelStats;
+}
+
+const BINARY_KERNEL_KINDS = "SPK CK PCK DSK EK";
+
 /** Create a {@link KernelsApi} implementation backed by the native Node addon + kernel staging. */
-export function createKernelsApi(native: NativeAddon, stager: KernelStager): KernelsApi {
+export function createKernelsApi(
+  native: NativeAddon,
+  stager: KernelStager,
+): KernelsApi & NodeKernelSetApi & NodeLazyKernelApi {
   const kernelKindProbeFromNative = (result: { file?: unknown; filtyp?: unknown }) => {
     invariant(typeof result.file === "string", "Expected kdata().file to be a string");
     invariant(typeof result.filtyp === "string", "Expected kdata().filtyp to be a string");
@@ -48,15 +113,88 @@ export function createKernelsApi(native: NativeAddon, stager: KernelStager): Ker
 
   return {
     furnsh: (kernel: KernelSource) => {
-      stager.furnsh(kernel, native);
+      try {
+        stager.furnsh(kernel, native);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     unload: (path: string) => {
-      stager.unload(path, native);
+      try {
+        stager.unload(path, native);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
     },
 
     kclear: () => {
-      stager.kclear(native);
+      try {
+        stager.kclear(native);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
+    },
+
+    kernelSetSnapshot: () => {
+      const count = native.ktotal(BINARY_KERNEL_KINDS);
+      for (let i = 0; i < count; i++) {
+        const entry = native.kdata(i, BINARY_KERNEL_KINDS);
+        if (!entry.found || typeof entry.file !== "string") continue;
+        const virtual = stager.virtualizePathFromSpice(entry.file);
+        if (virtual !== entry.file) {
+          throw new Error(
+            `kernelSetSnapshot(): byte-backed binary kernel ${virtual} cannot be snapshotted; load it from an OS path`,
+          );
+        }
+      }
+
+      const snapshot = native.kernelSetSnapshot();
+      invariant(snapshot instanceof Uint8Array, "Expected kernelSetSnapshot() to return a Uint8Array");
+      return snapshot;
+    },
+
+    kernelSetRestore: (snapshot: Uint8Array) => {
+      if (!(snapshot instanceof Uint8Array)) {
+        throw new TypeError("kernelSetRestore(snapshot): expected a Uint8Array");
+      }
+      try {
+        // Drop staged kernels first so the stager's bookkeeping matches the native kclear.
+        stager.kclear(native);
+        native.kernelSetRestore(snapshot);
+      } finally {
+        publishKernelPoolChanges(native);
+      }
+    },
+
+    registerLazyKernel: (path: string) => {
+      try {
+        native.registerLazyKernel(stager.resolvePathForSpice(path));
+      } finally {
+        publishKernelPoolChanges(native);
+      }
+    },
+
+    unregisterLazyKernel: (path: string) => {
+      try {
+        const found = native.unregisterLazyKernel(stager.resolvePathForSpice(path));
+        invariant(typeof found === "boolean", "Expected unregisterLazyKernel() to return a boolean");
+        return found;
+      } finally {
+        publishKernelPoolChanges(native);
+      }
+    },
+
+    setLazyKernelBudget: (maxOpen: number) => {
+      native.setLazyKernelBudget(maxOpen);
+    },
+
+    lazyKernelStats: () => {
+      const stats = native.lazyKernelStats();
+      for (const key of ["registered", "open", "budget", "opens", "closes"] as const) {
+        invariant(typeof stats[key] === "number", `Expected lazyKernelStats().${key} to be a number`);
+      }
+      return stats;
     },
 
     kinfo: (path: string) => {
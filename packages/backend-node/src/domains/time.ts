@@ -1,10 +1,93 @@
 import type { TimeApi } from "@rybosome/tspice-backend-contract";
+import { assertSpiceInt32 } from "@rybosome/tspice-backend-contract";
 import { assertNever, invariant } from "@rybosome/tspice-core";
 
 import type { NativeAddon } from "../runtime/addon.js";
 
+/**
+ * Packed result of {@link NodeTimeBatchApi.et2utcBatch}: string `i` is the
+ * ASCII text `bytes.subarray(offsets[i], offsets[i + 1])`.
+ */
+export type Et2utcBatchResult = {
+  offsets: Int32Array;
+  bytes: Uint8Array;
+};
+
+/**
+ * Node-only batched time conversion (not part of the backend contract).
+ *
+ * Strict ISO-8601 UTC input (`YYYY-MM-DD[THH:MM:SS[.fff]]` /
+ * `YYYY-DDD[THH:MM:SS[.fff]]`) and `"C"` / `"D"` / `"ISOC"` / `"ISOD"` output
+ * with `prec <= 6` are converted natively from the loaded LSK's leap-second
+ * table; anything else (other syntaxes, epochs near a leap second, non-default
+ * `timdef` settings) falls back to `str2et` / `et2utc` per element. Throws on
+ * the first element CSPICE rejects.
+ */
+export interface NodeTimeBatchApi {
+  str2etBatch(times: readonly string[]): Float64Array;
+  et2utcBatch(ets: Float64Array, format: string, prec: number): Et2utcBatchResult;
+  /**
+   * `deltet` / `unitim` at every epoch in `epochs`. Like the scalar calls,
+   * these read an immutable snapshot of the loaded LSK without taking the
+   * CSPICE lock; only epochs within a couple of seconds of a leap second (or
+   * before 1972) go through CSPICE.
+   */
+  deltetBatch(epochs: Float64Array, eptype: "ET" | "UTC"): Float64Array;
+  unitimBatch(epochs: Float64Array, insys: string, outsys: string): Float64Array;
+}
+
+/**
+ * Packed result of {@link NodeSclkBatchApi.sce2sBatch} /
+ * {@link NodeSclkBatchApi.scdecdBatch}, laid out like {@link Et2utcBatchResult}.
+ */
+export type SclkStringBatchResult = {
+  offsets: Int32Array;
+  bytes: Uint8Array;
+};
+
+/**
+ * Node-only batched SCLK conversion (not part of the backend contract).
+ *
+ * Same as the scalar `scs2e` / `sce2s` / `scencd` / `scdecd` / `sct2e` /
+ * `sce2c` for one spacecraft over every element, under a single native call.
+ * For type 1 clocks, ticks <-> ET is computed natively from the SCLK kernel's
+ * coefficient table (cached per spacecraft until the next kernel or pool
+ * change); values outside the table and SCLK string parsing and formatting go
+ * through CSPICE. Throws on the first element CSPICE rejects, with its `index`.
+ */
+export interface NodeSclkBatchApi {
+  scs2eBatch(sc: number, sclkchs: readonly string[]): Float64Array;
+  sce2sBatch(sc: number, ets: Float64Array): SclkStringBatchResult;
+  scencdBatch(sc: number, sclkchs: readonly string[]): Float64Array;
+  scdecdBatch(sc: number, sclkdps: Float64Array): SclkStringBatchResult;
+  sct2eBatch(sc: number, sclkdps: Float64Array): Float64Array;
+  sce2cBatch(sc: number, ets: Float64Array): Float64Array;
+}
+
+function checkSclkNumbers(out: unknown, n: number, name: string): Float64Array {
+  invariant(
+    out instanceof Float64Array && out.length === n,
+    `Expected ${name}() to return a Float64Array of length n`,
+  );
+  return out;
+}
+
+function checkSclkStrings(
+  out: { offsets: Int32Array; bytes: Uint8Array },
+  n: number,
+  name: string,
+): SclkStringBatchResult {
+  invariant(out && typeof out === "object", `Expected ${name}() to return an object`);
+  invariant(
+    out.offsets instanceof Int32Array && out.offsets.length === n + 1,
+    `Expected ${name}().offsets to be an Int32Array of length n+1`,
+  );
+  invariant(out.bytes instanceof Uint8Array, `Expected ${name}().bytes to be a Uint8Array`);
+  return { offsets: out.offsets, bytes: out.bytes };
+}
+
 /** Create a {@link TimeApi} implementation backed by the native Node addon. */
-export function createTimeApi(native: NativeAddon): TimeApi {
+export function createTimeApi(native: NativeAddon): TimeApi & NodeTimeBatchApi & NodeSclkBatchApi {
   function timdef(action: "GET", item: string): string;
   function timdef(action: "SET", item: string, value: string): void;
   function timdef(action: "GET" | "SET", item: string, value?: string): string | void {
@@ -53,6 +136,47 @@ export function createTimeApi(native: NativeAddon): TimeApi {
     et2utc: (et, format, prec) => {
       return native.et2utc(et, format, prec);
     },
+
+    str2etBatch: (times) => {
+      invariant(Array.isArray(times), "str2etBatch(times): expected an array of strings");
+      const ets = native.str2etBatch(times);
+      invariant(
+        ets instanceof Float64Array && ets.length === times.length,
+        "Expected str2etBatch() to return a Float64Array of length n",
+      );
+      return ets;
+    },
+    et2utcBatch: (ets, format, prec) => {
+      invariant(ets instanceof Float64Array, "et2utcBatch(ets): expected a Float64Array");
+      assertSpiceInt32(prec, "et2utcBatch(prec)");
+      const out = native.et2utcBatch(ets, format, prec);
+      invariant(out && typeof out === "object", "Expected et2utcBatch() to return an object");
+      invariant(
+        out.offsets instanceof Int32Array && out.offsets.length === ets.length + 1,
+        "Expected et2utcBatch().offsets to be an Int32Array of length n+1",
+      );
+      invariant(out.bytes instanceof Uint8Array, "Expected et2utcBatch().bytes to be a Uint8Array");
+      return { offsets: out.offsets, bytes: out.bytes };
+    },
+    deltetBatch: (epochs, eptype) => {
+      invariant(epochs instanceof Float64Array, "deltetBatch(epochs): expected a Float64Array");
+      invariant(eptype === "ET" || eptype === "UTC", `Unsupported deltet eptype: ${eptype}`);
+      const out = native.deltetBatch(epochs, eptype);
+      invariant(
+        out instanceof Float64Array && out.length === epochs.length,
+        "Expected deltetBatch() to return a Float64Array of length n",
+      );
+      return out;
+    },
+    unitimBatch: (epochs, insys, outsys) => {
+      invariant(epochs instanceof Float64Array, "unitimBatch(epochs): expected a Float64Array");
+      const out = native.unitimBatch(epochs, insys, outsys);
+      invariant(
+        out instanceof Float64Array && out.length === epochs.length,
+        "Expected unitimBatch() to return a Float64Array of length n",
+      );
+      return out;
+    },
     timout: (et, picture) => {
       return native.timout(et, picture);
     },
@@ -128,5 +252,41 @@ export function createTimeApi(native: NativeAddon): TimeApi {
       invariant(typeof out === "number", "Expected sce2c() to return a number");
       return out;
     },
+
+    scs2eBatch: (sc, sclkchs) => {
+      assertSpiceInt32(sc, "scs2eBatch(sc)");
+      invariant(Array.isArray(sclkchs), "scs2eBatch(sclkchs): expected an array of strings");
+      return checkSclkNumbers(native.scs2eBatch(sc, sclkchs), sclkchs.length, "scs2eBatch");
+    },
+
+    sce2sBatch: (sc, ets) => {
+      assertSpiceInt32(sc, "sce2sBatch(sc)");
+      invariant(ets instanceof Float64Array, "sce2sBatch(ets): expected a Float64Array");
+      return checkSclkStrings(native.sce2sBatch(sc, ets), ets.length, "sce2sBatch");
+    },
+
+    scencdBatch: (sc, sclkchs) => {
+      assertSpiceInt32(sc, "scencdBatch(sc)");
+      invariant(Array.isArray(sclkchs), "scencdBatch(sclkchs): expected an array of strings");
+      return checkSclkNumbers(native.scencdBatch(sc, sclkchs), sclkchs.length, "scencdBatch");
+    },
+
+    scdecdBatch: (sc, sclkdps) => {
+      assertSpiceInt32(sc, "scdecdBatch(sc)");
+      invariant(sclkdps instanceof Float64Array, "scdecdBatch(sclkdps): expected a Float64Array");
+      return checkSclkStrings(native.scdecdBatch(sc, sclkdps), sclkdps.length, "scdecdBatch");
+    },
+
+    sct2eBatch: (sc, sclkdps) => {
+      assertSpiceInt32(sc, "sct2eBatch(sc)");
+      invariant(sclkdps instanceof Float64Array, "sct2eBatch(sclkdps): expected a Float64Array");
+      return checkSclkNumbers(native.sct2eBatch(sc, sclkdps), sclkdps.length, "sct2eBatch");
+    },
+
+    sce2cBatch: (sc, ets) => {
+      assertSpiceInt32(sc, "sce2cBatch(sc)");
+      invariant(ets instanceof Float64Array, "sce2cBatch(ets): expected a Float64Array");
+      return checkSclkNumbers(native.sce2cBatch(sc, ets), ets.length, "sce2cBatch");
+    },
   };
 }
@@ -9,19 +9,226 @@ import { createVirtualOutputStager } from "./runtime/virtual-output-staging.js";
 import { createSpiceHandleRegistry } from "./runtime/spice-handles.js";
 
 import { createCoordsVectorsApi } from "./domains/coords-vectors.js";
+import type { NodeCoordsVectorsBatchApi, NodeCoordsVectorsIntoApi } from "./domains/coords-vectors.js";
 import { createEphemerisApi } from "./domains/ephemeris.js";
+import type {
+  NodeEphemerisBatchApi,
+  NodeEphemerisCachedApi,
+  NodeEphemerisCoverageApi,
+  NodeEphemerisIdApi,
+  NodeEphemerisIntoApi,
+  NodeEphemerisSpkStreamApi,
+  NodeEphemerisSubsetApi,
+  NodeEphemerisTableApi,
+  NodeEphemerisTryApi,
+} from "./domains/ephemeris.js";
 import { createFramesApi } from "./domains/frames.js";
+import type {
+  NodeFramesCacheApi,
+  NodeFramesCkBatchApi,
+  NodeFramesIdApi,
+  NodeFramesIntoApi,
+  NodeFramesTransformApi,
+  NodeFramesTryApi,
+} from "./domains/frames.js";
+import type {
+  NodeFileIoDafApi,
+  NodeFileIoDskWriteApi,
+  NodeFileIoInventoryApi,
+  NodeFileIoOutputApi,
+} from "./domains/file-io.js";
 import { createGeometryApi } from "./domains/geometry.js";
+import type { NodeGeometryBatchApi } from "./domains/geometry.js";
 import { createGeometryGfApi } from "./domains/geometry-gf.js";
+import type { NodeGeometryGfAsyncApi, NodeGeometryGfPackedApi } from "./domains/geometry-gf.js";
 import { createIdsNamesApi } from "./domains/ids-names.js";
+import type { NodeIdsNamesInternApi, NodeIdsNamesTableApi } from "./domains/ids-names.js";
 import { createKernelsApi } from "./domains/kernels.js";
+import type { NodeKernelSetApi, NodeLazyKernelApi } from "./domains/kernels.js";
 import { createKernelPoolApi } from "./domains/kernel-pool.js";
+import type {
+  NodeKernelPoolChangesApi,
+  NodeKernelPoolLoadApi,
+  NodeKernelPoolSnapshotApi,
+} from "./domains/kernel-pool.js";
 import { createTimeApi } from "./domains/time.js";
+import type { NodeSclkBatchApi, NodeTimeBatchApi } from "./domains/time.js";
 import { createFileIoApi } from "./domains/file-io.js";
 import { createErrorApi } from "./domains/error.js";
+import type { NodeErrorStatusApi } from "./domains/error.js";
 import { createCellsWindowsApi } from "./domains/cells-windows.js";
+import type {
+  ManagedSpiceHandle,
+  NodeCellsWindowsAlgebraApi,
+  NodeCellsWindowsBulkApi,
+  NodeCellsWindowsManagedApi,
+  NodeCellsWindowsManagedApi,
+} from "./domains/cells-windows.js";
 import { createDskApi } from "./domains/dsk.js";
+import type { NodeDskIndexApi } from "./domains/dsk.js";
 import { createEkApi } from "./domains/ek.js";
+import type { NodeEkColumnarApi } from "./domains/ek.js";
+
+export type {
+  NodeEphemerisBatchApi,
+  NodeEphemerisCachedApi,
+  NodeEphemerisCoverageApi,
+  NodeEphemerisIdApi,
+  NodeEphemerisIntoApi,
+  NodeEphemerisSpkStreamApi,
+  NodeEphemerisSubsetApi,
+  NodeEphemerisTableApi,
+  NodeEphemerisTryApi,
+  NodeSpkSegmentStream,
+  SpkSegmentStreamOptions,
+  SpkSubsetOptions,
+  SpkEvaluatorStats,
+  SpkezrBatchResult,
+  SpkposBatchResult,
+} from "./domains/ephemeris.js";
+export type {
+  CkgpavBatchResult,
+  CkgpBatchResult,
+  FrameCacheStats,
+  NodeFramesCacheApi,
+  NodeFramesCkBatchApi,
+  NodeFramesIdApi,
+  NodeFramesIntoApi,
+  NodeFramesTransformApi,
+  NodeFramesTryApi,
+} from "./domains/frames.js";
+export type { NodeErrorStatusApi, SpiceCallStatus, SpiceErrorParts } from "./domains/error.js";
+export type {
+  IllumfBatchResult,
+  IluminBatchResult,
+  NodeGeometryBatchApi,
+  OccultBatchResult,
+  OccultTriple,
+  SincptBatchResult,
+} from "./domains/geometry.js";
+export type { DskRaycastBatchResult, NodeDskIndexApi, NodeDskPlateIndex } from "./domains/dsk.js";
+export type {
+  BodyNameTable,
+  FrameNameTable,
+  NodeIdsNamesInternApi,
+  NodeIdsNamesTableApi,
+} from "./domains/ids-names.js";
+export type { LazyKernelStats, NodeKernelSetApi, NodeLazyKernelApi } from "./domains/kernels.js";
+export type {
+  KernelPoolSnapshot,
+  NodeKernelPoolChangesApi,
+  NodeKernelPoolLoadApi,
+  NodeKernelPoolSnapshotApi,
+} from "./domains/kernel-pool.js";
+export type {
+  KernelPoolChangeEvent,
+  KernelPoolChangeKind,
+  KernelPoolChangeListener,
+} from "./runtime/kernel-pool-changes.js";
+export type {
+  NativeExportStats,
+  NativeLatencyHistogram,
+  NativeMemoryKindStats,
+  NativeMemoryStats,
+  NativeStats,
+} from "./runtime/native-stats.js";
+export { getNativeStats, resetNativeStats } from "./runtime/native-stats.js";
+export { takeNativeTrace } from "./runtime/native-trace.js";
+export type { QueryCacheStats } from "./runtime/query-cache.js";
+export { getQueryCacheStats, setQueryCacheCapacity } from "./runtime/query-cache.js";
+export type { Et2utcBatchResult, NodeSclkBatchApi, NodeTimeBatchApi, SclkStringBatchResult } from "./domains/time.js";
+export type { NodeCoordsVectorsBatchApi, NodeCoordsVectorsIntoApi } from "./domains/coords-vectors.js";
+export type { NodeGeometryGfAsyncApi, NodeGeometryGfPackedApi } from "./domains/geometry-gf.js";
+export type { NodeCallOptions } from "./runtime/cancellation.js";
+export type {
+  DafSummariesResult,
+  DlaDescriptorsResult,
+  DskType2WriteOptions,
+  NodeFileIoDafApi,
+  NodeFileIoDskWriteApi,
+  NodeFileIoInventoryApi,
+  NodeFileIoOutputApi,
+} from "./domains/file-io.js";
+export { setVirtualOutputStagingDir } from "./runtime/virtual-output-staging.js";
+export type {
+  NodeCellsWindowsAlgebraApi,
+  NodeCellsWindowsBulkApi,
+  WindowOperand,
+} from "./domains/cells-windows.js";
+export type {
+  EkColumnarColumn,
+  EkCursorBatch,
+  EkCursorBatchColumn,
+  EkCursorColumnInfo,
+  EkQueryColumnarResult,
+  EkQueryCursorOptions,
+  EkSegmentColumn,
+  EkSegmentColumnSchema,
+  NodeEkColumnarApi,
+  NodeEkCursor,
+} from "./domains/ek.js";
+
+export type {
+  CreateNodeBackendPoolOptions,
+  GfPartitionedOptions,
+  NodeBackendPool,
+  NodeBackendPoolDispatch,
+  NodeBackendPoolResult,
+} from "./pool/createNodeBackendPool.js";
+export { createNodeBackendPool } from "./pool/createNodeBackendPool.js";
+export type { GfPartitionedOp } from "./pool/partition-gf.js";
+export type {
+  NodeBackendPoolBroadcastOp,
+  NodeBackendPoolOp,
+  NodeBackendPoolReadOp,
+} from "./pool/ops.js";
+
+/**
+ * Node backend: the shared {@link SpiceBackend} contract plus Node-only native
+ * extensions (batched/typed-array entrypoints that have no WASM/fake equivalent).
+ */
+export type NodeSpiceBackend = SpiceBackend &
+  NodeEphemerisBatchApi &
+  NodeEphemerisIntoApi &
+  NodeEphemerisTryApi &
+  NodeEphemerisIdApi &
+  NodeEphemerisCachedApi &
+  NodeEphemerisSpkStreamApi &
+  NodeEphemerisSubsetApi &
+  NodeEphemerisCoverageApi &
+  NodeEphemerisTableApi &
+  NodeFramesIntoApi &
+  NodeFramesTryApi &
+  NodeFramesCacheApi &
+  NodeFramesCkBatchApi &
+  NodeFramesIdApi &
+  NodeFramesTransformApi &
+  NodeErrorStatusApi &
+  NodeCoordsVectorsIntoApi &
+  NodeCoordsVectorsBatchApi &
+  NodeGeometryBatchApi &
+  NodeGeometryGfAsyncApi &
+  NodeGeometryGfPackedApi &
+  NodeIdsNamesInternApi &
+  NodeIdsNamesTableApi &
+  NodeKernelSetApi &
+  NodeLazyKernelApi &
+  NodeKernelPoolSnapshotApi &
+  NodeKernelPoolLoadApi &
+  NodeKernelPoolChangesApi &
+  NodeTimeBatchApi &
+  NodeSclkBatchApi &
+  NodeEkColumnarApi &
+  NodeCellsWindowsBulkApi &
+  NodeCellsWindowsAlgebraApi &
+  NodeCellsWindowsManagedApi &
+  NodeDskIndexApi &
+  NodeFileIoDafApi &
+  NodeFileIoDskWriteApi &
+  NodeFileIoInventoryApi &
+  NodeFileIoOutputApi & {
+    kind: "node";
+  };
 
 /** Return the SPICE toolkit version exposed by the native Node addon. */
 export function spiceVersion(): string {
@@ -30,14 +237,52 @@ export function spiceVersion(): string {
   return version;
 }
 
+/**
+ * Route the Node-only async entrypoints (e.g. `gfsepAsync`) through a single
+ * native executor thread that owns CSPICE, fed by a lock-free FIFO queue.
+ *
+ * Process-wide and off by default, in which case async work runs on the libuv
+ * threadpool. Synchronous calls are unaffected.
+ */
+export function setCspiceExecutorEnabled(enabled: boolean): void {
+  invariant(typeof enabled === "boolean", "setCspiceExecutorEnabled(enabled): expected a boolean");
+  getNodeBinding().setCspiceExecutorEnabled(enabled);
+}
+
+/** Whether {@link setCspiceExecutorEnabled} is currently on. */
+export function isCspiceExecutorEnabled(): boolean {
+  const enabled = getNodeBinding().isCspiceExecutorEnabled();
+  invariant(typeof enabled === "boolean", "Expected native isCspiceExecutorEnabled() to return a boolean");
+  return enabled;
+}
+
+/**
+ * Serve `dafgda()` reads from read-only memory maps of the underlying files.
+ *
+ * Process-wide and off by default. Applies to DAFs opened with `dafopr()` whose
+ * binary format matches the host; others keep reading through CSPICE.
+ * Disabling unmaps all files.
+ */
+export function setDafMmapEnabled(enabled: boolean): void {
+  invariant(typeof enabled === "boolean", "setDafMmapEnabled(enabled): expected a boolean");
+  getNodeBinding().setDafMmapEnabled(enabled);
+}
+
+/** Whether {@link setDafMmapEnabled} is currently on (always `false` where mmap is unavailable). */
+export function isDafMmapEnabled(): boolean {
+  const enabled = getNodeBinding().isDafMmapEnabled();
+  invariant(typeof enabled === "boolean", "Expected native isDafMmapEnabled() to return a boolean");
+  return enabled;
+}
+
 /** Create a {@link SpiceBackend} implementation backed by the native Node addon. */
-export function createNodeBackend(): SpiceBackend & { kind: "node" } {
+export function createNodeBackend(): NodeSpiceBackend {
   const native = getNodeBinding();
   const stager = createKernelStager();
   const spiceHandles = createSpiceHandleRegistry();
-  const outputs = createVirtualOutputStager();
+  const outputs = createVirtualOutputStager({ mapFile: (path) => native.mapOutputFile(path) });
 
-  const backend: SpiceBackend & { kind: "node" } = {
+  const backend: NodeSpiceBackend = {
     kind: "node",
     ...createTimeApi(native),
     ...createKernelsApi(native, stager),
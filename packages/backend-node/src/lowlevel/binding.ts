@@ -12,6 +12,27 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.furnsh === "function", "Expected native addon to export furnsh(path)");
   invariant(typeof native.unload === "function", "Expected native addon to export unload(path)");
   invariant(typeof native.kclear === "function", "Expected native addon to export kclear()");
+  invariant(typeof native.kernelSetSnapshot === "function", "Expected native addon to export kernelSetSnapshot()");
+  invariant(typeof native.kernelSetRestore === "function", "Expected native addon to export kernelSetRestore(snapshot)");
+  invariant(typeof native.registerLazyKernel === "function", "Expected native addon to export registerLazyKernel(path)");
+  invariant(
+    typeof native.unregisterLazyKernel === "function",
+    "Expected native addon to export unregisterLazyKernel(path)",
+  );
+  invariant(
+    typeof native.setLazyKernelBudget === "function",
+    "Expected native addon to export setLazyKernelBudget(maxOpen)",
+  );
+  invariant(typeof native.lazyKernelStats === "function", "Expected native addon to export lazyKernelStats()");
+  invariant(
+    typeof native.kernelBuffersSupported === "function",
+    "Expected native addon to export kernelBuffersSupported()",
+  );
+  invariant(typeof native.furnshBuffer === "function", "Expected native addon to export furnshBuffer(name, bytes)");
+  invariant(
+    typeof native.releaseKernelBuffer === "function",
+    "Expected native addon to export releaseKernelBuffer(path)",
+  );
   invariant(typeof native.ktotal === "function", "Expected native addon to export ktotal(kind?)");
   invariant(typeof native.kdata === "function", "Expected native addon to export kdata(which, kind?)");
 
@@ -20,14 +41,29 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.gcpool === "function", "Expected native addon to export gcpool(name, start, room)");
   invariant(typeof native.gnpool === "function", "Expected native addon to export gnpool(template, start, room)");
   invariant(typeof native.dtpool === "function", "Expected native addon to export dtpool(name)");
+  invariant(typeof native.poolSnapshot === "function", "Expected native addon to export poolSnapshot(pattern)");
   invariant(typeof native.pdpool === "function", "Expected native addon to export pdpool(name, values)");
   invariant(typeof native.pipool === "function", "Expected native addon to export pipool(name, values)");
   invariant(typeof native.pcpool === "function", "Expected native addon to export pcpool(name, values)");
+  invariant(
+    typeof native.loadTextKernelFromBuffer === "function",
+    "Expected native addon to export loadTextKernelFromBuffer(name, bytes)",
+  );
   invariant(typeof native.swpool === "function", "Expected native addon to export swpool(agent, names)");
   invariant(typeof native.cvpool === "function", "Expected native addon to export cvpool(agent)");
   invariant(typeof native.expool === "function", "Expected native addon to export expool(name)");
   invariant(typeof native.str2et === "function", "Expected native addon to export str2et(time)");
   invariant(typeof native.et2utc === "function", "Expected native addon to export et2utc(et, format, prec)");
+  invariant(typeof native.str2etBatch === "function", "Expected native addon to export str2etBatch(times)");
+  invariant(
+    typeof native.et2utcBatch === "function",
+    "Expected native addon to export et2utcBatch(ets, format, prec)",
+  );
+  invariant(typeof native.deltetBatch === "function", "Expected native addon to export deltetBatch(epochs, eptype)");
+  invariant(
+    typeof native.unitimBatch === "function",
+    "Expected native addon to export unitimBatch(epochs, insys, outsys)",
+  );
   invariant(typeof native.timout === "function", "Expected native addon to export timout(et, picture)");
   invariant(typeof native.deltet === "function", "Expected native addon to export deltet(epoch, eptype)");
   invariant(typeof native.unitim === "function", "Expected native addon to export unitim(epoch, insys, outsys)");
@@ -42,6 +78,7 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.sigerr === "function", "Expected native addon to export sigerr(short)");
   invariant(typeof native.chkin === "function", "Expected native addon to export chkin(name)");
   invariant(typeof native.chkout === "function", "Expected native addon to export chkout(name)");
+  invariant(typeof native.lastSpiceError === "function", "Expected native addon to export lastSpiceError()");
 
   invariant(typeof native.exists === "function", "Expected native addon to export exists(path)");
   invariant(typeof native.getfat === "function", "Expected native addon to export getfat(path)");
@@ -50,6 +87,14 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.dafcls === "function", "Expected native addon to export dafcls(handle)");
   invariant(typeof native.dafbfs === "function", "Expected native addon to export dafbfs(handle)");
   invariant(typeof native.daffna === "function", "Expected native addon to export daffna(handle)");
+  invariant(typeof native.dafgda === "function", "Expected native addon to export dafgda(handle, baddr, eaddr)");
+  invariant(typeof native.dafSummaries === "function", "Expected native addon to export dafSummaries(path)");
+  invariant(
+    typeof native.setDafMmapEnabled === "function",
+    "Expected native addon to export setDafMmapEnabled(enabled)",
+  );
+  invariant(typeof native.isDafMmapEnabled === "function", "Expected native addon to export isDafMmapEnabled()");
+  invariant(typeof native.mapOutputFile === "function", "Expected native addon to export mapOutputFile()");
 
   invariant(typeof native.dasopr === "function", "Expected native addon to export dasopr(path)");
   invariant(typeof native.dascls === "function", "Expected native addon to export dascls(handle)");
@@ -57,6 +102,7 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.dlaopn === "function", "Expected native addon to export dlaopn(path, ftype, ifname, ncomch)");
   invariant(typeof native.dlabfs === "function", "Expected native addon to export dlabfs(handle)");
   invariant(typeof native.dlafns === "function", "Expected native addon to export dlafns(handle, descr)");
+  invariant(typeof native.dlaDescriptors === "function", "Expected native addon to export dlaDescriptors(path)");
 
   // --- EK ---
   invariant(typeof native.ekopr === "function", "Expected native addon to export ekopr(path)");
@@ -70,6 +116,12 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.ekgc === "function", "Expected native addon to export ekgc(selidx, row, elment)");
   invariant(typeof native.ekgd === "function", "Expected native addon to export ekgd(selidx, row, elment)");
   invariant(typeof native.ekgi === "function", "Expected native addon to export ekgi(selidx, row, elment)");
+  invariant(typeof native.ekQueryColumnar === "function", "Expected native addon to export ekQueryColumnar(query)");
+  invariant(typeof native.ekCursorOpen === "function", "Expected native addon to export ekCursorOpen(query, batchRows)");
+  invariant(typeof native.ekCursorNext === "function", "Expected native addon to export ekCursorNext(cursor, reuse)");
+  invariant(typeof native.ekCursorReadAsync === "function", "Expected native addon to export ekCursorReadAsync(cursor)");
+  invariant(typeof native.ekCursorTake === "function", "Expected native addon to export ekCursorTake(cursor, reuse)");
+  invariant(typeof native.ekCursorClose === "function", "Expected native addon to export ekCursorClose(cursor)");
   invariant(
     typeof native.ekifld === "function",
     "Expected native addon to export ekifld(handle, tabnam, nrows, cnames, decls)",
@@ -87,21 +139,37 @@ export function getNodeBinding(): NativeAddon {
     "Expected native addon to export ekaclc(handle, segno, column, cvals, entszs, nlflgs, rcptrs)",
   );
   invariant(typeof native.ekffld === "function", "Expected native addon to export ekffld(handle, segno, rcptrs)");
+  invariant(
+    typeof native.ekWriteSegment === "function",
+    "Expected native addon to export ekWriteSegment(handle, tabnam, cnames, decls, columns)",
+  );
 
   // --- DSK writer ---
   invariant(typeof native.dskopn === "function", "Expected native addon to export dskopn(path, ifname, ncomch)");
   invariant(typeof native.dskmi2 === "function", "Expected native addon to export dskmi2(nv, vrtces, np, plates, finscl, corscl, worksz, voxpsz, voxlsz, makvtl, spxisz)");
   invariant(typeof native.dskw02 === "function", "Expected native addon to export dskw02(handle, center, surfid, dclass, frame, corsys, corpar, mncor1, mxcor1, mncor2, mxcor2, mncor3, mxcor3, first, last, nv, vrtces, np, plates, spaixd, spaixi)");
+  invariant(typeof native.dskWriteType2 === "function", "Expected native addon to export dskWriteType2(handle, center, surfid, dclass, frame, corsys, corpar, bounds, vertices, plates, finscl, corscl, worksz, voxpsz, voxlsz, makvtl, spxisz)");
 
   invariant(typeof native.dskobj === "function", "Expected native addon to export dskobj(dsk, bodids)");
   invariant(typeof native.dsksrf === "function", "Expected native addon to export dsksrf(dsk, bodyid, srfids)");
   invariant(typeof native.dskgd === "function", "Expected native addon to export dskgd(handle, dladsc)");
   invariant(typeof native.dskb02 === "function", "Expected native addon to export dskb02(handle, dladsc)");
+  invariant(
+    typeof native.dskx02 === "function",
+    "Expected native addon to export dskx02(handle, dladsc, vertex, raydir)",
+  );
+  invariant(typeof native.dskBvhBuild === "function", "Expected native addon to export dskBvhBuild(handle, dladsc)");
+  invariant(typeof native.dskBvhRaycast === "function", "Expected native addon to export dskBvhRaycast(index, vertices, raydirs, threads)");
+  invariant(typeof native.dskBvhFree === "function", "Expected native addon to export dskBvhFree(index)");
 
   invariant(typeof native.bodn2c === "function", "Expected native addon to export bodn2c(name)");
   invariant(typeof native.bodc2n === "function", "Expected native addon to export bodc2n(code)");
   invariant(typeof native.namfrm === "function", "Expected native addon to export namfrm(name)");
   invariant(typeof native.frmnam === "function", "Expected native addon to export frmnam(code)");
+  invariant(typeof native.internBody === "function", "Expected native addon to export internBody(name)");
+  invariant(typeof native.internFrame === "function", "Expected native addon to export internFrame(name)");
+  invariant(typeof native.exportBodyNameTable === "function", "Expected native addon to export exportBodyNameTable()");
+  invariant(typeof native.exportFrameTable === "function", "Expected native addon to export exportFrameTable()");
   invariant(typeof native.cidfrm === "function", "Expected native addon to export cidfrm(center)");
   invariant(typeof native.cnmfrm === "function", "Expected native addon to export cnmfrm(centerName)");
   invariant(typeof native.scs2e === "function", "Expected native addon to export scs2e(sc, sclkch)");
@@ -110,10 +178,50 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.scdecd === "function", "Expected native addon to export scdecd(sc, sclkdp)");
   invariant(typeof native.sct2e === "function", "Expected native addon to export sct2e(sc, sclkdp)");
   invariant(typeof native.sce2c === "function", "Expected native addon to export sce2c(sc, et)");
+  invariant(typeof native.scs2eBatch === "function", "Expected native addon to export scs2eBatch(sc, sclkchs)");
+  invariant(typeof native.sce2sBatch === "function", "Expected native addon to export sce2sBatch(sc, ets)");
+  invariant(typeof native.scencdBatch === "function", "Expected native addon to export scencdBatch(sc, sclkchs)");
+  invariant(typeof native.scdecdBatch === "function", "Expected native addon to export scdecdBatch(sc, sclkdps)");
+  invariant(typeof native.sct2eBatch === "function", "Expected native addon to export sct2eBatch(sc, sclkdps)");
+  invariant(typeof native.sce2cBatch === "function", "Expected native addon to export sce2cBatch(sc, ets)");
   invariant(typeof native.ckgp === "function", "Expected native addon to export ckgp(inst, sclkdp, tol, ref)");
   invariant(typeof native.ckgpav === "function", "Expected native addon to export ckgpav(inst, sclkdp, tol, ref)");
+  invariant(
+    typeof native.ckgpBatch === "function",
+    "Expected native addon to export ckgpBatch(inst, sclkdp, tol, ref)",
+  );
+  invariant(
+    typeof native.ckgpavBatch === "function",
+    "Expected native addon to export ckgpavBatch(inst, sclkdp, tol, ref)",
+  );
   invariant(typeof native.pxform === "function", "Expected native addon to export pxform(from, to, et)");
   invariant(typeof native.sxform === "function", "Expected native addon to export sxform(from, to, et)");
+  invariant(typeof native.pxformInto === "function", "Expected native addon to export pxformInto(from, to, et, out)");
+  invariant(typeof native.pxformId === "function", "Expected native addon to export pxformId(fromId, toId, et)");
+  invariant(
+    typeof native.pxformIdInto === "function",
+    "Expected native addon to export pxformIdInto(fromId, toId, et, out)",
+  );
+  invariant(typeof native.sxformInto === "function", "Expected native addon to export sxformInto(from, to, et, out)");
+  invariant(typeof native.frameCacheStats === "function", "Expected native addon to export frameCacheStats()");
+  invariant(typeof native.tryPxform === "function", "Expected native addon to export tryPxform(from, to, et)");
+  invariant(typeof native.trySxform === "function", "Expected native addon to export trySxform(from, to, et)");
+  invariant(
+    typeof native.pxformIntoStatus === "function",
+    "Expected native addon to export pxformIntoStatus(from, to, et, out)",
+  );
+  invariant(
+    typeof native.sxformIntoStatus === "function",
+    "Expected native addon to export sxformIntoStatus(from, to, et, out)",
+  );
+  invariant(
+    typeof native.transformVectors === "function",
+    "Expected native addon to export transformVectors(from, to, ets, vecs, out?)",
+  );
+  invariant(
+    typeof native.transformStates === "function",
+    "Expected native addon to export transformStates(from, to, ets, states, out?)",
+  );
   invariant(typeof native.reclat === "function", "Expected native addon to export reclat(rect)");
   invariant(typeof native.latrec === "function", "Expected native addon to export latrec(radius, lon, lat)");
   invariant(typeof native.recsph === "function", "Expected native addon to export recsph(rect)");
@@ -129,6 +237,18 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.vminus === "function", "Expected native addon to export vminus(v)");
   invariant(typeof native.vscl === "function", "Expected native addon to export vscl(s, v)");
   invariant(typeof native.mxm === "function", "Expected native addon to export mxm(a, b)");
+  invariant(typeof native.vcrssInto === "function", "Expected native addon to export vcrssInto(a, b, out)");
+  invariant(typeof native.vaddInto === "function", "Expected native addon to export vaddInto(a, b, out)");
+  invariant(typeof native.vsubInto === "function", "Expected native addon to export vsubInto(a, b, out)");
+  invariant(typeof native.mxvInto === "function", "Expected native addon to export mxvInto(m, v, out)");
+  invariant(typeof native.mtxvInto === "function", "Expected native addon to export mtxvInto(m, v, out)");
+  invariant(typeof native.mxmInto === "function", "Expected native addon to export mxmInto(a, b, out)");
+  for (const name of ["reclatBatch", "latrecBatch", "recsphBatch", "sphrecBatch"] as const) {
+    invariant(typeof native[name] === "function", `Expected native addon to export ${name}(input, out?)`);
+  }
+  for (const name of ["georecBatch", "recgeoBatch"] as const) {
+    invariant(typeof native[name] === "function", `Expected native addon to export ${name}(input, re, f, out?)`);
+  }
   invariant(typeof native.rotate === "function", "Expected native addon to export rotate(angle, axis)");
   invariant(typeof native.rotmat === "function", "Expected native addon to export rotmat(m, angle, axis)");
   invariant(typeof native.axisar === "function", "Expected native addon to export axisar(axis, angle)");
@@ -165,6 +285,25 @@ export function getNodeBinding(): NativeAddon {
   invariant(typeof native.wncard === "function", "Expected native addon to export wncard(window)");
   invariant(typeof native.wnfetd === "function", "Expected native addon to export wnfetd(window, index)");
   invariant(typeof native.wnvald === "function", "Expected native addon to export wnvald(size, n, window)");
+  invariant(typeof native.cellToTypedArray === "function", "Expected native addon to export cellToTypedArray(cell)");
+  invariant(
+    typeof native.cellFromTypedArray === "function",
+    "Expected native addon to export cellFromTypedArray(values, size)",
+  );
+  invariant(
+    typeof native.windowToFloat64Array === "function",
+    "Expected native addon to export windowToFloat64Array(window)",
+  );
+  invariant(
+    typeof native.windowFromFloat64Array === "function",
+    "Expected native addon to export windowFromFloat64Array(endpoints, maxIntervals)",
+  );
+  invariant(typeof native.wnunidPacked === "function", "Expected native addon to export wnunidPacked(a, b, out)");
+  invariant(typeof native.wnintdPacked === "function", "Expected native addon to export wnintdPacked(a, b, out)");
+  invariant(typeof native.wndifdPacked === "function", "Expected native addon to export wndifdPacked(a, b, out)");
+  invariant(typeof native.wnexpdPacked === "function", "Expected native addon to export wnexpdPacked(window, left, right, out)");
+  invariant(typeof native.wncondPacked === "function", "Expected native addon to export wncondPacked(window, left, right, out)");
+  invariant(typeof native.wnfltdPacked === "function", "Expected native addon to export wnfltdPacked(window, small, out)");
   invariant(
     typeof native.spkezr === "function",
     "Expected native addon to export spkezr(target, et, ref, abcorr, observer)",
@@ -173,10 +312,86 @@ export function getNodeBinding(): NativeAddon {
     typeof native.spkpos === "function",
     "Expected native addon to export spkpos(target, et, ref, abcorr, observer)",
   );
+  invariant(
+    typeof native.spkezrBatch === "function",
+    "Expected native addon to export spkezrBatch(target, ets, ref, abcorr, observer, options?)",
+  );
+  invariant(
+    typeof native.spkposBatch === "function",
+    "Expected native addon to export spkposBatch(target, ets, ref, abcorr, observer, options?)",
+  );
+  invariant(
+    typeof native.spkezrInto === "function",
+    "Expected native addon to export spkezrInto(target, et, ref, abcorr, observer, out)",
+  );
+  invariant(
+    typeof native.spkposInto === "function",
+    "Expected native addon to export spkposInto(target, et, ref, abcorr, observer, out)",
+  );
+  invariant(
+    typeof native.trySpkezr === "function",
+    "Expected native addon to export trySpkezr(target, et, ref, abcorr, observer)",
+  );
+  invariant(
+    typeof native.spkezrIntoStatus === "function",
+    "Expected native addon to export spkezrIntoStatus(target, et, ref, abcorr, observer, out)",
+  );
+  invariant(
+    typeof native.spkposIntoStatus === "function",
+    "Expected native addon to export spkposIntoStatus(target, et, ref, abcorr, observer, out)",
+  );
+  invariant(
+    typeof native.spkezId === "function",
+    "Expected native addon to export spkezId(target, et, refId, abcorr, observer)",
+  );
+  invariant(
+    typeof native.spkgeoId === "function",
+    "Expected native addon to export spkgeoId(target, et, refId, observer)",
+  );
+  invariant(
+    typeof native.spkgeoCached === "function",
+    "Expected native addon to export spkgeoCached(target, et, ref, observer)",
+  );
+  invariant(
+    typeof native.spkgeoCachedBatch === "function",
+    "Expected native addon to export spkgeoCachedBatch(target, ets, ref, observer)",
+  );
+  invariant(typeof native.spkEvaluatorStats === "function", "Expected native addon to export spkEvaluatorStats()");
   invariant(typeof native.spkopn === "function", "Expected native addon to export spkopn(path, ifname, ncomch)");
   invariant(typeof native.spkopa === "function", "Expected native addon to export spkopa(path)");
   invariant(typeof native.spkw08 === "function", "Expected native addon to export spkw08(handle, body, center, frame, first, last, segid, degree, states, epoch1, step)");
+  invariant(
+    typeof native.spkwStreamOpen === "function",
+    "Expected native addon to export spkwStreamOpen(handle, type, body, center, degree, frame, segid, first, last, epoch1, step, chunkStates)",
+  );
+  invariant(
+    typeof native.spkwStreamAppend === "function",
+    "Expected native addon to export spkwStreamAppend(stream, states, epochs)",
+  );
+  invariant(typeof native.spkwStreamClose === "function", "Expected native addon to export spkwStreamClose(stream, abort)");
+  invariant(
+    typeof native.spkSubset === "function",
+    "Expected native addon to export spkSubset(sources, outPath, ifname, bodies, first, last)",
+  );
+  invariant(
+    typeof native.ephemerisTableBuild === "function",
+    "Expected native addon to export ephemerisTableBuild(target, et0, et1, ref, abcorr, observer, tolerance, velocityTolerance?)",
+  );
+  invariant(
+    typeof native.ephemerisTableEval === "function",
+    "Expected native addon to export ephemerisTableEval(table, ets, out)",
+  );
   invariant(typeof native.spkcls === "function", "Expected native addon to export spkcls(handle)");
+  invariant(typeof native.spkobjIds === "function", "Expected native addon to export spkobjIds(spk)");
+  invariant(
+    typeof native.spkcovIntervals === "function",
+    "Expected native addon to export spkcovIntervals(spk, idcode)",
+  );
+  invariant(typeof native.ckobjIds === "function", "Expected native addon to export ckobjIds(ck)");
+  invariant(
+    typeof native.ckcovIntervals === "function",
+    "Expected native addon to export ckcovIntervals(ck, idcode, needav, level, tol, timsys)",
+  );
   invariant(
     typeof native.subpnt === "function",
     "Expected native addon to export subpnt(method, target, et, fixref, abcorr, observer)",
@@ -200,6 +415,18 @@ export function getNodeBinding(): NativeAddon {
     typeof native.sincpt === "function",
     "Expected native addon to export sincpt(method, target, et, fixref, abcorr, observer, dref, dvec)",
   );
+  invariant(
+    typeof native.sincptBatch === "function",
+    "Expected native addon to export sincptBatch(method, target, et, fixref, abcorr, observer, dref, dirs)",
+  );
+  invariant(
+    typeof native.iluminBatch === "function",
+    "Expected native addon to export iluminBatch(method, target, et, fixref, abcorr, observer, spoints)",
+  );
+  invariant(
+    typeof native.illumfBatch === "function",
+    "Expected native addon to export illumfBatch(method, target, ilusrc, et, fixref, abcorr, observer, spoints)",
+  );
   invariant(
     typeof native.ilumin === "function",
     "Expected native addon to export ilumin(method, target, et, fixref, abcorr, observer, spoint)",
@@ -208,6 +435,10 @@ export function getNodeBinding(): NativeAddon {
     typeof native.occult === "function",
     "Expected native addon to export occult(targ1, shape1, frame1, targ2, shape2, frame2, abcorr, observer, et)",
   );
+  invariant(
+    typeof native.occultBatch === "function",
+    "Expected native addon to export occultBatch(targ1s, shape1s, frame1s, targ2s, shape2s, frame2s, observers, abcorr, ets, transitions)",
+  );
 
   // --- GF (Geometry Finder) ---
   invariant(typeof native.gfsstp === "function", "Expected native addon to export gfsstp(step)");
@@ -224,6 +455,38 @@ export function getNodeBinding(): NativeAddon {
     typeof native.gfdist === "function",
     "Expected native addon to export gfdist(target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result)",
   );
+  invariant(
+    typeof native.gfsepAsync === "function",
+    "Expected native addon to export gfsepAsync(targ1, shape1, frame1, targ2, shape2, frame2, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result, options?)",
+  );
+  invariant(
+    typeof native.gfdistAsync === "function",
+    "Expected native addon to export gfdistAsync(target, abcorr, obsrvr, relate, refval, adjust, step, nintvls, cnfine, result, options?)",
+  );
+
+  invariant(
+    typeof native.setCspiceExecutorEnabled === "function",
+    "Expected native addon to export setCspiceExecutorEnabled(enabled)",
+  );
+  invariant(
+    typeof native.isCspiceExecutorEnabled === "function",
+    "Expected native addon to export isCspiceExecutorEnabled()",
+  );
+  invariant(typeof native.newCancelToken === "function", "Expected native addon to export newCancelToken()");
+  invariant(typeof native.cancelToken === "function", "Expected native addon to export cancelToken(token)");
+  invariant(typeof native.freeCancelToken === "function", "Expected native addon to export freeCancelToken(token)");
+  invariant(
+    typeof native.kernelPoolGeneration === "function",
+    "Expected native addon to export kernelPoolGeneration(kind?)",
+  );
+  invariant(typeof native.getNativeStats === "function", "Expected native addon to export getNativeStats()");
+  invariant(typeof native.resetNativeStats === "function", "Expected native addon to export resetNativeStats()");
+  invariant(typeof native.takeNativeTrace === "function", "Expected native addon to export takeNativeTrace()");
+  invariant(
+    typeof native.setQueryCacheCapacity === "function",
+    "Expected native addon to export setQueryCacheCapacity(maxEntries)",
+  );
+  invariant(typeof native.queryCacheStats === "function", "Expected native addon to export queryCacheStats()");
 
   return native;
 }
@@ -0,0 +1,51 @@
+// Entry point for a process-pool child (see `createNodeBackendPool`).
+//
+// Each child owns one native backend (and therefore one independent CSPICE
+// instance) and serves RPC requests from the parent over the IPC channel.
+
+import { createNodeBackend } from "../index.js";
+
+import type { PoolMessageToChild, PoolResponse } from "./protocol.js";
+import { poolDisposeType, poolRequestType, poolResponseType, serializePoolError } from "./protocol.js";
+import { isPoolOp } from "./ops.js";
+
+const send = process.send?.bind(process);
+if (!send) {
+  throw new Error("tspice backend pool child must be started with an IPC channel (child_process.fork)");
+}
+
+const backend = createNodeBackend() as unknown as Record<string, (...args: unknown[]) => unknown>;
+
+process.on("message", (raw: unknown) => {
+  const msg = raw as Partial<PoolMessageToChild> | null | undefined;
+  if (!msg || typeof msg !== "object") return;
+
+  if (msg.type === poolDisposeType) {
+    try {
+      backend.kclear?.();
+    } finally {
+      process.disconnect();
+    }
+    return;
+  }
+
+  if (msg.type !== poolRequestType || typeof msg.id !== "number") return;
+  const { id, op, args } = msg;
+
+  let response: PoolResponse;
+  try {
+    if (typeof op !== "string" || !isPoolOp(op)) {
+      throw new Error(`Unsupported pool op: ${String(op)}`);
+    }
+    const fn = backend[op];
+    if (typeof fn !== "function") {
+      throw new Error(`Backend does not implement ${op}()`);
+    }
+    const value = fn(...(Array.isArray(args) ? args : []));
+    response = { type: poolResponseType, id, ok: true, value };
+  } catch (err) {
+    response = { type: poolResponseType, id, ok: false, error: serializePoolError(err) };
+  }
+
+  send(response);
+});
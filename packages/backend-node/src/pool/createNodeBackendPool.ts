@@ -0,0 +1,309 @@
+import { fork } from "node:child_process";
+import type { ChildProcess } from "node:child_process";
+import { availableParallelism } from "node:os";
+import { fileURLToPath } from "node:url";
+
+import { invariant } from "@rybosome/tspice-core";
+
+import type { NodeSpiceBackend } from "../index.js";
+import { getNodeBinding } from "../lowlevel/binding.js";
+
+import type { NodeBackendPoolOp } from "./ops.js";
+import { isPoolBroadcastOp, isPoolReadOp } from "./ops.js";
+import type { GfPartitionedOp } from "./partition-gf.js";
+import { clipWindow, gfPartitionedArgIndex, windowCutsByMeasure, windowMeasure } from "./partition-gf.js";
+import type { PoolDispose, PoolMessageFromChild, PoolRequest } from "./protocol.js";
+import { deserializePoolError, poolDisposeType, poolRequestType, poolResponseType } from "./protocol.js";
+
+export type NodeBackendPoolDispatch = "round-robin" | "least-loaded";
+
+export type CreateNodeBackendPoolOptions = {
+  /** Number of child processes. Defaults to `os.availableParallelism()`. */
+  size?: number;
+  /** How read-only calls pick a child. Defaults to `"least-loaded"`. */
+  dispatch?: NodeBackendPoolDispatch;
+  /** How long `dispose()` waits for children to exit before killing them. Defaults to 5000ms. */
+  disposeTimeoutMs?: number;
+};
+
+export type GfPartitionedOptions = {
+  /** Number of sub-windows. Defaults to the number of live children. */
+  partitions?: number;
+  /**
+   * How far each sub-window extends past its share of `cnfine` on both sides, in seconds. Must be
+   * at least the search `step` (the default), so an event straddling a cut is sampled in full by
+   * one of the two searches.
+   */
+  margin?: number;
+};
+
+export type NodeBackendPoolResult<Op extends NodeBackendPoolOp> = Awaited<ReturnType<NodeSpiceBackend[Op]>>;
+
+/**
+ * A pool of child processes, each hosting its own native backend (and so its
+ * own CSPICE instance), for scaling read-heavy workloads across cores.
+ */
+export type NodeBackendPool = {
+  /** Number of live child processes. */
+  readonly size: number;
+
+  /**
+   * Invoke a backend op.
+   *
+   * Read-only ops (`spkezr`, `pxform`, `sincpt`, ...) go to a single child.
+   * Kernel/pool mutations (`furnsh`, `unload`, `kclear`, `pdpool`, ...) are
+   * broadcast to every child and resolve with the first child's result once all
+   * of them have applied it. Each child handles its messages in order, so a read
+   * issued after a broadcast always observes it.
+   *
+   * Handle-returning ops (cells, windows, DAF/EK writers) are not supported:
+   * handles are local to one child.
+   */
+  call<Op extends NodeBackendPoolOp>(
+    op: Op,
+    ...args: Parameters<NodeSpiceBackend[Op]>
+  ): Promise<NodeBackendPoolResult<Op>>;
+
+  /**
+   * Run one `gfsepPacked` / `gfdistPacked` search as several smaller ones, in parallel.
+   *
+   * `cnfine` is split into `partitions` pieces of equal measure, each widened by `margin` and
+   * searched by its own child. Each child's result is clipped back to its piece and the pieces
+   * are merged with the native window union, so the resolved window matches a single search
+   * over `cnfine` to within the convergence tolerance. Per-piece results are capped at
+   * `nintvls`; the merged one is not. `ABSMAX` / `ABSMIN` depend on the whole window and run
+   * unpartitioned on one child.
+   */
+  gfPartitioned<Op extends GfPartitionedOp>(
+    op: Op,
+    args: Parameters<NodeSpiceBackend[Op]>,
+    opts?: GfPartitionedOptions,
+  ): Promise<Float64Array>;
+
+  /** Shut down all children. Pending calls are rejected. */
+  dispose(): Promise<void>;
+};
+
+type Pending = {
+  resolve: (value: unknown) => void;
+  reject: (reason: unknown) => void;
+};
+
+type PoolChild = {
+  proc: ChildProcess;
+  pending: Map<number, Pending>;
+  alive: boolean;
+  exited: Promise<void>;
+};
+
+const childEntryPath = fileURLToPath(new URL("./child.js", import.meta.url));
+
+/** Start a {@link NodeBackendPool}. */
+export function createNodeBackendPool(opts: CreateNodeBackendPoolOptions = {}): NodeBackendPool {
+  const size = opts.size ?? availableParallelism();
+  invariant(Number.isInteger(size) && size >= 1, `createNodeBackendPool(size): expected an integer >= 1 (got ${size})`);
+
+  const dispatch = opts.dispatch ?? "least-loaded";
+  invariant(
+    dispatch === "round-robin" || dispatch === "least-loaded",
+    `createNodeBackendPool(dispatch): expected "round-robin" or "least-loaded" (got ${String(dispatch)})`,
+  );
+
+  const disposeTimeoutMs = opts.disposeTimeoutMs ?? 5000;
+
+  let nextId = 1;
+  let nextRoundRobin = 0;
+  let disposed = false;
+
+  const spawnChild = (): PoolChild => {
+    const proc = fork(childEntryPath, [], {
+      serialization: "advanced",
+      stdio: ["ignore", "inherit", "inherit", "ipc"],
+      // The parent's loader flags (e.g. from a test runner) don't apply to the plain JS entry.
+      execArgv: [],
+    });
+
+    const child: PoolChild = {
+      proc,
+      pending: new Map(),
+      alive: true,
+      exited: new Promise<void>((resolve) => proc.once("exit", () => resolve())),
+    };
+
+    proc.on("message", (raw: unknown) => {
+      const msg = raw as Partial<PoolMessageFromChild> | null | undefined;
+      if (!msg || msg.type !== poolResponseType || typeof msg.id !== "number") return;
+
+      const pending = child.pending.get(msg.id);
+      if (!pending) return;
+      child.pending.delete(msg.id);
+
+      if (msg.ok === true) {
+        pending.resolve((msg as Extract<PoolMessageFromChild, { ok: true }>).value);
+      } else {
+        pending.reject(deserializePoolError((msg as Extract<PoolMessageFromChild, { ok: false }>).error));
+      }
+    });
+
+    proc.once("exit", (code, signal) => {
+      child.alive = false;
+      const reason = new Error(
+        `tspice backend pool child (pid=${proc.pid}) exited (code=${code}, signal=${signal})`,
+      );
+      for (const pending of child.pending.values()) pending.reject(reason);
+      child.pending.clear();
+    });
+
+    // `exit` always follows; just keep an unhandled `error` from crashing the parent.
+    proc.on("error", () => {});
+
+    return child;
+  };
+
+  const children: PoolChild[] = Array.from({ length: size }, spawnChild);
+
+  const liveChildren = (): PoolChild[] => children.filter((c) => c.alive);
+
+  const send = (child: PoolChild, op: string, args: unknown[]): Promise<unknown> =>
+    new Promise<unknown>((resolve, reject) => {
+      const id = nextId++;
+      child.pending.set(id, { resolve, reject });
+
+      const msg: PoolRequest = { type: poolRequestType, id, op, args };
+      try {
+        child.proc.send(msg, (err) => {
+          if (!err) return;
+          if (child.pending.delete(id)) reject(err);
+        });
+      } catch (err) {
+        child.pending.delete(id);
+        reject(err);
+      }
+    });
+
+  const pickChild = (live: PoolChild[]): PoolChild => {
+    if (dispatch === "round-robin") {
+      const child = live[nextRoundRobin % live.length]!;
+      nextRoundRobin = (nextRoundRobin + 1) % live.length;
+      return child;
+    }
+
+    let best = live[0]!;
+    for (const child of live) {
+      if (child.pending.size < best.pending.size) best = child;
+    }
+    return best;
+  };
+
+  const call = async (op: string, ...args: unknown[]): Promise<unknown> => {
+    if (disposed) throw new Error(`tspice backend pool disposed (op=${op})`);
+
+    const live = liveChildren();
+    if (live.length === 0) throw new Error(`tspice backend pool has no live children (op=${op})`);
+
+    if (isPoolBroadcastOp(op)) {
+      const results = await Promise.all(live.map((child) => send(child, op, args)));
+      return results[0];
+    }
+
+    if (isPoolReadOp(op)) {
+      return await send(pickChild(live), op, args);
+    }
+
+    throw new Error(`tspice backend pool does not support op: ${op}`);
+  };
+
+  const gfPartitioned = async (
+    op: GfPartitionedOp,
+    args: unknown[],
+    gfOpts: GfPartitionedOptions = {},
+  ): Promise<Float64Array> => {
+    const argIndex = gfPartitionedArgIndex[op];
+    invariant(argIndex !== undefined, `gfPartitioned(op): expected "gfsepPacked" or "gfdistPacked" (got ${String(op)})`);
+
+    const cnfine = args[argIndex.cnfine];
+    const step = args[argIndex.step];
+    const relate = args[argIndex.relate];
+    invariant(cnfine instanceof Float64Array, "gfPartitioned(cnfine): expected a Float64Array");
+    invariant(cnfine.length % 2 === 0, "gfPartitioned(cnfine): expected an even number of endpoints");
+    invariant(typeof step === "number" && step > 0, "gfPartitioned(step): expected a positive number");
+
+    const margin = gfOpts.margin ?? step;
+    invariant(
+      Number.isFinite(margin) && margin >= step,
+      `gfPartitioned(margin): expected a number >= step (got ${margin})`,
+    );
+
+    const live = liveChildren();
+    const requested = gfOpts.partitions ?? live.length;
+    invariant(
+      Number.isInteger(requested) && requested >= 1,
+      `gfPartitioned(partitions): expected an integer >= 1 (got ${requested})`,
+    );
+
+    const global = typeof relate === "string" && /^\s*ABS(MAX|MIN)\s*$/i.test(relate);
+    const measure = cnfine.length === 0 ? 0 : windowMeasure(cnfine);
+    // Pieces much shorter than the margin would mostly search each other's ground.
+    const parts = global ? 1 : Math.max(1, Math.min(requested, Math.floor(measure / (2 * margin))));
+    if (parts === 1) return (await call(op, ...args)) as Float64Array;
+
+    if (disposed) throw new Error(`tspice backend pool disposed (op=${op})`);
+    if (live.length === 0) throw new Error(`tspice backend pool has no live children (op=${op})`);
+
+    const cuts = windowCutsByMeasure(cnfine, parts);
+    const pieces = await Promise.all(
+      Array.from({ length: parts }, async (_, k) => {
+        const lo = cuts[k]!;
+        const hi = cuts[k + 1]!;
+        const subArgs = args.slice();
+        subArgs[argIndex.cnfine] = clipWindow(cnfine, lo - margin, hi + margin);
+        const result = (await send(live[k % live.length]!, op, subArgs)) as Float64Array;
+        return clipWindow(result, lo, hi, k < parts - 1);
+      }),
+    );
+
+    const native = getNodeBinding();
+    let merged = pieces[0]!;
+    for (let k = 1; k < parts; k++) merged = native.wnunidPacked(merged, pieces[k]!, undefined)!;
+    return merged;
+  };
+
+  const dispose = async (): Promise<void> => {
+    if (disposed) return;
+    disposed = true;
+
+    const msg: PoolDispose = { type: poolDisposeType };
+    for (const child of liveChildren()) {
+      try {
+        child.proc.send(msg);
+      } catch {
+        // ignore
+      }
+    }
+
+    await Promise.all(
+      children.map(async (child) => {
+        if (!child.alive) return;
+        let timer: ReturnType<typeof setTimeout> | undefined;
+        const timedOut = new Promise<void>((resolve) => {
+          timer = setTimeout(() => {
+            child.proc.kill();
+            resolve();
+          }, disposeTimeoutMs);
+        });
+        await Promise.race([child.exited, timedOut]);
+        clearTimeout(timer);
+        await child.exited;
+      }),
+    );
+  };
+
+  return {
+    get size() {
+      return liveChildren().length;
+    },
+    call: call as NodeBackendPool["call"],
+    gfPartitioned: gfPartitioned as NodeBackendPool["gfPartitioned"],
+    dispose,
+  };
+}
@@ -0,0 +1,117 @@
+import type { NodeSpiceBackend } from "../index.js";
+
+/**
+ * Read-only ops: dispatched to a single child.
+ *
+ * These only read kernel data or the kernel pool and never allocate handles,
+ * so any child with the same kernel set returns the same answer.
+ */
+export const poolReadOps = [
+  "spkezr",
+  "spkpos",
+  "spkez",
+  "spkezp",
+  "spkgeo",
+  "spkgps",
+  "spkssb",
+  "spkezId",
+  "spkgeoId",
+  "spkgeoCached",
+  "spkgeoCachedBatch",
+  "spkezrBatch",
+  "spkposBatch",
+  "pxform",
+  "sxform",
+  "pxformId",
+  "transformVectors",
+  "transformStates",
+  "ckgp",
+  "ckgpav",
+  "subpnt",
+  "subslr",
+  "sincpt",
+  "sincptBatch",
+  "ilumin",
+  "illumg",
+  "illumf",
+  "iluminBatch",
+  "illumfBatch",
+  "occult",
+  "occultBatch",
+  "gfsepPacked",
+  "gfdistPacked",
+  "str2et",
+  "et2utc",
+  "str2etBatch",
+  "et2utcBatch",
+  "timout",
+  "deltet",
+  "unitim",
+  "deltetBatch",
+  "unitimBatch",
+  "namfrm",
+  "frmnam",
+  "bodn2c",
+  "bodc2n",
+  "bodc2s",
+  "bods2c",
+  "internBody",
+  "internFrame",
+  "exportBodyNameTable",
+  "exportFrameTable",
+  "bodfnd",
+  "bodvar",
+  "gdpool",
+  "gipool",
+  "gcpool",
+  "gnpool",
+  "dtpool",
+  "poolSnapshot",
+  "expool",
+  "ktotal",
+  "kernelSetSnapshot",
+  "ekQueryColumnar",
+  "spkobjIds",
+  "spkcovIntervals",
+  "ckobjIds",
+  "ckcovIntervals",
+  "tkvrsn",
+] as const satisfies readonly (keyof NodeSpiceBackend)[];
+
+/**
+ * State-mutating ops: broadcast to every child so all CSPICE instances stay in
+ * sync. The first child's result is returned.
+ */
+export const poolBroadcastOps = [
+  "furnsh",
+  "unload",
+  "kclear",
+  "kernelSetRestore",
+  "registerLazyKernel",
+  "unregisterLazyKernel",
+  "setLazyKernelBudget",
+  "pdpool",
+  "pipool",
+  "pcpool",
+  "loadTextKernelFromBuffer",
+  "boddef",
+] as const satisfies readonly (keyof NodeSpiceBackend)[];
+
+export type NodeBackendPoolReadOp = (typeof poolReadOps)[number];
+export type NodeBackendPoolBroadcastOp = (typeof poolBroadcastOps)[number];
+export type NodeBackendPoolOp = NodeBackendPoolReadOp | NodeBackendPoolBroadcastOp;
+
+const readOpSet: ReadonlySet<string> = new Set(poolReadOps);
+const broadcastOpSet: ReadonlySet<string> = new Set(poolBroadcastOps);
+
+export function isPoolReadOp(op: string): op is NodeBackendPoolReadOp {
+  return readOpSet.has(op);
+}
+
+export function isPoolBroadcastOp(op: string): op is NodeBackendPoolBroadcastOp {
+  return broadcastOpSet.has(op);
+}
+
+export function isPoolOp(op: string): op is NodeBackendPoolOp {
+  return readOpSet.has(op) || broadcastOpSet.has(op);
+}
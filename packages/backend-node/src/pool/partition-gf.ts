@@ -0,0 +1,57 @@
+// Confinement-window partitioning for `NodeBackendPool.gfPartitioned`.
+//
+// Windows here are packed `[left0, right0, left1, right1, ...]` Float64Arrays with sorted,
+// disjoint intervals (what `windowToFloat64Array` produces).
+
+export type GfPartitionedOp = "gfsepPacked" | "gfdistPacked";
+
+// Argument positions of `relate`, `step` and `cnfine` in each packed search.
+export const gfPartitionedArgIndex = {
+  gfsepPacked: { relate: 8, step: 11, cnfine: 13 },
+  gfdistPacked: { relate: 3, step: 6, cnfine: 8 },
+} as const satisfies Record<GfPartitionedOp, { relate: number; step: number; cnfine: number }>;
+
+export function windowMeasure(win: Float64Array): number {
+  let total = 0;
+  for (let i = 0; i < win.length; i += 2) total += win[i + 1]! - win[i]!;
+  return total;
+}
+
+/**
+ * Cut `win` into `parts` pieces of equal measure. Returns `parts + 1` increasing times: the first
+ * and last are the window's endpoints, and piece `k` is `win ∩ [cuts[k], cuts[k + 1]]`.
+ */
+export function windowCutsByMeasure(win: Float64Array, parts: number): number[] {
+  const total = windowMeasure(win);
+  const cuts = [win[0]!];
+
+  let interval = 0;
+  let before = 0; // measure of the intervals before `interval`
+  for (let k = 1; k < parts; k++) {
+    const target = (total * k) / parts;
+    while (interval + 2 < win.length && before + (win[interval + 1]! - win[interval]!) < target) {
+      before += win[interval + 1]! - win[interval]!;
+      interval += 2;
+    }
+    cuts.push(Math.min(win[interval]! + (target - before), win[interval + 1]!));
+  }
+
+  cuts.push(win[win.length - 1]!);
+  return cuts;
+}
+
+/**
+ * `win ∩ [lo, hi]`. With `halfOpen`, degenerate intervals at `hi` are dropped, so singleton results
+ * (local extrema) on a shared cut land in exactly one piece.
+ */
+export function clipWindow(win: Float64Array, lo: number, hi: number, halfOpen = false): Float64Array {
+  const out: number[] = [];
+  for (let i = 0; i < win.length; i += 2) {
+    const left = Math.max(win[i]!, lo);
+    const right = Math.min(win[i + 1]!, hi);
+    if (left > right) continue;
+    if (halfOpen && left === hi) continue;
+    out.push(left, right);
+  }
+  return Float64Array.from(out);
+}
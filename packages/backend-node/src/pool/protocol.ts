@@ -0,0 +1,68 @@
+// Parent <-> child IPC messages for the process pool.
+//
+// These intentionally mirror the request/response shapes of the `@rybosome/tspice`
+// worker RPC layer (`tspice:request` / `tspice:response`, numeric ids, structured
+// errors) so both transports stay easy to reason about together. Values travel
+// over Node's `"advanced"` IPC serialization, so typed arrays round-trip without a
+// separate value codec.
+
+export const poolRequestType = "tspice:request" as const;
+export const poolResponseType = "tspice:response" as const;
+export const poolDisposeType = "tspice:dispose" as const;
+
+export type PoolRequest = {
+  type: typeof poolRequestType;
+  id: number;
+  op: string;
+  args: unknown[];
+};
+
+export type PoolDispose = {
+  type: typeof poolDisposeType;
+};
+
+export type PoolSerializedError = {
+  message: string;
+  name?: string;
+  stack?: string;
+  /** SPICE short error message (e.g. `SPICE(NOSUCHFILE)`), when present. */
+  spiceShort?: string;
+  spiceLong?: string;
+  spiceTrace?: string;
+};
+
+export type PoolResponse =
+  | { type: typeof poolResponseType; id: number; ok: true; value: unknown }
+  | { type: typeof poolResponseType; id: number; ok: false; error: PoolSerializedError };
+
+export type PoolMessageToChild = PoolRequest | PoolDispose;
+export type PoolMessageFromChild = PoolResponse;
+
+const optionalStringKeys = ["name", "stack", "spiceShort", "spiceLong", "spiceTrace"] as const;
+
+/** Serialize a thrown value into a structured, IPC-safe shape. */
+export function serializePoolError(err: unknown): PoolSerializedError {
+  if (err && typeof err === "object") {
+    const obj = err as Record<string, unknown>;
+    const out: PoolSerializedError = {
+      message: typeof obj.message === "string" && obj.message ? obj.message : "Pool request failed",
+    };
+    for (const key of optionalStringKeys) {
+      const v = obj[key];
+      if (typeof v === "string" && v) out[key] = v;
+    }
+    return out;
+  }
+
+  return { message: typeof err === "string" ? err : "Pool request failed" };
+}
+
+/** Rebuild an {@link Error} from {@link serializePoolError} output. */
+export function deserializePoolError(err: PoolSerializedError): Error {
+  const out = new Error(err.message);
+  for (const key of optionalStringKeys) {
+    const v = err[key];
+    if (typeof v === "string") (out as unknown as Record<string, string>)[key] = v;
+  }
+  return out;
+}
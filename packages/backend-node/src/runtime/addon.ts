@@ -7,9 +7,42 @@ import { fileURLToPath } from "node:url";
 
 import type { SpiceIntCell, SpiceWindow } from "@rybosome/tspice-backend-contract";
 
+import type { DskRaycastBatchResult } from "../domains/dsk.js";
+import type { EkCursorBatch, EkCursorOpenResult, EkQueryColumnarResult, EkSegmentColumn } from "../domains/ek.js";
+import type { SpkEvaluatorStats } from "../domains/ephemeris.js";
+import type { FrameCacheStats } from "../domains/frames.js";
+import type { IllumfBatchResult, IluminBatchResult, SincptBatchResult } from "../domains/geometry.js";
+import type { KernelPoolSnapshot } from "../domains/kernel-pool.js";
+import type { LazyKernelStats } from "../domains/kernels.js";
+
+import type { NativeCallOptions } from "./cancellation.js";
+import type { NativeStats } from "./native-stats.js";
+import type { QueryCacheStats } from "./query-cache.js";
+
 export type NativeAddon = {
   spiceVersion(): string;
 
+  // --- CSPICE executor (process-wide) ---
+  setCspiceExecutorEnabled(enabled: boolean): void;
+  isCspiceExecutorEnabled(): boolean;
+
+  // --- kernel-pool generation counters (process-wide, lock-free) ---
+  kernelPoolGeneration(kind?: "kernels" | "variables" | "bodies"): number;
+
+  // --- native instrumentation (process-wide, opt-in via TSPICE_NATIVE_STATS / TSPICE_NATIVE_TRACE) ---
+  getNativeStats(): NativeStats;
+  resetNativeStats(): void;
+  takeNativeTrace(): string | null;
+
+  // --- per-call cancellation (per environment) ---
+  newCancelToken(): number;
+  cancelToken(token: number): void;
+  freeCancelToken(token: number): void;
+
+  // --- pure-query memo (process-wide, off by default) ---
+  setQueryCacheCapacity(maxEntries: number): void;
+  queryCacheStats(): QueryCacheStats;
+
   // --- error/status utilities ---
   failed(): boolean;
   reset(): void;
@@ -18,10 +51,24 @@ export type NativeAddon = {
   sigerr(short: string): void;
   chkin(name: string): void;
   chkout(name: string): void;
+  lastSpiceError(): { class: number; short: string; long: string; trace: string } | null;
 
   furnsh(path: string): void;
   unload(path: string): void;
   kclear(): void;
+  /** Whether `furnshBuffer` is available (Linux `memfd_create`). */
+  kernelBuffersSupported(): boolean;
+  /** Load a kernel from memory; returns the path CSPICE knows it by. */
+  furnshBuffer(name: string, bytes: Uint8Array): string;
+  /** Close the descriptor behind a `furnshBuffer` path (after unloading it). */
+  releaseKernelBuffer(path: string): void;
+  /** Serialized kernel pool + binary kernel paths (see `NodeKernelSetApi`). */
+  kernelSetSnapshot(): Uint8Array;
+  kernelSetRestore(snapshot: Uint8Array): void;
+  registerLazyKernel(path: string): void;
+  unregisterLazyKernel(path: string): boolean;
+  setLazyKernelBudget(maxOpen: number): void;
+  lazyKernelStats(): LazyKernelStats;
   ktotal(kind?: string): number;
   kdata(
     which: number,
@@ -44,20 +91,27 @@ export type NativeAddon = {
   gcpool(name: string, start: number, room: number): { found: boolean; values?: string[] };
   gnpool(template: string, start: number, room: number): { found: boolean; values?: string[] };
   dtpool(name: string): { found: boolean; n?: number; type?: string };
+  poolSnapshot(pattern: string): KernelPoolSnapshot;
 
   pdpool(name: string, values: readonly number[]): void;
   pipool(name: string, values: readonly number[]): void;
   pcpool(name: string, values: readonly string[]): void;
+  /** Parse a text kernel's data sections natively and pool every variable under one lock. */
+  loadTextKernelFromBuffer(name: string, bytes: Uint8Array): number;
 
   swpool(agent: string, names: readonly string[]): void;
   cvpool(agent: string): boolean;
   expool(name: string): boolean;
   str2et(utc: string): number;
   et2utc(et: number, format: string, prec: number): string;
+  str2etBatch(times: readonly string[]): Float64Array;
+  et2utcBatch(ets: Float64Array, format: string, prec: number): { offsets: Int32Array; bytes: Uint8Array };
   timout(et: number, picture: string): string;
 
   deltet(epoch: number, eptype: string): number;
   unitim(epoch: number, insys: string, outsys: string): number;
+  deltetBatch(epochs: Float64Array, eptype: string): Float64Array;
+  unitimBatch(epochs: Float64Array, insys: string, outsys: string): Float64Array;
   tparse(timstr: string): number;
   tpictr(sample: string, pictur: string): string;
   timdefGet(item: string): string;
@@ -73,6 +127,18 @@ export type NativeAddon = {
   dafcls(handle: number): void;
   dafbfs(handle: number): void;
   daffna(handle: number): boolean;
+  dafgda(handle: number, baddr: number, eaddr: number): Float64Array;
+  setDafMmapEnabled(enabled: boolean): void;
+  isDafMmapEnabled(): boolean;
+  mapOutputFile(path: string): ArrayBuffer | null;
+  dafSummaries(path: string): {
+    nd: number;
+    ni: number;
+    count: number;
+    doubles: Float64Array;
+    ints: Int32Array;
+    names: { offsets: Int32Array; bytes: Uint8Array };
+  };
 
   dasopr(path: string): number;
   dascls(handle: number): void;
@@ -81,6 +147,12 @@ export type NativeAddon = {
   dlabfs(handle: number): { found: boolean; descr?: Record<string, unknown> };
   dlafns(handle: number, descr: Record<string, unknown>): { found: boolean; descr?: Record<string, unknown> };
   dlacls(handle: number): void;
+  dlaDescriptors(path: string): {
+    count: number;
+    descrs: Int32Array;
+    dskInts: Int32Array | null;
+    dskDoubles: Float64Array | null;
+  };
 
   // --- EK ---
   ekopr(path: string): number;
@@ -109,6 +181,14 @@ export type NativeAddon = {
     row: number,
     elment: number,
   ): { found: false } | { found: true; isNull: true } | { found: true; isNull: false; value: number };
+  ekQueryColumnar(query: string): EkQueryColumnarResult;
+  ekCursorOpen(query: string, batchRows: number): EkCursorOpenResult;
+  ekCursorNext(cursor: number, reuse: EkCursorBatch | undefined): EkCursorBatch | null;
+  /** Reads the next batch off the JS thread; resolves with its row count (0 once exhausted). */
+  ekCursorReadAsync(cursor: number): Promise<number>;
+  /** Hands out the batch read by `ekCursorReadAsync`, or `null` when there is none. */
+  ekCursorTake(cursor: number, reuse: EkCursorBatch | undefined): EkCursorBatch | null;
+  ekCursorClose(cursor: number): void;
   ekifld(
     handle: number,
     tabnam: string,
@@ -144,6 +224,13 @@ export type NativeAddon = {
     rcptrs: readonly number[],
   ): void;
   ekffld(handle: number, segno: number, rcptrs: readonly number[]): void;
+  ekWriteSegment(
+    handle: number,
+    tabnam: string,
+    cnames: readonly string[],
+    decls: readonly string[],
+    columns: readonly EkSegmentColumn[],
+  ): number;
 
   // --- DSK writer ---
   dskopn(path: string, ifname: string, ncomch: number): number;
@@ -183,6 +270,25 @@ export type NativeAddon = {
     spaixd: readonly number[],
     spaixi: readonly number[],
   ): void;
+  dskWriteType2(
+    handle: number,
+    center: number,
+    surfid: number,
+    dclass: number,
+    frame: string,
+    corsys: number,
+    corpar: readonly number[],
+    bounds: Float64Array,
+    vertices: Float64Array,
+    plates: Int32Array,
+    finscl: number,
+    corscl: number,
+    worksz: number,
+    voxpsz: number,
+    voxlsz: number,
+    makvtl: boolean,
+    spxisz: number,
+  ): void;
 
   // --- DSK ---
 
@@ -190,12 +296,30 @@ export type NativeAddon = {
   dsksrf(dsk: string, bodyid: number, srfidsCellHandle: number): void;
   dskgd(handle: number, dladsc: Record<string, unknown>): Record<string, unknown>;
   dskb02(handle: number, dladsc: Record<string, unknown>): Record<string, unknown>;
+  dskx02(
+    handle: number,
+    dladsc: Record<string, unknown>,
+    vertex: readonly number[],
+    raydir: readonly number[],
+  ): { found: boolean; plid?: number; xpt?: number[] };
+  dskBvhBuild(handle: number, dladsc: Record<string, unknown>): { id: number; nv: number; np: number; nodes: number };
+  dskBvhRaycast(index: number, vertices: Float64Array, raydirs: Float64Array, threads: number): DskRaycastBatchResult;
+  dskBvhFree(index: number): void;
 
 
   bodn2c(name: string): { found: boolean; code?: number };
   bodc2n(code: number): { found: boolean; name?: string };
   bodc2s(code: number): string;
   bods2c(name: string): { found: boolean; code?: number };
+  internBody(name: string): number;
+  internFrame(name: string): number;
+  exportBodyNameTable(): {
+    generation: number;
+    codes: Int32Array;
+    names: { offsets: Int32Array; bytes: Uint8Array };
+    primary: Uint8Array;
+  };
+  exportFrameTable(): { generation: number; codes: Int32Array; names: { offsets: Int32Array; bytes: Uint8Array } };
   boddef(name: string, code: number): void;
   bodfnd(body: number, item: string): boolean;
   bodvar(body: number, item: string): number[];
@@ -212,6 +336,12 @@ export type NativeAddon = {
   scdecd(sc: number, sclkdp: number): string;
   sct2e(sc: number, sclkdp: number): number;
   sce2c(sc: number, et: number): number;
+  scs2eBatch(sc: number, sclkchs: readonly string[]): Float64Array;
+  sce2sBatch(sc: number, ets: Float64Array): { offsets: Int32Array; bytes: Uint8Array };
+  scencdBatch(sc: number, sclkchs: readonly string[]): Float64Array;
+  scdecdBatch(sc: number, sclkdps: Float64Array): { offsets: Int32Array; bytes: Uint8Array };
+  sct2eBatch(sc: number, sclkdps: Float64Array): Float64Array;
+  sce2cBatch(sc: number, ets: Float64Array): Float64Array;
   ckgp(
     inst: number,
     sclkdp: number,
@@ -224,6 +354,18 @@ export type NativeAddon = {
     tol: number,
     ref: string,
   ): { found: boolean; cmat?: number[]; av?: number[]; clkout?: number };
+  ckgpBatch(
+    inst: number,
+    sclkdp: Float64Array,
+    tol: number,
+    ref: string,
+  ): { cmats: Float64Array; clkouts: Float64Array; found: Uint8Array };
+  ckgpavBatch(
+    inst: number,
+    sclkdp: Float64Array,
+    tol: number,
+    ref: string,
+  ): { cmats: Float64Array; avs: Float64Array; clkouts: Float64Array; found: Uint8Array };
 
   cklpf(ck: string): number;
   ckupf(handle: number): void;
@@ -237,6 +379,8 @@ export type NativeAddon = {
     timsys: string,
     coverWindowHandle: number,
   ): void;
+  ckobjIds(ck: string): Int32Array;
+  ckcovIntervals(ck: string, idcode: number, needav: boolean, level: string, tol: number, timsys: string): Float64Array;
 
   spkezr(
     target: string,
@@ -246,6 +390,14 @@ export type NativeAddon = {
     obs: string
   ): { state: number[]; lt: number };
 
+  trySpkezr(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: string,
+    obs: string,
+  ): { found: boolean; state?: number[]; lt?: number };
+
   spkpos(
     target: string,
     et: number,
@@ -254,6 +406,60 @@ export type NativeAddon = {
     obs: string
   ): { pos: number[]; lt: number };
 
+  spkezrBatch(
+    target: string,
+    ets: Float64Array,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    options?: NativeCallOptions,
+  ): { states: Float64Array; lts: Float64Array };
+
+  spkposBatch(
+    target: string,
+    ets: Float64Array,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    options?: NativeCallOptions,
+  ): { positions: Float64Array; lts: Float64Array };
+
+  spkezrInto(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    out: Float64Array,
+  ): number;
+
+  spkposInto(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    out: Float64Array,
+  ): number;
+
+  spkezrIntoStatus(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    out: Float64Array,
+  ): number;
+
+  spkposIntoStatus(
+    target: string,
+    et: number,
+    ref: string,
+    abcorr: string,
+    obs: string,
+    out: Float64Array,
+  ): number;
+
   spkez(
     target: number,
     et: number,
@@ -277,6 +483,37 @@ export type NativeAddon = {
     obs: number
   ): { state: number[]; lt: number };
 
+  spkezId(
+    target: number,
+    et: number,
+    refId: number,
+    abcorr: string,
+    obs: number
+  ): { state: number[]; lt: number };
+
+  spkgeoId(
+    target: number,
+    et: number,
+    refId: number,
+    obs: number
+  ): { state: number[]; lt: number };
+
+  spkgeoCached(
+    target: number,
+    et: number,
+    ref: string,
+    obs: number
+  ): { state: number[]; lt: number };
+
+  spkgeoCachedBatch(
+    target: number,
+    ets: Float64Array,
+    ref: string,
+    obs: number,
+  ): { states: Float64Array; lts: Float64Array };
+
+  spkEvaluatorStats(): SpkEvaluatorStats;
+
   spkgps(
     target: number,
     et: number,
@@ -296,6 +533,51 @@ export type NativeAddon = {
     spoint: number[],
   ): { trgepc: number; srfvec: number[]; phase: number; incdnc: number; emissn: number };
 
+  sincptBatch(
+    method: string,
+    target: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    dref: string,
+    dirs: Float64Array,
+  ): SincptBatchResult;
+
+  iluminBatch(
+    method: string,
+    target: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    spoints: Float64Array,
+  ): IluminBatchResult;
+
+  illumfBatch(
+    method: string,
+    target: string,
+    ilusrc: string,
+    et: number,
+    fixref: string,
+    abcorr: string,
+    observer: string,
+    spoints: Float64Array,
+  ): IllumfBatchResult;
+
+  occultBatch(
+    targ1s: string[],
+    shape1s: string[],
+    frame1s: string[],
+    targ2s: string[],
+    shape2s: string[],
+    frame2s: string[],
+    observers: string[],
+    abcorr: string,
+    ets: Float64Array,
+    transitions: boolean,
+  ): { codes: Int8Array; offsets?: Int32Array; runStarts?: Int32Array; runCodes?: Int8Array };
+
   illumf(
     method: string,
     target: string,
@@ -326,6 +608,8 @@ export type NativeAddon = {
   nvc2pl(normal: number[], konst: number): number[];
   pl2nvc(plane: number[]): { normal: number[]; konst: number };
   spkobj(spk: string, ids: SpiceIntCell): void;
+  spkobjIds(spk: string): Int32Array;
+  spkcovIntervals(spk: string, idcode: number): Float64Array;
 
   spksfs(body: number, et: number): { found: boolean; handle?: number; descr?: number[]; ident?: string };
 
@@ -350,6 +634,42 @@ export type NativeAddon = {
     epoch1: number,
     step: number,
   ): void;
+  spkwStreamOpen(
+    handle: number,
+    type: number,
+    body: number,
+    center: number,
+    degree: number,
+    frame: string,
+    segid: string,
+    first: number,
+    last: number,
+    epoch1: number,
+    step: number,
+    chunkStates: number,
+  ): number;
+  spkwStreamAppend(stream: number, states: Float64Array, epochs: Float64Array | undefined): void;
+  spkwStreamClose(stream: number, abort: boolean): void;
+  spkSubset(
+    sources: readonly string[],
+    outPath: string,
+    ifname: string,
+    bodies: Int32Array,
+    first: number,
+    last: number,
+  ): number;
+
+  ephemerisTableBuild(
+    target: string,
+    et0: number,
+    et1: number,
+    ref: string,
+    abcorr: string,
+    observer: string,
+    tolerance: number,
+    velocityTolerance?: number,
+  ): ArrayBuffer;
+  ephemerisTableEval(table: ArrayBuffer, ets: Float64Array, out: Float64Array): void;
 
   subpnt(
     method: string,
@@ -441,8 +761,52 @@ export type NativeAddon = {
     cnfine: SpiceWindow,
     result: SpiceWindow,
   ): void;
+
+  gfsepAsync(
+    targ1: string,
+    shape1: string,
+    frame1: string,
+    targ2: string,
+    shape2: string,
+    frame2: string,
+    abcorr: string,
+    obsrvr: string,
+    relate: string,
+    refval: number,
+    adjust: number,
+    step: number,
+    nintvls: number,
+    cnfine: SpiceWindow,
+    result: SpiceWindow,
+    options?: NativeCallOptions,
+  ): Promise<number>;
+
+  gfdistAsync(
+    target: string,
+    abcorr: string,
+    obsrvr: string,
+    relate: string,
+    refval: number,
+    adjust: number,
+    step: number,
+    nintvls: number,
+    cnfine: SpiceWindow,
+    result: SpiceWindow,
+    options?: NativeCallOptions,
+  ): Promise<number>;
   pxform(from: string, to: string, et: number): number[];
   sxform(from: string, to: string, et: number): number[];
+  pxformInto(from: string, to: string, et: number, out: Float64Array): void;
+  pxformId(fromId: number, toId: number, et: number): number[];
+  pxformIdInto(fromId: number, toId: number, et: number, out: Float64Array): void;
+  sxformInto(from: string, to: string, et: number, out: Float64Array): void;
+  pxformIntoStatus(from: string, to: string, et: number, out: Float64Array): number;
+  sxformIntoStatus(from: string, to: string, et: number, out: Float64Array): number;
+  frameCacheStats(): FrameCacheStats;
+  tryPxform(from: string, to: string, et: number): { found: boolean; value?: number[] };
+  trySxform(from: string, to: string, et: number): { found: boolean; value?: number[] };
+  transformVectors(from: string, to: string, ets: Float64Array, vecs: Float64Array, out?: Float64Array): Float64Array;
+  transformStates(from: string, to: string, ets: Float64Array, states: Float64Array, out?: Float64Array): Float64Array;
 
   reclat(rect: number[]): { radius: number; lon: number; lat: number };
   latrec(radius: number, lon: number, lat: number): number[];
@@ -462,6 +826,20 @@ export type NativeAddon = {
   vscl(s: number, v: readonly number[]): number[];
 
   mxm(a: readonly number[], b: readonly number[]): number[];
+
+  vcrssInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  vaddInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  vsubInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+  mxvInto(m: ArrayLike<number>, v: ArrayLike<number>, out: Float64Array): void;
+  mtxvInto(m: ArrayLike<number>, v: ArrayLike<number>, out: Float64Array): void;
+  mxmInto(a: ArrayLike<number>, b: ArrayLike<number>, out: Float64Array): void;
+
+  reclatBatch(rect: Float64Array, out?: Float64Array): Float64Array;
+  latrecBatch(lat: Float64Array, out?: Float64Array): Float64Array;
+  recsphBatch(rect: Float64Array, out?: Float64Array): Float64Array;
+  sphrecBatch(sph: Float64Array, out?: Float64Array): Float64Array;
+  georecBatch(geo: Float64Array, re: number, f: number, out?: Float64Array): Float64Array;
+  recgeoBatch(rect: Float64Array, re: number, f: number, out?: Float64Array): Float64Array;
   rotate(angle: number, axis: number): number[];
   rotmat(m: readonly number[], angle: number, axis: number): number[];
   axisar(axis: readonly number[], angle: number): number[];
@@ -497,6 +875,28 @@ export type NativeAddon = {
   wnfetd(window: number, index: number): number[];
   wnvald(size: number, n: number, window: number): void;
 
+  cellToTypedArray(cell: number): Int32Array | Float64Array;
+  cellFromTypedArray(values: Int32Array | Float64Array, size: number | undefined): number;
+  windowToFloat64Array(window: number): Float64Array;
+  windowFromFloat64Array(endpoints: Float64Array, maxIntervals: number | undefined): number;
+
+  wnunidPacked(a: number | Float64Array, b: number | Float64Array, out: number | undefined): Float64Array | undefined;
+  wnintdPacked(a: number | Float64Array, b: number | Float64Array, out: number | undefined): Float64Array | undefined;
+  wndifdPacked(a: number | Float64Array, b: number | Float64Array, out: number | undefined): Float64Array | undefined;
+  wnexpdPacked(
+    window: number | Float64Array,
+    left: number,
+    right: number,
+    out: number | undefined,
+  ): Float64Array | undefined;
+  wncondPacked(
+    window: number | Float64Array,
+    left: number,
+    right: number,
+    out: number | undefined,
+  ): Float64Array | undefined;
+  wnfltdPacked(window: number | Float64Array, small: number, out: number | undefined): Float64Array | undefined;
+
   /** Internal test helper (not part of the backend contract). */
   __ktotalAll(): number;
 };
@@ -0,0 +1,86 @@
+import { invariant } from "@rybosome/tspice-core";
+
+import type { NativeAddon } from "./addon.js";
+
+/**
+ * Node-only per-call deadline and cancellation (not part of the backend
+ * contract), accepted as a trailing argument by `gfsepAsync` / `gfdistAsync`
+ * and `spkezrBatch` / `spkposBatch`.
+ *
+ * Stopping is cooperative: GF searches poll between search steps (through
+ * CSPICE's GF interrupt hook) and batches between epochs, so the CSPICE lock
+ * is released shortly after the signal fires or the deadline passes. A
+ * cancelled call rejects (or throws) an `Error` named `AbortError`; one that
+ * ran out of time, an `Error` named `TimeoutError`. A GF search stopped once
+ * it was submitted leaves `result` empty; one whose signal was already aborted
+ * is never submitted.
+ */
+export interface NodeCallOptions {
+  /**
+   * Cancels the call when aborted. A synchronous batch blocks the JS thread,
+   * so only a signal that is already aborted can stop it.
+   */
+  signal?: AbortSignal;
+  /**
+   * Milliseconds the call may take, counted from when it is made (time spent
+   * waiting for the CSPICE lock counts too).
+   */
+  timeoutMs?: number;
+}
+
+/** What the native addon takes in place of {@link NodeCallOptions}. */
+export type NativeCallOptions = { token?: number; timeoutMs?: number };
+
+function abortError(name: string): Error {
+  const error = new Error(`${name}(): cancelled`);
+  error.name = "AbortError";
+  return error;
+}
+
+function assertCallOptions(name: string, options: NodeCallOptions | undefined): void {
+  invariant(
+    options === undefined || (typeof options === "object" && options !== null),
+    `${name}(options): expected { signal?, timeoutMs? } or undefined`,
+  );
+}
+
+/**
+ * Runs the async native call `call` with `options` translated for the addon:
+ * a signal becomes a native cancel token for the duration of the call.
+ */
+export async function withCallOptions<T>(
+  native: NativeAddon,
+  name: string,
+  options: NodeCallOptions | undefined,
+  call: (nativeOptions: NativeCallOptions | undefined) => Promise<T>,
+): Promise<T> {
+  assertCallOptions(name, options);
+  if (options === undefined) return call(undefined);
+
+  const { signal, timeoutMs } = options;
+  if (signal === undefined) return call({ timeoutMs });
+  if (signal.aborted) throw abortError(name);
+
+  const token = native.newCancelToken();
+  const onAbort = (): void => native.cancelToken(token);
+  signal.addEventListener("abort", onAbort, { once: true });
+  try {
+    return await call({ token, timeoutMs });
+  } finally {
+    signal.removeEventListener("abort", onAbort);
+    native.freeCancelToken(token);
+  }
+}
+
+/** Synchronous counterpart of {@link withCallOptions}. */
+export function withCallOptionsSync<T>(
+  name: string,
+  options: NodeCallOptions | undefined,
+  call: (nativeOptions: NativeCallOptions | undefined) => T,
+): T {
+  assertCallOptions(name, options);
+  if (options === undefined) return call(undefined);
+  // The signal cannot fire while the call holds the JS thread.
+  if (options.signal?.aborted) throw abortError(name);
+  return call({ timeoutMs: options.timeoutMs });
+}
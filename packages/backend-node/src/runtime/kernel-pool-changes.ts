@@ -0,0 +1,105 @@
+import { invariant } from "@rybosome/tspice-core";
+
+import type { NativeAddon } from "./addon.js";
+
+/**
+ * What changed since the previous notification:
+ *
+ * - `"kernels"`: `furnsh` / `unload` / `kclear` (which can also change pool variables and body
+ *   mappings, so treat it as affecting everything)
+ * - `"variables"`: `pdpool` / `pipool` / `pcpool`
+ * - `"bodies"`: `boddef`
+ */
+export type KernelPoolChangeKind = "kernels" | "variables" | "bodies";
+
+export type KernelPoolChangeEvent = {
+  /** The native kernel-pool generation after the change (see `kernelPoolGeneration()`). */
+  generation: number;
+  kinds: readonly KernelPoolChangeKind[];
+};
+
+export type KernelPoolChangeListener = (event: KernelPoolChangeEvent) => void;
+
+const KINDS: readonly KernelPoolChangeKind[] = ["kernels", "variables", "bodies"];
+
+type Generations = { total: number } & Record<KernelPoolChangeKind, number>;
+
+// CSPICE state is process-wide, so listeners are too: a `furnsh` through one backend instance
+// notifies subscribers of every other instance in this JS realm.
+const listeners = new Set<KernelPoolChangeListener>();
+let seen: Generations | undefined;
+
+function readGeneration(native: NativeAddon, kind?: KernelPoolChangeKind): number {
+  const generation = native.kernelPoolGeneration(kind);
+  invariant(typeof generation === "number", "Expected kernelPoolGeneration() to return a number");
+  return generation;
+}
+
+function readGenerations(native: NativeAddon): Generations {
+  return {
+    total: readGeneration(native),
+    kernels: readGeneration(native, "kernels"),
+    variables: readGeneration(native, "variables"),
+    bodies: readGeneration(native, "bodies"),
+  };
+}
+
+/**
+ * Notify subscribers if the native generation moved. Called by every mutating wrapper after the
+ * native call returns (or throws).
+ *
+ * Mutations made elsewhere in the process (another `worker_thread`) bump the same native counters
+ * but are only reported here with the next local mutation; poll `kernelPoolGeneration()` for those.
+ */
+export function publishKernelPoolChanges(native: NativeAddon): void {
+  if (listeners.size === 0) {
+    return;
+  }
+
+  const total = readGeneration(native);
+  if (seen !== undefined && seen.total === total) {
+    return;
+  }
+
+  const next = readGenerations(native);
+  const prev = seen;
+  seen = next;
+  const event: KernelPoolChangeEvent = {
+    generation: next.total,
+    kinds: prev === undefined ? KINDS : KINDS.filter((kind) => next[kind] !== prev[kind]),
+  };
+
+  // Snapshot so listeners can unsubscribe while being notified. A throwing listener must not
+  // turn a successful `furnsh` into a failure, so its error is rethrown asynchronously.
+  for (const listener of [...listeners]) {
+    try {
+      listener(event);
+    } catch (err) {
+      queueMicrotask(() => {
+        throw err;
+      });
+    }
+  }
+}
+
+/** Register `listener` for kernel-pool changes; returns an idempotent unsubscribe function. */
+export function subscribeKernelPoolChanges(
+  native: NativeAddon,
+  listener: KernelPoolChangeListener,
+): () => void {
+  invariant(typeof listener === "function", "subscribeKernelPoolChanges(listener): expected a function");
+
+  if (listeners.size === 0) {
+    seen = readGenerations(native);
+  }
+  // Wrap so the same function can be subscribed twice and unsubscribed independently.
+  const entry: KernelPoolChangeListener = (event) => listener(event);
+  listeners.add(entry);
+
+  return () => {
+    listeners.delete(entry);
+    if (listeners.size === 0) {
+      seen = undefined;
+    }
+  };
+}
@@ -14,8 +14,8 @@ export type KernelStager = {
   kclear(native: NativeAddon): void;
 
   /**
-   * If `path` matches a byte-staged kernel, returns the resolved OS temp-file
-   * path. Otherwise returns a canonicalized virtual kernel identifier (or the
+   * If `path` matches a byte-staged kernel, returns the resolved OS path
+   * (temp file or in-memory `/proc/self/fd/...` path). Otherwise returns a canonicalized virtual kernel identifier (or the
    * original OS path).
    */
   resolvePath(path: string): string;
@@ -33,10 +33,18 @@ export type KernelStager = {
   virtualizePathFromSpice(path: string): string;
 };
 
-/** Create a staging helper that maps virtual kernel IDs to OS temp files for the native backend. */
+/**
+ * Create a staging helper that maps virtual kernel IDs to OS paths for the native backend.
+ *
+ * Byte-backed kernels are loaded straight from memory via `native.furnshBuffer`
+ * where the addon supports it (Linux `memfd_create`), and staged to OS temp
+ * files otherwise.
+ */
 export function createKernelStager(): KernelStager {
   const tempByVirtualPath = new Map<string, string>();
   const virtualByTempPath = new Map<string, string>();
+  // Staged paths that are in-memory kernel buffers (released, not unlinked).
+  const bufferPaths = new Set<string>();
   let tempKernelRootDir: string | undefined;
 
   const VIRTUAL_KERNEL_ROOT = "/kernels/";
@@ -115,6 +123,40 @@ export function createKernelStager(): KernelStager {
     }
   }
 
+  function kernelBuffersSupported(native: NativeAddon): boolean {
+    return typeof native.kernelBuffersSupported === "function" && native.kernelBuffersSupported();
+  }
+
+  function releaseStaged(stagedPath: string, native: NativeAddon): void {
+    if (bufferPaths.delete(stagedPath)) {
+      native.releaseKernelBuffer(stagedPath);
+      return;
+    }
+    safeUnlink(stagedPath);
+  }
+
+  function stageBytes(virtualPath: string, bytes: Uint8Array, native: NativeAddon): string {
+    const fileName = path.basename(virtualPath) || "kernel";
+
+    if (kernelBuffersSupported(native)) {
+      const bufferPath = native.furnshBuffer(fileName, bytes);
+      bufferPaths.add(bufferPath);
+      return bufferPath;
+    }
+
+    const rootDir = ensureTempKernelRootDir();
+    const tempPath = path.join(rootDir, `${randomUUID()}-${fileName}`);
+    fs.writeFileSync(tempPath, bytes);
+
+    try {
+      native.furnsh(tempPath);
+    } catch (error) {
+      safeUnlink(tempPath);
+      throw error;
+    }
+    return tempPath;
+  }
+
   function resolvePathForSpice(input: string): string {
     const canonical = tryCanonicalVirtualKernelPath(input);
     if (!canonical) {
@@ -138,28 +180,18 @@ export function createKernelStager(): KernelStager {
 
       const virtualPath = canonicalVirtualKernelPath(kernel.path);
 
-      // For byte-backed kernels, we write to a temp file and load via CSPICE.
-      // We then remember the resolved temp path so `unload(kernel.path)` unloads
-      // the correct file.
+      // For byte-backed kernels, we load from an in-memory buffer (or a temp
+      // file) via CSPICE. We then remember the resolved path so
+      // `unload(kernel.path)` unloads the correct file.
       const existingTemp = tempByVirtualPath.get(virtualPath);
       if (existingTemp) {
         native.unload(existingTemp);
         tempByVirtualPath.delete(virtualPath);
         virtualByTempPath.delete(existingTemp);
-        safeUnlink(existingTemp);
+        releaseStaged(existingTemp, native);
       }
 
-      const rootDir = ensureTempKernelRootDir();
-      const fileName = path.basename(virtualPath) || "kernel";
-      const tempPath = path.join(rootDir, `${randomUUID()}-${fileName}`);
-      fs.writeFileSync(tempPath, kernel.bytes);
-
-      try {
-        native.furnsh(tempPath);
-      } catch (error) {
-        safeUnlink(tempPath);
-        throw error;
-      }
+      const tempPath = stageBytes(virtualPath, kernel.bytes, native);
 
       tempByVirtualPath.set(virtualPath, tempPath);
       virtualByTempPath.set(tempPath, virtualPath);
@@ -172,7 +204,7 @@ export function createKernelStager(): KernelStager {
         native.unload(resolved);
         tempByVirtualPath.delete(canonical!);
         virtualByTempPath.delete(resolved);
-        safeUnlink(resolved);
+        releaseStaged(resolved, native);
         return;
       }
 
@@ -182,9 +214,9 @@ export function createKernelStager(): KernelStager {
     kclear: (native) => {
       native.kclear();
 
-      // Clear any byte-backed kernels we staged to temp files.
+      // Clear any byte-backed kernels we staged to temp files or buffers.
       for (const tempPath of tempByVirtualPath.values()) {
-        safeUnlink(tempPath);
+        releaseStaged(tempPath, native);
       }
       tempByVirtualPath.clear();
       virtualByTempPath.clear();
@@ -0,0 +1,93 @@
+import { invariant } from "@rybosome/tspice-core";
+
+import { getNativeAddon } from "./addon.js";
+
+/**
+ * A log-linear latency histogram: every power of two nanoseconds is split into 4 buckets, so
+ * quantiles are within ~19% of the recorded values.
+ */
+export type NativeLatencyHistogram = {
+  count: number;
+  sumNs: number;
+  maxNs: number;
+  p50Ns: number;
+  p90Ns: number;
+  p99Ns: number;
+  /** Non-empty buckets, packed as `[lowerBoundNs0, count0, lowerBoundNs1, count1, ...]`. */
+  buckets: Float64Array;
+};
+
+export type NativeExportStats = {
+  calls: number;
+  /** Calls that threw. */
+  errors: number;
+  /** Wall time of each call (for async exports, only the synchronous part). */
+  total: NativeLatencyHistogram;
+  /** Time spent waiting for the CSPICE mutex, per acquisition. */
+  lockWait: NativeLatencyHistogram;
+  /** Time the CSPICE mutex was held (CSPICE work plus handle-registry access), per acquisition. */
+  cspice: NativeLatencyHistogram;
+  /** Per call, wall time minus lock wait and hold: argument conversion and result building. */
+  marshal: NativeLatencyHistogram;
+};
+
+/** Live native allocations of one kind, as reported to V8 via `napi_adjust_external_memory`. */
+export type NativeMemoryKindStats = {
+  count: number;
+  bytes: number;
+};
+
+/**
+ * Process-wide native memory held on behalf of JS, by kind. Sizes are what the addon allocated
+ * (element storage and headers), not allocator overhead.
+ */
+export type NativeMemoryStats = {
+  /** Cells from `newIntCell` / `newDoubleCell` / `newCharCell` / `cellFromTypedArray`. */
+  cells: NativeMemoryKindStats;
+  /** Windows from `newWindow` / `windowFromFloat64Array`. */
+  windows: NativeMemoryKindStats;
+  /** State buffers of open `spkwStream` writers. */
+  spkStreams: NativeMemoryKindStats;
+  /** Indexes from `dskBvhBuild` that have not been disposed. */
+  dskBvhs: NativeMemoryKindStats;
+  /**
+   * Byte-backed kernels loaded from memory (`furnsh({ path, bytes })` on Linux) and not yet
+   * unloaded. Shared by every environment, like the kernel pool.
+   */
+  kernelBuffers: NativeMemoryKindStats;
+  totalBytes: number;
+};
+
+export type NativeStats = {
+  /** Whether the addon was loaded with `TSPICE_NATIVE_STATS` set. */
+  enabled: boolean;
+  /**
+   * Per addon export that has been called since the last reset. Lock time taken outside any
+   * export call (async workers, the CSPICE executor) is reported under `"(unattributed)"`.
+   */
+  exports: Record<string, NativeExportStats>;
+  /** Native memory breakdown; collected whether or not `enabled` is set. */
+  memory: NativeMemoryStats;
+};
+
+/**
+ * Read the native addon's per-export call counters and latency histograms.
+ *
+ * Collection is opt-in for the life of the process: set `TSPICE_NATIVE_STATS=1` before the
+ * addon is loaded. Otherwise `exports` is empty; `memory` is always filled in. Counters are shared
+ * by every backend instance and worker thread in the process; names are the native export names,
+ * which may differ from the backend method that calls them.
+ */
+export function getNativeStats(): NativeStats {
+  const stats = getNativeAddon().getNativeStats();
+  invariant(
+    typeof stats === "object" && stats !== null && typeof stats.enabled === "boolean",
+    "Expected native getNativeStats() to return an object",
+  );
+  return stats;
+}
+
+/** Zero every counter reported by {@link getNativeStats}. */
+export function resetNativeStats(): void {
+  getNativeAddon().resetNativeStats();
+}
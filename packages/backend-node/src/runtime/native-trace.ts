@@ -0,0 +1,23 @@
+import { invariant } from "@rybosome/tspice-core";
+
+import { getNativeAddon } from "./addon.js";
+
+/**
+ * Drain the native addon's trace recorder as Chrome Trace Event JSON.
+ *
+ * Recording is opt-in for the life of the process: set `TSPICE_NATIVE_TRACE=1` before the addon
+ * is loaded. Otherwise this returns `null`. The result holds every event recorded since the
+ * previous call (each native thread keeps its most recent 65536): one span per addon export
+ * call, per wait for the CSPICE mutex and per hold of it, on one track per native thread
+ * (JS threads, libuv workers, the CSPICE executor). Write it to a `.json` file and open it in
+ * the Perfetto UI or `chrome://tracing`. `otherData.droppedEvents` counts events overwritten
+ * before they were drained.
+ */
+export function takeNativeTrace(): string | null {
+  const trace = getNativeAddon().takeNativeTrace();
+  invariant(
+    trace === null || typeof trace === "string",
+    "Expected native takeNativeTrace() to return a string or null",
+  );
+  return trace;
+}
@@ -0,0 +1,40 @@
+import { invariant } from "@rybosome/tspice-core";
+
+import { getNativeAddon } from "./addon.js";
+
+/** Counters reported by {@link getQueryCacheStats}. */
+export type QueryCacheStats = {
+  /** Entry cap set by {@link setQueryCacheCapacity} (`0` while the cache is off). */
+  capacity: number;
+  /** Entries currently held, including ones from an older kernel-pool generation. */
+  entries: number;
+  hits: number;
+  /** Lookups that found nothing or only a stale entry. */
+  misses: number;
+};
+
+/**
+ * Memoize `spkezr`, `pxform`, `sxform`, `bodvar` and `subpnt` results in the native addon.
+ *
+ * Process-wide and off by default (`0`). Entries are keyed on the exact arguments and stamped with
+ * the kernel-pool generation, so any `furnsh` / `unload` / `kclear` / pool write / `boddef`
+ * invalidates them. Hits are served without taking the CSPICE mutex and match the uncached result
+ * bit for bit; failures are never cached. Calling this again clears the cache and its counters.
+ */
+export function setQueryCacheCapacity(maxEntries: number): void {
+  invariant(
+    Number.isInteger(maxEntries) && maxEntries >= 0,
+    "setQueryCacheCapacity(maxEntries): expected a non-negative integer",
+  );
+  getNativeAddon().setQueryCacheCapacity(maxEntries);
+}
+
+/** Read the counters of the cache configured by {@link setQueryCacheCapacity}. */
+export function getQueryCacheStats(): QueryCacheStats {
+  const stats = getNativeAddon().queryCacheStats();
+  invariant(stats && typeof stats === "object", "Expected native queryCacheStats() to return an object");
+  for (const key of ["capacity", "entries", "hits", "misses"] as const) {
+    invariant(typeof stats[key] === "number", `Expected queryCacheStats().${key} to be a number`);
+  }
+  return stats;
+}
@@ -33,6 +33,35 @@ function registerExitCleanup(fn: ExitCleanupFn): () => void {
   };
 }
 
+// Parent of each stager's temp root; `undefined` means `os.tmpdir()`.
+let stagingParentDir: string | undefined;
+
+/**
+ * Stage `VirtualOutput` files under `dir` instead of `os.tmpdir()`.
+ *
+ * Process-wide; applies to backends whose first output is created afterwards.
+ * Pointing it at a memory-backed filesystem (e.g. `/dev/shm` on Linux) keeps
+ * generated kernels off disk entirely. Pass `undefined` to restore the default.
+ */
+export function setVirtualOutputStagingDir(dir: string | undefined): void {
+  invariant(
+    dir === undefined || (typeof dir === "string" && dir.length > 0),
+    "setVirtualOutputStagingDir(dir): expected a non-empty string or undefined",
+  );
+  stagingParentDir = dir;
+}
+
+export type VirtualOutputStagerOptions = {
+  /**
+   * Maps a closed output file into memory and returns its bytes without
+   * copying them, or `null` when that is not possible (the file is then read
+   * normally). Only used by `takeVirtualOutput`, which removes the file right
+   * away: a mapping of a file that stays staged would see a later `spkopa`
+   * rewrite it, and fault if the file shrank.
+   */
+  mapFile?: (path: string) => ArrayBuffer | null;
+};
+
 export type VirtualOutputStager = {
   /** Resolve an output target (path or VirtualOutput) to an OS path for CSPICE. */
   resolvePathForSpice(target: string | VirtualOutput): string;
@@ -40,6 +69,12 @@ export type VirtualOutputStager = {
   /** Read bytes for a previously-created VirtualOutput. */
   readVirtualOutput(output: VirtualOutput): Uint8Array;
 
+  /**
+   * Like `readVirtualOutput`, then removes the staged file, so the returned
+   * bytes are the only copy left.
+   */
+  takeVirtualOutput(output: VirtualOutput): Uint8Array;
+
   /** Mark a VirtualOutput as currently being written by a native handle. */
   markOpen(output: VirtualOutput): void;
 
@@ -51,7 +86,7 @@ export type VirtualOutputStager = {
 };
 
 /** Create a staging helper for VirtualOutput targets (written/read via OS temp files). */
-export function createVirtualOutputStager(): VirtualOutputStager {
+export function createVirtualOutputStager(options: VirtualOutputStagerOptions = {}): VirtualOutputStager {
   let tempRootDir: string | undefined;
   let unregisterExitCleanupFn: (() => void) | undefined;
   let disposed = false;
@@ -81,7 +116,7 @@ export function createVirtualOutputStager(): VirtualOutputStager {
     if (tempRootDir) {
       return tempRootDir;
     }
-    tempRootDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-outputs-"));
+    tempRootDir = fs.mkdtempSync(path.join(stagingParentDir ?? os.tmpdir(), "tspice-outputs-"));
 
     // Ensure we don't leak temp dirs in long-running processes where
     // the backend is created but not explicitly disposed.
@@ -119,6 +154,37 @@ export function createVirtualOutputStager(): VirtualOutputStager {
     return abs;
   }
 
+  function readOutputBytes(output: VirtualOutput, context: string, map: boolean): Uint8Array {
+    const outPath = resolveVirtualOutputPath(output.path, `${context}(output)`);
+
+    if ((openOutputRefCount.get(outPath) ?? 0) > 0) {
+      throw new Error(
+        `${context}(): VirtualOutput ${JSON.stringify(output.path)} is still open. ` +
+          "Close the writer handle first (e.g. spkcls(handle)) before reading bytes.",
+      );
+    }
+
+    try {
+      const mapped = map ? options.mapFile?.(outPath) : null;
+      if (mapped) {
+        return new Uint8Array(mapped);
+      }
+      const buf = fs.readFileSync(outPath);
+      // Return a plain Uint8Array (not a Node Buffer) per the backend contract.
+      return new Uint8Array(buf.buffer, buf.byteOffset, buf.byteLength);
+    } catch (error) {
+      const code = (error as NodeJS.ErrnoException | undefined)?.code;
+      if (code === "ENOENT" || !fs.existsSync(outPath)) {
+        throw new Error(
+          `${context}(): no staged file found for VirtualOutput path ${JSON.stringify(output.path)}. ` +
+            "This can happen if the output was never created, or if the writer handle has not been closed yet (e.g. call spkcls(handle) before reading).",
+          { cause: error },
+        );
+      }
+      throw error;
+    }
+  }
+
   return {
     resolvePathForSpice: (target) => {
       ensureNotDisposed("resolvePathForSpice(target)");
@@ -135,30 +201,15 @@ export function createVirtualOutputStager(): VirtualOutputStager {
 
     readVirtualOutput: (output) => {
       ensureNotDisposed("readVirtualOutput(output)");
-      const outPath = resolveVirtualOutputPath(output.path, "readVirtualOutput(output)");
-
-      if ((openOutputRefCount.get(outPath) ?? 0) > 0) {
-        throw new Error(
-          `readVirtualOutput(): VirtualOutput ${JSON.stringify(output.path)} is still open. ` +
-            "Close the writer handle first (e.g. spkcls(handle)) before reading bytes.",
-        );
-      }
+      return readOutputBytes(output, "readVirtualOutput", false);
+    },
 
-      try {
-        const buf = fs.readFileSync(outPath);
-        // Return a plain Uint8Array (not a Node Buffer) per the backend contract.
-        return new Uint8Array(buf.buffer, buf.byteOffset, buf.byteLength);
-      } catch (error) {
-        const code = (error as NodeJS.ErrnoException | undefined)?.code;
-        if (code === "ENOENT") {
-          throw new Error(
-            `readVirtualOutput(): no staged file found for VirtualOutput path ${JSON.stringify(output.path)}. ` +
-              "This can happen if the output was never created, or if the writer handle has not been closed yet (e.g. call spkcls(handle) before reading).",
-            { cause: error },
-          );
-        }
-        throw error;
-      }
+    takeVirtualOutput: (output) => {
+      ensureNotDisposed("takeVirtualOutput(output)");
+      const bytes = readOutputBytes(output, "takeVirtualOutput", true);
+      // A mapped file stays readable through `bytes` after its last link is gone.
+      fs.rmSync(resolveVirtualOutputPath(output.path, "takeVirtualOutput(output)"), { force: true });
+      return bytes;
     },
 
     markOpen: (output) => {
@@ -0,0 +1,114 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend, createNodeBackendPool } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node process pool", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("broadcasts kernel loads and dispatches reads across children", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const pool = createNodeBackendPool({ size: 2, dispatch: "round-robin" });
+    const local = createNodeBackend();
+
+    try {
+      expect(pool.size).toBe(2);
+
+      await pool.call("furnsh", { path: "/kernels/naif0012.tls", bytes: lsk });
+      await pool.call("furnsh", { path: "/kernels/de405s.bsp", bytes: spk });
+      local.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      // Round-robin over 2 children: both must have every kernel loaded.
+      const ktotals = await Promise.all([pool.call("ktotal", "ALL"), pool.call("ktotal", "ALL")]);
+      expect(ktotals).toEqual([2, 2]);
+
+      const ets = [0, 3600, 86_400, 864_000];
+      const states = await Promise.all(
+        ets.map((et) => pool.call("spkezr", "EARTH", et, "J2000", "LT+S", "SUN")),
+      );
+      for (let i = 0; i < ets.length; i++) {
+        expect(states[i]).toEqual(local.spkezr("EARTH", ets[i]!, "J2000", "LT+S", "SUN"));
+      }
+
+      const batch = await pool.call("spkposBatch", "EARTH", new Float64Array(ets), "J2000", "NONE", "SUN");
+      expect(batch.positions).toBeInstanceOf(Float64Array);
+      expect(batch.positions.length).toBe(ets.length * 3);
+
+      await pool.call("kclear");
+      expect(await pool.call("ktotal", "ALL")).toBe(0);
+    } finally {
+      local.kclear();
+      await pool.dispose();
+    }
+  });
+
+  itNative("gfPartitioned matches a single search over the whole window", async () => {
+    const { spk } = await loadTestKernels();
+    const pool = createNodeBackendPool({ size: 2 });
+    const local = createNodeBackend();
+
+    try {
+      await pool.call("furnsh", { path: "/kernels/de405s.bsp", bytes: spk });
+      local.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      // Two intervals, so some cuts fall inside a gap-adjacent interval.
+      const cnfine = new Float64Array([0, 10 * 86_400, 12 * 86_400, 60 * 86_400]);
+
+      for (const relate of [">", "LOCMAX", "LOCMIN"]) {
+        const expected = local.gfdistPacked("MOON", "NONE", "EARTH", relate, 400_000, 0, 86_400, 100, cnfine);
+        expect(expected.length).toBeGreaterThan(0);
+
+        const actual = await pool.gfPartitioned(
+          "gfdistPacked",
+          ["MOON", "NONE", "EARTH", relate, 400_000, 0, 86_400, 100, cnfine],
+          { partitions: 5 },
+        );
+        expect(actual).toBeInstanceOf(Float64Array);
+        expect(actual.length).toBe(expected.length);
+        for (let i = 0; i < expected.length; i++) {
+          expect(Math.abs(actual[i]! - expected[i]!)).toBeLessThan(1e-3);
+        }
+      }
+
+      // Each piece must be at least two margins long; this collapses to one search.
+      const short = await pool.gfPartitioned(
+        "gfdistPacked",
+        ["MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, new Float64Array([0, 86_400])],
+        { partitions: 8 },
+      );
+      expect(short).toEqual(
+        local.gfdistPacked("MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, new Float64Array([0, 86_400])),
+      );
+
+      await expect(
+        pool.gfPartitioned("gfdistPacked", ["MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, cnfine], {
+          margin: 3600,
+        }),
+      ).rejects.toThrow(/margin/);
+    } finally {
+      local.kclear();
+      await pool.dispose();
+    }
+  });
+
+  itNative("propagates SPICE errors and rejects unsupported ops", async () => {
+    const pool = createNodeBackendPool({ size: 1 });
+
+    try {
+      await expect(pool.call("spkezr", "EARTH", 0, "J2000", "NONE", "SUN")).rejects.toMatchObject({
+        spiceShort: expect.stringMatching(/^SPICE\(/),
+      });
+
+      await expect(
+        (pool.call as (op: string, ...args: unknown[]) => Promise<unknown>)("newWindow", 10),
+      ).rejects.toThrow(/does not support op: newWindow/);
+    } finally {
+      await pool.dispose();
+    }
+
+    expect(pool.size).toBe(0);
+    await expect(pool.call("ktotal", "ALL")).rejects.toThrow(/disposed/);
+  });
+});
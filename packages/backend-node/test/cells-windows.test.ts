@@ -1,9 +1,18 @@
+import v8 from "node:v8";
+import vm from "node:vm";
+
 import { describe, expect, it } from "vitest";
 
-import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createNodeBackend, getNativeStats } from "@rybosome/tspice-backend-node";
 
 import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
 
+// `--expose-gc` for this process, whatever flags the test runner started it with.
+function exposeGc(): () => void {
+  v8.setFlagsFromString("--expose-gc");
+  return vm.runInNewContext("gc") as () => void;
+}
+
 describe("@rybosome/tspice-backend-node cells/windows", () => {
   const itNative = it.runIf(nodeAddonAvailable());
 
@@ -63,6 +72,80 @@ describe("@rybosome/tspice-backend-node cells/windows", () => {
     }
   });
 
+  itNative("copies whole cells and windows to and from typed arrays", () => {
+    const b = createNodeBackend();
+
+    const icell = b.cellFromTypedArray(new Int32Array([1, 2, 3]), 8);
+    const dcell = b.cellFromTypedArray(new Float64Array([-1.5, 2.25]));
+    const win = b.newWindow(4);
+    const sorted = b.windowFromFloat64Array(new Float64Array([0, 1, 2, 3, 5, 8]));
+    const unsorted = b.windowFromFloat64Array(new Float64Array([5, 8, 0, 1, 0.5, 3]), 10);
+
+    try {
+      expect(b.card(icell)).toBe(3);
+      expect(b.size(icell)).toBe(8);
+      expect(b.cellGeti(icell, 2)).toBe(3);
+      b.insrti(4, icell);
+      expect(Array.from(b.cellToTypedArray(icell))).toEqual([1, 2, 3, 4]);
+      expect(b.cellToTypedArray(icell)).toBeInstanceOf(Int32Array);
+      expect(Array.from(b.cellToTypedArray(dcell))).toEqual([-1.5, 2.25]);
+
+      b.wninsd(0, 1, win);
+      b.wninsd(2, 3, win);
+      expect(Array.from(b.windowToFloat64Array(win))).toEqual([0, 1, 2, 3]);
+
+      expect(b.wncard(sorted)).toBe(3);
+      expect(b.wnfetd(sorted, 2)).toEqual([5, 8]);
+      expect(Array.from(b.windowToFloat64Array(unsorted))).toEqual([0, 3, 5, 8]);
+      b.wninsd(9, 10, unsorted);
+      expect(b.wncard(unsorted)).toBe(3);
+
+      expect(() => b.windowFromFloat64Array(new Float64Array([0, 1, 2]))).toThrow(/even/);
+      expect(() => b.windowFromFloat64Array(new Float64Array([1, 0]))).toThrow();
+      expect(() => b.cellFromTypedArray(new Int32Array(4), 2)).toThrow(RangeError);
+    } finally {
+      b.freeCell(icell);
+      b.freeCell(dcell);
+      b.freeWindow(win);
+      b.freeWindow(sorted);
+      b.freeWindow(unsorted);
+    }
+  });
+
+  itNative("window set algebra matches the wn* examples", () => {
+    const b = createNodeBackend();
+
+    // The examples from the CSPICE wnunid_c / wnintd_c / wndifd_c / wnexpd_c / wncond_c headers.
+    const a = new Float64Array([1, 3, 7, 11, 23, 27]);
+    const bWin = b.windowFromFloat64Array(new Float64Array([2, 4, 8, 10, 16, 18]));
+    const out = b.newWindow(8);
+
+    try {
+      expect(Array.from(b.wnunidPacked(a, bWin))).toEqual([1, 4, 7, 11, 16, 18, 23, 27]);
+      expect(Array.from(b.wnintdPacked(a, bWin))).toEqual([2, 3, 8, 10]);
+      expect(Array.from(b.wndifdPacked(a, bWin))).toEqual([1, 2, 7, 8, 10, 11, 23, 27]);
+      expect(Array.from(b.wnexpdPacked(a, 2, 1))).toEqual([-1, 4, 5, 12, 21, 28]);
+      expect(Array.from(b.wncondPacked(a, 2, 1))).toEqual([9, 10, 25, 26]);
+      expect(Array.from(b.wnfltdPacked(a, 3))).toEqual([7, 11, 23, 27]);
+
+      // Touching intervals intersect in a point; removing a point leaves an interval unchanged.
+      expect(Array.from(b.wnintdPacked(new Float64Array([0, 1]), new Float64Array([1, 2])))).toEqual([1, 1]);
+      expect(Array.from(b.wndifdPacked(new Float64Array([0, 2]), new Float64Array([1, 1])))).toEqual([0, 2]);
+
+      b.wnunidPacked(a, bWin, out);
+      expect(b.wncard(out)).toBe(4);
+      expect(b.wnfetd(out, 1)).toEqual([7, 11]);
+      b.wnintdPacked(out, bWin, out);
+      expect(Array.from(b.windowToFloat64Array(out))).toEqual([2, 4, 8, 10, 16, 18]);
+
+      expect(() => b.wnunidPacked(new Float64Array([3, 1]), a)).toThrow(RangeError);
+      expect(() => b.wnunidPacked(new Float64Array([0, 2, 1, 3]), a)).toThrow(RangeError);
+    } finally {
+      b.freeWindow(bWin);
+      b.freeWindow(out);
+    }
+  });
+
   itNative("throws on capacity overflow (CSPICE-like)", () => {
     const b = createNodeBackend();
 
@@ -75,4 +158,80 @@ describe("@rybosome/tspice-backend-node cells/windows", () => {
       b.freeCell(icell);
     }
   });
+
+  itNative("rejects freed handles even after their slot is recycled", () => {
+    const b = createNodeBackend();
+
+    const stale = b.newWindow(4);
+    b.freeWindow(stale);
+    expect(() => b.wncard(stale)).toThrow(/unknown\/expired/);
+
+    const handles = Array.from({ length: 64 }, () => b.newWindow(4));
+    try {
+      expect(handles).not.toContain(stale);
+      expect(new Set(handles).size).toBe(handles.length);
+      expect(() => b.wncard(stale)).toThrow(/unknown\/expired/);
+
+      b.wninsd(1, 2, handles[0]!);
+      expect(b.wncard(handles[0]!)).toBe(1);
+    } finally {
+      for (const h of handles) b.freeWindow(h);
+    }
+  });
+  itNative("reports cell and window storage in getNativeStats().memory", () => {
+    const b = createNodeBackend();
+    const before = getNativeStats().memory;
+
+    const cell = b.newDoubleCell(1000);
+    const window = b.newWindow(500);
+    const during = getNativeStats().memory;
+    expect(during.cells.count).toBe(before.cells.count + 1);
+    expect(during.cells.bytes - before.cells.bytes).toBeGreaterThanOrEqual(1000 * 8);
+    expect(during.windows.count).toBe(before.windows.count + 1);
+    expect(during.windows.bytes - before.windows.bytes).toBeGreaterThanOrEqual(1000 * 8);
+    expect(during.totalBytes).toBeGreaterThan(before.totalBytes);
+
+    b.freeCell(cell);
+    b.freeWindow(window);
+    const after = getNativeStats().memory;
+    expect(after.cells).toEqual(before.cells);
+    expect(after.windows).toEqual(before.windows);
+  });
+
+  itNative("manageCell/manageWindow free once, explicitly or on collection", () => {
+    const b = createNodeBackend();
+    const before = getNativeStats().memory;
+
+    const cell = b.manageCell(b.newIntCell(10));
+    b.insrti(4, cell.handle);
+    expect(b.card(cell.handle)).toBe(1);
+    cell.free();
+    cell.free();
+    expect(() => b.card(cell.handle)).toThrow(/unknown\/expired/);
+
+    const window = b.manageWindow(b.newWindow(4));
+    b.wninsd(0, 1, window.handle);
+    window.free();
+    expect(getNativeStats().memory.cells).toEqual(before.cells);
+    expect(getNativeStats().memory.windows).toEqual(before.windows);
+  });
+
+  itNative("manageCell frees a dropped cell when it is collected", async () => {
+    const b = createNodeBackend();
+    const gc = exposeGc();
+    const before = getNativeStats().memory.cells;
+
+    (() => {
+      const cell = b.manageCell(b.newIntCell(1000));
+      b.insrti(1, cell.handle);
+    })();
+    expect(getNativeStats().memory.cells.count).toBe(before.count + 1);
+
+    // FinalizationRegistry callbacks run in a task after the collection.
+    for (let i = 0; i < 50 && getNativeStats().memory.cells.count !== before.count; i++) {
+      gc();
+      await new Promise((resolve) => setImmediate(resolve));
+    }
+    expect(getNativeStats().memory.cells).toEqual(before);
+  });
 });
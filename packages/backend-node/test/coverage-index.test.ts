@@ -0,0 +1,98 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node coverage index", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("spkobjIds/spkcovIntervals match spkobj/spkcov", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const path = "/kernels/de405s.bsp";
+
+    try {
+      backend.furnsh({ path, bytes: spk });
+
+      const cell = backend.newIntCell(1000);
+      backend.spkobj(path, cell);
+      const expectedIds: number[] = [];
+      for (let i = 0; i < backend.card(cell); i++) expectedIds.push(backend.cellGeti(cell, i));
+      backend.freeCell(cell);
+
+      const ids = backend.spkobjIds(path);
+      expect(ids).toBeInstanceOf(Int32Array);
+      expect(Array.from(ids)).toEqual(expectedIds);
+      expect(Array.from(backend.spkobjIds(path))).toEqual(expectedIds);
+
+      for (const id of expectedIds) {
+        const window = backend.newWindow(1000);
+        backend.spkcov(path, id, window);
+        const expected: number[] = [];
+        for (let i = 0; i < backend.wncard(window); i++) expected.push(...backend.wnfetd(window, i));
+        backend.freeWindow(window);
+
+        const intervals = backend.spkcovIntervals(path, id);
+        expect(intervals).toBeInstanceOf(Float64Array);
+        expect(Array.from(intervals)).toEqual(expected);
+      }
+
+      expect(backend.spkcovIntervals(path, 123_456_789)).toHaveLength(0);
+      expect(() => backend.spkcovIntervals("/kernels/does-not-exist.bsp", 399)).toThrow();
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("the index is rebuilt after unload/furnsh", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const path = "/kernels/de405s.bsp";
+
+    try {
+      backend.furnsh({ path, bytes: spk });
+      const before = Array.from(backend.spkcovIntervals(path, 399));
+      backend.unload(path);
+
+      backend.furnsh({ path, bytes: spk });
+      expect(Array.from(backend.spkcovIntervals(path, 399))).toEqual(before);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("trySpkezr/tryPxform report missing data as not found", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const et = 86_400;
+      const hit = backend.trySpkezr("EARTH", et, "J2000", "LT+S", "SUN");
+      const boxed = backend.spkezr("EARTH", et, "J2000", "LT+S", "SUN");
+      expect(hit).toEqual({ found: true, state: boxed.state, lt: boxed.lt });
+
+      // Far outside the test SPK's coverage, with and without light-time correction.
+      expect(backend.trySpkezr("EARTH", 1e12, "J2000", "NONE", "SUN")).toEqual({ found: false });
+      expect(backend.trySpkezr("EARTH", 1e12, "J2000", "LT+S", "SUN")).toEqual({ found: false });
+      expect(backend.failed()).toBe(false);
+
+      // Not a coverage gap: still throws.
+      expect(() => backend.trySpkezr("EARTH", et, "NOT_A_FRAME", "NONE", "SUN")).toThrow();
+
+      const m = backend.tryPxform("J2000", "ECLIPJ2000", et);
+      expect(m.found && Array.from(m.value)).toEqual(Array.from(backend.pxform("J2000", "ECLIPJ2000", et)));
+      expect(() => backend.tryPxform("J2000", "NOT_A_FRAME", et)).toThrow();
+
+      // Unloading the SPK invalidates the pre-check's view of what is loaded.
+      backend.unload("/kernels/de405s.bsp");
+      expect(backend.trySpkezr("EARTH", et, "J2000", "NONE", "SUN")).toEqual({ found: false });
+    } finally {
+      backend.kclear();
+    }
+  });
+});
@@ -0,0 +1,261 @@
+import fs from "node:fs";
+import os from "node:os";
+import path from "node:path";
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const APOPHIS_DSK = fileURLToPath(
+  new URL(
+    "../../tspice/test/fixtures/kernels/dsk-minimal/apophis_g_25000mm_rad_obj_0000n00000_v001.bds",
+    import.meta.url,
+  ),
+);
+
+// A bumpy latitude/longitude sphere, so plates are not all the same size or distance from the center.
+function bumpySphere(nlat: number, nlon: number): { vrtces: number[]; plates: number[] } {
+  const vrtces: number[] = [0, 0, 1.1];
+  for (let i = 1; i < nlat; i++) {
+    for (let j = 0; j < nlon; j++) {
+      const th = (Math.PI * i) / nlat;
+      const ph = (2 * Math.PI * j) / nlon;
+      const r = 1 + 0.1 * Math.sin(3 * th) * Math.cos(2 * ph);
+      vrtces.push(r * Math.sin(th) * Math.cos(ph), r * Math.sin(th) * Math.sin(ph), r * Math.cos(th));
+    }
+  }
+  vrtces.push(0, 0, -0.9);
+
+  const south = vrtces.length / 3;
+  const id = (i: number, j: number) => 2 + (i - 1) * nlon + (j % nlon);
+  const plates: number[] = [];
+  for (let j = 0; j < nlon; j++) plates.push(1, id(1, j), id(1, j + 1));
+  for (let i = 1; i < nlat - 1; i++) {
+    for (let j = 0; j < nlon; j++) {
+      plates.push(id(i, j), id(i + 1, j), id(i + 1, j + 1));
+      plates.push(id(i, j), id(i + 1, j + 1), id(i, j + 1));
+    }
+  }
+  for (let j = 0; j < nlon; j++) plates.push(south, id(nlat - 1, j + 1), id(nlat - 1, j));
+  return { vrtces, plates };
+}
+
+// Nearest hit by testing every plate.
+function bruteForceRaycast(
+  vrtces: number[],
+  plates: number[],
+  o: ArrayLike<number>,
+  d: ArrayLike<number>,
+): { t: number; plate: number } | undefined {
+  let best: { t: number; plate: number } | undefined;
+  for (let p = 0; p < plates.length / 3; p++) {
+    const a = (plates[p * 3]! - 1) * 3;
+    const b = (plates[p * 3 + 1]! - 1) * 3;
+    const c = (plates[p * 3 + 2]! - 1) * 3;
+    const e1 = [0, 1, 2].map((k) => vrtces[b + k]! - vrtces[a + k]!);
+    const e2 = [0, 1, 2].map((k) => vrtces[c + k]! - vrtces[a + k]!);
+    const s = [0, 1, 2].map((k) => o[k]! - vrtces[a + k]!);
+    const pv = [d[1]! * e2[2]! - d[2]! * e2[1]!, d[2]! * e2[0]! - d[0]! * e2[2]!, d[0]! * e2[1]! - d[1]! * e2[0]!];
+    const det = e1[0]! * pv[0]! + e1[1]! * pv[1]! + e1[2]! * pv[2]!;
+    if (det === 0) continue;
+    const u = (s[0]! * pv[0]! + s[1]! * pv[1]! + s[2]! * pv[2]!) / det;
+    if (u < 0 || u > 1) continue;
+    const qv = [s[1]! * e1[2]! - s[2]! * e1[1]!, s[2]! * e1[0]! - s[0]! * e1[2]!, s[0]! * e1[1]! - s[1]! * e1[0]!];
+    const v = (d[0]! * qv[0]! + d[1]! * qv[1]! + d[2]! * qv[2]!) / det;
+    if (v < 0 || u + v > 1) continue;
+    const t = (e2[0]! * qv[0]! + e2[1]! * qv[1]! + e2[2]! * qv[2]!) / det;
+    if (t >= 0 && (best === undefined || t < best.t)) best = { t, plate: p + 1 };
+  }
+  return best;
+}
+
+describe("@rybosome/tspice-backend-node DSK plate index", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("matches a brute-force cast over every plate", () => {
+    const backend = createNodeBackend();
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-dsk-bvh-"));
+
+    try {
+      const dskPath = path.join(tmpDir, "bumpy.bds");
+      const { vrtces, plates } = bumpySphere(24, 48);
+      const nv = vrtces.length / 3;
+      const np = plates.length / 3;
+
+      const writer = backend.dskopn(dskPath, "TSPICE", 0);
+      try {
+        const { spaixd, spaixi } = backend.dskmi2(nv, vrtces, np, plates, 5.0, 4, 500_000, 100_000, 100_000, true, 1_000_000);
+        backend.dskw02(
+          writer,
+          399,
+          1,
+          1, // dclass = SPICE_DSK_SVFCLS
+          "J2000",
+          3, // corsys = SPICE_DSK_RECSYS
+          new Array(10).fill(0),
+          -1.2,
+          1.2,
+          -1.2,
+          1.2,
+          -1.2,
+          1.2,
+          0,
+          1,
+          nv,
+          vrtces,
+          np,
+          plates,
+          spaixd,
+          spaixi,
+        );
+      } finally {
+        backend.dascls(writer);
+      }
+
+      const handle = backend.dasopr(dskPath);
+      const first = backend.dlabfs(handle);
+      if (!first.found) throw new Error("Expected a DLA segment in the written DSK");
+      const index = backend.dskPlateIndex(handle, first.descr);
+      // The index keeps its own copy of the mesh.
+      backend.dascls(handle);
+
+      try {
+        expect(index.nv).toBe(nv);
+        expect(index.np).toBe(np);
+
+        // Rays from a shell of radius 3 aimed near the center; some graze past the limb.
+        const n = 400;
+        const vertices = new Float64Array(n * 3);
+        const raydirs = new Float64Array(n * 3);
+        for (let i = 0; i < n; i++) {
+          const th = Math.acos(1 - (2 * (i + 0.5)) / n);
+          const ph = i * 2.399963;
+          const o = [3 * Math.sin(th) * Math.cos(ph), 3 * Math.sin(th) * Math.sin(ph), 3 * Math.cos(th)];
+          vertices.set(o, i * 3);
+          raydirs.set([-o[0]! + 0.9 * Math.sin(i), -o[1]! + 0.9 * Math.cos(3 * i), -o[2]!], i * 3);
+        }
+
+        const result = index.raycast(vertices, raydirs);
+        expect(result.points).toHaveLength(n * 3);
+        expect(result.plates).toHaveLength(n);
+        expect(result.found).toHaveLength(Math.ceil(n / 8));
+
+        let hits = 0;
+        for (let i = 0; i < n; i++) {
+          const o = vertices.subarray(i * 3, i * 3 + 3);
+          const d = raydirs.subarray(i * 3, i * 3 + 3);
+          const want = bruteForceRaycast(vrtces, plates, o, d);
+          const found = ((result.found[i >> 3]! >> (i & 7)) & 1) === 1;
+          expect(found).toBe(want !== undefined);
+          if (want === undefined) {
+            expect(result.plates[i]).toBe(0);
+            continue;
+          }
+          hits++;
+          for (let k = 0; k < 3; k++) {
+            expect(Math.abs(result.points[i * 3 + k]! - (o[k]! + want.t * d[k]!))).toBeLessThan(1e-12);
+          }
+        }
+        expect(hits).toBeGreaterThan(n / 2);
+        expect(hits).toBeLessThan(n);
+
+        // Threading does not change results; a shared direction broadcasts over every origin.
+        const single = index.raycast(vertices, raydirs, { threads: 1 });
+        expect(single.points).toEqual(result.points);
+        expect(single.plates).toEqual(result.plates);
+
+        const sun = new Float64Array([0, 0, -1]);
+        const shadow = index.raycast(vertices, sun);
+        for (let i = 0; i < n; i += 37) {
+          const one = index.raycast(vertices.slice(i * 3, i * 3 + 3), sun);
+          expect(one.plates[0]).toBe(shadow.plates[i]);
+        }
+
+        expect(index.raycast(new Float64Array(0), new Float64Array(0)).plates).toHaveLength(0);
+        expect(() => index.raycast(vertices, new Float64Array(6))).toThrow(/3 doubles/);
+        expect(() => index.raycast(vertices.slice(0, 3), new Float64Array(3))).toThrow(/raydirs\[0\]/);
+      } finally {
+        index.dispose();
+      }
+
+      expect(() => index.raycast(new Float64Array([0, 0, 2]), new Float64Array([0, 0, -1]))).toThrow(/disposed/);
+      index.dispose();
+    } finally {
+      fs.rmSync(tmpDir, { recursive: true, force: true });
+    }
+  });
+
+  itNative("indexes a real shape model", () => {
+    const backend = createNodeBackend();
+    const handle = backend.dasopr(APOPHIS_DSK);
+
+    try {
+      const first = backend.dlabfs(handle);
+      if (!first.found) throw new Error("Expected a DLA segment in the Apophis DSK");
+      const bookkeeping = backend.dskb02(handle, first.descr);
+      const [[xmin, xmax], [ymin, ymax], [zmin, zmax]] = bookkeeping.vtxbds;
+
+      const index = backend.dskPlateIndex(handle, first.descr);
+      try {
+        expect(index.np).toBe(bookkeeping.np);
+        expect(index.nv).toBe(bookkeeping.nv);
+
+        // Every ray from far outside toward the origin hits the (star-shaped) body; rays skewed
+        // off the center may miss, and the last few point away from it.
+        const n = 64;
+        const vertices = new Float64Array(n * 3);
+        const raydirs = new Float64Array(n * 3);
+        for (let i = 0; i < n; i++) {
+          const th = Math.acos(1 - (2 * (i + 0.5)) / n);
+          const ph = i * 2.399963;
+          const o = [10 * Math.sin(th) * Math.cos(ph), 10 * Math.sin(th) * Math.sin(ph), 10 * Math.cos(th)];
+          vertices.set(o, i * 3);
+          const skew = i % 4 === 3 ? 1.5 : 0;
+          const sign = i >= n - 4 ? 1 : -1;
+          raydirs.set([sign * o[0]! + skew, sign * o[1]! - skew, sign * o[2]!], i * 3);
+        }
+        const result = index.raycast(vertices, raydirs);
+
+        // Same plates and points as CSPICE's own intercept.
+        let hits = 0;
+        for (let i = 0; i < n; i++) {
+          const o = Array.from(vertices.subarray(i * 3, i * 3 + 3)) as [number, number, number];
+          const d = Array.from(raydirs.subarray(i * 3, i * 3 + 3)) as [number, number, number];
+          const want = backend.dskx02(handle, first.descr, o, d);
+          const found = ((result.found[i >> 3]! >> (i & 7)) & 1) === 1;
+          expect(found).toBe(want.found);
+          if (!want.found) {
+            expect(result.plates[i]).toBe(0);
+            continue;
+          }
+          hits++;
+          expect(result.plates[i]).toBe(want.plid);
+          for (let k = 0; k < 3; k++) {
+            expect(Math.abs(result.points[i * 3 + k]! - want.xpt[k]!)).toBeLessThan(1e-10);
+          }
+        }
+        expect(hits).toBeGreaterThan(n / 2);
+        expect(hits).toBeLessThan(n);
+
+        for (let i = 0; i < n; i++) {
+          if (i % 4 === 3 || i >= n - 4) continue;
+          expect(result.plates[i]).toBeGreaterThan(0);
+          expect(result.plates[i]).toBeLessThanOrEqual(bookkeeping.np);
+          const [x, y, z] = result.points.subarray(i * 3, i * 3 + 3);
+          expect(x!).toBeGreaterThanOrEqual(xmin - 1e-9);
+          expect(x!).toBeLessThanOrEqual(xmax + 1e-9);
+          expect(y!).toBeGreaterThanOrEqual(ymin - 1e-9);
+          expect(y!).toBeLessThanOrEqual(ymax + 1e-9);
+          expect(z!).toBeGreaterThanOrEqual(zmin - 1e-9);
+          expect(z!).toBeLessThanOrEqual(zmax + 1e-9);
+        }
+      } finally {
+        index.dispose();
+      }
+    } finally {
+      backend.dascls(handle);
+    }
+  });
+});
@@ -18,11 +18,18 @@ type EkNativeDeps = Pick<
   | "ekgc"
   | "ekgd"
   | "ekgi"
+  | "ekQueryColumnar"
+  | "ekCursorOpen"
+  | "ekCursorNext"
+  | "ekCursorReadAsync"
+  | "ekCursorTake"
+  | "ekCursorClose"
   | "ekifld"
   | "ekacli"
   | "ekacld"
   | "ekaclc"
   | "ekffld"
+  | "ekWriteSegment"
 >;
 
 function makeNativeDeps(overrides: Partial<EkNativeDeps>): EkNativeDeps {
@@ -44,11 +51,18 @@ function makeNativeDeps(overrides: Partial<EkNativeDeps>): EkNativeDeps {
     ekgc: notImplemented("ekgc"),
     ekgd: notImplemented("ekgd"),
     ekgi: notImplemented("ekgi"),
+    ekQueryColumnar: notImplemented("ekQueryColumnar"),
+    ekCursorOpen: notImplemented("ekCursorOpen"),
+    ekCursorNext: notImplemented("ekCursorNext"),
+    ekCursorReadAsync: notImplemented("ekCursorReadAsync"),
+    ekCursorTake: notImplemented("ekCursorTake"),
+    ekCursorClose: notImplemented("ekCursorClose"),
     ekifld: notImplemented("ekifld"),
     ekacli: notImplemented("ekacli"),
     ekacld: notImplemented("ekacld"),
     ekaclc: notImplemented("ekaclc"),
     ekffld: notImplemented("ekffld"),
+    ekWriteSegment: notImplemented("ekWriteSegment"),
     ...overrides,
   };
 }
@@ -149,4 +163,46 @@ describe("backend-node ek domain wrapper", () => {
     // Still rejects unknown/closed handles.
     expect(() => api.ekcls(handle)).toThrow(/invalid|closed/i);
   });
+
+  it("ekQueryCursor() passes the previous batch back for reuse and closes when exhausted", async () => {
+    const batches = [
+      { rowStart: 0, rows: 2, columns: [{ nulls: new Uint8Array(1), values: new Int32Array([1, 2]) }] },
+      { rowStart: 2, rows: 1, columns: [{ nulls: new Uint8Array(1), values: new Int32Array([3]) }] },
+    ];
+    const reused: unknown[] = [];
+    const closed: number[] = [];
+
+    const native = makeNativeDeps({
+      ekCursorOpen: (_query: string, batchRows: number) => {
+        expect(batchRows).toBe(2);
+        return { ok: true, cursor: 7, nmrows: 3, columns: [{ table: "T", name: "ID", type: "INT" }] };
+      },
+      ekCursorNext: (_cursor: number, reuse) => {
+        reused.push(reuse);
+        return batches.shift() ?? null;
+      },
+      ekCursorReadAsync: async () => batches[0]?.rows ?? 0,
+      ekCursorTake: (_cursor: number, reuse) => {
+        reused.push(reuse);
+        return batches.shift() ?? null;
+      },
+      ekCursorClose: (cursor: number) => closed.push(cursor),
+    });
+
+    const api = createEkApi(native, createSpiceHandleRegistry());
+    const res = api.ekQueryCursor("SELECT ID FROM T", { batchRows: 2 });
+    if (!res.ok) throw new Error("unexpected query error");
+
+    const first = res.cursor.next();
+    expect(first?.rows).toBe(2);
+    const second = await res.cursor.nextAsync();
+    expect(second?.rowStart).toBe(2);
+    expect(await res.cursor.nextAsync()).toBeNull();
+    expect(res.cursor.next()).toBeNull();
+
+    expect(reused).toEqual([undefined, first, second]);
+    expect(closed).toEqual([7]);
+
+    expect(() => api.ekQueryCursor("SELECT ID FROM T", { batchRows: 0 })).toThrow();
+  });
 });
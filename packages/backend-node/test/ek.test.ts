@@ -5,7 +5,7 @@ import { fileURLToPath } from "node:url";
 
 import { describe, expect, it } from "vitest";
 
-import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createNodeBackend, type EkCursorBatch } from "@rybosome/tspice-backend-node";
 
 import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
 
@@ -140,6 +140,247 @@ describe("@rybosome/tspice-backend-node ek", () => {
     }
   });
 
+  it.runIf(nodeAddonAvailable())("ekQueryColumnar() returns whole columns matching ekg*", async () => {
+    const backend = await createNodeBackend();
+    backend.kclear();
+
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-ek-"));
+    const ekPath = path.join(tmpDir, "columnar.bes");
+    const handle = backend.ekopn(ekPath, "columnar", 0);
+
+    const { segno, rcptrs } = backend.ekifld(
+      handle,
+      "OBS",
+      3,
+      ["ID", "MAG", "TAG", "V"],
+      [
+        "DATATYPE = INTEGER, INDEXED = TRUE",
+        "DATATYPE = DOUBLE PRECISION, NULLS_OK = TRUE",
+        "DATATYPE = CHARACTER*(*), NULLS_OK = TRUE",
+        "DATATYPE = INTEGER, SIZE = VARIABLE",
+      ],
+    );
+    backend.ekacli(handle, segno, "ID", [1, 2, 3], [1, 1, 1], [false, false, false], rcptrs);
+    backend.ekacld(handle, segno, "MAG", [1.5, 0, -2.25], [1, 1, 1], [false, true, false], rcptrs);
+    backend.ekaclc(handle, segno, "TAG", ["alpha", "", "γ"], [1, 1, 1], [false, true, false], rcptrs);
+    backend.ekacli(handle, segno, "V", [7, 8, 9, 10], [1, 2, 1], [false, false, false], rcptrs);
+    backend.ekffld(handle, segno, rcptrs);
+    backend.ekcls(handle);
+
+    backend.furnsh(ekPath);
+
+    const res = backend.ekQueryColumnar("SELECT ID, MAG, TAG, V FROM OBS ORDER BY ID");
+    if (!res.ok) throw new Error(`Unexpected ekQueryColumnar() parse error: ${res.errmsg}`);
+    expect(res.nmrows).toBe(3);
+    expect(res.columns.map((c) => [c.name, c.type])).toEqual([
+      ["ID", "INT"],
+      ["MAG", "DP"],
+      ["TAG", "CHR"],
+      ["V", "INT"],
+    ]);
+
+    const [id, mag, tag, v] = res.columns;
+    if (id?.type !== "INT" || mag?.type !== "DP" || tag?.type !== "CHR" || v?.type !== "INT") {
+      throw new Error("Unexpected column types");
+    }
+
+    expect(Array.from(id.values)).toEqual([1, 2, 3]);
+    expect(Array.from(id.nulls)).toEqual([0]);
+    expect(id.rowOffsets).toBeUndefined();
+
+    expect(Array.from(mag.values)).toEqual([1.5, 0, -2.25]);
+    expect(Array.from(mag.nulls)).toEqual([0b010]);
+
+    const decoder = new TextDecoder();
+    const tags = Array.from({ length: res.nmrows }, (_, i) =>
+      decoder.decode(tag.bytes.subarray(tag.offsets[i], tag.offsets[i + 1])),
+    );
+    expect(tags).toEqual(["alpha", "", "γ"]);
+    expect(Array.from(tag.nulls)).toEqual([0b010]);
+
+    expect(Array.from(v.rowOffsets ?? [])).toEqual([0, 1, 3, 4]);
+    expect(Array.from(v.values)).toEqual([7, 8, 9, 10]);
+
+    // Same values as the per-element accessors.
+    for (let row = 0; row < res.nmrows; row++) {
+      const byElement = backend.ekgc(2, row, 0);
+      if (byElement.found && !byElement.isNull) expect(byElement.value).toBe(tags[row]);
+      expect(backend.ekgi(0, row, 0)).toEqual({ found: true, isNull: false, value: id.values[row] });
+    }
+
+    const bad = backend.ekQueryColumnar("SELECT ID MAG FROM OBS");
+    expect(bad.ok).toBe(false);
+    if (!bad.ok) expect(bad.errmsg.length).toBeGreaterThan(0);
+  });
+
+  it.runIf(nodeAddonAvailable())("ekQueryCursor() streams the same rows as ekQueryColumnar()", async () => {
+    const backend = await createNodeBackend();
+    backend.kclear();
+
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-ek-"));
+    const ekPath = path.join(tmpDir, "cursor.bes");
+    const handle = backend.ekopn(ekPath, "cursor", 0);
+
+    const n = 10;
+    const ids = Int32Array.from({ length: n }, (_, i) => i + 1);
+    const encoder = new TextEncoder();
+    const encoded = Array.from(ids, (id) => encoder.encode(`row-${id}`));
+    const offsets = new Int32Array(n + 1);
+    encoded.forEach((b, i) => (offsets[i + 1] = offsets[i]! + b.length));
+    const bytes = new Uint8Array(offsets[n]!);
+    encoded.forEach((b, i) => bytes.set(b, offsets[i]!));
+
+    backend.ekWriteSegment(
+      handle,
+      "ROWS",
+      [
+        { name: "ID", decl: "DATATYPE = INTEGER, INDEXED = TRUE" },
+        { name: "X", decl: "DATATYPE = DOUBLE PRECISION" },
+        { name: "NAME", decl: "DATATYPE = CHARACTER*(*)" },
+      ],
+      [{ values: ids }, { values: Float64Array.from(ids, (id) => id / 4) }, { offsets, bytes }],
+    );
+    backend.ekcls(handle);
+    backend.furnsh(ekPath);
+
+    const query = "SELECT ID, X, NAME FROM ROWS ORDER BY ID";
+    const whole = backend.ekQueryColumnar(query);
+    if (!whole.ok) throw new Error(`Unexpected ekQueryColumnar() parse error: ${whole.errmsg}`);
+
+    const collect = (batch: EkCursorBatch, out: { ids: number[]; xs: number[]; names: string[] }) => {
+      const [id, x, name] = batch.columns;
+      if (!id || !("values" in id) || !x || !("values" in x) || !name || !("bytes" in name)) {
+        throw new Error("Unexpected batch layout");
+      }
+      out.ids.push(...id.values);
+      out.xs.push(...x.values);
+      const decoder = new TextDecoder();
+      for (let r = 0; r < batch.rows; r++) {
+        out.names.push(decoder.decode(name.bytes.subarray(name.offsets[r], name.offsets[r + 1])));
+      }
+    };
+
+    const opened = backend.ekQueryCursor(query, { batchRows: 4 });
+    if (!opened.ok) throw new Error(`Unexpected ekQueryCursor() parse error: ${opened.errmsg}`);
+    expect(opened.cursor.nmrows).toBe(n);
+    expect(opened.cursor.columns.map((c) => [c.name, c.type])).toEqual([
+      ["ID", "INT"],
+      ["X", "DP"],
+      ["NAME", "CHR"],
+    ]);
+
+    const sync = { ids: [] as number[], xs: [] as number[], names: [] as string[] };
+    const sizes: number[] = [];
+    for (const batch of opened.cursor) {
+      sizes.push(batch.rows);
+      // Interleaved queries must not disturb the cursor.
+      backend.ekfind("SELECT ID FROM ROWS WHERE ID = 1");
+      collect(batch, sync);
+    }
+    expect(sizes).toEqual([4, 4, 2]);
+    expect(sync.ids).toEqual(Array.from(ids));
+    expect(sync.names).toEqual(Array.from(ids, (id) => `row-${id}`));
+
+    const [wholeX] = whole.columns.slice(1);
+    if (wholeX?.type !== "DP") throw new Error("Unexpected column types");
+    expect(sync.xs).toEqual(Array.from(wholeX.values));
+
+    // `for...of` closed the cursor.
+    expect(opened.cursor.next()).toBeNull();
+
+    const reopened = backend.ekQueryCursor(query, { batchRows: 3 });
+    if (!reopened.ok) throw new Error(`Unexpected ekQueryCursor() parse error: ${reopened.errmsg}`);
+    const viaAsync = { ids: [] as number[], xs: [] as number[], names: [] as string[] };
+    let firstBuffer: ArrayBufferLike | undefined;
+    for await (const batch of reopened.cursor) {
+      const id = batch.columns[0];
+      if (!id || !("values" in id)) throw new Error("Unexpected batch layout");
+      firstBuffer ??= id.values.buffer;
+      // Later batches are written into the first batch's buffers.
+      expect(id.values.buffer).toBe(firstBuffer);
+      collect(batch, viaAsync);
+    }
+    expect(viaAsync).toEqual(sync);
+
+    const stale = backend.ekQueryCursor(query, { batchRows: 4 });
+    if (!stale.ok) throw new Error(`Unexpected ekQueryCursor() parse error: ${stale.errmsg}`);
+    stale.cursor.next();
+    backend.kclear();
+    expect(() => stale.cursor.next()).toThrow(/kernels were loaded or unloaded/);
+    stale.cursor.close();
+
+    const bad = backend.ekQueryCursor("SELECT ID X FROM ROWS");
+    expect(bad.ok).toBe(false);
+  });
+
+  it.runIf(nodeAddonAvailable())("ekWriteSegment() round-trips ekQueryColumnar() columns", async () => {
+    const backend = await createNodeBackend();
+    backend.kclear();
+
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-ek-"));
+    const ekPath = path.join(tmpDir, "segment.bes");
+    const handle = backend.ekopn(ekPath, "segment", 0);
+
+    const encoder = new TextEncoder();
+    const names = ["Alice", "", "Carol"];
+    const encoded = names.map((n) => encoder.encode(n));
+    const offsets = new Int32Array(names.length + 1);
+    encoded.forEach((b, i) => (offsets[i + 1] = offsets[i]! + b.length));
+    const bytes = new Uint8Array(offsets[names.length]!);
+    encoded.forEach((b, i) => bytes.set(b, offsets[i]!));
+
+    const segno = backend.ekWriteSegment(
+      handle,
+      "PEOPLE",
+      [
+        { name: "ID", decl: "DATATYPE = INTEGER, INDEXED = TRUE" },
+        { name: "COST", decl: "DATATYPE = DOUBLE PRECISION, NULLS_OK = TRUE" },
+        { name: "NAME", decl: "DATATYPE = CHARACTER*(*), NULLS_OK = TRUE" },
+        { name: "V", decl: "DATATYPE = INTEGER, SIZE = VARIABLE" },
+      ],
+      [
+        { values: new Int32Array([1, 2, 3]) },
+        { values: new Float64Array([10.5, 0, 30]), nulls: new Uint8Array([0b010]) },
+        { offsets, bytes, nulls: new Uint8Array([0b010]) },
+        { values: new Int32Array([7, 8, 9, 10]), rowOffsets: new Int32Array([0, 1, 3, 4]) },
+      ],
+    );
+    expect(segno).toBe(0);
+    backend.ekcls(handle);
+
+    backend.furnsh(ekPath);
+    const res = backend.ekQueryColumnar("SELECT ID, COST, NAME, V FROM PEOPLE ORDER BY ID");
+    if (!res.ok) throw new Error(`Unexpected ekQueryColumnar() parse error: ${res.errmsg}`);
+    expect(res.nmrows).toBe(3);
+
+    const [id, cost, name, v] = res.columns;
+    if (id?.type !== "INT" || cost?.type !== "DP" || name?.type !== "CHR" || v?.type !== "INT") {
+      throw new Error("Unexpected column types");
+    }
+    expect(Array.from(id.values)).toEqual([1, 2, 3]);
+    expect(Array.from(cost.values)).toEqual([10.5, 0, 30]);
+    expect(Array.from(cost.nulls)).toEqual([0b010]);
+    expect(Array.from(name.offsets)).toEqual(Array.from(offsets));
+    expect(Array.from(name.bytes)).toEqual(Array.from(bytes));
+    expect(Array.from(name.nulls)).toEqual([0b010]);
+    expect(Array.from(v.values)).toEqual([7, 8, 9, 10]);
+    expect(Array.from(v.rowOffsets ?? [])).toEqual([0, 1, 3, 4]);
+
+    const badHandle = backend.ekopn(path.join(tmpDir, "bad.bes"), "bad", 0);
+    expect(() =>
+      backend.ekWriteSegment(
+        badHandle,
+        "BAD",
+        [
+          { name: "A", decl: "DATATYPE = INTEGER" },
+          { name: "B", decl: "DATATYPE = INTEGER" },
+        ],
+        [{ values: new Int32Array([1, 2]) }, { values: new Int32Array([1, 2, 3]) }],
+      ),
+    ).toThrow(/has 3 rows; expected 2/);
+    backend.ekcls(badHandle);
+  });
+
   it.runIf(nodeAddonAvailable())("ekaclc() hard-caps packed string allocations", async () => {
     const backend = await createNodeBackend();
     backend.kclear();
@@ -0,0 +1,99 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { evaluateEphemerisTable, parseEphemerisTable } from "@rybosome/tspice-core";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node ephemeris tables", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("fits spkpos to the requested tolerance and evaluates without CSPICE", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    try {
+      const et0 = 0;
+      const et1 = 30 * 86_400;
+      const tolerance = 0.01;
+      const table = backend.ephemerisTableBuild("MOON", et0, et1, "J2000", "NONE", "EARTH", tolerance);
+      expect(table).toBeInstanceOf(ArrayBuffer);
+
+      const parsed = parseEphemerisTable(table);
+      expect([parsed.et0, parsed.et1, parsed.tolerance]).toEqual([et0, et1, tolerance]);
+      expect(parsed.maxError).toBeLessThanOrEqual(tolerance);
+
+      const n = 500;
+      const ets = new Float64Array(n);
+      for (let i = 0; i < n; i++) ets[i] = et0 + ((et1 - et0) * i) / (n - 1);
+      const states = backend.ephemerisTableEval(table, ets);
+      const js = new Float64Array(6);
+      for (let i = 0; i < n; i++) {
+        const { pos } = backend.spkpos("MOON", ets[i]!, "J2000", "NONE", "EARTH");
+        const err = Math.hypot(states[i * 6]! - pos[0], states[i * 6 + 1]! - pos[1], states[i * 6 + 2]! - pos[2]);
+        // Between check points the error may exceed the tolerance slightly.
+        expect(err).toBeLessThan(tolerance * 2);
+
+        expect(evaluateEphemerisTable(parsed, ets[i]!, js)).toBe(true);
+        for (let k = 0; k < 6; k++) expect(js[k]).toBeCloseTo(states[i * 6 + k]!, 9);
+      }
+
+      // Velocity is the derivative of the fit: close to the real one at display precision.
+      const { state } = backend.spkezr("MOON", ets[n >> 1]!, "J2000", "NONE", "EARTH");
+      for (let k = 3; k < 6; k++) expect(states[(n >> 1) * 6 + k]).toBeCloseTo(state[k]!, 5);
+
+      let caught: unknown;
+      try {
+        backend.ephemerisTableEval(table, new Float64Array([et0, et1 + 1]));
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(RangeError);
+      expect((caught as { index?: number }).index).toBe(1);
+
+      expect(() => backend.ephemerisTableBuild("MOON", et1, et0, "J2000", "NONE", "EARTH", tolerance)).toThrow(
+        /et0 < et1/,
+      );
+      expect(() => backend.ephemerisTableEval(new ArrayBuffer(16), ets)).toThrow(/table header/);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("refines pieces until velocities are within velocityTolerance", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    try {
+      const et0 = 0;
+      const et1 = 30 * 86_400;
+      const tolerance = 1;
+      const loose = parseEphemerisTable(
+        backend.ephemerisTableBuild("MOON", et0, et1, "J2000", "NONE", "EARTH", tolerance, 1),
+      );
+      const velocityTolerance = 1e-7;
+      const table = backend.ephemerisTableBuild("MOON", et0, et1, "J2000", "NONE", "EARTH", tolerance, velocityTolerance);
+      expect(parseEphemerisTable(table).segments).toBeGreaterThan(loose.segments);
+
+      const n = 500;
+      const ets = new Float64Array(n);
+      for (let i = 0; i < n; i++) ets[i] = et0 + ((et1 - et0) * i) / (n - 1);
+      const states = backend.ephemerisTableEval(table, ets);
+      for (let i = 0; i < n; i++) {
+        const { state } = backend.spkezr("MOON", ets[i]!, "J2000", "NONE", "EARTH");
+        const err = Math.hypot(states[i * 6 + 3]! - state[3]!, states[i * 6 + 4]! - state[4]!, states[i * 6 + 5]! - state[5]!);
+        // Between check points the error may exceed the tolerance slightly.
+        expect(err).toBeLessThan(velocityTolerance * 2);
+      }
+
+      expect(() => backend.ephemerisTableBuild("MOON", et0, et1, "J2000", "NONE", "EARTH", tolerance, 0)).toThrow(
+        /velocityTolerance/,
+      );
+    } finally {
+      backend.kclear();
+    }
+  });
+});
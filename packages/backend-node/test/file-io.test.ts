@@ -4,7 +4,7 @@ import path from "node:path";
 
 import { describe, expect, it } from "vitest";
 
-import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createNodeBackend, isDafMmapEnabled, setDafMmapEnabled } from "@rybosome/tspice-backend-node";
 import type { DlaDescriptor, SpiceHandle } from "@rybosome/tspice-backend-contract";
 import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
 import { loadTestKernels } from "./test-kernels.js";
@@ -31,6 +31,116 @@ describe("@rybosome/tspice-backend-node file-io", () => {
     }
   });
 
+  itNative("dafgda() reads the same words with and without mmap", async () => {
+    const backend = createNodeBackend();
+
+    const { spk } = await loadTestKernels();
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-file-io-"));
+
+    try {
+      const spkPath = path.join(tmpDir, "de405s.bsp");
+      fs.writeFileSync(spkPath, spk);
+
+      // Words 385..400 (record 4); DAF addresses are 1-based doubles.
+      const baddr = 385;
+      const eaddr = 400;
+      const raw = Buffer.from(spk);
+      const expected = Array.from({ length: eaddr - baddr + 1 }, (_, i) =>
+        os.endianness() === "LE" ? raw.readDoubleLE((baddr - 1 + i) * 8) : raw.readDoubleBE((baddr - 1 + i) * 8),
+      );
+
+      const handle = backend.dafopr(spkPath);
+      try {
+        const viaCspice = backend.dafgda(handle, baddr, eaddr);
+        expect(viaCspice).toBeInstanceOf(Float64Array);
+        expect(Array.from(viaCspice)).toEqual(expected);
+
+        setDafMmapEnabled(true);
+        const viaMmap = backend.dafgda(handle, baddr, eaddr);
+        expect(Array.from(viaMmap)).toEqual(expected);
+        if (process.platform !== "win32") {
+          expect(isDafMmapEnabled()).toBe(true);
+        }
+
+        expect(() => backend.dafgda(handle, 0, 1)).toThrow(/baddr/);
+      } finally {
+        setDafMmapEnabled(false);
+        backend.dafcls(handle);
+      }
+      expect(isDafMmapEnabled()).toBe(false);
+    } finally {
+      fs.rmSync(tmpDir, { recursive: true, force: true });
+    }
+  });
+
+  itNative("dafSummaries/dlaDescriptors match the dafbfs/daffna and dlabfs/dlafns walks", async () => {
+    const backend = createNodeBackend();
+
+    const { spk, dsk } = await loadTestKernels();
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-file-io-"));
+
+    try {
+      const spkPath = path.join(tmpDir, "de405s.bsp");
+      fs.writeFileSync(spkPath, spk);
+
+      const daf = backend.dafSummaries(spkPath);
+      expect(daf.nd).toBe(2);
+      expect(daf.ni).toBe(6);
+      expect(daf.count).toBeGreaterThan(0);
+      expect(daf.names.offsets.length).toBe(daf.count + 1);
+
+      let walked = 0;
+      const handle = backend.dafopr(spkPath);
+      try {
+        backend.dafbfs(handle);
+        while (backend.daffna(handle)) walked++;
+      } finally {
+        backend.dafcls(handle);
+      }
+      expect(daf.count).toBe(walked);
+      // Every SPK segment covers a non-empty interval: [et0, et1] are the two doubles.
+      for (let i = 0; i < daf.count; i++) {
+        expect(daf.doubles[2 * i + 1]!).toBeGreaterThan(daf.doubles[2 * i]!);
+      }
+
+      const dskPath = path.join(tmpDir, "apophis_g_25000mm_rad_obj_0000n00000_v001.bds");
+      fs.writeFileSync(dskPath, dsk);
+
+      const dla = backend.dlaDescriptors(dskPath);
+      expect(dla.count).toBe(1);
+      expect(dla.dskInts).not.toBeNull();
+      expect(dla.dskDoubles).not.toBeNull();
+
+      const das = backend.dasopr(dskPath);
+      try {
+        const first = backend.dlabfs(das);
+        if (!first.found) throw new Error("Expected a DLA segment");
+        const d = first.descr;
+        expect(Array.from(dla.descrs)).toEqual([
+          d.bwdptr,
+          d.fwdptr,
+          d.ibase,
+          d.isize,
+          d.dbase,
+          d.dsize,
+          d.cbase,
+          d.csize,
+        ]);
+        const gd = backend.dskgd(das, d);
+        expect(dla.dskInts![0]).toBe(gd.surfce);
+        expect(dla.dskInts![1]).toBe(gd.center);
+        expect(dla.dskDoubles![16]).toBe(gd.start);
+        expect(dla.dskDoubles![17]).toBe(gd.stop);
+      } finally {
+        backend.dascls(das);
+      }
+
+      expect(() => backend.dafSummaries(path.join(tmpDir, "missing.bsp"))).toThrow(/dafSummaries/);
+    } finally {
+      fs.rmSync(tmpDir, { recursive: true, force: true });
+    }
+  });
+
   itNative("throws on double-close", async () => {
     const backend = createNodeBackend();
 
@@ -310,4 +420,88 @@ describe("@rybosome/tspice-backend-node file-io", () => {
       fs.rmSync(tmpDir, { recursive: true, force: true });
     }
   });
+
+  itNative("dskWriteType2 writes the same segment as dskmi2 + dskw02", () => {
+    const backend = createNodeBackend();
+
+    const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-file-io-"));
+    try {
+      // A unit octahedron.
+      const vrtces = [1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1];
+      const plates = [1, 3, 5, 3, 2, 5, 2, 4, 5, 4, 1, 5, 3, 1, 6, 2, 3, 6, 4, 2, 6, 1, 4, 6];
+      const nv = vrtces.length / 3;
+      const np = plates.length / 3;
+      const options = {
+        center: 399,
+        surfid: 7,
+        dclass: 1,
+        frame: "J2000",
+        corsys: 3,
+        mncor1: -1,
+        mxcor1: 1,
+        mncor2: -1,
+        mxcor2: 1,
+        mncor3: -1,
+        mxcor3: 1,
+        first: 0,
+        last: 1,
+        finscl: 5.0,
+        corscl: 4,
+        worksz: 100_000,
+        voxpsz: 5_000,
+        voxlsz: 5_000,
+        spxisz: 200_000,
+      };
+
+      const legacyPath = path.join(tmpDir, "legacy.bds");
+      const legacy = backend.dskopn(legacyPath, "TSPICE", 0);
+      try {
+        const { spaixd, spaixi } = backend.dskmi2(nv, vrtces, np, plates, 5.0, 4, 100_000, 5_000, 5_000, true, 200_000);
+        backend.dskw02(legacy, 399, 7, 1, "J2000", 3, new Array(10).fill(0), -1, 1, -1, 1, -1, 1, 0, 1, nv, vrtces, np, plates, spaixd, spaixi);
+      } finally {
+        backend.dascls(legacy);
+      }
+
+      // Twice, so the second write runs on reused scratch.
+      const fusedPaths = [path.join(tmpDir, "fused-1.bds"), path.join(tmpDir, "fused-2.bds")];
+      for (const fusedPath of fusedPaths) {
+        const fused = backend.dskopn(fusedPath, "TSPICE", 0);
+        try {
+          backend.dskWriteType2(fused, new Float64Array(vrtces), new Int32Array(plates), options);
+        } finally {
+          backend.dascls(fused);
+        }
+      }
+
+      const readSegment = (p: string) => {
+        const handle = backend.dasopr(p);
+        try {
+          const first = backend.dlabfs(handle);
+          if (!first.found) throw new Error(`Expected a DLA segment in ${p}`);
+          return { gd: backend.dskgd(handle, first.descr), b02: backend.dskb02(handle, first.descr) };
+        } finally {
+          backend.dascls(handle);
+        }
+      };
+      const want = readSegment(legacyPath);
+      expect(want.b02.np).toBe(np);
+      for (const fusedPath of fusedPaths) {
+        expect(readSegment(fusedPath)).toEqual(want);
+      }
+
+      const bad = backend.dskopn(path.join(tmpDir, "bad.bds"), "TSPICE", 0);
+      try {
+        expect(() =>
+          backend.dskWriteType2(bad, new Float64Array(vrtces), new Int32Array([1, 2, 7]), options),
+        ).toThrow(/plates\[2\]/);
+        expect(() =>
+          backend.dskWriteType2(bad, new Float64Array(vrtces), plates as unknown as Int32Array, options),
+        ).toThrow(/Int32Array/);
+      } finally {
+        backend.dascls(bad);
+      }
+    } finally {
+      fs.rmSync(tmpDir, { recursive: true, force: true });
+    }
+  });
 });
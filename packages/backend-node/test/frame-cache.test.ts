@@ -0,0 +1,60 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node frame cache", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("serves inertial chains from the cache at any epoch", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+
+      const first = Array.from(backend.pxform("J2000", "ECLIPJ2000", 0));
+      const before = backend.frameCacheStats();
+      expect(before.fixedChains).toBeGreaterThan(0);
+
+      const out = new Float64Array(9);
+      for (const et of [1, 86_400, -1e9, 1e9]) {
+        expect(Array.from(backend.pxform("J2000", "ECLIPJ2000", et))).toEqual(first);
+        backend.pxformInto("J2000", "ECLIPJ2000", et, out);
+        expect(Array.from(out)).toEqual(first);
+      }
+      const after = backend.frameCacheStats();
+      expect(after.hits - before.hits).toBe(8);
+      expect(after.misses).toBe(before.misses);
+
+      // sxform is cached separately; its derivative block is zero for an inertial chain.
+      const s = backend.sxform("J2000", "ECLIPJ2000", 0);
+      expect(backend.sxform("J2000", "ECLIPJ2000", 1e6)).toEqual(s);
+      expect(s.slice(18, 21)).toEqual([0, 0, 0]);
+
+      // Failures are not cached.
+      expect(() => backend.pxform("J2000", "NOT_A_FRAME", 0)).toThrow();
+      expect(() => backend.pxform("J2000", "NOT_A_FRAME", 0)).toThrow();
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("is dropped on kernel changes", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.pxform("J2000", "ECLIPJ2000", 0);
+      expect(backend.frameCacheStats().fixedChains).toBeGreaterThan(0);
+
+      backend.kclear();
+      expect(backend.frameCacheStats()).toMatchObject({ fixedChains: 0, recent: 0 });
+    } finally {
+      backend.kclear();
+    }
+  });
+});
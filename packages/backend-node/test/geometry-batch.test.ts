@@ -0,0 +1,201 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node batched surface geometry", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  const setup = async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+    // Just enough of a PCK for IAU_EARTH and an ellipsoid.
+    backend.pdpool("BODY399_RADII", [6378.1366, 6378.1366, 6356.7519]);
+    backend.pdpool("BODY399_POLE_RA", [0, 0, 0]);
+    backend.pdpool("BODY399_POLE_DEC", [90, 0, 0]);
+    backend.pdpool("BODY399_PM", [190.147, 360.9856235, 0]);
+    return backend;
+  };
+
+  // A fan of rays from the Moon around the direction of Earth's center; the outer ones miss.
+  const rayFan = (backend: ReturnType<typeof createNodeBackend>, et: number, k: number): Float64Array => {
+    const [x, y, z] = backend.spkpos("EARTH", et, "J2000", "NONE", "MOON").pos;
+    const dirs = new Float64Array(k * k * 3);
+    for (let i = 0; i < k; i++) {
+      for (let j = 0; j < k; j++) {
+        const du = ((i / (k - 1)) * 2 - 1) * 0.025;
+        const dv = ((j / (k - 1)) * 2 - 1) * 0.025;
+        dirs.set([x + du * Math.hypot(x, y, z), y + dv * Math.hypot(x, y, z), z], (i * k + j) * 3);
+      }
+    }
+    return dirs;
+  };
+
+  itNative("sincptBatch matches sincpt per ray", async () => {
+    const backend = await setup();
+
+    try {
+      const et = 86_400;
+      const dirs = rayFan(backend, et, 15);
+      const n = dirs.length / 3;
+
+      for (const abcorr of ["NONE", "LT+S"]) {
+        const batch = backend.sincptBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", abcorr, "MOON", "J2000", dirs);
+        expect(batch.found.length).toBe(Math.ceil(n / 8));
+
+        let hits = 0;
+        for (let i = 0; i < n; i++) {
+          const dvec = Array.from(dirs.subarray(i * 3, i * 3 + 3)) as [number, number, number];
+          const one = backend.sincpt("ELLIPSOID", "EARTH", et, "IAU_EARTH", abcorr, "MOON", "J2000", dvec);
+          const hit = (batch.found[i >> 3]! >> (i & 7)) & 1;
+          expect(hit === 1).toBe(one.found);
+          if (!one.found) {
+            expect(Array.from(batch.spoints.subarray(i * 3, i * 3 + 3))).toEqual([0, 0, 0]);
+            continue;
+          }
+          hits++;
+          // The geometric path intersects directly; allow rounding-level differences.
+          for (let k = 0; k < 3; k++) {
+            expect(Math.abs(batch.spoints[i * 3 + k]! - one.spoint[k]!)).toBeLessThan(1e-6);
+            expect(Math.abs(batch.srfvecs[i * 3 + k]! - one.srfvec[k]!)).toBeLessThan(1e-6);
+          }
+          expect(Math.abs(batch.trgepcs[i]! - one.trgepc)).toBeLessThan(1e-9);
+        }
+        expect(hits).toBeGreaterThan(0);
+        expect(hits).toBeLessThan(n);
+      }
+
+      const empty = backend.sincptBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", "NONE", "MOON", "J2000", new Float64Array(0));
+      expect(empty.found.length).toBe(0);
+      expect(() =>
+        backend.sincptBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", "NONE", "MOON", "J2000", new Float64Array(4)),
+      ).toThrow(/multiple of 3/);
+
+      const zero = new Float64Array(dirs);
+      zero.fill(0, 6, 9);
+      let caught: unknown;
+      try {
+        backend.sincptBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", "NONE", "MOON", "J2000", zero);
+      } catch (err) {
+        caught = err;
+      }
+      expect((caught as { index?: unknown }).index).toBe(2);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("iluminBatch / illumfBatch match ilumin / illumf per point", async () => {
+    const backend = await setup();
+
+    try {
+      const et = 86_400;
+      const dirs = rayFan(backend, et, 9);
+      const hits = backend.sincptBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", "NONE", "MOON", "J2000", dirs);
+      const points: number[] = [];
+      for (let i = 0; i < dirs.length / 3; i++) {
+        if ((hits.found[i >> 3]! >> (i & 7)) & 1) points.push(...hits.spoints.subarray(i * 3, i * 3 + 3));
+      }
+      const spoints = new Float64Array(points);
+      const n = spoints.length / 3;
+      expect(n).toBeGreaterThan(0);
+
+      const ilu = backend.iluminBatch("ELLIPSOID", "EARTH", et, "IAU_EARTH", "CN+S", "MOON", spoints);
+      const ill = backend.illumfBatch("ELLIPSOID", "EARTH", "SUN", et, "IAU_EARTH", "CN+S", "MOON", spoints);
+      for (let i = 0; i < n; i++) {
+        const spoint = Array.from(spoints.subarray(i * 3, i * 3 + 3)) as [number, number, number];
+        const one = backend.ilumin("ELLIPSOID", "EARTH", et, "IAU_EARTH", "CN+S", "MOON", spoint);
+        expect(ilu.trgepcs[i]).toBe(one.trgepc);
+        expect(Array.from(ilu.srfvecs.subarray(i * 3, i * 3 + 3))).toEqual(one.srfvec);
+        expect([ilu.phase[i], ilu.incdnc[i], ilu.emissn[i]]).toEqual([one.phase, one.incdnc, one.emissn]);
+
+        const f = backend.illumf("ELLIPSOID", "EARTH", "SUN", et, "IAU_EARTH", "CN+S", "MOON", spoint);
+        expect([ill.phase[i], ill.incdnc[i], ill.emissn[i]]).toEqual([f.phase, f.incdnc, f.emissn]);
+        expect(ill.visibl[i]).toBe(f.visibl ? 1 : 0);
+        expect(ill.lit[i]).toBe(f.lit ? 1 : 0);
+      }
+
+      let caught: unknown;
+      try {
+        backend.illumfBatch("ELLIPSOID", "EARTH", "NOT_A_BODY", et, "IAU_EARTH", "NONE", "MOON", spoints);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as Error).message).toMatch(/spoints\[0\]/);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("occultBatch matches occult per triple and epoch", async () => {
+    const backend = await setup();
+    // An inflated Moon so that, seen from the Sun, it regularly covers Earth over a month.
+    backend.pdpool("BODY301_RADII", [200_000, 200_000, 200_000]);
+    backend.pdpool("BODY301_POLE_RA", [0, 0, 0]);
+    backend.pdpool("BODY301_POLE_DEC", [90, 0, 0]);
+    backend.pdpool("BODY301_PM", [0, 13.17635815, 0]);
+
+    try {
+      const triples = [
+        { targ1: "MOON", shape1: "ELLIPSOID", frame1: "IAU_MOON", targ2: "EARTH", shape2: "POINT", frame2: " ", observer: "SUN" },
+        { targ1: "EARTH", shape1: "ELLIPSOID", frame1: "IAU_EARTH", targ2: "MOON", shape2: "ELLIPSOID", frame2: "IAU_MOON", observer: "SUN" },
+      ];
+      const ets = new Float64Array(120);
+      for (let i = 0; i < ets.length; i++) ets[i] = i * 6 * 3600;
+
+      const batch = backend.occultBatch(triples, "LT", ets, { transitions: true });
+      expect(batch.codes.length).toBe(triples.length * ets.length);
+      let occulted = 0;
+      triples.forEach((t, ti) => {
+        for (let e = 0; e < ets.length; e++) {
+          const one = backend.occult(t.targ1, t.shape1, t.frame1, t.targ2, t.shape2, t.frame2, "LT", t.observer, ets[e]!);
+          expect(batch.codes[ti * ets.length + e]).toBe(one);
+          if (one !== 0) occulted++;
+        }
+      });
+      expect(occulted).toBeGreaterThan(0);
+
+      // The runs expand back to the codes.
+      const { offsets, runStarts, runCodes } = batch.transitions!;
+      expect(offsets.length).toBe(triples.length + 1);
+      for (let ti = 0; ti < triples.length; ti++) {
+        expect(runStarts[offsets[ti]!]).toBe(0);
+        for (let r = offsets[ti]!; r < offsets[ti + 1]!; r++) {
+          const end = r + 1 < offsets[ti + 1]! ? runStarts[r + 1]! : ets.length;
+          for (let e = runStarts[r]!; e < end; e++) {
+            expect(batch.codes[ti * ets.length + e]).toBe(runCodes[r]);
+          }
+        }
+      }
+
+      expect(backend.occultBatch(triples, "LT", ets).transitions).toBeUndefined();
+      expect(backend.occultBatch([], "LT", ets).codes.length).toBe(0);
+
+      let caught: unknown;
+      try {
+        backend.occultBatch([{ ...triples[0]!, targ2: "NOT_A_BODY" }], "LT", ets);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as { index?: number }).index).toBe(0);
+
+      // Rejected by occult even where the bounding spheres are apart.
+      expect(() => backend.occultBatch(triples, "LT+S", ets)).toThrow();
+      caught = undefined;
+      try {
+        backend.occultBatch([triples[0]!, { ...triples[1]!, frame2: "NOT_A_FRAME" }], "LT", ets);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as { index?: number }).index).toBe(ets.length);
+    } finally {
+      backend.kclear();
+    }
+  });
+});
@@ -0,0 +1,263 @@
+import { describe, expect, it } from "vitest";
+
+import type { SpiceWindow } from "@rybosome/tspice-backend-contract";
+import {
+  createNodeBackend,
+  isCspiceExecutorEnabled,
+  setCspiceExecutorEnabled,
+} from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node async GF", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("gfdistAsync resolves with the same window as gfdist", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    const cnfine = backend.newWindow(2);
+    const syncResult = backend.newWindow(100);
+    const asyncResult = backend.newWindow(100);
+
+    try {
+      backend.wninsd(0, 30 * 86_400, cnfine);
+
+      backend.gfdist("MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, cnfine, syncResult);
+
+      const pending = backend.gfdistAsync(
+        "MOON",
+        "NONE",
+        "EARTH",
+        ">",
+        400_000,
+        0,
+        86_400,
+        100,
+        cnfine,
+        asyncResult,
+      );
+      expect(pending).toBeInstanceOf(Promise);
+      await expect(pending).resolves.toBe(asyncResult);
+
+      const card = backend.wncard(asyncResult);
+      expect(card).toBeGreaterThan(0);
+      expect(card).toBe(backend.wncard(syncResult));
+      for (let i = 0; i < card; i++) {
+        expect(backend.wnfetd(asyncResult, i)).toEqual(backend.wnfetd(syncResult, i));
+      }
+    } finally {
+      backend.freeWindow(asyncResult);
+      backend.freeWindow(syncResult);
+      backend.freeWindow(cnfine);
+      backend.kclear();
+    }
+  });
+
+  itNative("reads cells while a search is in flight", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    const cnfine = backend.newWindow(2);
+    const result = backend.newWindow(100);
+    const other = backend.newWindow(4);
+    const ids = backend.newIntCell(4);
+
+    try {
+      backend.wninsd(0, 30 * 86_400, cnfine);
+      backend.wninsd(1, 2, other);
+      backend.wninsd(5, 8, other);
+      backend.insrti(42, ids);
+
+      const pending = backend.gfdistAsync(
+        "MOON",
+        "NONE",
+        "EARTH",
+        ">",
+        400_000,
+        0,
+        86_400,
+        100,
+        cnfine,
+        result,
+      );
+
+      // `other` and `ids` are read without the CSPICE lock; `cnfine` may be pinned by the search,
+      // in which case the read waits for it. Either way the values are unchanged.
+      expect(backend.wncard(other)).toBe(2);
+      expect(backend.wnfetd(other, 1)).toEqual([5, 8]);
+      expect(backend.card(ids)).toBe(1);
+      expect(backend.size(ids)).toBe(4);
+      expect(backend.cellGeti(ids, 0)).toBe(42);
+      expect(backend.wncard(cnfine)).toBe(1);
+      expect(backend.wnfetd(cnfine, 0)).toEqual([0, 30 * 86_400]);
+
+      await expect(pending).resolves.toBe(result);
+      expect(backend.wncard(result)).toBeGreaterThan(0);
+
+      // Out-of-range reads still go through CSPICE for their errors.
+      expect(() => backend.wnfetd(other, 2)).toThrow();
+      expect(() => backend.cellGeti(ids, 1)).toThrow();
+    } finally {
+      backend.freeCell(ids);
+      backend.freeWindow(other);
+      backend.freeWindow(result);
+      backend.freeWindow(cnfine);
+      backend.kclear();
+    }
+  });
+
+  itNative("runs queued async searches in FIFO order on the CSPICE executor", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    const cnfine = backend.newWindow(2);
+    const expected = backend.newWindow(100);
+    const results = [backend.newWindow(100), backend.newWindow(100), backend.newWindow(100)];
+
+    expect(isCspiceExecutorEnabled()).toBe(false);
+    setCspiceExecutorEnabled(true);
+    try {
+      expect(isCspiceExecutorEnabled()).toBe(true);
+      backend.wninsd(0, 30 * 86_400, cnfine);
+      backend.gfdist("MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, cnfine, expected);
+
+      const order: number[] = [];
+      await Promise.all(
+        results.map((result, i) =>
+          backend
+            .gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, cnfine, result)
+            .then(() => order.push(i)),
+        ),
+      );
+      expect(order).toEqual([0, 1, 2]);
+
+      for (const result of results) {
+        expect(backend.wncard(result)).toBe(backend.wncard(expected));
+        expect(backend.wnfetd(result, 0)).toEqual(backend.wnfetd(expected, 0));
+      }
+    } finally {
+      setCspiceExecutorEnabled(false);
+      for (const result of results) backend.freeWindow(result);
+      backend.freeWindow(expected);
+      backend.freeWindow(cnfine);
+      backend.kclear();
+    }
+  });
+
+  itNative("gfsepAsync/gfdistAsync reject instead of throwing", async () => {
+    const backend = createNodeBackend();
+
+    const cnfine = backend.newWindow(2);
+    const result = backend.newWindow(10);
+
+    try {
+      backend.wninsd(0, 86_400, cnfine);
+
+      // No kernels loaded: CSPICE fails inside the worker.
+      await expect(
+        backend.gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 3600, 10, cnfine, result),
+      ).rejects.toThrow(/gfdistAsync\(MOON\)/);
+
+      // Unknown handles are reported as RangeErrors from the worker.
+      const bogus = 0x7fff_fff0 as unknown as SpiceWindow;
+      await expect(
+        backend.gfsepAsync(
+          "MOON",
+          "POINT",
+          "NULL",
+          "SUN",
+          "POINT",
+          "NULL",
+          "NONE",
+          "EARTH",
+          ">",
+          0.5,
+          0,
+          3600,
+          10,
+          cnfine,
+          bogus,
+        ),
+      ).rejects.toBeInstanceOf(RangeError);
+
+      // Argument validation failures also surface as rejections.
+      await expect(
+        backend.gfdistAsync("MOON", "NONE", "EARTH", ">", Number.NaN, 0, 3600, 10, cnfine, result),
+      ).rejects.toThrow(/gfdistAsync\(refval\)/);
+    } finally {
+      backend.freeWindow(result);
+      backend.freeWindow(cnfine);
+    }
+  });
+
+  itNative("gfsepAsync/gfdistAsync honor deadlines and abort signals", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+    const cnfine = backend.newWindow(2);
+    const expected = backend.newWindow(100);
+    const result = backend.newWindow(100);
+
+    try {
+      backend.wninsd(0, 30 * 86_400, cnfine);
+      backend.gfsep("MOON", "POINT", "NULL", "SUN", "POINT", "NULL", "NONE", "EARTH", ">", 1, 0, 86_400, 100, cnfine, expected);
+
+      // A generous deadline runs the interruptible search to the same answer.
+      await expect(
+        backend.gfsepAsync("MOON", "POINT", "NULL", "SUN", "POINT", "NULL", "NONE", "EARTH", ">", 1, 0, 86_400, 100, cnfine, result, {
+          timeoutMs: 60_000,
+          signal: new AbortController().signal,
+        }),
+      ).resolves.toBe(result);
+      const card = backend.wncard(result);
+      expect(card).toBeGreaterThan(0);
+      expect(card).toBe(backend.wncard(expected));
+      for (let i = 0; i < card; i++) {
+        expect(backend.wnfetd(result, i)).toEqual(backend.wnfetd(expected, i));
+      }
+
+      // Already past its deadline when it reaches the CSPICE lock: never starts.
+      await expect(
+        backend.gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 60, 100, cnfine, result, { timeoutMs: 0 }),
+      ).rejects.toMatchObject({ name: "TimeoutError", message: "gfdistAsync(): deadline exceeded" });
+
+      const aborted = new AbortController();
+      aborted.abort();
+      await expect(
+        backend.gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 60, 100, cnfine, result, {
+          signal: aborted.signal,
+        }),
+      ).rejects.toMatchObject({ name: "AbortError" });
+
+      // Aborted while queued or mid-search: the search stops and leaves `result` empty.
+      const controller = new AbortController();
+      const pending = backend.gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 60, 100, cnfine, result, {
+        signal: controller.signal,
+      });
+      controller.abort();
+      await expect(pending).rejects.toMatchObject({ name: "AbortError", message: "gfdistAsync(): cancelled" });
+      expect(backend.wncard(result)).toBe(0);
+
+      // The next search is unaffected.
+      await expect(
+        backend.gfdistAsync("MOON", "NONE", "EARTH", ">", 400_000, 0, 86_400, 100, cnfine, result),
+      ).resolves.toBe(result);
+      expect(backend.wncard(result)).toBeGreaterThan(0);
+    } finally {
+      backend.freeWindow(result);
+      backend.freeWindow(expected);
+      backend.freeWindow(cnfine);
+      backend.kclear();
+    }
+  });
+});
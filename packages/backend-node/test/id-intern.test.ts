@@ -0,0 +1,100 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { indexNameTable } from "@rybosome/tspice-core";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+describe("@rybosome/tspice-backend-node interned IDs", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("internBody/internFrame match bods2c/namfrm and follow boddef", () => {
+    const backend = createNodeBackend();
+
+    try {
+      expect(backend.internBody("EARTH")).toBe(399);
+      expect(backend.internBody("EARTH")).toBe(399);
+      expect(backend.internFrame("J2000")).toBe(1);
+      expect(backend.internFrame("ECLIPJ2000")).toBe(17);
+
+      expect(() => backend.internBody("NOT_A_BODY_NAME")).toThrow(RangeError);
+      expect(() => backend.internFrame("NOT_A_FRAME")).toThrow(RangeError);
+
+      // `boddef` drops the cache, so a name that was interned earlier picks up the new mapping.
+      backend.boddef("TSPICE_INTERN_TEST", -9_001);
+      expect(backend.internBody("TSPICE_INTERN_TEST")).toBe(-9_001);
+      backend.boddef("TSPICE_INTERN_TEST", -9_002);
+      expect(backend.internBody("TSPICE_INTERN_TEST")).toBe(-9_002);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("spkezId/spkgeoId/pxformId match the frame-name variants", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const earth = backend.internBody("EARTH");
+      const sun = backend.internBody("SUN");
+      const j2000 = backend.internFrame("J2000");
+      const eclip = backend.internFrame("ECLIPJ2000");
+      const et = 86_400;
+
+      expect(backend.spkezId(earth, et, eclip, "LT+S", sun)).toEqual(
+        backend.spkez(earth, et, "ECLIPJ2000", "LT+S", sun),
+      );
+      expect(backend.spkgeoId(earth, et, j2000, sun)).toEqual(backend.spkgeo(earth, et, "J2000", sun));
+
+      const m = backend.pxform("J2000", "ECLIPJ2000", et);
+      expect(Array.from(backend.pxformId(j2000, eclip, et))).toEqual(Array.from(m));
+      const out = new Float64Array(9);
+      backend.pxformIdInto(j2000, eclip, et, out);
+      expect(Array.from(out)).toEqual(Array.from(m));
+
+      expect(() => backend.pxformId(j2000, 123_456_789, et)).toThrow(/unknown frame ID 123456789/);
+      expect(() => backend.spkezId(earth, et, 123_456_789, "NONE", sun)).toThrow(RangeError);
+
+      expect(() => backend.pxformId(1.5, 1, 0)).toThrow(/fromId to be a 32-bit signed integer/);
+      expect(() => backend.pxformId(j2000, Number.NaN, et)).toThrow(/toId to be a 32-bit signed integer/);
+      expect(() => backend.pxformIdInto(2 ** 40, eclip, et, out)).toThrow(TypeError);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("exportBodyNameTable/exportFrameTable list built-in, kernel and boddef names", () => {
+    const backend = createNodeBackend();
+
+    try {
+      backend.boddef("TSPICE_TABLE_DEFINED", -9_101);
+      backend.pcpool("NAIF_BODY_NAME", ["TSPICE_TABLE_POOL"]);
+      backend.pipool("NAIF_BODY_CODE", [-9_102]);
+
+      const bodies = backend.exportBodyNameTable();
+      expect(bodies.generation).toBe(backend.kernelPoolGeneration());
+      const bodyIndex = indexNameTable(bodies);
+      expect(bodyIndex.codeOf("earth")).toBe(399);
+      expect(bodyIndex.codeOf("Solar  System Barycenter")).toBe(0);
+      expect(bodyIndex.nameOf(399)).toBe("EARTH");
+      expect(bodyIndex.codeOf("TSPICE_TABLE_DEFINED")).toBe(-9_101);
+      expect(bodyIndex.codeOf("TSPICE_TABLE_POOL")).toBe(-9_102);
+      for (const { code, name } of bodyIndex.entries.slice(0, 50)) {
+        expect(backend.bodn2c(name)).toEqual({ found: true, code });
+      }
+
+      const frames = backend.exportFrameTable();
+      const frameIndex = indexNameTable(frames);
+      expect(frameIndex.codeOf("J2000")).toBe(1);
+      expect(frameIndex.codeOf("eclipj2000")).toBe(17);
+      expect(frameIndex.nameOf(10_013)).toBe("IAU_EARTH");
+      expect(Array.from(frames.codes)).toEqual([...frames.codes].sort((a, b) => a - b));
+    } finally {
+      backend.kclear();
+    }
+  });
+});
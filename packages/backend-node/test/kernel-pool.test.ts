@@ -57,4 +57,121 @@ describe("@rybosome/tspice-backend-node kernel pool", () => {
       expect(() => b.swpool("AGENT", [blank])).toThrow(RangeError);
     }
   });
+
+  itNative("bumps lock-free generations and notifies subscribers on pool changes", () => {
+    const b = createNodeBackend();
+    const other = createNodeBackend();
+
+    const events: Array<{ generation: number; kinds: readonly string[] }> = [];
+    const unsubscribe = b.subscribeKernelPoolChanges((event) => events.push(event));
+    try {
+      const before = b.kernelPoolGeneration();
+      const bodiesBefore = b.kernelPoolGeneration("bodies");
+
+      other.pdpool("TSPICE_GENERATION_TEST", [1, 2]);
+      expect(b.kernelPoolGeneration()).toBe(before + 1);
+      expect(b.kernelPoolGeneration("bodies")).toBe(bodiesBefore);
+      expect(events).toEqual([{ generation: before + 1, kinds: ["variables"] }]);
+
+      b.boddef("TSPICE_GENERATION_BODY", -999123);
+      expect(events.at(-1)).toEqual({ generation: before + 2, kinds: ["bodies"] });
+
+      // Rejected before touching CSPICE: no bump, no event.
+      expect(() => b.pdpool("", [1])).toThrow(RangeError);
+      expect(events).toHaveLength(2);
+
+      b.kclear();
+      expect(events.at(-1)?.kinds).toEqual(["kernels"]);
+      expect(() => b.kernelPoolGeneration("nope" as any)).toThrow(RangeError);
+    } finally {
+      unsubscribe();
+      b.kclear();
+    }
+
+    other.pdpool("TSPICE_GENERATION_TEST", [3]);
+    expect(events).toHaveLength(3);
+    other.kclear();
+  });
+
+  itNative("loadTextKernelFromBuffer pools a text kernel's assignments", () => {
+    const b = createNodeBackend();
+
+    const kernel = [
+      "KPL/IK",
+      "TSPICE_TK_COMMENT = 1 is commentary outside \\begindata",
+      "\\begindata",
+      "   TSPICE_TK_SCALAR = 1.5D3",
+      "   TSPICE_TK_VECTOR = ( 1, 2 3,",
+      "                        -4.5E-1 )",
+      "   TSPICE_TK_STRINGS = ( 'it''s', 'B' )",
+      "   TSPICE_TK_DATES = ( @2000-01-01T12:00:00 @1972-JAN-1 )",
+      "   TSPICE_TK_APPEND += ( 2 3 )",
+      "   TSPICE_TK_VECTOR += 5",
+      "\\begintext",
+      "   TSPICE_TK_IGNORED = 2",
+      "",
+    ].join("\r\n");
+
+    try {
+      b.pdpool("TSPICE_TK_APPEND", [1]);
+      expect(b.loadTextKernelFromBuffer("test.ti", new TextEncoder().encode(kernel))).toBe(5);
+
+      expect(b.gdpool("TSPICE_TK_SCALAR", 0, 10)).toEqual({ found: true, values: [1500] });
+      expect(b.gdpool("TSPICE_TK_VECTOR", 0, 10)).toEqual({ found: true, values: [1, 2, 3, -0.45, 5] });
+      expect(b.gcpool("TSPICE_TK_STRINGS", 0, 10)).toEqual({ found: true, values: ["it's", "B"] });
+      expect(b.gdpool("TSPICE_TK_DATES", 0, 10)).toEqual({ found: true, values: [0, -883_656_000] });
+      expect(b.gdpool("TSPICE_TK_APPEND", 0, 10)).toEqual({ found: true, values: [1, 2, 3] });
+      expect(b.dtpool("TSPICE_TK_COMMENT")).toEqual({ found: false });
+      expect(b.dtpool("TSPICE_TK_IGNORED")).toEqual({ found: false });
+
+      const load = (text: string) => b.loadTextKernelFromBuffer("bad.tf", new TextEncoder().encode(text));
+      expect(() => load("\\begindata\nTSPICE_TK_BAD = ( 1 'a' )\n")).toThrow(/line 2: .*mix strings and numbers/);
+      expect(() => load("\\begindata\nTSPICE_TK_BAD = ( 1\n")).toThrow(/never closed/);
+      expect(() => load("\\begindata\nKERNELS_TO_LOAD = ( 'a.bsp' )\n")).toThrow(/furnsh/);
+
+      // `+=` onto a numeric pool variable with strings fails before anything is written.
+      expect(() => load("\\begindata\nTSPICE_TK_FIRST = 1\nTSPICE_TK_APPEND += 'x'\n")).toThrow(
+        /cannot append string values/,
+      );
+      expect(b.dtpool("TSPICE_TK_FIRST")).toEqual({ found: false });
+    } finally {
+      b.kclear();
+    }
+  });
+
+  itNative("poolSnapshot reads every matching variable in one call", () => {
+    const b = createNodeBackend();
+
+    const numbers = Array.from({ length: 300 }, (_, i) => i * 0.5);
+    const strings = Array.from({ length: 150 }, (_, i) => `VALUE_${i}`);
+    try {
+      b.pdpool("TSPICE_SNAP_NUM", numbers);
+      b.pcpool("TSPICE_SNAP_STR", strings);
+      b.pipool("TSPICE_SNAP_INT", [7, -3]);
+      b.pdpool("TSPICE_OTHER", [1]);
+
+      const snap = b.poolSnapshot("TSPICE_SNAP_*");
+      expect([...snap.names].sort()).toEqual(["TSPICE_SNAP_INT", "TSPICE_SNAP_NUM", "TSPICE_SNAP_STR"]);
+
+      const decoder = new TextDecoder();
+      const read = (name: string) => {
+        const i = snap.names.indexOf(name);
+        const start = snap.start[i]!;
+        const count = snap.count[i]!;
+        if (snap.types[i] === "N") return Array.from(snap.numbers.subarray(start, start + count));
+        return Array.from({ length: count }, (_, j) =>
+          decoder.decode(snap.strings.bytes.subarray(snap.strings.offsets[start + j], snap.strings.offsets[start + j + 1])),
+        );
+      };
+
+      expect(read("TSPICE_SNAP_NUM")).toEqual(numbers);
+      expect(read("TSPICE_SNAP_STR")).toEqual(strings);
+      expect(read("TSPICE_SNAP_INT")).toEqual([7, -3]);
+
+      expect(b.poolSnapshot("TSPICE_NO_SUCH_*").names).toEqual([]);
+      expect(() => b.poolSnapshot(" ")).toThrow(RangeError);
+    } finally {
+      b.kclear();
+    }
+  });
 });
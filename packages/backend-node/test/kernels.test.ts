@@ -1,11 +1,13 @@
 import fs from "node:fs";
+import os from "node:os";
 import path from "node:path";
 import { fileURLToPath } from "node:url";
 
 import { describe, expect, it } from "vitest";
 
-import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createNodeBackend, getNativeStats } from "@rybosome/tspice-backend-node";
 import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+import { loadTestKernels } from "./test-kernels.js";
 
 const testDir = path.dirname(fileURLToPath(import.meta.url));
 
@@ -91,4 +93,159 @@ describe("@rybosome/tspice-backend-node kernels", () => {
     backend.unload(kernelPath);
     expect(withTesting.__ktotalAll()).toBe(before);
   });
+
+  itNative.runIf(process.platform === "linux")(
+    "loads byte-backed kernels from memory without a temp file on Linux",
+    async () => {
+      const { getNativeAddon } = await import("../src/runtime/addon.js");
+      const native = getNativeAddon();
+      expect(native.kernelBuffersSupported()).toBe(true);
+
+      const backend = createNodeBackend();
+      const bytes = fs.readFileSync(path.join(testDir, "fixtures", "minimal.tm"));
+      const kernelPath = "/kernels/minimal-buffer.tm";
+
+      backend.furnsh({ path: kernelPath, bytes });
+      try {
+        let spicePath: string | undefined;
+        for (let i = 0; i < native.ktotal("ALL"); i++) {
+          const kd = native.kdata(i, "ALL");
+          if (kd.found && kd.file?.startsWith("/proc/self/fd/")) spicePath = kd.file;
+        }
+        expect(spicePath).toBeDefined();
+        expect(backend.kinfo(kernelPath).found).toBe(true);
+      } finally {
+        backend.unload(kernelPath);
+      }
+      expect(backend.kinfo(kernelPath).found).toBe(false);
+    },
+  );
+
+  itNative.runIf(process.platform === "linux")(
+    "reports in-memory kernels in getNativeStats().memory until unload/kclear",
+    () => {
+      const backend = createNodeBackend();
+      const bytes = fs.readFileSync(path.join(testDir, "fixtures", "minimal.tm"));
+      const before = getNativeStats().memory.kernelBuffers;
+
+      backend.furnsh({ path: "/kernels/memory-a.tm", bytes });
+      backend.furnsh({ path: "/kernels/memory-b.tm", bytes });
+      expect(getNativeStats().memory.kernelBuffers).toEqual({
+        count: before.count + 2,
+        bytes: before.bytes + 2 * bytes.byteLength,
+      });
+
+      backend.unload("/kernels/memory-a.tm");
+      expect(getNativeStats().memory.kernelBuffers).toEqual({
+        count: before.count + 1,
+        bytes: before.bytes + bytes.byteLength,
+      });
+
+      backend.kclear();
+      expect(getNativeStats().memory.kernelBuffers).toEqual(before);
+    },
+  );
+
+  itNative.runIf(process.platform === "linux")(
+    "releaseKernelBuffer() only closes descriptors that furnshBuffer() created",
+    async () => {
+      const { getNativeAddon } = await import("../src/runtime/addon.js");
+      const native = getNativeAddon();
+
+      const fd = fs.openSync(path.join(testDir, "fixtures", "minimal.tm"), "r");
+      try {
+        native.releaseKernelBuffer(`/proc/self/fd/${fd}`);
+        expect(() => fs.fstatSync(fd)).not.toThrow();
+      } finally {
+        fs.closeSync(fd);
+      }
+
+      const bufferPath = native.furnshBuffer("minimal.tm", fs.readFileSync(path.join(testDir, "fixtures", "minimal.tm")));
+      native.unload(bufferPath);
+      native.releaseKernelBuffer(bufferPath);
+      // A second release is ignored rather than closing whatever reused the descriptor.
+      expect(() => native.releaseKernelBuffer(bufferPath)).not.toThrow();
+    },
+  );
+
+  itNative("furnshBuffer() rejects non-Uint8Array bytes", async () => {
+    const { getNativeAddon } = await import("../src/runtime/addon.js");
+    const native = getNativeAddon();
+    expect(() => native.furnshBuffer("x.tm", [1, 2, 3] as unknown as Uint8Array)).toThrow(
+      /expects a string and a Uint8Array/,
+    );
+  });
+
+  itNative("kernelSetSnapshot()/kernelSetRestore() round-trip the pool and binary kernels", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const dir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-kernel-set-"));
+    const spkPath = path.join(dir, "de405s.bsp");
+    fs.writeFileSync(spkPath, spk);
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh(spkPath);
+      backend.pcpool("TSPICE_SET_NAMES", ["A", "BB"]);
+
+      const et = backend.str2et("2000-01-01T12:00:00");
+      const state = backend.spkezr("EARTH", et, "J2000", "NONE", "SUN");
+
+      const snapshot = backend.kernelSetSnapshot();
+      backend.kclear();
+      expect(backend.ktotal("ALL")).toBe(0);
+
+      backend.kernelSetRestore(snapshot);
+      expect(backend.ktotal("SPK")).toBe(1);
+      expect(backend.ktotal("TEXT")).toBe(0);
+      expect(backend.str2et("2000-01-01T12:00:00")).toBe(et);
+      expect(backend.spkezr("EARTH", et, "J2000", "NONE", "SUN")).toEqual(state);
+      expect(backend.gcpool("TSPICE_SET_NAMES", 0, 10)).toEqual({ found: true, values: ["A", "BB"] });
+
+      expect(() => backend.kernelSetRestore(snapshot.subarray(0, snapshot.length - 1))).toThrow(RangeError);
+      expect(() => backend.kernelSetRestore(new Uint8Array([1, 2, 3]))).toThrow(/not a kernel-set snapshot/);
+
+      backend.kclear();
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+      expect(() => backend.kernelSetSnapshot()).toThrow(/byte-backed/);
+    } finally {
+      backend.kclear();
+      fs.rmSync(dir, { recursive: true, force: true });
+    }
+  });
+
+  itNative("opens lazily registered SPKs on demand", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const dir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-lazy-kernels-"));
+    const spkPath = path.join(dir, "de405s.bsp");
+    fs.writeFileSync(spkPath, spk);
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      const et = backend.str2et("2000-01-01T12:00:00");
+
+      const opensBefore = backend.lazyKernelStats().opens;
+      backend.registerLazyKernel(spkPath);
+      backend.registerLazyKernel(spkPath);
+      expect(backend.lazyKernelStats()).toMatchObject({ registered: 1, open: 0 });
+      expect(backend.ktotal("SPK")).toBe(0);
+
+      const state = backend.spkezr("EARTH", et, "J2000", "NONE", "SUN");
+      expect(state.state).toHaveLength(6);
+      expect(backend.lazyKernelStats()).toMatchObject({ registered: 1, open: 1, opens: opensBefore + 1 });
+      expect(backend.ktotal("SPK")).toBe(1);
+
+      expect(backend.unregisterLazyKernel(spkPath)).toBe(true);
+      expect(backend.unregisterLazyKernel(spkPath)).toBe(false);
+      expect(backend.lazyKernelStats()).toMatchObject({ registered: 0, open: 0 });
+      expect(() => backend.spkezr("EARTH", et, "J2000", "NONE", "SUN")).toThrow();
+
+      expect(() => backend.registerLazyKernel(path.join(testDir, "fixtures", "minimal.tm"))).toThrow(/not an SPK/);
+      expect(() => backend.setLazyKernelBudget(0)).toThrow(RangeError);
+    } finally {
+      backend.kclear();
+      fs.rmSync(dir, { recursive: true, force: true });
+    }
+  });
 });
@@ -0,0 +1,314 @@
+import fs from "node:fs";
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createWasmBackend } from "@rybosome/tspice-backend-wasm";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const SCLK_FIXTURE_PATH = fileURLToPath(
+  new URL("../../tspice/test/fixtures/kernels/cook_01.tsc", import.meta.url),
+);
+
+describe("@rybosome/tspice-backend-node batch APIs", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("spkezrBatch/spkposBatch match per-epoch spkezr/spkpos", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const ets = new Float64Array([0, 3600, 86_400, 10 * 86_400]);
+
+      const batch = backend.spkezrBatch("EARTH", ets, "J2000", "LT+S", "SUN");
+      expect(batch.states).toBeInstanceOf(Float64Array);
+      expect(batch.states.length).toBe(ets.length * 6);
+      expect(batch.lts.length).toBe(ets.length);
+
+      const posBatch = backend.spkposBatch("EARTH", ets, "J2000", "LT+S", "SUN");
+      expect(posBatch.positions.length).toBe(ets.length * 3);
+
+      for (let i = 0; i < ets.length; i++) {
+        const one = backend.spkezr("EARTH", ets[i]!, "J2000", "LT+S", "SUN");
+        expect(Array.from(batch.states.subarray(i * 6, i * 6 + 6))).toEqual(one.state);
+        expect(batch.lts[i]).toBe(one.lt);
+
+        const pos = backend.spkpos("EARTH", ets[i]!, "J2000", "LT+S", "SUN");
+        expect(Array.from(posBatch.positions.subarray(i * 3, i * 3 + 3))).toEqual(pos.pos);
+        expect(posBatch.lts[i]).toBe(pos.lt);
+      }
+
+      const empty = backend.spkezrBatch("EARTH", new Float64Array(0), "J2000", "NONE", "SUN");
+      expect(empty.states.length).toBe(0);
+      expect(empty.lts.length).toBe(0);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("spkezrBatch/spkposBatch stop at their deadline", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const ets = new Float64Array([0, 3600, 86_400]);
+      const plain = backend.spkezrBatch("EARTH", ets, "J2000", "LT+S", "SUN");
+      const timed = backend.spkezrBatch("EARTH", ets, "J2000", "LT+S", "SUN", { timeoutMs: 60_000 });
+      expect(timed.states).toEqual(plain.states);
+      expect(timed.lts).toEqual(plain.lts);
+
+      let caught: unknown;
+      try {
+        backend.spkezrBatch("EARTH", ets, "J2000", "LT+S", "SUN", { timeoutMs: 0 });
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toMatchObject({ name: "TimeoutError", message: "spkezrBatch(): deadline exceeded" });
+      expect(() => backend.spkposBatch("EARTH", ets, "J2000", "NONE", "SUN", { timeoutMs: 0 })).toThrow(
+        /spkposBatch\(\): deadline exceeded/,
+      );
+
+      const controller = new AbortController();
+      controller.abort();
+      expect(() =>
+        backend.spkposBatch("EARTH", ets, "J2000", "NONE", "SUN", { signal: controller.signal }),
+      ).toThrow(/spkposBatch\(\): cancelled/);
+
+      // A failed batch leaves no hook behind.
+      expect(backend.spkposBatch("EARTH", ets, "J2000", "NONE", "SUN").positions.length).toBe(9);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("spkezrBatch light-time pipeline agrees with spkezr for every correction", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const ets = new Float64Array(500).map((_, i) => i * 3600);
+      for (const abcorr of ["LT", "LT+S", "CN", "CN+S", "XLT", "XLT+S", "XCN", "XCN+S", " cn + s "]) {
+        for (const ref of ["J2000", "ECLIPJ2000"]) {
+          const batch = backend.spkezrBatch("MOON", ets, ref, abcorr, "EARTH");
+          for (let i = 0; i < ets.length; i += 37) {
+            const one = backend.spkezr("MOON", ets[i]!, ref, abcorr, "EARTH");
+            const row = batch.states.subarray(i * 6, i * 6 + 6);
+            const scale = Math.hypot(one.state[0], one.state[1], one.state[2]);
+            for (let k = 0; k < 6; k++) {
+              expect(Math.abs(row[k]! - one.state[k]!)).toBeLessThanOrEqual(1e-12 * scale);
+            }
+            expect(Math.abs(batch.lts[i]! - one.lt)).toBeLessThanOrEqual(1e-15 * Math.max(1, one.lt));
+          }
+        }
+      }
+
+      // Past the end of the kernel: the error names the first failing epoch, as per-epoch calls do.
+      let caught: unknown;
+      try {
+        backend.spkezrBatch("MOON", new Float64Array([0, 1e12, 2e12]), "J2000", "CN+S", "EARTH");
+      } catch (err) {
+        caught = err;
+      }
+      expect((caught as { index?: unknown }).index).toBe(1);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("spkezrBatch reports the failing epoch index", () => {
+    const backend = createNodeBackend();
+
+    let caught: unknown;
+    try {
+      backend.spkezrBatch("EARTH", new Float64Array([0, 1]), "J2000", "NONE", "SUN");
+    } catch (err) {
+      caught = err;
+    }
+
+    expect(caught).toBeInstanceOf(Error);
+    expect((caught as Error).message).toMatch(/ets\[0\]/);
+    expect((caught as { index?: unknown }).index).toBe(0);
+  });
+
+  itNative("spkezrBatch rejects non-Float64Array epochs", () => {
+    const backend = createNodeBackend();
+    expect(() =>
+      backend.spkezrBatch("EARTH", [0, 1] as unknown as Float64Array, "J2000", "NONE", "SUN"),
+    ).toThrow(/Float64Array/);
+  });
+
+  itNative("str2etBatch/et2utcBatch match per-epoch str2et/et2utc", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+
+      const times = [
+        "2000-01-01T12:00:00",
+        "2017-06-30T08:15:42.125",
+        "1999-365T23:59:59.5",
+        "1985-07-01",
+        "2016-12-31T23:59:60.5",
+        "2000 JAN 01 12:00:00 TDB",
+        "JD 2451545.0",
+      ];
+      const ets = backend.str2etBatch(times);
+      expect(ets).toBeInstanceOf(Float64Array);
+      expect(ets.length).toBe(times.length);
+      times.forEach((time, i) => {
+        expect(Math.abs(ets[i]! - backend.str2et(time))).toBeLessThan(1e-6);
+      });
+
+      const decoder = new TextDecoder();
+      for (const format of ["C", "D", "ISOC", "ISOD", "J"]) {
+        for (const prec of [0, 3, 6]) {
+          const { offsets, bytes } = backend.et2utcBatch(ets, format, prec);
+          expect(offsets.length).toBe(ets.length + 1);
+          for (let i = 0; i < ets.length; i++) {
+            const text = decoder.decode(bytes.subarray(offsets[i]!, offsets[i + 1]!));
+            expect(text).toBe(backend.et2utc(ets[i]!, format, prec));
+          }
+        }
+      }
+
+      expect(backend.str2etBatch([])).toHaveLength(0);
+      expect(Array.from(backend.et2utcBatch(new Float64Array(0), "ISOC", 3).offsets)).toEqual([0]);
+
+      let caught: unknown;
+      try {
+        backend.str2etBatch(["2000-01-01T12:00:00", "not a time"]);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as Error).message).toMatch(/times\[1\]/);
+      expect((caught as { index?: unknown }).index).toBe(1);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  // The node scalars read the same leap-second snapshot as the batches, so the WASM build of CSPICE
+  // is the reference here.
+  itNative("deltetBatch/unitimBatch match CSPICE (WASM) and follow kernel changes", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const wasm = await createWasmBackend();
+
+    try {
+      expect(() => backend.deltetBatch(new Float64Array([0]), "ET")).toThrow();
+
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      wasm.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+
+      // Includes epochs before the leap-second table and right at the 2017 leap second.
+      const leap2017 = wasm.str2et("2017-01-01T00:00:00");
+      const epochs = new Float64Array([-1e9, -1e8, 0, 5e8, leap2017 - 0.5, leap2017, 1e9]);
+
+      const expectMatchesWasm = () => {
+        for (const eptype of ["ET", "UTC"] as const) {
+          const deltas = backend.deltetBatch(epochs, eptype);
+          epochs.forEach((epoch, i) => {
+            expect(Math.abs(deltas[i]! - wasm.deltet(epoch, eptype))).toBeLessThan(1e-9);
+          });
+        }
+
+        for (const [insys, outsys] of [
+          ["ET", "TAI"],
+          ["TAI", "TDB"],
+          ["TDB", "TDT"],
+          ["TDT", "JDTDB"],
+          ["JED", "JDTDT"],
+        ] as const) {
+          const input = insys.startsWith("J")
+            ? epochs.map((e) => 2_451_545 + e / 86_400)
+            : epochs;
+          const out = backend.unitimBatch(input, insys, outsys);
+          input.forEach((epoch, i) => {
+            expect(Math.abs(out[i]! - wasm.unitim(epoch, insys, outsys))).toBeLessThan(1e-9);
+          });
+        }
+      };
+
+      expectMatchesWasm();
+
+      // A pool write must reach the batches, not just a fresh furnsh.
+      for (const b of [backend, wasm]) {
+        b.pdpool("DELTET/DELTA_T_A", [40.5]);
+        b.pdpool("DELTET/K", [2e-3]);
+      }
+      expectMatchesWasm();
+
+      expect(() => backend.unitimBatch(new Float64Array([0]), "ET", "NOPE")).toThrow(/epochs\[0\]/);
+
+      backend.kclear();
+      expect(() => backend.deltetBatch(new Float64Array([0]), "ET")).toThrow();
+      expect(() => backend.unitim(0, "ET", "TAI")).toThrow();
+    } finally {
+      backend.kclear();
+      wasm.kclear();
+    }
+  });
+
+  itNative("SCLK batches match the scalar SCLK conversions", () => {
+    const backend = createNodeBackend();
+    const sc = -77;
+
+    try {
+      backend.furnsh({ path: "/kernels/cook_01.tsc", bytes: fs.readFileSync(SCLK_FIXTURE_PATH) });
+
+      const sclkchs = ["1/0:0:0:0", "593328:90:5:0", "1/100:0:0:0", "1/3231:12:3:4"];
+      const sclkdps = backend.scencdBatch(sc, sclkchs);
+      sclkchs.forEach((sclkch, i) => expect(sclkdps[i]).toBe(backend.scencd(sc, sclkch)));
+
+      const ets = backend.sct2eBatch(sc, sclkdps);
+      const viaStrings = backend.scs2eBatch(sc, sclkchs);
+      sclkdps.forEach((sclkdp, i) => {
+        const et = backend.sct2e(sc, sclkdp);
+        expect(Math.abs(ets[i]! - et)).toBeLessThan(1e-6);
+        expect(Math.abs(viaStrings[i]! - backend.scs2e(sc, sclkchs[i]!))).toBeLessThan(1e-6);
+      });
+
+      const ticks = backend.sce2cBatch(sc, ets);
+      ets.forEach((et, i) => expect(Math.abs(ticks[i]! - backend.sce2c(sc, et))).toBeLessThan(1e-4));
+
+      const decoder = new TextDecoder();
+      const decoded = backend.scdecdBatch(sc, sclkdps);
+      const encoded = backend.sce2sBatch(sc, ets);
+      for (let i = 0; i < sclkdps.length; i++) {
+        expect(decoder.decode(decoded.bytes.subarray(decoded.offsets[i]!, decoded.offsets[i + 1]!))).toBe(
+          backend.scdecd(sc, sclkdps[i]!),
+        );
+        expect(decoder.decode(encoded.bytes.subarray(encoded.offsets[i]!, encoded.offsets[i + 1]!))).toBe(
+          backend.sce2s(sc, ets[i]!),
+        );
+      }
+
+      expect(backend.sct2eBatch(sc, new Float64Array(0))).toHaveLength(0);
+
+      let caught: unknown;
+      try {
+        backend.scencdBatch(sc, ["1/0:0:0:0", "not a clock"]);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as { index?: unknown }).index).toBe(1);
+
+      backend.kclear();
+      expect(() => backend.sct2eBatch(sc, new Float64Array([0]))).toThrow(/sclkdps\[0\]/);
+    } finally {
+      backend.kclear();
+    }
+  });
+});
@@ -0,0 +1,98 @@
+import { execFileSync } from "node:child_process";
+import path from "node:path";
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const packageRoot = path.resolve(path.dirname(fileURLToPath(import.meta.url)), "..");
+
+// The flag is read once per process when the addon loads, so enabled runs happen in a child.
+const childScript = `
+import { createNodeBackend, getNativeStats, resetNativeStats } from "@rybosome/tspice-backend-node";
+
+const backend = createNodeBackend();
+backend.bodn2c("EARTH");
+resetNativeStats();
+
+for (let i = 0; i < 50; i++) backend.bodn2c("EARTH");
+for (let i = 0; i < 3; i++) {
+  try {
+    backend.pxform("NOT_A_FRAME", "J2000", 0);
+  } catch {}
+}
+
+const out = {};
+const stats = getNativeStats();
+for (const [name, s] of Object.entries(stats.exports)) {
+  out[name] = {
+    calls: s.calls,
+    errors: s.errors,
+    total: { ...s.total, buckets: Array.from(s.total.buckets) },
+    lockWait: s.lockWait.count,
+    cspice: s.cspice.count,
+    marshal: s.marshal.count,
+  };
+}
+console.log(JSON.stringify({ enabled: stats.enabled, exports: out }));
+`;
+
+const offScript = `
+import { createNodeBackend, getNativeStats } from "@rybosome/tspice-backend-node";
+
+createNodeBackend().bodn2c("EARTH");
+const stats = getNativeStats();
+console.log(JSON.stringify({ enabled: stats.enabled, exports: stats.exports }));
+`;
+
+function runChild(script: string, env: NodeJS.ProcessEnv): string {
+  return execFileSync(process.execPath, ["--input-type=module", "-e", script], {
+    cwd: packageRoot,
+    env,
+    encoding: "utf8",
+  });
+}
+
+describe("@rybosome/tspice-backend-node native stats", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("is off unless TSPICE_NATIVE_STATS is set at load", () => {
+    const env = { ...process.env };
+    delete env.TSPICE_NATIVE_STATS;
+    const stats = JSON.parse(runChild(offScript, env).trim().split("\n").pop()!);
+
+    expect(stats.enabled).toBe(false);
+    expect(stats.exports).toEqual({});
+  });
+
+  itNative("counts and times every export call when enabled", () => {
+    const stdout = runChild(childScript, { ...process.env, TSPICE_NATIVE_STATS: "1" });
+    const stats = JSON.parse(stdout.trim().split("\n").pop()!);
+
+    expect(stats.enabled).toBe(true);
+
+    const bodn2c = stats.exports.bodn2c;
+    expect(bodn2c.calls).toBe(50);
+    expect(bodn2c.errors).toBe(0);
+    expect(bodn2c.lockWait).toBeGreaterThanOrEqual(50);
+    expect(bodn2c.cspice).toBe(bodn2c.lockWait);
+    expect(bodn2c.marshal).toBe(50);
+
+    const total = bodn2c.total;
+    expect(total.count).toBe(50);
+    expect(total.maxNs).toBeGreaterThan(0);
+    expect(total.p50Ns).toBeLessThanOrEqual(total.p99Ns);
+    expect(total.p99Ns).toBeLessThanOrEqual(total.maxNs);
+    let bucketed = 0;
+    for (let i = 1; i < total.buckets.length; i += 2) bucketed += total.buckets[i];
+    expect(bucketed).toBe(50);
+
+    expect(stats.exports.pxform.calls).toBe(3);
+    expect(stats.exports.pxform.errors).toBe(3);
+
+    // Reset before the loop dropped the warm-up call; the stats exports are not instrumented.
+    expect(stats.exports.getNativeStats).toBeUndefined();
+    expect(stats.exports.resetNativeStats).toBeUndefined();
+  });
+});
@@ -0,0 +1,75 @@
+import { execFileSync } from "node:child_process";
+import path from "node:path";
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const packageRoot = path.resolve(path.dirname(fileURLToPath(import.meta.url)), "..");
+
+// The flag is read once per process when the addon loads, so enabled runs happen in a child.
+const childScript = `
+import { createNodeBackend, takeNativeTrace } from "@rybosome/tspice-backend-node";
+
+const backend = createNodeBackend();
+backend.bodn2c("EARTH");
+takeNativeTrace();
+
+for (let i = 0; i < 20; i++) backend.bodn2c("EARTH");
+
+console.log(JSON.stringify({ first: JSON.parse(takeNativeTrace()), second: JSON.parse(takeNativeTrace()) }));
+`;
+
+const offScript = `
+import { createNodeBackend, takeNativeTrace } from "@rybosome/tspice-backend-node";
+
+createNodeBackend().bodn2c("EARTH");
+console.log(JSON.stringify({ trace: takeNativeTrace() }));
+`;
+
+function runChild(script: string, env: NodeJS.ProcessEnv): string {
+  return execFileSync(process.execPath, ["--input-type=module", "-e", script], {
+    cwd: packageRoot,
+    env,
+    encoding: "utf8",
+  });
+}
+
+describe("@rybosome/tspice-backend-node native trace", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("is off unless TSPICE_NATIVE_TRACE is set at load", () => {
+    const env = { ...process.env };
+    delete env.TSPICE_NATIVE_TRACE;
+    const { trace } = JSON.parse(runChild(offScript, env).trim().split("\n").pop()!);
+
+    expect(trace).toBeNull();
+  });
+
+  itNative("records export, lock-wait and CSPICE spans as Chrome trace events", () => {
+    const stdout = runChild(childScript, { ...process.env, TSPICE_NATIVE_TRACE: "1" });
+    const { first, second } = JSON.parse(stdout.trim().split("\n").pop()!);
+
+    type Event = { ph: string; name: string; cat?: string; tid: number; ts?: number; dur?: number };
+    const spans = (first.traceEvents as Event[]).filter((e) => e.ph === "X");
+
+    const calls = spans.filter((e) => e.cat === "export" && e.name === "bodn2c");
+    expect(calls).toHaveLength(20);
+    expect(spans.filter((e) => e.cat === "lock").length).toBeGreaterThanOrEqual(20);
+    expect(spans.filter((e) => e.cat === "cspice").length).toBeGreaterThanOrEqual(20);
+    expect(first.otherData.droppedEvents).toBe(0);
+
+    // Each CSPICE hold sits inside a call on the same thread.
+    for (const hold of spans.filter((e) => e.cat === "cspice")) {
+      const parent = calls.find(
+        (c) => c.tid === hold.tid && c.ts! <= hold.ts! && hold.ts! + hold.dur! <= c.ts! + c.dur! + 0.001,
+      );
+      expect(parent).toBeDefined();
+    }
+
+    // Thread names are metadata; draining consumed every span.
+    expect((first.traceEvents as Event[]).some((e) => e.ph === "M" && e.name === "thread_name")).toBe(true);
+    expect((second.traceEvents as Event[]).filter((e) => e.ph === "X")).toHaveLength(0);
+  });
+});
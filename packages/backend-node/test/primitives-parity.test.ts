@@ -1,5 +1,8 @@
 import { describe, expect, it } from "vitest";
 
+import type { Mat3RowMajor, SpiceVector3 } from "@rybosome/tspice-backend-contract";
+import { brandMat3RowMajor } from "@rybosome/tspice-backend-contract";
+
 import { createNodeBackend } from "@rybosome/tspice-backend-node";
 import { createWasmBackend } from "@rybosome/tspice-backend-wasm";
 import { loadTestKernels } from "./test-kernels.js";
@@ -309,4 +312,52 @@ describe("primitives parity (node vs wasm)", () => {
       throw new AggregateError(cleanupErrors, "Cleanup failed");
     }
   }, 20_000);
+
+  // The Node backend runs these without the CSPICE mutex (see `native/src/vector_math.h`); the
+  // WASM backend still calls the CSPICE routines, so the two must agree bit-for-bit on the
+  // purely arithmetic ops. `rotate`/`rotmat`/`axisar` go through each platform's libm `sin`/`cos`,
+  // which may round differently, so those are compared with a tight tolerance instead.
+  itNative("lock-free vector math matches CSPICE", async () => {
+    const node = createNodeBackend();
+    const wasm = await createWasmBackend();
+
+    let seed = 12345;
+    const rand = (): number => {
+      seed = (seed * 1103515245 + 12345) % 2 ** 31;
+      return (seed / 2 ** 31) * 2e3 - 1e3;
+    };
+    const vec = (): SpiceVector3 => [rand(), rand(), rand()];
+    const mat = (): Mat3RowMajor => brandMat3RowMajor(Array.from({ length: 9 }, rand));
+
+    const vectors: SpiceVector3[] = [[0, 0, 0], [1e-300, -1e-300, 0], [1e300, 1e300, -1e300]];
+    for (let i = 0; i < 64; i++) vectors.push(vec());
+
+    for (const a of vectors) {
+      const b = vec();
+      const m = mat();
+      const m2 = mat();
+      const s = rand();
+      expect(node.vnorm(a)).toBe(wasm.vnorm(a));
+      expect(node.vhat(a)).toEqual(wasm.vhat(a));
+      expect(node.vdot(a, b)).toBe(wasm.vdot(a, b));
+      expect(node.vcrss(a, b)).toEqual(wasm.vcrss(a, b));
+      expect(node.vadd(a, b)).toEqual(wasm.vadd(a, b));
+      expect(node.vsub(a, b)).toEqual(wasm.vsub(a, b));
+      expect(node.vminus(a)).toEqual(wasm.vminus(a));
+      expect(node.vscl(s, a)).toEqual(wasm.vscl(s, a));
+      expect(node.mxv(m, a)).toEqual(wasm.mxv(m, a));
+      expect(node.mtxv(m, a)).toEqual(wasm.mtxv(m, a));
+      expect(Array.from(node.mxm(m, m2))).toEqual(Array.from(wasm.mxm(m, m2)));
+
+      const angle = s / 100;
+      for (const axis of [1, 2, 3]) {
+        const r = Array.from(node.rotate(angle, axis));
+        wasm.rotate(angle, axis).forEach((x, i) => expectClose(r[i]!, x, { atol: 1e-15 }));
+        const rm = Array.from(node.rotmat(m, angle, axis));
+        wasm.rotmat(m, angle, axis).forEach((x, i) => expectClose(rm[i]!, x, { atol: 1e-12 }));
+      }
+      const ax = Array.from(node.axisar(a, angle));
+      wasm.axisar(a, angle).forEach((x, i) => expectClose(ax[i]!, x, { atol: 1e-14 }));
+    }
+  }, 20_000);
 });
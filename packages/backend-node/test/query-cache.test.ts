@@ -0,0 +1,118 @@
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend, getQueryCacheStats, setQueryCacheCapacity } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const MGS_DIR = "../../tspice/test/fixtures/kernels/mgs-minimal/";
+const MGS_SCLK = fileURLToPath(new URL(`${MGS_DIR}mgs_sclkscet_00061.tsc`, import.meta.url));
+const MGS_CK = fileURLToPath(new URL(`${MGS_DIR}mgs_hga_hinge_v2.bc`, import.meta.url));
+
+// The fixture CK's segments give the HGA hinge (-94070) relative to -94000. The pack ships no FK,
+// so name the pair here: -94000 as a fixed offset from J2000, -94070 as a CK frame.
+const MGS_FK = `\\begindata
+FRAME_MGS_SPACECRAFT = -94000
+FRAME_-94000_NAME = 'MGS_SPACECRAFT'
+FRAME_-94000_CLASS = 4
+FRAME_-94000_CLASS_ID = -94000
+FRAME_-94000_CENTER = -94
+TKFRAME_-94000_RELATIVE = 'J2000'
+TKFRAME_-94000_SPEC = 'ANGLES'
+TKFRAME_-94000_UNITS = 'DEGREES'
+TKFRAME_-94000_AXES = ( 3, 2, 1 )
+TKFRAME_-94000_ANGLES = ( 0, 0, 0 )
+FRAME_TSPICE_MGS_HGA = -94070
+FRAME_-94070_NAME = 'TSPICE_MGS_HGA'
+FRAME_-94070_CLASS = 3
+FRAME_-94070_CLASS_ID = -94070
+FRAME_-94070_CENTER = -94
+CK_-94070_SCLK = -94
+CK_-94070_SPK = -94
+\\begintext
+`;
+
+describe("@rybosome/tspice-backend-node query cache", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("is off by default", () => {
+    expect(getQueryCacheStats()).toEqual({ capacity: 0, entries: 0, hits: 0, misses: 0 });
+    expect(() => setQueryCacheCapacity(-1)).toThrow();
+  });
+
+  itNative("serves repeated queries until the kernel pool changes", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+      backend.pdpool("BODY399_RADII", [6378.1366, 6378.1366, 6356.7519]);
+
+      const uncached = backend.spkezr("EARTH", 1e8, "J2000", "LT+S", "SUN");
+      setQueryCacheCapacity(64);
+
+      for (let i = 0; i < 3; i++) {
+        expect(backend.spkezr("EARTH", 1e8, "J2000", "LT+S", "SUN")).toEqual(uncached);
+        expect(backend.bodvar(399, "RADII")).toEqual([6378.1366, 6378.1366, 6356.7519]);
+      }
+      expect(getQueryCacheStats()).toMatchObject({ capacity: 64, entries: 2, hits: 4, misses: 2 });
+
+      // Failures are not cached.
+      expect(() => backend.pxform("J2000", "NOT_A_FRAME", 0)).toThrow();
+      expect(getQueryCacheStats().entries).toBe(2);
+
+      // A pool write moves the generation; the stale entry is recomputed.
+      backend.pdpool("BODY399_RADII", [1, 2, 3]);
+      expect(backend.bodvar(399, "RADII")).toEqual([1, 2, 3]);
+      expect(getQueryCacheStats()).toMatchObject({ hits: 4, misses: 4 });
+    } finally {
+      setQueryCacheCapacity(0);
+      backend.kclear();
+    }
+  });
+
+  itNative("recomputes CK frame transformations after cklpf/ckupf", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const cover = backend.newWindow(16);
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh(MGS_SCLK);
+      backend.furnsh({ path: "/kernels/mgs-test.tf", bytes: new TextEncoder().encode(MGS_FK) });
+
+      backend.ckcov(MGS_CK, -94070, false, "INTERVAL", 0, "TDB", cover);
+      const [left, right] = backend.wnfetd(cover, 0);
+      const et = (left + right) / 2;
+
+      setQueryCacheCapacity(64);
+
+      // No CK yet: the query fails, and failures are not cached.
+      expect(() => backend.pxform("J2000", "TSPICE_MGS_HGA", et)).toThrow();
+
+      const handle = backend.cklpf(MGS_CK);
+      const loaded = backend.pxform("J2000", "TSPICE_MGS_HGA", et);
+      expect(backend.pxform("J2000", "TSPICE_MGS_HGA", et)).toEqual(loaded);
+      expect(getQueryCacheStats()).toMatchObject({ entries: 1, hits: 1 });
+
+      // Unloading the CK must not serve the cached rotation.
+      backend.ckupf(handle);
+      expect(() => backend.pxform("J2000", "TSPICE_MGS_HGA", et)).toThrow();
+
+      const reloaded = backend.cklpf(MGS_CK);
+      try {
+        expect(backend.pxform("J2000", "TSPICE_MGS_HGA", et)).toEqual(loaded);
+        expect(getQueryCacheStats().hits).toBe(1);
+      } finally {
+        backend.ckupf(reloaded);
+      }
+    } finally {
+      setQueryCacheCapacity(0);
+      backend.freeWindow(cover);
+      backend.kclear();
+    }
+  });
+});
@@ -0,0 +1,141 @@
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+function expectStateClose(actual: ArrayLike<number>, expected: ArrayLike<number>, rel = 1e-12): void {
+  let scale = 1;
+  for (let k = 0; k < 3; k++) scale = Math.max(scale, Math.abs(expected[k]!));
+  for (let k = 0; k < 6; k++) {
+    expect(Math.abs(actual[k]! - expected[k]!)).toBeLessThanOrEqual(rel * scale);
+  }
+}
+
+describe("@rybosome/tspice-backend-node cached SPK evaluator", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("matches spkgeo for Chebyshev segments and reuses records", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      // One-minute sampling over a day stays inside a handful of records.
+      const ets = new Float64Array(1440).map((_, i) => i * 60);
+      const before = backend.spkEvaluatorStats();
+
+      for (const [target, observer] of [
+        [399, 10],
+        [301, 399],
+        [10, 399],
+        [399, 399],
+      ] as const) {
+        for (const ref of ["J2000", "ECLIPJ2000"]) {
+          const batch = backend.spkgeoCachedBatch(target, ets, ref, observer);
+          for (let i = 0; i < ets.length; i += 97) {
+            const want = backend.spkgeo(target, ets[i]!, ref, observer);
+            expectStateClose(batch.states.subarray(i * 6, i * 6 + 6), want.state);
+            expect(Math.abs(batch.lts[i]! - want.lt)).toBeLessThanOrEqual(1e-12 * Math.max(1, want.lt));
+
+            const one = backend.spkgeoCached(target, ets[i]!, ref, observer);
+            expect(one.state).toEqual(Array.from(batch.states.subarray(i * 6, i * 6 + 6)));
+            expect(one.lt).toBe(batch.lts[i]);
+          }
+        }
+      }
+
+      const after = backend.spkEvaluatorStats();
+      expect(after.segments).toBeGreaterThan(0);
+      expect(after.recordHits - before.recordHits).toBeGreaterThan(after.recordReads - before.recordReads);
+      expect(after.fallbacks).toBe(before.fallbacks);
+
+      expect(backend.spkgeoCachedBatch(399, new Float64Array(0), "J2000", 10).states).toHaveLength(0);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("follows kernel changes and reports CSPICE errors like spkgeo", async () => {
+    const { spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      expect(() => backend.spkgeoCached(399, 0, "J2000", 10)).toThrow();
+
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+      const want = backend.spkgeo(399, 0, "J2000", 10).state;
+      expectStateClose(backend.spkgeoCached(399, 0, "J2000", 10).state, want);
+
+      backend.kclear();
+      expect(() => backend.spkgeoCached(399, 0, "J2000", 10)).toThrow();
+
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+      expectStateClose(backend.spkgeoCached(399, 0, "J2000", 10).state, want);
+
+      let caught: unknown;
+      try {
+        backend.spkgeoCachedBatch(399, new Float64Array([0, 1e12]), "J2000", 10);
+      } catch (err) {
+        caught = err;
+      }
+      expect(caught).toBeInstanceOf(Error);
+      expect((caught as Error).message).toMatch(/ets\[1\]/);
+      expect((caught as { index?: unknown }).index).toBe(1);
+
+      expect(() => backend.spkgeoCached(399, 0, "NOT_A_FRAME", 10)).toThrow();
+      expect(() =>
+        backend.spkgeoCachedBatch(399, [0] as unknown as Float64Array, "J2000", 10),
+      ).toThrow(/Float64Array/);
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("matches spkgeo for Hermite (type 13) segments", () => {
+    const backend = createNodeBackend();
+    const output = { kind: "virtual-output", path: "spk-evaluator-type13.bsp" } as const;
+
+    const n = 200;
+    const w = 1e-3;
+    const epochs = new Float64Array(n);
+    const states = new Float64Array(n * 6);
+    for (let i = 0; i < n; i++) {
+      const t = i * 60 + (i % 4) * 5;
+      epochs[i] = t;
+      states.set(
+        [7000 * Math.cos(w * t), 7000 * Math.sin(w * t), 0.1 * t, -7 * Math.sin(w * t), 7 * Math.cos(w * t), 0.1],
+        i * 6,
+      );
+    }
+
+    try {
+      const handle = backend.spkopn(output, "TSPICE", 0);
+      const stream = backend.spkwStream(handle, {
+        type: 13,
+        body: 1000,
+        center: 399,
+        frame: "J2000",
+        segid: "TSPICE_EVALUATOR_TEST",
+        degree: 7,
+        first: epochs[0]!,
+        last: epochs[n - 1]!,
+      });
+      stream.append(states, epochs);
+      stream.close();
+      backend.spkcls(handle);
+      backend.furnsh({ path: "/kernels/type13.bsp", bytes: backend.readVirtualOutput(output) });
+
+      const sample = new Float64Array(301).map((_, i) => epochs[0]! + (i / 300) * (epochs[n - 1]! - epochs[0]!));
+      const batch = backend.spkgeoCachedBatch(1000, sample, "J2000", 399);
+      for (let i = 0; i < sample.length; i++) {
+        const want = backend.spkgeo(1000, sample[i]!, "J2000", 399).state;
+        expectStateClose(batch.states.subarray(i * 6, i * 6 + 6), want, 1e-10);
+      }
+    } finally {
+      backend.kclear();
+    }
+  });
+});
@@ -1,6 +1,10 @@
+import fs from "node:fs";
+import os from "node:os";
+import path from "node:path";
+
 import { describe, expect, it } from "vitest";
 
-import { createNodeBackend } from "@rybosome/tspice-backend-node";
+import { createNodeBackend, setVirtualOutputStagingDir } from "@rybosome/tspice-backend-node";
 
 import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
 
@@ -77,4 +81,231 @@ describe("SPK writers (type 8)", () => {
       backend.readVirtualOutput({ kind: "virtual-output", path: "missing-output.bsp" }),
     ).toThrow(/no staged file found|virtual output/i);
   });
+
+  itNative("takeVirtualOutput hands over the bytes and removes the staged file", () => {
+    const stagingDir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-take-"));
+    setVirtualOutputStagingDir(stagingDir);
+    try {
+      const backend = createNodeBackend();
+      const output = { kind: "virtual-output", path: "take.bsp" } as const;
+
+      const handle = backend.spkopn(output, "TSPICE", 0);
+      backend.spkw08(handle, 1000, 0, "J2000", 0, 60, "TAKE", 1, [0, 0, 0, 1, 0, 0, 60, 0, 0, 1, 0, 0], 0, 60);
+      backend.spkcls(handle);
+
+      // Staged under the configured directory.
+      expect(fs.readdirSync(stagingDir).some((d) => d.startsWith("tspice-outputs-"))).toBe(true);
+
+      const copy = backend.readVirtualOutput(output);
+      const bytes = backend.takeVirtualOutput(output);
+      expect(Buffer.isBuffer(bytes)).toBe(false);
+      expect(Buffer.from(bytes).equals(Buffer.from(copy))).toBe(true);
+
+      expect(() => backend.readVirtualOutput(output)).toThrow(/no staged file found/i);
+      expect(() => backend.takeVirtualOutput(output)).toThrow(/no staged file found/i);
+
+      // Still valid after the file is gone.
+      backend.furnsh({ path: "/kernels/take.bsp", bytes });
+      const { state } = backend.spkezr("1000", 30, "J2000", "NONE", "0");
+      expect(state[0]).toBeCloseTo(30, 10);
+      backend.kclear();
+    } finally {
+      setVirtualOutputStagingDir(undefined);
+      fs.rmSync(stagingDir, { recursive: true, force: true });
+    }
+  });
+
+  itNative("readVirtualOutput bytes do not change when the staged file is reopened", () => {
+    const backend = createNodeBackend();
+    const output = { kind: "virtual-output", path: "reopen.bsp" } as const;
+
+    let handle = backend.spkopn(output, "TSPICE", 0);
+    backend.spkw08(handle, 1000, 0, "J2000", 0, 60, "FIRST", 1, [0, 0, 0, 1, 0, 0, 60, 0, 0, 1, 0, 0], 0, 60);
+    backend.spkcls(handle);
+
+    const first = backend.readVirtualOutput(output);
+    const snapshot = Buffer.from(first);
+
+    handle = backend.spkopa(output);
+    backend.spkw08(handle, 1001, 0, "J2000", 0, 60, "SECOND", 1, [0, 0, 0, 1, 0, 0, 60, 0, 0, 1, 0, 0], 0, 60);
+    backend.spkcls(handle);
+
+    expect(Buffer.from(first).equals(snapshot)).toBe(true);
+    const second = backend.readVirtualOutput(output);
+    expect(second.byteLength).toBeGreaterThan(first.byteLength);
+    backend.takeVirtualOutput(output);
+  });
+});
+
+describe("SPK streaming writer", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  const stateAt = (t: number): number[] => {
+    const w = 1e-3;
+    return [
+      7000 * Math.cos(w * t),
+      7000 * Math.sin(w * t),
+      0.1 * t,
+      -7000 * w * Math.sin(w * t),
+      7000 * w * Math.cos(w * t),
+      0.1,
+    ];
+  };
+
+  const writeStream = (
+    path: string,
+    type: 9 | 12,
+    chunkStates: number,
+    epochs: Float64Array,
+    states: Float64Array,
+    appendRows: number,
+  ) => {
+    const backend = createNodeBackend();
+    const output = { kind: "virtual-output", path } as const;
+    const handle = backend.spkopn(output, "TSPICE", 0);
+    const n = epochs.length;
+    const stream = backend.spkwStream(handle, {
+      type,
+      body: 1000,
+      center: 399,
+      frame: "J2000",
+      segid: "TSPICE_STREAM_TEST",
+      degree: type === 9 ? 5 : 7,
+      first: epochs[0]!,
+      last: epochs[n - 1]!,
+      ...(type === 12 ? { epoch1: epochs[0]!, step: epochs[1]! - epochs[0]! } : {}),
+      chunkStates,
+    });
+    for (let row = 0; row < n; row += appendRows) {
+      const end = Math.min(n, row + appendRows);
+      stream.append(states.subarray(row * 6, end * 6), type === 9 ? epochs.subarray(row, end) : undefined);
+    }
+    stream.close();
+    expect(() => stream.append(new Float64Array(6))).toThrow(/closed/);
+    backend.spkcls(handle);
+    const bytes = backend.readVirtualOutput(output);
+    backend.kclear();
+    return bytes;
+  };
+
+  for (const type of [9, 12] as const) {
+    itNative(`type ${type}: chunked segments evaluate like a single segment`, () => {
+      const n = 500;
+      const epochs = new Float64Array(n);
+      const states = new Float64Array(n * 6);
+      for (let i = 0; i < n; i++) {
+        epochs[i] = type === 9 ? i * 60 + (i % 3) * 7 : i * 60;
+        states.set(stateAt(epochs[i]!), i * 6);
+      }
+
+      const single = writeStream(`spk-stream-single-${type}.bsp`, type, n, epochs, states, n);
+      const chunked = writeStream(`spk-stream-chunked-${type}.bsp`, type, 40, epochs, states, 17);
+
+      const backend = createNodeBackend();
+      try {
+        const sample = Array.from({ length: 97 }, (_, i) => epochs[0]! + (i / 96) * (epochs[n - 1]! - epochs[0]!));
+
+        backend.furnsh({ path: "/kernels/single.bsp", bytes: single });
+        const expected = sample.map((et) => backend.spkgeo(1000, et, "J2000", 399).state);
+        backend.kclear();
+
+        backend.furnsh({ path: "/kernels/chunked.bsp", bytes: chunked });
+        const actual = sample.map((et) => backend.spkgeo(1000, et, "J2000", 399).state);
+        // Type 12 segments restart their epoch grid at each boundary, so allow rounding-level drift.
+        for (let i = 0; i < sample.length; i++) {
+          for (let k = 0; k < 6; k++) {
+            const want = expected[i]![k]!;
+            expect(Math.abs(actual[i]![k]! - want)).toBeLessThanOrEqual(1e-9 * Math.max(1, Math.abs(want)));
+          }
+        }
+      } finally {
+        backend.kclear();
+      }
+    });
+  }
+
+  itNative("validates chunk size and epochs", () => {
+    const backend = createNodeBackend();
+    const output = { kind: "virtual-output", path: "spk-stream-invalid.bsp" } as const;
+    const handle = backend.spkopn(output, "TSPICE", 0);
+
+    const options = {
+      type: 9,
+      body: 1000,
+      center: 399,
+      frame: "J2000",
+      segid: "TSPICE_STREAM_TEST",
+      degree: 5,
+      first: 0,
+      last: 100,
+    } as const;
+    expect(() => backend.spkwStream(handle, { ...options, chunkStates: 4 })).toThrow(/chunkStates/);
+    expect(() => backend.spkwStream(handle, { ...options, type: 8 })).toThrow(/epoch1 and step/);
+
+    const stream = backend.spkwStream(handle, options);
+    expect(() => stream.append(new Float64Array(6))).toThrow(/epochs/);
+    stream.abort();
+    expect(() => stream.close()).toThrow(/closed/);
+
+    backend.spkcls(handle);
+    backend.kclear();
+  });
+});
+
+describe("SPK subsetting", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("keeps only the requested bodies over the requested window", () => {
+    const backend = createNodeBackend();
+    const dir = fs.mkdtempSync(path.join(os.tmpdir(), "tspice-spk-subset-"));
+    const source = path.join(dir, "source.bsp");
+
+    const n = 2000;
+    const epochs = Float64Array.from({ length: n }, (_, i) => i * 60);
+    const handle = backend.spkopn(source, "TSPICE", 0);
+    for (const body of [1000, 1001]) {
+      const states = new Float64Array(n * 6);
+      for (let i = 0; i < n; i++) {
+        const t = epochs[i]!;
+        const w = 1e-3;
+        states.set([body + Math.cos(w * t), Math.sin(w * t), t, -w * Math.sin(w * t), w * Math.cos(w * t), 1], i * 6);
+      }
+      const stream = backend.spkwStream(handle, {
+        type: 9,
+        body,
+        center: 399,
+        frame: "J2000",
+        segid: `BODY_${body}`,
+        degree: 5,
+        first: epochs[0]!,
+        last: epochs[n - 1]!,
+      });
+      stream.append(states, epochs);
+      stream.close();
+    }
+    backend.spkcls(handle);
+
+    const output = { kind: "virtual-output", path: "spk-subset.bsp" } as const;
+    const segments = backend.spkSubset([source], output, { bodies: [1000], first: 30_000, last: 36_000 });
+    expect(segments).toBe(1);
+    const bytes = backend.readVirtualOutput(output);
+    expect(bytes.byteLength).toBeLessThan(fs.statSync(source).size / 4);
+
+    backend.furnsh(source);
+    const expected = backend.spkezr("1000", 33_333, "J2000", "NONE", "399").state;
+    backend.kclear();
+
+    backend.furnsh({ path: output.path, bytes });
+    const subset = backend.spkezr("1000", 33_333, "J2000", "NONE", "399").state;
+    subset.forEach((v, i) => expect(v).toBeCloseTo(expected[i]!, 9));
+    expect(Array.from(backend.spkcovIntervals(output.path, 1000))).toEqual([30_000, 36_000]);
+    expect(Array.from(backend.spkobjIds(output.path))).toEqual([1000]);
+    backend.kclear();
+
+    expect(() => backend.spkSubset([source], path.join(dir, "empty.bsp"), { bodies: [5], first: 0, last: 10 })).toThrow(
+      /no segment/,
+    );
+    expect(fs.existsSync(path.join(dir, "empty.bsp"))).toBe(false);
+    fs.rmSync(dir, { recursive: true, force: true });
+  });
 });
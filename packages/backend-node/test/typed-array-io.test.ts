@@ -0,0 +1,319 @@
+import { fileURLToPath } from "node:url";
+
+import { describe, expect, it } from "vitest";
+
+import type { SpiceVector3 } from "@rybosome/tspice-backend-contract";
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { loadTestKernels } from "./test-kernels.js";
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+const MGS_DIR = "../../tspice/test/fixtures/kernels/mgs-minimal/";
+const MGS_SCLK = fileURLToPath(new URL(`${MGS_DIR}mgs_sclkscet_00061.tsc`, import.meta.url));
+const MGS_CK = fileURLToPath(new URL(`${MGS_DIR}mgs_hga_hinge_v2.bc`, import.meta.url));
+const MGS_HGA = -94070;
+
+// The fixture CK gives the HGA relative to -94000, which the pack ships no FK for.
+const MGS_SPACECRAFT_FK = `\\begindata
+FRAME_MGS_SPACECRAFT = -94000
+FRAME_-94000_NAME = 'MGS_SPACECRAFT'
+FRAME_-94000_CLASS = 4
+FRAME_-94000_CLASS_ID = -94000
+FRAME_-94000_CENTER = -94
+TKFRAME_-94000_RELATIVE = 'J2000'
+TKFRAME_-94000_SPEC = 'ANGLES'
+TKFRAME_-94000_UNITS = 'DEGREES'
+TKFRAME_-94000_AXES = ( 3, 2, 1 )
+TKFRAME_-94000_ANGLES = ( 10, 20, 30 )
+\\begintext
+`;
+
+describe("@rybosome/tspice-backend-node typed-array I/O", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("vector/matrix *Into helpers match the boxed variants", () => {
+    const backend = createNodeBackend();
+
+    const a = new Float64Array([1, 2, 3]);
+    const b = new Float64Array([-4, 0.5, 7]);
+    const m = backend.rotate(0.3, 3);
+    const out3 = new Float64Array(3);
+    const out9 = new Float64Array(9);
+
+    backend.vcrssInto(a, b, out3);
+    expect(Array.from(out3)).toEqual(backend.vcrss([1, 2, 3], [-4, 0.5, 7]));
+
+    backend.vaddInto(a, b, out3);
+    expect(Array.from(out3)).toEqual(backend.vadd([1, 2, 3], [-4, 0.5, 7]));
+
+    backend.vsubInto(a, b, out3);
+    expect(Array.from(out3)).toEqual(backend.vsub([1, 2, 3], [-4, 0.5, 7]));
+
+    backend.mxvInto(m, a, out3);
+    expect(Array.from(out3)).toEqual(backend.mxv(m, [1, 2, 3]));
+
+    backend.mtxvInto(m, a, out3);
+    expect(Array.from(out3)).toEqual(backend.mtxv(m, [1, 2, 3]));
+
+    backend.mxmInto(m, m, out9);
+    expect(Array.from(out9)).toEqual(backend.mxm(m, m));
+
+    // Typed-array inputs are accepted by the boxed entrypoints too.
+    const vdotTyped = backend.vdot(a as unknown as SpiceVector3, b as unknown as SpiceVector3);
+    expect(vdotTyped).toBe(backend.vdot([1, 2, 3], [-4, 0.5, 7]));
+
+    // Outputs may alias inputs, and `subarray()` targets an offset in a larger buffer.
+    const buf = new Float64Array([0, 1, 2, 3, 0]);
+    const view = buf.subarray(1, 4);
+    backend.vaddInto(view, view, view);
+    expect(Array.from(buf)).toEqual([0, 2, 4, 6, 0]);
+  });
+
+  itNative("spkezrInto/spkposInto/pxformInto match the boxed variants", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const et = 86_400;
+
+      const state = new Float64Array(6);
+      const lt = backend.spkezrInto("EARTH", et, "J2000", "LT+S", "SUN", state);
+      const boxed = backend.spkezr("EARTH", et, "J2000", "LT+S", "SUN");
+      expect(Array.from(state)).toEqual(boxed.state);
+      expect(lt).toBe(boxed.lt);
+
+      const pos = new Float64Array(3);
+      const posLt = backend.spkposInto("EARTH", et, "J2000", "LT+S", "SUN", pos);
+      const boxedPos = backend.spkpos("EARTH", et, "J2000", "LT+S", "SUN");
+      expect(Array.from(pos)).toEqual(boxedPos.pos);
+      expect(posLt).toBe(boxedPos.lt);
+
+      const m = new Float64Array(9);
+      backend.pxformInto("J2000", "ECLIPJ2000", et, m);
+      expect(Array.from(m)).toEqual(Array.from(backend.pxform("J2000", "ECLIPJ2000", et)));
+
+      const s = new Float64Array(36);
+      backend.sxformInto("J2000", "ECLIPJ2000", et, s);
+      expect(Array.from(s)).toEqual(backend.sxform("J2000", "ECLIPJ2000", et));
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("*IntoStatus report failures as a status instead of throwing", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const et = 86_400;
+      const state = new Float64Array(7);
+      expect(backend.spkezrIntoStatus("EARTH", et, "J2000", "LT+S", "SUN", state)).toBe("ok");
+      const boxed = backend.spkezr("EARTH", et, "J2000", "LT+S", "SUN");
+      expect(Array.from(state.subarray(0, 6))).toEqual(boxed.state);
+      expect(state[6]).toBe(boxed.lt);
+
+      const m = new Float64Array(9);
+      expect(backend.pxformIntoStatus("J2000", "ECLIPJ2000", et, m)).toBe("ok");
+      expect(Array.from(m)).toEqual(Array.from(backend.pxform("J2000", "ECLIPJ2000", et)));
+
+      // Far outside the test SPK's coverage.
+      const pos = new Float64Array(4);
+      expect(backend.spkposIntoStatus("EARTH", 1e12, "J2000", "NONE", "SUN", pos)).toBe("coverage-gap");
+      expect(backend.lastSpiceError()).toMatchObject({ status: "coverage-gap", short: "SPICE(SPKINSUFFDATA)" });
+
+      expect(backend.pxformIntoStatus("J2000", "NOT_A_FRAME", et, m)).toBe("error");
+      expect(backend.lastSpiceError()?.status).toBe("error");
+      expect(backend.failed()).toBe(false);
+
+      expect(() => backend.spkezrIntoStatus("EARTH", et, "J2000", "NONE", "SUN", new Float64Array(6))).toThrow(
+        /length-7/,
+      );
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("coordinate *Batch conversions match the scalar variants row by row", () => {
+    const backend = createNodeBackend();
+
+    const rect = new Float64Array([1, 2, 3, -4, 0.5, 7, 6378.1, -12, 0.25, 0, 0, -1]);
+    const n = rect.length / 3;
+    const row = (a: Float64Array, i: number): SpiceVector3 => [a[3 * i]!, a[3 * i + 1]!, a[3 * i + 2]!];
+
+    const lat = backend.reclatBatch(rect);
+    const sph = backend.recsphBatch(rect);
+    const re = 6378.137;
+    const f = 1 / 298.257223563;
+    const geo = backend.recgeoBatch(rect, re, f);
+
+    for (let i = 0; i < n; i++) {
+      const r = backend.reclat(row(rect, i));
+      expect(row(lat, i)).toEqual([r.radius, r.lon, r.lat]);
+      expect(row(backend.latrecBatch(lat), i)).toEqual(backend.latrec(r.radius, r.lon, r.lat));
+
+      const s = backend.recsph(row(rect, i));
+      expect(row(sph, i)).toEqual([s.radius, s.colat, s.lon]);
+      expect(row(backend.sphrecBatch(sph), i)).toEqual(backend.sphrec(s.radius, s.colat, s.lon));
+
+      const g = backend.recgeo(row(rect, i), re, f);
+      expect(row(geo, i)).toEqual([g.lon, g.lat, g.alt]);
+      expect(row(backend.georecBatch(geo, re, f), i)).toEqual(backend.georec(g.lon, g.lat, g.alt, re, f));
+    }
+
+    // `out` may alias the input.
+    const inPlace = rect.slice();
+    expect(backend.reclatBatch(inPlace, inPlace)).toBe(inPlace);
+    expect(Array.from(inPlace)).toEqual(Array.from(lat));
+
+    expect(backend.reclatBatch(new Float64Array(0)).length).toBe(0);
+    expect(() => backend.reclatBatch(new Float64Array(4))).toThrow(/multiple of 3/);
+    expect(() => backend.reclatBatch(rect, new Float64Array(3))).toThrow(/length 12/);
+  });
+
+  itNative("transformVectors/transformStates match pxform+mxv and sxform per epoch", async () => {
+    const { lsk, spk } = await loadTestKernels();
+    const backend = createNodeBackend();
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh({ path: "/kernels/de405s.bsp", bytes: spk });
+
+      const ets = new Float64Array([0, 86_400, 1e8]);
+      // Two vectors per epoch, grouped epoch-major.
+      const vecs = new Float64Array([1, 0, 0, 0, 1, 0, 1, 2, 3, -4, 0.5, 7, 0, 0, 1, 3, -2, 1]);
+      const out = backend.transformVectors("J2000", "ECLIPJ2000", ets, vecs);
+      expect(out).not.toBe(vecs);
+
+      for (let i = 0; i < ets.length; i++) {
+        const m = backend.pxform("J2000", "ECLIPJ2000", ets[i]!);
+        for (let j = 0; j < 2; j++) {
+          const row = 2 * i + j;
+          const v: SpiceVector3 = [vecs[3 * row]!, vecs[3 * row + 1]!, vecs[3 * row + 2]!];
+          expect(Array.from(out.subarray(3 * row, 3 * row + 3))).toEqual(backend.mxv(m, v));
+        }
+      }
+
+      // A single epoch applies to every row, and `out` may alias `vecs`.
+      const inPlace = vecs.slice();
+      expect(backend.transformVectors("J2000", "J2000", new Float64Array([0]), inPlace, inPlace)).toBe(inPlace);
+      expect(Array.from(inPlace)).toEqual(Array.from(vecs));
+
+      const states = new Float64Array([1, 2, 3, 0.1, 0.2, 0.3, -4, 0.5, 7, 0, 0, 1]);
+      const stateEts = new Float64Array([0, 86_400]);
+      const outStates = backend.transformStates("J2000", "ECLIPJ2000", stateEts, states);
+      for (let i = 0; i < stateEts.length; i++) {
+        const s = backend.sxform("J2000", "ECLIPJ2000", stateEts[i]!);
+        for (let r = 0; r < 6; r++) {
+          let acc = s[r * 6]! * states[6 * i]!;
+          for (let c = 1; c < 6; c++) acc += s[r * 6 + c]! * states[6 * i + c]!;
+          expect(outStates[6 * i + r]).toBe(acc);
+        }
+      }
+
+      expect(() => backend.transformVectors("J2000", "ECLIPJ2000", ets, new Float64Array(6))).toThrow(
+        /multiple of ets.length/,
+      );
+      expect(() =>
+        backend.transformVectors("J2000", "NOT_A_FRAME", ets, vecs),
+      ).toThrow();
+    } finally {
+      backend.kclear();
+    }
+  });
+
+  itNative("ckgpBatch/ckgpavBatch return packed, correctly-sized outputs", () => {
+    const backend = createNodeBackend();
+
+    const empty = backend.ckgpavBatch(-77001, new Float64Array(0), 0, "J2000");
+    expect(empty.cmats.length).toBe(0);
+    expect(empty.avs.length).toBe(0);
+    expect(empty.clkouts.length).toBe(0);
+    expect(empty.found.length).toBe(0);
+
+    expect(() =>
+      backend.ckgpBatch(-77001, [0] as unknown as Float64Array, 0, "J2000"),
+    ).toThrow(/Float64Array/);
+  });
+
+  itNative("ckgpBatch/ckgpavBatch match ckgp/ckgpav row by row", async () => {
+    const { lsk } = await loadTestKernels();
+    const backend = createNodeBackend();
+    const cover = backend.newWindow(64);
+
+    try {
+      backend.furnsh({ path: "/kernels/naif0012.tls", bytes: lsk });
+      backend.furnsh(MGS_SCLK);
+      backend.furnsh({ path: "/kernels/mgs-spacecraft.tf", bytes: new TextEncoder().encode(MGS_SPACECRAFT_FK) });
+      backend.furnsh(MGS_CK);
+
+      // Ticks across the first coverage intervals, plus ticks before the first one and in the gaps
+      // between them, which have no pointing.
+      backend.ckcov(MGS_CK, MGS_HGA, true, "INTERVAL", 0, "SCLK", cover);
+      const nIntervals = Math.min(backend.wncard(cover), 4);
+      expect(nIntervals).toBeGreaterThan(0);
+      const ticks: number[] = [];
+      for (let w = 0; w < nIntervals; w++) {
+        const [left, right] = backend.wnfetd(cover, w);
+        ticks.push(left - 1000);
+        for (let k = 0; k <= 8; k++) ticks.push(left + ((right - left) * k) / 8);
+      }
+      const sclkdp = new Float64Array(ticks);
+      const n = sclkdp.length;
+
+      for (const tol of [0, 500]) {
+        const batch = backend.ckgpBatch(MGS_HGA, sclkdp, tol, "MGS_SPACECRAFT");
+        const batchAv = backend.ckgpavBatch(MGS_HGA, sclkdp, tol, "MGS_SPACECRAFT");
+        let found = 0;
+        let missing = 0;
+        for (let i = 0; i < n; i++) {
+          const bit = (batch.found[i >> 3]! >> (i & 7)) & 1;
+          const bitAv = (batchAv.found[i >> 3]! >> (i & 7)) & 1;
+
+          const one = backend.ckgp(MGS_HGA, sclkdp[i]!, tol, "MGS_SPACECRAFT");
+          expect(bit).toBe(one.found ? 1 : 0);
+          if (one.found) {
+            found++;
+            expect(Array.from(batch.cmats.subarray(i * 9, i * 9 + 9))).toEqual(Array.from(one.cmat));
+            expect(batch.clkouts[i]).toBe(one.clkout);
+          } else {
+            missing++;
+            expect(Array.from(batch.cmats.subarray(i * 9, i * 9 + 9))).toEqual(new Array(9).fill(0));
+            expect(batch.clkouts[i]).toBe(0);
+          }
+
+          const oneAv = backend.ckgpav(MGS_HGA, sclkdp[i]!, tol, "MGS_SPACECRAFT");
+          expect(bitAv).toBe(oneAv.found ? 1 : 0);
+          if (oneAv.found) {
+            expect(Array.from(batchAv.cmats.subarray(i * 9, i * 9 + 9))).toEqual(Array.from(oneAv.cmat));
+            expect(Array.from(batchAv.avs.subarray(i * 3, i * 3 + 3))).toEqual(Array.from(oneAv.av));
+            expect(batchAv.clkouts[i]).toBe(oneAv.clkout);
+          } else {
+            expect(Array.from(batchAv.avs.subarray(i * 3, i * 3 + 3))).toEqual([0, 0, 0]);
+          }
+        }
+        // Padding bits past `n` stay clear.
+        if (n % 8 !== 0) expect(batch.found[n >> 3]! >> (n % 8)).toBe(0);
+        expect(found).toBeGreaterThan(0);
+        if (tol === 0) expect(missing).toBeGreaterThan(0);
+      }
+    } finally {
+      backend.freeWindow(cover);
+      backend.kclear();
+    }
+  });
+
+  itNative("*Into rejects wrongly-sized or non-Float64Array outputs", () => {
+    const backend = createNodeBackend();
+
+    expect(() => backend.vaddInto([1, 2, 3], [1, 2, 3], new Float64Array(2))).toThrow(/length-3/);
+    expect(() =>
+      backend.vaddInto([1, 2, 3], [1, 2, 3], [0, 0, 0] as unknown as Float64Array),
+    ).toThrow(/Float64Array/);
+  });
+});
@@ -0,0 +1,51 @@
+import path from "node:path";
+import { fileURLToPath } from "node:url";
+import { Worker } from "node:worker_threads";
+
+import { describe, expect, it } from "vitest";
+
+import { createNodeBackend } from "@rybosome/tspice-backend-node";
+
+import { nodeAddonAvailable } from "./_helpers/nodeAddonAvailable.js";
+
+function addonPath(): string {
+  const packageRoot = path.resolve(path.dirname(fileURLToPath(import.meta.url)), "..");
+  const override = process.env.TSPICE_BACKEND_NODE_BINDING_PATH;
+  return override
+    ? path.resolve(packageRoot, override)
+    : path.join(packageRoot, "native", "build", "Release", "tspice_backend_node.node");
+}
+
+// Loads the addon in a fresh worker, creates an int cell holding `values`, and reports its handle
+// and cardinality as seen from inside the worker.
+function cellInWorker(values: number[]): Promise<{ handle: number; card: number }> {
+  const source = `
+    const { parentPort, workerData } = require("node:worker_threads");
+    const addon = require(workerData.addon);
+    const cell = addon.newIntCell(16);
+    for (const v of workerData.values) addon.insrti(v, cell);
+    parentPort.postMessage({ handle: cell, card: addon.card(cell) });
+  `;
+  return new Promise((resolve, reject) => {
+    const worker = new Worker(source, { eval: true, workerData: { addon: addonPath(), values } });
+    worker.once("message", (msg) => {
+      resolve(msg);
+      void worker.terminate();
+    });
+    worker.once("error", reject);
+  });
+}
+
+describe("@rybosome/tspice-backend-node worker_threads", () => {
+  const itNative = it.runIf(nodeAddonAvailable());
+
+  itNative("gives each worker its own cell handle table", async () => {
+    const [a, b] = await Promise.all([cellInWorker([1, 2, 3]), cellInWorker([4, 5])]);
+    expect(a.card).toBe(3);
+    expect(b.card).toBe(2);
+
+    // No cells were created on this thread, so a worker's handle means nothing here.
+    const local = createNodeBackend();
+    expect(() => local.card(a.handle as never)).toThrow(/unknown\/expired/);
+  });
+});
@@ -1,12 +1,16 @@
 #ifndef TSPICE_BACKEND_SHIM_H
 #define TSPICE_BACKEND_SHIM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 
 // NAIF documents frame names as up to 32 chars + NUL.
 #define TSPICE_FRNAME_MAX_BYTES 33
 
+// Body names are up to 36 chars (`MAXL` in zzbodtrn.inc) + NUL.
+#define TSPICE_BODY_NAME_MAX_BYTES 37
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -20,9 +24,32 @@ void tspice_init_cspice_error_handling_once(void);
 // Writes the current CSPICE error message (if any) into `err` (up to
 // `errMaxBytes`, including a trailing NUL), then calls `reset_c()`.
 //
+// With `err == NULL` (or `errMaxBytes <= 0`) only the structured last-error
+// fields are captured and nothing is formatted: shim functions called that way
+// take the cheap failure path, and callers classify the failure with
+// tspice_last_error_class() and read the message parts only if they need them.
+//
 // Returns 0.
 int tspice_get_spice_error_message_and_reset(char *err, int errMaxBytes);
 
+// Failure classes reported by tspice_last_error_class().
+#define TSPICE_ERROR_NONE 0
+// No data for the requested epoch (e.g. SPICE(SPKINSUFFDATA), SPICE(NOFRAMECONNECT)).
+#define TSPICE_ERROR_COVERAGE_GAP 1
+#define TSPICE_ERROR_OTHER 2
+
+// Classifies the most recently captured error by its short message. Returns
+// TSPICE_ERROR_NONE when no CSPICE error is captured (including after
+// tspice_clear_last_error_buffers() / tspice_reset()).
+int tspice_last_error_class(void);
+
+// Formats the most recently captured error parts into `out` exactly as
+// tspice_get_spice_error_message_and_reset() does, for callers that took the
+// cheap (null `err`) path and then decide they need the message after all.
+//
+// Returns 0.
+int tspice_format_last_error(char *out, int outMaxBytes);
+
 // Retrieve the most recent error message parts captured by
 // tspice_get_spice_error_message_and_reset(). These do not modify CSPICE error
 // status.
@@ -37,6 +64,29 @@ int tspice_get_last_error_trace(char *out, int outMaxBytes);
 // stale `spiceShort`/`spiceLong`/`spiceTrace` fields.
 void tspice_clear_last_error_buffers(void);
 
+// --- Cooperative interruption ---
+//
+// Long calls poll an optional interrupt hook and stop early when it returns
+// non-zero: tspice_gfsep / tspice_gfdist through gfevnt_c's interrupt (bail)
+// hook, tspice_spkezr_batch / tspice_spkpos_batch between epochs. An
+// interrupted call returns TSPICE_INTERRUPTED with CSPICE error status clear;
+// its outputs are unspecified.
+//
+// The hook is process-global, like CSPICE itself: install it, make the call and
+// uninstall it (NULL) while holding the same lock. It runs on the calling thread
+// and must not call CSPICE.
+#define TSPICE_INTERRUPTED 2
+
+typedef int (*tspice_interrupt_hook)(void *ctx);
+
+void tspice_set_interrupt_hook(tspice_interrupt_hook hook, void *ctx);
+
+// Non-zero while a hook is installed.
+int tspice_interrupt_hook_installed(void);
+
+// Polls the installed hook. Returns 0 when no hook is installed.
+int tspice_interrupt_requested(void);
+
 // --- CSPICE error/status utilities ---
 int tspice_failed(int *outFailed, char *err, int errMaxBytes);
 int tspice_reset(char *err, int errMaxBytes);
@@ -54,6 +104,38 @@ int tspice_unload(const char *path, char *err, int errMaxBytes);
 
 int tspice_kclear(char *err, int errMaxBytes);
 
+// --- In-memory kernel buffers ---
+//
+// Loads a kernel straight from memory instead of staging it as a file on disk.
+//
+// On Linux the bytes are copied into an anonymous `memfd_create` file and
+// furnsh'ed through `/proc/self/fd/<fd>`; the path CSPICE knows the kernel by is
+// written to `outPath`. The descriptor stays open until
+// tspice_release_kernel_buffer(outPath) is called, which callers must do after
+// unloading the kernel (or after kclear).
+//
+// `name` is only used as the memfd's debug label.
+//
+// Returns 1 with a descriptive `err` on platforms where this isn't available;
+// check tspice_kernel_buffers_supported() first.
+int tspice_kernel_buffers_supported(void);
+
+int tspice_furnsh_buffer(
+    const char *name,
+    const unsigned char *bytes,
+    size_t byteLength,
+    char *outPath,
+    int outPathMaxBytes,
+    char *err,
+    int errMaxBytes);
+
+// Closes the descriptor backing a path returned by tspice_furnsh_buffer() and
+// stores the size of the kernel it held in `*outByteLength` (may be NULL).
+// Does not unload the kernel. Paths that tspice_furnsh_buffer() did not return
+// (or that were already released) are ignored and yield 0. Like
+// tspice_furnsh_buffer(), requires the CSPICE lock.
+int tspice_release_kernel_buffer(const char *path, size_t *outByteLength, char *err, int errMaxBytes);
+
 int tspice_ktotal(const char *kind, int *outCount, char *err, int errMaxBytes);
 
 int tspice_kdata(
@@ -126,6 +208,66 @@ int tspice_dafbfs(int handle, char *err, int errMaxBytes);
 // with the DLA APIs.
 int tspice_daffna(int handle, int *outFound, char *err, int errMaxBytes);
 
+// Selects the DAF via `dafcs_c(handle)`, reads the summary found by the last
+// `daffna_c` (`dafgs_c`), and unpacks it (`dafus_c`) into `nd` doubles and
+// `ni` integers. SPK and CK files use `nd = 2`, `ni = 6`.
+int tspice_dafgsu(
+    int handle,
+    int nd,
+    int ni,
+    double *outDc,
+    int *outIc,
+    char *err,
+    int errMaxBytes);
+
+// `dafhsf_c`: summary format (`nd` doubles, `ni` integers) of an open DAF.
+int tspice_dafhsf(int handle, int *outNd, int *outNi, char *err, int errMaxBytes);
+
+// Selects the DAF via `dafcs_c(handle)` and reads the name of the array found
+// by the last `daffna_c` (`dafgn_c`). Names hold at most 1000 characters.
+int tspice_dafgn(int handle, char *outName, int outNameMaxBytes, char *err, int errMaxBytes);
+
+// Reads DAF double-precision words `baddr..eaddr` (1-based, inclusive) into
+// `outData` (see `dafgda_c`). `outLen` must be >= eaddr - baddr + 1.
+int tspice_dafgda(
+    int handle,
+    int baddr,
+    int eaddr,
+    double *outData,
+    int outLen,
+    char *err,
+    int errMaxBytes);
+
+// Optional mmap read path for tspice_dafgda() (off by default).
+//
+// When enabled, DAFs opened through tspice_dafopr() in the host's native
+// binary format are mapped read-only on first read. Disabling unmaps them.
+// On platforms without mmap (WASM) this is a no-op and reads always go through
+// `dafgda_c`.
+int tspice_daf_mmap_supported(void);
+int tspice_daf_mmap_enabled(void);
+void tspice_daf_mmap_set_enabled(int enabled);
+
+// Maps a finished output file (one its writer has closed) privately into
+// memory, so its bytes can be handed out without reading them into a second
+// buffer. The mapping is copy-on-write (writes through it never reach the
+// file) and stays valid if the file is removed afterwards, but it is not a
+// snapshot: later writes to the file show through pages not yet copied, and
+// truncating the file makes reads past the new end fault (SIGBUS). Only map
+// files that nothing will write again, e.g. ones removed right after mapping.
+// Empty files yield `*outBase == NULL`, `*outLength == 0`.
+//
+// Release with tspice_unmap_output_file(). Returns 1 with a descriptive `err`
+// where mmap is unavailable; check tspice_output_map_supported() first.
+int tspice_output_map_supported(void);
+int tspice_map_output_file(
+    const char *path,
+    void **outBase,
+    size_t *outLength,
+    char *err,
+    int errMaxBytes);
+void tspice_unmap_output_file(void *base, size_t length);
+
 // --- DAS -------------------------------------------------------------------
 
 int tspice_dasopr(const char *path, int *outHandle, char *err, int errMaxBytes);
@@ -224,6 +366,26 @@ int tspice_ekgi(
     char *err,
     int errMaxBytes);
 
+// Parse a query's SELECT clause. `outTypes[i]` is a `SpiceEKDataType`
+// (0=CHR, 1=DP, 2=INT, 3=TIME); `outTabs` / `outCols` are `maxCols` rows of
+// `nameMaxBytes` each. A parse error is reported via `outError` / `outErrmsg`.
+int tspice_ekpsel(
+    const char *query,
+    int maxCols,
+    int nameMaxBytes,
+    int outErrmsgMaxBytes,
+    int *outN,
+    int *outTypes,
+    char *outTabs,
+    char *outCols,
+    int *outError,
+    char *outErrmsg,
+    char *err,
+    int errMaxBytes);
+
+// Number of elements in entry (`selidx`, `row`) of the last `ekfind` result.
+int tspice_eknelt(int selidx, int row, int *outN, char *err, int errMaxBytes);
+
 // --- EK fast write ---------------------------------------------------------
 
 int tspice_ekifld(
@@ -339,6 +501,37 @@ int tspice_dskw02(
     char *err,
     int errMaxBytes);
 
+// Fused `dskmi2_c` + `dskw02_c`: builds the type 2 spatial index and writes
+// the segment without handing the index back to the caller.
+//
+// `bounds8` is `[mncor1, mxcor1, mncor2, mxcor2, mncor3, mxcor3, first, last]`.
+// `work` (2 * worksz ints) and `spaixi` (spxisz ints) are caller-owned scratch
+// so repeated writes can reuse them; their contents on return are unspecified.
+int tspice_dsk_write_type2(
+    int handle,
+    int center,
+    int surfid,
+    int dclass,
+    const char *frame,
+    int corsys,
+    const double *corpar,
+    const double *bounds8,
+    int nv,
+    const double *vrtces,
+    int np,
+    const int32_t *plates,
+    double finscl,
+    int corscl,
+    int worksz,
+    int voxpsz,
+    int voxlsz,
+    int makvtl,
+    int spxisz,
+    int32_t *work,
+    int32_t *spaixi,
+    char *err,
+    int errMaxBytes);
+
 int tspice_dskobj(const char *dsk, uintptr_t bodidsCellHandle, char *err, int errMaxBytes);
 
 int tspice_dsksrf(
@@ -374,6 +567,43 @@ int tspice_dskb02(
     char *err,
     int errMaxBytes);
 
+// Read `room` vertices (3 doubles each) / plates (3 one-based vertex indices
+// each) of a type 2 DSK segment, starting at the one-based index `start`.
+// `*outN` is the number actually returned.
+int tspice_dskv02(
+    int handle,
+    const int32_t *dladscInts8,
+    int start,
+    int room,
+    int *outN,
+    double *outVrtces,
+    char *err,
+    int errMaxBytes);
+
+int tspice_dskp02(
+    int handle,
+    const int32_t *dladscInts8,
+    int start,
+    int room,
+    int *outN,
+    int32_t *outPlates,
+    char *err,
+    int errMaxBytes);
+
+// Nearest intercept of the ray `vertex + t * raydir` (t >= 0) with the plates
+// of a type 2 DSK segment (dskx02_c). `*outFound` is 0 on a miss, leaving
+// `*outPlid` 0 and `outXpt3` zeroed.
+int tspice_dskx02(
+    int handle,
+    const int32_t *dladscInts8,
+    const double *vertex3,
+    const double *raydir3,
+    int32_t *outPlid,
+    double *outXpt3,
+    int32_t *outFound,
+    char *err,
+    int errMaxBytes);
+
 // --- Kernel pool -----------------------------------------------------------
 
 int tspice_gdpool(
@@ -569,6 +799,22 @@ int tspice_bods2c(
     char *err,
     int errMaxBytes);
 
+// Built-in body name/code pairs (the table compiled into CSPICE), via the
+// private `zzbodget_`.
+//
+// Names are written fixed-width, `nameMaxBytes` per entry (at least
+// `TSPICE_BODY_NAME_MAX_BYTES`), NUL-terminated and without trailing blanks.
+// `room` must cover the whole table (a few hundred entries); CSPICE signals an
+// error otherwise.
+int tspice_body_builtin_names(
+    int room,
+    int *outCodes,
+    char *outNames,
+    int nameMaxBytes,
+    int *outCount,
+    char *err,
+    int errMaxBytes);
+
 // boddef_c: define a body name/code mapping (side effect).
 int tspice_boddef(
     const char *name,
@@ -618,6 +864,22 @@ int tspice_frmnam(
     char *err,
     int errMaxBytes);
 
+// Every named frame CSPICE knows: built-in frames (`bltfrm_c`) and frames
+// defined in the kernel pool (`kplfrm_c`), in ascending ID order, with the
+// names `frmnam_c` reports for them.
+//
+// Writes up to `room` entries (names fixed-width, `nameMaxBytes` per entry, at
+// least `TSPICE_FRNAME_MAX_BYTES`). `*outTotal` is the number of frames
+// available, so callers can retry with a larger `room` when it exceeds `room`.
+int tspice_frame_table(
+    int room,
+    int *outCodes,
+    char *outNames,
+    int nameMaxBytes,
+    int *outTotal,
+    char *err,
+    int errMaxBytes);
+
 // cidfrm_c: frame info from body id.
 int tspice_cidfrm(
     int center,
@@ -687,6 +949,34 @@ int tspice_sxform(
     char *err,
     int errMaxBytes);
 
+// Batched pxform_c over `n` epochs for a single frame pair.
+//
+// `outMatrices9n` receives `9*n` doubles (one row-major matrix per epoch,
+// epoch-major). Stops at the first CSPICE failure; if `outFailedIndex` is
+// non-NULL it is set to the failing epoch index (or -1 on success / argument
+// validation errors).
+int tspice_pxform_batch(
+    const char *from,
+    const char *to,
+    const double *ets,
+    int n,
+    double *outMatrices9n,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
+// Batched sxform_c over `n` epochs. Same conventions as tspice_pxform_batch,
+// but `outMatrices36n` receives `36*n` doubles.
+int tspice_sxform_batch(
+    const char *from,
+    const char *to,
+    const double *ets,
+    int n,
+    double *outMatrices36n,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
 // spkezr_c: compute state (6 doubles) and light time.
 int tspice_spkezr(
     const char *target,
@@ -711,6 +1001,49 @@ int tspice_spkpos(
     char *err,
     int errMaxBytes);
 
+// Batched spkezr_c over `n` epochs for a single target/observer pair.
+//
+// `outStates6n` receives `6*n` doubles (one state per epoch, epoch-major) and
+// `outLts` (optional, may be NULL) receives `n` light times. Both buffers are
+// caller-owned.
+//
+// Stops at the first CSPICE failure; if `outFailedIndex` is non-NULL it is set
+// to the failing epoch index (or -1 on success / argument validation errors).
+// Outputs for rows before the failing index are valid.
+//
+// Light-time corrections (`LT`, `CN`, `XLT`, `XCN`, optionally `+S`) in
+// inertial frames run as two passes over the batch: observer SSB states (and
+// accelerations for stellar aberration) for every epoch, then `spkaps_c`
+// against them, with names, frame and `abcorr` resolved once. Any failure
+// reruns the per-epoch path, so errors are reported as `spkezr_c` would.
+int tspice_spkezr_batch(
+    const char *target,
+    const double *ets,
+    int n,
+    const char *ref,
+    const char *abcorr,
+    const char *observer,
+    double *outStates6n,
+    double *outLts,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
+// Batched spkpos_c over `n` epochs. Same conventions as tspice_spkezr_batch,
+// with `outPos3n` receiving `3*n` doubles.
+int tspice_spkpos_batch(
+    const char *target,
+    const double *ets,
+    int n,
+    const char *ref,
+    const char *abcorr,
+    const char *observer,
+    double *outPos3n,
+    double *outLts,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
 // spkez_c: compute state (6 doubles) and light time (numeric IDs).
 int tspice_spkez(
     int target,
@@ -941,6 +1274,76 @@ int tspice_spkw08_v2(
     char *err,
     int errMaxBytes);
 
+// spkw09_c: write a type 9 segment (unequal time steps, Lagrange interpolation).
+//
+// `states6n` is a flat array of `n*6` doubles; `epochs` holds the `n` strictly
+// increasing epochs of the states.
+int tspice_spkw09(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    const double *epochs,
+    char *err,
+    int errMaxBytes);
+
+// spkw12_c: write a type 12 segment (equal time steps, Hermite interpolation).
+int tspice_spkw12(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    double epoch1,
+    double step,
+    char *err,
+    int errMaxBytes);
+
+// spkw13_c: write a type 13 segment (unequal time steps, Hermite interpolation).
+int tspice_spkw13(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    const double *epochs,
+    char *err,
+    int errMaxBytes);
+
+// spksub_c: copy the part of one segment of the SPK open as `handle` that
+// covers `[begin, end]` into the SPK open for write as `newHandle`, as a new
+// segment named `ident`.
+//
+// The segment is given by its summary as unpacked by tspice_dafgsu() with
+// `nd = 2`, `ni = 6` (`dc2`, `ic6`); it is repacked with `dafps_c` first.
+// `[begin, end]` must lie within the segment's coverage.
+int tspice_spksub(
+    int handle,
+    const double *dc2,
+    const int *ic6,
+    const char *ident,
+    double begin,
+    double end,
+    int newHandle,
+    char *err,
+    int errMaxBytes);
+
 // --- Derived geometry primitives ---
 
 // subpnt_c: compute the sub-observer point on a target body's surface.
@@ -1005,6 +1408,78 @@ int tspice_ilumin(
     char *err,
     int errMaxBytes);
 
+// Batched sincpt_c: intersect `n` rays (`dirs3n`, 3 doubles each, in `dref`)
+// from one observer at one epoch.
+//
+// Outputs are caller-owned: `outSpoints3n` / `outSrfvecs3n` (3*n doubles),
+// `outTrgepcs` (n doubles) and `outFoundBits` (ceil(n/8) bytes; bit `i % 8` of
+// byte `i / 8` is set when ray `i` hit). Rows for missed rays are zero.
+//
+// For `ELLIPSOID` with `NONE`, the observer position, frame rotation and radii
+// are looked up once and each ray is a single `surfpt_c`; everything else (or
+// any failure on that path) runs `sincpt_c` per ray. Stops at the first CSPICE
+// failure with `outFailedIndex` set as in tspice_spkezr_batch.
+int tspice_sincpt_batch(
+    const char *method,
+    const char *target,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const char *dref,
+    const double *dirs3n,
+    int n,
+    double *outSpoints3n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
+// Batched ilumin_c / illumf_c over `n` surface points (`spoints3n`, body-fixed)
+// at one epoch. Each output holds one entry per point (`outSrfvecs3n` 3*n
+// doubles); `outVisibl` / `outLit` receive 0/1 bytes. Same failure conventions
+// as tspice_sincpt_batch.
+int tspice_ilumin_batch(
+    const char *method,
+    const char *target,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const double *spoints3n,
+    int n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    double *outPhases,
+    double *outIncdncs,
+    double *outEmissns,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
+int tspice_illumf_batch(
+    const char *method,
+    const char *target,
+    const char *ilusrc,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const double *spoints3n,
+    int n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    double *outPhases,
+    double *outIncdncs,
+    double *outEmissns,
+    unsigned char *outVisibl,
+    unsigned char *outLit,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
 // occult_c: determine occultation condition code for one target vs another.
 int tspice_occult(
     const char *targ1,
@@ -1020,6 +1495,33 @@ int tspice_occult(
     char *err,
     int errMaxBytes);
 
+// Batched occult_c over `nTriples` (targ1, shape1, frame1, targ2, shape2, frame2,
+// observer) triples, one string array per field, at each of `nEts` epochs with one
+// `abcorr`. `outCodes` (nTriples*nEts bytes) receives the occult_c code for
+// triple `t` at epoch `e` in `outCodes[t * nEts + e]`.
+//
+// For `POINT` / `ELLIPSOID` shapes, each epoch first resolves the position of
+// every distinct (target, observer) pair once (`spkpos_c`, J2000, `abcorr`) and
+// reports 0 without calling occult_c when the targets' bounding spheres are
+// clearly apart as seen by the observer. Everything else runs occult_c. Stops
+// at the first CSPICE failure with `outFailedIndex` set to `t * nEts + e`.
+int tspice_occult_batch(
+    const char *const *targ1s,
+    const char *const *shape1s,
+    const char *const *frame1s,
+    const char *const *targ2s,
+    const char *const *shape2s,
+    const char *const *frame2s,
+    const char *const *observers,
+    int nTriples,
+    const char *abcorr,
+    const double *ets,
+    int nEts,
+    signed char *outCodes,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
 // --- GF (Geometry Finder) event finding ---
 
 // gfsstp_c: set the constant step size used by gfstep_c.
@@ -1199,6 +1701,37 @@ int tspice_recgeo(
     char *err,
     int errMaxBytes);
 
+// Batched coordinate conversions over `n` packed 3-vectors.
+//
+// Inputs and outputs are `3*n` doubles, row-major (one point per row):
+// - reclat: (x, y, z) -> (radius, lon, lat); latrec is the inverse.
+// - recsph: (x, y, z) -> (r, colat, lon); sphrec is the inverse.
+// - georec: (lon, lat, alt) -> (x, y, z); recgeo is the inverse.
+//
+// Each row goes through the same CSPICE routine as the scalar entrypoints, so
+// results are bit-identical to calling them one point at a time. `out3n` may
+// alias the input. On failure, rows before the failing one are valid.
+int tspice_reclat_batch(const double *rect3n, int n, double *outLat3n, char *err, int errMaxBytes);
+int tspice_latrec_batch(const double *lat3n, int n, double *outRect3n, char *err, int errMaxBytes);
+int tspice_recsph_batch(const double *rect3n, int n, double *outSph3n, char *err, int errMaxBytes);
+int tspice_sphrec_batch(const double *sph3n, int n, double *outRect3n, char *err, int errMaxBytes);
+int tspice_georec_batch(
+    const double *geo3n,
+    int n,
+    double re,
+    double f,
+    double *outRect3n,
+    char *err,
+    int errMaxBytes);
+int tspice_recgeo_batch(
+    const double *rect3n,
+    int n,
+    double re,
+    double f,
+    double *outGeo3n,
+    char *err,
+    int errMaxBytes);
+
 // --- SCLK conversions + CK attitude ---
 
 // scs2e_c: convert an encoded SCLK string -> ET seconds past J2000.
@@ -1281,6 +1814,43 @@ int tspice_ckgpav(
     char *err,
     int errMaxBytes);
 
+// Batched ckgp_c over `n` encoded SCLK times (`sclkdps`) for one instrument
+// and reference frame.
+//
+// Outputs are caller-owned: `outCmats9n` (9*n doubles, row-major per tick),
+// `outClkouts` (n doubles) and `outFoundBits` (ceil(n/8) bytes; bit `i % 8` of
+// byte `i / 8` is set when tick `i` was found). Rows for ticks without pointing
+// are zero. Stops at the first CSPICE failure with `outFailedIndex` set as in
+// tspice_spkezr_batch.
+int tspice_ckgp_batch(
+    int inst,
+    const double *sclkdps,
+    int n,
+    double tol,
+    const char *ref,
+    double *outCmats9n,
+    double *outClkouts,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
+// Batched ckgpav_c. Same conventions as tspice_ckgp_batch, plus `outAvs3n`
+// (3*n doubles).
+int tspice_ckgpav_batch(
+    int inst,
+    const double *sclkdps,
+    int n,
+    double tol,
+    const char *ref,
+    double *outCmats9n,
+    double *outAvs3n,
+    double *outClkouts,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes);
+
 // --- CK file query / management (read-only) --------------------------------
 
 // cklpf_c: load a CK file for access by pointing routines.
@@ -1366,6 +1936,38 @@ int tspice_wnfetd(
     int errMaxBytes);
 int tspice_wnvald(int size, int n, uintptr_t window, char *err, int errMaxBytes);
 
+// Bulk copies of a cell's data segment (one `memcpy` instead of one call per
+// element). Exports write `card` values and require `outLen >= card`; imports
+// replace the contents with `n <= size` values as given (set cells are not
+// re-sorted).
+int tspice_cell_export_int(
+    uintptr_t cell,
+    int *outData,
+    int outLen,
+    int *outCard,
+    char *err,
+    int errMaxBytes);
+int tspice_cell_export_double(
+    uintptr_t cell,
+    double *outData,
+    int outLen,
+    int *outCard,
+    char *err,
+    int errMaxBytes);
+int tspice_cell_import_int(uintptr_t cell, const int *data, int n, char *err, int errMaxBytes);
+int tspice_cell_import_double(uintptr_t cell, const double *data, int n, char *err, int errMaxBytes);
+
+// Replace a window's contents with `nEndpoints / 2` intervals. Input that is
+// already a valid window is copied as-is; otherwise it is normalized with
+// `wnvald_c` (sorted and merged; `left > right` is an error, leaving the window
+// empty). Export a window with `tspice_cell_export_double`.
+int tspice_window_import(
+    uintptr_t window,
+    const double *endpoints,
+    int nEndpoints,
+    char *err,
+    int errMaxBytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,88 @@ static int tspice_spice_int_to_int_checked(
 
 // ---------------------------------------------------------------------------
 
+// ---- Cell storage pool ----------------------------------------------------
+//
+// Every cell/window is a single block: a small header, the `SpiceCell`
+// descriptor, then the `base` array (control area + data). GF searches create
+// and free confinement/result windows on every call, so blocks whose `base`
+// fits a power-of-two size class are recycled through a bounded per-class
+// free list instead of going back to `malloc`. Larger blocks bypass the pool.
+//
+// Concurrency: same contract as the handle registry (callers serialize).
+
+#define TSPICE_CELL_POOL_MIN_SHIFT 8   // 256-byte smallest class
+#define TSPICE_CELL_POOL_MAX_SHIFT 16  // 64 KiB largest class
+#define TSPICE_CELL_POOL_CLASSES (TSPICE_CELL_POOL_MAX_SHIFT - TSPICE_CELL_POOL_MIN_SHIFT + 1)
+#define TSPICE_CELL_POOL_MAX_FREE 32   // blocks retained per class
+#define TSPICE_CELL_POOL_UNPOOLED ((size_t)-1)
+
+typedef struct tspice_cell_block {
+  struct tspice_cell_block *next;  // free-list link while pooled
+  size_t sizeClass;                // class index or TSPICE_CELL_POOL_UNPOOLED
+  SpiceCell cell;
+} tspice_cell_block;
+
+// `base` starts after the descriptor, aligned for `SpiceDouble`/`SpiceInt`.
+#define TSPICE_CELL_BLOCK_BASE_OFFSET ((sizeof(tspice_cell_block) + 15u) & ~(size_t)15u)
+
+static tspice_cell_block *tspice_cell_pool_free[TSPICE_CELL_POOL_CLASSES];
+static size_t tspice_cell_pool_free_count[TSPICE_CELL_POOL_CLASSES];
+
+static size_t tspice_cell_pool_class_for(size_t baseBytes) {
+  for (size_t c = 0; c < TSPICE_CELL_POOL_CLASSES; c++) {
+    if (baseBytes <= ((size_t)1 << (TSPICE_CELL_POOL_MIN_SHIFT + c))) return c;
+  }
+  return TSPICE_CELL_POOL_UNPOOLED;
+}
+
+// Returns a zeroed descriptor whose `base` points at `baseBytes` zeroed bytes,
+// or NULL on allocation failure.
+static SpiceCell *tspice_cell_storage_alloc(size_t baseBytes) {
+  const size_t sizeClass = tspice_cell_pool_class_for(baseBytes);
+  tspice_cell_block *block = NULL;
+
+  if (sizeClass != TSPICE_CELL_POOL_UNPOOLED && tspice_cell_pool_free[sizeClass]) {
+    block = tspice_cell_pool_free[sizeClass];
+    tspice_cell_pool_free[sizeClass] = block->next;
+    tspice_cell_pool_free_count[sizeClass]--;
+  } else {
+    const size_t capacity = sizeClass == TSPICE_CELL_POOL_UNPOOLED
+        ? baseBytes
+        : ((size_t)1 << (TSPICE_CELL_POOL_MIN_SHIFT + sizeClass));
+    if (capacity > SIZE_MAX - TSPICE_CELL_BLOCK_BASE_OFFSET) return NULL;
+    block = (tspice_cell_block *)malloc(TSPICE_CELL_BLOCK_BASE_OFFSET + capacity);
+    if (!block) return NULL;
+  }
+
+  block->next = NULL;
+  block->sizeClass = sizeClass;
+  memset(&block->cell, 0, sizeof(block->cell));
+
+  char *base = (char *)block + TSPICE_CELL_BLOCK_BASE_OFFSET;
+  memset(base, 0, baseBytes);
+  block->cell.base = (void *)base;
+  return &block->cell;
+}
+
+// Returns a block from `tspice_cell_storage_alloc` to its class free list (or
+// to `free` when the list is full or the block is unpooled).
+static void tspice_cell_storage_release(SpiceCell *cell) {
+  if (!cell) return;
+  tspice_cell_block *block =
+      (tspice_cell_block *)((char *)cell - offsetof(tspice_cell_block, cell));
+
+  const size_t sizeClass = block->sizeClass;
+  if (sizeClass == TSPICE_CELL_POOL_UNPOOLED ||
+      tspice_cell_pool_free_count[sizeClass] >= TSPICE_CELL_POOL_MAX_FREE) {
+    free(block);
+    return;
+  }
+  block->next = tspice_cell_pool_free[sizeClass];
+  tspice_cell_pool_free[sizeClass] = block;
+  tspice_cell_pool_free_count[sizeClass]++;
+}
+
 static SpiceCell *tspice_as_cell(uintptr_t handle) { return (SpiceCell *)handle; }
 
 static int tspice_alloc_and_init_int_cell(SpiceInt size, uintptr_t *outCell, char *err, int errMaxBytes) {
@@ -58,19 +140,11 @@ static int tspice_alloc_and_init_int_cell(SpiceInt size, uintptr_t *outCell, cha
     return tspice_return_error(err, errMaxBytes, "tspice_new_int_cell(): size must be >= 0");
   }
 
-  SpiceCell *cell = (SpiceCell *)malloc(sizeof(SpiceCell));
+  SpiceCell *cell = tspice_cell_storage_alloc((size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceInt));
   if (!cell) {
-    return tspice_return_error(err, errMaxBytes, "tspice_new_int_cell(): malloc(cell) failed");
-  }
-
-  SpiceInt *base = (SpiceInt *)malloc((size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceInt));
-  if (!base) {
-    free(cell);
-    return tspice_return_error(err, errMaxBytes, "tspice_new_int_cell(): malloc(base) failed");
+    return tspice_return_error(err, errMaxBytes, "tspice_new_int_cell(): cell allocation failed");
   }
-
-  memset(cell, 0, sizeof(*cell));
-  memset(base, 0, (size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceInt));
+  SpiceInt *base = (SpiceInt *)cell->base;
 
   cell->dtype = SPICE_INT;
   cell->length = 0;
@@ -87,15 +161,13 @@ static int tspice_alloc_and_init_int_cell(SpiceInt size, uintptr_t *outCell, cha
   ssize_c(size, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
   scard_c(0, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
 
@@ -114,20 +186,12 @@ static int tspice_alloc_and_init_double_cell(
     return tspice_return_error(err, errMaxBytes, "tspice_new_double_cell(): size must be >= 0");
   }
 
-  SpiceCell *cell = (SpiceCell *)malloc(sizeof(SpiceCell));
+  SpiceCell *cell =
+      tspice_cell_storage_alloc((size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceDouble));
   if (!cell) {
-    return tspice_return_error(err, errMaxBytes, "tspice_new_double_cell(): malloc(cell) failed");
-  }
-
-  SpiceDouble *base =
-      (SpiceDouble *)malloc((size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceDouble));
-  if (!base) {
-    free(cell);
-    return tspice_return_error(err, errMaxBytes, "tspice_new_double_cell(): malloc(base) failed");
+    return tspice_return_error(err, errMaxBytes, "tspice_new_double_cell(): cell allocation failed");
   }
-
-  memset(cell, 0, sizeof(*cell));
-  memset(base, 0, (size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceDouble));
+  SpiceDouble *base = (SpiceDouble *)cell->base;
 
   cell->dtype = SPICE_DP;
   cell->length = 0;
@@ -142,15 +206,13 @@ static int tspice_alloc_and_init_double_cell(
   ssize_c(size, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
   scard_c(0, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
 
@@ -173,20 +235,12 @@ static int tspice_alloc_and_init_double_cell_uninitialized(
     return tspice_return_error(err, errMaxBytes, "tspice_new_window(): size must be >= 0");
   }
 
-  SpiceCell *cell = (SpiceCell *)malloc(sizeof(SpiceCell));
+  SpiceCell *cell =
+      tspice_cell_storage_alloc((size_t)(SPICE_CELL_CTRLSZ + capacity) * sizeof(SpiceDouble));
   if (!cell) {
-    return tspice_return_error(err, errMaxBytes, "tspice_new_window(): malloc(cell) failed");
+    return tspice_return_error(err, errMaxBytes, "tspice_new_window(): cell allocation failed");
   }
-
-  SpiceDouble *base =
-      (SpiceDouble *)malloc((size_t)(SPICE_CELL_CTRLSZ + capacity) * sizeof(SpiceDouble));
-  if (!base) {
-    free(cell);
-    return tspice_return_error(err, errMaxBytes, "tspice_new_window(): malloc(base) failed");
-  }
-
-  memset(cell, 0, sizeof(*cell));
-  memset(base, 0, (size_t)(SPICE_CELL_CTRLSZ + capacity) * sizeof(SpiceDouble));
+  SpiceDouble *base = (SpiceDouble *)cell->base;
 
   cell->dtype = SPICE_DP;
   cell->length = 0;
@@ -217,23 +271,15 @@ static int tspice_alloc_and_init_char_cell(
     return tspice_return_error(err, errMaxBytes, "tspice_new_char_cell(): length must be > 0");
   }
 
-  SpiceCell *cell = (SpiceCell *)malloc(sizeof(SpiceCell));
-  if (!cell) {
-    return tspice_return_error(err, errMaxBytes, "tspice_new_char_cell(): malloc(cell) failed");
-  }
-
   // Each "element" is a fixed-length string of `length` chars.
   const size_t totalElements = (size_t)(SPICE_CELL_CTRLSZ + size);
   const size_t bytes = totalElements * (size_t)length * sizeof(SpiceChar);
 
-  SpiceChar *base = (SpiceChar *)malloc(bytes);
-  if (!base) {
-    free(cell);
-    return tspice_return_error(err, errMaxBytes, "tspice_new_char_cell(): malloc(base) failed");
+  SpiceCell *cell = tspice_cell_storage_alloc(bytes);
+  if (!cell) {
+    return tspice_return_error(err, errMaxBytes, "tspice_new_char_cell(): cell allocation failed");
   }
-
-  memset(cell, 0, sizeof(*cell));
-  memset(base, 0, bytes);
+  SpiceChar *base = (SpiceChar *)cell->base;
 
   cell->dtype = SPICE_CHR;
   cell->length = length;
@@ -248,15 +294,13 @@ static int tspice_alloc_and_init_char_cell(
   ssize_c(size, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
   scard_c(0, cell);
   if (failed_c()) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
-    free(base);
-    free(cell);
+    tspice_cell_storage_release(cell);
     return 1;
   }
 
@@ -284,7 +328,7 @@ int tspice_new_int_cell(int size, uintptr_t *outCell, char *err, int errMaxBytes
     SpiceCell *cell = (SpiceCell *)(*outCell);
     const int reg = tspice_registry_add(cell, "tspice_new_int_cell()", err, errMaxBytes);
     if (reg != 0) {
-      tspice_free_cell(*outCell, NULL, 0);
+      tspice_cell_storage_release(cell);
       *outCell = 0;
       return 1;
     }
@@ -310,7 +354,7 @@ int tspice_new_double_cell(int size, uintptr_t *outCell, char *err, int errMaxBy
     SpiceCell *cell = (SpiceCell *)(*outCell);
     const int reg = tspice_registry_add(cell, "tspice_new_double_cell()", err, errMaxBytes);
     if (reg != 0) {
-      tspice_free_cell(*outCell, NULL, 0);
+      tspice_cell_storage_release(cell);
       *outCell = 0;
       return 1;
     }
@@ -345,7 +389,7 @@ int tspice_new_char_cell(
     SpiceCell *cell = (SpiceCell *)(*outCell);
     const int reg = tspice_registry_add(cell, "tspice_new_char_cell()", err, errMaxBytes);
     if (reg != 0) {
-      tspice_free_cell(*outCell, NULL, 0);
+      tspice_cell_storage_release(cell);
       *outCell = 0;
       return 1;
     }
@@ -381,7 +425,7 @@ int tspice_new_window(int maxIntervals, uintptr_t *outWindow, char *err, int err
   SpiceCell *window = (SpiceCell *)(*outWindow);
   const int reg = tspice_registry_add(window, "tspice_new_window()", err, errMaxBytes);
   if (reg != 0) {
-    tspice_free_cell(*outWindow, NULL, 0);
+    tspice_cell_storage_release(window);
     *outWindow = 0;
     return 1;
   }
@@ -419,10 +463,7 @@ int tspice_free_cell(uintptr_t cellHandle, char *err, int errMaxBytes) {
 
   (void)tspice_registry_remove(cell);
 
-  if (cell->base) {
-    free(cell->base);
-  }
-  free(cell);
+  tspice_cell_storage_release(cell);
   return 0;
 }
 
@@ -439,10 +480,7 @@ int tspice_free_window(uintptr_t windowHandle, char *err, int errMaxBytes) {
 
   (void)tspice_registry_remove(window);
 
-  if (window->base) {
-    free(window->base);
-  }
-  free(window);
+  tspice_cell_storage_release(window);
   return 0;
 }
 
@@ -967,3 +1005,217 @@ int tspice_wnvald(int size, int n, uintptr_t windowHandle, char *err, int errMax
 
   return 0;
 }
+
+// ---- Bulk copies ----------------------------------------------------------
+
+static SpiceCell *tspice_bulk_cell(
+    uintptr_t cellHandle,
+    SpiceDataType dtype,
+    const char *ctx,
+    char *err,
+    int errMaxBytes) {
+  SpiceCell *cell = tspice_validate_handle(cellHandle, "cell", ctx, err, errMaxBytes);
+  if (!cell) {
+    return NULL;
+  }
+  if (cell->dtype != dtype) {
+    char buf[200];
+    snprintf(buf, sizeof(buf), "%s: expected %s cell", ctx, dtype == SPICE_INT ? "SPICE_INT" : "SPICE_DP");
+    tspice_return_error(err, errMaxBytes, buf);
+    return NULL;
+  }
+
+  // `card_c` syncs the cell header with its control area before `data` is touched directly.
+  cell->init = SPICEFALSE;
+  (void)card_c(cell);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return NULL;
+  }
+  return cell;
+}
+
+int tspice_cell_export_int(
+    uintptr_t cellHandle,
+    int *outData,
+    int outLen,
+    int *outCard,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outCard) {
+    *outCard = 0;
+  }
+
+  SpiceCell *cell = tspice_bulk_cell(cellHandle, SPICE_INT, "tspice_cell_export_int()", err, errMaxBytes);
+  if (!cell) {
+    return 1;
+  }
+
+  int card = 0;
+  if (tspice_spice_int_to_int_checked(cell->card, &card, "tspice_cell_export_int()", err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (card > 0 && (!outData || outLen < card)) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_export_int(): outLen must be >= card");
+  }
+
+  const SpiceInt *data = (const SpiceInt *)cell->data;
+  if (sizeof(SpiceInt) == sizeof(int)) {
+    if (card > 0) memcpy(outData, data, (size_t)card * sizeof(int));
+  } else {
+    for (int i = 0; i < card; i++) {
+      if (tspice_spice_int_to_int_checked(data[i], &outData[i], "tspice_cell_export_int()", err, errMaxBytes) != 0) {
+        return 1;
+      }
+    }
+  }
+
+  if (outCard) {
+    *outCard = card;
+  }
+  return 0;
+}
+
+int tspice_cell_export_double(
+    uintptr_t cellHandle,
+    double *outData,
+    int outLen,
+    int *outCard,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outCard) {
+    *outCard = 0;
+  }
+
+  SpiceCell *cell = tspice_bulk_cell(cellHandle, SPICE_DP, "tspice_cell_export_double()", err, errMaxBytes);
+  if (!cell) {
+    return 1;
+  }
+
+  int card = 0;
+  if (tspice_spice_int_to_int_checked(cell->card, &card, "tspice_cell_export_double()", err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (card > 0 && (!outData || outLen < card)) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_export_double(): outLen must be >= card");
+  }
+
+  if (card > 0) {
+    memcpy(outData, cell->data, (size_t)card * sizeof(double));
+  }
+  if (outCard) {
+    *outCard = card;
+  }
+  return 0;
+}
+
+int tspice_cell_import_int(uintptr_t cellHandle, const int *data, int n, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  SpiceCell *cell = tspice_bulk_cell(cellHandle, SPICE_INT, "tspice_cell_import_int()", err, errMaxBytes);
+  if (!cell) {
+    return 1;
+  }
+  if (n < 0 || (SpiceInt)n > cell->size) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_import_int(): n must be in [0, size]");
+  }
+  if (n > 0 && !data) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_import_int(): data must be non-NULL");
+  }
+
+  SpiceInt *dst = (SpiceInt *)cell->data;
+  if (sizeof(SpiceInt) == sizeof(int)) {
+    if (n > 0) memcpy(dst, data, (size_t)n * sizeof(int));
+  } else {
+    for (int i = 0; i < n; i++) {
+      dst[i] = (SpiceInt)data[i];
+    }
+  }
+
+  scard_c((SpiceInt)n, cell);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+  return 0;
+}
+
+int tspice_cell_import_double(uintptr_t cellHandle, const double *data, int n, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  SpiceCell *cell = tspice_bulk_cell(cellHandle, SPICE_DP, "tspice_cell_import_double()", err, errMaxBytes);
+  if (!cell) {
+    return 1;
+  }
+  if (n < 0 || (SpiceInt)n > cell->size) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_import_double(): n must be in [0, size]");
+  }
+  if (n > 0 && !data) {
+    return tspice_return_error(err, errMaxBytes, "tspice_cell_import_double(): data must be non-NULL");
+  }
+
+  if (n > 0) {
+    memcpy(cell->data, data, (size_t)n * sizeof(double));
+  }
+
+  scard_c((SpiceInt)n, cell);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+  return 0;
+}
+
+int tspice_window_import(
+    uintptr_t windowHandle,
+    const double *endpoints,
+    int nEndpoints,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  if (nEndpoints < 0 || (nEndpoints % 2) != 0) {
+    return tspice_return_error(err, errMaxBytes, "tspice_window_import(): nEndpoints must be even and >= 0");
+  }
+
+  // Already a valid window (each interval ordered, intervals strictly increasing and disjoint):
+  // one memcpy. Anything else goes through wnvald_c, which sorts, merges and rejects left > right.
+  int ordered = 1;
+  for (int i = 0; i < nEndpoints && ordered; i += 2) {
+    if (!(endpoints[i] <= endpoints[i + 1])) ordered = 0;
+    if (i + 2 < nEndpoints && !(endpoints[i + 1] < endpoints[i + 2])) ordered = 0;
+  }
+
+  if (tspice_cell_import_double(windowHandle, endpoints, nEndpoints, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (ordered) {
+    return 0;
+  }
+
+  SpiceCell *window = tspice_as_cell(windowHandle);
+  wnvald_c(window->size, (SpiceInt)nEndpoints, window);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    scard_c(0, window);
+    return 1;
+  }
+  return 0;
+}
@@ -1,4 +1,5 @@
 #include "tspice_backend_shim.h"
+#include "tspice_error.h"
 
 #include "SpiceUsr.h"
 
@@ -827,3 +828,170 @@ int tspice_recgeo(
 
   return 0;
 }
+
+// --- batched coordinate conversions ---
+//
+// Scalar loops over the CSPICE routines: there is no hand-written SIMD path,
+// because vector trig cannot reproduce CSPICE's results bit for bit. The saving
+// is one native call and one lock per batch instead of per point.
+//
+// Each row is copied into locals before CSPICE writes the result, so `out3n`
+// may alias `in3n` (in-place conversion).
+
+typedef void (*tspice_coord3_fn)(const SpiceDouble in[3], SpiceDouble out[3]);
+
+static void tspice_reclat_row(const SpiceDouble in[3], SpiceDouble out[3]) {
+  reclat_c(in, &out[0], &out[1], &out[2]);
+}
+
+static void tspice_latrec_row(const SpiceDouble in[3], SpiceDouble out[3]) {
+  latrec_c(in[0], in[1], in[2], out);
+}
+
+static void tspice_recsph_row(const SpiceDouble in[3], SpiceDouble out[3]) {
+  recsph_c(in, &out[0], &out[1], &out[2]);
+}
+
+static void tspice_sphrec_row(const SpiceDouble in[3], SpiceDouble out[3]) {
+  sphrec_c(in[0], in[1], in[2], out);
+}
+
+static int tspice_coord3_batch(
+    const char *ctx,
+    tspice_coord3_fn fn,
+    const double *in3n,
+    int n,
+    double *out3n,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  if (n < 0) {
+    char buf[200];
+    snprintf(buf, sizeof(buf), "%s: n must be >= 0", ctx);
+    return tspice_return_error(err, errMaxBytes, buf);
+  }
+  if (n > 0 && (!in3n || !out3n)) {
+    char buf[200];
+    snprintf(buf, sizeof(buf), "%s: input and output buffers must not be NULL when n > 0", ctx);
+    return tspice_return_error(err, errMaxBytes, buf);
+  }
+
+  for (size_t i = 0; i < (size_t)n; i++) {
+    const SpiceDouble in[3] = {in3n[i * 3], in3n[i * 3 + 1], in3n[i * 3 + 2]};
+    SpiceDouble out[3] = {0.0, 0.0, 0.0};
+    fn(in, out);
+    out3n[i * 3] = (double)out[0];
+    out3n[i * 3 + 1] = (double)out[1];
+    out3n[i * 3 + 2] = (double)out[2];
+  }
+
+  // These routines only signal on internal toolkit errors; check once.
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
+
+int tspice_reclat_batch(const double *rect3n, int n, double *outLat3n, char *err, int errMaxBytes) {
+  return tspice_coord3_batch("tspice_reclat_batch()", tspice_reclat_row, rect3n, n, outLat3n, err, errMaxBytes);
+}
+
+int tspice_latrec_batch(const double *lat3n, int n, double *outRect3n, char *err, int errMaxBytes) {
+  return tspice_coord3_batch("tspice_latrec_batch()", tspice_latrec_row, lat3n, n, outRect3n, err, errMaxBytes);
+}
+
+int tspice_recsph_batch(const double *rect3n, int n, double *outSph3n, char *err, int errMaxBytes) {
+  return tspice_coord3_batch("tspice_recsph_batch()", tspice_recsph_row, rect3n, n, outSph3n, err, errMaxBytes);
+}
+
+int tspice_sphrec_batch(const double *sph3n, int n, double *outRect3n, char *err, int errMaxBytes) {
+  return tspice_coord3_batch("tspice_sphrec_batch()", tspice_sphrec_row, sph3n, n, outRect3n, err, errMaxBytes);
+}
+
+int tspice_georec_batch(
+    const double *geo3n,
+    int n,
+    double re,
+    double f,
+    double *outRect3n,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  if (n < 0) {
+    return tspice_return_error(err, errMaxBytes, "tspice_georec_batch(): n must be >= 0");
+  }
+  if (n > 0 && (!geo3n || !outRect3n)) {
+    return tspice_return_error(
+        err, errMaxBytes, "tspice_georec_batch(): input and output buffers must not be NULL when n > 0");
+  }
+
+  for (size_t i = 0; i < (size_t)n; i++) {
+    const SpiceDouble lon = geo3n[i * 3];
+    const SpiceDouble lat = geo3n[i * 3 + 1];
+    const SpiceDouble alt = geo3n[i * 3 + 2];
+    SpiceDouble out[3] = {0.0, 0.0, 0.0};
+    georec_c(lon, lat, alt, (SpiceDouble)re, (SpiceDouble)f, out);
+    // `re`/`f` are the only inputs CSPICE validates, so a failure surfaces on the first row.
+    if (failed_c()) {
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    outRect3n[i * 3] = (double)out[0];
+    outRect3n[i * 3 + 1] = (double)out[1];
+    outRect3n[i * 3 + 2] = (double)out[2];
+  }
+
+  return 0;
+}
+
+int tspice_recgeo_batch(
+    const double *rect3n,
+    int n,
+    double re,
+    double f,
+    double *outGeo3n,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  if (n < 0) {
+    return tspice_return_error(err, errMaxBytes, "tspice_recgeo_batch(): n must be >= 0");
+  }
+  if (n > 0 && (!rect3n || !outGeo3n)) {
+    return tspice_return_error(
+        err, errMaxBytes, "tspice_recgeo_batch(): input and output buffers must not be NULL when n > 0");
+  }
+
+  for (size_t i = 0; i < (size_t)n; i++) {
+    const SpiceDouble rect[3] = {rect3n[i * 3], rect3n[i * 3 + 1], rect3n[i * 3 + 2]};
+    SpiceDouble lon = 0.0;
+    SpiceDouble lat = 0.0;
+    SpiceDouble alt = 0.0;
+    recgeo_c(rect, (SpiceDouble)re, (SpiceDouble)f, &lon, &lat, &alt);
+    if (failed_c()) {
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    outGeo3n[i * 3] = (double)lon;
+    outGeo3n[i * 3 + 1] = (double)lat;
+    outGeo3n[i * 3 + 2] = (double)alt;
+  }
+
+  return 0;
+}
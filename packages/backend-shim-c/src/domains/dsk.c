@@ -275,3 +275,112 @@ int tspice_dskb02(int handle, const int32_t *dladscInts8, int32_t *outInts10, do
 
   return 0;
 }
+
+int tspice_dskv02(int handle, const int32_t *dladscInts8, int start, int room, int *outN,
+                  double *outVrtces, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  tspice_clear_error(err, errMaxBytes);
+
+  if (dladscInts8 == NULL) {
+    return tspice_return_error(err, errMaxBytes, "dladscInts8 must be non-null");
+  }
+  if (outN == NULL) {
+    return tspice_return_error(err, errMaxBytes, "outN must be non-null");
+  }
+  if (outVrtces == NULL) {
+    return tspice_return_error(err, errMaxBytes, "outVrtces must be non-null");
+  }
+  *outN = 0;
+
+  SpiceDLADescr dladsc;
+  tspice_write_dla_descr_from_ints(&dladsc, dladscInts8);
+
+  SpiceInt n = 0;
+  dskv02_c((SpiceInt)handle, &dladsc, (SpiceInt)start, (SpiceInt)room, &n,
+           (SpiceDouble(*)[3])outVrtces);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  *outN = (int)n;
+  return 0;
+}
+
+int tspice_dskp02(int handle, const int32_t *dladscInts8, int start, int room, int *outN,
+                  int32_t *outPlates, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  tspice_clear_error(err, errMaxBytes);
+
+  if (dladscInts8 == NULL) {
+    return tspice_return_error(err, errMaxBytes, "dladscInts8 must be non-null");
+  }
+  if (outN == NULL) {
+    return tspice_return_error(err, errMaxBytes, "outN must be non-null");
+  }
+  if (outPlates == NULL) {
+    return tspice_return_error(err, errMaxBytes, "outPlates must be non-null");
+  }
+  *outN = 0;
+
+  SpiceDLADescr dladsc;
+  tspice_write_dla_descr_from_ints(&dladsc, dladscInts8);
+
+  SpiceInt n = 0;
+  dskp02_c((SpiceInt)handle, &dladsc, (SpiceInt)start, (SpiceInt)room, &n,
+           (SpiceInt(*)[3])outPlates);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  *outN = (int)n;
+  return 0;
+}
+
+int tspice_dskx02(int handle, const int32_t *dladscInts8, const double *vertex3, const double *raydir3,
+                  int32_t *outPlid, double *outXpt3, int32_t *outFound, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  tspice_clear_error(err, errMaxBytes);
+
+  if (dladscInts8 == NULL) {
+    return tspice_return_error(err, errMaxBytes, "dladscInts8 must be non-null");
+  }
+  if (vertex3 == NULL || raydir3 == NULL) {
+    return tspice_return_error(err, errMaxBytes, "vertex3 and raydir3 must be non-null");
+  }
+  if (outPlid == NULL || outXpt3 == NULL || outFound == NULL) {
+    return tspice_return_error(err, errMaxBytes, "outPlid, outXpt3 and outFound must be non-null");
+  }
+  *outPlid = 0;
+  outXpt3[0] = 0.0;
+  outXpt3[1] = 0.0;
+  outXpt3[2] = 0.0;
+  *outFound = 0;
+
+  SpiceDLADescr dladsc;
+  tspice_write_dla_descr_from_ints(&dladsc, dladscInts8);
+
+  SpiceDouble vertex[3] = {vertex3[0], vertex3[1], vertex3[2]};
+  SpiceDouble raydir[3] = {raydir3[0], raydir3[1], raydir3[2]};
+  SpiceInt plid = 0;
+  SpiceDouble xpt[3] = {0.0, 0.0, 0.0};
+  SpiceBoolean found = SPICEFALSE;
+  dskx02_c((SpiceInt)handle, &dladsc, vertex, raydir, &plid, xpt, &found);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  if (found == SPICETRUE) {
+    *outPlid = (int32_t)plid;
+    outXpt3[0] = (double)xpt[0];
+    outXpt3[1] = (double)xpt[1];
+    outXpt3[2] = (double)xpt[2];
+    *outFound = 1;
+  }
+  return 0;
+}
@@ -478,6 +478,136 @@ int tspice_ekgi(
 }
 
 
+int tspice_ekpsel(
+    const char *query,
+    int maxCols,
+    int nameMaxBytes,
+    int outErrmsgMaxBytes,
+    int *outN,
+    int *outTypes,
+    char *outTabs,
+    char *outCols,
+    int *outError,
+    char *outErrmsg,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outN) {
+    *outN = 0;
+  }
+  if (outError) {
+    *outError = 0;
+  }
+  if (outErrmsg && outErrmsgMaxBytes > 0) {
+    outErrmsg[0] = '\0';
+  }
+
+  if (!query || query[0] == '\0') {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: query must be a non-empty string");
+  }
+  if (maxCols < 1) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: maxCols must be >= 1");
+  }
+  if (nameMaxBytes < 2) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: nameMaxBytes must be >= 2");
+  }
+  if (outErrmsgMaxBytes < 2) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: outErrmsgMaxBytes must be >= 2");
+  }
+  if (!outN || !outTypes || !outTabs || !outCols || !outError || !outErrmsg) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: output pointers must be non-NULL");
+  }
+
+  // `ekpsel_c` writes up to SPICE_EK_MAXQSEL entries regardless of what the
+  // caller has room for, so parse into full-size scratch and copy out.
+  SpiceInt nC = 0;
+  SpiceInt xbegs[SPICE_EK_MAXQSEL];
+  SpiceInt xends[SPICE_EK_MAXQSEL];
+  SpiceEKDataType xtypes[SPICE_EK_MAXQSEL];
+  SpiceEKExprClass xclass[SPICE_EK_MAXQSEL];
+  SpiceChar tabs[SPICE_EK_MAXQSEL][SPICE_EK_TNAMSZ + 1];
+  SpiceChar cols[SPICE_EK_MAXQSEL][SPICE_EK_CSTRLN];
+  SpiceBoolean errorC = SPICEFALSE;
+
+  ekpsel_c(
+      query,
+      (SpiceInt)outErrmsgMaxBytes,
+      (SpiceInt)(SPICE_EK_TNAMSZ + 1),
+      (SpiceInt)SPICE_EK_CSTRLN,
+      &nC,
+      xbegs,
+      xends,
+      xtypes,
+      xclass,
+      tabs,
+      cols,
+      &errorC,
+      outErrmsg);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  outErrmsg[outErrmsgMaxBytes - 1] = '\0';
+
+  if (errorC == SPICETRUE) {
+    *outError = 1;
+    return 0;
+  }
+  if (nC > (SpiceInt)maxCols) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_ekpsel: query selects more than maxCols columns");
+  }
+
+  for (SpiceInt i = 0; i < nC; i++) {
+    outTypes[i] = (int)xtypes[i];
+
+    char *tab = outTabs + (size_t)i * (size_t)nameMaxBytes;
+    strncpy(tab, tabs[i], (size_t)nameMaxBytes - 1);
+    tab[nameMaxBytes - 1] = '\0';
+
+    char *col = outCols + (size_t)i * (size_t)nameMaxBytes;
+    strncpy(col, cols[i], (size_t)nameMaxBytes - 1);
+    col[nameMaxBytes - 1] = '\0';
+  }
+
+  *outN = (int)nC;
+  return 0;
+}
+
+int tspice_eknelt(int selidx, int row, int *outN, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (err && errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outN) {
+    *outN = 0;
+  }
+
+  if (!outN) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_eknelt: outN must be non-NULL");
+  }
+  if (selidx < 0) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_eknelt: selidx must be >= 0");
+  }
+  if (row < 0) {
+    return tspice_ek_invalid_arg(err, errMaxBytes, "tspice_eknelt: row must be >= 0");
+  }
+
+  const SpiceInt nC = eknelt_c((SpiceInt)selidx, (SpiceInt)row);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  *outN = (int)nC;
+  return 0;
+}
+
 // --- EK fast write ---------------------------------------------------------
 
 static int tspice_ek_sum_entszs(
@@ -4,8 +4,10 @@
 
 #include "../handle_validation.h"
 
+#include <ctype.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static int tspice_ephemeris_invalid_arg(char *err, int errMaxBytes, const char *msg) {
@@ -26,7 +28,7 @@ static int tspice_ephemeris_invalid_arg(char *err, int errMaxBytes, const char *
   return 1;
 }
 
-static int tspice_int_to_spice_int_checked(
+static int tspice_ephemeris_int_to_spice_int_checked(
     int value,
     SpiceInt *out,
     const char *ctx,
@@ -47,7 +49,7 @@ static int tspice_int_to_spice_int_checked(
   return 0;
 }
 
-static int tspice_spice_int_to_int_checked(
+static int tspice_ephemeris_spice_int_to_int_checked(
     SpiceInt value,
     int *out,
     const char *ctx,
@@ -143,6 +145,250 @@ int tspice_spkpos(
   return 0;
 }
 
+// Classifies `abcorr` for the batched aberration-correction pipeline. Returns 1 (with
+// `*outStellar`) for the light-time corrections it handles, 0 for `NONE` or anything unusual,
+// which keeps the plain per-epoch `spkezr_c` path and its error messages.
+static int tspice_spkezr_batch_abcorr_supported(const char *abcorr, int *outStellar) {
+  static const char *const kSupported[] = {"LT", "CN", "XLT", "XCN"};
+
+  char buf[16];
+  size_t len = 0;
+  for (const char *p = abcorr; *p; p++) {
+    if (*p == ' ') continue;
+    if (len + 1 >= sizeof(buf)) return 0;
+    buf[len++] = (char)toupper((unsigned char)*p);
+  }
+  buf[len] = '\0';
+
+  *outStellar = 0;
+  if (len > 2 && strcmp(buf + len - 2, "+S") == 0) {
+    *outStellar = 1;
+    buf[len - 2] = '\0';
+  }
+  for (size_t i = 0; i < sizeof(kSupported) / sizeof(kSupported[0]); i++) {
+    if (strcmp(buf, kSupported[i]) == 0) return 1;
+  }
+  return 0;
+}
+
+// Aberration-corrected states in an inertial frame, in two passes over the whole batch (what
+// `spkez_c` does per epoch through `spkacs`):
+//
+// 1. observer states relative to the SSB (`spkssb_c`), plus the observer acceleration from
+//    states one second either side (`qderiv`) when stellar aberration needs it;
+// 2. light-time iteration and stellar aberration against those states (`spkaps_c`).
+//
+// Names, the frame class and `abcorr` are resolved once per batch instead of once per epoch.
+// Returns 0 on success, 1 when CSPICE failed (error left signaled), TSPICE_INTERRUPTED when the
+// interrupt hook asked to stop, or -1 when the batch does not qualify (non-inertial frame, unknown
+// names, no memory) and nothing was touched.
+static int tspice_spkezr_batch_pipeline(
+    const char *target,
+    const double *ets,
+    int n,
+    const char *ref,
+    const char *abcorr,
+    const char *observer,
+    double *outStates6n,
+    double *outLts) {
+  int stellar = 0;
+  if (!tspice_spkezr_batch_abcorr_supported(abcorr, &stellar)) return -1;
+
+  SpiceInt targ = 0;
+  SpiceInt obs = 0;
+  SpiceBoolean found = SPICEFALSE;
+  bods2c_c(target, &targ, &found);
+  if (failed_c() || !found) return failed_c() ? 1 : -1;
+  bods2c_c(observer, &obs, &found);
+  if (failed_c() || !found) return failed_c() ? 1 : -1;
+
+  SpiceInt frcode = 0;
+  namfrm_c(ref, &frcode);
+  if (failed_c()) return 1;
+  if (frcode == 0) return -1;
+  SpiceInt cent = 0;
+  SpiceInt frclss = 0;
+  SpiceInt clssid = 0;
+  frinfo_c(frcode, &cent, &frclss, &clssid, &found);
+  if (failed_c()) return 1;
+  // Frame class 1 is INERTL; other frames need the `spkez_c` transformation logic.
+  if (!found || frclss != 1) return -1;
+
+  SpiceDouble *stobs = (SpiceDouble *)malloc(sizeof(SpiceDouble) * 9 * (size_t)n);
+  if (!stobs) return -1;
+  SpiceDouble *accobs = stobs + 6 * (size_t)n;
+
+  int interrupted = 0;
+  for (int i = 0; i < n; i++) {
+    if (tspice_interrupt_requested()) {
+      interrupted = 1;
+      break;
+    }
+    spkssb_c(obs, (SpiceDouble)ets[i], ref, &stobs[(size_t)i * 6]);
+    if (failed_c()) break;
+
+    SpiceDouble *acc = &accobs[(size_t)i * 3];
+    if (!stellar) {
+      acc[0] = acc[1] = acc[2] = 0.0;
+      continue;
+    }
+    // spkacs: quadratic derivative of the observer velocity with a one-second step.
+    const SpiceDouble delta = 1.0;
+    SpiceDouble before[6];
+    SpiceDouble after[6];
+    spkssb_c(obs, (SpiceDouble)ets[i] - delta, ref, before);
+    if (failed_c()) break;
+    spkssb_c(obs, (SpiceDouble)ets[i] + delta, ref, after);
+    if (failed_c()) break;
+    vlcomg_c(3, 1.0 / (2.0 * delta), &after[3], -1.0 / (2.0 * delta), &before[3], acc);
+  }
+
+  for (int i = 0; i < n && !interrupted && !failed_c(); i++) {
+    if (tspice_interrupt_requested()) {
+      interrupted = 1;
+      break;
+    }
+    SpiceDouble lt = 0.0;
+    SpiceDouble dlt = 0.0;
+    spkaps_c(
+        targ,
+        (SpiceDouble)ets[i],
+        ref,
+        abcorr,
+        &stobs[(size_t)i * 6],
+        &accobs[(size_t)i * 3],
+        (SpiceDouble *)&outStates6n[(size_t)i * 6],
+        &lt,
+        &dlt);
+    if (outLts) {
+      outLts[i] = (double)lt;
+    }
+  }
+
+  free(stobs);
+  if (failed_c()) return 1;
+  return interrupted ? TSPICE_INTERRUPTED : 0;
+}
+
+int tspice_spkezr_batch(
+    const char *target,
+    const double *ets,
+    int n,
+    const char *ref,
+    const char *abcorr,
+    const char *observer,
+    double *outStates6n,
+    double *outLts,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (n < 0) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spkezr_batch(): n must be >= 0");
+  }
+  if (n > 0 && (!ets || !outStates6n)) {
+    return tspice_ephemeris_invalid_arg(
+        err,
+        errMaxBytes,
+        "tspice_spkezr_batch(): ets and outStates6n must not be NULL when n > 0");
+  }
+
+  // Light-time corrected batches in inertial frames go through the two-pass pipeline. If it fails
+  // anywhere, rerun per epoch so the reported error and index are exactly those of `spkezr_c`.
+  if (n > 0) {
+    const int piped = tspice_spkezr_batch_pipeline(target, ets, n, ref, abcorr, observer, outStates6n, outLts);
+    if (piped == 0 || piped == TSPICE_INTERRUPTED) {
+      return piped;
+    }
+    if (piped > 0) {
+      reset_c();
+      tspice_clear_last_error_buffers();
+    }
+  }
+
+  for (int i = 0; i < n; i++) {
+    if (tspice_interrupt_requested()) {
+      return TSPICE_INTERRUPTED;
+    }
+    SpiceDouble lt = 0.0;
+    // `double` and `SpiceDouble` are the same type on every supported platform,
+    // so CSPICE can write straight into the caller-owned output row.
+    spkezr_c(target, (SpiceDouble)ets[i], ref, abcorr, observer, (SpiceDouble *)&outStates6n[(size_t)i * 6], &lt);
+    if (failed_c()) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    if (outLts) {
+      outLts[i] = (double)lt;
+    }
+  }
+
+  return 0;
+}
+
+int tspice_spkpos_batch(
+    const char *target,
+    const double *ets,
+    int n,
+    const char *ref,
+    const char *abcorr,
+    const char *observer,
+    double *outPos3n,
+    double *outLts,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (n < 0) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spkpos_batch(): n must be >= 0");
+  }
+  if (n > 0 && (!ets || !outPos3n)) {
+    return tspice_ephemeris_invalid_arg(
+        err,
+        errMaxBytes,
+        "tspice_spkpos_batch(): ets and outPos3n must not be NULL when n > 0");
+  }
+
+  for (int i = 0; i < n; i++) {
+    if (tspice_interrupt_requested()) {
+      return TSPICE_INTERRUPTED;
+    }
+    SpiceDouble lt = 0.0;
+    spkpos_c(target, (SpiceDouble)ets[i], ref, abcorr, observer, (SpiceDouble *)&outPos3n[(size_t)i * 3], &lt);
+    if (failed_c()) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    if (outLts) {
+      outLts[i] = (double)lt;
+    }
+  }
+
+  return 0;
+}
+
 int tspice_spkez(
     int target,
     double et,
@@ -161,8 +407,8 @@ int tspice_spkez(
 
   SpiceInt targ = 0;
   SpiceInt obs = 0;
-  if (tspice_int_to_spice_int_checked(target, &targ, "tspice_spkez()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(observer, &obs, "tspice_spkez()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(target, &targ, "tspice_spkez()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(observer, &obs, "tspice_spkez()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble state[6];
   SpiceDouble lt = 0.0;
@@ -205,8 +451,8 @@ int tspice_spkezp(
 
   SpiceInt targ = 0;
   SpiceInt obs = 0;
-  if (tspice_int_to_spice_int_checked(target, &targ, "tspice_spkezp()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(observer, &obs, "tspice_spkezp()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(target, &targ, "tspice_spkezp()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(observer, &obs, "tspice_spkezp()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble pos[3];
   SpiceDouble lt = 0.0;
@@ -245,8 +491,8 @@ int tspice_spkgeo(
 
   SpiceInt targ = 0;
   SpiceInt obs = 0;
-  if (tspice_int_to_spice_int_checked(target, &targ, "tspice_spkgeo()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(observer, &obs, "tspice_spkgeo()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(target, &targ, "tspice_spkgeo()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(observer, &obs, "tspice_spkgeo()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble state[6];
   SpiceDouble lt = 0.0;
@@ -288,8 +534,8 @@ int tspice_spkgps(
 
   SpiceInt targ = 0;
   SpiceInt obs = 0;
-  if (tspice_int_to_spice_int_checked(target, &targ, "tspice_spkgps()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(observer, &obs, "tspice_spkgps()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(target, &targ, "tspice_spkgps()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(observer, &obs, "tspice_spkgps()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble pos[3];
   SpiceDouble lt = 0.0;
@@ -325,7 +571,7 @@ int tspice_spkssb(
   }
 
   SpiceInt targ = 0;
-  if (tspice_int_to_spice_int_checked(target, &targ, "tspice_spkssb()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(target, &targ, "tspice_spkssb()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble state[6];
   spkssb_c(targ, (SpiceDouble)et, ref, state);
@@ -367,7 +613,7 @@ int tspice_spkcov(
   }
 
   SpiceInt code = 0;
-  if (tspice_int_to_spice_int_checked(idcode, &code, "tspice_spkcov()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(idcode, &code, "tspice_spkcov()", err, errMaxBytes) != 0) return 1;
 
   spkcov_c(spk, code, cover);
   if (failed_c()) {
@@ -454,7 +700,7 @@ int tspice_spksfs(
   }
 
   SpiceInt b = 0;
-  if (tspice_int_to_spice_int_checked(body, &b, "tspice_spksfs()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(body, &b, "tspice_spksfs()", err, errMaxBytes) != 0) return 1;
 
   SpiceInt handle = 0;
   SpiceDouble descr[5];
@@ -475,7 +721,7 @@ int tspice_spksfs(
   }
 
   if (outHandle) {
-    if (tspice_spice_int_to_int_checked(handle, outHandle, "tspice_spksfs()", err, errMaxBytes) != 0) {
+    if (tspice_ephemeris_spice_int_to_int_checked(handle, outHandle, "tspice_spksfs()", err, errMaxBytes) != 0) {
       return 1;
     }
   }
@@ -516,9 +762,9 @@ int tspice_spkpds(
   SpiceInt b = 0;
   SpiceInt c = 0;
   SpiceInt t = 0;
-  if (tspice_int_to_spice_int_checked(body, &b, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(center, &c, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(type, &t, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(body, &b, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(center, &c, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(type, &t, "tspice_spkpds()", err, errMaxBytes) != 0) return 1;
 
   SpiceDouble descr[5];
   spkpds_c(b, c, frame, t, (SpiceDouble)first, (SpiceDouble)last, descr);
@@ -576,16 +822,16 @@ int tspice_spkuds(
   }
 
   if (outBody) {
-    if (tspice_spice_int_to_int_checked(body, outBody, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(body, outBody, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
   if (outCenter) {
-    if (tspice_spice_int_to_int_checked(center, outCenter, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(center, outCenter, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
   if (outFrame) {
-    if (tspice_spice_int_to_int_checked(frame, outFrame, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(frame, outFrame, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
   if (outType) {
-    if (tspice_spice_int_to_int_checked(type, outType, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(type, outType, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
   if (outFirst) {
     *outFirst = (double)first;
@@ -594,10 +840,10 @@ int tspice_spkuds(
     *outLast = (double)last;
   }
   if (outBaddr) {
-    if (tspice_spice_int_to_int_checked(baddrs, outBaddr, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(baddrs, outBaddr, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
   if (outEaddr) {
-    if (tspice_spice_int_to_int_checked(eaddrs, outEaddr, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
+    if (tspice_ephemeris_spice_int_to_int_checked(eaddrs, outEaddr, "tspice_spkuds()", err, errMaxBytes) != 0) return 1;
   }
 
   return 0;
@@ -635,7 +881,7 @@ int tspice_spkopn(
   }
 
   SpiceInt ncomchC = 0;
-  if (tspice_int_to_spice_int_checked(ncomch, &ncomchC, "tspice_spkopn(ncomch)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(ncomch, &ncomchC, "tspice_spkopn(ncomch)", err, errMaxBytes) != 0) return 1;
 
   SpiceInt handleC = 0;
   spkopn_c(path, ifname, ncomchC, &handleC);
@@ -644,7 +890,7 @@ int tspice_spkopn(
     return 1;
   }
 
-  if (tspice_spice_int_to_int_checked(handleC, outHandle, "tspice_spkopn(outHandle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_spice_int_to_int_checked(handleC, outHandle, "tspice_spkopn(outHandle)", err, errMaxBytes) != 0) return 1;
   return 0;
 }
 
@@ -672,7 +918,7 @@ int tspice_spkopa(const char *path, int *outHandle, char *err, int errMaxBytes)
     return 1;
   }
 
-  if (tspice_spice_int_to_int_checked(handleC, outHandle, "tspice_spkopa(outHandle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_spice_int_to_int_checked(handleC, outHandle, "tspice_spkopa(outHandle)", err, errMaxBytes) != 0) return 1;
   return 0;
 }
 
@@ -684,7 +930,7 @@ int tspice_spkcls(int handle, char *err, int errMaxBytes) {
   }
 
   SpiceInt handleC = 0;
-  if (tspice_int_to_spice_int_checked(handle, &handleC, "tspice_spkcls(handle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(handle, &handleC, "tspice_spkcls(handle)", err, errMaxBytes) != 0) return 1;
 
   spkcls_c(handleC);
   if (failed_c()) {
@@ -781,11 +1027,11 @@ int tspice_spkw08_v2(
   SpiceInt degreeC = 0;
   SpiceInt nC = 0;
 
-  if (tspice_int_to_spice_int_checked(handle, &handleC, "tspice_spkw08_v2(handle)", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(body, &bodyC, "tspice_spkw08_v2(body)", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(center, &centerC, "tspice_spkw08_v2(center)", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(degree, &degreeC, "tspice_spkw08_v2(degree)", err, errMaxBytes) != 0) return 1;
-  if (tspice_int_to_spice_int_checked(n, &nC, "tspice_spkw08_v2(n)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(handle, &handleC, "tspice_spkw08_v2(handle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(body, &bodyC, "tspice_spkw08_v2(body)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(center, &centerC, "tspice_spkw08_v2(center)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(degree, &degreeC, "tspice_spkw08_v2(degree)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(n, &nC, "tspice_spkw08_v2(n)", err, errMaxBytes) != 0) return 1;
 
   // Interpret `states6n` as an array of `n` 6-vectors.
   const SpiceDouble(*states)[6] = (const SpiceDouble(*)[6])states6n;
@@ -811,3 +1057,269 @@ int tspice_spkw08_v2(
 
   return 0;
 }
+
+// Shared argument checks for the spkw09/12/13 wrappers below.
+static int tspice_spkw_check_args(
+    const char *fn,
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    SpiceInt *outHandle,
+    SpiceInt *outBody,
+    SpiceInt *outCenter,
+    SpiceInt *outDegree,
+    SpiceInt *outN,
+    char *err,
+    int errMaxBytes) {
+  char msg[160];
+
+  if (!frame || frame[0] == '\0') {
+    snprintf(msg, sizeof(msg), "%s(): frame must be a non-empty string", fn);
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, msg);
+  }
+  if (!segid || segid[0] == '\0') {
+    snprintf(msg, sizeof(msg), "%s(): segid must be a non-empty string", fn);
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, msg);
+  }
+  if (n <= 0) {
+    snprintf(msg, sizeof(msg), "%s(): n must be > 0", fn);
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, msg);
+  }
+  if (n > 2147483647 / 6) {
+    snprintf(msg, sizeof(msg), "%s(): 6*n would overflow int", fn);
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, msg);
+  }
+  if (!states6n) {
+    snprintf(msg, sizeof(msg), "%s(): states6n must not be NULL", fn);
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, msg);
+  }
+
+  if (tspice_ephemeris_int_to_spice_int_checked(handle, outHandle, "spkw(handle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(body, outBody, "spkw(body)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(center, outCenter, "spkw(center)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(degree, outDegree, "spkw(degree)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(n, outN, "spkw(n)", err, errMaxBytes) != 0) return 1;
+  return 0;
+}
+
+int tspice_spkw09(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    const double *epochs,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  SpiceInt handleC = 0;
+  SpiceInt bodyC = 0;
+  SpiceInt centerC = 0;
+  SpiceInt degreeC = 0;
+  SpiceInt nC = 0;
+  if (tspice_spkw_check_args(
+          "tspice_spkw09", handle, body, center, frame, segid, degree, n, states6n,
+          &handleC, &bodyC, &centerC, &degreeC, &nC, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (!epochs) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spkw09(): epochs must not be NULL");
+  }
+
+  spkw09_c(
+      handleC,
+      bodyC,
+      centerC,
+      frame,
+      (SpiceDouble)first,
+      (SpiceDouble)last,
+      segid,
+      degreeC,
+      nC,
+      (const SpiceDouble(*)[6])states6n,
+      (const SpiceDouble *)epochs);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
+
+int tspice_spkw12(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    double epoch1,
+    double step,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  SpiceInt handleC = 0;
+  SpiceInt bodyC = 0;
+  SpiceInt centerC = 0;
+  SpiceInt degreeC = 0;
+  SpiceInt nC = 0;
+  if (tspice_spkw_check_args(
+          "tspice_spkw12", handle, body, center, frame, segid, degree, n, states6n,
+          &handleC, &bodyC, &centerC, &degreeC, &nC, err, errMaxBytes) != 0) {
+    return 1;
+  }
+
+  spkw12_c(
+      handleC,
+      bodyC,
+      centerC,
+      frame,
+      (SpiceDouble)first,
+      (SpiceDouble)last,
+      segid,
+      degreeC,
+      nC,
+      (const SpiceDouble(*)[6])states6n,
+      (SpiceDouble)epoch1,
+      (SpiceDouble)step);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
+
+int tspice_spkw13(
+    int handle,
+    int body,
+    int center,
+    const char *frame,
+    double first,
+    double last,
+    const char *segid,
+    int degree,
+    int n,
+    const double *states6n,
+    const double *epochs,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  SpiceInt handleC = 0;
+  SpiceInt bodyC = 0;
+  SpiceInt centerC = 0;
+  SpiceInt degreeC = 0;
+  SpiceInt nC = 0;
+  if (tspice_spkw_check_args(
+          "tspice_spkw13", handle, body, center, frame, segid, degree, n, states6n,
+          &handleC, &bodyC, &centerC, &degreeC, &nC, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (!epochs) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spkw13(): epochs must not be NULL");
+  }
+
+  spkw13_c(
+      handleC,
+      bodyC,
+      centerC,
+      frame,
+      (SpiceDouble)first,
+      (SpiceDouble)last,
+      segid,
+      degreeC,
+      nC,
+      (const SpiceDouble(*)[6])states6n,
+      (const SpiceDouble *)epochs);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
+
+int tspice_spksub(
+    int handle,
+    const double *dc2,
+    const int *ic6,
+    const char *ident,
+    double begin,
+    double end,
+    int newHandle,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+
+  if (!dc2 || !ic6) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spksub(): dc2 and ic6 must not be NULL");
+  }
+  if (!ident) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spksub(): ident must not be NULL");
+  }
+  if (!(begin <= end)) {
+    return tspice_ephemeris_invalid_arg(err, errMaxBytes, "tspice_spksub(): begin must be <= end");
+  }
+
+  SpiceInt handleC = 0;
+  SpiceInt newHandleC = 0;
+  if (tspice_ephemeris_int_to_spice_int_checked(handle, &handleC, "tspice_spksub(handle)", err, errMaxBytes) != 0) return 1;
+  if (tspice_ephemeris_int_to_spice_int_checked(newHandle, &newHandleC, "tspice_spksub(newHandle)", err, errMaxBytes) != 0) return 1;
+
+  SpiceDouble dc[2] = {(SpiceDouble)dc2[0], (SpiceDouble)dc2[1]};
+  SpiceInt ic[6];
+  for (int i = 0; i < 6; i++) {
+    ic[i] = (SpiceInt)ic6[i];
+  }
+
+  SpiceDouble descr[5];
+  dafps_c(2, 6, dc, ic, descr);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  spksub_c(handleC, descr, ident, (SpiceDouble)begin, (SpiceDouble)end, newHandleC);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
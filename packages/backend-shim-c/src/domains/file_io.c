@@ -1,3 +1,7 @@
+#if defined(__linux__) && !defined(__EMSCRIPTEN__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "tspice_backend_shim.h"
 #include "tspice_error.h"
 
@@ -10,6 +14,15 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TSPICE_HAVE_DAF_MMAP 1
+#endif
+
 // --- ABI guard ---------------------------------------------------------
 //
 // This shim intentionally exposes 32-bit integers for DLA descriptor fields
@@ -21,7 +34,226 @@ _Static_assert(sizeof(SpiceInt) == 4, "tspice_backend_shim requires sizeof(Spice
 typedef char tspice_spiceint_must_be_32bit[(sizeof(SpiceInt) == 4) ? 1 : -1];
 #endif
 
+// --- DAF mmap read path -------------------------------------------------
+//
+// Optional read path for `tspice_dafgda`. Files opened via `tspice_dafopr` are
+// remembered by handle and, when mmap mode is on, mapped read-only on first
+// access so word reads become pointer arithmetic (and the pages are shared with
+// other processes through the OS page cache).
+//
+// Only files in the host's native binary format are mapped. Anything else, and
+// every platform without mmap (WASM), goes through `dafgda_c`.
+
+#define TSPICE_DAF_MAP_SLOTS 64
+#define TSPICE_DAF_FILE_RECORD_BYTES 1024
+
+typedef struct {
+  int handle;                 // 0 = free slot
+  int refs;                   // dafopr/dafcls nesting (CSPICE reuses the handle)
+  char *path;                 // owned copy of the dafopr path
+  const unsigned char *base;  // NULL until mapped
+  size_t length;
+  int unmappable;             // set once a map attempt is rejected
+} tspice_daf_map_entry;
+
+static tspice_daf_map_entry tspice_daf_maps[TSPICE_DAF_MAP_SLOTS];
+static int tspice_daf_mmap_on = 0;
+
+static tspice_daf_map_entry *tspice_daf_map_find(int handle) {
+  if (handle == 0) return NULL;
+  for (int i = 0; i < TSPICE_DAF_MAP_SLOTS; i++) {
+    if (tspice_daf_maps[i].handle == handle) return &tspice_daf_maps[i];
+  }
+  return NULL;
+}
+
+static void tspice_daf_map_unmap(tspice_daf_map_entry *entry) {
+#if defined(TSPICE_HAVE_DAF_MMAP)
+  if (entry->base) {
+    munmap((void *)entry->base, entry->length);
+  }
+#endif
+  entry->base = NULL;
+  entry->length = 0;
+  entry->unmappable = 0;
+}
+
+static void tspice_daf_map_track(int handle, const char *path) {
+  tspice_daf_map_entry *entry = tspice_daf_map_find(handle);
+  if (entry) {
+    entry->refs++;
+    return;
+  }
+
+  for (int i = 0; i < TSPICE_DAF_MAP_SLOTS; i++) {
+    if (tspice_daf_maps[i].handle != 0) continue;
+
+    const size_t n = strlen(path);
+    char *copy = (char *)malloc(n + 1);
+    // Tracking is best-effort: an untracked handle simply reads via dafgda_c.
+    if (!copy) return;
+    memcpy(copy, path, n + 1);
+
+    tspice_daf_maps[i].handle = handle;
+    tspice_daf_maps[i].refs = 1;
+    tspice_daf_maps[i].path = copy;
+    tspice_daf_maps[i].base = NULL;
+    tspice_daf_maps[i].length = 0;
+    tspice_daf_maps[i].unmappable = 0;
+    return;
+  }
+}
+
+static void tspice_daf_map_untrack(int handle) {
+  tspice_daf_map_entry *entry = tspice_daf_map_find(handle);
+  if (!entry || --entry->refs > 0) return;
+
+  tspice_daf_map_unmap(entry);
+  free(entry->path);
+  memset(entry, 0, sizeof(*entry));
+}
+
+#if defined(TSPICE_HAVE_DAF_MMAP)
+// Map `entry->path` if it is a DAF in the host's binary file format.
+static int tspice_daf_map_ensure(tspice_daf_map_entry *entry) {
+  if (entry->base) return 1;
+  if (entry->unmappable) return 0;
+  entry->unmappable = 1;
+
+  const int fd = open(entry->path, O_RDONLY);
+  if (fd < 0) return 0;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < TSPICE_DAF_FILE_RECORD_BYTES) {
+    close(fd);
+    return 0;
+  }
+
+  void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) return 0;
+
+  // File record: IDWORD at bytes 0..7, binary file format id at 88..95.
+  const uint16_t probe = 1;
+  const char *nativeBff = (*(const unsigned char *)&probe == 1) ? "LTL-IEEE" : "BIG-IEEE";
+  const unsigned char *rec = (const unsigned char *)base;
+  if (memcmp(rec, "DAF/", 4) != 0 || memcmp(rec + 88, nativeBff, 8) != 0) {
+    munmap(base, (size_t)st.st_size);
+    return 0;
+  }
+
+#if defined(MADV_RANDOM)
+  // Segment lookups jump around; don't let readahead pull in whole files.
+  (void)madvise(base, (size_t)st.st_size, MADV_RANDOM);
+#endif
+
+  entry->base = rec;
+  entry->length = (size_t)st.st_size;
+  entry->unmappable = 0;
+  return 1;
+}
+#endif
+
+int tspice_daf_mmap_supported(void) {
+#if defined(TSPICE_HAVE_DAF_MMAP)
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int tspice_daf_mmap_enabled(void) {
+  return tspice_daf_mmap_on;
+}
+
+void tspice_daf_mmap_set_enabled(int enabled) {
+  tspice_daf_mmap_on = (enabled != 0 && tspice_daf_mmap_supported()) ? 1 : 0;
+  if (!tspice_daf_mmap_on) {
+    for (int i = 0; i < TSPICE_DAF_MAP_SLOTS; i++) {
+      if (tspice_daf_maps[i].handle != 0) tspice_daf_map_unmap(&tspice_daf_maps[i]);
+    }
+  }
+}
+
+// --- Output file maps ---------------------------------------------------
+
+static int tspice_output_map_error(char *err, int errMaxBytes, const char *msg) {
+  tspice_clear_last_error_buffers();
+  if (err && errMaxBytes > 0) {
+    strncpy(err, msg, (size_t)errMaxBytes - 1);
+    err[errMaxBytes - 1] = '\0';
+  }
+  return 1;
+}
+
+int tspice_output_map_supported(void) {
+  return tspice_daf_mmap_supported();
+}
+
+int tspice_map_output_file(
+    const char *path,
+    void **outBase,
+    size_t *outLength,
+    char *err,
+    int errMaxBytes) {
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outBase) *outBase = NULL;
+  if (outLength) *outLength = 0;
+
+  if (!path || path[0] == '\0' || !outBase || !outLength) {
+    return tspice_output_map_error(
+        err, errMaxBytes, "tspice_map_output_file(): path, outBase and outLength are required");
+  }
+
+#if defined(TSPICE_HAVE_DAF_MMAP)
+  char buf[200];
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    snprintf(buf, sizeof(buf), "tspice_map_output_file(): open failed (errno=%d)", errno);
+    return tspice_output_map_error(err, errMaxBytes, buf);
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    snprintf(buf, sizeof(buf), "tspice_map_output_file(): fstat failed (errno=%d)", errno);
+    close(fd);
+    return tspice_output_map_error(err, errMaxBytes, buf);
+  }
+
+  void *base = NULL;
+  if (st.st_size > 0) {
+    // Private and writable: callers hand the pages to code that may write to them, and those
+    // writes must never reach the file.
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED) {
+      snprintf(buf, sizeof(buf), "tspice_map_output_file(): mmap failed (errno=%d)", errno);
+      close(fd);
+      return tspice_output_map_error(err, errMaxBytes, buf);
+    }
+  }
+  close(fd);
+
+  *outBase = base;
+  *outLength = (size_t)st.st_size;
+  return 0;
+#else
+  return tspice_output_map_error(
+      err, errMaxBytes, "tspice_map_output_file(): memory-mapped outputs are not supported on this platform");
+#endif
+}
 
+void tspice_unmap_output_file(void *base, size_t length) {
+#if defined(TSPICE_HAVE_DAF_MMAP)
+  if (base && length > 0) {
+    munmap(base, length);
+  }
+#else
+  (void)base;
+  (void)length;
+#endif
+}
 
 static void tspice_write_dla_descr8(const SpiceDLADescr *descr, int32_t *outDescr8) {
   if (!descr || !outDescr8) return;
@@ -125,6 +357,7 @@ int tspice_dafopr(const char *path, int *outHandle, char *err, int errMaxBytes)
   }
 
   if (outHandle) *outHandle = (int)handleC;
+  tspice_daf_map_track((int)handleC, path);
   return 0;
 }
 
@@ -137,6 +370,7 @@ int tspice_dafcls(int handle, char *err, int errMaxBytes) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
     return 1;
   }
+  tspice_daf_map_untrack(handle);
   return 0;
 }
 
@@ -179,6 +413,141 @@ int tspice_daffna(int handle, int *outFound, char *err, int errMaxBytes) {
   return 0;
 }
 
+int tspice_dafgsu(
+    int handle,
+    int nd,
+    int ni,
+    double *outDc,
+    int *outIc,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) err[0] = '\0';
+
+  if (!outDc || !outIc) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgsu: outDc and outIc must be non-NULL");
+  }
+  // DAF summaries hold at most 125 double-precision words.
+  if (nd < 0 || ni < 2 || nd > 124 || ni > 250) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgsu: expected 0 <= nd <= 124 and 2 <= ni <= 250");
+  }
+
+  dafcs_c((SpiceInt)handle);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  SpiceDouble sum[125];
+  dafgs_c(sum);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  SpiceInt icC[250];
+  dafus_c(sum, (SpiceInt)nd, (SpiceInt)ni, outDc, icC);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  for (int i = 0; i < ni; i++) {
+    outIc[i] = (int)icC[i];
+  }
+  return 0;
+}
+
+int tspice_dafhsf(int handle, int *outNd, int *outNi, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) err[0] = '\0';
+
+  if (!outNd || !outNi) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafhsf: outNd and outNi must be non-NULL");
+  }
+
+  SpiceInt nd = 0;
+  SpiceInt ni = 0;
+  dafhsf_c((SpiceInt)handle, &nd, &ni);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  *outNd = (int)nd;
+  *outNi = (int)ni;
+  return 0;
+}
+
+int tspice_dafgn(int handle, char *outName, int outNameMaxBytes, char *err, int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) err[0] = '\0';
+
+  if (!outName || outNameMaxBytes < 2) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgn: outName must hold at least 2 bytes");
+  }
+  outName[0] = '\0';
+
+  dafcs_c((SpiceInt)handle);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  dafgn_c((SpiceInt)outNameMaxBytes, outName);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+  return 0;
+}
+
+int tspice_dafgda(
+    int handle,
+    int baddr,
+    int eaddr,
+    double *outData,
+    int outLen,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) err[0] = '\0';
+
+  if (!outData) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgda: outData must be non-NULL");
+  }
+  if (baddr < 1 || eaddr < baddr) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgda: expected 1 <= baddr <= eaddr");
+  }
+  const size_t count = (size_t)eaddr - (size_t)baddr + 1;
+  if (outLen < 0 || (size_t)outLen < count) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dafgda: outLen must be >= eaddr - baddr + 1");
+  }
+
+#if defined(TSPICE_HAVE_DAF_MMAP)
+  if (tspice_daf_mmap_on) {
+    tspice_daf_map_entry *entry = tspice_daf_map_find(handle);
+    if (entry && tspice_daf_map_ensure(entry)) {
+      // DAF addresses are 1-based double-precision words from the start of the file.
+      const size_t begin = ((size_t)baddr - 1) * sizeof(double);
+      const size_t end = (size_t)eaddr * sizeof(double);
+      if (end <= entry->length) {
+        memcpy(outData, entry->base + begin, end - begin);
+        return 0;
+      }
+      // Out-of-range: let dafgda_c produce the canonical SPICE error.
+    }
+  }
+#endif
+
+  dafgda_c((SpiceInt)handle, (SpiceInt)baddr, (SpiceInt)eaddr, outData);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+  return 0;
+}
+
 int tspice_dasopr(const char *path, int *outHandle, char *err, int errMaxBytes) {
   tspice_init_cspice_error_handling_once();
   if (err && errMaxBytes > 0) err[0] = '\0';
@@ -593,3 +962,101 @@ int tspice_dskw02(
 
   return 0;
 }
+
+int tspice_dsk_write_type2(
+    int handle,
+    int center,
+    int surfid,
+    int dclass,
+    const char *frame,
+    int corsys,
+    const double *corpar,
+    const double *bounds8,
+    int nv,
+    const double *vrtces,
+    int np,
+    const int32_t *plates,
+    double finscl,
+    int corscl,
+    int worksz,
+    int voxpsz,
+    int voxlsz,
+    int makvtl,
+    int spxisz,
+    int32_t *work,
+    int32_t *spaixi,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+  if (err && errMaxBytes > 0) err[0] = '\0';
+
+  if (!frame || frame[0] == '\0') {
+    return tspice_return_error(err, errMaxBytes, "tspice_dsk_write_type2: frame must be a non-empty string");
+  }
+  if (!corpar || !bounds8) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dsk_write_type2: corpar and bounds8 must be non-NULL");
+  }
+  if (nv <= 0 || np <= 0 || !vrtces || !plates) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dsk_write_type2: expected at least one vertex and one plate");
+  }
+  if (worksz <= 0 || voxpsz < 0 || voxlsz < 0 || spxisz < SPICE_DSK02_IXIFIX) {
+    return tspice_return_error(
+        err, errMaxBytes, "tspice_dsk_write_type2: expected worksz > 0, voxpsz/voxlsz >= 0, spxisz >= SPICE_DSK02_IXIFIX");
+  }
+  if (!work || !spaixi) {
+    return tspice_return_error(err, errMaxBytes, "tspice_dsk_write_type2: work and spaixi must be non-NULL");
+  }
+
+  SpiceDouble spaixd[SPICE_DSK02_IXDFIX];
+
+  dskmi2_c(
+      (SpiceInt)nv,
+      (SpiceDouble(*)[3])vrtces,
+      (SpiceInt)np,
+      (SpiceInt(*)[3])plates,
+      (SpiceDouble)finscl,
+      (SpiceInt)corscl,
+      (SpiceInt)worksz,
+      (SpiceInt)voxpsz,
+      (SpiceInt)voxlsz,
+      makvtl ? SPICETRUE : SPICEFALSE,
+      (SpiceInt)spxisz,
+      (SpiceInt(*)[2])work,
+      spaixd,
+      (SpiceInt *)spaixi);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  dskw02_c(
+      (SpiceInt)handle,
+      (SpiceInt)center,
+      (SpiceInt)surfid,
+      (SpiceInt)dclass,
+      frame,
+      (SpiceInt)corsys,
+      corpar,
+      (SpiceDouble)bounds8[0],
+      (SpiceDouble)bounds8[1],
+      (SpiceDouble)bounds8[2],
+      (SpiceDouble)bounds8[3],
+      (SpiceDouble)bounds8[4],
+      (SpiceDouble)bounds8[5],
+      (SpiceDouble)bounds8[6],
+      (SpiceDouble)bounds8[7],
+      (SpiceInt)nv,
+      (SpiceDouble(*)[3])vrtces,
+      (SpiceInt)np,
+      (SpiceInt(*)[3])plates,
+      spaixd,
+      (SpiceInt *)spaixi);
+
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  return 0;
+}
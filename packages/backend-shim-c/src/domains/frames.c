@@ -6,6 +6,7 @@
 
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static int tspice_frames_invalid_arg(char *err, int errMaxBytes, const char *msg) {
@@ -108,6 +109,139 @@ int tspice_frmnam(
   return 0;
 }
 
+// Built-in frames are a fixed set of a few hundred; kernel-pool frames grow on
+// demand up to this many.
+#define TSPICE_FRAME_TABLE_INITIAL_SIZE 1024
+#define TSPICE_FRAME_TABLE_MAX_SIZE (1 << 22)
+
+// Collect `bltfrm_c(SPICE_FRMTYP_ALL)` (or `kplfrm_c` when `kernelPool`) into a
+// malloc'ed, ascending array. The caller frees `*outIds`.
+static int tspice_collect_frame_ids(
+    int kernelPool,
+    SpiceInt **outIds,
+    SpiceInt *outCount,
+    char *err,
+    int errMaxBytes) {
+  *outIds = NULL;
+  *outCount = 0;
+
+  for (SpiceInt size = TSPICE_FRAME_TABLE_INITIAL_SIZE;; size *= 2) {
+    SpiceInt *storage = (SpiceInt *)malloc((size_t)(SPICE_CELL_CTRLSZ + size) * sizeof(SpiceInt));
+    if (!storage) {
+      return tspice_frames_invalid_arg(err, errMaxBytes, "tspice_frame_table(): allocation failed");
+    }
+
+    // Same layout as `SPICEINT_CELL`; CSPICE initializes the control area on first use.
+    SpiceCell ids = {
+        SPICE_INT, 0, size, 0, SPICETRUE, SPICEFALSE, SPICEFALSE, storage, storage + SPICE_CELL_CTRLSZ};
+    if (kernelPool) {
+      kplfrm_c(SPICE_FRMTYP_ALL, &ids);
+    } else {
+      bltfrm_c(SPICE_FRMTYP_ALL, &ids);
+    }
+
+    if (!failed_c()) {
+      *outCount = card_c(&ids);
+      memmove(storage, storage + SPICE_CELL_CTRLSZ, (size_t)*outCount * sizeof(SpiceInt));
+      *outIds = storage;
+      return 0;
+    }
+
+    free(storage);
+    SpiceChar shortMsg[42];
+    getmsg_c("SHORT", (SpiceInt)sizeof(shortMsg), shortMsg);
+    if (strstr(shortMsg, "TOOSMALL") == NULL || size >= TSPICE_FRAME_TABLE_MAX_SIZE) {
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    reset_c();
+    tspice_clear_last_error_buffers();
+  }
+}
+
+int tspice_frame_table(
+    int room,
+    int *outCodes,
+    char *outNames,
+    int nameMaxBytes,
+    int *outTotal,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outTotal) {
+    *outTotal = 0;
+  }
+
+  if (room < 0) {
+    return tspice_frames_invalid_arg(err, errMaxBytes, "tspice_frame_table(): room must be >= 0");
+  }
+  if (room > 0 && (!outCodes || !outNames || nameMaxBytes < TSPICE_FRNAME_MAX_BYTES)) {
+    return tspice_frames_invalid_arg(
+        err,
+        errMaxBytes,
+        "tspice_frame_table(): output buffers are required and names need TSPICE_FRNAME_MAX_BYTES per entry");
+  }
+
+  SpiceInt *builtin = NULL;
+  SpiceInt *pool = NULL;
+  SpiceInt nBuiltin = 0;
+  SpiceInt nPool = 0;
+  if (tspice_collect_frame_ids(0, &builtin, &nBuiltin, err, errMaxBytes) != 0) {
+    return 1;
+  }
+  if (tspice_collect_frame_ids(1, &pool, &nPool, err, errMaxBytes) != 0) {
+    free(builtin);
+    return 1;
+  }
+
+  // Both sets are ascending; merge them (a kernel frame may reuse a built-in ID).
+  int total = 0;
+  SpiceInt i = 0;
+  SpiceInt j = 0;
+  while (i < nBuiltin || j < nPool) {
+    SpiceInt code;
+    if (j >= nPool || (i < nBuiltin && builtin[i] < pool[j])) {
+      code = builtin[i++];
+    } else if (i >= nBuiltin || pool[j] < builtin[i]) {
+      code = pool[j++];
+    } else {
+      code = builtin[i++];
+      j++;
+    }
+
+    SpiceChar name[TSPICE_FRNAME_MAX_BYTES];
+    frmnam_c(code, (SpiceInt)sizeof(name), name);
+    if (failed_c()) {
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      free(builtin);
+      free(pool);
+      return 1;
+    }
+    if (name[0] == '\0') {
+      // IDs whose definition does not name the frame.
+      continue;
+    }
+
+    if (total < room) {
+      outCodes[total] = (int)code;
+      char *dst = outNames + (size_t)total * (size_t)nameMaxBytes;
+      memcpy(dst, name, sizeof(name));
+    }
+    total++;
+  }
+
+  free(builtin);
+  free(pool);
+  if (outTotal) {
+    *outTotal = total;
+  }
+  return 0;
+}
+
 int tspice_cidfrm(
     int center,
     int *outFrcode,
@@ -418,6 +552,78 @@ int tspice_sxform(
   return 0;
 }
 
+typedef int (*tspice_frame_xform_fn)(const char *, const char *, double, double *, char *, int);
+
+static int tspice_frame_xform_batch(
+    const char *name,
+    tspice_frame_xform_fn fn,
+    size_t stride,
+    const char *from,
+    const char *to,
+    const double *ets,
+    int n,
+    double *outMatrices,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (n < 0) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s(): n must be >= 0", name);
+    return tspice_frames_invalid_arg(err, errMaxBytes, buf);
+  }
+  if (n > 0 && (!ets || !outMatrices)) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s(): ets and outMatrices must not be NULL when n > 0", name);
+    return tspice_frames_invalid_arg(err, errMaxBytes, buf);
+  }
+
+  for (int i = 0; i < n; i++) {
+    if (fn(from, to, ets[i], &outMatrices[(size_t)i * stride], err, errMaxBytes) != 0) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int tspice_pxform_batch(
+    const char *from,
+    const char *to,
+    const double *ets,
+    int n,
+    double *outMatrices9n,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  return tspice_frame_xform_batch(
+      "tspice_pxform_batch", tspice_pxform, 9, from, to, ets, n, outMatrices9n, outFailedIndex, err, errMaxBytes);
+}
+
+int tspice_sxform_batch(
+    const char *from,
+    const char *to,
+    const double *ets,
+    int n,
+    double *outMatrices36n,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  return tspice_frame_xform_batch(
+      "tspice_sxform_batch", tspice_sxform, 36, from, to, ets, n, outMatrices36n, outFailedIndex, err, errMaxBytes);
+}
+
 int tspice_ckgp(
     int inst,
     double sclkdp,
@@ -559,6 +765,128 @@ int tspice_ckgpav(
   return 0;
 }
 
+// Shared body of tspice_ckgp_batch / tspice_ckgpav_batch: `outAvs3n == NULL` selects ckgp_c.
+static int tspice_ck_pointing_batch(
+    const char *name,
+    int inst,
+    const double *sclkdps,
+    int n,
+    double tol,
+    const char *ref,
+    double *outCmats9n,
+    double *outAvs3n,
+    double *outClkouts,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (n < 0) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s(): n must be >= 0", name);
+    return tspice_frames_invalid_arg(err, errMaxBytes, buf);
+  }
+  if (n > 0 && (!sclkdps || !ref || !outCmats9n || !outClkouts || !outFoundBits)) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s(): input and output buffers must not be NULL when n > 0", name);
+    return tspice_frames_invalid_arg(err, errMaxBytes, buf);
+  }
+  if (n == 0) {
+    return 0;
+  }
+
+  memset(outFoundBits, 0, ((size_t)n + 7) / 8);
+  for (int i = 0; i < n; i++) {
+    SpiceDouble cmat[3][3];
+    SpiceDouble av[3] = {0.0, 0.0, 0.0};
+    SpiceDouble clkout = 0.0;
+    SpiceBoolean found = SPICEFALSE;
+    if (outAvs3n) {
+      ckgpav_c((SpiceInt)inst, (SpiceDouble)sclkdps[i], (SpiceDouble)tol, ref, cmat, av, &clkout, &found);
+    } else {
+      ckgp_c((SpiceInt)inst, (SpiceDouble)sclkdps[i], (SpiceDouble)tol, ref, cmat, &clkout, &found);
+    }
+    if (failed_c()) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+
+    double *outCmat = &outCmats9n[(size_t)i * 9];
+    if (found == SPICETRUE) {
+      for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+          outCmat[r * 3 + c] = (double)cmat[r][c];
+        }
+      }
+      outClkouts[i] = (double)clkout;
+      outFoundBits[i / 8] |= (unsigned char)(1u << (i % 8));
+    } else {
+      memset(outCmat, 0, 9 * sizeof(double));
+      outClkouts[i] = 0.0;
+    }
+    if (outAvs3n) {
+      double *outAv = &outAvs3n[(size_t)i * 3];
+      outAv[0] = found == SPICETRUE ? (double)av[0] : 0.0;
+      outAv[1] = found == SPICETRUE ? (double)av[1] : 0.0;
+      outAv[2] = found == SPICETRUE ? (double)av[2] : 0.0;
+    }
+  }
+  return 0;
+}
+
+int tspice_ckgp_batch(
+    int inst,
+    const double *sclkdps,
+    int n,
+    double tol,
+    const char *ref,
+    double *outCmats9n,
+    double *outClkouts,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  return tspice_ck_pointing_batch(
+      "tspice_ckgp_batch", inst, sclkdps, n, tol, ref, outCmats9n, NULL, outClkouts, outFoundBits, outFailedIndex,
+      err, errMaxBytes);
+}
+
+int tspice_ckgpav_batch(
+    int inst,
+    const double *sclkdps,
+    int n,
+    double tol,
+    const char *ref,
+    double *outCmats9n,
+    double *outAvs3n,
+    double *outClkouts,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  if (n > 0 && !outAvs3n) {
+    if (outFailedIndex) {
+      *outFailedIndex = -1;
+    }
+    return tspice_frames_invalid_arg(
+        err, errMaxBytes, "tspice_ckgpav_batch(): input and output buffers must not be NULL when n > 0");
+  }
+  return tspice_ck_pointing_batch(
+      "tspice_ckgpav_batch", inst, sclkdps, n, tol, ref, outCmats9n, outAvs3n, outClkouts, outFoundBits,
+      outFailedIndex, err, errMaxBytes);
+}
+
 // --- CK file query / management (read-only) --------------------------------
 
 static const char *tspice_frames_dtype_to_string(SpiceDataType dtype) {
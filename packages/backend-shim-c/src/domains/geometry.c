@@ -2,6 +2,11 @@
 
 #include "SpiceUsr.h"
 
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 int tspice_subpnt(
@@ -164,6 +169,196 @@ int tspice_sincpt(
   return 0;
 }
 
+static int tspice_geometry_invalid_arg(char *err, int errMaxBytes, const char *msg) {
+  tspice_clear_last_error_buffers();
+  if (err && errMaxBytes > 0) {
+    strncpy(err, msg, (size_t)errMaxBytes - 1);
+    err[errMaxBytes - 1] = '\0';
+  }
+  return 1;
+}
+
+// Case-insensitive match of `value` against `keyword`, ignoring blanks (how CSPICE compares
+// method and aberration-correction strings).
+static int tspice_geometry_keyword_is(const char *value, const char *keyword) {
+  const char *p = value;
+  const char *k = keyword;
+  for (;;) {
+    while (*p == ' ') p++;
+    if (!*p || !*k) break;
+    if (toupper((unsigned char)*p) != *k) return 0;
+    p++;
+    k++;
+  }
+  return *p == '\0' && *k == '\0';
+}
+
+static void tspice_geometry_set_found_bit(unsigned char *bits, int i, int found) {
+  if (found) {
+    bits[i / 8] |= (unsigned char)(1u << (i % 8));
+  } else {
+    bits[i / 8] &= (unsigned char)~(1u << (i % 8));
+  }
+}
+
+// Geometric ellipsoid intercepts share everything but the ray: the observer position in the
+// body-fixed frame, the `dref` -> `fixref` rotation and the radii are looked up once, then each
+// ray is one `mxv_c` + `surfpt_c`. Returns 0 on success, or -1 when the batch does not qualify or
+// anything fails (the caller then runs `sincpt_c` per ray, which also reports the error).
+static int tspice_sincpt_batch_ellipsoid(
+    const char *method,
+    const char *target,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const char *dref,
+    const double *dirs3n,
+    int n,
+    double *outSpoints3n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    unsigned char *outFoundBits) {
+  if (!tspice_geometry_keyword_is(method, "ELLIPSOID") || !tspice_geometry_keyword_is(abcorr, "NONE")) {
+    return -1;
+  }
+
+  // sincpt_c requires `fixref` to be centered on the target.
+  SpiceInt trgcode = 0;
+  SpiceBoolean found = SPICEFALSE;
+  bods2c_c(target, &trgcode, &found);
+  if (failed_c() || !found) return -1;
+  SpiceInt frcode = 0;
+  namfrm_c(fixref, &frcode);
+  if (failed_c() || frcode == 0) return -1;
+  SpiceInt frcent = 0;
+  SpiceInt frclss = 0;
+  SpiceInt clssid = 0;
+  frinfo_c(frcode, &frcent, &frclss, &clssid, &found);
+  if (failed_c() || !found || frcent != trgcode) return -1;
+
+  SpiceDouble radii[3];
+  SpiceInt dim = 0;
+  bodvrd_c(target, "RADII", 3, &dim, radii);
+  if (failed_c() || dim != 3 || radii[0] <= 0.0 || radii[1] <= 0.0 || radii[2] <= 0.0) return -1;
+
+  SpiceDouble trgpos[3];
+  SpiceDouble lt = 0.0;
+  spkpos_c(target, (SpiceDouble)et, fixref, "NONE", observer, trgpos, &lt);
+  if (failed_c()) return -1;
+  SpiceDouble obspos[3];
+  vminus_c(trgpos, obspos);
+
+  // An observer inside the ellipsoid is an error for sincpt_c.
+  const SpiceDouble level = (obspos[0] / radii[0]) * (obspos[0] / radii[0]) +
+      (obspos[1] / radii[1]) * (obspos[1] / radii[1]) + (obspos[2] / radii[2]) * (obspos[2] / radii[2]);
+  if (level < 1.0) return -1;
+
+  SpiceDouble rot[3][3];
+  pxform_c(dref, fixref, (SpiceDouble)et, rot);
+  if (failed_c()) return -1;
+
+  for (int i = 0; i < n; i++) {
+    const double *dir = &dirs3n[(size_t)i * 3];
+    if (dir[0] == 0.0 && dir[1] == 0.0 && dir[2] == 0.0) return -1;
+
+    SpiceDouble dvec[3] = {(SpiceDouble)dir[0], (SpiceDouble)dir[1], (SpiceDouble)dir[2]};
+    SpiceDouble fixdir[3];
+    mxv_c(rot, dvec, fixdir);
+
+    SpiceDouble *spoint = (SpiceDouble *)&outSpoints3n[(size_t)i * 3];
+    SpiceBoolean hit = SPICEFALSE;
+    surfpt_c(obspos, fixdir, radii[0], radii[1], radii[2], spoint, &hit);
+    if (failed_c()) return -1;
+
+    SpiceDouble *srfvec = (SpiceDouble *)&outSrfvecs3n[(size_t)i * 3];
+    if (hit) {
+      vsub_c(spoint, obspos, srfvec);
+      outTrgepcs[i] = et;
+    } else {
+      spoint[0] = spoint[1] = spoint[2] = 0.0;
+      srfvec[0] = srfvec[1] = srfvec[2] = 0.0;
+      outTrgepcs[i] = 0.0;
+    }
+    tspice_geometry_set_found_bit(outFoundBits, i, hit == SPICETRUE);
+  }
+  return 0;
+}
+
+int tspice_sincpt_batch(
+    const char *method,
+    const char *target,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const char *dref,
+    const double *dirs3n,
+    int n,
+    double *outSpoints3n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    unsigned char *outFoundBits,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (n < 0) {
+    return tspice_geometry_invalid_arg(err, errMaxBytes, "tspice_sincpt_batch(): n must be >= 0");
+  }
+  if (n > 0 && (!dirs3n || !outSpoints3n || !outTrgepcs || !outSrfvecs3n || !outFoundBits)) {
+    return tspice_geometry_invalid_arg(
+        err, errMaxBytes, "tspice_sincpt_batch(): input and output buffers must not be NULL when n > 0");
+  }
+  if (n == 0) {
+    return 0;
+  }
+
+  memset(outFoundBits, 0, ((size_t)n + 7) / 8);
+  if (tspice_sincpt_batch_ellipsoid(
+          method, target, et, fixref, abcorr, observer, dref, dirs3n, n, outSpoints3n, outTrgepcs, outSrfvecs3n,
+          outFoundBits) == 0) {
+    return 0;
+  }
+  if (failed_c()) {
+    reset_c();
+    tspice_clear_last_error_buffers();
+  }
+
+  for (int i = 0; i < n; i++) {
+    SpiceDouble dvec[3] = {
+        (SpiceDouble)dirs3n[(size_t)i * 3], (SpiceDouble)dirs3n[(size_t)i * 3 + 1], (SpiceDouble)dirs3n[(size_t)i * 3 + 2]};
+    SpiceDouble *spoint = (SpiceDouble *)&outSpoints3n[(size_t)i * 3];
+    SpiceDouble *srfvec = (SpiceDouble *)&outSrfvecs3n[(size_t)i * 3];
+    SpiceDouble trgepc = 0.0;
+    SpiceBoolean found = SPICEFALSE;
+    sincpt_c(method, target, (SpiceDouble)et, fixref, abcorr, observer, dref, dvec, spoint, &trgepc, srfvec, &found);
+    if (failed_c()) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    if (!found) {
+      spoint[0] = spoint[1] = spoint[2] = 0.0;
+      srfvec[0] = srfvec[1] = srfvec[2] = 0.0;
+      trgepc = 0.0;
+    }
+    outTrgepcs[i] = (double)trgepc;
+    tspice_geometry_set_found_bit(outFoundBits, i, found == SPICETRUE);
+  }
+  return 0;
+}
+
 int tspice_ilumin(
     const char *method,
     const char *target,
@@ -544,3 +739,338 @@ int tspice_occult(
   }
   return 0;
 }
+
+// Bounding radius for the occultation pre-pass: 0 for `POINT`, the largest semi-axis for
+// `ELLIPSOID`. Returns 0 on success, -1 for any other shape or when the radii are unavailable.
+static int tspice_occult_bounding_radius(const char *target, const char *shape, double *outRadius) {
+  if (tspice_geometry_keyword_is(shape, "POINT")) {
+    *outRadius = 0.0;
+    return 0;
+  }
+  if (!tspice_geometry_keyword_is(shape, "ELLIPSOID")) {
+    return -1;
+  }
+  SpiceDouble radii[3];
+  SpiceInt dim = 0;
+  bodvrd_c(target, "RADII", 3, &dim, radii);
+  if (failed_c() || dim != 3) return -1;
+  *outRadius = fmax(fabs((double)radii[0]), fmax(fabs((double)radii[1]), fabs((double)radii[2])));
+  return 0;
+}
+
+// Index of the (target, observer) pair in `pairs` (2 strings per pair), appending it if new.
+static int tspice_occult_intern_pair(
+    const char *target, const char *observer, const char **pairs, int *nPairs) {
+  for (int i = 0; i < *nPairs; i++) {
+    if (strcmp(pairs[2 * i], target) == 0 && strcmp(pairs[2 * i + 1], observer) == 0) return i;
+  }
+  pairs[2 * *nPairs] = target;
+  pairs[2 * *nPairs + 1] = observer;
+  return (*nPairs)++;
+}
+
+int tspice_occult_batch(
+    const char *const *targ1s,
+    const char *const *shape1s,
+    const char *const *frame1s,
+    const char *const *targ2s,
+    const char *const *shape2s,
+    const char *const *frame2s,
+    const char *const *observers,
+    int nTriples,
+    const char *abcorr,
+    const double *ets,
+    int nEts,
+    signed char *outCodes,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  if (nTriples < 0 || nEts < 0) {
+    return tspice_geometry_invalid_arg(err, errMaxBytes, "tspice_occult_batch(): nTriples and nEts must be >= 0");
+  }
+  if (nTriples > 0 && nEts > 0 &&
+      (!targ1s || !shape1s || !frame1s || !targ2s || !shape2s || !frame2s || !observers || !ets || !outCodes)) {
+    return tspice_geometry_invalid_arg(
+        err, errMaxBytes, "tspice_occult_batch(): input and output buffers must not be NULL when n > 0");
+  }
+  if (nTriples == 0 || nEts == 0) {
+    return 0;
+  }
+
+  // Per triple: the two (target, observer) position slots and bounding radii, or `pair1 < 0` when
+  // the triple always goes through occult_c (DSK shapes, missing radii, two points).
+  const size_t nt = (size_t)nTriples;
+  int *pairIndex = (int *)malloc(nt * 2 * sizeof(int));
+  double *radius = (double *)malloc(nt * 2 * sizeof(double));
+  const char **pairs = (const char **)malloc(nt * 4 * sizeof(const char *));
+  double *pos = (double *)malloc(nt * 2 * 3 * sizeof(double));
+  int *posEt = (int *)malloc(nt * 2 * sizeof(int));
+  if (!pairIndex || !radius || !pairs || !pos || !posEt) {
+    free(pairIndex);
+    free(radius);
+    free(pairs);
+    free(pos);
+    free(posEt);
+    return tspice_geometry_invalid_arg(err, errMaxBytes, "tspice_occult_batch(): out of memory");
+  }
+
+  int nPairs = 0;
+  for (int t = 0; t < nTriples; t++) {
+    pairIndex[2 * t] = -1;
+    if (tspice_occult_bounding_radius(targ1s[t], shape1s[t], &radius[2 * t]) != 0 ||
+        tspice_occult_bounding_radius(targ2s[t], shape2s[t], &radius[2 * t + 1]) != 0 ||
+        (radius[2 * t] == 0.0 && radius[2 * t + 1] == 0.0)) {
+      if (failed_c()) {
+        reset_c();
+        tspice_clear_last_error_buffers();
+      }
+      continue;
+    }
+    pairIndex[2 * t] = tspice_occult_intern_pair(targ1s[t], observers[t], pairs, &nPairs);
+    pairIndex[2 * t + 1] = tspice_occult_intern_pair(targ2s[t], observers[t], pairs, &nPairs);
+  }
+  for (int p = 0; p < nPairs; p++) {
+    posEt[p] = -1;
+  }
+
+  int code = 0;
+  for (int e = 0; e < nEts && code == 0; e++) {
+    const SpiceDouble et = (SpiceDouble)ets[e];
+    for (int t = 0; t < nTriples; t++) {
+      signed char *out = &outCodes[(size_t)t * (size_t)nEts + (size_t)e];
+
+      // Pre-pass: when the bounding spheres of the two targets, as seen by the observer, are
+      // clearly apart there is no occultation. Positions are shared by every triple with the same
+      // (target, observer) at this epoch. Each triple's first epoch always goes through occult_c,
+      // so arguments that spkpos_c accepts but occult_c rejects (stellar-aberration corrections,
+      // unknown frame names) fail the batch as they would in a scalar loop.
+      if (e > 0 && pairIndex[2 * t] >= 0) {
+        int usable = 1;
+        double *p[2];
+        for (int k = 0; k < 2 && usable; k++) {
+          const int slot = pairIndex[2 * t + k];
+          p[k] = &pos[(size_t)slot * 3];
+          if (posEt[slot] == e) continue;
+          SpiceDouble lt = 0.0;
+          spkpos_c(pairs[2 * slot], et, "J2000", abcorr, pairs[2 * slot + 1], p[k], &lt);
+          if (failed_c()) {
+            reset_c();
+            tspice_clear_last_error_buffers();
+            usable = 0;
+          } else {
+            posEt[slot] = e;
+          }
+        }
+        if (usable) {
+          const double d1 = vnorm_c(p[0]);
+          const double d2 = vnorm_c(p[1]);
+          if (d1 > radius[2 * t] && d2 > radius[2 * t + 1]) {
+            const double reach = asin(radius[2 * t] / d1) + asin(radius[2 * t + 1] / d2);
+            if (vsep_c(p[0], p[1]) > reach * (1.0 + 1e-6) + 1e-9) {
+              *out = 0;
+              continue;
+            }
+          }
+        }
+      }
+
+      SpiceInt ocltid = 0;
+      occult_c(targ1s[t], shape1s[t], frame1s[t], targ2s[t], shape2s[t], frame2s[t], abcorr, observers[t], et, &ocltid);
+      if (failed_c()) {
+        if (outFailedIndex) {
+          *outFailedIndex = t * nEts + e;
+        }
+        tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+        code = 1;
+        break;
+      }
+      *out = (signed char)ocltid;
+    }
+  }
+
+  free(pairIndex);
+  free(radius);
+  free(pairs);
+  free(pos);
+  free(posEt);
+  return code;
+}
+
+// Shared loop for tspice_ilumin_batch / tspice_illumf_batch. `ilusrc == NULL` selects ilumin_c
+// (the Sun); otherwise illumf_c with the visibility/lighting flags.
+static int tspice_illum_batch(
+    const char *name,
+    const char *method,
+    const char *target,
+    const char *ilusrc,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const double *spoints3n,
+    int n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    double *outPhases,
+    double *outIncdncs,
+    double *outEmissns,
+    unsigned char *outVisibl,
+    unsigned char *outLit,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outFailedIndex) {
+    *outFailedIndex = -1;
+  }
+
+  char msg[160];
+  if (n < 0) {
+    snprintf(msg, sizeof(msg), "%s(): n must be >= 0", name);
+    return tspice_geometry_invalid_arg(err, errMaxBytes, msg);
+  }
+  if (n > 0 &&
+      (!spoints3n || !outTrgepcs || !outSrfvecs3n || !outPhases || !outIncdncs || !outEmissns ||
+       (ilusrc && (!outVisibl || !outLit)))) {
+    snprintf(msg, sizeof(msg), "%s(): input and output buffers must not be NULL when n > 0", name);
+    return tspice_geometry_invalid_arg(err, errMaxBytes, msg);
+  }
+
+  for (int i = 0; i < n; i++) {
+    SpiceDouble spoint[3] = {
+        (SpiceDouble)spoints3n[(size_t)i * 3],
+        (SpiceDouble)spoints3n[(size_t)i * 3 + 1],
+        (SpiceDouble)spoints3n[(size_t)i * 3 + 2]};
+    SpiceDouble trgepc = 0.0;
+    SpiceDouble phase = 0.0;
+    SpiceDouble incdnc = 0.0;
+    SpiceDouble emissn = 0.0;
+    SpiceDouble *srfvec = (SpiceDouble *)&outSrfvecs3n[(size_t)i * 3];
+    if (ilusrc) {
+      SpiceBoolean visibl = SPICEFALSE;
+      SpiceBoolean lit = SPICEFALSE;
+      illumf_c(
+          method, target, ilusrc, (SpiceDouble)et, fixref, abcorr, observer, spoint, &trgepc, srfvec, &phase, &incdnc,
+          &emissn, &visibl, &lit);
+      outVisibl[i] = visibl == SPICETRUE ? 1 : 0;
+      outLit[i] = lit == SPICETRUE ? 1 : 0;
+    } else {
+      ilumin_c(method, target, (SpiceDouble)et, fixref, abcorr, observer, spoint, &trgepc, srfvec, &phase, &incdnc, &emissn);
+    }
+    if (failed_c()) {
+      if (outFailedIndex) {
+        *outFailedIndex = i;
+      }
+      tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+      return 1;
+    }
+    outTrgepcs[i] = (double)trgepc;
+    outPhases[i] = (double)phase;
+    outIncdncs[i] = (double)incdnc;
+    outEmissns[i] = (double)emissn;
+  }
+  return 0;
+}
+
+int tspice_ilumin_batch(
+    const char *method,
+    const char *target,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const double *spoints3n,
+    int n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    double *outPhases,
+    double *outIncdncs,
+    double *outEmissns,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  return tspice_illum_batch(
+      "tspice_ilumin_batch",
+      method,
+      target,
+      NULL,
+      et,
+      fixref,
+      abcorr,
+      observer,
+      spoints3n,
+      n,
+      outTrgepcs,
+      outSrfvecs3n,
+      outPhases,
+      outIncdncs,
+      outEmissns,
+      NULL,
+      NULL,
+      outFailedIndex,
+      err,
+      errMaxBytes);
+}
+
+int tspice_illumf_batch(
+    const char *method,
+    const char *target,
+    const char *ilusrc,
+    double et,
+    const char *fixref,
+    const char *abcorr,
+    const char *observer,
+    const double *spoints3n,
+    int n,
+    double *outTrgepcs,
+    double *outSrfvecs3n,
+    double *outPhases,
+    double *outIncdncs,
+    double *outEmissns,
+    unsigned char *outVisibl,
+    unsigned char *outLit,
+    int *outFailedIndex,
+    char *err,
+    int errMaxBytes) {
+  if (!ilusrc) {
+    tspice_init_cspice_error_handling_once();
+    if (outFailedIndex) {
+      *outFailedIndex = -1;
+    }
+    return tspice_geometry_invalid_arg(err, errMaxBytes, "tspice_illumf_batch(): ilusrc must not be NULL");
+  }
+  return tspice_illum_batch(
+      "tspice_illumf_batch",
+      method,
+      target,
+      ilusrc,
+      et,
+      fixref,
+      abcorr,
+      observer,
+      spoints3n,
+      n,
+      outTrgepcs,
+      outSrfvecs3n,
+      outPhases,
+      outIncdncs,
+      outEmissns,
+      outVisibl,
+      outLit,
+      outFailedIndex,
+      err,
+      errMaxBytes);
+}
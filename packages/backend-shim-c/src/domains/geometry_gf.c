@@ -26,7 +26,7 @@ static int tspice_geometry_gf_invalid_arg(char *err, int errMaxBytes, const char
   return 1;
 }
 
-static int tspice_int_to_spice_int_checked(
+static int tspice_geometry_gf_int_to_spice_int_checked(
     int value,
     SpiceInt *out,
     const char *ctx,
@@ -80,6 +80,115 @@ static int tspice_expect_double_window(uintptr_t handle, const char *argName, co
   return 0;
 }
 
+// gfevnt_c parameter name/value rows; long enough for body and frame names.
+#define TSPICE_GF_PARAM_BYTES 81
+#define TSPICE_GF_MAX_PARAMS 8
+
+// Mirrors the tolerance set through tspice_gfstol(): gfsep_c / gfdist_c read it
+// from CSPICE's private storage, but gfevnt_c takes it as an argument.
+static double g_gf_cnvtol = SPICE_GF_CNVTOL;
+
+// Set once tspice_gf_bail() has seen an interrupt request, so the search stops
+// even if the hook would change its answer.
+static int g_gf_bailed = 0;
+
+static SpiceBoolean tspice_gf_bail(void) {
+  if (!g_gf_bailed && tspice_interrupt_requested()) {
+    g_gf_bailed = 1;
+  }
+  return g_gf_bailed ? SPICETRUE : SPICEFALSE;
+}
+
+// The gfsep_c / gfdist_c search as a gfevnt_c search over `gquant`, with
+// tspice_gf_bail() as its interrupt hook. Used while an interrupt hook is
+// installed; step and tolerance are the ones gfsep_c / gfdist_c would use.
+//
+// Returns 0, 1 (CSPICE failed), or TSPICE_INTERRUPTED with `result` emptied.
+static int tspice_gf_search_interruptible(
+    const char *ctx,
+    const char *gquant,
+    int npars,
+    const char *const *names,
+    const char *const *values,
+    const char *relate,
+    double refval,
+    double adjust,
+    double step,
+    SpiceInt nintvls,
+    SpiceCell *cnfine,
+    SpiceCell *result,
+    char *err,
+    int errMaxBytes) {
+  SpiceChar qpnams[TSPICE_GF_MAX_PARAMS][TSPICE_GF_PARAM_BYTES];
+  SpiceChar qcpars[TSPICE_GF_MAX_PARAMS][TSPICE_GF_PARAM_BYTES];
+  for (int i = 0; i < npars; i++) {
+    if (!values[i] || strlen(values[i]) >= TSPICE_GF_PARAM_BYTES) {
+      char buf[256];
+      snprintf(
+          buf,
+          sizeof(buf),
+          "%s: %s must be a string of at most %d characters",
+          ctx,
+          names[i],
+          TSPICE_GF_PARAM_BYTES - 1);
+      return tspice_geometry_gf_invalid_arg(err, errMaxBytes, buf);
+    }
+    snprintf(qpnams[i], TSPICE_GF_PARAM_BYTES, "%s", names[i]);
+    snprintf(qcpars[i], TSPICE_GF_PARAM_BYTES, "%s", values[i]);
+  }
+  // Unused by these quantities, but gfevnt_c still reads them.
+  SpiceDouble qdpars[1] = {0.0};
+  SpiceInt qipars[1] = {0};
+  SpiceBoolean qlpars[1] = {SPICEFALSE};
+
+  gfsstp_c((SpiceDouble)step);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  g_gf_bailed = 0;
+  gfevnt_c(
+      gfstep_c,
+      gfrefn_c,
+      gquant,
+      (SpiceInt)npars,
+      TSPICE_GF_PARAM_BYTES,
+      qpnams,
+      qcpars,
+      qdpars,
+      qipars,
+      qlpars,
+      relate,
+      (SpiceDouble)refval,
+      (SpiceDouble)g_gf_cnvtol,
+      (SpiceDouble)adjust,
+      SPICEFALSE,
+      gfrepi_c,
+      gfrepu_c,
+      gfrepf_c,
+      nintvls,
+      SPICETRUE,
+      tspice_gf_bail,
+      cnfine,
+      result);
+  const int bailed = g_gf_bailed;
+  g_gf_bailed = 0;
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  if (bailed) {
+    // Drop the partial result, and clear CSPICE's own interrupt status so the
+    // next search starts clean.
+    scard_c(0, result);
+    gfclrh_c();
+    return TSPICE_INTERRUPTED;
+  }
+  return 0;
+}
+
 int tspice_gfsstp(double step, char *err, int errMaxBytes) {
   tspice_init_cspice_error_handling_once();
   if (errMaxBytes > 0) {
@@ -128,6 +237,7 @@ int tspice_gfstol(double value, char *err, int errMaxBytes) {
     tspice_get_spice_error_message_and_reset(err, errMaxBytes);
     return 1;
   }
+  g_gf_cnvtol = value;
 
   return 0;
 }
@@ -230,7 +340,7 @@ int tspice_gfsep(
   }
 
   SpiceInt nintvlsC = 0;
-  if (tspice_int_to_spice_int_checked(nintvls, &nintvlsC, "tspice_gfsep(nintvls)", err, errMaxBytes) != 0) {
+  if (tspice_geometry_gf_int_to_spice_int_checked(nintvls, &nintvlsC, "tspice_gfsep(nintvls)", err, errMaxBytes) != 0) {
     return 1;
   }
 
@@ -243,6 +353,26 @@ int tspice_gfsep(
     return 1;
   }
 
+  if (tspice_interrupt_hook_installed()) {
+    const char *const names[] = {"TARGET1", "FRAME1", "SHAPE1", "TARGET2", "FRAME2", "SHAPE2", "OBSERVER", "ABCORR"};
+    const char *const values[] = {targ1, frame1, shape1, targ2, frame2, shape2, obsrvr, abcorr};
+    return tspice_gf_search_interruptible(
+        "tspice_gfsep()",
+        "ANGULAR SEPARATION",
+        8,
+        names,
+        values,
+        relate,
+        refval,
+        adjust,
+        step,
+        nintvlsC,
+        cnfine,
+        result,
+        err,
+        errMaxBytes);
+  }
+
   gfsep_c(
       targ1,
       shape1,
@@ -286,7 +416,7 @@ int tspice_gfdist(
   }
 
   SpiceInt nintvlsC = 0;
-  if (tspice_int_to_spice_int_checked(nintvls, &nintvlsC, "tspice_gfdist(nintvls)", err, errMaxBytes) != 0) {
+  if (tspice_geometry_gf_int_to_spice_int_checked(nintvls, &nintvlsC, "tspice_gfdist(nintvls)", err, errMaxBytes) != 0) {
     return 1;
   }
 
@@ -299,6 +429,26 @@ int tspice_gfdist(
     return 1;
   }
 
+  if (tspice_interrupt_hook_installed()) {
+    const char *const names[] = {"TARGET", "OBSERVER", "ABCORR"};
+    const char *const values[] = {target, obsrvr, abcorr};
+    return tspice_gf_search_interruptible(
+        "tspice_gfdist()",
+        "DISTANCE",
+        3,
+        names,
+        values,
+        relate,
+        refval,
+        adjust,
+        step,
+        nintvlsC,
+        cnfine,
+        result,
+        err,
+        errMaxBytes);
+  }
+
   gfdist_c(
       target,
       abcorr,
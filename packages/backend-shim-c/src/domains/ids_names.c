@@ -1,11 +1,27 @@
 #include "tspice_backend_shim.h"
 
 #include "SpiceUsr.h"
+#include "SpiceZfc.h"
 
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+// Private CSPICE routine (zzbodget.c): copy of the built-in body name/code
+// table. Not every toolkit release declares it in SpiceZfc.h.
+extern int zzbodget_(
+    integer *room,
+    char *names,
+    char *nornam,
+    integer *codes,
+    integer *nvals,
+    ftnlen namesLen,
+    ftnlen nornamLen);
+
+// `MAXL` in zzbodtrn.inc (Fortran names are blank-padded, not NUL-terminated).
+#define TSPICE_BODY_NAME_FORTRAN_LEN 36
+
 #define TSPICE_BODY_POOLVAR_MAX_BYTES 1024
 
 static int tspice_ids_names_invalid_arg(char *err, int errMaxBytes, const char *msg) {
@@ -208,6 +224,81 @@ int tspice_bods2c(
   return 0;
 }
 
+int tspice_body_builtin_names(
+    int room,
+    int *outCodes,
+    char *outNames,
+    int nameMaxBytes,
+    int *outCount,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outCount) {
+    *outCount = 0;
+  }
+
+  if (room <= 0 || !outCodes || !outNames || nameMaxBytes < TSPICE_BODY_NAME_MAX_BYTES) {
+    return tspice_ids_names_invalid_arg(
+        err,
+        errMaxBytes,
+        "tspice_body_builtin_names(): room must be > 0 and names need TSPICE_BODY_NAME_MAX_BYTES per entry");
+  }
+
+  const size_t namesBytes = (size_t)room * TSPICE_BODY_NAME_FORTRAN_LEN;
+  char *names = (char *)malloc(namesBytes);
+  char *nornam = (char *)malloc(namesBytes);
+  integer *codes = (integer *)malloc((size_t)room * sizeof(integer));
+  if (!names || !nornam || !codes) {
+    free(names);
+    free(nornam);
+    free(codes);
+    return tspice_ids_names_invalid_arg(err, errMaxBytes, "tspice_body_builtin_names(): allocation failed");
+  }
+
+  integer roomF = (integer)room;
+  integer n = 0;
+  zzbodget_(
+      &roomF,
+      names,
+      nornam,
+      codes,
+      &n,
+      (ftnlen)TSPICE_BODY_NAME_FORTRAN_LEN,
+      (ftnlen)TSPICE_BODY_NAME_FORTRAN_LEN);
+  if (failed_c()) {
+    free(names);
+    free(nornam);
+    free(codes);
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    return 1;
+  }
+
+  for (integer i = 0; i < n; i++) {
+    const char *src = names + (size_t)i * TSPICE_BODY_NAME_FORTRAN_LEN;
+    size_t len = TSPICE_BODY_NAME_FORTRAN_LEN;
+    while (len > 0 && src[len - 1] == ' ') {
+      len--;
+    }
+
+    char *dst = outNames + (size_t)i * (size_t)nameMaxBytes;
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+    outCodes[i] = (int)codes[i];
+  }
+
+  free(names);
+  free(nornam);
+  free(codes);
+  if (outCount) {
+    *outCount = (int)n;
+  }
+  return 0;
+}
+
 int tspice_boddef(
     const char *name,
     int code,
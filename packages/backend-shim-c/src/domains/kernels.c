@@ -1,3 +1,7 @@
+#if defined(__linux__) && !defined(__EMSCRIPTEN__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "tspice_backend_shim.h"
 #include "tspice_error.h"
 
@@ -6,6 +10,20 @@
 #include <string.h>
 #include <stdio.h>
 
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_memfd_create)
+#define TSPICE_HAVE_MEMFD 1
+#endif
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#endif
+
 
 int tspice_furnsh(const char *path, char *err, int errMaxBytes) {
   tspice_init_cspice_error_handling_once();
@@ -55,6 +73,194 @@ int tspice_kclear(char *err, int errMaxBytes) {
   return 0;
 }
 
+static int tspice_kernels_invalid_arg(char *err, int errMaxBytes, const char *msg) {
+  // Stable ABI boundary: never invoke CSPICE with invalid pointers/lengths.
+  // Also clear structured last-error buffers so higher-level callers don't
+  // accidentally attach stale SPICE fields to these validation errors.
+  tspice_clear_last_error_buffers();
+
+  if (err && errMaxBytes > 0) {
+    if (msg) {
+      strncpy(err, msg, (size_t)errMaxBytes - 1);
+      err[errMaxBytes - 1] = '\0';
+    } else {
+      err[0] = '\0';
+    }
+  }
+
+  return 1;
+}
+
+#if defined(TSPICE_HAVE_MEMFD)
+static const char *const TSPICE_KERNEL_BUFFER_PREFIX = "/proc/self/fd/";
+
+// Parses `/proc/self/fd/<fd>`; returns -1 if `path` isn't of that form.
+static int tspice_kernel_buffer_fd_from_path(const char *path) {
+  const size_t prefixLen = strlen(TSPICE_KERNEL_BUFFER_PREFIX);
+  if (!path || strncmp(path, TSPICE_KERNEL_BUFFER_PREFIX, prefixLen) != 0) {
+    return -1;
+  }
+
+  char *end = NULL;
+  const long fd = strtol(path + prefixLen, &end, 10);
+  if (end == path + prefixLen || *end != '\0' || fd < 0 || fd > 0x7fffffffL) {
+    return -1;
+  }
+  return (int)fd;
+}
+
+// Descriptors created by tspice_furnsh_buffer() and not yet released, with the size of the kernel
+// each one holds. Only these are ever closed by tspice_release_kernel_buffer(), so a caller cannot
+// close unrelated descriptors by passing an arbitrary `/proc/self/fd/<n>` path. Guarded by the
+// caller's CSPICE lock, like the rest of the shim's global state.
+typedef struct {
+  int fd;
+  size_t byteLength;
+} tspice_kernel_buffer;
+
+static tspice_kernel_buffer *g_kernel_buffers = NULL;
+static size_t g_kernel_buffer_count = 0;
+static size_t g_kernel_buffer_capacity = 0;
+
+static int tspice_kernel_buffer_track(int fd, size_t byteLength) {
+  if (g_kernel_buffer_count == g_kernel_buffer_capacity) {
+    const size_t capacity = g_kernel_buffer_capacity ? g_kernel_buffer_capacity * 2 : 16;
+    tspice_kernel_buffer *buffers =
+        (tspice_kernel_buffer *)realloc(g_kernel_buffers, capacity * sizeof(tspice_kernel_buffer));
+    if (!buffers) {
+      return 1;
+    }
+    g_kernel_buffers = buffers;
+    g_kernel_buffer_capacity = capacity;
+  }
+  g_kernel_buffers[g_kernel_buffer_count].fd = fd;
+  g_kernel_buffers[g_kernel_buffer_count].byteLength = byteLength;
+  g_kernel_buffer_count++;
+  return 0;
+}
+
+// Forgets `fd` and stores its kernel size in `*outByteLength`; returns 0 if it was not created by
+// tspice_furnsh_buffer().
+static int tspice_kernel_buffer_untrack(int fd, size_t *outByteLength) {
+  for (size_t i = 0; i < g_kernel_buffer_count; i++) {
+    if (g_kernel_buffers[i].fd == fd) {
+      *outByteLength = g_kernel_buffers[i].byteLength;
+      g_kernel_buffers[i] = g_kernel_buffers[--g_kernel_buffer_count];
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif
+
+int tspice_kernel_buffers_supported(void) {
+#if defined(TSPICE_HAVE_MEMFD)
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int tspice_furnsh_buffer(
+    const char *name,
+    const unsigned char *bytes,
+    size_t byteLength,
+    char *outPath,
+    int outPathMaxBytes,
+    char *err,
+    int errMaxBytes) {
+  tspice_init_cspice_error_handling_once();
+
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outPath && outPathMaxBytes > 0) {
+    outPath[0] = '\0';
+  }
+
+  if (!outPath || outPathMaxBytes < 32) {
+    return tspice_kernels_invalid_arg(
+        err, errMaxBytes, "tspice_furnsh_buffer(): outPath must hold at least 32 bytes");
+  }
+  if (!bytes && byteLength > 0) {
+    return tspice_kernels_invalid_arg(
+        err, errMaxBytes, "tspice_furnsh_buffer(): bytes must be non-null when byteLength > 0");
+  }
+
+#if defined(TSPICE_HAVE_MEMFD)
+  // MFD_CLOEXEC keeps kernel buffers out of forked or spawned child processes.
+  const int fd = (int)syscall(
+      SYS_memfd_create, (name && name[0] != '\0') ? name : "tspice-kernel", (unsigned int)MFD_CLOEXEC);
+  if (fd < 0) {
+    char buf[200];
+    snprintf(buf, sizeof(buf), "tspice_furnsh_buffer(): memfd_create failed (errno=%d)", errno);
+    return tspice_kernels_invalid_arg(err, errMaxBytes, buf);
+  }
+
+  size_t written = 0;
+  while (written < byteLength) {
+    const ssize_t n = write(fd, bytes + written, byteLength - written);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      char buf[200];
+      snprintf(buf, sizeof(buf), "tspice_furnsh_buffer(): write to memfd failed (errno=%d)", errno);
+      close(fd);
+      return tspice_kernels_invalid_arg(err, errMaxBytes, buf);
+    }
+    written += (size_t)n;
+  }
+
+  if (tspice_kernel_buffer_track(fd, byteLength) != 0) {
+    close(fd);
+    return tspice_kernels_invalid_arg(err, errMaxBytes, "tspice_furnsh_buffer(): out of memory");
+  }
+
+  snprintf(outPath, (size_t)outPathMaxBytes, "%s%d", TSPICE_KERNEL_BUFFER_PREFIX, fd);
+
+  furnsh_c(outPath);
+  if (failed_c()) {
+    tspice_get_spice_error_message_and_reset(err, errMaxBytes);
+    size_t ignored = 0;
+    tspice_kernel_buffer_untrack(fd, &ignored);
+    close(fd);
+    outPath[0] = '\0';
+    return 1;
+  }
+
+  return 0;
+#else
+  (void)name;
+  return tspice_kernels_invalid_arg(
+      err, errMaxBytes, "tspice_furnsh_buffer(): in-memory kernels are not supported on this platform");
+#endif
+}
+
+int tspice_release_kernel_buffer(const char *path, size_t *outByteLength, char *err, int errMaxBytes) {
+  if (errMaxBytes > 0) {
+    err[0] = '\0';
+  }
+  if (outByteLength) {
+    *outByteLength = 0;
+  }
+
+#if defined(TSPICE_HAVE_MEMFD)
+  const int fd = tspice_kernel_buffer_fd_from_path(path);
+  size_t byteLength = 0;
+  if (fd >= 0 && tspice_kernel_buffer_untrack(fd, &byteLength)) {
+    close(fd);
+    if (outByteLength) {
+      *outByteLength = byteLength;
+    }
+  }
+#else
+  (void)path;
+#endif
+
+  return 0;
+}
+
 int tspice_ktotal(const char *kind, int *outCount, char *err, int errMaxBytes) {
   tspice_init_cspice_error_handling_once();
 
@@ -24,6 +24,24 @@ void tspice_clear_last_error_buffers(void) {
   g_last_trace[0] = '\0';
 }
 
+// Interrupt hook (see tspice_set_interrupt_hook()). Serialized the same way as
+// the last-error buffers above.
+static tspice_interrupt_hook g_interrupt_hook = NULL;
+static void *g_interrupt_ctx = NULL;
+
+void tspice_set_interrupt_hook(tspice_interrupt_hook hook, void *ctx) {
+  g_interrupt_hook = hook;
+  g_interrupt_ctx = hook ? ctx : NULL;
+}
+
+int tspice_interrupt_hook_installed(void) {
+  return g_interrupt_hook != NULL;
+}
+
+int tspice_interrupt_requested(void) {
+  return g_interrupt_hook != NULL && g_interrupt_hook(g_interrupt_ctx) != 0;
+}
+
 static void tspice_copy_string(char *dst, size_t dstBytes, const char *src) {
   if (dst == NULL || dstBytes == 0) {
     return;
@@ -74,33 +92,52 @@ int tspice_get_last_error_trace(char *out, int outMaxBytes) {
   return 0;
 }
 
-int tspice_get_spice_error_message_and_reset(char *out, int outMaxBytes) {
-  // Always attempt to capture last-error fields, even if `out` is null.
+int tspice_last_error_class(void) {
+  // Failures that mean "no data at this epoch" rather than a bad call or bad kernels.
+  static const char *const kCoverageGaps[] = {
+      "SPICE(SPKINSUFFDATA)",
+      "SPICE(NOFRAMECONNECT)",
+  };
 
-  SpiceChar shortMsg[1841];
-  SpiceChar longMsg[1841];
-  SpiceChar traceMsg[1841];
+  if (g_last_short[0] == '\0') {
+    return TSPICE_ERROR_NONE;
+  }
+  for (size_t i = 0; i < sizeof(kCoverageGaps) / sizeof(kCoverageGaps[0]); i++) {
+    if (strcmp(g_last_short, kCoverageGaps[i]) == 0) {
+      return TSPICE_ERROR_COVERAGE_GAP;
+    }
+  }
+  return TSPICE_ERROR_OTHER;
+}
 
-  shortMsg[0] = '\0';
-  longMsg[0] = '\0';
-  traceMsg[0] = '\0';
+int tspice_get_spice_error_message_and_reset(char *out, int outMaxBytes) {
+  // Always capture last-error fields, even if `out` is null. They are written
+  // straight into the last-error buffers (no intermediate copies); with a null
+  // `out` that is all this does besides `reset_c()`.
+  g_last_short[0] = '\0';
+  g_last_long[0] = '\0';
+  g_last_trace[0] = '\0';
 
-  getmsg_c("SHORT", (SpiceInt)sizeof(shortMsg), shortMsg);
-  getmsg_c("LONG", (SpiceInt)sizeof(longMsg), longMsg);
+  getmsg_c("SHORT", (SpiceInt)sizeof(g_last_short), g_last_short);
+  getmsg_c("LONG", (SpiceInt)sizeof(g_last_long), g_last_long);
   // `qcktrc_c` returns a printable traceback string (often empty when no trace
   // information is available).
-  qcktrc_c((SpiceInt)sizeof(traceMsg), traceMsg);
-
-  tspice_copy_string(g_last_short, sizeof(g_last_short), shortMsg);
-  tspice_copy_string(g_last_long, sizeof(g_last_long), longMsg);
-  tspice_copy_string(g_last_trace, sizeof(g_last_trace), traceMsg);
+  qcktrc_c((SpiceInt)sizeof(g_last_trace), g_last_trace);
 
   reset_c();
 
+  return tspice_format_last_error(out, outMaxBytes);
+}
+
+int tspice_format_last_error(char *out, int outMaxBytes) {
   if (out == NULL || outMaxBytes <= 0) {
     return 0;
   }
 
+  const char *shortMsg = g_last_short;
+  const char *longMsg = g_last_long;
+  const char *traceMsg = g_last_trace;
+
   out[0] = '\0';
 
   const char *sep = "\n";
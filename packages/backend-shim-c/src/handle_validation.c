@@ -9,15 +9,18 @@
 #include <string.h>
 
 typedef struct {
-  uintptr_t *items;
+  // Open-addressing hash set of live cell pointers; `0` marks an empty slot.
+  uintptr_t *slots;
   size_t len;
-  size_t cap;
+  size_t cap;  // 0 or a power of two
 } tspice_cell_registry;
 
 // NOTE: This registry is process-global and intentionally simple.
 //
-// We store raw pointer values (`uintptr_t`) in a sorted array so we can do
-// O(log n) membership checks via binary search.
+// We store raw pointer values (`uintptr_t`) in a linear-probing hash set so
+// add/contains/remove are O(1) on average (the previous sorted array paid an
+// O(n) memmove on every add and remove). The table stays at most half full,
+// and removal uses backward-shift deletion so no tombstones accumulate.
 // It is used only to validate handles and prevent use-after-free.
 //
 // Concurrency: not thread-safe. Callers must ensure no concurrent access
@@ -25,32 +28,46 @@ typedef struct {
 // single-threaded).
 static tspice_cell_registry tspice_cells_registry = {0};
 
-static size_t tspice_registry_lower_bound(uintptr_t handle, int *outFound) {
-  size_t lo = 0;
-  size_t hi = tspice_cells_registry.len;
-
-  while (lo < hi) {
-    const size_t mid = lo + ((hi - lo) / 2);
-    const uintptr_t v = tspice_cells_registry.items[mid];
-
-    if (v < handle) {
-      lo = mid + 1;
-    } else {
-      hi = mid;
-    }
-  }
+static size_t tspice_registry_hash(uintptr_t handle, size_t cap) {
+  // Cell pointers are at least 8-byte aligned; drop the low bits, then mix.
+  uint64_t h = (uint64_t)(handle >> 3);
+  h ^= h >> 33;
+  h *= UINT64_C(0xff51afd7ed558ccd);
+  h ^= h >> 33;
+  return (size_t)h & (cap - 1);
+}
 
-  if (outFound) {
-    *outFound = (lo < tspice_cells_registry.len && tspice_cells_registry.items[lo] == handle) ? 1 : 0;
+// Returns the slot holding `handle`, or the empty slot where it would go.
+static size_t tspice_registry_probe(const uintptr_t *slots, size_t cap, uintptr_t handle) {
+  size_t i = tspice_registry_hash(handle, cap);
+  while (slots[i] != 0 && slots[i] != handle) {
+    i = (i + 1) & (cap - 1);
   }
-  return lo;
+  return i;
 }
 
 static int tspice_registry_contains(uintptr_t handle) {
-  if (handle == 0) return 0;
-  int found = 0;
-  (void)tspice_registry_lower_bound(handle, &found);
-  return found;
+  if (handle == 0 || tspice_cells_registry.cap == 0) return 0;
+  const size_t i =
+      tspice_registry_probe(tspice_cells_registry.slots, tspice_cells_registry.cap, handle);
+  return tspice_cells_registry.slots[i] == handle ? 1 : 0;
+}
+
+static int tspice_registry_rehash(size_t nextCap) {
+  uintptr_t *next = (uintptr_t *)calloc(nextCap, sizeof(uintptr_t));
+  if (!next) return 1;
+
+  for (size_t i = 0; i < tspice_cells_registry.cap; i++) {
+    const uintptr_t v = tspice_cells_registry.slots[i];
+    if (v != 0) {
+      next[tspice_registry_probe(next, nextCap, v)] = v;
+    }
+  }
+
+  free(tspice_cells_registry.slots);
+  tspice_cells_registry.slots = next;
+  tspice_cells_registry.cap = nextCap;
+  return 0;
 }
 
 int tspice_registry_add(SpiceCell *cell, const char *ctx, char *err, int errMaxBytes) {
@@ -59,32 +76,22 @@ int tspice_registry_add(SpiceCell *cell, const char *ctx, char *err, int errMaxB
   }
 
   const uintptr_t handle = (uintptr_t)cell;
-  int found = 0;
-  const size_t idx = tspice_registry_lower_bound(handle, &found);
-  if (found) {
+  if (tspice_registry_contains(handle)) {
     return 0;
   }
 
-  if (tspice_cells_registry.len == tspice_cells_registry.cap) {
-    const size_t nextCap = tspice_cells_registry.cap == 0 ? 16 : tspice_cells_registry.cap * 2;
-    uintptr_t *next = (uintptr_t *)realloc(tspice_cells_registry.items, nextCap * sizeof(uintptr_t));
-    if (!next) {
+  if ((tspice_cells_registry.len + 1) * 2 > tspice_cells_registry.cap) {
+    const size_t nextCap = tspice_cells_registry.cap == 0 ? 32 : tspice_cells_registry.cap * 2;
+    if (tspice_registry_rehash(nextCap) != 0) {
       char buf[160];
       snprintf(buf, sizeof(buf), "%s: failed to grow cell registry", ctx);
       return tspice_return_error(err, errMaxBytes, buf);
     }
-    tspice_cells_registry.items = next;
-    tspice_cells_registry.cap = nextCap;
   }
 
-  // Insert to keep the array sorted.
-  if (idx < tspice_cells_registry.len) {
-    memmove(
-        &tspice_cells_registry.items[idx + 1],
-        &tspice_cells_registry.items[idx],
-        (tspice_cells_registry.len - idx) * sizeof(uintptr_t));
-  }
-  tspice_cells_registry.items[idx] = handle;
+  const size_t i =
+      tspice_registry_probe(tspice_cells_registry.slots, tspice_cells_registry.cap, handle);
+  tspice_cells_registry.slots[i] = handle;
   tspice_cells_registry.len++;
 
   return 0;
@@ -95,47 +102,48 @@ static void tspice_registry_maybe_shrink(void) {
 
   // If the registry is empty, release memory eagerly.
   if (tspice_cells_registry.len == 0) {
-    free(tspice_cells_registry.items);
-    tspice_cells_registry.items = NULL;
+    free(tspice_cells_registry.slots);
+    tspice_cells_registry.slots = NULL;
     tspice_cells_registry.cap = 0;
     return;
   }
 
   // Best-effort shrink to avoid unbounded growth over long-lived processes.
-  // Keep a small floor to avoid frequent realloc churn.
-  if (tspice_cells_registry.cap <= 64) return;
-  if (tspice_cells_registry.len * 4 > tspice_cells_registry.cap) return;
+  // Keep a small floor to avoid frequent rehash churn.
+  if (tspice_cells_registry.cap <= 256) return;
+  if (tspice_cells_registry.len * 8 > tspice_cells_registry.cap) return;
 
-  size_t nextCap = tspice_cells_registry.cap / 2;
-  if (nextCap < 16) nextCap = 16;
-  if (nextCap < tspice_cells_registry.len) nextCap = tspice_cells_registry.len;
-
-  uintptr_t *next = (uintptr_t *)realloc(tspice_cells_registry.items, nextCap * sizeof(uintptr_t));
-  if (!next) {
-    // Best-effort: if shrinking fails, keep the current allocation.
-    return;
-  }
-  tspice_cells_registry.items = next;
-  tspice_cells_registry.cap = nextCap;
+  // Best-effort: if shrinking fails, keep the current allocation.
+  (void)tspice_registry_rehash(tspice_cells_registry.cap / 2);
 }
 
 int tspice_registry_remove(SpiceCell *cell) {
   if (!cell) return 0;
 
   const uintptr_t handle = (uintptr_t)cell;
-  int found = 0;
-  const size_t idx = tspice_registry_lower_bound(handle, &found);
-  if (!found) {
+  if (!tspice_registry_contains(handle)) {
     return 0;
   }
 
-  // Remove while keeping the array sorted.
-  if (idx + 1 < tspice_cells_registry.len) {
-    memmove(
-        &tspice_cells_registry.items[idx],
-        &tspice_cells_registry.items[idx + 1],
-        (tspice_cells_registry.len - idx - 1) * sizeof(uintptr_t));
+  uintptr_t *slots = tspice_cells_registry.slots;
+  const size_t mask = tspice_cells_registry.cap - 1;
+  size_t hole = tspice_registry_probe(slots, tspice_cells_registry.cap, handle);
+  slots[hole] = 0;
+
+  // Backward-shift deletion: pull later entries of the probe run into the
+  // hole when their home slot does not lie strictly between the hole and them.
+  size_t i = (hole + 1) & mask;
+  while (slots[i] != 0) {
+    const size_t home = tspice_registry_hash(slots[i], tspice_cells_registry.cap);
+    const int movable = ((i - home) & mask) >= ((i - hole) & mask);
+    if (movable) {
+      slots[hole] = slots[i];
+      slots[i] = 0;
+      hole = i;
+    }
+    i = (i + 1) & mask;
   }
+
   tspice_cells_registry.len--;
   tspice_registry_maybe_shrink();
   return 1;
@@ -4,6 +4,13 @@
 //   stdin:  { setup: { kernels?: (string | { path: string, restrictToDir?: string })[] }, call: string, args: any }
 //   stdout: { ok:true, result:any } OR { ok:false, error:{ message, spiceShort?, spiceLong?, spiceTrace? } }
 //
+// `argsBatch: any[][]` may replace `args` to run the call once per entry; the response is then
+// { ok:true, results:[<response>, ...] } with one single-call response per entry.
+//
+// By default the runner handles one request and exits. With `--serve` it reads newline-delimited
+// requests until EOF, writing one response line each, and keeps kernels loaded between requests
+// whose `setup.kernels` is identical.
+//
 // Implements:
 //   - time.str2et (alias: str2et) args: [string] -> number
 //   - time.et2utc (alias: et2utc) args: [number, string, number] -> string
@@ -13,6 +20,9 @@
 //   - frames.frmnam (alias: frmnam) args: [number] -> {found, name?}
 //   - frames.pxform (alias: pxform) args: [string, string, number] -> number[9] (row-major)
 
+// getline() for `--serve` (the runner is built with -std=c99).
+#define _POSIX_C_SOURCE 200809L
+
 #include "SpiceUsr.h"
 
 #include <math.h>
@@ -924,7 +934,7 @@ static void write_error_json_ex(const char *code, const char *message,
   json_print_string_field("spiceLong", spiceLong, &first);
   json_print_string_field("spiceTrace", spiceTrace, &first);
 
-  fputs("}}\n", stdout);
+  fputs("}}", stdout);
 }
 
 static void write_error_json(const char *message, const char *spiceShort,
@@ -1057,325 +1067,193 @@ static void capture_spice_error(char *shortMsg, size_t shortBytes,
   }
 }
 
-int main(void) {
-  int exitCode = 0;
+// Terminates the current response. Every request gets exactly one response line; in `--serve`
+// mode the parent is blocked on it, so flush right away.
+static void end_response(void) {
+  fputc('\n', stdout);
+  fflush(stdout);
+}
 
-  // Ensure numeric parsing is locale-stable (decimal separator is '.')
-  // regardless of the environment.
-  if (setlocale(LC_NUMERIC, "C") == NULL) {
-    write_error_json_ex(
-        "locale_init",
-        "Failed to set process numeric locale (LC_NUMERIC) to 'C'",
-        "setlocale(LC_NUMERIC, 'C') returned NULL",
-        NULL,
-        NULL,
-        NULL);
-    return 1;
-  }
+typedef enum {
+  LOAD_KERNELS_OK = 0,
+  // An error response was written.
+  LOAD_KERNELS_FAILED,
+  // An error response was written and the process should exit non-zero.
+  LOAD_KERNELS_FATAL,
+} LoadKernelsResult;
+
+// Loads every entry of a `setup.kernels` array. Writes an error response on failure.
+static LoadKernelsResult load_kernels(const char *input, const jsmntok_t *tokens,
+                                      const int tokenCount, const int kernelsTok) {
+  char strDetail[256];
 
-  size_t inputLen = 0;
-  char *input = NULL;
-  ReadStdinErr readErr = read_all_stdin(&input, &inputLen);
-  if (readErr != READ_STDIN_OK) {
-    switch (readErr) {
-    case READ_STDIN_TOO_LARGE: {
-      char msg[128];
-      snprintf(msg, sizeof(msg), "stdin too large (max %zu bytes)",
-               (size_t)CSPICE_RUNNER_MAX_STDIN_BYTES);
-      write_error_json_ex("stdin_too_large", msg, NULL, NULL, NULL, NULL);
-      break;
-    }
-    case READ_STDIN_OOM:
-      write_error_json_ex("stdin_oom", "Out of memory while reading stdin", NULL,
-                          NULL, NULL, NULL);
-      exitCode = 1;
-      break;
-    case READ_STDIN_IO: {
-      const char *detail = errno != 0 ? strerror(errno) : NULL;
-      write_error_json_ex("stdin_io", "Failed to read stdin", detail, NULL, NULL,
-                          NULL);
-      exitCode = 1;
-      break;
-    }
-    case READ_STDIN_OVERFLOW:
-      write_error_json_ex("stdin_overflow",
-                          "Internal overflow while reading stdin", NULL, NULL,
-                          NULL, NULL);
-      exitCode = 1;
-      break;
-    default:
-      write_error_json_ex("stdin_error", "Failed to read stdin", NULL, NULL, NULL,
-                          NULL);
-      exitCode = 1;
-      break;
-    }
-    return exitCode;
+  if (tokens[kernelsTok].type != JSMN_ARRAY) {
+    write_error_json_ex("invalid_request", "setup.kernels must be an array",
+                        NULL, NULL, NULL, NULL);
+    return LOAD_KERNELS_FAILED;
   }
 
-  // Parse JSON.
-  int tokenCap = 256;
-  jsmntok_t *tokens = NULL;
-  int tokenCount = 0;
-
-  while (1) {
-    tokens = (jsmntok_t *)malloc(sizeof(jsmntok_t) * (size_t)tokenCap);
-    if (tokens == NULL) {
-      free(input);
-      write_error_json("Out of memory", NULL, NULL, NULL);
-      return 1;
+  int nKernels = tokens[kernelsTok].size;
+  int idx = kernelsTok + 1;
+  for (int i = 0; i < nKernels; i++) {
+    if (idx >= tokenCount) {
+      write_error_json_ex("invalid_request", "setup.kernels parse error",
+                          NULL, NULL, NULL, NULL);
+      return LOAD_KERNELS_FAILED;
     }
 
-    jsmn_parser p;
-    jsmn_init(&p);
-    tokenCount = jsmn_parse(&p, input, inputLen, tokens, (unsigned int)tokenCap);
-    if (tokenCount >= 0) {
-      break;
-    }
+    char *kernelPath = NULL;
+    char *restrictToDir = NULL;
 
-    free(tokens);
-    tokens = NULL;
-
-    if (tokenCount == -1) {
-      tokenCap *= 2;
-      if (tokenCap > 8192) {
-        free(input);
-        write_error_json_ex("invalid_request", "JSON too large/complex", NULL,
-                            NULL, NULL, NULL);
-        return 0;
+    if (tokens[idx].type == JSMN_STRING) {
+      strDetail[0] = '\0';
+      jsmn_strdup_err_t kErr =
+          jsmn_strdup(input, &tokens[idx], &kernelPath, strDetail, sizeof(strDetail));
+      if (kErr != JSMN_STRDUP_OK) {
+        if (kErr == JSMN_STRDUP_INVALID) {
+          write_error_json_ex("invalid_request", "Invalid JSON string escape",
+                              strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
+        } else {
+          write_error_json("Out of memory", NULL, NULL, NULL);
+        }
+        return LOAD_KERNELS_FAILED;
       }
-      continue;
-    }
-
-    free(input);
-    write_error_json_ex("invalid_request", "Invalid JSON", NULL, NULL, NULL,
-                        NULL);
-    return 0;
-  }
-
-  if (tokenCount < 1 || tokens[0].type != JSMN_OBJECT) {
-    free(tokens);
-    free(input);
-    write_error_json_ex("invalid_request", "Input JSON must be an object", NULL,
-                        NULL, NULL, NULL);
-    return 0;
-  }
-
-  int callTok = jsmn_find_object_key(input, tokens, 0, "call", tokenCount);
-  int argsTok = jsmn_find_object_key(input, tokens, 0, "args", tokenCount);
-  int setupTok = jsmn_find_object_key(input, tokens, 0, "setup", tokenCount);
-
-  if (callTok < 0) {
-    free(tokens);
-    free(input);
-    write_error_json_ex("invalid_request", "Missing required field: call", NULL,
-                        NULL, NULL, NULL);
-    return 0;
-  }
-
-  if (tokens[callTok].type != JSMN_STRING) {
-    free(tokens);
-    free(input);
-    write_error_json_ex("invalid_request", "call must be a string", NULL, NULL,
-                        NULL, NULL);
-    return 0;
-  }
-
-  char *call = NULL;
-  char strDetail[256];
-  strDetail[0] = '\0';
-  jsmn_strdup_err_t callErr =
-      jsmn_strdup(input, &tokens[callTok], &call, strDetail, sizeof(strDetail));
-  if (callErr != JSMN_STRDUP_OK) {
-    free(tokens);
-    free(input);
-    if (callErr == JSMN_STRDUP_INVALID) {
-      write_error_json_ex("invalid_request", "Invalid JSON string escape",
-                          strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
-    } else {
-      write_error_json("Out of memory", NULL, NULL, NULL);
-    }
-    return 0;
-  }
-
-  // --- Per-case isolation + error policy.
-  kclear_c();
-  reset_c();
-  erract_c("SET", 0, "RETURN");
-  errprt_c("SET", 0, "NONE");
-
-  // Setup: load kernels if provided.
-  if (setupTok >= 0 && tokens[setupTok].type == JSMN_OBJECT) {
-    int kernelsTok = jsmn_find_object_key(input, tokens, setupTok, "kernels", tokenCount);
-    if (kernelsTok >= 0) {
-      if (tokens[kernelsTok].type != JSMN_ARRAY) {
-        write_error_json_ex("invalid_request", "setup.kernels must be an array",
-                            NULL, NULL, NULL, NULL);
-        goto done;
+    } else if (tokens[idx].type == JSMN_OBJECT) {
+      int pathTok = jsmn_find_object_key(input, tokens, idx, "path", tokenCount);
+      if (pathTok < 0 || tokens[pathTok].type != JSMN_STRING) {
+        write_error_json_ex(
+            "invalid_request",
+            "setup.kernels entries must have a string 'path' field",
+            NULL,
+            NULL,
+            NULL,
+            NULL);
+        return LOAD_KERNELS_FAILED;
       }
 
-      int nKernels = tokens[kernelsTok].size;
-      int idx = kernelsTok + 1;
-      for (int i = 0; i < nKernels; i++) {
-        if (idx >= tokenCount) {
-          write_error_json_ex("invalid_request", "setup.kernels parse error",
-                              NULL, NULL, NULL, NULL);
-          goto done;
+      strDetail[0] = '\0';
+      jsmn_strdup_err_t pathErr =
+          jsmn_strdup(input, &tokens[pathTok], &kernelPath, strDetail, sizeof(strDetail));
+      if (pathErr != JSMN_STRDUP_OK) {
+        if (pathErr == JSMN_STRDUP_INVALID) {
+          write_error_json_ex("invalid_request", "Invalid JSON string escape",
+                              strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
+        } else {
+          write_error_json("Out of memory", NULL, NULL, NULL);
         }
+        return LOAD_KERNELS_FAILED;
+      }
 
-        char *kernelPath = NULL;
-        char *restrictToDir = NULL;
-
-        if (tokens[idx].type == JSMN_STRING) {
-          strDetail[0] = '\0';
-          jsmn_strdup_err_t kErr =
-              jsmn_strdup(input, &tokens[idx], &kernelPath, strDetail, sizeof(strDetail));
-          if (kErr != JSMN_STRDUP_OK) {
-            if (kErr == JSMN_STRDUP_INVALID) {
-              write_error_json_ex("invalid_request", "Invalid JSON string escape",
-                                  strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
-            } else {
-              write_error_json("Out of memory", NULL, NULL, NULL);
-            }
-            goto done;
-          }
-        } else if (tokens[idx].type == JSMN_OBJECT) {
-          int pathTok = jsmn_find_object_key(input, tokens, idx, "path", tokenCount);
-          if (pathTok < 0 || tokens[pathTok].type != JSMN_STRING) {
-            write_error_json_ex(
-                "invalid_request",
-                "setup.kernels entries must have a string 'path' field",
-                NULL,
-                NULL,
-                NULL,
-                NULL);
-            goto done;
-          }
-
-          strDetail[0] = '\0';
-          jsmn_strdup_err_t pathErr =
-              jsmn_strdup(input, &tokens[pathTok], &kernelPath, strDetail, sizeof(strDetail));
-          if (pathErr != JSMN_STRDUP_OK) {
-            if (pathErr == JSMN_STRDUP_INVALID) {
-              write_error_json_ex("invalid_request", "Invalid JSON string escape",
-                                  strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
-            } else {
-              write_error_json("Out of memory", NULL, NULL, NULL);
-            }
-            goto done;
-          }
-
-          int restrictTok = jsmn_find_object_key(input, tokens, idx, "restrictToDir", tokenCount);
-          if (restrictTok >= 0) {
-            if (tokens[restrictTok].type != JSMN_STRING) {
-              write_error_json_ex(
-                  "invalid_request",
-                  "setup.kernels[].restrictToDir must be a string",
-                  NULL,
-                  NULL,
-                  NULL,
-                  NULL);
-              free(kernelPath);
-              goto done;
-            }
-
-            strDetail[0] = '\0';
-            jsmn_strdup_err_t restrictErr = jsmn_strdup(input, &tokens[restrictTok],
-                                                       &restrictToDir, strDetail,
-                                                       sizeof(strDetail));
-            if (restrictErr != JSMN_STRDUP_OK) {
-              if (restrictErr == JSMN_STRDUP_INVALID) {
-                write_error_json_ex("invalid_request", "Invalid JSON string escape",
-                                    strDetail[0] ? strDetail : NULL, NULL, NULL,
-                                    NULL);
-              } else {
-                write_error_json("Out of memory", NULL, NULL, NULL);
-              }
-              free(kernelPath);
-              goto done;
-            }
-          }
-        } else {
+      int restrictTok = jsmn_find_object_key(input, tokens, idx, "restrictToDir", tokenCount);
+      if (restrictTok >= 0) {
+        if (tokens[restrictTok].type != JSMN_STRING) {
           write_error_json_ex(
               "invalid_request",
-              "setup.kernels entries must be strings or objects",
+              "setup.kernels[].restrictToDir must be a string",
               NULL,
               NULL,
               NULL,
               NULL);
-          goto done;
+          free(kernelPath);
+          return LOAD_KERNELS_FAILED;
         }
 
-        char *prevCwd = NULL;
-        if (restrictToDir != NULL) {
-          prevCwd = getcwd(NULL, 0);
-          if (prevCwd == NULL) {
-            write_error_json("Failed to getcwd before kernel load", NULL, NULL, NULL);
-            exitCode = 1;
-            free(kernelPath);
-            free(restrictToDir);
-            goto done;
-          }
-
-          if (chdir(restrictToDir) != 0) {
-            char msg[512];
-            snprintf(msg, sizeof(msg),
-                     "Failed to chdir to restrictToDir: %s (dir=%s)",
-                     strerror(errno), restrictToDir);
-            write_error_json(msg, NULL, NULL, NULL);
-            exitCode = 1;
-            free(prevCwd);
-            free(kernelPath);
-            free(restrictToDir);
-            goto done;
+        strDetail[0] = '\0';
+        jsmn_strdup_err_t restrictErr = jsmn_strdup(input, &tokens[restrictTok],
+                                                   &restrictToDir, strDetail,
+                                                   sizeof(strDetail));
+        if (restrictErr != JSMN_STRDUP_OK) {
+          if (restrictErr == JSMN_STRDUP_INVALID) {
+            write_error_json_ex("invalid_request", "Invalid JSON string escape",
+                                strDetail[0] ? strDetail : NULL, NULL, NULL,
+                                NULL);
+          } else {
+            write_error_json("Out of memory", NULL, NULL, NULL);
           }
+          free(kernelPath);
+          return LOAD_KERNELS_FAILED;
         }
+      }
+    } else {
+      write_error_json_ex(
+          "invalid_request",
+          "setup.kernels entries must be strings or objects",
+          NULL,
+          NULL,
+          NULL,
+          NULL);
+      return LOAD_KERNELS_FAILED;
+    }
 
-        furnsh_c(kernelPath);
-
-        if (prevCwd != NULL) {
-          if (chdir(prevCwd) != 0) {
-            char msg[512];
-            snprintf(msg, sizeof(msg),
-                     "Failed to restore cwd after kernel load: %s (cwd=%s)",
-                     strerror(errno), prevCwd);
-            write_error_json(msg, NULL, NULL, NULL);
-            exitCode = 1;
-            free(prevCwd);
-            free(kernelPath);
-            free(restrictToDir);
-            goto done;
-          }
-          free(prevCwd);
-        }
+    char *prevCwd = NULL;
+    if (restrictToDir != NULL) {
+      prevCwd = getcwd(NULL, 0);
+      if (prevCwd == NULL) {
+        write_error_json("Failed to getcwd before kernel load", NULL, NULL, NULL);
+        free(kernelPath);
+        free(restrictToDir);
+        return LOAD_KERNELS_FATAL;
+      }
 
+      if (chdir(restrictToDir) != 0) {
+        char msg[512];
+        snprintf(msg, sizeof(msg),
+                 "Failed to chdir to restrictToDir: %s (dir=%s)",
+                 strerror(errno), restrictToDir);
+        write_error_json(msg, NULL, NULL, NULL);
+        free(prevCwd);
         free(kernelPath);
         free(restrictToDir);
+        return LOAD_KERNELS_FATAL;
+      }
+    }
 
-        if (failed_c() == SPICETRUE) {
-          char shortMsg[1841];
-          char longMsg[1841];
-          char traceMsg[1841];
-          capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg),
-                              traceMsg, sizeof(traceMsg));
-          write_error_json("SPICE error in furnsh", shortMsg, longMsg, traceMsg);
-          goto done;
-        }
+    furnsh_c(kernelPath);
 
-        idx = jsmn_skip_subtree(tokens, idx, tokenCount);
+    if (prevCwd != NULL) {
+      if (chdir(prevCwd) != 0) {
+        char msg[512];
+        snprintf(msg, sizeof(msg),
+                 "Failed to restore cwd after kernel load: %s (cwd=%s)",
+                 strerror(errno), prevCwd);
+        write_error_json(msg, NULL, NULL, NULL);
+        free(prevCwd);
+        free(kernelPath);
+        free(restrictToDir);
+        return LOAD_KERNELS_FATAL;
       }
+      free(prevCwd);
     }
-  }
 
-  if (argsTok < 0) {
-    write_error_json_ex("invalid_request", "Missing required field: args", NULL,
-                        NULL, NULL, NULL);
-    goto done;
+    free(kernelPath);
+    free(restrictToDir);
+
+    if (failed_c() == SPICETRUE) {
+      char shortMsg[1841];
+      char longMsg[1841];
+      char traceMsg[1841];
+      capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg),
+                          traceMsg, sizeof(traceMsg));
+      write_error_json("SPICE error in furnsh", shortMsg, longMsg, traceMsg);
+      return LOAD_KERNELS_FAILED;
+    }
+
+    idx = jsmn_skip_subtree(tokens, idx, tokenCount);
   }
 
+  return LOAD_KERNELS_OK;
+}
+
+// Runs one call with the given `args` array token and writes its response. Assumes the error
+// status is clear on entry.
+static void run_call(const char *input, const jsmntok_t *tokens, const int tokenCount,
+                     const char *call, const int argsTok) {
+  char strDetail[256];
+
   if (tokens[argsTok].type != JSMN_ARRAY) {
     write_error_json_ex("invalid_request", "args must be an array", NULL, NULL,
                         NULL, NULL);
-    goto done;
+    return;
   }
 
   const bool isStr2et = strcmp(call, "time.str2et") == 0 || strcmp(call, "str2et") == 0;
@@ -1389,7 +1267,7 @@ int main(void) {
   if (!isStr2et && !isEt2utc && !isBodn2c && !isBodc2n && !isNamfrm && !isFrmnam && !isPxform) {
     write_error_json_ex("unsupported_call", "Unsupported call", NULL, NULL,
                         NULL, NULL);
-    goto done;
+    return;
   }
 
   if (isStr2et) {
@@ -1401,7 +1279,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int arg0Tok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1413,7 +1291,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     char *timeStr = NULL;
@@ -1427,7 +1305,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceDouble et = 0.0;
@@ -1441,12 +1319,12 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in str2et", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     // Success.
-    fprintf(stdout, "{\"ok\":true,\"result\":%.17g}\n", (double)et);
-    goto done;
+    fprintf(stdout, "{\"ok\":true,\"result\":%.17g}", (double)et);
+    return;
   }
 
   if (isEt2utc) {
@@ -1458,7 +1336,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int etTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1483,7 +1361,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     if (fmtTok < 0 || fmtTok >= tokenCount || tokens[fmtTok].type != JSMN_STRING) {
@@ -1494,7 +1372,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     parse_result precParse = PARSE_INVALID;
@@ -1514,7 +1392,7 @@ int main(void) {
             NULL,
             NULL);
       }
-      goto done;
+      return;
     }
 
     char *format = NULL;
@@ -1528,7 +1406,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceChar utc[128];
@@ -1543,13 +1421,13 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in et2utc", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     fputs("{\"ok\":true,\"result\":\"", stdout);
     json_print_escaped(utc);
-    fputs("\"}\n", stdout);
-    goto done;
+    fputs("\"}", stdout);
+    return;
   }
 
   if (isBodn2c) {
@@ -1561,7 +1439,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int nameTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1573,7 +1451,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     char *name = NULL;
@@ -1587,7 +1465,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceInt code = 0;
@@ -1602,18 +1480,18 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in bodn2c", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     if (found != SPICETRUE) {
-      fputs("{\"ok\":true,\"result\":{\"found\":false}}\n", stdout);
-      goto done;
+      fputs("{\"ok\":true,\"result\":{\"found\":false}}", stdout);
+      return;
     }
 
     fprintf(stdout,
-            "{\"ok\":true,\"result\":{\"found\":true,\"code\":%" PRIdMAX "}}\n",
+            "{\"ok\":true,\"result\":{\"found\":true,\"code\":%" PRIdMAX "}}",
             (intmax_t)code);
-    goto done;
+    return;
   }
 
   if (isBodc2n) {
@@ -1625,7 +1503,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int codeTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1647,7 +1525,7 @@ int main(void) {
             NULL,
             NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceChar name[64];
@@ -1662,18 +1540,18 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in bodc2n", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     if (found != SPICETRUE) {
-      fputs("{\"ok\":true,\"result\":{\"found\":false}}\n", stdout);
-      goto done;
+      fputs("{\"ok\":true,\"result\":{\"found\":false}}", stdout);
+      return;
     }
 
     fputs("{\"ok\":true,\"result\":{\"found\":true,\"name\":\"", stdout);
     json_print_escaped(name);
-    fputs("\"}}\n", stdout);
-    goto done;
+    fputs("\"}}", stdout);
+    return;
   }
 
   if (isNamfrm) {
@@ -1685,7 +1563,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int nameTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1697,7 +1575,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     char *name = NULL;
@@ -1711,7 +1589,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceInt frcode = 0;
@@ -1725,18 +1603,18 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in namfrm", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     if (frcode == 0) {
-      fputs("{\"ok\":true,\"result\":{\"found\":false}}\n", stdout);
-      goto done;
+      fputs("{\"ok\":true,\"result\":{\"found\":false}}", stdout);
+      return;
     }
 
     fprintf(stdout,
-            "{\"ok\":true,\"result\":{\"found\":true,\"code\":%" PRIdMAX "}}\n",
+            "{\"ok\":true,\"result\":{\"found\":true,\"code\":%" PRIdMAX "}}",
             (intmax_t)frcode);
-    goto done;
+    return;
   }
 
   if (isFrmnam) {
@@ -1748,7 +1626,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int codeTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1770,7 +1648,7 @@ int main(void) {
             NULL,
             NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceChar frname[64];
@@ -1784,18 +1662,18 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in frmnam", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     if (frname[0] == '\0') {
-      fputs("{\"ok\":true,\"result\":{\"found\":false}}\n", stdout);
-      goto done;
+      fputs("{\"ok\":true,\"result\":{\"found\":false}}", stdout);
+      return;
     }
 
     fputs("{\"ok\":true,\"result\":{\"found\":true,\"name\":\"", stdout);
     json_print_escaped(frname);
-    fputs("\"}}\n", stdout);
-    goto done;
+    fputs("\"}}", stdout);
+    return;
   }
 
   if (isPxform) {
@@ -1807,7 +1685,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     int fromTok = jsmn_get_array_elem(tokens, argsTok, 0, tokenCount);
@@ -1822,7 +1700,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     if (toTok < 0 || toTok >= tokenCount || tokens[toTok].type != JSMN_STRING) {
@@ -1833,7 +1711,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     SpiceDouble et = 0.0;
@@ -1852,7 +1730,7 @@ int main(void) {
           NULL,
           NULL,
           NULL);
-      goto done;
+      return;
     }
 
     char *from = NULL;
@@ -1868,7 +1746,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     strDetail[0] = '\0';
@@ -1882,7 +1760,7 @@ int main(void) {
       } else {
         write_error_json("Out of memory", NULL, NULL, NULL);
       }
-      goto done;
+      return;
     }
 
     SpiceDouble m[3][3];
@@ -1897,7 +1775,7 @@ int main(void) {
       capture_spice_error(shortMsg, sizeof(shortMsg), longMsg, sizeof(longMsg), traceMsg,
                           sizeof(traceMsg));
       write_error_json("SPICE error in pxform", shortMsg, longMsg, traceMsg);
-      goto done;
+      return;
     }
 
     // Success: row-major matrix.
@@ -1911,18 +1789,308 @@ int main(void) {
         fprintf(stdout, "%.17g", (double)m[r][c]);
       }
     }
-    fputs("]}\n", stdout);
+    fputs("]}", stdout);
+    return;
+  }
+}
+
+// Kernel set kept loaded between requests in `--serve` mode.
+typedef struct {
+  // Raw JSON text of the `setup.kernels` currently loaded ("" for none), or NULL when the pool is
+  // in an unknown state and must be cleared before the next request.
+  char *kernelsKey;
+} KernelCache;
+
+// Handles one request and writes exactly one response (without the trailing newline).
+//
+// With `cache == NULL` (one-shot mode) the kernel pool is cleared before and after the request.
+// Otherwise kernels are only reloaded when `setup.kernels` differs from the previous request's:
+// none of the supported calls modify the pool, so a matching kernel set can be reused as is.
+//
+// Returns the process exit code to use (non-zero only on unrecoverable errors).
+static int handle_request(const char *input, const size_t inputLen, KernelCache *cache) {
+  int exitCode = 0;
+
+  // Parse JSON.
+  int tokenCap = 256;
+  jsmntok_t *tokens = NULL;
+  int tokenCount = 0;
+
+  while (1) {
+    tokens = (jsmntok_t *)malloc(sizeof(jsmntok_t) * (size_t)tokenCap);
+    if (tokens == NULL) {
+      write_error_json("Out of memory", NULL, NULL, NULL);
+      return 1;
+    }
+
+    jsmn_parser p;
+    jsmn_init(&p);
+    tokenCount = jsmn_parse(&p, input, inputLen, tokens, (unsigned int)tokenCap);
+    if (tokenCount >= 0) {
+      break;
+    }
+
+    free(tokens);
+    tokens = NULL;
+
+    if (tokenCount == -1) {
+      tokenCap *= 2;
+      if (tokenCap > 8192) {
+        write_error_json_ex("invalid_request", "JSON too large/complex", NULL,
+                            NULL, NULL, NULL);
+        return 0;
+      }
+      continue;
+    }
+
+    write_error_json_ex("invalid_request", "Invalid JSON", NULL, NULL, NULL,
+                        NULL);
+    return 0;
+  }
+
+  if (tokenCount < 1 || tokens[0].type != JSMN_OBJECT) {
+    free(tokens);
+    write_error_json_ex("invalid_request", "Input JSON must be an object", NULL,
+                        NULL, NULL, NULL);
+    return 0;
+  }
+
+  int callTok = jsmn_find_object_key(input, tokens, 0, "call", tokenCount);
+  int argsTok = jsmn_find_object_key(input, tokens, 0, "args", tokenCount);
+  int setupTok = jsmn_find_object_key(input, tokens, 0, "setup", tokenCount);
+
+  if (callTok < 0) {
+    free(tokens);
+    write_error_json_ex("invalid_request", "Missing required field: call", NULL,
+                        NULL, NULL, NULL);
+    return 0;
+  }
+
+  if (tokens[callTok].type != JSMN_STRING) {
+    free(tokens);
+    write_error_json_ex("invalid_request", "call must be a string", NULL, NULL,
+                        NULL, NULL);
+    return 0;
+  }
+
+  char *call = NULL;
+  char strDetail[256];
+  strDetail[0] = '\0';
+  jsmn_strdup_err_t callErr =
+      jsmn_strdup(input, &tokens[callTok], &call, strDetail, sizeof(strDetail));
+  if (callErr != JSMN_STRDUP_OK) {
+    free(tokens);
+    if (callErr == JSMN_STRDUP_INVALID) {
+      write_error_json_ex("invalid_request", "Invalid JSON string escape",
+                          strDetail[0] ? strDetail : NULL, NULL, NULL, NULL);
+    } else {
+      write_error_json("Out of memory", NULL, NULL, NULL);
+    }
+    return 0;
+  }
+
+  // --- Per-case isolation + error policy.
+  const int kernelsTok = setupTok >= 0 && tokens[setupTok].type == JSMN_OBJECT
+                             ? jsmn_find_object_key(input, tokens, setupTok, "kernels", tokenCount)
+                             : -1;
+  const char *kernelsKey = kernelsTok >= 0 ? input + tokens[kernelsTok].start : "";
+  const size_t kernelsKeyLen =
+      kernelsTok >= 0 ? (size_t)(tokens[kernelsTok].end - tokens[kernelsTok].start) : 0;
+
+  const bool reuseKernels = cache != NULL && cache->kernelsKey != NULL &&
+                            strlen(cache->kernelsKey) == kernelsKeyLen &&
+                            memcmp(cache->kernelsKey, kernelsKey, kernelsKeyLen) == 0;
+
+  if (!reuseKernels) {
+    kclear_c();
+  }
+  reset_c();
+  erract_c("SET", 0, "RETURN");
+  errprt_c("SET", 0, "NONE");
+
+  if (!reuseKernels) {
+    if (cache != NULL) {
+      free(cache->kernelsKey);
+      cache->kernelsKey = NULL;
+    }
+
+    // Setup: load kernels if provided.
+    if (kernelsTok >= 0) {
+      const LoadKernelsResult loaded = load_kernels(input, tokens, tokenCount, kernelsTok);
+      if (loaded != LOAD_KERNELS_OK) {
+        exitCode = loaded == LOAD_KERNELS_FATAL ? 1 : 0;
+        goto done;
+      }
+    }
+
+    if (cache != NULL) {
+      cache->kernelsKey = (char *)malloc(kernelsKeyLen + 1);
+      if (cache->kernelsKey != NULL) {
+        memcpy(cache->kernelsKey, kernelsKey, kernelsKeyLen);
+        cache->kernelsKey[kernelsKeyLen] = '\0';
+      }
+    }
+  }
+
+  // Batched form: `argsBatch: any[][]` runs the call once per entry and responds with
+  // `{ ok:true, results:[<response>, ...] }`, one single-call response per entry, in order.
+  int batchTok = jsmn_find_object_key(input, tokens, 0, "argsBatch", tokenCount);
+  if (batchTok >= 0) {
+    if (argsTok >= 0) {
+      write_error_json_ex("invalid_request", "args and argsBatch are mutually exclusive",
+                          NULL, NULL, NULL, NULL);
+      goto done;
+    }
+    if (tokens[batchTok].type != JSMN_ARRAY) {
+      write_error_json_ex("invalid_request", "argsBatch must be an array", NULL, NULL,
+                          NULL, NULL);
+      goto done;
+    }
+
+    fputs("{\"ok\":true,\"results\":[", stdout);
+    int itemTok = batchTok + 1;
+    for (int i = 0; i < tokens[batchTok].size; i++) {
+      if (i != 0) {
+        fputc(',', stdout);
+      }
+      // Each entry starts from a clean error status, like a separate request.
+      reset_c();
+      run_call(input, tokens, tokenCount, call, itemTok);
+      itemTok = jsmn_skip_subtree(tokens, itemTok, tokenCount);
+    }
+    fputs("]}", stdout);
     goto done;
   }
 
+  if (argsTok < 0) {
+    write_error_json_ex("invalid_request", "Missing required field: args", NULL,
+                        NULL, NULL, NULL);
+    goto done;
+  }
+
+  run_call(input, tokens, tokenCount, call, argsTok);
 
 done:
-  // Clear state even though this is a single-shot process.
-  kclear_c();
+  if (cache == NULL) {
+    // Clear state even though this is a single-shot process.
+    kclear_c();
+  }
   reset_c();
 
   free(call);
   free(tokens);
+  return exitCode;
+}
+
+// `--serve`: handle newline-delimited requests from stdin until EOF, writing one response line
+// per request. Kernels stay loaded between requests with the same `setup.kernels`.
+static int serve(void) {
+  KernelCache cache = {NULL};
+  char *line = NULL;
+  size_t lineCap = 0;
+  int exitCode = 0;
+
+  ssize_t n;
+  while ((n = getline(&line, &lineCap, stdin)) != -1) {
+    size_t len = (size_t)n;
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+      line[--len] = '\0';
+    }
+    if (len == 0) {
+      continue;
+    }
+
+    if (len > (size_t)CSPICE_RUNNER_MAX_STDIN_BYTES) {
+      char msg[128];
+      snprintf(msg, sizeof(msg), "request too large (max %zu bytes)",
+               (size_t)CSPICE_RUNNER_MAX_STDIN_BYTES);
+      write_error_json_ex("stdin_too_large", msg, NULL, NULL, NULL, NULL);
+      end_response();
+      continue;
+    }
+
+    exitCode = handle_request(line, len, &cache);
+    end_response();
+    if (exitCode != 0) {
+      break;
+    }
+  }
+
+  if (exitCode == 0 && ferror(stdin)) {
+    exitCode = 1;
+  }
+
+  free(line);
+  free(cache.kernelsKey);
+  kclear_c();
+  reset_c();
+  return exitCode;
+}
+
+int main(int argc, char **argv) {
+  int exitCode = 0;
+
+  // Ensure numeric parsing is locale-stable (decimal separator is '.')
+  // regardless of the environment.
+  if (setlocale(LC_NUMERIC, "C") == NULL) {
+    write_error_json_ex(
+        "locale_init",
+        "Failed to set process numeric locale (LC_NUMERIC) to 'C'",
+        "setlocale(LC_NUMERIC, 'C') returned NULL",
+        NULL,
+        NULL,
+        NULL);
+    end_response();
+    return 1;
+  }
+
+  if (argc > 1 && strcmp(argv[1], "--serve") == 0) {
+    return serve();
+  }
+
+  size_t inputLen = 0;
+  char *input = NULL;
+  ReadStdinErr readErr = read_all_stdin(&input, &inputLen);
+  if (readErr != READ_STDIN_OK) {
+    switch (readErr) {
+    case READ_STDIN_TOO_LARGE: {
+      char msg[128];
+      snprintf(msg, sizeof(msg), "stdin too large (max %zu bytes)",
+               (size_t)CSPICE_RUNNER_MAX_STDIN_BYTES);
+      write_error_json_ex("stdin_too_large", msg, NULL, NULL, NULL, NULL);
+      break;
+    }
+    case READ_STDIN_OOM:
+      write_error_json_ex("stdin_oom", "Out of memory while reading stdin", NULL,
+                          NULL, NULL, NULL);
+      exitCode = 1;
+      break;
+    case READ_STDIN_IO: {
+      const char *detail = errno != 0 ? strerror(errno) : NULL;
+      write_error_json_ex("stdin_io", "Failed to read stdin", detail, NULL, NULL,
+                          NULL);
+      exitCode = 1;
+      break;
+    }
+    case READ_STDIN_OVERFLOW:
+      write_error_json_ex("stdin_overflow",
+                          "Internal overflow while reading stdin", NULL, NULL,
+                          NULL, NULL);
+      exitCode = 1;
+      break;
+    default:
+      write_error_json_ex("stdin_error", "Failed to read stdin", NULL, NULL, NULL,
+                          NULL);
+      exitCode = 1;
+      break;
+    }
+    end_response();
+    return exitCode;
+  }
+
+  exitCode = handle_request(input, inputLen, NULL);
+  end_response();
+
   free(input);
   return exitCode;
 }
@@ -3,8 +3,15 @@ export { loadScenarioYamlFile } from "./dsl/load.js";
 export { parseScenario } from "./dsl/parse.js";
 export { executeScenario } from "./dsl/execute.js";
 
-export type { CaseRunner, RunCaseInput, RunCaseResult, RunnerErrorReport } from "./runners/types.js";
+export type {
+  CaseRunner,
+  RunCaseBatchInput,
+  RunCaseInput,
+  RunCaseResult,
+  RunnerErrorReport,
+} from "./runners/types.js";
 export { createTspiceRunner } from "./runners/tspiceRunner.js";
+export type { CreateCspiceRunnerOptions, CspiceCaseRunner } from "./runners/cspiceRunner.js";
 export { createCspiceRunner } from "./runners/cspiceRunner.js";
 
 export type { CompareOptions, CompareResult, Mismatch } from "./compare/types.js";
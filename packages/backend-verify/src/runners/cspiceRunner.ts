@@ -1,10 +1,11 @@
 import * as path from "node:path";
 import * as fs from "node:fs";
-import { spawn } from "node:child_process";
+import { spawn, type ChildProcessWithoutNullStreams } from "node:child_process";
 import { fileURLToPath } from "node:url";
 
 import type {
   CaseRunner,
+  RunCaseBatchInput,
   RunCaseInput,
   RunCaseResult,
   RunnerErrorReport,
@@ -113,6 +114,8 @@ type CRunnerError = {
 
 type CRunnerResponse = CRunnerOk | CRunnerError;
 
+type CRunnerBatchResponse = { ok: true; results: CRunnerResponse[] } | CRunnerError;
+
 function isCRunnerResponse(value: unknown): value is CRunnerResponse {
   if (typeof value !== "object" || value === null) return false;
   const v = value as Record<string, unknown>;
@@ -129,6 +132,17 @@ function isCRunnerResponse(value: unknown): value is CRunnerResponse {
   return typeof e.message === "string";
 }
 
+function isCRunnerBatchResponse(value: unknown): value is CRunnerBatchResponse {
+  if (typeof value !== "object" || value === null) return false;
+  const v = value as Record<string, unknown>;
+  if (v.ok === true) {
+    return Array.isArray(v.results) && v.results.every(isCRunnerResponse);
+  }
+  return isCRunnerResponse(value);
+}
+
+const MAX_REQUEST_BYTES = 1024 * 1024;
+
 export type InvokeRunnerOptions = {
   /**
    * Hard timeout for the child process (ms).
@@ -397,7 +411,7 @@ export async function invokeRunner(
     try {
       const payload = `${JSON.stringify(input)}\n`;
       const bytes = Buffer.byteLength(payload, "utf8");
-      const maxBytes = 1024 * 1024;
+      const maxBytes = MAX_REQUEST_BYTES;
 
       if (bytes > maxBytes) {
         throw new Error(
@@ -422,6 +436,174 @@ export async function invokeRunner(
   });
 }
 
+export type CspiceRunnerServerOptions = {
+  /**
+   * Longest time (ms) to wait for the next response while requests are outstanding. On expiry the
+   * server is killed and every outstanding request rejected; the next request starts a new one.
+   */
+  timeoutMs?: number;
+  /** Cap on a single response line. */
+  maxLineChars?: number;
+  /** Arguments for the binary (default `["--serve"]`; tests override this). */
+  args?: string[];
+  cwd?: string;
+};
+
+/** A long-lived `cspice-runner --serve` process. */
+export type CspiceRunnerServer = {
+  /**
+   * Send one request and resolve with its parsed JSON response. Requests are pipelined: several
+   * can be outstanding, and responses are matched to them in order.
+   */
+  request(input: RunCaseInput | RunCaseBatchInput): Promise<unknown>;
+  /** Close stdin so the server exits; outstanding requests are rejected. */
+  close(): void;
+};
+
+type PendingRequest = { resolve: (value: unknown) => void; reject: (error: Error) => void };
+
+/**
+ * Start a CSPICE runner in `--serve` mode. The process is spawned lazily and respawned after a failure.
+ *
+ * @internal (exported for tests)
+ */
+export function startCspiceRunnerServer(
+  binaryPath: string,
+  opts: CspiceRunnerServerOptions = {},
+): CspiceRunnerServer {
+  const timeoutMs = opts.timeoutMs ?? 15_000;
+  const maxLineChars = opts.maxLineChars ?? 1_000_000;
+  const args = opts.args ?? ["--serve"];
+
+  let child: ChildProcessWithoutNullStreams | null = null;
+  let pending: PendingRequest[] = [];
+  let stdoutBuf = "";
+  let stderrTail = "";
+  let timer: NodeJS.Timeout | undefined;
+
+  const fail = (proc: ChildProcessWithoutNullStreams, message: string) => {
+    if (child !== proc) return;
+    child = null;
+    clearTimeout(timer);
+    try {
+      proc.kill("SIGKILL");
+    } catch {
+      // ignore
+    }
+    const stderr = stderrTail.trim();
+    const error = new Error(stderr ? `${message} stderr=${JSON.stringify(stderr)}` : message);
+    const rejected = pending;
+    pending = [];
+    for (const p of rejected) p.reject(error);
+  };
+
+  // Only the oldest outstanding request is timed, so a long pipeline does not time out early.
+  const armTimer = (proc: ChildProcessWithoutNullStreams) => {
+    clearTimeout(timer);
+    // Don't keep the event loop alive for an idle server.
+    const idle = pending.length === 0;
+    const handles = [proc, proc.stdin, proc.stdout, proc.stderr] as unknown as Array<{
+      ref?(): void;
+      unref?(): void;
+    }>;
+    for (const h of handles) {
+      if (idle) h.unref?.();
+      else h.ref?.();
+    }
+    if (idle) return;
+    timer = setTimeout(() => fail(proc, `cspice-runner --serve timed out after ${timeoutMs}ms`), timeoutMs);
+  };
+
+  const spawnServer = (): ChildProcessWithoutNullStreams => {
+    const proc = spawn(binaryPath, args, { stdio: ["pipe", "pipe", "pipe"], cwd: opts.cwd });
+    stdoutBuf = "";
+    stderrTail = "";
+    proc.stdout.setEncoding("utf8");
+    proc.stderr.setEncoding("utf8");
+
+    proc.stdout.on("data", (chunk: string) => {
+      stdoutBuf += chunk;
+      let nl: number;
+      while ((nl = stdoutBuf.indexOf("\n")) !== -1) {
+        const line = stdoutBuf.slice(0, nl).trim();
+        stdoutBuf = stdoutBuf.slice(nl + 1);
+        if (!line) continue;
+
+        const p = pending.shift();
+        if (!p) {
+          fail(proc, `cspice-runner --serve wrote an unsolicited line: ${JSON.stringify(line.slice(0, 4_000))}`);
+          return;
+        }
+        try {
+          p.resolve(JSON.parse(line) as unknown);
+        } catch {
+          p.reject(new Error(`Failed to parse cspice-runner JSON output: ${JSON.stringify(line.slice(0, 4_000))}`));
+        }
+      }
+      if (stdoutBuf.length > maxLineChars) {
+        fail(proc, `cspice-runner output exceeded limit (line capped at ${maxLineChars} chars)`);
+        return;
+      }
+      armTimer(proc);
+    });
+    proc.stderr.on("data", (chunk: string) => {
+      stderrTail = (stderrTail + chunk).slice(-4_000);
+    });
+    proc.on("error", (err) => fail(proc, err.message));
+    proc.on("close", (code, signal) =>
+      fail(proc, `cspice-runner --serve exited (code=${code}, signal=${signal}).`),
+    );
+    proc.stdin.on("error", (err) => fail(proc, err.message));
+    return proc;
+  };
+
+  return {
+    request(input) {
+      const payload = `${JSON.stringify(input)}\n`;
+      const bytes = Buffer.byteLength(payload, "utf8");
+      if (bytes > MAX_REQUEST_BYTES) {
+        return Promise.reject(
+          new Error(
+            `cspice-runner request payload is too large (${bytes} bytes > ${MAX_REQUEST_BYTES} bytes). ` +
+              `Split the work into smaller requests.`,
+          ),
+        );
+      }
+
+      const proc = child ?? (child = spawnServer());
+      return new Promise((resolve, reject) => {
+        pending.push({ resolve, reject });
+        if (pending.length === 1) armTimer(proc);
+        proc.stdin.write(payload);
+      });
+    },
+
+    close() {
+      const proc = child;
+      if (!proc) return;
+      try {
+        proc.stdin.end();
+      } catch {
+        // ignore
+      }
+      fail(proc, "cspice-runner --serve was closed");
+    },
+  };
+}
+
+function toRunCaseResult(out: CRunnerResponse): RunCaseResult {
+  if (out.ok) {
+    return { ok: true, result: out.result };
+  }
+
+  const report: RunnerErrorReport = {
+    ...(out.error.code ? { code: out.error.code } : {}),
+    message: out.error.message,
+    spice: asSpiceErrorState(out.error),
+  };
+  return { ok: false, error: report };
+}
+
 function asSpiceErrorState(err: CRunnerError["error"]): SpiceErrorState {
   const spice: SpiceErrorState = { failed: true };
   if (err.spiceShort) spice.short = err.spiceShort;
@@ -430,38 +612,96 @@ function asSpiceErrorState(err: CRunnerError["error"]): SpiceErrorState {
   return spice;
 }
 
+export type CreateCspiceRunnerOptions = {
+  /**
+   * Keep one `cspice-runner --serve` process for every case (default), instead of spawning one per
+   * case. Kernels stay loaded between consecutive cases with the same `setup.kernels`.
+   */
+  persistent?: boolean;
+};
+
+/** CSPICE CaseRunner, plus a batched form that runs one call over many argument lists. */
+export interface CspiceCaseRunner extends CaseRunner {
+  /** Run `call` once per entry of `argsBatch` (in one request when persistent); results are in order. */
+  runCaseBatch(input: RunCaseBatchInput): Promise<RunCaseResult[]>;
+}
+
 /** Create a CaseRunner that executes calls using the CSPICE CLI runner binary. */
-export async function createCspiceRunner(): Promise<CaseRunner> {
+export async function createCspiceRunner(
+  options: CreateCspiceRunnerOptions = {},
+): Promise<CspiceCaseRunner> {
   const binaryPath = getCspiceRunnerBinaryPath();
+  const server = options.persistent === false ? null : startCspiceRunnerServer(binaryPath);
+
+  const missingBinary = (): RunCaseResult => ({
+    ok: false,
+    error: {
+      message: `cspice-runner binary not found: ${binaryPath} (run: pnpm -C packages/backend-verify test)`,
+    },
+  });
+
+  const runCase = async (input: RunCaseInput): Promise<RunCaseResult> => {
+    if (!fs.existsSync(binaryPath)) {
+      return missingBinary();
+    }
+
+    try {
+      if (server) {
+        const out = await server.request(input);
+        if (!isCRunnerResponse(out)) {
+          throw new Error(
+            `cspice-runner returned JSON, but it did not match the expected protocol shape: ${JSON.stringify(out)}`,
+          );
+        }
+        return toRunCaseResult(out);
+      }
+      return toRunCaseResult(await invokeRunner(binaryPath, input));
+    } catch (error) {
+      return { ok: false, error: safeErrorReport(error) };
+    }
+  };
 
   return {
     kind: "cspice(raw)",
 
-    async runCase(input: RunCaseInput): Promise<RunCaseResult> {
+    runCase,
+
+    async runCaseBatch(input: RunCaseBatchInput): Promise<RunCaseResult[]> {
+      const { argsBatch, ...rest } = input;
+      if (!server) {
+        const results: RunCaseResult[] = [];
+        for (const args of argsBatch) results.push(await runCase({ ...rest, args }));
+        return results;
+      }
       if (!fs.existsSync(binaryPath)) {
-        return {
-          ok: false,
-          error: {
-            message: `cspice-runner binary not found: ${binaryPath} (run: pnpm -C packages/backend-verify test)`,
-          },
-        };
+        return argsBatch.map(() => missingBinary());
       }
 
       try {
-        const out = await invokeRunner(binaryPath, input);
-        if (out.ok) {
-          return { ok: true, result: out.result };
+        const out = await server.request(input);
+        if (!isCRunnerBatchResponse(out)) {
+          throw new Error(
+            `cspice-runner returned JSON, but it did not match the expected protocol shape: ${JSON.stringify(out)}`,
+          );
         }
-
-        const report: RunnerErrorReport = {
-          ...(out.error.code ? { code: out.error.code } : {}),
-          message: out.error.message,
-          spice: asSpiceErrorState(out.error),
-        };
-        return { ok: false, error: report };
+        if (!out.ok) {
+          const failed = toRunCaseResult(out);
+          return argsBatch.map(() => failed);
+        }
+        if (out.results.length !== argsBatch.length) {
+          throw new Error(
+            `cspice-runner returned ${out.results.length} results for ${argsBatch.length} argument lists`,
+          );
+        }
+        return out.results.map(toRunCaseResult);
       } catch (error) {
-        return { ok: false, error: safeErrorReport(error) };
+        const failed: RunCaseResult = { ok: false, error: safeErrorReport(error) };
+        return argsBatch.map(() => failed);
       }
     },
+
+    dispose() {
+      server?.close();
+    },
   };
 }
@@ -10,6 +10,13 @@ export type RunCaseInput = {
   args: unknown[];
 };
 
+/** One call run over many argument lists with a shared setup. */
+export type RunCaseBatchInput = {
+  setup?: CaseSetup;
+  call: string;
+  argsBatch: unknown[][];
+};
+
 export type SpiceErrorState = {
   failed: boolean;
   short?: string;
@@ -1,6 +1,6 @@
 import { describe, expect, it } from "vitest";
 
-import { invokeRunner } from "../src/runners/cspiceRunner.js";
+import { invokeRunner, startCspiceRunnerServer } from "../src/runners/cspiceRunner.js";
 
 describe("cspice-runner protocol", () => {
   it("preserves KernelEntry metadata in setup.kernels", async () => {
@@ -33,4 +33,40 @@ describe("cspice-runner protocol", () => {
 
     expect(out).toEqual({ ok: true, result: input.setup.kernels });
   });
+
+  it("pipelines newline-delimited requests to a --serve process in order", async () => {
+    // Stand-in server: answers each request line with its call name.
+    const script = [
+      "require('node:readline').createInterface({ input: process.stdin }).on('line', (line) => {",
+      "  const { call } = JSON.parse(line)",
+      "  process.stdout.write(JSON.stringify({ ok: true, result: call }) + '\\n')",
+      "})",
+    ].join("; ");
+
+    const server = startCspiceRunnerServer(process.execPath, { timeoutMs: 5_000, args: ["-e", script] });
+    try {
+      const out = await Promise.all(
+        ["a", "b", "c"].map((call) => server.request({ call, args: [] })),
+      );
+      expect(out).toEqual([
+        { ok: true, result: "a" },
+        { ok: true, result: "b" },
+        { ok: true, result: "c" },
+      ]);
+    } finally {
+      server.close();
+    }
+  });
+
+  it("rejects outstanding requests when the --serve process stops answering", async () => {
+    const server = startCspiceRunnerServer(process.execPath, {
+      timeoutMs: 50,
+      args: ["-e", "setInterval(() => {}, 1000)"],
+    });
+    try {
+      await expect(server.request({ call: "noop", args: [] })).rejects.toThrow(/timed out/i);
+    } finally {
+      server.close();
+    }
+  });
 });
@@ -4,6 +4,9 @@
 // This file exists so the Emscripten build can compile a single translation
 // unit while reusing that shared shim implementation.
 //
+// Keep the include list (and its order) in sync with `shimSources` in
+// `scripts/build-backend-wasm.mjs`.
+//
 // When rebuilding the WASM artifacts, compile this file with include paths for:
 // - CSPICE headers
 // - `packages/backend-shim-c/include`
@@ -19,7 +22,9 @@
 #include "../../backend-shim-c/src/domains/frames.c"
 #include "../../backend-shim-c/src/domains/ephemeris.c"
 #include "../../backend-shim-c/src/domains/geometry.c"
+#include "../../backend-shim-c/src/domains/geometry_gf.c"
 #include "../../backend-shim-c/src/domains/coords_vectors.c"
 #include "../../backend-shim-c/src/domains/file_io.c"
+#include "../../backend-shim-c/src/domains/ek.c"
 #include "../../backend-shim-c/src/domains/cells_windows.c"
 #include "../../backend-shim-c/src/domains/dsk.c"
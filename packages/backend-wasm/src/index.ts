@@ -1,6 +1,6 @@
 import type { SpiceBackend } from "@rybosome/tspice-backend-contract";
 
-export type { CreateWasmBackendOptions } from "./runtime/create-backend-options.js";
+export type { CreateWasmBackendOptions, WasmFlavor } from "./runtime/create-backend-options.js";
 import type { CreateWasmBackendOptions } from "./runtime/create-backend-options.js";
 
 // NOTE: Runtime selection is handled by `package.json` conditional exports.
@@ -8,10 +8,20 @@ import type { CreateWasmBackendOptions } from "./runtime/create-backend-options.
 // for TypeScript (which does not currently select types per condition).
 
 export declare const WASM_BINARY_FILENAME: "tspice_backend_wasm.wasm";
+export declare const WASM_SIMD_BINARY_FILENAME: "tspice_backend_wasm.simd.wasm";
 
 // This differs between Node and Web builds.
 export declare const WASM_JS_FILENAME: string;
 
+/** Whether the current runtime can compile WebAssembly SIMD (selects the SIMD artifact under `wasmFlavor: "auto"`). */
+export declare function wasmSimdSupported(): boolean;
+
+/**
+ * Compile (once per binary, cached) the module `createWasmBackend(options)` would load. Post the
+ * result to workers and pass it back as `wasmModule` so N workers share one compile.
+ */
+export declare function compileWasmModule(options?: CreateWasmBackendOptions): Promise<object>;
+
 export declare function createWasmBackend(
   options?: CreateWasmBackendOptions,
 ): Promise<SpiceBackend & { kind: "wasm" }>;
@@ -1,7 +1,10 @@
 export {
   WASM_BINARY_FILENAME,
   WASM_JS_FILENAME,
+  WASM_SIMD_BINARY_FILENAME,
+  compileWasmModule,
   createWasmBackend,
+  wasmSimdSupported,
 } from "./runtime/create-backend.web.js";
 
-export type { CreateWasmBackendOptions } from "./runtime/create-backend.web.js";
+export type { CreateWasmBackendOptions, WasmFlavor } from "./runtime/create-backend.web.js";
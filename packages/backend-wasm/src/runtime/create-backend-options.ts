@@ -1,6 +1,34 @@
+/**
+ * Which WASM artifact to load.
+ *
+ * - `"scalar"`: the baseline build.
+ * - `"simd"`: the same module built with `-msimd128`, so the compiler may
+ *   vectorize loops. Requires WebAssembly SIMD support.
+ * - `"auto"`: `"simd"` when supported, otherwise `"scalar"`.
+ */
+export type WasmFlavor = "auto" | "scalar" | "simd";
+
 export type CreateWasmBackendOptions = {
+  /** Explicit wasm binary location. Takes precedence over {@link wasmFlavor}. */
   wasmUrl?: string | URL;
 
+  /**
+   * Which packaged artifact to load when `wasmUrl` is not set.
+   *
+   * Defaults to `"auto"`. If the SIMD artifact is unavailable, `"auto"` falls
+   * back to the scalar build.
+   */
+  wasmFlavor?: WasmFlavor;
+
+  /**
+   * A precompiled `WebAssembly.Module` for this backend (e.g. compiled once on
+   * the main thread and posted to each worker). When set, the binary is not
+   * fetched or compiled again and `wasmUrl` / `wasmFlavor` are ignored.
+   *
+   * Typed as `object` so this package does not require the DOM lib.
+   */
+  wasmModule?: object;
+
   /**
    * (Node-only) If the default `dist/**` wasm binary appears invalid/partial,
    * `createWasmBackend()` can fall back to the checked-in Emscripten artifact.
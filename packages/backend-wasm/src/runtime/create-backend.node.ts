@@ -20,12 +20,21 @@ import { createEkApi } from "../domains/ek.js";
 import { createWasmFs } from "./fs.js";
 import { createSpiceHandleRegistry } from "./spice-handles.js";
 import { createVirtualOutputRegistry } from "./virtual-outputs.js";
-
-export type { CreateWasmBackendOptions } from "./create-backend-options.js";
+import {
+  compileWasmBytes,
+  compileWasmFromUrl,
+  compileWasmModuleCached,
+  instantiateWasmFromModule,
+  resolveWasmFlavor,
+  WASM_SIMD_BINARY_FILENAME,
+} from "./wasm-flavor.js";
+
+export type { CreateWasmBackendOptions, WasmFlavor } from "./create-backend-options.js";
 import type { CreateWasmBackendOptions } from "./create-backend-options.js";
 
 export const WASM_JS_FILENAME = "tspice_backend_wasm.node.js" as const;
 export const WASM_BINARY_FILENAME = "tspice_backend_wasm.wasm" as const;
+export { WASM_SIMD_BINARY_FILENAME, wasmSimdSupported } from "./wasm-flavor.js";
 
 // Cache wasm binaries by URL to avoid repeated (sometimes flaky) disk reads.
 //
@@ -151,14 +160,32 @@ export async function readWasmBinaryForNode(wasmUrl: string): Promise<ArrayBuffe
   return buffer;
 }
 
-/** Create a {@link SpiceBackend} implementation backed by WASM (Node runtime). */
-export async function createWasmBackend(
-  options: CreateWasmBackendOptions = {},
-): Promise<SpiceBackend & { kind: "wasm" }> {
+/** Compile (or reuse) the module `createWasmBackend(options)` would load (Node runtime). */
+async function compileWasmModuleForNode(
+  options: CreateWasmBackendOptions,
+): Promise<{ wasmModule: object; wasmUrl: string }> {
   // NOTE: Keep this as a literal string so bundlers (Vite) don't generate a
   // runtime glob map for *every* file in this directory (including *.d.ts.map),
   // which can lead to JSON being imported as an ESM module.
-  const wasmUrl = options.wasmUrl?.toString() ?? new URL("../tspice_backend_wasm.wasm", import.meta.url).href;
+  const usingDefaultWasmUrl = options.wasmUrl == null && options.wasmModule == null;
+  let flavor = usingDefaultWasmUrl ? resolveWasmFlavor(options) : "scalar";
+
+  let wasmUrl = options.wasmUrl?.toString() ?? new URL("../tspice_backend_wasm.wasm", import.meta.url).href;
+  if (usingDefaultWasmUrl && flavor === "simd") {
+    const simdUrl = new URL("../tspice_backend_wasm.simd.wasm", import.meta.url);
+    const [{ existsSync }, { fileURLToPath }] = await Promise.all([import("node:fs"), import("node:url")]);
+    if (existsSync(fileURLToPath(simdUrl))) {
+      wasmUrl = simdUrl.href;
+    } else if (options.wasmFlavor === "simd") {
+      throw new Error(
+        `wasmFlavor "simd" requested, but ${WASM_SIMD_BINARY_FILENAME} is missing. ` +
+          `Rebuild the WASM artifacts (node scripts/build-backend-wasm.mjs).`,
+      );
+    } else {
+      // `"auto"`: the SIMD artifact is optional.
+      flavor = "scalar";
+    }
+  }
 
   const WINDOWS_DRIVE_PATH_RE = /^[A-Za-z]:[\\/]/;
   const URL_SCHEME_WITH_AUTHORITY_RE = /^[A-Za-z][A-Za-z\d+.-]*:\/\//;
@@ -199,201 +226,253 @@ export async function createWasmBackend(
     }
   }
 
-  let createEmscriptenModule: (opts: Record<string, unknown>) => Promise<unknown>;
-  try {
-    // NOTE: This must be a literal import path so bundlers like Vite don't
-    // rewrite the glue JS into an asset URL module (via `new URL(..., import.meta.url)`
-    // + `?url`) which breaks `import()`.
-    ({ default: createEmscriptenModule } = (await import(
-      "../tspice_backend_wasm.node.js"
-    )) as {
-      default: (opts: Record<string, unknown>) => Promise<unknown>;
+  const initFailed = (error: unknown): Error =>
+    new Error(`Failed to initialize tspice WASM module (wasmUrl=${wasmUrl}): ${String(error)}`);
+
+  const compile = async (bytes: ArrayBuffer | Uint8Array): Promise<object> => {
+    try {
+      return await compileWasmBytes(bytes);
+    } catch (error) {
+      throw initFailed(error);
+    }
+  };
+
+  // http(s): compile while the binary downloads.
+  if (wasmUrl.startsWith("http://") || wasmUrl.startsWith("https://")) {
+    const wasmModule = await compileWasmModuleCached(wasmUrl, async () => {
+      try {
+        return await compileWasmFromUrl(wasmUrl);
+      } catch (error) {
+        throw initFailed(error);
+      }
     });
-  } catch (error) {
-    throw new Error(
-      `Failed to load tspice WASM glue (../${WASM_JS_FILENAME}): ${String(error)}`,
-    );
+    return { wasmModule, wasmUrl };
   }
 
-  const wasmLocator = wasmUrl;
-
-  // In Node, avoid Emscripten's fetch/instantiateStreaming path for:
-  // - `file://...` URLs (Node's built-in `fetch` can't load them)
-  // - plain filesystem paths when `fetch` exists
-  // Instead, feed the bytes directly to Emscripten via `wasmBinary`.
-  let wasmBinary: ArrayBuffer | Uint8Array | undefined;
-
-  if (wasmUrl.startsWith("file://")) {
-    wasmBinary = await (async () => {
-      const [{ readFileSync, statSync }, { writeFile, rename }, { fileURLToPath }] =
-        await Promise.all([
-          import("node:fs"),
-          import("node:fs/promises"),
-          import("node:url"),
-        ]);
-
-      const usingDefaultWasmUrl = options.wasmUrl == null;
-      const wasmPath = fileURLToPath(wasmUrl);
-
-      type BufferSourceLike = ArrayBuffer | ArrayBufferView;
-      type WebAssemblyLike = {
-        validate(bytes: BufferSourceLike): boolean;
+  if (!wasmUrl.startsWith("file://")) {
+    const wasmModule = await compileWasmModuleCached(wasmUrl, async () => {
+      let bytes: ArrayBuffer | undefined;
+      try {
+        bytes = await readWasmBinaryForNode(wasmUrl);
+      } catch (error) {
+        throw new Error(
+          `Failed to read tspice WASM binary (wasmUrl=${wasmUrl}): ${String(error)}`,
+        );
+      }
+      return compile(bytes!);
+    });
+    return { wasmModule, wasmUrl };
+  }
+
+  // `file://...` URLs are read from disk (Node's built-in `fetch` can't load
+  // them) and validated first, since the dist artifact may be mid-restore.
+  const readFileUrlBytes = async (): Promise<Uint8Array> => {
+    const [{ readFileSync, statSync }, { writeFile, rename }, { fileURLToPath }] =
+      await Promise.all([
+        import("node:fs"),
+        import("node:fs/promises"),
+        import("node:url"),
+      ]);
+
+    const wasmPath = fileURLToPath(wasmUrl);
+
+    type BufferSourceLike = ArrayBuffer | ArrayBufferView;
+    type WebAssemblyLike = {
+      validate(bytes: BufferSourceLike): boolean;
+    };
+
+    // `WebAssembly` is available in Node, but TypeScript only types it when the DOM
+    // lib is enabled. Define a minimal type so we can use `validate()` without pulling
+    // in browser-only lib typings.
+    const wasmApi = (globalThis as unknown as { WebAssembly?: WebAssemblyLike }).WebAssembly;
+
+    const assertMagicHeader = (
+      bytes: Uint8Array,
+      path: string,
+      urlForMessage: string,
+    ): void => {
+      // Validate WASM magic header: 0x00 0x61 0x73 0x6d ("\0asm")
+      if (
+        bytes.length < 4 ||
+        bytes[0] !== 0x00 ||
+        bytes[1] !== 0x61 ||
+        bytes[2] !== 0x73 ||
+        bytes[3] !== 0x6d
+      ) {
+        const prefixBytes = bytes.slice(0, Math.min(8, bytes.length));
+        const prefix = Array.from(prefixBytes)
+          .map((b) => b.toString(16).padStart(2, "0"))
+          .join(" ");
+        throw new Error(
+          `Invalid WASM magic header for ${path} (url=${urlForMessage}). ` +
+            `Expected 00 61 73 6d ("\\0asm") but got ${prefix}${
+              bytes.length > 8 ? " ..." : ""
+            }.`,
+        );
+      }
+    };
+
+    const isValidWasm = (bytes: Uint8Array): boolean => {
+      // Fail fast on truncated/corrupt cache restores.
+      //
+      // If `validate()` is unavailable (or stubbed), assume valid and let
+      // instantiation fail with a real error.
+      if (!wasmApi?.validate) {
+        return true;
+      }
+
+      return wasmApi.validate(bytes);
+    };
+
+    const readBytesWithSizeCheck = (path: string, urlForMessage: string): Uint8Array => {
+      const readWithSizeCheck = (): { bytes: Uint8Array; statSize: number } => {
+        const bytes = readFileSync(path);
+        const statSize = statSync(path).size;
+        return { bytes, statSize };
       };
 
-      // `WebAssembly` is available in Node, but TypeScript only types it when the DOM
-      // lib is enabled. Define a minimal type so we can use `validate()` without pulling
-      // in browser-only lib typings.
-      const wasmApi = (globalThis as unknown as { WebAssembly?: WebAssemblyLike }).WebAssembly;
-
-      const assertMagicHeader = (
-        bytes: Uint8Array,
-        path: string,
-        urlForMessage: string,
-      ): void => {
-        // Validate WASM magic header: 0x00 0x61 0x73 0x6d ("\0asm")
-        if (
-          bytes.length < 4 ||
-          bytes[0] !== 0x00 ||
-          bytes[1] !== 0x61 ||
-          bytes[2] !== 0x73 ||
-          bytes[3] !== 0x6d
-        ) {
-          const prefixBytes = bytes.slice(0, Math.min(8, bytes.length));
-          const prefix = Array.from(prefixBytes)
-            .map((b) => b.toString(16).padStart(2, "0"))
-            .join(" ");
+      // On macOS + Node 22 we've occasionally observed truncated reads leading to
+      // `WebAssembly.instantiate(): section ... extends past end of the module`.
+      // Sync reads + a size sanity-check seems to avoid the issue.
+      let { bytes, statSize } = readWithSizeCheck();
+      if (bytes.length !== statSize) {
+        const firstReadSize = bytes.length;
+        const firstStatSize = statSize;
+
+        ({ bytes, statSize } = readWithSizeCheck());
+        if (bytes.length !== statSize) {
           throw new Error(
-            `Invalid WASM magic header for ${path} (url=${urlForMessage}). ` +
-              `Expected 00 61 73 6d ("\\0asm") but got ${prefix}${
-                bytes.length > 8 ? " ..." : ""
-              }.`,
+            `WASM binary read size mismatch for ${path} (url=${urlForMessage}): ` +
+              `readFileSync().length=${bytes.length} (previous=${firstReadSize}) ` +
+              `statSync().size=${statSize} (previous=${firstStatSize}). ` +
+              `This may indicate a transient/inconsistent filesystem state.`,
           );
         }
-      };
+      }
 
-      const isValidWasm = (bytes: Uint8Array): boolean => {
-        // Fail fast on truncated/corrupt cache restores.
-        //
-        // If `validate()` is unavailable (or stubbed), assume valid and let
-        // instantiation fail with a real error.
-        if (!wasmApi?.validate) {
-          return true;
-        }
+      return bytes;
+    };
 
-        return wasmApi.validate(bytes);
-      };
+    let lastValidationError: unknown;
 
-      const readBytesWithSizeCheck = (path: string, urlForMessage: string): Uint8Array => {
-        const readWithSizeCheck = (): { bytes: Uint8Array; statSize: number } => {
-          const bytes = readFileSync(path);
-          const statSize = statSync(path).size;
-          return { bytes, statSize };
-        };
-
-        // On macOS + Node 22 we've occasionally observed truncated reads leading to
-        // `WebAssembly.instantiate(): section ... extends past end of the module`.
-        // Sync reads + a size sanity-check seems to avoid the issue.
-        let { bytes, statSize } = readWithSizeCheck();
-        if (bytes.length !== statSize) {
-          const firstReadSize = bytes.length;
-          const firstStatSize = statSize;
-
-          ({ bytes, statSize } = readWithSizeCheck());
-          if (bytes.length !== statSize) {
-            throw new Error(
-              `WASM binary read size mismatch for ${path} (url=${urlForMessage}): ` +
-                `readFileSync().length=${bytes.length} (previous=${firstReadSize}) ` +
-                `statSync().size=${statSize} (previous=${firstStatSize}). ` +
-                `This may indicate a transient/inconsistent filesystem state.`,
-            );
-          }
+    async function readValidatedOrNull(
+      path: string,
+      urlForMessage: string,
+    ): Promise<Uint8Array | null> {
+      try {
+        const bytes = readBytesWithSizeCheck(path, urlForMessage);
+        assertMagicHeader(bytes, path, urlForMessage);
+
+        if (!isValidWasm(bytes)) {
+          throw new Error(
+            `WebAssembly.validate() returned false for ${path} (url=${urlForMessage}).`,
+          );
         }
 
         return bytes;
-      };
+      } catch (error) {
+        lastValidationError = error;
+        return null;
+      }
+    }
 
-      let lastValidationError: unknown;
+    // If turbo restores `dist/**` from cache, downstream tasks can sometimes observe
+    // partially-written outputs. Validate the wasm bytes before loading.
+    const initial = await readValidatedOrNull(wasmPath, wasmUrl);
+    if (initial) {
+      return initial;
+    }
 
-      async function readValidatedOrNull(
-        path: string,
-        urlForMessage: string,
-      ): Promise<Uint8Array | null> {
-        try {
-          const bytes = readBytesWithSizeCheck(path, urlForMessage);
-          assertMagicHeader(bytes, path, urlForMessage);
+    // Retry briefly in case another process is still writing/restoring the file.
+    for (const delayMs of [10, 25, 50, 100, 250]) {
+      await new Promise((resolve) => setTimeout(resolve, delayMs));
+      const retry = await readValidatedOrNull(wasmPath, wasmUrl);
+      if (retry) {
+        return retry;
+      }
+    }
 
-          if (!isValidWasm(bytes)) {
-            throw new Error(
-              `WebAssembly.validate() returned false for ${path} (url=${urlForMessage}).`,
-            );
+    // If the dist wasm is still invalid, fall back to the checked-in Emscripten artifact
+    // when running from a workspace checkout.
+    if (usingDefaultWasmUrl) {
+      const fallbackUrl = new URL(
+        `../../emscripten/${flavor === "simd" ? WASM_SIMD_BINARY_FILENAME : WASM_BINARY_FILENAME}`,
+        import.meta.url,
+      );
+      const fallbackPath = fileURLToPath(fallbackUrl);
+
+      const fallback = await readValidatedOrNull(fallbackPath, fallbackUrl.href);
+      if (fallback) {
+        if (options.repairInvalidDistWasm === true) {
+          // Best-effort repair so subsequent loads see a valid file.
+          try {
+            const tmpPath = `${wasmPath}.tmp.${process.pid}.${Date.now()}`;
+            await writeFile(tmpPath, fallback);
+            await rename(tmpPath, wasmPath);
+          } catch {
+            // ignore
           }
-
-          return bytes;
-        } catch (error) {
-          lastValidationError = error;
-          return null;
         }
-      }
 
-      // If turbo restores `dist/**` from cache, downstream tasks can sometimes observe
-      // partially-written outputs. Validate the wasm bytes before loading.
-      const initial = await readValidatedOrNull(wasmPath, wasmUrl);
-      if (initial) {
-        return initial;
+        return fallback;
       }
+    }
 
-      // Retry briefly in case another process is still writing/restoring the file.
-      for (const delayMs of [10, 25, 50, 100, 250]) {
-        await new Promise((resolve) => setTimeout(resolve, delayMs));
-        const retry = await readValidatedOrNull(wasmPath, wasmUrl);
-        if (retry) {
-          return retry;
-        }
-      }
+    const message =
+      `Invalid/partial WASM binary at ${wasmPath}. ` +
+      `Try rerunning backend-wasm build (pnpm -C packages/backend-wasm build) ` +
+      `or ensure turbo cache outputs are fully restored before tests run.`;
 
-      // If the dist wasm is still invalid, fall back to the checked-in Emscripten artifact
-      // when running from a workspace checkout.
-      if (usingDefaultWasmUrl) {
-        const fallbackUrl = new URL(
-          `../../emscripten/${WASM_BINARY_FILENAME}`,
-          import.meta.url,
-        );
-        const fallbackPath = fileURLToPath(fallbackUrl);
-
-        const fallback = await readValidatedOrNull(fallbackPath, fallbackUrl.href);
-        if (fallback) {
-          if (options.repairInvalidDistWasm === true) {
-            // Best-effort repair so subsequent loads see a valid file.
-            try {
-              const tmpPath = `${wasmPath}.tmp.${process.pid}.${Date.now()}`;
-              await writeFile(tmpPath, fallback);
-              await rename(tmpPath, wasmPath);
-            } catch {
-              // ignore
-            }
-          }
+    throw lastValidationError != null
+      ? new Error(message, { cause: lastValidationError })
+      : new Error(message);
+  };
 
-          return fallback;
-        }
-      }
+  const wasmModule = await compileWasmModuleCached(wasmUrl, async () => compile(await readFileUrlBytes()));
+  return { wasmModule, wasmUrl };
+}
+
+/**
+ * Compile the WASM module `createWasmBackend(options)` would load, without
+ * instantiating it.
+ *
+ * The compiled module is cached per binary location, so backends created in
+ * this thread share one compile. Pass it to workers (`postMessage` structured-
+ * clones a `WebAssembly.Module` without recompiling) and create their backends
+ * with `{ wasmModule }`.
+ */
+export async function compileWasmModule(options: CreateWasmBackendOptions = {}): Promise<object> {
+  if (options.wasmModule) {
+    return options.wasmModule;
+  }
+  return (await compileWasmModuleForNode(options)).wasmModule;
+}
 
-      const message =
-        `Invalid/partial WASM binary at ${wasmPath}. ` +
-        `Try rerunning backend-wasm build (pnpm -C packages/backend-wasm build) ` +
-        `or ensure turbo cache outputs are fully restored before tests run.`;
+/** Create a {@link SpiceBackend} implementation backed by WASM (Node runtime). */
+export async function createWasmBackend(
+  options: CreateWasmBackendOptions = {},
+): Promise<SpiceBackend & { kind: "wasm" }> {
+  const { wasmModule, wasmUrl } = options.wasmModule
+    ? {
+        wasmModule: options.wasmModule,
+        wasmUrl: options.wasmUrl?.toString() ?? new URL("../tspice_backend_wasm.wasm", import.meta.url).href,
+      }
+    : await compileWasmModuleForNode(options);
 
-      throw lastValidationError != null
-        ? new Error(message, { cause: lastValidationError })
-        : new Error(message);
-    })();
-  } else {
-    try {
-      wasmBinary = await readWasmBinaryForNode(wasmUrl);
-    } catch (error) {
-      throw new Error(
-        `Failed to read tspice WASM binary (wasmUrl=${wasmUrl}): ${String(error)}`,
-      );
-    }
+  let createEmscriptenModule: (opts: Record<string, unknown>) => Promise<unknown>;
+  try {
+    // NOTE: This must be a literal import path so bundlers like Vite don't
+    // rewrite the glue JS into an asset URL module (via `new URL(..., import.meta.url)`
+    // + `?url`) which breaks `import()`.
+    ({ default: createEmscriptenModule } = (await import(
+      "../tspice_backend_wasm.node.js"
+    )) as {
+      default: (opts: Record<string, unknown>) => Promise<unknown>;
+    });
+  } catch (error) {
+    throw new Error(
+      `Failed to load tspice WASM glue (../${WASM_JS_FILENAME}): ${String(error)}`,
+    );
   }
 
   let module: EmscriptenModule;
@@ -401,11 +480,13 @@ export async function createWasmBackend(
     module = (await createEmscriptenModule({
       locateFile(path: string, prefix: string) {
         if (path === WASM_BINARY_FILENAME) {
-          return wasmLocator;
+          return wasmUrl;
         }
         return `${prefix}${path}`;
       },
-      ...(wasmBinary ? { wasmBinary } : {}),
+      // Always instantiate from the compiled module so Emscripten never
+      // fetches or compiles the binary itself.
+      instantiateWasm: instantiateWasmFromModule(wasmModule),
     })) as EmscriptenModule;
   } catch (error) {
     throw new Error(
@@ -20,25 +20,35 @@ import { createEkApi } from "../domains/ek.js";
 import { createWasmFs } from "./fs.js";
 import { createSpiceHandleRegistry } from "./spice-handles.js";
 import { createVirtualOutputRegistry } from "./virtual-outputs.js";
-
-export type { CreateWasmBackendOptions } from "./create-backend-options.js";
+import {
+  compileWasmFromUrl,
+  compileWasmModuleCached,
+  instantiateWasmFromModule,
+  resolveWasmFlavor,
+} from "./wasm-flavor.js";
+
+export type { CreateWasmBackendOptions, WasmFlavor } from "./create-backend-options.js";
 import type { CreateWasmBackendOptions } from "./create-backend-options.js";
 
 export const WASM_JS_FILENAME = "tspice_backend_wasm.web.js" as const;
 export const WASM_BINARY_FILENAME = "tspice_backend_wasm.wasm" as const;
+export { WASM_SIMD_BINARY_FILENAME, wasmSimdSupported } from "./wasm-flavor.js";
 
-/** Create a {@link SpiceBackend} implementation backed by WASM (web/runtime loader). */
-export async function createWasmBackend(
-  options: CreateWasmBackendOptions = {},
-): Promise<SpiceBackend & { kind: "wasm" }> {
+/** Binary URLs for `options`: the preferred one, and the scalar one `"auto"` falls back to. */
+function resolveWasmUrls(options: CreateWasmBackendOptions): { wasmUrl: string; scalarWasmUrl: string } {
   // NOTE: Keep this as a literal string so bundlers (Vite) don't generate a
   // runtime glob map for *every* file in this directory (including *.d.ts.map),
   // which can lead to JSON being imported as an ESM module.
+  const usingDefaultWasmUrl = options.wasmUrl == null && options.wasmModule == null;
+  const flavor = usingDefaultWasmUrl ? resolveWasmFlavor(options) : "scalar";
+
+  // NOTE: Inline blob workers set `options.wasmUrl` explicitly, since
+  // `import.meta.url` will be `blob:` for the worker entry module.
+  const scalarWasmUrl = options.wasmUrl?.toString() ?? new URL("../tspice_backend_wasm.wasm", import.meta.url).href;
   const wasmUrl =
-    options.wasmUrl?.toString() ??
-    // NOTE: Inline blob workers set `options.wasmUrl` explicitly, since
-    // `import.meta.url` will be `blob:` for the worker entry module.
-    new URL("../tspice_backend_wasm.wasm", import.meta.url).href;
+    usingDefaultWasmUrl && flavor === "simd"
+      ? new URL("../tspice_backend_wasm.simd.wasm", import.meta.url).href
+      : scalarWasmUrl;
 
   const URL_SCHEME_RE = /^[A-Za-z][A-Za-z\d+.-]*:/;
   const WINDOWS_DRIVE_PATH_RE = /^[A-Za-z]:[\\/]/;
@@ -60,6 +70,52 @@ export async function createWasmBackend(
     }
   }
 
+  return { wasmUrl, scalarWasmUrl };
+}
+
+// Compile `url` once per realm (streaming when the server sends `application/wasm`).
+function compileCached(url: string): Promise<object> {
+  return compileWasmModuleCached(url, () => compileWasmFromUrl(url));
+}
+
+/**
+ * Compile the WASM module `createWasmBackend(options)` would load, without
+ * instantiating it.
+ *
+ * The compiled module is cached per binary URL, so backends created in this
+ * realm share one compile. Post it to workers (a `WebAssembly.Module` is
+ * structured-cloneable without recompiling) and create their backends with
+ * `{ wasmModule }`.
+ */
+export async function compileWasmModule(options: CreateWasmBackendOptions = {}): Promise<object> {
+  if (options.wasmModule) {
+    return options.wasmModule;
+  }
+
+  const { wasmUrl, scalarWasmUrl } = resolveWasmUrls(options);
+  try {
+    return await compileCached(wasmUrl);
+  } catch (error) {
+    if (wasmUrl === scalarWasmUrl || options.wasmFlavor === "simd") {
+      throw new Error(`Failed to compile tspice WASM module (wasmUrl=${wasmUrl}): ${String(error)}`);
+    }
+    try {
+      return await compileCached(scalarWasmUrl);
+    } catch (fallbackError) {
+      throw new Error(
+        `Failed to compile tspice WASM module (wasmUrl=${scalarWasmUrl}): ${String(fallbackError)}`,
+        { cause: error },
+      );
+    }
+  }
+}
+
+/** Create a {@link SpiceBackend} implementation backed by WASM (web/runtime loader). */
+export async function createWasmBackend(
+  options: CreateWasmBackendOptions = {},
+): Promise<SpiceBackend & { kind: "wasm" }> {
+  const { wasmUrl, scalarWasmUrl } = resolveWasmUrls(options);
+
   let createEmscriptenModule: (opts: Record<string, unknown>) => Promise<unknown>;
   try {
     // NOTE: This must be a literal import path so bundlers like Vite don't
@@ -76,22 +132,41 @@ export async function createWasmBackend(
     );
   }
 
-  const wasmLocator = wasmUrl;
-
-  let module: EmscriptenModule;
-  try {
-    module = (await createEmscriptenModule({
+  // Both flavours share one glue JS (SIMD only changes code inside the wasm),
+  // so the glue always asks for WASM_BINARY_FILENAME and we redirect it.
+  const instantiate = async (wasmLocator: string): Promise<EmscriptenModule> => {
+    const wasmModule = options.wasmModule ?? (await compileCached(wasmLocator));
+    return (await createEmscriptenModule({
       locateFile(path: string, prefix: string) {
         if (path === WASM_BINARY_FILENAME) {
           return wasmLocator;
         }
         return `${prefix}${path}`;
       },
+      instantiateWasm: instantiateWasmFromModule(wasmModule),
     })) as EmscriptenModule;
+  };
+
+  let module: EmscriptenModule;
+  try {
+    module = await instantiate(wasmUrl);
   } catch (error) {
-    throw new Error(
-      `Failed to initialize tspice WASM module (wasmUrl=${wasmUrl}): ${String(error)}`,
-    );
+    // `"auto"` tolerates a missing/unloadable SIMD artifact.
+    const canFallBack = wasmUrl !== scalarWasmUrl && options.wasmFlavor !== "simd";
+    if (!canFallBack) {
+      throw new Error(
+        `Failed to initialize tspice WASM module (wasmUrl=${wasmUrl}): ${String(error)}`,
+      );
+    }
+
+    try {
+      module = await instantiate(scalarWasmUrl);
+    } catch (fallbackError) {
+      throw new Error(
+        `Failed to initialize tspice WASM module (wasmUrl=${scalarWasmUrl}): ${String(fallbackError)}`,
+        { cause: error },
+      );
+    }
   }
 
 
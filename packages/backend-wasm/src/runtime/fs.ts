@@ -34,14 +34,43 @@ export function resolveKernelPath(path: string): string {
   return `/kernels/${normalizeVirtualKernelPath(raw)}`;
 }
 
-/** Create a minimal WASM-FS facade for writing files and loading kernels via `furnsh`. */
+// MEMFS `r--r--r--`: shared kernel bytes must never be written through.
+const READ_ONLY_MODE = 0o444;
+
+function isSharedBytes(data: Uint8Array): boolean {
+  return typeof SharedArrayBuffer !== "undefined" && data.buffer instanceof SharedArrayBuffer;
+}
+
+/**
+ * Create a minimal WASM-FS facade for writing files and loading kernels via `furnsh`.
+ *
+ * Bytes backed by a `SharedArrayBuffer` are not copied: the MEMFS node takes
+ * ownership of the view (read-only), so every instance handed the same buffer
+ * (e.g. one per worker) reads kernel records straight out of that one copy.
+ * Callers must treat such buffers as immutable once loaded.
+ */
 export function createWasmFs(module: EmscriptenModule): WasmFsApi {
+  // Paths whose MEMFS node aliases caller-owned shared memory.
+  const sharedPaths = new Set<string>();
+
   function writeFile(path: string, data: Uint8Array): void {
     const dir = path.split("/").slice(0, -1).join("/") || "/";
     if (dir && dir !== "/") {
       module.FS.mkdirTree(dir);
     }
 
+    // Never write into (or truncate) a node that aliases shared memory; replace it.
+    if (sharedPaths.delete(path)) {
+      module.FS.unlink(path);
+    }
+
+    if (isSharedBytes(data)) {
+      module.FS.writeFile(path, data, { canOwn: true });
+      module.FS.chmod(path, READ_ONLY_MODE);
+      sharedPaths.add(path);
+      return;
+    }
+
     // Normalize to a tightly-sized, offset-0 view to avoid FS edge cases with Buffer pooling.
     const bytes =
       data.byteOffset === 0 && data.byteLength === data.buffer.byteLength
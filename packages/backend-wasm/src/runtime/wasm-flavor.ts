@@ -0,0 +1,173 @@
+import type { CreateWasmBackendOptions, WasmFlavor } from "./create-backend-options.js";
+
+export const WASM_SIMD_BINARY_FILENAME = "tspice_backend_wasm.simd.wasm" as const;
+
+// Smallest module using a SIMD opcode (`i8x16.splat` + `i8x16.popcnt`).
+const SIMD_PROBE_BYTES = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11,
+]);
+
+type WebAssemblyModuleLike = object;
+type WebAssemblyInstanceLike = object;
+
+type ResponseLike = object;
+
+type WebAssemblyLike = {
+  validate(bytes: Uint8Array): boolean;
+  compile(bytes: ArrayBuffer | Uint8Array): Promise<WebAssemblyModuleLike>;
+  compileStreaming?(source: ResponseLike | Promise<ResponseLike>): Promise<WebAssemblyModuleLike>;
+  instantiate(
+    module: WebAssemblyModuleLike,
+    imports: Record<string, unknown>,
+  ): Promise<WebAssemblyInstanceLike>;
+};
+
+// `WebAssembly` is available in every supported runtime, but TypeScript only
+// types it when the DOM lib is enabled.
+function getWebAssembly(): WebAssemblyLike | undefined {
+  return (globalThis as unknown as { WebAssembly?: WebAssemblyLike }).WebAssembly;
+}
+
+function requireWebAssembly(): WebAssemblyLike {
+  const wasmApi = getWebAssembly();
+  if (!wasmApi) {
+    throw new Error("WebAssembly is not available in this runtime");
+  }
+  return wasmApi;
+}
+
+let simdSupported: boolean | undefined;
+
+/** Whether the current runtime can compile WebAssembly fixed-width SIMD (`simd128`). */
+export function wasmSimdSupported(): boolean {
+  if (simdSupported === undefined) {
+    try {
+      simdSupported = getWebAssembly()?.validate(SIMD_PROBE_BYTES) === true;
+    } catch {
+      simdSupported = false;
+    }
+  }
+  return simdSupported;
+}
+
+/**
+ * Decide which artifact to load when the caller did not pass `wasmUrl`.
+ *
+ * `"auto"` (the default) selects SIMD when the runtime supports it.
+ */
+export function resolveWasmFlavor(options: CreateWasmBackendOptions): Exclude<WasmFlavor, "auto"> {
+  const flavor = options.wasmFlavor ?? "auto";
+  if (flavor !== "auto" && flavor !== "scalar" && flavor !== "simd") {
+    throw new Error(`Unsupported wasmFlavor '${String(flavor)}'. Expected "auto", "scalar", or "simd".`);
+  }
+
+  if (flavor === "simd" && !wasmSimdSupported()) {
+    throw new Error(`wasmFlavor "simd" requested, but this runtime does not support WebAssembly SIMD.`);
+  }
+
+  if (flavor === "auto") {
+    return wasmSimdSupported() ? "simd" : "scalar";
+  }
+  return flavor;
+}
+
+/**
+ * Emscripten `instantiateWasm` hook for a caller-provided compiled module.
+ *
+ * Lets several workers instantiate one `WebAssembly.Module` (which is
+ * structured-cloneable) instead of each fetching and compiling the binary.
+ */
+export function instantiateWasmFromModule(
+  wasmModule: WebAssemblyModuleLike,
+): (
+  imports: Record<string, unknown>,
+  receiveInstance: (instance: WebAssemblyInstanceLike, module: WebAssemblyModuleLike) => void,
+) => Record<string, never> {
+  return (imports, receiveInstance) => {
+    const wasmApi = requireWebAssembly();
+    void wasmApi.instantiate(wasmModule, imports).then((instance) => receiveInstance(instance, wasmModule));
+    // Emscripten expects `{}` here to signal asynchronous instantiation.
+    return {};
+  };
+}
+
+// Compiled modules by binary location, so every backend created in this
+// realm from the same binary shares one compile. Like the Node byte cache this
+// is bounded; failed compiles are dropped so the next call retries.
+const COMPILED_MODULE_CACHE_MAX_ENTRIES = 2;
+const compiledModuleCache = new Map<string, Promise<WebAssemblyModuleLike>>();
+
+/** Return the cached compile for `key`, or start (and cache) `compile()`. */
+export function compileWasmModuleCached(
+  key: string,
+  compile: () => Promise<WebAssemblyModuleLike>,
+): Promise<WebAssemblyModuleLike> {
+  const hit = compiledModuleCache.get(key);
+  if (hit) {
+    // Refresh recency (Map preserves insertion order).
+    compiledModuleCache.delete(key);
+    compiledModuleCache.set(key, hit);
+    return hit;
+  }
+
+  const pending = compile();
+  compiledModuleCache.set(key, pending);
+  pending.catch(() => {
+    if (compiledModuleCache.get(key) === pending) {
+      compiledModuleCache.delete(key);
+    }
+  });
+
+  while (compiledModuleCache.size > COMPILED_MODULE_CACHE_MAX_ENTRIES) {
+    const lruKey = compiledModuleCache.keys().next().value as string | undefined;
+    if (!lruKey) break;
+    compiledModuleCache.delete(lruKey);
+  }
+  return pending;
+}
+
+/** `WebAssembly.compile` for bytes already in memory. */
+export function compileWasmBytes(bytes: ArrayBuffer | Uint8Array): Promise<WebAssemblyModuleLike> {
+  return requireWebAssembly().compile(bytes);
+}
+
+type FetchResponseLike = {
+  ok: boolean;
+  status: number;
+  clone(): FetchResponseLike;
+  arrayBuffer(): Promise<ArrayBuffer>;
+};
+
+/**
+ * Fetch and compile `url`, compiling while the bytes download when the
+ * runtime has `WebAssembly.compileStreaming`.
+ *
+ * Streaming compilation requires an `application/wasm` response; servers that
+ * send another content type get a buffered `compile` instead.
+ */
+export async function compileWasmFromUrl(url: string): Promise<WebAssemblyModuleLike> {
+  const wasmApi = requireWebAssembly();
+  const fetchFn = (globalThis as unknown as { fetch?: (url: string) => Promise<FetchResponseLike> }).fetch;
+  if (!fetchFn) {
+    throw new Error("fetch is not available in this runtime");
+  }
+
+  const response = await fetchFn(url);
+  if (!response.ok) {
+    throw new Error(`Failed to fetch ${url}: HTTP ${response.status}`);
+  }
+
+  if (wasmApi.compileStreaming) {
+    const fallback = response.clone();
+    try {
+      return await wasmApi.compileStreaming(response);
+    } catch (error) {
+      // MIME type mismatch surfaces as a TypeError; compile errors do not.
+      if (!(error instanceof TypeError)) {
+        throw error;
+      }
+      return wasmApi.compile(await fallback.arrayBuffer());
+    }
+  }
+  return wasmApi.compile(await response.arrayBuffer());
+}
@@ -79,4 +79,26 @@ describe("@rybosome/tspice-backend-wasm kernels", () => {
     expect(() => backend.furnsh("file:///tmp/naif0012.tls")).toThrow(/virtual ids/i);
     expect(() => backend.unload("/var/data/naif0012.tls")).toThrow(/virtual ids/i);
   });
+
+  it("loads SharedArrayBuffer-backed kernels into several instances without copying", async () => {
+    const text = new TextEncoder().encode("\\begindata\nTSPICE_SHARED_KERNEL = 42\n\\begintext\n");
+    const shared = new Uint8Array(new SharedArrayBuffer(text.byteLength));
+    shared.set(text);
+
+    const a = await createWasmBackend();
+    const b = await createWasmBackend();
+    for (const backend of [a, b]) {
+      backend.furnsh({ path: "shared.tk", bytes: shared });
+      expect(backend.gdpool("TSPICE_SHARED_KERNEL", 0, 1)).toEqual({ found: true, values: [42] });
+    }
+
+    // Replacing a shared file must not write into the shared buffer.
+    a.unload("shared.tk");
+    a.furnsh({
+      path: "shared.tk",
+      bytes: new TextEncoder().encode("\\begindata\nTSPICE_SHARED_KERNEL = 7\n\\begintext\n"),
+    });
+    expect(a.gdpool("TSPICE_SHARED_KERNEL", 0, 1)).toEqual({ found: true, values: [7] });
+    expect(shared).toEqual(text);
+  });
 });
@@ -0,0 +1,62 @@
+import { readFile } from "node:fs/promises";
+
+import { describe, expect, it } from "vitest";
+
+import {
+  compileWasmModule,
+  createWasmBackend,
+  wasmSimdSupported,
+} from "@rybosome/tspice-backend-wasm";
+
+describe("wasm flavour selection", () => {
+  it("detects SIMD support in Node", () => {
+    // Every Node version we support ships WebAssembly SIMD.
+    expect(wasmSimdSupported()).toBe(true);
+  });
+
+  it("loads the scalar and auto flavours", async () => {
+    for (const wasmFlavor of ["scalar", "auto"] as const) {
+      const backend = await createWasmBackend({ wasmFlavor });
+      expect(backend.kind).toBe("wasm");
+      expect(backend.tkvrsn("TOOLKIT")).not.toBe("");
+    }
+  });
+
+  it("rejects unknown flavours", async () => {
+    await expect(
+      createWasmBackend({ wasmFlavor: "threads" as unknown as "auto" }),
+    ).rejects.toThrow(/Unsupported wasmFlavor/);
+  });
+
+  it(
+    "instantiates from a precompiled WebAssembly.Module",
+    async () => {
+      const bytes = await readFile(new URL("../dist/tspice_backend_wasm.wasm", import.meta.url));
+      const wasmModule = await WebAssembly.compile(bytes);
+
+      const a = await createWasmBackend({ wasmModule });
+      const b = await createWasmBackend({ wasmModule });
+      expect(a.tkvrsn("TOOLKIT")).toBe(b.tkvrsn("TOOLKIT"));
+
+      // Each instance has its own memory (and CSPICE state).
+      a.pdpool("TSPICE_FLAVOR_TEST", [1]);
+      expect(a.expool("TSPICE_FLAVOR_TEST")).toBe(true);
+      expect(b.expool("TSPICE_FLAVOR_TEST")).toBe(false);
+    },
+    20_000,
+  );
+
+  it(
+    "compiles each binary once and shares the module",
+    async () => {
+      const first = await compileWasmModule({ wasmFlavor: "scalar" });
+      const second = await compileWasmModule({ wasmFlavor: "scalar" });
+      expect(second).toBe(first);
+      expect(first).toBeInstanceOf(WebAssembly.Module);
+
+      const backend = await createWasmBackend({ wasmModule: first });
+      expect(backend.tkvrsn("TOOLKIT")).not.toBe("");
+    },
+    20_000,
+  );
+});
@@ -0,0 +1,27 @@
+import { readFile } from "node:fs/promises";
+
+import { describe, expect, it } from "vitest";
+
+async function readRepoFile(relFromPackage: string): Promise<string> {
+  return readFile(new URL(relFromPackage, import.meta.url), "utf8");
+}
+
+describe("emscripten wrapper", () => {
+  it("includes the same shim sources as the WASM build script", async () => {
+    const wrapper = await readRepoFile("../emscripten/tspice_backend_wasm_wrapper.c");
+    const buildScript = await readRepoFile("../../../scripts/build-backend-wasm.mjs");
+
+    const wrapperSources = [...wrapper.matchAll(/^#include "\.\.\/\.\.\/backend-shim-c\/src\/(.+\.c)"$/gm)].map(
+      (m) => m[1],
+    );
+
+    const shimSourcesBlock = /const shimSources = \[([\s\S]*?)\];/.exec(buildScript)?.[1];
+    expect(shimSourcesBlock).toBeDefined();
+    const buildSources = [...shimSourcesBlock!.matchAll(/"backend-shim-c", "src", ((?:"[^"]+", )*"[^"]+\.c")\)/g)].map(
+      (m) => m[1]!.split(", ").map((part) => part.slice(1, -1)).join("/"),
+    );
+
+    expect(wrapperSources.length).toBeGreaterThan(0);
+    expect(wrapperSources).toEqual(buildSources);
+  });
+});
@@ -8,6 +8,9 @@ export type {
   FixtureRootsV1,
   MicroBenchmarkV1,
   MicroCaseV1,
+  ScalingBenchmarkV1,
+  ScalingModeV1,
+  ScalingSweepV1,
   SetupV1,
   ValidateBenchmarkSuiteV1Options,
   ValidationError,
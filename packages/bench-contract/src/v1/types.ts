@@ -21,7 +21,7 @@ export interface DefaultsV1 {
   readonly setup?: SetupV1;
 }
 
-export type BenchmarkKindV1 = "micro" | "workflow";
+export type BenchmarkKindV1 = "micro" | "workflow" | "scaling";
 
 /** Common benchmark fields shared by all benchmark kinds. */
 export interface BenchmarkBaseV1 {
@@ -65,7 +65,30 @@ export interface WorkflowBenchmarkV1 extends BenchmarkBaseV1 {
   readonly steps: readonly WorkflowStepV1[];
 }
 
-export type BenchmarkV1 = MicroBenchmarkV1 | WorkflowBenchmarkV1;
+/** How a scaling benchmark runs its workers. */
+export type ScalingModeV1 = "threads" | "processes";
+
+/** Configurations swept by a scaling benchmark (every `workers` x `batchSizes` pair). */
+export interface ScalingSweepV1 {
+  /** Worker threads in one process (default), or one process per worker. */
+  readonly mode?: ScalingModeV1;
+
+  /** Worker counts to run, each a positive integer. */
+  readonly workers: readonly number[];
+
+  /** Calls each worker makes per dispatch from the coordinator. Defaults to `[1]`. */
+  readonly batchSizes?: readonly number[];
+}
+
+/** Benchmark that measures one call's throughput across worker counts and batch sizes. */
+export interface ScalingBenchmarkV1 extends BenchmarkBaseV1 {
+  readonly kind: "scaling";
+  readonly call: string;
+  readonly args?: unknown;
+  readonly sweep: ScalingSweepV1;
+}
+
+export type BenchmarkV1 = MicroBenchmarkV1 | WorkflowBenchmarkV1 | ScalingBenchmarkV1;
 
 /** Top-level v1 benchmark suite schema. */
 export interface BenchmarkSuiteV1 {
@@ -441,6 +441,87 @@ function validateWorkflowBenchmark(
   }
 }
 
+const SCALING_MODES = new Set(["threads", "processes"]);
+
+function validatePositiveIntegerList(
+  value: unknown,
+  errors: ValidationError[],
+  pathSegments: readonly PathSegment[],
+): void {
+  if (!Array.isArray(value) || value.length === 0) {
+    pushError(errors, pathSegments, "Expected a non-empty array of positive integers.");
+    return;
+  }
+
+  for (let i = 0; i < value.length; i += 1) {
+    const item = value[i];
+    if (typeof item !== "number" || !Number.isInteger(item) || item < 1) {
+      pushError(errors, [...pathSegments, i], "Expected a positive integer.");
+    }
+  }
+}
+
+function validateScalingBenchmark(
+  benchmark: Record<string, unknown>,
+  errors: ValidationError[],
+  pathSegments: readonly PathSegment[],
+  options: ValidateBenchmarkSuiteV1Options,
+): void {
+  for (const field of ["cases", "steps"]) {
+    if (hasOwn(benchmark, field)) {
+      pushError(
+        errors,
+        [...pathSegments, field],
+        `Field '${field}' is not allowed when kind is 'scaling'.`,
+      );
+    }
+  }
+
+  if (!hasOwn(benchmark, "call") || !isNonEmptyString(benchmark.call)) {
+    pushError(
+      errors,
+      [...pathSegments, "call"],
+      "Scaling benchmark field 'call' must be a non-empty string.",
+    );
+  } else {
+    const message = options.validateCall?.(benchmark.call);
+    if (message !== undefined) {
+      pushError(errors, [...pathSegments, "call"], message);
+    }
+  }
+
+  if (!hasOwn(benchmark, "sweep")) {
+    pushError(
+      errors,
+      pathSegments,
+      "Scaling benchmark is missing required field 'sweep'.",
+    );
+    return;
+  }
+
+  const sweepPath = [...pathSegments, "sweep"];
+  const sweep = asRecord(benchmark.sweep, errors, sweepPath);
+  if (sweep === null) return;
+
+  if (hasOwn(sweep, "mode") && !SCALING_MODES.has(sweep.mode as string)) {
+    pushError(
+      errors,
+      [...sweepPath, "mode"],
+      "sweep.mode must be 'threads' or 'processes'.",
+    );
+  }
+
+  if (!hasOwn(sweep, "workers")) {
+    pushError(errors, sweepPath, "sweep is missing required field 'workers'.");
+  } else {
+    validatePositiveIntegerList(sweep.workers, errors, [...sweepPath, "workers"]);
+  }
+
+  if (hasOwn(sweep, "batchSizes")) {
+    validatePositiveIntegerList(sweep.batchSizes, errors, [...sweepPath, "batchSizes"]);
+  }
+}
+
 function validateBenchmark(
   value: unknown,
   errors: ValidationError[],
@@ -459,17 +540,17 @@ function validateBenchmark(
     pushError(
       errors,
       [...pathSegments, "kind"],
-      "Benchmark 'kind' must be 'micro' or 'workflow'.",
+      "Benchmark 'kind' must be 'micro', 'workflow' or 'scaling'.",
     );
     return null;
   }
 
   const kind = record.kind;
-  if (kind !== "micro" && kind !== "workflow") {
+  if (kind !== "micro" && kind !== "workflow" && kind !== "scaling") {
     pushError(
       errors,
       [...pathSegments, "kind"],
-      "Benchmark 'kind' must be 'micro' or 'workflow'.",
+      "Benchmark 'kind' must be 'micro', 'workflow' or 'scaling'.",
     );
     return null;
   }
@@ -485,8 +566,10 @@ function validateBenchmark(
 
   if (kind === "micro") {
     validateMicroBenchmark(record, errors, pathSegments, options);
-  } else {
+  } else if (kind === "workflow") {
     validateWorkflowBenchmark(record, errors, pathSegments, options);
+  } else {
+    validateScalingBenchmark(record, errors, pathSegments, options);
   }
 
   return record as unknown as BenchmarkV1;
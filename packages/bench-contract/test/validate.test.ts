@@ -51,7 +51,7 @@ describe("validateBenchmarkSuiteV1", () => {
     if (result.ok) return;
 
     const messages = result.errors.map((e) => e.message).join("\n");
-    expect(messages).toContain("Benchmark 'kind' must be 'micro' or 'workflow'.");
+    expect(messages).toContain("Benchmark 'kind' must be 'micro', 'workflow' or 'scaling'.");
     expect(messages).toContain("Duplicate benchmark id 'dup'");
   });
 
@@ -163,4 +163,50 @@ describe("validateBenchmarkSuiteV1", () => {
       ]),
     );
   });
+
+  it("accepts scaling benchmarks and validates their sweep", () => {
+    const ok = validateBenchmarkSuiteV1(
+      {
+        schemaVersion: 1,
+        benchmarks: [
+          {
+            id: "s",
+            kind: "scaling",
+            call: "spkezr",
+            args: ["MOON", 0, "J2000", "NONE", "EARTH"],
+            sweep: { mode: "processes", workers: [1, 2, 4], batchSizes: [1, 64] },
+          },
+        ],
+      },
+      { repoRoot: process.cwd(), checkFixtureExistence: false },
+    );
+    expect(ok.ok).toBe(true);
+
+    const bad = validateBenchmarkSuiteV1(
+      {
+        schemaVersion: 1,
+        benchmarks: [
+          { id: "a", kind: "scaling", call: "noop", steps: [], sweep: { workers: [] } },
+          { id: "b", kind: "scaling", sweep: { mode: "fibers", workers: [1, 0], batchSizes: [2.5] } },
+          { id: "c", kind: "scaling", call: "noop" },
+        ],
+      },
+      { repoRoot: process.cwd(), checkFixtureExistence: false },
+    );
+
+    expect(bad.ok).toBe(false);
+    if (bad.ok) return;
+
+    expect(bad.errors).toEqual(
+      expect.arrayContaining([
+        { path: "$.benchmarks[0].steps", message: "Field 'steps' is not allowed when kind is 'scaling'." },
+        { path: "$.benchmarks[0].sweep.workers", message: "Expected a non-empty array of positive integers." },
+        { path: "$.benchmarks[1].call", message: "Scaling benchmark field 'call' must be a non-empty string." },
+        { path: "$.benchmarks[1].sweep.mode", message: "sweep.mode must be 'threads' or 'processes'." },
+        { path: "$.benchmarks[1].sweep.workers[1]", message: "Expected a positive integer." },
+        { path: "$.benchmarks[1].sweep.batchSizes[0]", message: "Expected a positive integer." },
+        { path: "$.benchmarks[2]", message: "Scaling benchmark is missing required field 'sweep'." },
+      ]),
+    );
+  });
 });
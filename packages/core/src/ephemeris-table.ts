@@ -0,0 +1,112 @@
+/**
+ * Reader for the piecewise-Chebyshev ephemeris tables built by the Node backend's
+ * `ephemerisTableBuild`.
+ *
+ * A table is a flat little-endian `ArrayBuffer`:
+ *
+ * - `u32` magic `"TSET"`, `u32` version (1), `u32` segments, `u32` coefficients per component
+ * - `f64` tolerance (km), `f64` largest error seen while fitting (km)
+ * - `f64` breakpoints (`segments + 1`, increasing)
+ * - `f64` coefficients, `[segment][x|y|z][coefficient]`, for `sum c[j] T_j(x)` on each piece
+ *
+ * Evaluation is plain arithmetic on the buffer (no CSPICE, no kernels), so tables can be shipped
+ * to a worker or a browser and sampled every frame there.
+ */
+
+const MAGIC = 0x54455354;
+const VERSION = 1;
+const HEADER_BYTES = 32;
+
+/** A parsed table; cheap views over the original buffer. */
+export type EphemerisTable = {
+  /** Fit tolerance requested at build time (km). */
+  tolerance: number;
+  /** Largest position error measured at the fit's check points (km). */
+  maxError: number;
+  /** First and last epoch covered (TDB seconds past J2000). */
+  et0: number;
+  et1: number;
+  segments: number;
+  coefficients: number;
+  breaks: Float64Array;
+  coeffs: Float64Array;
+};
+
+/** Validates and wraps a table buffer. Throws when it is not a well-formed table. */
+export function parseEphemerisTable(buffer: ArrayBuffer): EphemerisTable {
+  if (!(buffer instanceof ArrayBuffer) || buffer.byteLength < HEADER_BYTES) {
+    throw new Error("Invalid ephemeris table: buffer is shorter than the table header");
+  }
+  const view = new DataView(buffer);
+  if (view.getUint32(0, true) !== MAGIC || view.getUint32(4, true) !== VERSION) {
+    throw new Error("Invalid ephemeris table: bad magic or version");
+  }
+  const segments = view.getUint32(8, true);
+  const coefficients = view.getUint32(12, true);
+  const doubles = segments + 1 + segments * 3 * coefficients;
+  if (segments === 0 || coefficients === 0 || buffer.byteLength !== HEADER_BYTES + doubles * 8) {
+    throw new Error("Invalid ephemeris table: size does not match its header");
+  }
+
+  const breaks = new Float64Array(buffer, HEADER_BYTES, segments + 1);
+  return {
+    tolerance: view.getFloat64(16, true),
+    maxError: view.getFloat64(24, true),
+    et0: breaks[0]!,
+    et1: breaks[segments]!,
+    segments,
+    coefficients,
+    breaks,
+    coeffs: new Float64Array(buffer, HEADER_BYTES + (segments + 1) * 8, segments * 3 * coefficients),
+  };
+}
+
+/**
+ * State (km, km/s) at `et` written to `out[offset..offset + 6)`. Velocities are the derivative of
+ * the position fit. Returns `false` (leaving `out` untouched) when `et` is outside the table.
+ */
+export function evaluateEphemerisTable(table: EphemerisTable, et: number, out: Float64Array, offset = 0): boolean {
+  const { breaks, coeffs, segments, coefficients: n } = table;
+  if (!(et >= breaks[0]! && et <= breaks[segments]!)) return false;
+
+  // Last breakpoint <= et; `et1` itself belongs to the final piece.
+  let lo = 0;
+  let hi = segments - 1;
+  while (lo < hi) {
+    const mid = (lo + hi + 1) >> 1;
+    if (breaks[mid]! <= et) lo = mid;
+    else hi = mid - 1;
+  }
+
+  const a = breaks[lo]!;
+  const b = breaks[lo + 1]!;
+  const x = (2 * et - (a + b)) / (b - a);
+  const dxdt = 2 / (b - a);
+  const base = lo * 3 * n;
+  for (let axis = 0; axis < 3; axis++) {
+    const c = base + axis * n;
+    let t0 = 1;
+    let t1 = x;
+    let d0 = 0;
+    let d1 = 1;
+    let value = coeffs[c]!;
+    let slope = 0;
+    if (n > 1) {
+      value += coeffs[c + 1]! * x;
+      slope += coeffs[c + 1]!;
+    }
+    for (let j = 2; j < n; j++) {
+      const t2 = 2 * x * t1 - t0;
+      const d2 = 2 * t1 + 2 * x * d1 - d0;
+      value += coeffs[c + j]! * t2;
+      slope += coeffs[c + j]! * d2;
+      t0 = t1;
+      t1 = t2;
+      d0 = d1;
+      d1 = d2;
+    }
+    out[offset + axis] = value;
+    out[offset + axis + 3] = slope * dxdt;
+  }
+  return true;
+}
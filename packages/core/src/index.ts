@@ -78,3 +78,9 @@ export function normalizeVirtualKernelPath(input: string): string {
 
   return out.join("/");
 }
+
+export type { EphemerisTable } from "./ephemeris-table.js";
+export { evaluateEphemerisTable, parseEphemerisTable } from "./ephemeris-table.js";
+
+export type { NameTableIndex, PackedNameTable } from "./name-table.js";
+export { indexNameTable, normalizeSpiceName } from "./name-table.js";
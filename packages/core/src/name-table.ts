@@ -0,0 +1,70 @@
+/**
+ * Local lookups over the packed ID/name tables exported by the Node backend's
+ * `exportBodyNameTable` / `exportFrameTable`.
+ *
+ * A table lists `codes[i]` with name `i` stored as the ASCII text
+ * `names.bytes[names.offsets[i], names.offsets[i + 1])`. Body tables also
+ * carry `primary[i]`, set on the one name per code that `bodc2n` returns.
+ * `generation` is the kernel-pool generation the table was read at; refresh
+ * the table when `kernelPoolGeneration()` moves past it.
+ */
+
+/** Packed table as returned by the native exports. */
+export type PackedNameTable = {
+  generation: number;
+  codes: Int32Array;
+  names: { offsets: Int32Array; bytes: Uint8Array };
+  /** Body tables only: 1 on the name `bodc2n` returns for its code. */
+  primary?: Uint8Array;
+};
+
+/** In-memory index over a {@link PackedNameTable}. */
+export type NameTableIndex = {
+  generation: number;
+  /** Every entry, in table order. */
+  entries: ReadonlyArray<{ code: number; name: string }>;
+  /** Code for `name`, compared the way CSPICE does (case-insensitive, blanks collapsed). */
+  codeOf(name: string): number | undefined;
+  /** Name for `code` (the `bodc2n` name for body tables; the first listed otherwise). */
+  nameOf(code: number): string | undefined;
+};
+
+/** CSPICE's name comparison key: upper case, trimmed, runs of blanks collapsed to one. */
+export function normalizeSpiceName(name: string): string {
+  return name.trim().replace(/\s+/g, " ").toUpperCase();
+}
+
+/** Decodes `table` once and builds both lookup directions. */
+export function indexNameTable(table: PackedNameTable): NameTableIndex {
+  const { codes, names, primary } = table;
+  if (names.offsets.length !== codes.length + 1) {
+    throw new Error("Invalid name table: offsets must have one more entry than codes");
+  }
+
+  const entries: { code: number; name: string }[] = [];
+  const byName = new Map<string, number>();
+  const byCode = new Map<number, string>();
+  for (let i = 0; i < codes.length; i++) {
+    const code = codes[i]!;
+    let name = "";
+    for (let b = names.offsets[i]!; b < names.offsets[i + 1]!; b++) {
+      name += String.fromCharCode(names.bytes[b]!);
+    }
+    entries.push({ code, name });
+
+    const key = normalizeSpiceName(name);
+    if (!byName.has(key)) {
+      byName.set(key, code);
+    }
+    if (primary ? primary[i] === 1 : !byCode.has(code)) {
+      byCode.set(code, name);
+    }
+  }
+
+  return {
+    generation: table.generation,
+    entries,
+    codeOf: (name) => byName.get(normalizeSpiceName(name)),
+    nameOf: (code) => byCode.get(code),
+  };
+}
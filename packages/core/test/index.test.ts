@@ -1,6 +1,13 @@
 import { describe, expect, it } from "vitest";
 
-import { assertNever, invariant, normalizeVirtualKernelPath } from "@rybosome/tspice-core";
+import {
+  assertNever,
+  evaluateEphemerisTable,
+  indexNameTable,
+  invariant,
+  normalizeVirtualKernelPath,
+  parseEphemerisTable,
+} from "@rybosome/tspice-core";
 
 describe("@rybosome/tspice-core", () => {
   it("throws when condition is false", () => {
@@ -18,4 +25,46 @@ describe("@rybosome/tspice-core", () => {
     expect(() => normalizeVirtualKernelPath("/kernels")).toThrow("Invalid kernel path");
     expect(() => normalizeVirtualKernelPath("kernels")).toThrow("Invalid kernel path");
   });
+
+  it("evaluates piecewise-Chebyshev ephemeris tables", () => {
+    // Two pieces, [0, 10] and [10, 30], 2 coefficients each: x = t, y = 2t, z = 7.
+    const breaks = [0, 10, 30];
+    const coeffs = [5, 5, 10, 10, 7, 0, 20, 10, 40, 20, 7, 0];
+    const buffer = new ArrayBuffer(32 + (breaks.length + coeffs.length) * 8);
+    const view = new DataView(buffer);
+    view.setUint32(0, 0x54455354, true);
+    view.setUint32(4, 1, true);
+    view.setUint32(8, 2, true);
+    view.setUint32(12, 2, true);
+    view.setFloat64(16, 1e-3, true);
+    new Float64Array(buffer, 32).set([...breaks, ...coeffs]);
+
+    const table = parseEphemerisTable(buffer);
+    expect([table.et0, table.et1, table.segments, table.tolerance]).toEqual([0, 30, 2, 1e-3]);
+
+    const out = new Float64Array(6);
+    for (const et of [0, 4, 10, 25, 30]) {
+      expect(evaluateEphemerisTable(table, et, out)).toBe(true);
+      expect(Array.from(out)).toEqual([et, 2 * et, 7, 1, 2, 0]);
+    }
+    expect(evaluateEphemerisTable(table, 31, out)).toBe(false);
+    expect(() => parseEphemerisTable(buffer.slice(0, 40))).toThrow("Invalid ephemeris table");
+  });
+
+  it("indexes packed ID/name tables", () => {
+    const text = "EARTHMOONEARTH BARYCENTER";
+    const index = indexNameTable({
+      generation: 3,
+      codes: Int32Array.from([399, 301, 3]),
+      names: { offsets: Int32Array.from([0, 5, 9, 25]), bytes: new TextEncoder().encode(text) },
+      primary: Uint8Array.from([1, 1, 1]),
+    });
+
+    expect(index.generation).toBe(3);
+    expect(index.codeOf("  earth   barycenter ")).toBe(3);
+    expect(index.codeOf("moon")).toBe(301);
+    expect(index.codeOf("PLUTO")).toBeUndefined();
+    expect(index.nameOf(399)).toBe("EARTH");
+    expect(index.entries).toHaveLength(3);
+  });
 });
@@ -60,6 +60,10 @@ export type SpiceClientsWebWorkerOptions = {
   terminateOnDispose?: boolean;
   /** Forwarded to `createWorkerTransport`. Defaults to `terminateOnDispose`. */
   signalDispose?: boolean;
+  /** Forwarded to `createWorkerTransport` (coalesce requests into one message). */
+  batchWindowMs?: number;
+  /** Forwarded to `createWorkerTransport` (binary framing for numeric arguments). */
+  binary?: boolean;
 };
 
 export type SpiceClientsBuilder = {
@@ -372,6 +376,8 @@ function createBuilder(state: BuilderState): SpiceClientsBuilder {
         ...(ww?.timeoutMs === undefined ? {} : { timeoutMs: ww.timeoutMs }),
         terminateOnDispose,
         signalDispose,
+        ...(ww?.batchWindowMs === undefined ? {} : { batchWindowMs: ww.batchWindowMs }),
+        ...(ww?.binary === undefined ? {} : { binary: ww.binary }),
       });
 
       const baseTransport: SpiceTransport = workerTransport;
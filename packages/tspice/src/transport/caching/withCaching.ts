@@ -27,10 +27,20 @@ export type CachingTransport = SpiceTransport & {
    *   timers and clear cache.
    */
   clear(): void;
-  /** Stop any sweep timers and clear all cached entries. */
+  /** Stop any sweep timers, unsubscribe from `invalidateOn`, and clear all cached entries. */
   dispose(): void;
 };
 
+/**
+ * A change notification fed to a caching transport through
+ * `WithCachingOptions.invalidateOn` (structurally compatible with the Node
+ * backend's kernel-pool change events, whose `kinds` are `"kernels"`,
+ * `"variables"` and `"bodies"`).
+ */
+export type CacheInvalidationEvent = {
+  kinds: readonly string[];
+};
+
 export type WithCachingOptions = {
   /**
    * Maximum number of entries to retain (LRU-evicted on overflow).
@@ -119,6 +129,27 @@ export type WithCachingOptions = {
    * `"no-store"` as a guardrail.
    */
   allowUnsafePolicyOverrides?: boolean;
+
+  /**
+   * Optional change feed for selective invalidation, e.g.
+   * `(listener) => backend.subscribeKernelPoolChanges(listener)` on the Node
+   * backend.
+   *
+   * Subscribed once when the wrapper is created; the returned unsubscribe
+   * function is called by `dispose()`. On each event, cached (and in-flight)
+   * entries whose op `isInvalidatedBy` accepts are dropped; the rest are kept.
+   */
+  invalidateOn?: (
+    listener: (event: CacheInvalidationEvent) => void,
+  ) => () => void;
+
+  /**
+   * Whether `event` invalidates cached results of `op`.
+   *
+   * Defaults to `true` for every op, so any change drops the whole cache.
+   * Only consulted when `invalidateOn` is set.
+   */
+  isInvalidatedBy?: (op: string, event: CacheInvalidationEvent) => boolean;
 };
 
 export type WithCachingResult = SpiceTransport | CachingTransport;
@@ -140,6 +171,7 @@ export function isCachingTransport(t: unknown): t is CachingTransport {
 }
 
 type CacheEntry = {
+  op: string;
   promise: Promise<unknown>;
   /** Epoch ms (exclusive). `undefined` => no TTL */
   expiresAt?: number;
@@ -425,12 +457,31 @@ export function withCaching(
     cache.clear();
   };
 
+  const isInvalidatedBy = opts?.isInvalidatedBy;
+  const invalidate = (event: CacheInvalidationEvent): void => {
+    if (isInvalidatedBy === undefined) {
+      cache.clear();
+      return;
+    }
+
+    for (const [k, entry] of cache) {
+      if (isInvalidatedBy(entry.op, event)) cache.delete(k);
+    }
+  };
+  let unsubscribe = opts?.invalidateOn?.(invalidate);
+
   const dispose = (): void => {
     if (sweepTimer !== undefined) {
       clearInterval(sweepTimer);
       sweepTimer = undefined;
     }
 
+    if (unsubscribe !== undefined) {
+      const fn = unsubscribe;
+      unsubscribe = undefined;
+      fn();
+    }
+
     cache.clear();
   };
 
@@ -489,7 +540,7 @@ export function withCaching(
       },
     );
 
-    cache.set(k, { promise });
+    cache.set(k, { op, promise });
     enforceMaxEntries();
 
     return promise;
@@ -4,6 +4,7 @@ import { createCachePolicy } from "./policy.js";
 
 import {
   defaultSpiceCacheKey,
+  type CacheInvalidationEvent,
   type WithCachingOptions,
 } from "./withCaching.js";
 
@@ -26,7 +27,7 @@ export type CachingTransportSync = SpiceTransportSync & {
    *   timers and clear cache.
    */
   clear(): void;
-  /** Stop any sweep timers and clear all cached entries. */
+  /** Stop any sweep timers, unsubscribe from `invalidateOn`, and clear all cached entries. */
   dispose(): void;
 };
 
@@ -49,6 +50,7 @@ export function isCachingTransportSync(t: unknown): t is CachingTransportSync {
 }
 
 type CacheEntry = {
+  op: string;
   value: unknown;
   /** Epoch ms (exclusive). `undefined` => no TTL */
   expiresAt?: number;
@@ -154,12 +156,31 @@ export function withCachingSync(
     cache.clear();
   };
 
+  const isInvalidatedBy = opts?.isInvalidatedBy;
+  const invalidate = (event: CacheInvalidationEvent): void => {
+    if (isInvalidatedBy === undefined) {
+      cache.clear();
+      return;
+    }
+
+    for (const [k, entry] of cache) {
+      if (isInvalidatedBy(entry.op, event)) cache.delete(k);
+    }
+  };
+  let unsubscribe = opts?.invalidateOn?.(invalidate);
+
   const dispose = (): void => {
     if (sweepTimer !== undefined) {
       clearInterval(sweepTimer);
       sweepTimer = undefined;
     }
 
+    if (unsubscribe !== undefined) {
+      const fn = unsubscribe;
+      unsubscribe = undefined;
+      fn();
+    }
+
     cache.clear();
   };
 
@@ -207,7 +228,7 @@ export function withCachingSync(
       throw err;
     }
 
-    const entry: CacheEntry = { value };
+    const entry: CacheEntry = { op, value };
     if (ttlMs !== undefined && ttlMs > 0) {
       entry.expiresAt = now() + ttlMs;
     }
@@ -1,6 +1,8 @@
 export const tspiceRpcRequestType = "tspice:request" as const;
 export const tspiceRpcResponseType = "tspice:response" as const;
 export const tspiceRpcDisposeType = "tspice:dispose" as const;
+export const tspiceRpcBatchRequestType = "tspice:batch-request" as const;
+export const tspiceRpcBatchResponseType = "tspice:batch-response" as const;
 
 export type RpcRequest = {
   type: typeof tspiceRpcRequestType;
@@ -33,8 +35,24 @@ export type RpcResponse =
       error: SerializedError;
     };
 
-export type RpcMessageFromMain = RpcRequest | RpcDispose;
-export type RpcMessageFromWorker = RpcResponse;
+/**
+ * Several requests coalesced into one message (see `batchWindowMs` on
+ * `createWorkerTransport`). Entries are handled exactly like individual
+ * requests; the worker answers with one {@link RpcBatchResponse} once every
+ * entry has settled.
+ */
+export type RpcBatchRequest = {
+  type: typeof tspiceRpcBatchRequestType;
+  requests: Omit<RpcRequest, "type">[];
+};
+
+export type RpcBatchResponse = {
+  type: typeof tspiceRpcBatchResponseType;
+  responses: RpcResponse[];
+};
+
+export type RpcMessageFromMain = RpcRequest | RpcBatchRequest | RpcDispose;
+export type RpcMessageFromWorker = RpcResponse | RpcBatchResponse;
 
 /** Serialize an unknown error into a structured, transferable shape for RPC. */
 export function serializeError(err: unknown): SerializedError {
@@ -17,6 +17,19 @@ type TaggedMat3RowMajor = {
   data: readonly number[];
 };
 
+// Binary framing (see `EncodeRpcValueOptions.binary`): numeric arrays packed
+// into a `Float64Array`, either flat or as equal-width rows.
+type TaggedFloat64Array = {
+  [tspiceRpcTagKey]: "F64";
+  data: Float64Array;
+};
+
+type TaggedFloat64Rows = {
+  [tspiceRpcTagKey]: "F64Rows";
+  width: number;
+  data: Float64Array;
+};
+
 type TaggedRecord = Record<string, unknown> & {
   [tspiceRpcTagKey]?: unknown;
 };
@@ -39,8 +52,60 @@ function isMat3RowMajorData(value: unknown): value is readonly number[] {
   );
 }
 
+// Below this many numbers, packing costs more than cloning the array.
+const BINARY_MIN_NUMBERS = 16;
+
+export type EncodeRpcValueOptions = {
+  /**
+   * Pack numeric arrays (`number[]`, and `number[][]` with rows of one width,
+   * e.g. a batch of states) of at least 16 numbers into a `Float64Array`.
+   * {@link decodeRpcValue} restores the plain arrays, so the value's shape is
+   * unchanged for the caller.
+   */
+  binary?: boolean;
+  /**
+   * Receives the `ArrayBuffer` of every array packed by `binary`. The encoder
+   * allocates these itself, so they are always safe to pass as the
+   * `postMessage` transfer list (caller-owned typed arrays are never added).
+   */
+  transfer?: ArrayBuffer[];
+};
+
+function isNumberArray(value: readonly unknown[]): value is readonly number[] {
+  for (let i = 0; i < value.length; i++) {
+    if (typeof value[i] !== "number") return false;
+  }
+  return true;
+}
+
+function packNumericArray(
+  value: readonly unknown[],
+  opts: EncodeRpcValueOptions,
+): TaggedFloat64Array | TaggedFloat64Rows | undefined {
+  if (value.length >= BINARY_MIN_NUMBERS && isNumberArray(value)) {
+    const data = Float64Array.from(value);
+    opts.transfer?.push(data.buffer);
+    return { [tspiceRpcTagKey]: "F64", data };
+  }
+
+  const first = value[0];
+  if (value.length < 2 || !Array.isArray(first) || first.length === 0) return undefined;
+  const width = first.length;
+  if (value.length * width < BINARY_MIN_NUMBERS) return undefined;
+  for (const row of value) {
+    if (!Array.isArray(row) || row.length !== width || !isNumberArray(row)) return undefined;
+  }
+
+  const data = new Float64Array(value.length * width);
+  for (let i = 0; i < value.length; i++) {
+    data.set(value[i] as readonly number[], i * width);
+  }
+  opts.transfer?.push(data.buffer);
+  return { [tspiceRpcTagKey]: "F64Rows", width, data };
+}
+
 /** Encode an arbitrary value into a structured-clone-safe shape. */
-export function encodeRpcValue(value: unknown): unknown {
+export function encodeRpcValue(value: unknown, opts?: EncodeRpcValueOptions): unknown {
   if (value instanceof Mat3) {
     const data = Array.from(value.rowMajor as readonly number[]);
     return {
@@ -51,7 +116,11 @@ export function encodeRpcValue(value: unknown): unknown {
   }
 
   if (Array.isArray(value)) {
-    return value.map(encodeRpcValue);
+    if (opts?.binary) {
+      const packed = packNumericArray(value, opts);
+      if (packed) return packed;
+    }
+    return value.map((v) => encodeRpcValue(v, opts));
   }
 
   // Fast-path: ArrayBuffer + views (TypedArrays/DataView) are structured-clone-
@@ -95,7 +164,7 @@ export function encodeRpcValue(value: unknown): unknown {
 
     const out: Record<string, unknown> = {};
     for (const [k, v] of Object.entries(value)) {
-      out[k] = encodeRpcValue(v);
+      out[k] = encodeRpcValue(v, opts);
     }
     return out;
   }
@@ -118,6 +187,22 @@ export function decodeRpcValue(value: unknown): unknown {
         return Mat3.fromRowMajor(data as unknown as Mat3RowMajorInput);
       }
     }
+
+    if (tag === "F64" && value.data instanceof Float64Array) {
+      return Array.from(value.data);
+    }
+
+    if (tag === "F64Rows" && value.data instanceof Float64Array) {
+      const width = value.width;
+      const data = value.data;
+      if (typeof width === "number" && Number.isInteger(width) && width > 0 && data.length % width === 0) {
+        const rows: number[][] = [];
+        for (let i = 0; i < data.length; i += width) {
+          rows.push(Array.from(data.subarray(i, i + width)));
+        }
+        return rows;
+      }
+    }
   }
 
   if (Array.isArray(value)) {
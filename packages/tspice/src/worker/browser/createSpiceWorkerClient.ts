@@ -67,6 +67,10 @@ export type CreateSpiceWorkerClientOptions<
   terminateOnDispose?: boolean;
   /** Forwarded to `createWorkerTransport`. Defaults to `terminateOnDispose`. */
   signalDispose?: boolean;
+  /** Forwarded to `createWorkerTransport` (coalesce requests into one message). */
+  batchWindowMs?: number;
+  /** Forwarded to `createWorkerTransport` (binary framing for numeric arguments). */
+  binary?: boolean;
   /** Optional transport wrapper (e.g. `withCaching`). */
   wrapTransport?: (t: WorkerTransport) => TTransport;
 
@@ -95,6 +99,10 @@ export function createSpiceWorkerClient<
     ...(opts?.signalDispose === undefined
       ? {}
       : { signalDispose: opts.signalDispose }),
+    ...(opts?.batchWindowMs === undefined
+      ? {}
+      : { batchWindowMs: opts.batchWindowMs }),
+    ...(opts?.binary === undefined ? {} : { binary: opts.binary }),
   });
 
   const transport = opts?.wrapTransport
@@ -161,6 +161,9 @@ exposeTransportToWorker({
     request: async (op: string, args: unknown[]): Promise<unknown> =>
       (await getTransportPromise()).request(op, args),
   },
+  // Results are decoded back to plain arrays by every tspice client, so binary
+  // framing is always safe to enable here.
+  binary: true,
   onDispose: async () => {
     // Best-effort cleanup. Worker termination also releases resources, but this
     // helps callers who keep the worker alive.
@@ -1,8 +1,16 @@
 import type { SpiceTransport } from "../../transport/types.js";
 
-import type { RpcDispose, RpcRequest, RpcResponse } from "../../transport/rpc/protocol.js";
+import type {
+  RpcBatchRequest,
+  RpcBatchResponse,
+  RpcDispose,
+  RpcRequest,
+  RpcResponse,
+} from "../../transport/rpc/protocol.js";
 import {
   deserializeError,
+  tspiceRpcBatchRequestType,
+  tspiceRpcBatchResponseType,
   tspiceRpcDisposeType,
   tspiceRpcRequestType,
   tspiceRpcResponseType,
@@ -11,7 +19,7 @@ import { decodeRpcValue, encodeRpcValue } from "../../transport/rpc/valueCodec.j
 import { canQueueMacrotask, queueMacrotask } from "../../transport/rpc/taskScheduling.js";
 
 export type WorkerLike = {
-  postMessage(message: unknown): void;
+  postMessage(message: unknown, transfer?: ArrayBuffer[]): void;
   addEventListener(type: string, listener: (ev: unknown) => void): void;
   removeEventListener(type: string, listener: (ev: unknown) => void): void;
   terminate(): void;
@@ -103,6 +111,31 @@ export function createWorkerTransport(opts: {
    * externally coordinated.
    */
   signalDispose?: boolean;
+
+  /**
+   * Coalesce requests into one `tspice:batch-request` message.
+   *
+   * Requests made within the window are posted together (the worker answers
+   * with one message once they have all settled). `0` batches the requests
+   * issued in the same tick; a positive value waits that many milliseconds.
+   * `undefined` (the default) posts every request on its own.
+   */
+  batchWindowMs?: number;
+
+  /** Flush a batch early once it holds this many requests. Defaults to `1024`. */
+  maxBatchSize?: number;
+
+  /**
+   * Binary framing for request arguments: numeric arrays of at least 16
+   * numbers (flat, or rows of one width) are packed into a `Float64Array`
+   * whose buffer is transferred rather than cloned. Caller-owned typed arrays
+   * are still copied, never detached.
+   *
+   * Pair with `exposeTransportToWorker({ binary: true })` for results.
+   *
+   * Defaults to `false`.
+   */
+  binary?: boolean;
 }): WorkerTransport {
   let worker: WorkerLike | undefined;
   // Retain a reference for best-effort dispose signaling even after terminal
@@ -120,6 +153,19 @@ export function createWorkerTransport(opts: {
 
   const signalDispose = opts.signalDispose ?? terminateOnDispose;
 
+  const batchWindowMs = opts.batchWindowMs;
+  if (batchWindowMs !== undefined && !(Number.isFinite(batchWindowMs) && batchWindowMs >= 0)) {
+    throw new Error("createWorkerTransport(): batchWindowMs must be a finite number >= 0");
+  }
+  if (batchWindowMs !== undefined && batchWindowMs > 0 && typeof setTimeout !== "function") {
+    throw new Error(`createWorkerTransport(): batchWindowMs=${batchWindowMs} requires setTimeout`);
+  }
+  const maxBatchSize = opts.maxBatchSize ?? 1024;
+  if (!Number.isInteger(maxBatchSize) || maxBatchSize < 1) {
+    throw new Error("createWorkerTransport(): maxBatchSize must be an integer >= 1");
+  }
+  const binary = opts.binary ?? false;
+
   let didSignalDispose = false;
 
   const signalDisposeOnce = (): void => {
@@ -168,6 +214,17 @@ export function createWorkerTransport(opts: {
   // Whether a single macrotask has been queued to settle all currently-queued responses.
   let settlementQueued = false;
 
+  type Outgoing = {
+    pending: Pending;
+    request: Omit<RpcRequest, "type">;
+    transfer: ArrayBuffer[];
+  };
+
+  // Requests waiting for the batch window to close (only used with `batchWindowMs`).
+  let outbox: Outgoing[] = [];
+  let outboxTimer: ReturnType<typeof setTimeout> | undefined;
+  let outboxScheduled = false;
+
   let nextId = 1;
 
   const formatRequestContext = (op: string, id?: number): string =>
@@ -227,6 +284,14 @@ export function createWorkerTransport(opts: {
     // Prevent any future settlement work from being queued.
     settlementQueued = false;
 
+    // Batched requests not yet posted are still in `pendingById` and get
+    // rejected below.
+    outbox = [];
+    if (outboxTimer !== undefined) {
+      clearTimeout(outboxTimer);
+      outboxTimer = undefined;
+    }
+
     rejectAllPending(opts?.getReason ?? (() => err));
 
     // Prefer the latest live worker for any best-effort dispose signaling.
@@ -335,10 +400,23 @@ export function createWorkerTransport(opts: {
   };
 
   const onMessage = (ev: unknown): void => {
-    const msg = (ev as { data?: unknown } | null | undefined)?.data as
-      | Partial<RpcResponse>
+    const data = (ev as { data?: unknown } | null | undefined)?.data as
+      | { type?: unknown }
       | null
       | undefined;
+    if (!data) return;
+
+    if (data.type === tspiceRpcBatchResponseType) {
+      const responses = (data as Partial<RpcBatchResponse>).responses;
+      if (!Array.isArray(responses)) return;
+      for (const res of responses) onResponse(res as Partial<RpcResponse> | null | undefined);
+      return;
+    }
+
+    onResponse(data as Partial<RpcResponse>);
+  };
+
+  const onResponse = (msg: Partial<RpcResponse> | null | undefined): void => {
     if (!msg || msg.type !== tspiceRpcResponseType || typeof msg.id !== "number") return;
 
     const id = msg.id;
@@ -419,6 +497,71 @@ export function createWorkerTransport(opts: {
     });
   };
 
+  const postRequests = (w: WorkerLike, batch: readonly Outgoing[]): void => {
+    let msg: RpcRequest | RpcBatchRequest;
+    let transfer: ArrayBuffer[];
+    if (batch.length === 1) {
+      msg = { type: tspiceRpcRequestType, ...batch[0]!.request };
+      transfer = batch[0]!.transfer;
+    } else {
+      msg = { type: tspiceRpcBatchRequestType, requests: batch.map((o) => o.request) };
+      transfer = batch.flatMap((o) => o.transfer);
+    }
+
+    try {
+      if (transfer.length > 0) {
+        w.postMessage(msg, transfer);
+      } else {
+        w.postMessage(msg);
+      }
+    } catch (err) {
+      for (const { pending, request } of batch) {
+        if (pendingById.get(request.id) !== pending) continue;
+        pendingById.delete(request.id);
+
+        const out = new Error(
+          `Worker postMessage failed ${formatRequestContext(request.op, request.id)}`,
+        );
+        (out as Error & { cause?: unknown }).cause = err;
+        pending.rejectAndCleanup(out);
+      }
+    }
+  };
+
+  const flushOutbox = (): void => {
+    outboxScheduled = false;
+    if (outboxTimer !== undefined) {
+      clearTimeout(outboxTimer);
+      outboxTimer = undefined;
+    }
+
+    const w = worker;
+    const batch = outbox;
+    outbox = [];
+    if (!w || batch.length === 0) return;
+
+    // Requests aborted or timed out while waiting are not sent at all.
+    const live = batch.filter((o) => pendingById.get(o.request.id) === o.pending);
+    if (live.length > 0) postRequests(w, live);
+  };
+
+  const enqueueOutgoing = (outgoing: Outgoing): void => {
+    outbox.push(outgoing);
+    if (outbox.length >= maxBatchSize) {
+      flushOutbox();
+      return;
+    }
+    if (outboxScheduled) return;
+    outboxScheduled = true;
+
+    if ((batchWindowMs ?? 0) > 0) {
+      outboxTimer = setTimeout(flushOutbox, batchWindowMs);
+    } else {
+      // Everything issued in the current tick goes out together.
+      void Promise.resolve().then(flushOutbox);
+    }
+  };
+
   const ensureWorker = (): WorkerLike => {
     ensureCanScheduleMacrotask();
 
@@ -555,15 +698,24 @@ export function createWorkerTransport(opts: {
         }, timeoutMs);
       }
 
-      const msg: RpcRequest = { type: tspiceRpcRequestType, id, op, args };
+      const transfer: ArrayBuffer[] = [];
+      let encodedArgs: unknown[];
       try {
-        w.postMessage({ ...msg, args: args.map(encodeRpcValue) });
+        encodedArgs = args.map((a) => encodeRpcValue(a, { binary, transfer }));
       } catch (err) {
         if (pendingById.get(id) === pending) pendingById.delete(id);
 
         const out = new Error(`Worker postMessage failed ${formatRequestContext(op, id)}`);
         (out as Error & { cause?: unknown }).cause = err;
         pending.rejectAndCleanup(out);
+        return;
+      }
+
+      const outgoing: Outgoing = { pending, request: { id, op, args: encodedArgs }, transfer };
+      if (batchWindowMs === undefined) {
+        postRequests(w, [outgoing]);
+      } else {
+        enqueueOutgoing(outgoing);
       }
     });
   };
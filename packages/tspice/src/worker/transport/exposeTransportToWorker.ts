@@ -1,8 +1,16 @@
 import type { SpiceTransport } from "../../transport/types.js";
 
-import type { RpcMessageFromMain, RpcRequest, RpcResponse } from "../../transport/rpc/protocol.js";
+import type {
+  RpcBatchRequest,
+  RpcBatchResponse,
+  RpcMessageFromMain,
+  RpcRequest,
+  RpcResponse,
+} from "../../transport/rpc/protocol.js";
 import {
   serializeError,
+  tspiceRpcBatchRequestType,
+  tspiceRpcBatchResponseType,
   tspiceRpcDisposeType,
   tspiceRpcRequestType,
   tspiceRpcResponseType,
@@ -13,7 +21,7 @@ import { queueMacrotask } from "../../transport/rpc/taskScheduling.js";
 type WorkerGlobalScopeLike = {
   addEventListener(type: "message", listener: (ev: { data: unknown }) => void): void;
   removeEventListener(type: "message", listener: (ev: { data: unknown }) => void): void;
-  postMessage(msg: unknown): void;
+  postMessage(msg: unknown, transfer?: ArrayBuffer[]): void;
   close?: () => void;
 };
 
@@ -54,6 +62,17 @@ export function exposeTransportToWorker(opts: {
    * - `1000` when `maxConcurrentRequests` is finite
    */
   maxQueuedRequests?: number;
+
+  /**
+   * Binary framing for results: numeric arrays of at least 16 numbers (flat,
+   * or rows of one width such as a batch of states) are packed into a
+   * `Float64Array` whose buffer is transferred rather than cloned. The client
+   * decodes them back to plain arrays, so this works with any
+   * `createWorkerTransport()`.
+   *
+   * Defaults to `false`.
+   */
+  binary?: boolean;
 }): { dispose: () => void } {
   const self = opts.self ?? (globalThis as unknown as WorkerGlobalScopeLike);
 
@@ -83,10 +102,26 @@ export function exposeTransportToWorker(opts: {
     }
   }
 
+  const binary = opts.binary ?? false;
+
   type QueuedRequest = {
     id: number;
     op: string;
     args: unknown[];
+    // Delivers the response: posted on its own, or collected into a batch.
+    reply: (res: RpcResponse, transfer: ArrayBuffer[]) => void;
+  };
+
+  const post = (msg: unknown, transfer: ArrayBuffer[]): void => {
+    if (transfer.length > 0) {
+      self.postMessage(msg, transfer);
+    } else {
+      self.postMessage(msg);
+    }
+  };
+
+  const replySingle = (res: RpcResponse, transfer: ArrayBuffer[]): void => {
+    post(res, transfer);
   };
 
   // FIFO queue with a moving head index to avoid O(n) `shift()`.
@@ -160,13 +195,14 @@ export function exposeTransportToWorker(opts: {
         const value = await opts.transport.request(req.op, req.args.map(decodeRpcValue));
         if (disposed) return;
 
+        const transfer: ArrayBuffer[] = [];
         const res: RpcResponse = {
           type: tspiceRpcResponseType,
           id: req.id,
           ok: true,
-          value: encodeRpcValue(value),
+          value: encodeRpcValue(value, { binary, transfer }),
         };
-        self.postMessage(res);
+        req.reply(res, transfer);
       } catch (err) {
         if (disposed) return;
 
@@ -176,7 +212,7 @@ export function exposeTransportToWorker(opts: {
           ok: false,
           error: serializeError(err),
         };
-        self.postMessage(res);
+        req.reply(res, []);
       } finally {
         inFlight -= 1;
         drain();
@@ -223,38 +259,85 @@ export function exposeTransportToWorker(opts: {
 
     if (msg.type === tspiceRpcRequestType) {
       const req = msg as Partial<RpcRequest>;
+      if (!isValidRequest(req)) return;
+      enqueue({ id: req.id, op: req.op, args: req.args, reply: replySingle });
+      return;
+    }
 
-      const id = req.id;
-      const op = req.op;
-      const args = req.args;
+    if (msg.type === tspiceRpcBatchRequestType) {
+      const requests = (msg as Partial<RpcBatchRequest>).requests;
+      if (!Array.isArray(requests)) return;
 
-      if (typeof id !== "number" || typeof op !== "string" || !Array.isArray(args)) {
-        return;
-      }
+      const valid = requests.filter(isValidRequest);
+      if (valid.length === 0) return;
 
-      const queuedReq: QueuedRequest = { id, op, args };
-      if (inFlight < maxConcurrentRequests) {
-        runRequest(queuedReq);
-      } else {
-        if (queuedSize() >= maxQueuedRequests) {
-          const res: RpcResponse = {
-            type: tspiceRpcResponseType,
-            id,
-            ok: false,
-            error: serializeError(
-              new Error(
-                `Worker backpressure queue overflow (maxQueuedRequests=${maxQueuedRequests})`,
-              ),
-            ),
-          };
-          self.postMessage(res);
-          return;
+      // Answer the whole batch with one message once every entry has settled.
+      const responses: RpcResponse[] = [];
+      const transfers: ArrayBuffer[] = [];
+      let remaining = valid.length;
+
+      const replyBatched = (res: RpcResponse, transfer: ArrayBuffer[]): void => {
+        responses.push(res);
+        transfers.push(...transfer);
+        remaining -= 1;
+        if (remaining > 0 || disposed) return;
+
+        const out: RpcBatchResponse = { type: tspiceRpcBatchResponseType, responses };
+        try {
+          post(out, transfers);
+        } catch {
+          // One unclonable value must not sink the rest of the batch.
+          for (const r of responses) postSingleOrError(r);
         }
-        queued.push(queuedReq);
+      };
+
+      for (const req of valid) {
+        enqueue({ id: req.id, op: req.op, args: req.args, reply: replyBatched });
       }
+      return;
+    }
+  };
+
+  const isValidRequest = (
+    req: Partial<Omit<RpcRequest, "type">> | null | undefined,
+  ): req is Omit<RpcRequest, "type"> =>
+    !!req && typeof req.id === "number" && typeof req.op === "string" && Array.isArray(req.args);
+
+  const postSingleOrError = (res: RpcResponse): void => {
+    try {
+      self.postMessage(res);
+    } catch (err) {
+      const out: RpcResponse = {
+        type: tspiceRpcResponseType,
+        id: res.id,
+        ok: false,
+        error: serializeError(err),
+      };
+      self.postMessage(out);
+    }
+  };
+
+  const enqueue = (queuedReq: QueuedRequest): void => {
+    if (inFlight < maxConcurrentRequests) {
+      runRequest(queuedReq);
+      return;
+    }
 
+    if (queuedSize() >= maxQueuedRequests) {
+      const res: RpcResponse = {
+        type: tspiceRpcResponseType,
+        id: queuedReq.id,
+        ok: false,
+        error: serializeError(
+          new Error(
+            `Worker backpressure queue overflow (maxQueuedRequests=${maxQueuedRequests})`,
+          ),
+        ),
+      };
+      queuedReq.reply(res, []);
       return;
     }
+    queued.push(queuedReq);
   };
 
   self.addEventListener("message", onMessage);
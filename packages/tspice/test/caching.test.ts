@@ -4,6 +4,7 @@ import {
   defaultSpiceCacheKey,
   isCachingTransport,
   withCaching,
+  type CacheInvalidationEvent,
 } from "../src/transport/caching/withCaching.js";
 import type { SpiceTransport } from "../src/transport/types.js";
 
@@ -121,4 +122,42 @@ describe("withCaching()", () => {
   it("disables caching when args contain binary-like data", () => {
     expect(defaultSpiceCacheKey("raw.foo", [new Uint8Array([1, 2, 3])])).toBe(null);
   });
+
+  it("drops only the entries a change event invalidates, and unsubscribes on dispose()", async () => {
+    let calls = 0;
+    const base: SpiceTransport = {
+      request: async (op) => {
+        calls += 1;
+        return `${op}:${calls}`;
+      },
+    };
+
+    let emit: ((event: CacheInvalidationEvent) => void) | undefined;
+    const transport = withCaching(base, {
+      maxEntries: Infinity,
+      now: () => 0,
+      invalidateOn: (listener) => {
+        emit = listener;
+        return () => {
+          emit = undefined;
+        };
+      },
+      isInvalidatedBy: (op, event) =>
+        event.kinds.includes("kernels") || (op === "raw.bodn2c" && event.kinds.includes("bodies")),
+    });
+    expect(isCachingTransport(transport)).toBe(true);
+
+    await expect(transport.request("raw.bodn2c", ["EARTH"])).resolves.toBe("raw.bodn2c:1");
+    await expect(transport.request("raw.str2et", ["2000"])).resolves.toBe("raw.str2et:2");
+
+    emit?.({ kinds: ["bodies"] });
+    await expect(transport.request("raw.bodn2c", ["EARTH"])).resolves.toBe("raw.bodn2c:3");
+    await expect(transport.request("raw.str2et", ["2000"])).resolves.toBe("raw.str2et:2");
+
+    emit?.({ kinds: ["kernels"] });
+    await expect(transport.request("raw.str2et", ["2000"])).resolves.toBe("raw.str2et:4");
+
+    if (isCachingTransport(transport)) transport.dispose();
+    expect(emit).toBeUndefined();
+  });
 });
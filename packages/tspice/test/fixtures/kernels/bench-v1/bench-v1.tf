@@ -0,0 +1,29 @@
+KPL/FK
+
+   bench-v1.tf
+
+   Names and frames for the synthetic bodies in bench-v1.bsp.
+
+   The Apophis DSK in ../dsk-minimal is expressed in frame ID -2099942000; it is defined here as
+   a fixed (TK) frame aligned with J2000 so the shape model can be used without the OSIRIS-REx
+   frame kernels.
+
+\begindata
+
+   NAIF_BODY_NAME += ( 'BENCH_SC', 'APOPHIS' )
+   NAIF_BODY_CODE += ( -900, 2099942 )
+
+   FRAME_BENCH_APOPHIS_FIXED   = -2099942000
+   FRAME_-2099942000_NAME      = 'BENCH_APOPHIS_FIXED'
+   FRAME_-2099942000_CLASS     = 4
+   FRAME_-2099942000_CLASS_ID  = -2099942000
+   FRAME_-2099942000_CENTER    = 2099942
+   TKFRAME_-2099942000_RELATIVE = 'J2000'
+   TKFRAME_-2099942000_SPEC     = 'MATRIX'
+   TKFRAME_-2099942000_MATRIX   = ( 1 0 0
+                                    0 1 0
+                                    0 0 1 )
+
+\begintext
+
+   This frame kernel is intended for benchmarks and tests only.
@@ -43,4 +43,24 @@ describe("rpc valueCodec", () => {
       b: { ok: true },
     });
   });
+
+  it("packs numeric arrays into transferable Float64Arrays in binary mode", () => {
+    const states = Array.from({ length: 4 }, (_, i) => [i, i + 0.5, -0, 3, 4, 5]);
+    const flat = Array.from({ length: 16 }, (_, i) => i / 3);
+    const transfer: ArrayBuffer[] = [];
+
+    const encoded = encodeRpcValue({ states, flat, small: [1, 2, 3] }, { binary: true, transfer }) as Record<
+      string,
+      { data?: unknown }
+    >;
+
+    expect(encoded.states?.data).toBeInstanceOf(Float64Array);
+    expect(encoded.flat?.data).toBeInstanceOf(Float64Array);
+    expect(encoded.small).toEqual([1, 2, 3]);
+    expect(transfer).toHaveLength(2);
+
+    const decoded = decodeRpcValue(encoded) as { states: number[][]; flat: number[] };
+    expect(decoded).toEqual({ states, flat, small: [1, 2, 3] });
+    expect(Object.is(decoded.states[0]![2], -0)).toBe(true);
+  });
 });
@@ -90,4 +90,48 @@ describe("worker transport", () => {
 
     transport.dispose();
   });
+
+  it("coalesces requests within batchWindowMs into one message each way", async () => {
+    const { worker, scope } = createConnectedWorkerPair();
+
+    const toWorker: unknown[] = [];
+    const toMain: Array<{ msg: unknown; transfer: ArrayBuffer[] | undefined }> = [];
+    const deliverToWorker = worker.onPostMessage!;
+    worker.onPostMessage = (msg) => {
+      toWorker.push(msg);
+      deliverToWorker(msg);
+    };
+    const deliverToMain = scope.onPostMessage!;
+    scope.postMessage = (msg: unknown, transfer?: ArrayBuffer[]) => {
+      toMain.push({ msg, transfer });
+      deliverToMain(msg);
+    };
+
+    const server: SpiceTransport = {
+      request: async (op, args) => {
+        if (op === "raw.fail") throw new Error("nope");
+        const et = args[0] as number;
+        return Array.from({ length: 8 }, (_, i) => [et, i, 0, 0, 0, 0]);
+      },
+    };
+    exposeTransportToWorker({ transport: server, self: scope, closeOnDispose: false, binary: true });
+
+    const transport = createWorkerTransport({ worker: () => worker, batchWindowMs: 0 });
+
+    const ok = [0, 1, 2].map((et) => transport.request("raw.states", [et]));
+    const failed = transport.request("raw.fail", []);
+
+    await expect(Promise.all(ok)).resolves.toEqual(
+      [0, 1, 2].map((et) => Array.from({ length: 8 }, (_, i) => [et, i, 0, 0, 0, 0])),
+    );
+    await expect(failed).rejects.toThrow("nope");
+
+    expect(toWorker).toHaveLength(1);
+    expect(toWorker[0]).toMatchObject({ type: "tspice:batch-request" });
+    expect(toMain).toHaveLength(1);
+    expect(toMain[0]!.msg).toMatchObject({ type: "tspice:batch-response" });
+    expect(toMain[0]!.transfer).toHaveLength(3);
+
+    transport.dispose();
+  });
 });
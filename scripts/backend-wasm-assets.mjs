@@ -1,3 +1,7 @@
 export const WASM_WEB_JS_FILENAME = "tspice_backend_wasm.web.js";
 export const WASM_NODE_JS_FILENAME = "tspice_backend_wasm.node.js";
 export const WASM_BINARY_FILENAME = "tspice_backend_wasm.wasm";
+
+// Optional second artifact built with `-msimd128`. It is driven by the same glue JS,
+// so only the wasm binary differs.
+export const WASM_SIMD_BINARY_FILENAME = "tspice_backend_wasm.simd.wasm";
@@ -0,0 +1,261 @@
+// Runs a v1 benchmark suite against one backend and prints the results as JSON on stdout.
+//
+// `bench-contract.mjs run` starts one of these per backend, so each backend gets a fresh process
+// and its RSS numbers are not polluted by the other. It can also be invoked directly:
+//
+//   node scripts/bench-contract-run.mjs --backend wasm benchmarks/contracts/v1/core.yml
+//
+// Runner semantics for the (opaque) contract fields:
+//   - `measure.warmup` / `measure.iterations`: untimed and timed iterations per benchmark.
+//   - micro: each case is timed on its own and reported as `<id>[<index>]`.
+//   - workflow: one iteration runs every step in order; `saveAs` values are visible to later steps
+//     through `{ $ref: var.<name> }`.
+//   - scaling: every `sweep.workers` x `sweep.batchSizes` configuration runs in its own process
+//     (scripts/bench-contract-scaling.mjs) and is reported as `<id>[w=<workers>,b=<batchSize>]`;
+//     `measure.warmup` / `measure.iterations` count batches per worker.
+//   - Kernels are `defaults.setup.kernels` followed by the benchmark's own, loaded as in-memory
+//     bytes before the benchmark and cleared (`kclear`) after it.
+
+import { spawnSync } from "node:child_process";
+import fs from "node:fs";
+import path from "node:path";
+import process from "node:process";
+import { fileURLToPath, pathToFileURL } from "node:url";
+
+const scriptsDir = path.dirname(fileURLToPath(import.meta.url));
+const repoRoot = path.resolve(scriptsDir, "..");
+
+const scalingRunnerPath = path.join(scriptsDir, "bench-contract-scaling.mjs");
+
+const DEFAULT_WARMUP = 10;
+const DEFAULT_ITERATIONS = 100;
+
+// Keeps results reachable so no step can be optimized away.
+let sink = null;
+
+function readMeasure(measure) {
+  const warmup = measure?.warmup ?? DEFAULT_WARMUP;
+  const iterations = measure?.iterations ?? DEFAULT_ITERATIONS;
+  if (!Number.isInteger(warmup) || warmup < 0) {
+    throw new Error(`measure.warmup must be a non-negative integer (got ${String(warmup)})`);
+  }
+  if (!Number.isInteger(iterations) || iterations < 1) {
+    throw new Error(`measure.iterations must be a positive integer (got ${String(iterations)})`);
+  }
+  return { warmup, iterations };
+}
+
+export function resolveArgs(value, vars) {
+  if (Array.isArray(value)) return value.map((v) => resolveArgs(v, vars));
+  if (value !== null && typeof value === "object") {
+    if (typeof value.$ref === "string") return vars.get(value.$ref.slice("var.".length));
+    return Object.fromEntries(Object.entries(value).map(([k, v]) => [k, resolveArgs(v, vars)]));
+  }
+  return value;
+}
+
+export function bindCall(backend, call) {
+  const fn = backend[call];
+  if (typeof fn !== "function") {
+    throw new Error(`Backend has no method '${call}'`);
+  }
+  return fn.bind(backend);
+}
+
+function quantile(sorted, q) {
+  return sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))];
+}
+
+function summarize(id, samplesNs) {
+  const totalNs = samplesNs.reduce((a, b) => a + b, 0);
+  const sorted = Float64Array.from(samplesNs).sort();
+  return {
+    id,
+    iterations: samplesNs.length,
+    opsPerSec: totalNs > 0 ? (samplesNs.length * 1e9) / totalNs : Infinity,
+    p50Us: quantile(sorted, 0.5) / 1e3,
+    p99Us: quantile(sorted, 0.99) / 1e3,
+    rssBytes: process.memoryUsage().rss,
+  };
+}
+
+function timeLoop(warmup, iterations, body) {
+  for (let i = 0; i < warmup; i++) body();
+  const samples = new Array(iterations);
+  for (let i = 0; i < iterations; i++) {
+    const start = process.hrtime.bigint();
+    body();
+    samples[i] = Number(process.hrtime.bigint() - start);
+  }
+  return samples;
+}
+
+function runMicro(backend, benchmark, measure) {
+  return benchmark.cases.map((c, index) => {
+    const fn = bindCall(backend, c.call);
+    const args = resolveArgs(c.args ?? [], new Map());
+    const samples = timeLoop(measure.warmup, measure.iterations, () => {
+      sink = fn(...args);
+    });
+    return { ...summarize(`${benchmark.id}[${index}]`, samples), call: c.call };
+  });
+}
+
+function runWorkflow(backend, benchmark, measure) {
+  const steps = benchmark.steps.map((step) => ({ ...step, fn: bindCall(backend, step.call) }));
+  const samples = timeLoop(measure.warmup, measure.iterations, () => {
+    const vars = new Map();
+    for (const step of steps) {
+      const out = step.fn(...resolveArgs(step.args ?? [], vars));
+      if (step.saveAs !== undefined) vars.set(step.saveAs, out);
+      if (step.sink) sink = out;
+    }
+  });
+  return [summarize(benchmark.id, samples)];
+}
+
+/**
+ * Run every micro and workflow benchmark in `suite` against `backend` (see {@link runScaling} for
+ * the rest).
+ *
+ * `resolveKernel(ref)` maps a fixture ref to an absolute path. A benchmark that throws is reported
+ * with an `error` instead of timings; the rest of the suite still runs.
+ */
+export function runSuite(suite, backend, resolveKernel) {
+  const results = [];
+  const defaultKernels = suite.defaults?.setup?.kernels ?? [];
+
+  for (const benchmark of suite.benchmarks) {
+    if (benchmark.kind === "scaling") continue;
+    const kernels = [...defaultKernels, ...(benchmark.setup?.kernels ?? [])];
+    try {
+      for (const ref of kernels) {
+        const absolutePath = resolveKernel(ref);
+        backend.furnsh({
+          path: `/kernels/${path.basename(absolutePath)}`,
+          bytes: new Uint8Array(fs.readFileSync(absolutePath)),
+        });
+      }
+      const measure = readMeasure(benchmark.measure);
+      const run = benchmark.kind === "micro" ? runMicro : runWorkflow;
+      results.push(...run(backend, benchmark, measure));
+    } catch (error) {
+      results.push({ id: benchmark.id, error: error instanceof Error ? error.message : String(error) });
+    } finally {
+      backend.kclear();
+    }
+  }
+
+  void sink;
+  return results;
+}
+
+/**
+ * Run every configuration of every scaling benchmark in `suite`, each in a fresh process with
+ * native stats enabled. A configuration that fails is reported with an `error`.
+ */
+export function runScaling(suite, backendName, resolveKernel) {
+  const results = [];
+  const defaultKernels = suite.defaults?.setup?.kernels ?? [];
+
+  for (const benchmark of suite.benchmarks) {
+    if (benchmark.kind !== "scaling") continue;
+    let base;
+    try {
+      base = {
+        backend: backendName,
+        id: benchmark.id,
+        call: benchmark.call,
+        args: benchmark.args ?? [],
+        kernels: [...defaultKernels, ...(benchmark.setup?.kernels ?? [])].map(resolveKernel),
+        mode: benchmark.sweep.mode ?? "threads",
+        ...readMeasure(benchmark.measure),
+      };
+    } catch (error) {
+      results.push({ id: benchmark.id, error: error instanceof Error ? error.message : String(error) });
+      continue;
+    }
+
+    for (const workers of benchmark.sweep.workers) {
+      for (const batchSize of benchmark.sweep.batchSizes ?? [1]) {
+        const config = { ...base, workers, batchSize };
+        const child = spawnSync(process.execPath, [scalingRunnerPath, JSON.stringify(config)], {
+          cwd: repoRoot,
+          encoding: "utf8",
+          env: { ...process.env, TSPICE_NATIVE_STATS: "1" },
+          stdio: ["ignore", "pipe", "pipe"],
+        });
+        const lastLine = (child.stdout ?? "").trim().split("\n").pop();
+        if (child.status === 0 && lastLine) {
+          results.push(JSON.parse(lastLine));
+        } else {
+          const detail = (child.stderr ?? "").trim().split("\n").pop();
+          results.push({
+            id: `${benchmark.id}[w=${workers},b=${batchSize}]`,
+            error: detail || `scaling runner exited with status ${child.status}`,
+          });
+        }
+      }
+    }
+  }
+
+  return results;
+}
+
+export async function loadCreateBackend() {
+  try {
+    return (await import("@rybosome/tspice")).createBackend;
+  } catch (error) {
+    if (!(error && typeof error === "object" && "code" in error && error.code === "ERR_MODULE_NOT_FOUND")) {
+      throw error;
+    }
+    const tspiceEntry = pathToFileURL(path.join(repoRoot, "packages", "tspice", "dist", "index.js"));
+    return (await import(tspiceEntry.href)).createBackend;
+  }
+}
+
+async function main() {
+  const args = process.argv.slice(2);
+  const backendIndex = args.indexOf("--backend");
+  const backendName = backendIndex === -1 ? undefined : args[backendIndex + 1];
+  const fileArg = args.find((arg, i) => !arg.startsWith("-") && i !== backendIndex + 1);
+  if ((backendName !== "node" && backendName !== "wasm") || !fileArg) {
+    console.error("Usage: node scripts/bench-contract-run.mjs --backend <node|wasm> <file>");
+    process.exit(1);
+  }
+
+  const { parseYamlFile, resolveFixtureRef } = await import("@rybosome/tspice-bench-contract/v1");
+  const parsed = parseYamlFile(path.resolve(process.cwd(), fileArg));
+  if (!parsed.ok) {
+    throw new Error(parsed.errors.map((e) => `${e.path}: ${e.message}`).join("\n"));
+  }
+  const suite = parsed.value;
+
+  const resolveKernel = (ref) => {
+    const resolved = resolveFixtureRef(ref, {
+      repoRoot,
+      ...(suite.fixtureRoots !== undefined ? { fixtureRoots: suite.fixtureRoots } : {}),
+      checkExistence: true,
+    });
+    if (!resolved.ok) throw new Error(`${ref}: ${resolved.message}`);
+    return resolved.absolutePath;
+  };
+
+  const createBackend = await loadCreateBackend();
+  const backend = await createBackend({ backend: backendName });
+  const results = [...runSuite(suite, backend, resolveKernel), ...runScaling(suite, backendName, resolveKernel)];
+
+  console.log(
+    JSON.stringify({
+      backend: backendName,
+      suite: suite.suite ?? null,
+      results,
+      // Peak resident set over the whole run, in bytes.
+      maxRssBytes: process.resourceUsage().maxRSS * 1024,
+    }),
+  );
+}
+
+if (process.argv[1] && import.meta.url === pathToFileURL(path.resolve(process.argv[1])).href) {
+  await main();
+}
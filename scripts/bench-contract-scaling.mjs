@@ -0,0 +1,235 @@
+// Runs one configuration (worker count x batch size) of a v1 `scaling` benchmark and prints its
+// result as JSON on stdout.
+//
+// `bench-contract-run.mjs` starts one of these per configuration with `TSPICE_NATIVE_STATS=1`, so
+// every configuration gets a fresh process, fresh native counters and its own peak RSS. The config
+// is a single JSON argument:
+//
+//   node scripts/bench-contract-scaling.mjs '{"backend":"node","id":"spkezr","call":"spkezr",
+//     "args":[...],"kernels":["/abs/naif0012.tls"],"mode":"threads","workers":4,"batchSize":64,
+//     "warmup":10,"iterations":100}'
+//
+// Each worker (a worker thread, or a child process in `processes` mode) creates its own backend and
+// loads the kernels. The coordinator then sends every worker `warmup` untimed batches, resets the
+// native stats, and sends `iterations` timed batches of `batchSize` calls; a worker gets its next
+// batch as soon as it acknowledges the previous one. Throughput is total timed calls over the wall
+// time of the timed phase.
+
+import { fork } from "node:child_process";
+import fs from "node:fs";
+import path from "node:path";
+import process from "node:process";
+import { fileURLToPath, pathToFileURL } from "node:url";
+import { isMainThread, parentPort, Worker, workerData } from "node:worker_threads";
+
+import { bindCall, loadCreateBackend, resolveArgs } from "./bench-contract-run.mjs";
+
+const scriptPath = fileURLToPath(import.meta.url);
+const repoRoot = path.resolve(path.dirname(scriptPath), "..");
+const WORKER_FLAG = "--worker";
+
+// Keeps results reachable so no call can be optimized away.
+let sink = null;
+
+async function loadNativeStats() {
+  try {
+    return await import("@rybosome/tspice-backend-node");
+  } catch (error) {
+    if (!(error && typeof error === "object" && "code" in error && error.code === "ERR_MODULE_NOT_FOUND")) {
+      throw error;
+    }
+    const entry = pathToFileURL(path.join(repoRoot, "packages", "backend-node", "dist", "index.js"));
+    return await import(entry.href);
+  }
+}
+
+/** Sum lock wait/hold and marshalling time over every export (and unattributed lock use). */
+function summarizeNativeStats(stats) {
+  if (!stats.enabled) return null;
+  const out = { lockWaitNs: 0, lockWaitMaxNs: 0, cspiceNs: 0, marshalNs: 0 };
+  for (const s of Object.values(stats.exports)) {
+    out.lockWaitNs += s.lockWait.sumNs;
+    out.lockWaitMaxNs = Math.max(out.lockWaitMaxNs, s.lockWait.maxNs);
+    out.cspiceNs += s.cspice.sumNs;
+    out.marshalNs += s.marshal.sumNs;
+  }
+  return out;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Worker side: one backend, answering `batch` / `reset` / `finish` requests from the coordinator.
+// ---------------------------------------------------------------------------------------------
+
+async function runWorker(config, send, onMessage) {
+  let backend;
+  let fn;
+  let args;
+  let nativeStats = null;
+  try {
+    const createBackend = await loadCreateBackend();
+    backend = await createBackend({ backend: config.backend });
+    for (const absolutePath of config.kernels) {
+      backend.furnsh({
+        path: `/kernels/${path.basename(absolutePath)}`,
+        bytes: new Uint8Array(fs.readFileSync(absolutePath)),
+      });
+    }
+    fn = bindCall(backend, config.call);
+    args = resolveArgs(config.args ?? [], new Map());
+    if (config.backend === "node") nativeStats = await loadNativeStats();
+    send({ type: "ready" });
+  } catch (error) {
+    send({ type: "error", message: error instanceof Error ? error.message : String(error) });
+    return;
+  }
+
+  onMessage((msg) => {
+    try {
+      if (msg.type === "batch") {
+        for (let i = 0; i < msg.calls; i++) sink = fn(...args);
+        send({ type: "done" });
+      } else if (msg.type === "reset") {
+        nativeStats?.resetNativeStats();
+        send({ type: "done" });
+      } else if (msg.type === "finish") {
+        const stats = nativeStats === null ? null : summarizeNativeStats(nativeStats.getNativeStats());
+        // No kclear: threads share one CSPICE pool, and the process exits right after.
+        void sink;
+        send({ type: "stats", stats, maxRssBytes: process.resourceUsage().maxRSS * 1024 });
+      }
+    } catch (error) {
+      send({ type: "error", message: error instanceof Error ? error.message : String(error) });
+    }
+  });
+}
+
+// ---------------------------------------------------------------------------------------------
+// Coordinator side.
+// ---------------------------------------------------------------------------------------------
+
+/** Start one worker and wrap it as a strictly request/response channel. */
+function startWorker(config) {
+  const handle =
+    config.mode === "processes"
+      ? fork(scriptPath, [WORKER_FLAG, JSON.stringify(config)], { stdio: ["ignore", "ignore", "inherit", "ipc"] })
+      : new Worker(scriptPath, { workerData: config });
+
+  let pending = null;
+  handle.on("message", (msg) => {
+    const p = pending;
+    pending = null;
+    if (p === null) return;
+    if (msg.type === "error") p.reject(new Error(msg.message));
+    else p.resolve(msg);
+  });
+  handle.on("error", (error) => {
+    const p = pending;
+    pending = null;
+    p?.reject(error);
+  });
+  handle.on("exit", (code) => {
+    const p = pending;
+    pending = null;
+    p?.reject(new Error(`worker exited with code ${code}`));
+  });
+
+  const next = () =>
+    new Promise((resolve, reject) => {
+      pending = { resolve, reject };
+    });
+
+  return {
+    ready: next(),
+    request(msg) {
+      const reply = next();
+      if (config.mode === "processes") handle.send(msg);
+      else handle.postMessage(msg);
+      return reply;
+    },
+    terminate() {
+      if (config.mode === "processes") handle.kill();
+      else void handle.terminate();
+    },
+  };
+}
+
+async function runBatches(worker, batches, calls) {
+  for (let i = 0; i < batches; i++) await worker.request({ type: "batch", calls });
+}
+
+async function runConfig(config) {
+  const workers = Array.from({ length: config.workers }, () => startWorker(config));
+  try {
+    await Promise.all(workers.map((w) => w.ready));
+    await Promise.all(workers.map((w) => runBatches(w, config.warmup, config.batchSize)));
+
+    // Native counters are per process: one reset covers every worker thread.
+    const resetters = config.mode === "processes" ? workers : workers.slice(0, 1);
+    await Promise.all(resetters.map((w) => w.request({ type: "reset" })));
+
+    const start = process.hrtime.bigint();
+    await Promise.all(workers.map((w) => runBatches(w, config.iterations, config.batchSize)));
+    const wallNs = Number(process.hrtime.bigint() - start);
+
+    const finals = await Promise.all(workers.map((w) => w.request({ type: "finish" })));
+    const perProcess = config.mode === "processes" ? finals : finals.slice(0, 1);
+    const calls = config.workers * config.iterations * config.batchSize;
+
+    let native = null;
+    for (const { stats } of perProcess) {
+      if (stats === null) continue;
+      native ??= { lockWaitNs: 0, lockWaitMaxNs: 0, cspiceNs: 0, marshalNs: 0 };
+      native.lockWaitNs += stats.lockWaitNs;
+      native.lockWaitMaxNs = Math.max(native.lockWaitMaxNs, stats.lockWaitMaxNs);
+      native.cspiceNs += stats.cspiceNs;
+      native.marshalNs += stats.marshalNs;
+    }
+
+    // Threads share this process's RSS; child processes add their own.
+    let rssBytes = process.resourceUsage().maxRSS * 1024;
+    if (config.mode === "processes") {
+      for (const f of finals) rssBytes += f.maxRssBytes;
+    }
+
+    return {
+      id: `${config.id}[w=${config.workers},b=${config.batchSize}]`,
+      call: config.call,
+      mode: config.mode,
+      workers: config.workers,
+      batchSize: config.batchSize,
+      calls,
+      wallMs: wallNs / 1e6,
+      opsPerSec: wallNs > 0 ? (calls * 1e9) / wallNs : Infinity,
+      // Per timed call, summed over workers; null when the backend has no native stats.
+      lockWaitUs: native === null ? null : native.lockWaitNs / calls / 1e3,
+      lockWaitMaxUs: native === null ? null : native.lockWaitMaxNs / 1e3,
+      cspiceUs: native === null ? null : native.cspiceNs / calls / 1e3,
+      marshalUs: native === null ? null : native.marshalNs / calls / 1e3,
+      rssBytes,
+    };
+  } finally {
+    for (const w of workers) w.terminate();
+  }
+}
+
+if (!isMainThread) {
+  await runWorker(
+    workerData,
+    (msg) => parentPort.postMessage(msg),
+    (handler) => parentPort.on("message", handler),
+  );
+} else if (process.argv[2] === WORKER_FLAG) {
+  await runWorker(
+    JSON.parse(process.argv[3]),
+    (msg) => process.send(msg),
+    (handler) => process.on("message", handler),
+  );
+} else if (process.argv[1] && import.meta.url === pathToFileURL(path.resolve(process.argv[1])).href) {
+  const config = JSON.parse(process.argv[2] ?? "null");
+  if (config === null) {
+    console.error("Usage: node scripts/bench-contract-scaling.mjs '<config json>'");
+    process.exit(1);
+  }
+  console.log(JSON.stringify(await runConfig(config)));
+  process.exit(0);
+}
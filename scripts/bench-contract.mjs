@@ -1,3 +1,4 @@
+import { spawnSync } from "node:child_process";
 import path from "node:path";
 import process from "node:process";
 import { fileURLToPath } from "node:url";
@@ -7,13 +8,20 @@ import { parseYamlFile, validateBenchmarkSuiteV1 } from "@rybosome/tspice-bench-
 const USAGE_TEXT = [
   "Usage:",
   "  pnpm bench:contract validate [--json] [--no-check-fixtures] <file>",
+  "  pnpm bench:contract run [--json] [--backend <node|wasm|all>] <file>",
   "",
   "Examples:",
   "  pnpm bench:contract validate benchmarks/contracts/v1/example.yml",
   "  pnpm bench:contract validate --json benchmarks/contracts/v1/example.yml",
   "  pnpm bench:contract validate --no-check-fixtures benchmarks/contracts/v1/example.yml",
+  "  pnpm bench:contract run benchmarks/contracts/v1/core.yml",
+  "  pnpm bench:contract run --backend wasm --json benchmarks/contracts/v1/core.yml",
+  "  pnpm bench:contract run --backend node benchmarks/contracts/v1/scaling.yml",
 ].join("\n");
 
+const COMMANDS = new Set(["validate", "run"]);
+const BACKENDS = ["node", "wasm"];
+
 const args = process.argv.slice(2);
 const json = args.includes("--json");
 const command = args[0];
@@ -81,9 +89,12 @@ function failValidate(errors) {
 }
 
 let checkFixtures = true;
+let backendArg = "all";
 let fileArg = null;
 
-for (const arg of args.slice(1)) {
+for (let i = 1; i < args.length; i += 1) {
+  const arg = args[i];
+
   if (arg === "--json") {
     continue;
   }
@@ -93,6 +104,15 @@ for (const arg of args.slice(1)) {
     continue;
   }
 
+  if (arg === "--backend" && command === "run") {
+    backendArg = args[i + 1];
+    i += 1;
+    if (backendArg !== "all" && !BACKENDS.includes(backendArg)) {
+      failUsage(`Unknown backend: ${backendArg ?? "<missing>"}`);
+    }
+    continue;
+  }
+
   if (arg.startsWith("-")) {
     failUsage(`Unknown argument: ${arg}`);
   }
@@ -104,9 +124,9 @@ for (const arg of args.slice(1)) {
   fileArg = arg;
 }
 
-if (command !== "validate" || !fileArg) {
+if (!COMMANDS.has(command) || !fileArg) {
   failUsage(
-    command !== "validate"
+    !COMMANDS.has(command)
       ? `Unknown command: ${command ?? "<missing>"}`
       : "Missing required <file> argument.",
   );
@@ -129,9 +149,91 @@ if (!validated.ok) {
   failValidate(validated.errors);
 }
 
+if (command === "validate") {
+  if (json) {
+    emitJsonResult({ ok: true, kind: "success", errors: [] });
+  } else {
+    // eslint-disable-next-line no-console
+    console.log("OK");
+  }
+  process.exit(0);
+}
+
+// Each backend runs in its own process so RSS reflects that backend alone.
+const runnerPath = path.join(repoRoot, "scripts", "bench-contract-run.mjs");
+const runs = [];
+for (const backend of backendArg === "all" ? BACKENDS : [backendArg]) {
+  const child = spawnSync(process.execPath, [runnerPath, "--backend", backend, filePath], {
+    cwd: repoRoot,
+    encoding: "utf8",
+    stdio: ["ignore", "pipe", json ? "pipe" : "inherit"],
+  });
+  const lastLine = (child.stdout ?? "").trim().split("\n").pop();
+  if (child.status === 0 && lastLine) {
+    runs.push(JSON.parse(lastLine));
+  } else {
+    const detail = (child.stderr ?? "").trim().split("\n").pop();
+    runs.push({ backend, error: detail || `runner exited with status ${child.status}` });
+  }
+}
+
 if (json) {
-  emitJsonResult({ ok: true, kind: "success", errors: [] });
+  emitJson({ ok: runs.some((r) => r.error === undefined), kind: "run", file: fileArg, runs });
 } else {
-  // eslint-disable-next-line no-console
-  console.log("OK");
+  printRunTable(runs);
+}
+
+function formatNumber(value, digits) {
+  return Number.isFinite(value) ? value.toFixed(digits) : "-";
+}
+
+function printRunTable(runs) {
+  const rows = [["benchmark", "backend", "ops/s", "p50 us", "p99 us", "lock us", "rss MB", "vs node"]];
+  const nodeOps = new Map();
+  for (const run of runs) {
+    if (run.backend !== "node" || run.error !== undefined) continue;
+    for (const r of run.results) nodeOps.set(r.id, r.opsPerSec);
+  }
+
+  for (const run of runs) {
+    if (run.error !== undefined) {
+      // eslint-disable-next-line no-console
+      console.error(`${run.backend}: skipped (${run.error})`);
+      continue;
+    }
+    for (const r of run.results) {
+      if (r.error !== undefined) {
+        rows.push([r.id, run.backend, `error: ${r.error}`, "", "", "", "", ""]);
+        continue;
+      }
+      const baseline = nodeOps.get(r.id);
+      rows.push([
+        r.id,
+        run.backend,
+        formatNumber(r.opsPerSec, 0),
+        formatNumber(r.p50Us, 2),
+        formatNumber(r.p99Us, 2),
+        // Scaling rows only: mean CSPICE mutex wait per call (node backend).
+        r.lockWaitUs === undefined ? "" : formatNumber(r.lockWaitUs ?? NaN, 2),
+        formatNumber(r.rssBytes / 2 ** 20, 1),
+        baseline === undefined ? "" : `${formatNumber(r.opsPerSec / baseline, 2)}x`,
+      ]);
+    }
+    rows.push([
+      "(peak)",
+      run.backend,
+      "",
+      "",
+      "",
+      "",
+      formatNumber(run.maxRssBytes / 2 ** 20, 1),
+      "",
+    ]);
+  }
+
+  const widths = rows[0].map((_, col) => Math.max(...rows.map((row) => row[col].length)));
+  for (const row of rows) {
+    // eslint-disable-next-line no-console
+    console.log(row.map((cell, col) => cell.padEnd(widths[col])).join("  ").trimEnd());
+  }
 }
@@ -6,6 +6,7 @@ import { fileURLToPath } from "node:url";
 import {
   WASM_BINARY_FILENAME,
   WASM_NODE_JS_FILENAME,
+  WASM_SIMD_BINARY_FILENAME,
   WASM_WEB_JS_FILENAME,
 } from "./backend-wasm-assets.mjs";
 
@@ -476,11 +477,12 @@ const commonEmccArgs = [
   `EXPORTED_FUNCTIONS=['${exportedFunctions.join("','")}']`,
 ];
 
-function runEmcc({ environment, outputJsPath }) {
+function runEmcc({ environment, outputJsPath, extraArgs = [] }) {
   execFileSync(
     "emcc",
     [
       ...commonEmccArgs,
+      ...extraArgs,
       "-s",
       `ENVIRONMENT=${environment}`,
       "-o",
@@ -558,6 +560,55 @@ fs.copyFileSync(outputWebWasmPath, outputWasmPath);
 fs.rmSync(outputWebWasmPath);
 fs.rmSync(outputNodeWasmPath);
 
+// --- SIMD flavour ---------------------------------------------------------
+//
+// Same sources and settings plus `-msimd128` (and `-O3` so the loop vectorizer
+// runs). The ABI (imports/exports) must match the scalar build exactly so the
+// checked-in glue JS can drive either binary; the runtime picks one via
+// `wasmFlavor`.
+//
+// Set TSPICE_WASM_SKIP_SIMD=1 to skip it.
+const outputSimdWasmPath = path.join(outputDir, WASM_SIMD_BINARY_FILENAME);
+if (process.env.TSPICE_WASM_SKIP_SIMD === "1") {
+  console.log("Skipping SIMD wasm flavour (TSPICE_WASM_SKIP_SIMD=1)");
+} else {
+  const simdBuildDir = path.join(wasmBuildDir, "simd");
+  fs.mkdirSync(simdBuildDir, { recursive: true });
+  const simdJsPath = path.join(simdBuildDir, WASM_WEB_JS_FILENAME);
+
+  runEmcc({
+    environment: "web,worker",
+    outputJsPath: simdJsPath,
+    // Later flags win, so `-O3` overrides the common `-O2`.
+    extraArgs: ["-msimd128", "-O3"],
+  });
+
+  const simdWasmPath = simdJsPath.replace(/\.js$/, ".wasm");
+  if (!fs.existsSync(simdWasmPath)) {
+    throw new Error(`Expected Emscripten to write ${simdWasmPath} but it was missing`);
+  }
+
+  const describeAbi = (bytes) => {
+    const mod = new WebAssembly.Module(bytes);
+    return JSON.stringify({
+      imports: WebAssembly.Module.imports(mod),
+      exports: WebAssembly.Module.exports(mod),
+    });
+  };
+
+  const scalarAbi = describeAbi(fs.readFileSync(outputWasmPath));
+  const simdBytes = fs.readFileSync(simdWasmPath);
+  if (describeAbi(simdBytes) !== scalarAbi) {
+    throw new Error(
+      `SIMD wasm imports/exports differ from the scalar build, so the shared glue JS cannot load it:\n` +
+        `- ${simdWasmPath}\n` +
+        `- ${outputWasmPath}`,
+    );
+  }
+
+  fs.copyFileSync(simdWasmPath, outputSimdWasmPath);
+}
+
 const generatedHeader = `// GENERATED FILE - DO NOT EDIT.\n// Regenerate via: node scripts/build-backend-wasm.mjs\n\n`;
 
 function ensureGeneratedHeader(jsPath) {
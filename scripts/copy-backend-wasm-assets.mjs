@@ -5,6 +5,7 @@ import { fileURLToPath } from "node:url";
 import {
   WASM_BINARY_FILENAME,
   WASM_NODE_JS_FILENAME,
+  WASM_SIMD_BINARY_FILENAME,
   WASM_WEB_JS_FILENAME,
 } from "./backend-wasm-assets.mjs";
 
@@ -15,6 +16,9 @@ const srcDir = path.join(backendWasmRoot, "emscripten");
 const distDir = path.join(backendWasmRoot, "dist");
 
 const assets = [WASM_WEB_JS_FILENAME, WASM_NODE_JS_FILENAME, WASM_BINARY_FILENAME];
+// Copied when present; the runtime falls back to the scalar build without it.
+const optionalAssets = new Set([WASM_SIMD_BINARY_FILENAME]);
+const wasmAssets = new Set([WASM_BINARY_FILENAME, WASM_SIMD_BINARY_FILENAME]);
 
 function fsyncDirBestEffort(dir) {
   // Best-effort durability; not supported everywhere.
@@ -86,9 +90,14 @@ function validateWasmSync(wasmPath, expectedSize) {
   }
 }
 
-for (const asset of assets) {
+for (const asset of [...assets, ...optionalAssets]) {
   const srcPath = path.join(srcDir, asset);
   const destPath = path.join(distDir, asset);
+  if (!fs.existsSync(srcPath) && optionalAssets.has(asset)) {
+    // Don't leave a stale copy from an earlier build behind.
+    fs.rmSync(destPath, { force: true });
+    continue;
+  }
   if (!fs.existsSync(srcPath)) {
     throw new Error(
       `Missing ${asset}. Run node scripts/build-backend-wasm.mjs to generate it.`,
@@ -101,7 +110,7 @@ for (const asset of assets) {
   const srcBytes = fs.readFileSync(srcPath);
   atomicWriteFileSync(destPath, srcBytes);
 
-  if (asset === WASM_BINARY_FILENAME) {
+  if (wasmAssets.has(asset)) {
     validateWasmSync(destPath, srcBytes.length);
   }
 }
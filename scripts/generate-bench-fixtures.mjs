@@ -0,0 +1,123 @@
+// Regenerates the synthetic SPK in `packages/tspice/test/fixtures/kernels/bench-v1/`.
+//
+// The benchmark suite needs ephemerides for a handful of bodies over a short span, and the NAIF
+// planetary SPKs are far larger than a fixture should be. This writes two-body (Keplerian) orbits
+// for Earth and the Moon plus two bodies held at fixed offsets from Earth, sampled into type 8
+// segments. The output is deterministic: re-running it reproduces the committed file byte for byte.
+//
+// Usage:
+//   node scripts/generate-bench-fixtures.mjs
+
+import fs from "node:fs";
+import path from "node:path";
+import { fileURLToPath, pathToFileURL } from "node:url";
+
+const scriptsDir = path.dirname(fileURLToPath(import.meta.url));
+const repoRoot = path.resolve(scriptsDir, "..");
+const fixtureDir = path.join(repoRoot, "packages", "tspice", "test", "fixtures", "kernels", "bench-v1");
+
+const DAY = 86_400;
+
+/** Coverage of every segment (TDB seconds past J2000). */
+export const BENCH_SPK_SPAN = { first: -10 * DAY, last: 40 * DAY };
+
+const GM_SUN = 1.32712440018e11;
+const GM_EARTH = 398_600.4418;
+const DEG = Math.PI / 180;
+
+// Osculating elements at J2000 (km, radians), relative to the J2000 equator and equinox.
+const EARTH_ORBIT = { gm: GM_SUN, a: 149_598_023, e: 0.0167, i: 23.44 * DEG, node: 0, peri: 102.9 * DEG, m0: 357.5 * DEG };
+const MOON_ORBIT = { gm: GM_EARTH, a: 384_400, e: 0.0549, i: 28.6 * DEG, node: 125.0 * DEG, peri: 318.1 * DEG, m0: 135.3 * DEG };
+
+function keplerState({ gm, a, e, i, node, peri, m0 }, t) {
+  const n = Math.sqrt(gm / (a * a * a));
+  const m = m0 + n * t;
+  let ea = m;
+  for (let k = 0; k < 30; k++) ea -= (ea - e * Math.sin(ea) - m) / (1 - e * Math.cos(ea));
+
+  const cosE = Math.cos(ea);
+  const sinE = Math.sin(ea);
+  const b = a * Math.sqrt(1 - e * e);
+  // Perifocal position/velocity.
+  const px = a * (cosE - e);
+  const py = b * sinE;
+  const edot = n / (1 - e * cosE);
+  const vx = -a * sinE * edot;
+  const vy = b * cosE * edot;
+
+  const cO = Math.cos(node);
+  const sO = Math.sin(node);
+  const cw = Math.cos(peri);
+  const sw = Math.sin(peri);
+  const ci = Math.cos(i);
+  const si = Math.sin(i);
+  const p = [cO * cw - sO * sw * ci, sO * cw + cO * sw * ci, sw * si];
+  const q = [-cO * sw - sO * cw * ci, -sO * sw + cO * cw * ci, cw * si];
+
+  return [0, 1, 2].map((k) => px * p[k] + py * q[k]).concat([0, 1, 2].map((k) => vx * p[k] + vy * q[k]));
+}
+
+function sampleOrbit(orbit, step) {
+  const { first, last } = BENCH_SPK_SPAN;
+  const n = Math.round((last - first) / step) + 1;
+  const states = new Float64Array(n * 6);
+  for (let k = 0; k < n; k++) states.set(keplerState(orbit, first + k * step), k * 6);
+  return states;
+}
+
+function fixedOffset(offset) {
+  const { first, last } = BENCH_SPK_SPAN;
+  return { states: Float64Array.from([...offset, 0, 0, 0, ...offset, 0, 0, 0]), step: last - first };
+}
+
+/** Body, center, segment id, Lagrange degree and samples for every segment in the file. */
+export function benchSpkSegments() {
+  return [
+    { body: 10, center: 0, segid: "BENCH SUN", degree: 1, ...fixedOffset([0, 0, 0]) },
+    { body: 399, center: 10, segid: "BENCH EARTH", degree: 7, states: sampleOrbit(EARTH_ORBIT, DAY / 4), step: DAY / 4 },
+    { body: 301, center: 399, segid: "BENCH MOON", degree: 7, states: sampleOrbit(MOON_ORBIT, 3600), step: 3600 },
+    // A spacecraft 20,000 km above the north pole, looking down at Earth.
+    { body: -900, center: 399, segid: "BENCH SC", degree: 1, ...fixedOffset([0, 0, 20_000]) },
+    // Apophis parked 50,000 km from Earth along +X, so the DSK shape model is a fixed target.
+    { body: 2099942, center: 399, segid: "BENCH APOPHIS", degree: 1, ...fixedOffset([50_000, 0, 0]) },
+  ];
+}
+
+/** Write the bench SPK through `backend` and return its bytes. */
+export function generateBenchSpk(backend) {
+  const output = { kind: "virtual-output", path: "bench-v1.bsp" };
+  const handle = backend.spkopn(output, "TSPICE BENCH V1", 0);
+  try {
+    const { first, last } = BENCH_SPK_SPAN;
+    for (const seg of benchSpkSegments()) {
+      backend.spkw08(handle, seg.body, seg.center, "J2000", first, last, seg.segid, seg.degree, seg.states, first, seg.step);
+    }
+  } finally {
+    backend.spkcls(handle);
+  }
+  return backend.readVirtualOutput(output);
+}
+
+async function main() {
+  let createBackend;
+  try {
+    ({ createBackend } = await import("@rybosome/tspice"));
+  } catch (error) {
+    if (!(error && typeof error === "object" && "code" in error && error.code === "ERR_MODULE_NOT_FOUND")) {
+      throw error;
+    }
+    const tspiceEntry = pathToFileURL(path.join(repoRoot, "packages", "tspice", "dist", "index.js"));
+    ({ createBackend } = await import(tspiceEntry.href));
+  }
+
+  // WASM, so the output does not depend on the host's native build.
+  const backend = await createBackend({ backend: "wasm" });
+  const bytes = generateBenchSpk(backend);
+  const outPath = path.join(fixtureDir, "bench-v1.bsp");
+  fs.writeFileSync(outPath, bytes);
+  console.log(`Wrote ${path.relative(repoRoot, outPath)} (${bytes.length} bytes)`);
+}
+
+if (process.argv[1] && import.meta.url === pathToFileURL(path.resolve(process.argv[1])).href) {
+  await main();
+}